@@ -22,16 +22,24 @@ buf_t  *g_lbases;   /* module object module search bases */
 fsbuf_t g_funcsigs; /* unique function signatures */
 sym_t   g_crt_mod;  /* C runtime module */
 sym_t   g_wasi_mod; /* WASI module */
+sym_t   g_wasit_mod; /* WASI threads module */
 sym_t   g_lm_id;    /* id for linear memory */
 sym_t   g_sp_id;    /* id for stack pointer global */
 sym_t   g_sb_id;    /* id for stack base global */
 sym_t   g_hb_id;    /* id for heap base global */
 size_t  g_sdbaddr;  /* static data allocation start */
 size_t  g_stacksz;  /* stack size in bytes */
+bool    g_stkauto;  /* size stack by stack usage analysis */
+bool    g_stkcheck; /* trap on stack overflow */
+bool    g_stkreport; /* report stack usage */
 size_t  g_argvbsz;  /* argv buf size in bytes */
+size_t  g_imempg;   /* initial memory size in pages, or 0 */
+size_t  g_mmempg;   /* maximum memory size in pages, or 0 */
+bool    g_sharedmem; /* imported shared memory (threads) */
+size_t  g_mvlimit;  /* max struct fields passed as multiple values */
 
 /* initialize wcpl environment */
-void init_wcpl(dsbuf_t *pincv, dsbuf_t *plibv, long optlvl, size_t sarg, size_t aarg)
+void init_wcpl(dsbuf_t *pincv, dsbuf_t *plibv, long optlvl, size_t sarg, size_t aarg, size_t imarg, size_t mmarg, bool smarg, size_t mvarg, bool starg, bool scarg, bool srarg)
 {
   size_t i; char *ipath;
   g_optlvl = optlvl; 
@@ -51,6 +59,7 @@ void init_wcpl(dsbuf_t *pincv, dsbuf_t *plibv, long optlvl, size_t sarg, size_t
   }
   fsbinit(&g_funcsigs);
   g_wasi_mod = intern("wasi_snapshot_preview1");
+  g_wasit_mod = intern("wasi");
   g_crt_mod = intern("crt");
   g_lm_id = intern("memory");
   g_sp_id = intern("sp$");
@@ -58,7 +67,14 @@ void init_wcpl(dsbuf_t *pincv, dsbuf_t *plibv, long optlvl, size_t sarg, size_t
   g_hb_id = intern("heap_base");
   g_sdbaddr = 1024; /* >0, 16-aligned: address 0 reserved for NULL */
   g_stacksz = sarg; /* 64K default */
+  g_stkauto = starg; /* false: use g_stacksz */
+  g_stkcheck = scarg; /* false: no overflow checks */
+  g_stkreport = srarg; /* false: no stack usage report */
   g_argvbsz = aarg; /* 4K default */
+  g_imempg = imarg; /* 0: just enough for data, stack and argv */
+  g_mmempg = mmarg; /* 0: no maximum */
+  g_sharedmem = smarg; /* false: private memory */
+  g_mvlimit = mvarg; /* 0: small structs are passed via memory */
 } 
 
 /* finalize wcpl environment */
@@ -67,7 +83,7 @@ void fini_wcpl(void)
   freebuf(g_ibases);
   freebuf(g_lbases);
   fsbfini(&g_funcsigs);
-  g_wasi_mod = g_crt_mod = 0;
+  g_wasi_mod = g_wasit_mod = g_crt_mod = 0;
   g_lm_id = g_sp_id = 0;
 }
 
@@ -758,6 +774,51 @@ size_t measure_offset(const node_t *ptn, node_t *prn, sym_t fld, node_t **ppftn)
   return 0; /* won't happen */
 }
 
+/* multi-value convention: structures of up to g_mvlimit scalar fields
+ * (possibly in nested structures) are passed and returned as multiple
+ * values, one per field; others are passed via memory */
+#define MVF_MAXDEPTH 4
+typedef struct mvfld {
+  size_t off;               /* offset from the start of the structure */
+  const node_t *ptn;        /* scalar field type */
+  int depth;                /* length of field path */
+  sym_t path[MVF_MAXDEPTH]; /* field names from the outermost structure */
+} mvfld_t;
+
+static bool mv_collect(const node_t *ptn, size_t off, const mvfld_t *ppf, buf_t *pmvb)
+{
+  size_t i;
+  if (ptn->name && !ndlen(ptn)) ptn = lookup_eus_type(TS_STRUCT, ptn->name);
+  if (!ptn || (ppf && ppf->depth == MVF_MAXDEPTH)) return false;
+  for (i = 0; i < ndlen(ptn); ++i) {
+    const node_t *pni = ndcref(ptn, i), *ptni; mvfld_t mvf;
+    if (pni->nt != NT_VARDECL || !pni->name || ndlen(pni) != 1) return false;
+    ptni = ndcref(pni, 0);
+    if (ppf) mvf = *ppf; else memset(&mvf, 0, sizeof(mvfld_t));
+    mvf.path[mvf.depth++] = pni->name;
+    mvf.off = off + measure_offset(ptn, NULL, pni->name, NULL);
+    if (ptni->ts == TS_STRUCT) {
+      if (!mv_collect(ptni, mvf.off, &mvf, pmvb)) return false;
+    } else if (ptni->ts == TS_V128 || ts2vt(ptni->ts) == VT_UNKN) {
+      return false; /* arrays, unions, simd vectors */
+    } else {
+      if (buflen(pmvb) == g_mvlimit) return false;
+      mvf.ptn = ptni; *(mvfld_t*)bufnewbk(pmvb) = mvf;
+    }
+  }
+  return true;
+}
+
+/* check if ptn is passed as multiple values; if so, put its fields into pmvb */
+static bool mv_struct(const node_t *ptn, buf_t *pmvb)
+{
+  bufclear(pmvb);
+  if (g_mvlimit == 0 || ptn->ts != TS_STRUCT) return false;
+  if (mv_collect(ptn, 0, NULL, pmvb) && buflen(pmvb) > 0) return true;
+  bufclear(pmvb);
+  return false;
+}
+
 /* intern the string literal, return fresh data id */
 static sym_t intern_strlit(node_t *pn)
 {
@@ -791,7 +852,7 @@ bool static_eval(node_t *pn, buf_t *prib, seval_t *pr)
           node_t vn = mknd();
           ts_t ets = (pn->ts == TS_STRING) ? TS_CHAR : TS_INT;
           id = intern_strlit(pn); /* sets pn->name */
-          ndset(&vn, NT_VARDECL, pn->pwsid, pn->startpos);
+          ndset(&vn, NT_VARDECL, pn->loc);
           vn.name = id;
           wrap_type_pointer(ndsettype(ndnewbk(&vn), ets));
           /* post id so initialize_bulk_data can find it */
@@ -997,7 +1058,7 @@ bool arithmetic_eval(node_t *pn, buf_t *prib, node_t *prn)
 {
   seval_t r; bool ok = false;
   if (static_eval(pn, prib, &r) && ts_numerical(r.ts)) {
-    ndset(prn, NT_LITERAL, pn->pwsid, pn->startpos); 
+    ndset(prn, NT_LITERAL, pn->loc); 
     prn->ts = r.ts; prn->val = r.val; 
     ok = true;
   }
@@ -1063,7 +1124,7 @@ static node_t *vardef_check_type(node_t *ptn)
         int count = 0;
         if (!arithmetic_eval_to_int(pcn, NULL, &count) || count <= 0)
           n2eprintf(pcn, ptn, "array size should be positive constant");
-        ndset(pcn, NT_LITERAL, pcn->pwsid, pcn->startpos);
+        ndset(pcn, NT_LITERAL, pcn->loc);
         pcn->ts = TS_INT; pcn->val.i = count;
       }
     } break;
@@ -1079,7 +1140,7 @@ static node_t *vardef_check_type(node_t *ptn)
 /* check if this function type is legal in WCPL */
 static void fundef_check_type(node_t *ptn)
 {
-  size_t i;
+  size_t i; buf_t mvb = mkbuf(sizeof(mvfld_t));
   assert(ptn->nt == NT_TYPE && ptn->ts == TS_FUNCTION);
   for (i = 0; i < ndlen(ptn); ++i) {
     node_t *ptni = ndref(ptn, i); 
@@ -1108,7 +1169,8 @@ static void fundef_check_type(node_t *ptn)
         } /* else neprintf(ptni, "not supported: array as function parameter/return type"); */
       } break;
       case TS_STRUCT:
-        if (i > 0) neprintf(ptni, "not supported: struct as function parameter type");
+        if (i > 0 && !mv_struct(ptni, &mvb)) /* small ones are passed as multiple values */
+          neprintf(ptni, "not supported: struct as function parameter type");
         break;
       case TS_UNION:
         if (i > 0) neprintf(ptni, "not supported: union as function parameter type");
@@ -1120,6 +1182,7 @@ static void fundef_check_type(node_t *ptn)
         neprintf(ptni, "function arguments of this type are not supported: %s", ts_name(ptni->ts));
     }
   }
+  buffini(&mvb);
 }
 
 /* try to replace simd display expression with equivalent literal (see below) */
@@ -1613,7 +1676,7 @@ static bool fold_simd_display(node_t *pn, buf_t *prib)
     size_t n = ndlen(pn), i; int cnt;
     if (ndlen(ptn) == 2 && arithmetic_eval_to_int(ndref(ptn, 1), prib, &cnt) && (int)n == cnt+1) { 
       ts_t vets = ndref(ptn, 0)->ts; assert(ts_numerical_or_enum(vets));
-      ndset(prn, NT_LITERAL, pn->pwsid, pn->startpos);
+      ndset(prn, NT_LITERAL, pn->loc);
       prn->ts = TS_V128; assert(prn->data.esz == sizeof(char));
       prn->val.i = vets; /* kluge: val.i is used as type hint  */
       cbclear(&prn->data); ok = true;
@@ -1799,24 +1862,24 @@ static void expr_wasmify(node_t *pn, buf_t *pvib, buf_t *plib)
       if (pvi) {
         if (pvi->sc == SC_AUTO && !pvi->fld) { /* indirect */
           pn->name = pvi->reg;
-          wrap_unary_operator(pn, pn->startpos, TT_STAR);
+          wrap_unary_operator(pn, pn->loc, TT_STAR);
         } else if (pvi->sc == SC_AUTO) { /* ->fld */
           pn->name = pvi->reg;
           wrap_postfix_operator
-            (wrap_unary_operator(pn, pn->startpos, TT_STAR), 
+            (wrap_unary_operator(pn, pn->loc, TT_STAR), 
              TT_DOT, pvi->fld);
         } else { /* in register, just fix name */
           pn->name = pvi->reg;
         }
         if (pvi->cast != TS_VOID) { /* add narrowing cast */
-          node_t cn = mknd(); ndset(&cn, NT_TYPE, -1, -1); cn.ts = pvi->cast;
+          node_t cn = mknd(); ndset(&cn, NT_TYPE, 0); cn.ts = pvi->cast;
           wrap_expr_cast(pn, &cn); ndfini(&cn);
         }
       } else { /* global */
         const node_t *ptn = lookup_global(pn->name);
         if (ptn && ptn->nt == NT_IMPORT && ndlen(ptn) == 1) ptn = ndcref(ptn, 0);
         if (ptn && ptn->nt == NT_TYPE && ptn->ts >= TS_BOOL && ptn->ts < TS_INT) { /* add narrowing cast */
-          node_t cn = mknd(); ndset(&cn, NT_TYPE, -1, -1); cn.ts = ptn->ts;
+          node_t cn = mknd(); ndset(&cn, NT_TYPE, 0); cn.ts = ptn->ts;
           wrap_expr_cast(pn, &cn); ndfini(&cn);
         }
       }
@@ -1830,7 +1893,7 @@ static void expr_wasmify(node_t *pn, buf_t *pvib, buf_t *plib)
           assert(pvi->sc == SC_REGISTER && !pvi->fld);
           pn->nt = NT_IDENTIFIER; pn->name = pvi->reg;
           tn = mknd(); make_vararg_union_type(&tn); /* va_arg_t */
-          tn.pwsid = pn->pwsid; tn.startpos = pn->startpos;
+          tn.loc = pn->loc;
           wrap_expr_cast(pn, wrap_type_pointer(&tn)); 
           ndfini(&tn);
         } break;
@@ -1841,7 +1904,7 @@ static void expr_wasmify(node_t *pn, buf_t *pvib, buf_t *plib)
           wrap_postfix_operator(pin, TT_PLUS_PLUS, 0);
           wrap_type_pointer(ptn);
           ndswap(pin, ptn); pn->nt = NT_CAST;
-          wrap_unary_operator(pn, pn->startpos, TT_STAR);
+          wrap_unary_operator(pn, pn->loc, TT_STAR);
         } break;
         case INTR_SIZEOF: case INTR_ALIGNOF: case INTR_OFFSETOF: {
           node_t *pan; assert(ndlen(pn) >= 1);
@@ -1854,7 +1917,7 @@ static void expr_wasmify(node_t *pn, buf_t *pvib, buf_t *plib)
           if (node_is_etc(pan)) { /* countof(...) => ((va_arg_t*)ap$[-1]).va_size */
             node_t nd = mknd();
             expr_wasmify(pan, pvib, plib);
-            ndset(&nd, NT_LITERAL, pn->pwsid, pn->startpos); 
+            ndset(&nd, NT_LITERAL, pn->loc); 
             nd.ts = TS_INT; nd.val.i = -1; wrap_subscript(pan, &nd);
             ndswap(&nd, pan); ndswap(&nd, pn); 
             wrap_postfix_operator(pn, TT_DOT, intern("va_size"));
@@ -1871,7 +1934,7 @@ static void expr_wasmify(node_t *pn, buf_t *pvib, buf_t *plib)
               expr_wasmify(pni, pvib, plib);
           }
         } break;
-        case INTR_ACODE: {
+        case INTR_ACODE: case INTR_ALLOCA: {
           size_t i;
           for (i = 0; i < ndlen(pn); ++i) expr_wasmify(ndref(pn, i), pvib, plib);
         } break;
@@ -1884,7 +1947,7 @@ static void expr_wasmify(node_t *pn, buf_t *pvib, buf_t *plib)
       if (pn->op == TT_ARROW) { /* (&x)->y => x.y; x->y => (*x).y */
         node_t *psn = ndref(pn, 0);
         if (psn->nt == NT_PREFIX && psn->op == TT_AND) lift_arg0(psn);
-        else wrap_unary_operator(psn, psn->startpos, TT_STAR);
+        else wrap_unary_operator(psn, psn->loc, TT_STAR);
         pn->op = TT_DOT;
       } 
     } break;
@@ -1893,7 +1956,7 @@ static void expr_wasmify(node_t *pn, buf_t *pvib, buf_t *plib)
     //  assert(ndlen(pn) == 2);
     //  pln = ndref(pn, 0), prn = ndref(pn, 1);
     //  if (pn->op == TT_ASN && pln->nt == NT_IDENTIFIER && prn->nt == NT_DISPLAY) {
-    //    node_t nd = mknd(); ndset(&nd, NT_BLOCK, pn->pwsid, pn->startpos);
+    //    node_t nd = mknd(); ndset(&nd, NT_BLOCK, pn->loc);
     //    assert(ndlen(prn) >= 1 && ndref(prn, 0)->nt == NT_TYPE);
     //    init_wasmify(pln, ndref(prn, 0), prn, 1, &nd);
     //    ndswap(pn, &nd); ndfini(&nd);
@@ -1974,14 +2037,14 @@ static void expr_wasmify(node_t *pn, buf_t *pvib, buf_t *plib)
       pil = bufnewbk(plib); pil[0] = bl, pil[1] = NT_BREAK;  
       for (i = 1; i < ndlen(pn); ++i) { /* move clause stms to ndb, convert to gotos */
         sym_t l = rpalloc_label(), *pl = bufnewbk(&clb);
-        node_t *psn = ndref(pn, i), *pni = ndset(ndbnewbk(&ndb), psn->nt, psn->pwsid, psn->startpos);
+        node_t *psn = ndref(pn, i), *pni = ndset(ndbnewbk(&ndb), psn->nt, psn->loc);
         expr_wasmify(psn, pvib, plib); ndswap(psn, pni); pni->nt = NT_BLOCK;
         if (psn->nt == NT_CASE) { ndswap(ndnewbk(psn), ndref(pni, 0)); ndrem(pni, 0); }
         ndinsbk(psn, NT_GOTO)->name = l; *pl = l; 
       }
       if (ndlen(pn) > 2) qsort(ndref(pn, 1), ndlen(pn)-1, sizeof(node_t), &case_cmp);
       if (ndlen(pn) == 1 || ndref(pn, 1)->nt != NT_DEFAULT) {
-        node_t *psn = ndset(ndinsnew(pn, 1), NT_DEFAULT, pn->pwsid, pn->startpos);
+        node_t *psn = ndset(ndinsnew(pn, 1), NT_DEFAULT, pn->loc);
         ndinsbk(psn, NT_GOTO)->name = bl;  
       } 
       wrap_node(pn, NT_BLOCK);
@@ -2099,10 +2162,11 @@ static void fundef_wasmify(node_t *pdn)
   node_t *ptn = ndref(pdn, 0), *pbn = ndref(pdn, 1);
   buf_t vib = mkbuf(sizeof(vi_t)); node_t frame = mknd();
   ndbuf_t asb; buf_t lib; size_t i; bool explicit_tail_ret = false;
+  buf_t mvb = mkbuf(sizeof(mvfld_t));
   ndbinit(&asb); bufinit(&lib, sizeof(int)*2); /* <tt, lbsym> */
   
   /* init frame structure, in case there are auto locals */
-  ndset(&frame, NT_TYPE, pdn->pwsid, pdn->startpos);
+  ndset(&frame, NT_TYPE, pdn->loc);
   frame.ts = TS_STRUCT;
   
   /* wasmify function signature and collect arg vars */
@@ -2114,7 +2178,7 @@ static void fundef_wasmify(node_t *pdn)
       case TS_ETC: { /* last */
         vi_t *pvi = bufnewbk(&vib);
         assert(i+1 == ndlen(ptn));
-        ndset(pdni, NT_VARDECL, pdni->pwsid, pdni->startpos);
+        ndset(pdni, NT_VARDECL, pdni->loc);
         pdni->name = intern("ap$");
         ptni = ndinsbk(pdni, NT_TYPE); ptni->ts = TS_ULLONG; wrap_type_pointer(ptni);
         pvi->name = pvi->reg = pdni->name; pvi->sc = SC_REGISTER;
@@ -2134,7 +2198,7 @@ static void fundef_wasmify(node_t *pdn)
           if (pdni->nt == NT_VARDECL && pdni->sc == SC_AUTO) {
             sym_t hname = internf("%s#", symname(name));
             node_t *pni = ndbnewbk(&asb), *psn;
-            ndset(pni, NT_ASSIGN, pdni->pwsid, pdni->startpos); pni->op = TT_ASN;
+            ndset(pni, NT_ASSIGN, pdni->loc); pni->op = TT_ASN;
             psn = ndinsbk(pni, NT_IDENTIFIER); psn->name = name;
             psn = ndinsbk(pni, NT_IDENTIFIER); psn->name = hname;
             pni = ndinsfr(pbn, NT_VARDECL); pni->sc = SC_AUTO;
@@ -2148,9 +2212,35 @@ static void fundef_wasmify(node_t *pdn)
         }
       } break;
       case TS_ARRAY: case TS_STRUCT: case TS_UNION: { 
+        if (mv_struct(ptni, &mvb)) {
+          if (i != 0) { /* p => p#1, p#2, ... ; p is auto local, set from them */
+            size_t k; node_t tn = mknd(); ndswap(&tn, ptni);
+            for (k = 0; k < buflen(&mvb); ++k) {
+              mvfld_t *pf = bufref(&mvb, k);
+              node_t *pni = k == 0 ? pdni : ndinsnew(ptn, i+k);
+              ndset(pni, NT_VARDECL, tn.loc);
+              pni->name = internf("%s#%d", name ? symname(name) : "", (int)k+1);
+              ndcpy(ndnewbk(pni), pf->ptn);
+              if (name) {
+                int j; node_t *pai = ndbnewbk(&asb), *psn;
+                ndset(pai, NT_ASSIGN, tn.loc); pai->op = TT_ASN;
+                psn = ndinsbk(pai, NT_IDENTIFIER); psn->name = name;
+                for (j = 0; j < pf->depth; ++j) wrap_postfix_operator(psn, TT_DOT, pf->path[j]);
+                psn = ndinsbk(pai, NT_IDENTIFIER); psn->name = pni->name;
+              }
+            }
+            if (name) {
+              node_t *pni = ndinsfr(pbn, NT_VARDECL); pni->sc = SC_AUTO;
+              pni->name = name; ndswap(ndnewbk(pni), &tn);
+            }
+            ndfini(&tn);
+            --i; /* process new scalar params */
+          } /* return value: returned as multiple values */
+          break;
+        }
         if (i == 0) { /* return value: insert $rp as first arg */
           node_t *prn = ndinsnew(ptn, 1), *pn; ptni = ndref(ptn, 0); /* re-fetch */
-          ndset(prn, NT_VARDECL, ptni->pwsid, ptni->startpos);
+          ndset(prn, NT_VARDECL, ptni->loc);
           pn = ndinsbk(prn, NT_TYPE), pn->ts = TS_VOID; ndswap(pn, ptni);
           wrap_type_pointer(pn); prn->name = intern("rp$");
           break;
@@ -2176,7 +2266,7 @@ static void fundef_wasmify(node_t *pdn)
       case TS_V128:  case TS_PTR: {
         if (pdni->sc == SC_AUTO) { /* field in fp$ frame struct */
           node_t *pvn = ndnewbk(&frame); vi_t *pvi = bufnewbk(&vib);
-          ndset(pvn, NT_VARDECL, pdni->pwsid, pdni->startpos);
+          ndset(pvn, NT_VARDECL, pdni->loc);
           pvn->name = name; ndpushbk(pvn, ptni);
           pvi->name = name, pvi->sc = SC_AUTO;
           pvi->reg = intern("fp$"); pvi->fld = name;
@@ -2190,7 +2280,7 @@ static void fundef_wasmify(node_t *pdn)
       } break;
       case TS_ARRAY: case TS_STRUCT: case TS_UNION: { 
         node_t *pvn = ndnewbk(&frame); vi_t *pvi = bufnewbk(&vib);
-        ndset(pvn, NT_VARDECL, pdni->pwsid, pdni->startpos);
+        ndset(pvn, NT_VARDECL, pdni->loc);
         pvn->name = name; ndpushbk(pvn, ptni);
         pvi->name = name, pvi->sc = SC_AUTO;
         pvi->reg = intern("fp$"); pvi->fld = name;
@@ -2213,24 +2303,24 @@ static void fundef_wasmify(node_t *pdn)
   if (ndlen(&frame) > 0) {
     node_t *pin, *psn; vi_t *pvi;
     pin = ndinsnew(pbn, i);
-    ndset(pin, NT_ASSIGN, pbn->pwsid, pbn->startpos);
+    ndset(pin, NT_ASSIGN, pbn->loc);
     pin->op = TT_ASN;
     psn = ndinsbk(pin, NT_IDENTIFIER); psn->name = intern("fp$");
     psn = ndinsbk(pin, NT_INTRCALL); psn->intr = INTR_ALLOCA;
     psn = ndinsbk(psn, NT_INTRCALL); psn->intr = INTR_SIZEOF;
     ndpushbk(psn, &frame);
     pin = ndinsnew(pbn, i);
-    ndset(pin, NT_ASSIGN, pbn->pwsid, pbn->startpos);
+    ndset(pin, NT_ASSIGN, pbn->loc);
     pin->op = TT_ASN;
     psn = ndinsbk(pin, NT_IDENTIFIER); psn->name = intern("bp$");
     psn = ndinsbk(pin, NT_IDENTIFIER); psn->name = g_sp_id;
     pin = ndinsnew(pbn, i);
-    ndset(pin, NT_VARDECL, pbn->pwsid, pbn->startpos);
+    ndset(pin, NT_VARDECL, pbn->loc);
     pin->name = intern("fp$"); wrap_type_pointer(ndpushbk(pin, &frame));
     pvi = bufnewbk(&vib); pvi->sc = SC_REGISTER;
     pvi->name = pvi->reg = pin->name;
     pin = ndinsnew(pbn, i);
-    ndset(pin, NT_VARDECL, pbn->pwsid, pbn->startpos);
+    ndset(pin, NT_VARDECL, pbn->loc);
     pin->name = intern("bp$"); wrap_type_pointer(ndsettype(ndnewbk(pin), TS_VOID));
     pvi = bufnewbk(&vib); pvi->sc = SC_REGISTER;
     pvi->name = pvi->reg = pin->name;
@@ -2238,12 +2328,12 @@ static void fundef_wasmify(node_t *pdn)
   } else if (contains_alloca(pbn)) {
     node_t *pin, *psn; vi_t *pvi;
     pin = ndinsnew(pbn, i);
-    ndset(pin, NT_ASSIGN, pbn->pwsid, pbn->startpos);
+    ndset(pin, NT_ASSIGN, pbn->loc);
     pin->op = TT_ASN;
     psn = ndinsbk(pin, NT_IDENTIFIER); psn->name = intern("bp$");
     psn = ndinsbk(pin, NT_IDENTIFIER); psn->name = g_sp_id;
     pin = ndinsnew(pbn, i);
-    ndset(pin, NT_VARDECL, pbn->pwsid, pbn->startpos);
+    ndset(pin, NT_VARDECL, pbn->loc);
     pin->name = intern("bp$"); wrap_type_pointer(ndsettype(ndnewbk(pin), TS_VOID));
     pvi = bufnewbk(&vib); pvi->sc = SC_REGISTER;
     pvi->name = pvi->reg = pin->name;
@@ -2272,6 +2362,7 @@ static void fundef_wasmify(node_t *pdn)
   ndbfini(&asb);
   ndfini(&frame);
   buffini(&vib);
+  buffini(&mvb);
 }
 
 /* check if tan type can be assigned to parameter/lval tpn type */
@@ -3270,11 +3361,80 @@ static node_t *compile_asncombo(node_t *prn, node_t *pan, node_t *pctn, tt_t op,
   return NULL;
 } 
 
-/* compile call expression; pdn != NULL for suspected bulk return call */
-static node_t *compile_call(node_t *prn, node_t *pfn, buf_t *pab, node_t *pdn)
+/* math/string library functions that are wasm instructions are inlined;
+ * returns the instruction to use or IN_CALL for regular functions */
+static instr_t builtin_call_instr(sym_t mod, sym_t name)
+{
+  const char *s = symname(name);
+  if (mod == intern("math")) {
+    if (streql(s, "fabs")) return IN_F64_ABS;
+    if (streql(s, "sqrt")) return IN_F64_SQRT;
+    if (streql(s, "ceil")) return IN_F64_CEIL;
+    if (streql(s, "floor")) return IN_F64_FLOOR;
+    if (streql(s, "trunc")) return IN_F64_TRUNC;
+    if (streql(s, "nearbyint")) return IN_F64_NEAREST;
+    if (streql(s, "copysign")) return IN_F64_COPYSIGN;
+    if (streql(s, "fmin")) return IN_F64_MIN;
+    if (streql(s, "fmax")) return IN_F64_MAX;
+    if (streql(s, "fabsf")) return IN_F32_ABS;
+    if (streql(s, "sqrtf")) return IN_F32_SQRT;
+    if (streql(s, "ceilf")) return IN_F32_CEIL;
+    if (streql(s, "floorf")) return IN_F32_FLOOR;
+    if (streql(s, "truncf")) return IN_F32_TRUNC;
+    if (streql(s, "nearbyintf")) return IN_F32_NEAREST;
+    if (streql(s, "copysignf")) return IN_F32_COPYSIGN;
+    if (streql(s, "fminf")) return IN_F32_MIN;
+    if (streql(s, "fmaxf")) return IN_F32_MAX;
+  } else if (mod == intern("string")) {
+    if (streql(s, "memcpy")) return IN_MEMORY_COPY;
+    if (streql(s, "memmove")) return IN_MEMORY_COPY;
+    if (streql(s, "memset")) return IN_MEMORY_FILL;
+  }
+  return IN_CALL;
+}
+
+/* replace pointer to multi-value struct on stack with its fields */
+static void acode_mvload(node_t *pcn, buf_t *pmvb)
+{
+  sym_t pname = rpalloc(VT_I32); size_t i; /* wasm32 */
+  inscode_t *pic = icbnewfr(&pcn->data); pic->in = IN_REGDECL;
+  pic->id = pname; pic->arg.u = VT_I32;
+  acode_pushin_id(pcn, IN_LOCAL_SET, pname);
+  for (i = 0; i < buflen(pmvb); ++i) {
+    mvfld_t *pf = bufref(pmvb, i); ts_t ts = pf->ptn->ts;
+    acode_pushin_id(pcn, IN_LOCAL_GET, pname);
+    asm_load(ts == TS_PTR ? ts : ts_integral_promote(ts), ts, (unsigned)pf->off, &pcn->data);
+  }
+}
+
+/* store multi-value struct fields on stack via pointer in pname local */
+static void acode_mvstore(node_t *pcn, sym_t pname, buf_t *pmvb)
+{
+  size_t i, n = buflen(pmvb); sym_t *pvn = emalloc(n*sizeof(sym_t));
+  for (i = n; i > 0; --i) { /* last field is on top */
+    mvfld_t *pf = bufref(pmvb, i-1); valtype_t vt = ts2vt(pf->ptn->ts);
+    inscode_t *pic = icbnewfr(&pcn->data); pic->in = IN_REGDECL;
+    pic->id = pvn[i-1] = rpalloc(vt); pic->arg.u = vt;
+    acode_pushin_id(pcn, IN_LOCAL_SET, pvn[i-1]);
+  }
+  for (i = 0; i < n; ++i) {
+    mvfld_t *pf = bufref(pmvb, i); ts_t ts = pf->ptn->ts;
+    acode_pushin_id(pcn, IN_LOCAL_GET, pname);
+    acode_pushin_id(pcn, IN_LOCAL_GET, pvn[i]);
+    asm_store(ts, ts == TS_PTR ? ts : ts_integral_promote(ts), (unsigned)pf->off, &pcn->data);
+  }
+  free(pvn);
+}
+
+/* compile call expression; pdn != NULL for suspected bulk return call;
+ * if there is no pdn, multi-value struct return leaves fields on stack;
+ * pmb (if not NULL) marks args that already have their fields on stack */
+static node_t *compile_call(node_t *prn, node_t *pfn, buf_t *pab, buf_t *pmb, node_t *pdn)
 {
   node_t *pcn = npnewcode(prn), *pftn = acode_type(pfn), *psn; size_t i;
   inscode_t cic; size_t alen = ndlen(pftn); bool etc = false;
+  instr_t bin = IN_CALL; sym_t tname = 0, xname = 0, yname = 0, dname = 0;
+  buf_t mvb = mkbuf(sizeof(mvfld_t));
   if (pftn->ts != TS_FUNCTION) 
     n2eprintf(ndref(prn, 0), prn, "can't call non-function type (function pointers need to be dereferenced)");
   if (alen > 1 && (psn = ndref(pftn, alen-1))->nt == NT_VARDECL
@@ -3286,12 +3446,23 @@ static node_t *compile_call(node_t *prn, node_t *pfn, buf_t *pab, node_t *pdn)
   } else if (ndlen(pftn) != buflen(pab)+1)
     n2eprintf(ndref(prn, 0), prn, "%d-parameter function called with %d arguments",
       (int)ndlen(pftn)-1, (int)buflen(pab));
-  if (ts_bulk(ndref(pftn, 0)->ts)) {
+  if (mv_struct(ndref(pftn, 0), &mvb)) {
+    if (pdn) { /* keep lval pointer till fields are returned */
+      inscode_t *pic = icbnewfr(&pcn->data); pic->in = IN_REGDECL;
+      pic->id = dname = rpalloc(VT_I32); pic->arg.u = VT_I32; /* wasm32 */
+      ndsettype(ndnewbk(pcn), TS_VOID);
+      acode_swapin(pcn, pdn);
+      acode_pushin_id(pcn, IN_LOCAL_SET, dname);
+    } else { /* fields stay on stack */
+      ndpushbk(pcn, ndref(pftn, 0));
+    }
+  } else if (ts_bulk(ndref(pftn, 0)->ts)) {
     if (!pdn) n2eprintf(ndref(prn, 0), prn, "no lval to accept bulk return value"); 
     /* adjust to bulk return convention */
     pftn = npdup(pftn); wrap_type_pointer(ndref(pftn, 0));
     ndsettype(ndnewfr(pftn), TS_VOID);
     *(node_t **)bufins(pab, 0) = pdn;
+    if (pmb) *(bool*)bufins(pmb, 0) = false;
     ndsettype(ndnewbk(pcn), TS_VOID);
   } else { 
     assert(!pdn);
@@ -3301,6 +3472,7 @@ static node_t *compile_call(node_t *prn, node_t *pfn, buf_t *pab, node_t *pdn)
     inscode_t ic; asm_getbk(&pfn->data, &ic);
     assert(ic.in == IN_REF_FUNC); 
     cic.in = IN_CALL; cic.id = ic.id; cic.arg2 = ic.arg2; /* mod */
+    if (!etc && !ts_bulk(ndref(pftn, 0)->ts)) bin = builtin_call_instr(ic.arg2.mod, ic.id);
   } else {
     funcsig_t fs; fsinit(&fs);
     cic.in = IN_CALL_INDIRECT;
@@ -3311,18 +3483,25 @@ static node_t *compile_call(node_t *prn, node_t *pfn, buf_t *pab, node_t *pdn)
   for (i = 0; i < buflen(pab) && (!etc || i < ndlen(pftn)-2); ++i) {
     node_t **ppani = bufref(pab, i), *pani = *ppani;
     node_t *ptni = acode_type(pani), *pftni = ndref(pftn, i+1);
-    node_t nd; bool nd_inited = false;
+    node_t nd; bool nd_inited = false, onstk = pmb && *(bool*)bufref(pmb, i);
     if (pftni->nt == NT_VARDECL) pftni = ndref(pftni, 0);
     /* see if we need to promote param type */
     if (ts_numerical(pftni->ts) && pftni->ts < TS_INT) {
       ndicpy(&nd, pftni); nd_inited = true;
       pftni = &nd; pftni->ts = ts_integral_promote(pftni->ts);
     }
-    if (!assign_compatible(pftni, ptni)) {
+    if (!assign_compatible(pftni, ptni) || (onstk && !same_type(pftni, ptni))) {
       n2eprintf(pani, prn, "can't pass argument[%d]: unexpected type", i);
     }
     if (!same_type(pftni, ptni)) pani = compile_cast(prn, pftni, pani);
     acode_swapin(pcn, pani); /* leaves arg on stack */
+    if (!onstk && mv_struct(pftni, &mvb)) acode_mvload(pcn, &mvb); /* pass fields */
+    if (i == 0 && (bin == IN_MEMORY_COPY || bin == IN_MEMORY_FILL)) {
+      /* dst pointer is also the return value */
+      inscode_t *pic = icbnewfr(&pcn->data); pic->in = IN_REGDECL;
+      pic->id = tname = rpalloc(VT_I32); pic->arg.u = VT_I32; /* wasm32 */
+      acode_pushin_id(pcn, IN_LOCAL_TEE, tname);
+    }
     if (nd_inited) ndfini(&nd);
   }
   if (etc && i <= buflen(pab)) {
@@ -3381,11 +3560,44 @@ static node_t *compile_call(node_t *prn, node_t *pfn, buf_t *pab, node_t *pdn)
     acode_pushin(pcn, IN_I32_ADD);
     acode_pushin_id_mod(pcn, IN_GLOBAL_SET, g_sp_id, g_crt_mod); 
     ndfini(&tn);
+  } else if (bin == IN_F64_MIN || bin == IN_F64_MAX || bin == IN_F32_MIN || bin == IN_F32_MAX) {
+    /* C's fmin/fmax ignore NaN args, wasm's min/max propagate them:
+     * x, y => isnan(y) ? x : isnan(x) ? y : min/max(x, y) */
+    valtype_t vt = (bin == IN_F64_MIN || bin == IN_F64_MAX) ? VT_F64 : VT_F32;
+    instr_t ne = (vt == VT_F64) ? IN_F64_NE : IN_F32_NE;
+    inscode_t *pic = icbnewfr(&pcn->data); pic->in = IN_REGDECL;
+    pic->id = xname = rpalloc(vt); pic->arg.u = vt;
+    pic = icbnewfr(&pcn->data); pic->in = IN_REGDECL;
+    pic->id = yname = rpalloc(vt); pic->arg.u = vt;
+    acode_pushin_id(pcn, IN_LOCAL_SET, yname);
+    acode_pushin_id(pcn, IN_LOCAL_SET, xname);
+    acode_pushin_id(pcn, IN_LOCAL_GET, xname);
+    acode_pushin_id(pcn, IN_LOCAL_GET, yname);
+    acode_pushin_id(pcn, IN_LOCAL_GET, xname);
+    acode_pushin_id(pcn, IN_LOCAL_GET, yname);
+    acode_pushin(pcn, bin);
+    acode_pushin_id(pcn, IN_LOCAL_GET, xname);
+    acode_pushin_id(pcn, IN_LOCAL_GET, xname);
+    acode_pushin(pcn, ne);
+    acode_pushin(pcn, IN_SELECT);
+    acode_pushin_id(pcn, IN_LOCAL_GET, yname);
+    acode_pushin_id(pcn, IN_LOCAL_GET, yname);
+    acode_pushin(pcn, ne);
+    acode_pushin(pcn, IN_SELECT);
+  } else if (bin != IN_CALL) {
+    /* single instruction; bulk memory ops return dst */
+    acode_pushin(pcn, bin);
+    if (tname) acode_pushin_id(pcn, IN_LOCAL_GET, tname);
   } else {
     /* put the call instruction */
     if (cic.in == IN_CALL_INDIRECT) acode_swapin(pcn, pfn); /* func on stack */ 
     asm_pushbk(&pcn->data, &cic);
   }
+  if (dname) { /* store returned fields into lval */
+    mv_struct(ndref(pftn, 0), &mvb);
+    acode_mvstore(pcn, dname, &mvb);
+  }
+  buffini(&mvb);
   return pcn;
 }
 
@@ -3533,12 +3745,19 @@ static node_t *compile_switch_ifs(node_t *prn, node_t *pan, node_t *pcv, size_t
   return pcn;
 }
 
-/* compile return statement; if bpid != 0, insert freea code */
-static node_t *compile_return(node_t *prn, node_t *pan, const node_t *ptn, sym_t bpid)
+/* compile return statement; if bpid != 0, insert freea code;
+ * multi-value struct is returned from pan pointer or, if mvpan is true, 
+ * is already on stack (e.g. returned by a call) */
+static node_t *compile_return(node_t *prn, node_t *pan, const node_t *ptn, sym_t bpid, bool mvpan)
 {
-  node_t *pcn = npnewcode(prn); ndsettype(ndnewbk(pcn), TS_VOID);
+  node_t *pcn = npnewcode(prn); buf_t mvb = mkbuf(sizeof(mvfld_t));
+  ndsettype(ndnewbk(pcn), TS_VOID);
   assert(ptn && ptn->nt == NT_TYPE);
-  if (pan) { /* got argument */
+  if (pan && mv_struct(ptn, &mvb)) { /* return fields as multiple values */
+    if (!same_type(ptn, acode_type(pan))) neprintf(prn, "unexpected returned type");
+    acode_swapin(pcn, pan);
+    if (!mvpan) acode_mvload(pcn, &mvb); /* pointer to struct is on stack */
+  } else if (pan) { /* got argument */
     node_t *patn = acode_type(pan);
     if (!assign_compatible(ptn, patn)) neprintf(prn, "unexpected returned type");
     if (!same_type(ptn, patn)) pan = compile_cast(prn, ptn, pan);
@@ -3551,6 +3770,7 @@ static node_t *compile_return(node_t *prn, node_t *pan, const node_t *ptn, sym_t
     acode_pushin_id_mod(pcn, IN_GLOBAL_SET, g_sp_id, g_crt_mod);
   }
   acode_pushin(pcn, IN_RETURN);
+  buffini(&mvb);
   return pcn;
 }
 
@@ -3574,6 +3794,30 @@ static node_t *compile_bulkasn(node_t *prn, node_t *pdan, node_t *psan)
   return NULL;
 }
 
+static node_t *expr_compile(node_t *pn, buf_t *prib, const node_t *ret);
+
+/* compile arguments of call pn into pab; calls returning multi-value 
+ * structs leave their fields on stack to be passed as-is (marked in pmb) */
+static void compile_args(node_t *pn, buf_t *prib, buf_t *pab, buf_t *pmb)
+{
+  size_t i;
+  for (i = 1; i < ndlen(pn); ++i) {
+    node_t *pani = ndref(pn, i), *pcn; bool onstk = false;
+    if (pani->nt == NT_CALL) {
+      buf_t apb = mkbuf(sizeof(node_t*)), amb = mkbuf(sizeof(bool));
+      node_t *pfn = expr_compile(ndref(pani, 0), prib, NULL);
+      compile_args(pani, prib, &apb, &amb);
+      pcn = compile_call(pani, pfn, &apb, &amb, NULL);
+      onstk = ts_bulk(acode_type(pcn)->ts);
+      buffini(&apb); buffini(&amb);
+    } else {
+      pcn = expr_compile(pani, prib, NULL);
+    }
+    *(node_t**)bufnewbk(pab) = pcn;
+    *(bool*)bufnewbk(pmb) = onstk;
+  }
+}
+
 /* compile expr/statement (that is, convert it to asm tree); prib is var/reg info,
  * ret is return type for statements, NULL for expressions returning a value
  * NB: code that has bulk type actually produces a pointer (cf. arrays) */
@@ -3622,12 +3866,19 @@ static node_t *expr_compile(node_t *pn, buf_t *prib, const node_t *ret)
       pcn = compile_subscript(pn, pan1, pan2);
     } break;
     case NT_CALL: {
-      size_t i; buf_t apb = mkbuf(sizeof(node_t*));
+      size_t i; buf_t apb = mkbuf(sizeof(node_t*)), amb = mkbuf(sizeof(bool));
       node_t *pfn = expr_compile(ndref(pn, 0), prib, NULL);
-      for (i = 1; i < ndlen(pn); ++i) 
-        *(node_t**)bufnewbk(&apb) = expr_compile(ndref(pn, i), prib, NULL);
-      pcn = compile_call(pn, pfn, &apb, NULL); /* regular call (no lval = on the left) */
-      buffini(&apb);
+      compile_args(pn, prib, &apb, &amb);
+      pcn = compile_call(pn, pfn, &apb, &amb, NULL); /* regular call (no lval = on the left) */
+      if (ts_bulk(acode_type(pcn)->ts)) { /* multi-value struct on stack */
+        buf_t mvb = mkbuf(sizeof(mvfld_t));
+        if (!ret) neprintf(pn, "no lval to accept bulk return value");
+        mv_struct(acode_type(pcn), &mvb); /* value is not used: drop fields */
+        for (i = 0; i < buflen(&mvb); ++i) acode_pushin(pcn, IN_DROP);
+        ndsettype(acode_type(pcn), TS_VOID);
+        buffini(&mvb);
+      }
+      buffini(&apb); buffini(&amb);
     } break;
     case NT_INTRCALL: {
       switch (pn->intr) {
@@ -3826,13 +4077,12 @@ static node_t *expr_compile(node_t *pn, buf_t *prib, const node_t *ret)
       pcn = NULL;
       if (pn->op == TT_ASN && ptn == NULL && ts_bulk(acode_type(pan)->ts)) { 
         if (pvn->nt == NT_CALL) { /* pass pan reference as extra arg */
-          size_t i; buf_t apb = mkbuf(sizeof(node_t*));
+          buf_t apb = mkbuf(sizeof(node_t*)), amb = mkbuf(sizeof(bool));
           node_t *pfn = expr_compile(ndref(pvn, 0), prib, NULL);
-          for (i = 1; i < ndlen(pvn); ++i) 
-            *(node_t**)bufnewbk(&apb) = expr_compile(ndref(pvn, i), prib, NULL);
+          compile_args(pvn, prib, &apb, &amb);
           /* compile_call will return NULL if it is given lval and it is not bulk */
-          pcn = compile_call(pvn, pfn, &apb, compile_addrof(pln, pan)); 
-          buffini(&apb);
+          pcn = compile_call(pvn, pfn, &apb, &amb, compile_addrof(pln, pan)); 
+          buffini(&apb); buffini(&amb);
         } else { /* try regular bulk assignment */
           pan2 = expr_compile(pvn, prib, NULL);
           pcn = compile_bulkasn(pn, pan, pan2); /* returns NULL on failure */
@@ -3909,8 +4159,19 @@ static node_t *expr_compile(node_t *pn, buf_t *prib, const node_t *ret)
     case NT_RETURN: {
       node_t *pan = NULL;
       assert(ret);
-      if (ndlen(pn) == 1) pan = expr_compile(ndref(pn, 0), prib, NULL);
-      pcn = compile_return(pn, pan, ret, pn->name);
+      if (ndlen(pn) == 1 && ts_bulk(ret->ts) && ndref(pn, 0)->nt == NT_CALL) {
+        /* multi-value struct returned by the call is passed thru */
+        node_t *pvn = ndref(pn, 0), *pfn; 
+        buf_t apb = mkbuf(sizeof(node_t*)), amb = mkbuf(sizeof(bool));
+        pfn = expr_compile(ndref(pvn, 0), prib, NULL);
+        compile_args(pvn, prib, &apb, &amb);
+        pan = compile_call(pvn, pfn, &apb, &amb, NULL);
+        pcn = compile_return(pn, pan, ret, pn->name, true);
+        buffini(&apb); buffini(&amb);
+      } else {
+        if (ndlen(pn) == 1) pan = expr_compile(ndref(pn, 0), prib, NULL);
+        pcn = compile_return(pn, pan, ret, pn->name, false);
+      }
     } break;
     case NT_BREAK:
     case NT_CONTINUE: assert(false); break; /* dewasmified */
@@ -3950,11 +4211,11 @@ static node_t *fundef_compile(node_t *pdn)
   node_t *ptn = ndref(pdn, 0), *pbn = ndref(pdn, 1), *pln = NULL;
   buf_t rib = mkbuf(sizeof(ri_t)); node_t *ret = NULL; size_t i;
   /* output is created anew from pieces of input and pool nodes */
-  node_t *prn = npnew(NT_FUNDEF, pdn->pwsid, pdn->startpos), *prtn, *prbn; 
+  node_t *prn = npnew(NT_FUNDEF, pdn->loc), *prtn, *prbn; 
   prn->name = pdn->name; prn->sc = pdn->sc;
   ndnewbk(prn); ndnewbk(prn); prtn = ndref(prn, 0), prbn = ndref(prn, 1); 
-  ndset(prtn, NT_TYPE, ptn->pwsid, ptn->startpos); prtn->ts = TS_FUNCTION;
-  ndset(prbn, NT_BLOCK, pbn->pwsid, pbn->startpos);
+  ndset(prtn, NT_TYPE, ptn->loc); prtn->ts = TS_FUNCTION;
+  ndset(prbn, NT_BLOCK, pbn->loc);
   
   /* collect types for args and local vars; sort for bsearch */
   assert(ptn->nt == NT_TYPE && ptn->ts == TS_FUNCTION && ndlen(ptn) > 0);
@@ -4047,6 +4308,234 @@ static node_t *fundef_flatten(node_t *pdn)
   return pcn;
 }
 
+/* check if instruction is global.get/set of the sp$ stack pointer */
+static bool is_sp_global(const inscode_t *pic, instr_t in)
+{
+  return pic->in == in && pic->id == g_sp_id && pic->arg2.mod == g_crt_mod;
+}
+
+/* check if global.set sp$ at i is bp$ restore before return */
+static bool is_sp_restore(icbuf_t *picb, size_t i)
+{
+  inscode_t *pic = icbref(picb, i);
+  return i > 0 && i+1 < icblen(picb) && is_sp_global(pic, IN_GLOBAL_SET) && 
+    icbref(picb, i-1)->in == IN_LOCAL_GET && icbref(picb, i-1)->id == intern("bp$") &&
+    icbref(picb, i+1)->in == IN_RETURN;
+}
+
+/* control stack entry for fundef_spcache: label, sp$ dirty state */
+typedef struct spcs {
+  instr_t in; sym_t id; 
+  bool indirty, brdirty, hadelse;
+} spcs_t;
+
+/* stack frame optimization for functions starting with bp$ = sp$:
+ * sp$ global is cached in a local, and its changes (frame/alloca/...
+ * adjustments) are written back to the global only before calls that
+ * may observe it; leaf functions never write it back, so their frames
+ * are allocated and released without touching the global */
+static void fundef_spcache(node_t *pcn)
+{
+  icbuf_t *picb = &pcn->data, icb; buf_t csb, ssb, lsb; 
+  size_t i, j, start, body, lastget, n = icblen(picb), ncalls = 0, nbpuses = 0;
+  sym_t bp = intern("bp$"), csp; bool leaf, inbp, dirty = false;
+  inscode_t *pic;
+  
+  /* see if there is bp$ = sp$ prologue after regdecls */
+  for (start = 0; start < n && icbref(picb, start)->in == IN_REGDECL; ++start) ;
+  if (start+2 >= n || !is_sp_global(icbref(picb, start), IN_GLOBAL_GET)) return;
+  pic = icbref(picb, start+1);
+  if (pic->id != bp) return;
+  if (pic->in == IN_LOCAL_SET) body = start+2;
+  else if (pic->in == IN_LOCAL_TEE && icbref(picb, start+2)->in == IN_DROP) body = start+3;
+  else return;
+  
+  /* count calls, mark loops containing non-restore sp$ sets */
+  bufinit(&ssb, sizeof(size_t)); /* stack of open loop/block/if positions */
+  bufinit(&lsb, sizeof(bool)); bufresize(&lsb, n); /* loops with sets */
+  bufinit(&csb, sizeof(spcs_t));
+  for (i = body; i < n; ++i) {
+    pic = icbref(picb, i);
+    switch (pic->in) {
+      case IN_CALL: case IN_CALL_INDIRECT: 
+      case IN_RETURN_CALL: case IN_RETURN_CALL_INDIRECT: 
+        ++ncalls; 
+        break;
+      case IN_BLOCK: case IN_LOOP: case IN_IF:
+        *(size_t*)bufnewbk(&ssb) = i; 
+        break;
+      case IN_END:
+        if (buflen(&ssb) > 0) bufpopbk(&ssb); 
+        break;
+      case IN_LOCAL_GET:
+        if (pic->id == bp && !is_sp_restore(picb, i+1)) ++nbpuses;
+        break;
+      case IN_GLOBAL_SET: 
+        if (is_sp_global(pic, IN_GLOBAL_SET) && !is_sp_restore(picb, i)) {
+          size_t k; /* mark enclosing loops as having sp$ sets */
+          for (k = 0; k < buflen(&ssb); ++k) {
+            size_t li = *(size_t*)bufref(&ssb, k);
+            if (icbref(picb, li)->in == IN_LOOP) *(bool*)bufref(&lsb, li) = true;
+          }
+        }
+        break;
+      default:;
+    }
+  }
+  leaf = (ncalls == 0 && nbpuses == 0);
+  
+  /* rebuild code with cached sp$ */
+  icbinit(&icb);
+  for (i = 0; i < start; ++i) {
+    pic = icbref(picb, i);
+    if (leaf && pic->id == bp) continue; /* not needed */
+    *icbnewbk(&icb) = *pic;
+  }
+  csp = rpalloc(VT_I32);
+  pic = icbnewbk(&icb); pic->in = IN_REGDECL; pic->id = csp; pic->arg.u = VT_I32;
+  *icbnewbk(&icb) = *icbref(picb, start); /* global.get sp$ */
+  pic = icbnewbk(&icb); pic->in = IN_LOCAL_SET; pic->id = leaf ? csp : bp;
+  inbp = !leaf; /* in straight code after prologue, csp is the same as bp$ */
+  for (i = body; i < n; ++i) {
+    inscode_t ic = *icbref(picb, i);
+    if (inbp && (ic.in == IN_BLOCK || ic.in == IN_LOOP || ic.in == IN_IF || 
+        ic.in == IN_ELSE || ic.in == IN_END || ic.in == IN_BR || ic.in == IN_BR_IF ||
+        ic.in == IN_BR_TABLE)) {
+      pic = icbnewbk(&icb); pic->in = IN_LOCAL_GET; pic->id = bp;
+      pic = icbnewbk(&icb); pic->in = IN_LOCAL_SET; pic->id = csp;
+      inbp = false;
+    }
+    switch (ic.in) {
+      case IN_GLOBAL_GET: {
+        if (is_sp_global(&ic, IN_GLOBAL_GET)) {
+          pic = icblen(&icb) > 0 ? icbref(&icb, icblen(&icb)-1) : NULL;
+          if (pic && pic->in == IN_LOCAL_SET && pic->id == csp) {
+            pic->in = IN_LOCAL_TEE; /* local.set + local.get */
+            continue;
+          }
+          ic.in = IN_LOCAL_GET; ic.id = inbp ? bp : csp; ic.arg2.mod = 0;
+        }
+      } break;
+      case IN_GLOBAL_SET: {
+        if (!is_sp_global(&ic, IN_GLOBAL_SET)) break;
+        if (is_sp_restore(picb, i)) {
+          if (leaf) { /* drop local.get bp$ and the set */
+            icbpopbk(&icb);
+            continue;
+          }
+          dirty = false; /* restored */
+        } else {
+          ic.in = IN_LOCAL_SET; ic.id = csp; ic.arg2.mod = 0;
+          dirty = true; inbp = false;
+        }
+      } break;
+      case IN_CALL: case IN_CALL_INDIRECT: 
+      case IN_RETURN_CALL: case IN_RETURN_CALL_INDIRECT: {
+        if (dirty) { /* write back before the call */
+          pic = icbnewbk(&icb); pic->in = IN_LOCAL_GET; pic->id = csp;
+          pic = icbnewbk(&icb); pic->in = IN_GLOBAL_SET; 
+          pic->id = g_sp_id; pic->arg2.mod = g_crt_mod;
+          dirty = false;
+        }
+      } break;
+      case IN_BLOCK: case IN_IF: case IN_LOOP: {
+        spcs_t *pcs = bufnewbk(&csb); 
+        pcs->in = ic.in; pcs->id = ic.id; 
+        pcs->indirty = dirty; pcs->brdirty = pcs->hadelse = false;
+        /* back edges may bring sp$ sets to loop start */
+        if (ic.in == IN_LOOP && *(bool*)bufref(&lsb, i)) dirty = true;
+      } break;
+      case IN_ELSE: {
+        spcs_t *pcs = buflen(&csb) > 0 ? bufref(&csb, buflen(&csb)-1) : NULL;
+        if (pcs) { /* then branch joins at the end */
+          pcs->brdirty = pcs->brdirty || dirty;
+          pcs->hadelse = true; dirty = pcs->indirty;
+        }
+      } break;
+      case IN_END: {
+        spcs_t *pcs = buflen(&csb) > 0 ? bufref(&csb, buflen(&csb)-1) : NULL;
+        if (pcs) {
+          if (pcs->in != IN_LOOP) dirty = dirty || pcs->brdirty;
+          if (pcs->in == IN_IF && !pcs->hadelse) dirty = dirty || pcs->indirty;
+          bufpopbk(&csb);
+        }
+      } break;
+      case IN_BR: case IN_BR_IF: {
+        size_t k; /* forward branches join at the block end */
+        for (k = buflen(&csb); k > 0; --k) {
+          spcs_t *pcs = bufref(&csb, k-1);
+          if (pcs->id != 0 && pcs->id == ic.id) {
+            if (pcs->in != IN_LOOP) pcs->brdirty = pcs->brdirty || dirty;
+            break;
+          }
+        } 
+        /* br_table's IN_BR entries are all followed by another IN_BR, 
+         * or by the code after br_table which is not reachable */
+        if (ic.in == IN_BR && (i+1 == n || icbref(picb, i+1)->in != IN_BR)) dirty = false;
+      } break;
+      case IN_RETURN: {
+        if (dirty && !leaf) { /* write back before the exit */
+          pic = icbnewbk(&icb); pic->in = IN_LOCAL_GET; pic->id = csp;
+          pic = icbnewbk(&icb); pic->in = IN_GLOBAL_SET; 
+          pic->id = g_sp_id; pic->arg2.mod = g_crt_mod;
+        }
+        dirty = false;
+      } break;
+      case IN_UNREACHABLE: {
+        dirty = false;
+      } break;
+      default:;
+    }
+    *icbnewbk(&icb) = ic;
+  }
+
+  /* stores to csp are dead if there are no reads after them, 
+   * including reads in enclosing loops (via back edges) */
+  for (lastget = i = 0; i < icblen(&icb); ++i) {
+    pic = icbref(&icb, i);
+    if (pic->in == IN_LOCAL_GET && pic->id == csp) lastget = i;
+  }
+  bufclear(&ssb);
+  for (i = j = 0; i < icblen(&icb); ++i) {
+    bool dead = false; pic = icbref(&icb, i);
+    if (pic->in == IN_REGDECL) {
+      if (pic->id == csp && lastget == 0) continue; /* not used */
+    } else if (pic->in == IN_BLOCK || pic->in == IN_LOOP || pic->in == IN_IF) {
+      *(size_t*)bufnewbk(&ssb) = i;
+    } else if (pic->in == IN_END) {
+      if (buflen(&ssb) > 0) bufpopbk(&ssb); 
+    } else if ((pic->in == IN_LOCAL_SET || pic->in == IN_LOCAL_TEE) && 
+               pic->id == csp && i > lastget) {
+      size_t k; dead = true;
+      for (k = 0; dead && k < buflen(&ssb); ++k) {
+        size_t si = *(size_t*)bufref(&ssb, k);
+        if (icbref(&icb, si)->in == IN_LOOP && si < lastget) dead = false;
+      }
+    }
+    if (dead && pic->in == IN_LOCAL_TEE) continue; /* value stays */
+    if (dead) { /* drop the whole address computation if it is pure */
+      size_t k = j; int need = 1;
+      while (need > 0 && k > 0) {
+        instr_t in = icbref(&icb, k-1)->in;
+        if (in == IN_LOCAL_GET || in == IN_GLOBAL_GET || in == IN_I32_CONST) --need;
+        else if (in == IN_I32_ADD || in == IN_I32_SUB || in == IN_I32_AND) ++need;
+        else break;
+        --k;
+      }
+      if (need == 0) { j = k; continue; }
+      pic->in = IN_DROP; pic->id = 0;
+    }
+    *icbref(&icb, j++) = *pic;
+  }
+  bufresize(&icb, j);
+  
+  bufswap(&icb, picb);
+  icbfini(&icb);
+  buffini(&csb);
+  buffini(&lsb);
+  buffini(&ssb);
+}
+
 /* fixme: simple peephole optimization */
 static void fundef_peephole(node_t *pcn, int optlvl)
 {
@@ -4151,12 +4640,19 @@ static node_t *expr_compile_top(node_t *pn)
 } */
 
 
-/* convert function param/result type node to a valtype */
+/* convert function param/result type node to valtype(s) */
 static void tn2vt(node_t *ptn, vtbuf_t *pvtb)
 {
+  buf_t mvb = mkbuf(sizeof(mvfld_t));
   assert(ptn->nt == NT_TYPE);
   if (ptn->ts == TS_VOID) {
     /* put nothing */
+  } else if (mv_struct(ptn, &mvb)) {
+    size_t i; /* one value per field */
+    for (i = 0; i < buflen(&mvb); ++i) {
+      mvfld_t *pf = bufref(&mvb, i);
+      *vtbnewbk(pvtb) = ts2vt(pf->ptn->ts);
+    }
   } else {
     valtype_t vt;
     if (ptn->ts == TS_ARRAY && ndlen(ptn) == 2 && ndref(ptn, 1)->nt == NT_NULL) vt = ts2vt(TS_PTR);
@@ -4167,17 +4663,18 @@ static void tn2vt(node_t *ptn, vtbuf_t *pvtb)
       *vtbnewbk(pvtb) = vt;
     }
   }
+  buffini(&mvb);
 }
 
 /* convert function type to a function signature */
 funcsig_t *ftn2fsig(node_t *ptn, funcsig_t *pfs)
 {
-  size_t i; node_t *ptni;
+  size_t i; node_t *ptni; buf_t mvb = mkbuf(sizeof(mvfld_t));
   assert(ptn->nt == NT_TYPE && ptn->ts == TS_FUNCTION);
   bufclear(&pfs->partypes);
   bufclear(&pfs->restypes);
   ptni = ndref(ptn, 0); assert(ptn->nt == NT_TYPE);
-  if (ts_bulk(ptni->ts)) { /* passed as pointer in 1st arg */
+  if (ts_bulk(ptni->ts) && !mv_struct(ptni, &mvb)) { /* passed as pointer in 1st arg */
     /* fixme: should depend on wasm32/wasm64 model */
     *vtbnewbk(&pfs->partypes) = VT_I32; /* restypes stays empty */  
   } else {
@@ -4194,6 +4691,7 @@ funcsig_t *ftn2fsig(node_t *ptn, funcsig_t *pfs)
       tn2vt(ptni, &pfs->partypes);
     }
   }
+  buffini(&mvb);
   return pfs;
 }
 
@@ -4228,13 +4726,14 @@ static void process_fundef(sym_t mmod, node_t *pn, wat_module_t *pm)
   }
   { /* post appropriate vardecl for later use */
     node_t nd = mknd();
-    ndset(&nd, NT_VARDECL, pn->pwsid, pn->startpos);
+    ndset(&nd, NT_VARDECL, pn->loc);
     nd.name = pn->name; ndpushbk(&nd, ndref(pn, 0)); 
     /* post function symbol as final, hide it if static */ 
     post_vardecl(mmod, &nd, true, pn->sc == SC_STATIC); 
     ndfini(&nd); 
   }
   /* hoist local variables */
+  phbeg("fold");
   fundef_hoist_locals(pn);
   if (getverbosity() > 0) {
     fprintf(stderr, "fundef_hoist_locals ==>\n");
@@ -4242,30 +4741,40 @@ static void process_fundef(sym_t mmod, node_t *pn, wat_module_t *pm)
   }  
   /* fold constant expressions */
   fundef_fold_constants(pn);
+  phend();
   if (getverbosity() > 0) {
     fprintf(stderr, "fundef_fold_constants ==>\n");
     dump_node(pn, stderr);
   }  
   /* convert entry to wasm conventions, normalize a bit */
+  phbeg("wasmify");
   fundef_wasmify(pn);
+  phend();
   if (getverbosity() > 0) {
     fprintf(stderr, "fundef_wasmify ==>\n");
     dump_node(pn, stderr);
   }  
   /* compile to asm tree */
+  phbeg("compile");
   pcn = fundef_compile(pn);
+  phend();
   if (getverbosity() > 0) {
     fprintf(stderr, "fundef_compile ==>\n");
     dump_node(pcn, stderr);
   }
   /* flatten asm tree */
+  phbeg("flatten");
   pcn = fundef_flatten(pcn);
+  phend();
   if (getverbosity() > 0) {
     fprintf(stderr, "fundef_flatten ==>\n");
     dump_node(pcn, stderr);
   }
   if (g_optlvl > 0) {
+    phbeg("peephole");
+    fundef_spcache(pcn);
     fundef_peephole(pcn, (int)g_optlvl);
+    phend();
     if (getverbosity() > 0) {
       fprintf(stderr, "fundef_peephole[-O%d] ==>\n", (int)g_optlvl);
       dump_node(pcn, stderr);
@@ -4355,9 +4864,10 @@ static void process_top_node(sym_t mmod, node_t *pn, wat_module_t *pm)
 }
 
 /* parse/process include file and its includes */
-static void process_include(pws_t *pw, int startpos, bool sys, sym_t name, wat_module_t *pm)
+static void process_include(const node_t *pin, bool sys, sym_t name, wat_module_t *pm)
 {
   pws_t *pwi; node_t nd = mknd();
+  phbeg("include");
   pwi = pws_from_modname(sys, name); /* searches g_ibases */
   if (pwi) {
     /* this should be workspace #1... */
@@ -4365,18 +4875,19 @@ static void process_include(pws_t *pw, int startpos, bool sys, sym_t name, wat_m
     while (parse_top_form(pwi, &nd)) {
       if (nd.nt == NT_INCLUDE) {
         bool sys = (nd.op != TT_STRING);
-        process_include(pwi, nd.startpos, sys, nd.name, pm);
+        process_include(&nd, sys, nd.name, pm);
       } else if (nd.nt != NT_NULL) {
         process_top_node(0, &nd, pm);
       }
     }
     closepws(pwi);
   } else {
-    reprintf(pw, startpos, 
+    neprintf(pin, 
       "cannot locate module %s: check -L option / WCPL_LIBRARY_PATH", 
       symname(name));
   }
   ndfini(&nd);
+  phend();
 }
 
 /* parse/process module file and its includes; return module name on success */
@@ -4392,7 +4903,7 @@ static sym_t process_module(const char *fname, wat_module_t *pm)
     while (parse_top_form(pw, &nd)) {
       if (nd.nt == NT_INCLUDE) {
         bool sys = (nd.op != TT_STRING);
-        process_include(pw, nd.startpos, sys, nd.name, pm);
+        process_include(&nd, sys, nd.name, pm);
       } else if (nd.nt != NT_NULL) {
         process_top_node(pwscurmod(pw), &nd, pm);
       }
@@ -4415,7 +4926,7 @@ void compile_module_to_wat(const char *ifname, wat_module_t *pwm)
   wat_module_clear(pwm);
 
   { /* add builtin declarations: stack pointer */
-    node_t nd = mknd(); ndset(&nd, NT_VARDECL, -1, -1);
+    node_t nd = mknd(); ndset(&nd, NT_VARDECL, 0);
     nd.name = g_sp_id; wrap_type_pointer(ndsettype(ndnewbk(&nd), TS_VOID)); 
     post_symbol(g_crt_mod, &nd, false, false);
     ndfini(&nd);
@@ -4574,16 +5085,26 @@ void compile_module_to_wat(const char *ifname, wat_module_t *pwm)
   fini_compiler();
 }
 
+static bool is_object_file(const char *fname)
+{
+  return strsuf(fname, ".o") != NULL || strsuf(fname, ".wo") != NULL 
+      || strsuf(fname, ".wbo") != NULL || strsuf(fname, ".wat") != NULL;
+}
+
 int main(int argc, char **argv)
 {
   int opt; char *eoarg;
   const char *ifile_arg = "-";
   const char *ofile_arg = NULL;
-  bool c_opt = false;
+  bool c_opt = false, r_opt = false, sm_opt = false;
+  bool sa_opt = false, sc_opt = false, su_opt = false;
+  int ret = EXIT_SUCCESS;
   long lvl_arg = 3;
   unsigned long s_arg = 131072; /* 128K default */
   unsigned long a_arg = 4096; /* 4K default */
-  const char *path;
+  unsigned long long im_arg = 0, mm_arg = 0; /* in bytes */
+  unsigned long mv_arg = 4; /* struct fields */
+  const char *path, *trep = NULL;
   dsbuf_t incv, libv; 
   
   dsbinit(&incv);
@@ -4598,26 +5119,73 @@ int main(int argc, char **argv)
      "  -w        Suppress warnings\n"
      "  -v        Increase verbosity\n"
      "  -q        Suppress logging ('quiet')\n"
-     "  -c        Compile single input file\n"
+     "  -c        Compile single input file (or convert object file)\n"
+     "  -run      Run linked program in the built-in interpreter; arguments\n"
+     "            after -- are passed to the program\n"
      "  -O lvl    Optimization level; defaults to 3\n"
-     "  -o ofile  Output file (use .wasm suffix for binary executable)\n"
+     "  -o ofile  Output file (use .wasm suffix for binary executable,\n"
+     "            .wbo suffix for binary object)\n"
      "  -I path   Add include path (must end with path separator)\n"
      "  -L path   Add library path (must end with path separator)\n"
-     "  -s stksz  Stack size in bytes; defaults to 131072 (128K)\n"
+     "  -s stksz  Stack size in bytes; defaults to 131072 (128K); use 'auto'\n"
+     "            to size it by stack usage analysis of the linked program\n"
      "  -a argsz  Argument area size in bytes (use 0 for malloc); defaults to 4096\n"
+     "  --initial-memory=size\n"
+     "            Initial memory size in bytes (multiple of 65536); defaults to\n"
+     "            the size of static data, stack and argument area\n"
+     "  --max-memory=size\n"
+     "            Maximum memory size in bytes (multiple of 65536); no maximum\n"
+     "            by default\n"
+     "  --shared-memory\n"
+     "            Import memory as shared (\"env\" \"memory\"), as required by\n"
+     "            WASI threads; needs --max-memory\n"
+     "  --multi-value=n\n"
+     "            Pass and return structures of up to n scalar fields as\n"
+     "            multiple values (0 to pass them via memory); defaults to 4;\n"
+     "            the library is built with the default (see README)\n"
+     "  -ftime-report[=file]\n"
+     "            Report time and heap allocations per compiler phase to stderr\n"
+     "            (or, if file is given, write them to file as JSON)\n"
+     "  -fstack-usage\n"
+     "            Report stack usage of each function and the worst case for\n"
+     "            the program, flagging recursion and allocas, to stderr\n"
+     "  -fstack-check\n"
+     "            Trap when the stack pointer goes below the stack's limit\n"
      "  -h        This help");
-  while ((opt = egetopt(argc, argv, "wvqcO:o:L:I:s:a:h")) != EOF) {
+  while ((opt = egetopt(argc, argv, "wvqcr:O:o:L:I:s:a:f:-:h")) != EOF) {
     switch (opt) {
       case 'w':  setwlevel(3); break;
       case 'v':  incverbosity(); break;
       case 'q':  incquietness(); break;
       case 'c':  c_opt = true; break;
+      case 'r':  {
+        if (!streql(eoptarg, "un")) eusage("unknown -r option: -r%s", eoptarg);
+        r_opt = true;
+      } break;
       case 'O':  lvl_arg = atol(eoptarg); break;
       case 'o':  ofile_arg = eoptarg; break;
       case 'I':  eoarg = eoptarg; dsbpushbk(&incv, &eoarg); break;
       case 'L':  eoarg = eoptarg; dsbpushbk(&libv, &eoarg); break;
-      case 's':  s_arg = strtoul(eoptarg, NULL, 0); break; 
+      case 's':  {
+        if (streql(eoptarg, "auto")) sa_opt = true;
+        else s_arg = strtoul(eoptarg, NULL, 0);
+      } break; 
       case 'a':  a_arg = strtoul(eoptarg, NULL, 0); break; 
+      case 'f':  {
+        if (streql(eoptarg, "time-report")) trep = "";
+        else if (strprf(eoptarg, "time-report=") != NULL) trep = eoptarg + 12;
+        else if (streql(eoptarg, "stack-usage")) su_opt = true;
+        else if (streql(eoptarg, "stack-check")) sc_opt = true;
+        else eusage("unknown -f option: -f%s", eoptarg);
+        if (trep != NULL) phenable();
+      } break;
+      case '-':  {
+        if (strprf(eoptarg, "initial-memory=") != NULL) im_arg = strtoull(eoptarg + 15, NULL, 0);
+        else if (strprf(eoptarg, "max-memory=") != NULL) mm_arg = strtoull(eoptarg + 11, NULL, 0);
+        else if (streql(eoptarg, "shared-memory")) sm_opt = true;
+        else if (strprf(eoptarg, "multi-value=") != NULL) mv_arg = strtoul(eoptarg + 12, NULL, 0);
+        else eusage("unknown option: --%s", eoptarg);
+      } break;
       case 'h':  eusage("WCPL 1.04 built on " __DATE__);
     }
   }
@@ -4626,8 +5194,23 @@ int main(int argc, char **argv)
     eusage("-s argument is outside of reasonable range");
   if (a_arg != 0 && (a_arg < 512 || a_arg > 65536))
     eusage("-a argument is outside of reasonable range");
-
-  init_wcpl(&incv, &libv, lvl_arg, (size_t)s_arg, (size_t)a_arg);
+  if (im_arg % 65536 != 0 || im_arg > 0x100000000ULL)
+    eusage("--initial-memory argument should be a multiple of 65536, up to 4G");
+  if (mm_arg % 65536 != 0 || mm_arg > 0x100000000ULL)
+    eusage("--max-memory argument should be a multiple of 65536, up to 4G");
+  if (mm_arg != 0 && im_arg > mm_arg)
+    eusage("--initial-memory argument is larger than --max-memory argument");
+  if (sm_opt && mm_arg == 0)
+    eusage("--shared-memory requires --max-memory argument");
+  if (mv_arg > 16)
+    eusage("--multi-value argument is outside of reasonable range");
+
+  init_wcpl(&incv, &libv, lvl_arg, (size_t)s_arg, (size_t)a_arg, 
+    (size_t)(im_arg/65536), (size_t)(mm_arg/65536), sm_opt, (size_t)mv_arg,
+    sa_opt, sc_opt, su_opt);
+
+  if (c_opt && r_opt)
+    eusage("-run cannot be combined with -c");
 
   if (c_opt) {
     /* compile single source file */
@@ -4635,28 +5218,44 @@ int main(int argc, char **argv)
     if (eoptind < argc) ifile_arg = argv[eoptind++];
     if (eoptind < argc) eusage("too many input files for -c mode");
     /* todo: autogenerate output file name (stdout for now) */
-    compile_module_to_wat(ifile_arg, &wm);
+    if (is_object_file(ifile_arg)) {
+      phbeg("load");
+      read_wat_object_module(ifile_arg, &wm);
+      phend();
+    } else {
+      compile_module_to_wat(ifile_arg, &wm);
+    }
+    phbeg("write");
     if (ofile_arg) {
-      FILE *pf = fopen(ofile_arg, "w");
+      bool wbo = strsuf(ofile_arg, ".wbo") != NULL;
+      FILE *pf = fopen(ofile_arg, wbo ? "wb" : "w");
       if (!pf) eprintf("cannot open output file %s:", ofile_arg);
-      write_wat_module(&wm, pf);
+      if (wbo) write_wbo_module(&wm, pf);
+      else write_wat_module(&wm, pf);
       fclose(pf);
       logef("# object module written to %s\n", ofile_arg);
     } else {
       write_wat_module(&wm, stdout);
     }
+    phend();
     wat_module_fini(&wm);   
   } else {
     /* load/compile input files, fetch libraries, link */
     wat_module_t wm; wat_module_buf_t wmb;
+    const char *prog_arg = NULL;
     if (eoptind == argc) eusage("one or more input file expected");
     wat_module_init(&wm); wat_module_buf_init(&wmb);
     while (eoptind < argc) {
-      wat_module_t *pwm = wat_module_buf_newbk(&wmb);
+      wat_module_t *pwm;
+      if (r_opt && streql(argv[eoptind], "--")) { ++eoptind; break; }
+      pwm = wat_module_buf_newbk(&wmb);
       ifile_arg = argv[eoptind++];
-      if (strsuf(ifile_arg, ".o") != NULL || strsuf(ifile_arg, ".wo") != NULL || strsuf(ifile_arg, ".wat") != NULL) {
+      if (prog_arg == NULL) prog_arg = ifile_arg;
+      if (is_object_file(ifile_arg)) {
         logef("# loading object module from %s\n", ifile_arg);
+        phbeg("load");
         read_wat_object_module(ifile_arg, pwm);
+        phend();
         logef("# object module '%s' loaded\n", symname(pwm->name));
       } else {
         logef("# compiling source file %s\n", ifile_arg);
@@ -4664,7 +5263,9 @@ int main(int argc, char **argv)
         logef("# object module '%s' created\n", symname(pwm->name));
       }
     }
+    phbeg("link");
     link_wat_modules(&wmb, &wm);
+    phend();
     logef("# all modules linked successfully\n", symname(g_wasi_mod));
 
     if (ofile_arg) {
@@ -4674,26 +5275,61 @@ int main(int argc, char **argv)
         pf = fopen(ofile_arg, "wb");
         if (!pf) eprintf("cannot open output file %s:", ofile_arg);
         wasm_module_init(&wbm);
+        phbeg("wat_to_wasm");
         wat_to_wasm(&wm, &wbm);
+        phend();
+        phbeg("write");
         write_wasm_module(&wbm, pf);
+        phend();
         wasm_module_fini(&wbm);
       } else {
         pf = fopen(ofile_arg, "w");
         if (!pf) eprintf("cannot open output file %s:", ofile_arg);
+        phbeg("write");
         write_wat_module(&wm, pf);
+        phend();
       }
       fclose(pf);
       logef("# executable module written to %s\n", ofile_arg);
-    } else {
+    } else if (!r_opt) {
+      phbeg("write");
       write_wat_module(&wm, stdout);
+      phend();
+    }
+
+    if (r_opt) {
+      /* run it: program name is the first input file */
+      wasm_module_t wbm; char **pargv; int pargc = 1;
+      if (prog_arg == NULL) eusage("one or more input file expected");
+      pargv = emalloc((argc - eoptind + 2) * sizeof(char*));
+      pargv[0] = (char*)prog_arg;
+      while (eoptind < argc) pargv[pargc++] = argv[eoptind++];
+      pargv[pargc] = NULL;
+      wasm_module_init(&wbm);
+      phbeg("wat_to_wasm");
+      wat_to_wasm(&wm, &wbm);
+      phend();
+      logef("# running %s\n", prog_arg);
+      ret = run_wasm_module(&wbm, pargc, pargv);
+      wasm_module_fini(&wbm);
+      free(pargv);
     }
 
     wat_module_fini(&wm);
     wat_module_buf_fini(&wmb); 
   }
 
+  if (trep != NULL && *trep == 0) {
+    phreport(stderr, false);
+  } else if (trep != NULL) {
+    FILE *pf = fopen(trep, "w");
+    if (!pf) eprintf("cannot open time report file %s:", trep);
+    phreport(pf, true);
+    fclose(pf);
+  }
+
   fini_wcpl();
   dsbfini(&incv); dsbfini(&libv);
-  return EXIT_SUCCESS;
+  return ret;
 }
 
@@ -9,13 +9,21 @@ extern buf_t  *g_lbases;   /* module object module search bases */
 extern fsbuf_t g_funcsigs; /* unique function signatures */
 extern sym_t   g_crt_mod;  /* C runtime module */
 extern sym_t   g_wasi_mod; /* WASI module */
+extern sym_t   g_wasit_mod; /* WASI threads module */
 extern sym_t   g_lm_id;    /* id for linear memory */
 extern sym_t   g_sp_id;    /* id for stack pointer global */
 extern sym_t   g_sb_id;    /* id for stack base global */
 extern sym_t   g_hb_id;    /* id for heap base global */
 extern size_t  g_sdbaddr;  /* static data allocation start */
 extern size_t  g_stacksz;  /* stack size in bytes */
+extern bool    g_stkauto;  /* size stack by stack usage analysis */
+extern bool    g_stkcheck; /* trap on stack overflow */
+extern bool    g_stkreport; /* report stack usage */
 extern size_t  g_argvbsz;  /* argv buf size in bytes */
+extern size_t  g_imempg;   /* initial memory size in pages, or 0 */
+extern size_t  g_mmempg;   /* maximum memory size in pages, or 0 */
+extern bool    g_sharedmem; /* imported shared memory (threads) */
+extern size_t  g_mvlimit;  /* max struct fields passed as multiple values */
 
 /* static eval value */
 typedef struct seval {
@@ -0,0 +1,90 @@
+#!/bin/sh
+# Benchmark suite over the examples: compiles each benchmark at -O0..-O3
+# and runs it in wcpl's built-in interpreter (-run).
+#
+# usage: bench.sh [-w wcpl] [-r runs] [-o results.tsv] [-b baseline.tsv]
+#
+# Results are written as tab-separated lines, one per benchmark and
+# optimization level:
+#
+#   bench  opt  compile_ms  wasm_bytes  funcs  locals  instrs  run_ms  output
+#
+# compile_ms is the total from -ftime-report, funcs and locals are counted
+# in the WAT output, instrs is the number of WASM instructions executed by
+# the interpreter, run_ms is the best of -r runs (default 1) and output is
+# a checksum of the program's stdout. All columns but compile_ms and run_ms
+# are deterministic, so result files of two commits can be compared with
+# diff; -b prints relative changes of each column against an earlier
+# result file instead.
+
+WCPL=../wcpl
+OUT=
+BASE=
+REPS=1
+while getopts w:r:o:b: opt; do
+  case $opt in
+    w) WCPL=$OPTARG ;;
+    r) REPS=$OPTARG ;;
+    o) OUT=$OPTARG ;;
+    b) BASE=$OPTARG ;;
+    *) echo "usage: $0 [-w wcpl] [-r runs] [-o results.tsv] [-b baseline.tsv]" >&2; exit 1 ;;
+  esac
+done
+
+cd "$(dirname "$0")" || exit 1
+TMP=${TMPDIR:-/tmp}/wcpl-bench.$$
+mkdir -p "$TMP" || exit 1
+trap 'rm -rf "$TMP"' EXIT INT TERM
+
+# name, arguments and standard input of each benchmark
+BENCHES="binarytrees:12:
+fannkuchredux:8:
+nbody:50000:
+spectralnorm:200:
+pi:200:
+sudoku::sudoku.txt"
+
+bench() { # name args input opt
+  "$WCPL" -q -O"$4" -ftime-report="$TMP/tr" -o "$TMP/b.wasm" "$1.c" || return 1
+  "$WCPL" -q -O"$4" -o "$TMP/b.wat" "$1.c" || return 1
+  cms=$(sed -n '1s/^{"total_ms": *\([0-9.]*\).*/\1/p' "$TMP/tr")
+  size=$(wc -c < "$TMP/b.wasm" | tr -d ' ')
+  funcs=$(grep -c '^  (func ' "$TMP/b.wat")
+  locals=$(grep -o '(local ' "$TMP/b.wat" | wc -l | tr -d ' ')
+  i=0; : > "$TMP/err"
+  while [ $i -lt $REPS ]; do
+    "$WCPL" -O"$4" -run "$1.c" -- $2 < "${3:-/dev/null}" > "$TMP/out" 2>> "$TMP/err"
+    i=$((i + 1))
+  done
+  run=$(awk '$3 == "instructions" && $4 == "executed" {
+    if (t == "" || $6 < t) t = $6; n = $2 } END { if (n != "") printf "%s\t%.0f", n, t * 1000 }' "$TMP/err")
+  [ -n "$run" ] || { cat "$TMP/err" >&2; return 1; }
+  sum=$(cksum < "$TMP/out" | awk '{ print $1 }')
+  printf '%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\n' "$1" "O$4" "$cms" "$size" "$funcs" "$locals" "$run" "$sum"
+}
+
+{
+  printf 'bench\topt\tcompile_ms\twasm_bytes\tfuncs\tlocals\tinstrs\trun_ms\toutput\n'
+  echo "$BENCHES" | while IFS=: read -r name args input; do
+    for o in 0 1 2 3; do
+      bench "$name" "$args" "$input" $o || echo "$name: -O$o failed" >&2
+    done
+  done
+} > "$TMP/res"
+
+if [ -n "$OUT" ]; then cp "$TMP/res" "$OUT"; fi
+if [ -z "$BASE" ]; then cat "$TMP/res"; exit 0; fi
+
+# compare with baseline: % change of numeric columns, output mismatches
+awk -F'\t' '
+  function d(n, o) { return o == 0 ? (n == 0 ? "=" : "new") : n == o ? "=" : sprintf("%+.1f%%", (n - o) * 100 / o) }
+  NR == FNR { if (FNR > 1) base[$1 "\t" $2] = $0; next }
+  FNR == 1 { print; next }
+  {
+    k = $1 "\t" $2
+    if (!(k in base)) { print $0 "\t(no baseline)"; next }
+    split(base[k], b, "\t")
+    printf "%s\t%s", $1, $2
+    for (i = 3; i <= 8; ++i) printf "\t%s", d($i + 0, b[i] + 0)
+    printf "\t%s\n", $9 == b[9] ? "=" : "CHANGED"
+  }' "$BASE" "$TMP/res"
@@ -51,10 +51,14 @@ void eprintf(const char *fmt, ...)
   exit(2); /* conventional value for failed execution */
 }
 
+/* heap allocation statistics (see -ftime-report) */
+static size_t g_nallocs = 0, g_allocsz = 0;
+
 void *emalloc(size_t n)
 {
   void *p = malloc(n);
   if (p == NULL) eprintf("malloc() failed:");
+  ++g_nallocs; g_allocsz += n;
   return p;
 }
 
@@ -62,16 +66,25 @@ void *ecalloc(size_t n, size_t s)
 {
   void *p = calloc(n, s);
   if (p == NULL) eprintf("calloc() failed:");
+  ++g_nallocs; g_allocsz += n * s;
   return p;
 }
 
-void *erealloc(void *m, size_t n)
+/* realloc of block of size n0 to size n; only the growth is counted */
+static void *egrow(void *m, size_t n0, size_t n)
 {
   void *p = realloc(m, n);
   if (p == NULL) eprintf("realloc() failed:");
+  ++g_nallocs; if (m == NULL) g_allocsz += n; else if (n > n0) g_allocsz += n - n0;
   return p;
 }
 
+void *erealloc(void *m, size_t n)
+{
+  /* old size is unknown: count fresh blocks only */
+  return egrow(m, n, n);
+}
+
 char *estrdup(const char *s)
 {
   char *t = (char *)emalloc(strlen(s)+1);
@@ -599,7 +612,7 @@ void bufgrow(buf_t* pb, size_t n)
     size_t oldsz = pb->end;
     size_t newsz = oldsz*2;
     if (oldsz + n > newsz) newsz += n;
-    pb->buf = erealloc(pb->buf, newsz*pb->esz);
+    pb->buf = egrow(pb->buf, oldsz*pb->esz, newsz*pb->esz);
     pb->end = newsz;
   }
 }
@@ -832,6 +845,68 @@ void bufswap(buf_t* pb1, buf_t* pb2)
   memswap(pb1, pb2, sizeof(buf_t));
 }
 
+/* hash indices over buffers */
+
+hidx_t* hidxinit(hidx_t* pi)
+{
+  assert(pi);
+  memset(pi, 0, sizeof(hidx_t));
+  return pi;
+}
+
+void hidxfini(hidx_t* pi)
+{
+  assert(pi);
+  free(pi->slots);
+  free(pi->hashes);
+}
+
+void hidxadd(hidx_t* pi, unsigned long h, size_t i)
+{
+  size_t j, mask;
+  assert(pi);
+  if (2*(pi->cnt+1) > pi->sz) { /* keep load under 1/2 */
+    size_t k, osz = pi->sz, *oslots = pi->slots; 
+    unsigned long *ohashes = pi->hashes;
+    pi->sz = osz ? osz*2 : 64; mask = pi->sz-1;
+    pi->slots = ecalloc(pi->sz, sizeof(size_t));
+    pi->hashes = emalloc(pi->sz * sizeof(unsigned long));
+    for (k = 0; k < osz; ++k) {
+      if (oslots[k] == 0) continue;
+      for (j = ohashes[k] & mask; pi->slots[j]; j = (j+1) & mask) ;
+      pi->slots[j] = oslots[k]; pi->hashes[j] = ohashes[k];
+    }
+    free(oslots); free(ohashes);
+  }
+  mask = pi->sz-1;
+  for (j = h & mask; pi->slots[j]; j = (j+1) & mask) ;
+  pi->slots[j] = i+1; pi->hashes[j] = h;
+  ++pi->cnt;
+}
+
+void* bufhsearch(const buf_t* pb, const hidx_t* pi, const void *pe, unsigned long h, int (*cmp)(const void *, const void *))
+{
+  size_t j, mask;
+  assert(pb); assert(pi); assert(pe); assert(cmp);
+  if (pi->sz == 0) return NULL;
+  mask = pi->sz-1;
+  for (j = h & mask; pi->slots[j]; j = (j+1) & mask) {
+    if (pi->hashes[j] == h) {
+      char *pd = (char*)pb->buf + pb->esz*(pi->slots[j]-1);
+      if (0 == (*cmp)(pd, pe)) return pd;
+    }
+  }
+  return NULL;
+}
+
+/* FNV-1a */
+unsigned long memhash(const void *p, size_t n)
+{
+  const unsigned char *pc = (const unsigned char *)p; unsigned long h = 2166136261UL;
+  while (n-- > 0) h = (h ^ *pc++) * 16777619UL;
+  return h;
+}
+
 /* unicode charsets */
 
 bool ucsin(unsigned c, const ucset_t *ps)
@@ -1248,6 +1323,23 @@ char *fgetlb(cbuf_t *pcb, FILE *fp)
   return cbdata(pcb);
 }
 
+/* read the rest of fp into pcb in large chunks; NULL on read errors */
+char *fgetall(cbuf_t *pcb, FILE *fp)
+{
+  size_t n, chunk;
+  assert(fp); assert(pcb);
+  cbclear(pcb);
+  do {
+    char *pc; /* read in chunks growing with the buffer */
+    chunk = cblen(pcb) < 0x10000 ? 0x10000 : cblen(pcb);
+    pc = cballoc(pcb, chunk);
+    n = fread(pc, 1, chunk, fp);
+    pcb->fill -= chunk - n;
+  } while (n == chunk);
+  if (ferror(fp)) return NULL;
+  return cbdata(pcb);
+}
+
 /* convert wchar_t string to utf-8 string
  * if rc = 0, return NULL on errors, else subst rc */
 char *wcsto8cb(const wchar_t *wstr, int rc, cbuf_t *pcb)
@@ -1396,9 +1488,75 @@ void bindouble(double d, cbuf_t* pcb) /* align=8 */
 }
 
 
+/* arenas */
+
+arena_t* arinit(arena_t* pa, size_t chunksz)
+{
+  assert(pa);
+  pa->chunks = NULL;
+  pa->curp = pa->endp = NULL;
+  pa->chunksz = chunksz;
+  return pa;
+}
+
+void arfini(arena_t* pa)
+{
+  armark_t m; m.chunk = NULL, m.curp = NULL;
+  arrelease(pa, &m);
+}
+
+void *aralloc(arena_t* pa, size_t n)
+{
+  char *p; assert(pa);
+  n = (n + 7) & ~(size_t)7;
+  if (pa->curp == NULL || (size_t)(pa->endp - pa->curp) < n) {
+    size_t hsz = (sizeof(archunk_t) + 7) & ~(size_t)7;
+    size_t csz = pa->chunksz != 0 ? pa->chunksz : 0x10000;
+    archunk_t *pc;
+    if (csz < n) csz = n; /* oversized request gets its own chunk */
+    pc = emalloc(hsz + csz);
+    pc->next = pa->chunks, pc->size = csz;
+    pa->chunks = pc;
+    pa->curp = (char*)pc + hsz, pa->endp = pa->curp + csz;
+  }
+  p = pa->curp; pa->curp += n;
+  return p;
+}
+
+char *arstrdup(arena_t* pa, const char *s)
+{
+  size_t n = strlen(s) + 1;
+  return memcpy(aralloc(pa, n), s, n);
+}
+
+void armark(arena_t* pa, armark_t *pm)
+{
+  assert(pa); assert(pm);
+  pm->chunk = pa->chunks, pm->curp = pa->curp;
+}
+
+void arrelease(arena_t* pa, const armark_t *pm)
+{
+  assert(pa); assert(pm);
+  while (pa->chunks != pm->chunk) {
+    archunk_t *pc = pa->chunks;
+    assert(pc != NULL); /* mark should be from this arena */
+    pa->chunks = pc->next;
+    free(pc);
+  }
+  if (pm->chunk != NULL) {
+    size_t hsz = (sizeof(archunk_t) + 7) & ~(size_t)7;
+    pa->curp = pm->curp, pa->endp = (char*)pm->chunk + hsz + pm->chunk->size;
+  } else {
+    pa->curp = pa->endp = NULL;
+  }
+}
+
+
 /* symbols */
 
 static struct { char **a; char ***v; size_t sz; size_t u; size_t maxu; } g_symt;
+static arena_t g_symar; /* symbol names */
 
 static unsigned long hashs(const char *s) {
   unsigned long i = 0, l = (unsigned long)strlen(s), h = l;
@@ -1441,8 +1599,7 @@ sym_t intern(const char *name)
       for (i = h & (g_symt.sz-1); g_symt.v[i]; i = (i-1) & (g_symt.sz-1)) ;
     }
   }
-  *(g_symt.v[i] = g_symt.a + g_symt.u) = 
-    strcpy(emalloc(strlen(name)+1), name);
+  *(g_symt.v[i] = g_symt.a + g_symt.u) = arstrdup(&g_symar, name);
   sym = (int)((g_symt.u)++);
   return (sym_t)(sym+1);
 }
@@ -1462,11 +1619,7 @@ sym_t internf(const char *fmt, ...)
 void clearsyms(void)
 {
   if (g_symt.sz != 0) {
-    size_t i;
-    for (i = 0; i < g_symt.sz; ++i) {
-      char **p = g_symt.v[i];
-      if (p) free(*p);
-    }
+    arfini(&g_symar); /* all names at once */
     free(g_symt.v); g_symt.v = NULL;
     free(g_symt.a); g_symt.a = NULL;
     g_symt.sz = g_symt.u = g_symt.maxu = 0;
@@ -1474,6 +1627,183 @@ void clearsyms(void)
 }
 
 
+/* perfect hash tables */
+
+typedef struct phtent { const char *name; int val; unsigned h0, h1; } phtent_t;
+
+static void phthash(const char *s, unsigned *ph0, unsigned *ph1)
+{
+  unsigned h0 = 2166136261U, h1 = 0x9E3779B9U;
+  while (*s) {
+    unsigned c = (unsigned char)*s++;
+    h0 = (h0 ^ c) * 16777619U;
+    h1 = (h1 + c) * 0x5BD1E995U; h1 ^= h1 >> 15;
+  }
+  *ph0 = h0 * 0x27D4EB2DU, *ph1 = h1;
+}
+
+static unsigned phtslot(unsigned h1, unsigned d, int sbits)
+{
+  return ((h1 ^ (d * 0x9E3779B9U)) * 0x85EBCA6BU) >> (32 - sbits);
+}
+
+phtab_t* phtinit(phtab_t *pt)
+{
+  memset(pt, 0, sizeof(phtab_t));
+  bufinit(&pt->ents, sizeof(phtent_t));
+  return pt;
+}
+
+void phtfini(phtab_t *pt)
+{
+  buffini(&pt->ents);
+  free(pt->disps); free(pt->slots);
+}
+
+void phtadd(phtab_t *pt, const char *name, int val)
+{
+  phtent_t *pe = bufnewbk(&pt->ents);
+  assert(pt->slots == NULL);
+  pe->name = name, pe->val = val;
+  phthash(name, &pe->h0, &pe->h1);
+}
+
+/* hash-and-displace: buckets are placed biggest first, each trying
+ * displacements until all its names land in free slots */
+void phtbuild(phtab_t *pt)
+{
+  size_t n = buflen(&pt->ents), i, j, k, nb, ns;
+  phtent_t *pents = (phtent_t*)pt->ents.buf;
+  buf_t order, bkt; bool ok = false;
+  bufinit(&order, sizeof(size_t)); bufinit(&bkt, sizeof(size_t));
+  pt->sbits = 2; while (((size_t)1 << pt->sbits) < n + n/4) pt->sbits += 1;
+  for (; !ok; pt->sbits += 1) {
+    size_t *pcnt; unsigned d;
+    pt->bbits = pt->sbits - 1;
+    nb = (size_t)1 << pt->bbits, ns = (size_t)1 << pt->sbits;
+    free(pt->disps); free(pt->slots);
+    pt->disps = ecalloc(nb, sizeof(unsigned));
+    pt->slots = emalloc(ns * sizeof(int));
+    for (i = 0; i < ns; ++i) pt->slots[i] = -1;
+    /* sort buckets by size, biggest first */
+    pcnt = ecalloc(nb, sizeof(size_t));
+    for (i = 0; i < n; ++i) pcnt[pents[i].h0 >> (32 - pt->bbits)] += 1;
+    bufclear(&order);
+    for (k = n; k > 0; --k) {
+      for (j = 0; j < nb; ++j) if (pcnt[j] == k) *(size_t*)bufnewbk(&order) = j;
+    }
+    free(pcnt);
+    ok = true;
+    for (j = 0; ok && j < buflen(&order); ++j) {
+      size_t b = *(size_t*)bufref(&order, j);
+      bufclear(&bkt);
+      for (i = 0; i < n; ++i) {
+        if ((size_t)(pents[i].h0 >> (32 - pt->bbits)) != b) continue;
+        for (k = 0; k < buflen(&bkt); ++k) { /* same name twice: keep first */
+          if (strcmp(pents[*(size_t*)bufref(&bkt, k)].name, pents[i].name) == 0) break;
+        }
+        if (k == buflen(&bkt)) *(size_t*)bufnewbk(&bkt) = i;
+      }
+      for (d = 0; d < 0x10000U; ++d) {
+        for (k = 0; k < buflen(&bkt); ++k) {
+          size_t e = *(size_t*)bufref(&bkt, k), m;
+          unsigned s = phtslot(pents[e].h1, d, pt->sbits);
+          if (pt->slots[s] >= 0) break;
+          for (m = 0; m < k; ++m) {
+            size_t e2 = *(size_t*)bufref(&bkt, m);
+            if (phtslot(pents[e2].h1, d, pt->sbits) == s) break;
+          }
+          if (m < k) break;
+        }
+        if (k == buflen(&bkt)) break;
+      }
+      if (d == 0x10000U) ok = false; /* retry with more slots */
+      else {
+        pt->disps[b] = d;
+        for (k = 0; k < buflen(&bkt); ++k) {
+          size_t e = *(size_t*)bufref(&bkt, k);
+          pt->slots[phtslot(pents[e].h1, d, pt->sbits)] = (int)e;
+        }
+      }
+    }
+  }
+  pt->sbits -= 1; /* undo last increment */
+  buffini(&order); buffini(&bkt);
+}
+
+bool phtlookup(const phtab_t *pt, const char *name, int *pval)
+{
+  unsigned h0, h1; int e; const phtent_t *pe;
+  if (pt->slots == NULL) return false;
+  phthash(name, &h0, &h1);
+  e = pt->slots[phtslot(h1, pt->disps[h0 >> (32 - pt->bbits)], pt->sbits)];
+  if (e < 0) return false;
+  pe = (const phtent_t*)pt->ents.buf + e;
+  if (strcmp(pe->name, name) != 0) return false;
+  if (pval) *pval = pe->val;
+  return true;
+}
+
+
+/* source locations */
+
+static struct { srcloc_t *bases; void **srcs; size_t sz; size_t u; srcloc_t next; } g_srct;
+
+srcloc_t srcreg(void *src, size_t size)
+{
+  srcloc_t base;
+  if (g_srct.sz == 0) { /* init; 0 is reserved for 'no location' */
+    g_srct.bases = ecalloc(16, sizeof(srcloc_t));
+    g_srct.srcs = ecalloc(16, sizeof(void*));
+    g_srct.sz = 16, g_srct.next = 1;
+  } else if (g_srct.u == g_srct.sz) {
+    g_srct.sz *= 2;
+    g_srct.bases = egrow(g_srct.bases, g_srct.u * sizeof(srcloc_t), g_srct.sz * sizeof(srcloc_t));
+    g_srct.srcs = egrow(g_srct.srcs, g_srct.u * sizeof(void*), g_srct.sz * sizeof(void*));
+  }
+  base = g_srct.next;
+  /* on overflow, leftover sources share the last location */
+  if (size < (size_t)(0xFFFFFFFFU - base)) g_srct.next = base + (srcloc_t)size + 1;
+  else g_srct.next = 0xFFFFFFFFU;
+  g_srct.bases[g_srct.u] = base;
+  g_srct.srcs[g_srct.u] = src;
+  g_srct.u += 1;
+  return base;
+}
+
+void *srcfind(srcloc_t loc, size_t *poff)
+{
+  size_t lo = 0, hi = g_srct.u; 
+  if (loc == 0 || hi == 0 || loc < g_srct.bases[0]) return NULL;
+  while (hi - lo > 1) { /* bases[lo] <= loc < bases[hi] */
+    size_t mid = lo + (hi - lo) / 2;
+    if (g_srct.bases[mid] <= loc) lo = mid; else hi = mid;
+  }
+  if (poff) *poff = (size_t)(loc - g_srct.bases[lo]);
+  return g_srct.srcs[lo];
+}
+
+void clearsrcs(void)
+{
+  if (g_srct.sz > 0) {
+    free(g_srct.bases); free(g_srct.srcs);
+    memset(&g_srct, 0, sizeof(g_srct));
+  }
+}
+
+void bufpos2lnoff(const buf_t* plsposs, size_t pos, int *pln1, int *poff0)
+{
+  size_t lo = 0, hi = buflen(plsposs), *plsp = (size_t*)plsposs->buf;
+  if (hi == 0 || pos < plsp[0]) { *pln1 = 1; *poff0 = (int)pos; return; }
+  while (hi - lo > 1) { /* plsp[lo] <= pos < plsp[hi] */
+    size_t mid = lo + (hi - lo) / 2;
+    if (plsp[mid] <= pos) lo = mid; else hi = mid;
+  }
+  *pln1 = (int)lo + 1;
+  *poff0 = (int)(pos - plsp[lo]);
+}
+
+
 /* path name components */
 
 /* returns trailing file name */
@@ -1647,6 +1977,131 @@ void lllogef(const char *fmt, ...)
   va_end(args);
 }
 
+/* phase statistics and -ftime-report: processor time and heap allocations
+ * per named phase; phases nest, so 'self' figures go to the innermost active
+ * phase while 'total' ones span the outermost activation of each phase */
+
+#define PHMAX 32 /* distinct phases */
+#define PHDEPTH 64 /* nesting depth */
+typedef struct phase {
+  const char *name; size_t calls, depth;
+  clock_t self, total, tstart;
+  size_t sallocs, tallocs, astart; 
+  size_t sbytes, tbytes, bstart;
+} phase_t;
+static struct { 
+  bool on; size_t n, sp; clock_t t0, tlast; size_t alast, blast;
+  phase_t phs[PHMAX]; size_t stk[PHDEPTH];
+} g_phst;
+
+void phenable(void)
+{
+  memset(&g_phst, 0, sizeof(g_phst));
+  g_phst.on = true; g_phst.n = 1; 
+  g_phst.phs[0].name = "(other)"; /* time outside of any phase */
+  g_phst.t0 = g_phst.tlast = clock();
+  g_phst.alast = g_phst.phs[0].astart = g_nallocs; 
+  g_phst.blast = g_phst.phs[0].bstart = g_allocsz;
+}
+
+bool phenabled(void)
+{
+  return g_phst.on;
+}
+
+/* charge resources used since last event to innermost phase */
+static clock_t phcharge(void)
+{
+  clock_t t = clock();
+  phase_t *pph = &g_phst.phs[g_phst.sp > 0 ? g_phst.stk[g_phst.sp-1] : 0];
+  pph->self += t - g_phst.tlast; g_phst.tlast = t;
+  pph->sallocs += g_nallocs - g_phst.alast; g_phst.alast = g_nallocs;
+  pph->sbytes += g_allocsz - g_phst.blast; g_phst.blast = g_allocsz;
+  return t;
+}
+
+/* enter phase; name should be a string literal */
+void phbeg(const char *name)
+{
+  size_t i; phase_t *pph; clock_t t;
+  if (!g_phst.on) return;
+  t = phcharge();
+  for (i = 1; i < g_phst.n; ++i) if (g_phst.phs[i].name == name) break;
+  if (i == g_phst.n) {
+    for (i = 1; i < g_phst.n; ++i) if (streql(g_phst.phs[i].name, name)) break;
+    if (i == g_phst.n) {
+      assert(g_phst.n < PHMAX);
+      g_phst.phs[g_phst.n++].name = name;
+    }
+  }
+  pph = &g_phst.phs[i]; ++pph->calls;
+  if (pph->depth++ == 0) {
+    pph->tstart = t; pph->astart = g_nallocs; pph->bstart = g_allocsz;
+  }
+  assert(g_phst.sp < PHDEPTH);
+  g_phst.stk[g_phst.sp++] = i;
+}
+
+/* leave innermost phase */
+void phend(void)
+{
+  phase_t *pph; clock_t t;
+  if (!g_phst.on) return;
+  t = phcharge();
+  assert(g_phst.sp > 0);
+  pph = &g_phst.phs[g_phst.stk[--g_phst.sp]];
+  if (--pph->depth == 0) {
+    pph->total += t - pph->tstart;
+    pph->tallocs += g_nallocs - pph->astart;
+    pph->tbytes += g_allocsz - pph->bstart;
+  }
+}
+
+static double clock2ms(clock_t t)
+{
+  return (double)t * 1000.0 / (double)CLOCKS_PER_SEC;
+}
+
+/* print phase statistics as a table (self figures add up to the total)
+ * or as a JSON object with both self and total figures */
+void phreport(FILE *fp, bool json)
+{
+  size_t i; clock_t total; 
+  if (!g_phst.on) return;
+  total = phcharge() - g_phst.t0;
+  if (json) {
+    fprintf(fp, "{\"total_ms\": %.3f, \"allocs\": %lu, \"alloc_bytes\": %lu, \"phases\": [", 
+      clock2ms(total), (unsigned long)(g_nallocs - g_phst.phs[0].astart), 
+      (unsigned long)(g_allocsz - g_phst.phs[0].bstart));
+    for (i = 1; i <= g_phst.n; ++i) {
+      phase_t *pph = &g_phst.phs[i % g_phst.n]; /* (other) goes last */
+      fprintf(fp, "%s\n  {\"name\": \"%s\", \"calls\": %lu, \"self_ms\": %.3f, \"total_ms\": %.3f, "
+        "\"self_allocs\": %lu, \"total_allocs\": %lu, \"self_alloc_bytes\": %lu, \"total_alloc_bytes\": %lu}",
+        i > 1 ? "," : "", pph->name, (unsigned long)pph->calls, clock2ms(pph->self), clock2ms(pph->total),
+        (unsigned long)pph->sallocs, (unsigned long)pph->tallocs, 
+        (unsigned long)pph->sbytes, (unsigned long)pph->tbytes);
+    }
+    fprintf(fp, "\n]}\n");
+  } else {
+    fprintf(fp, "%-14s %9s %10s %10s %10s %10s\n", 
+      "phase", "calls", "self ms", "total ms", "allocs", "alloc KB");
+    for (i = 1; i <= g_phst.n; ++i) {
+      phase_t *pph = &g_phst.phs[i % g_phst.n]; 
+      if (i == g_phst.n) {
+        fprintf(fp, "%-14s %9s %10.2f %10s %10lu %10lu\n", pph->name, "", clock2ms(pph->self), "",
+          (unsigned long)pph->sallocs, (unsigned long)(pph->sbytes / 1024));
+      } else {
+        fprintf(fp, "%-14s %9lu %10.2f %10.2f %10lu %10lu\n", pph->name, (unsigned long)pph->calls,
+          clock2ms(pph->self), clock2ms(pph->total), (unsigned long)pph->sallocs, 
+          (unsigned long)(pph->sbytes / 1024));
+      }
+    }
+    fprintf(fp, "%-14s %9s %10s %10.2f %10lu %10lu\n", "total", "", "", clock2ms(total),
+      (unsigned long)(g_nallocs - g_phst.phs[0].astart), 
+      (unsigned long)((g_allocsz - g_phst.phs[0].bstart) / 1024));
+  }
+}
+
 /* progname: return stored name of program */
 const char *progname(void)
 {
@@ -1776,7 +2231,7 @@ int egetopt(int argc, char* argv[], const char* opts)
 
 
 /* NB: the section below is generated with the help of baz archiver (see https://github.com/false-schemers/baz); the command is:
-*  baz cvfz l.c --exclude="src" --exclude="lib/include/NDEBUG" --exclude="README.md" --zopfli=1000 wcpl/lib */
+*  baz cvfz l.c --exclude="src" --exclude="lib/include/NDEBUG" --exclude="README.md" --exclude="*.wo" --zopfli=1000 wcpl/lib */
 
 struct memdir {
   const char *path;
@@ -1788,322 +2243,6 @@ struct memdir {
 
 /* start of in-memory archive */
 
-/* lib/crt.args.wo (DEFLATEd, org. size 4765) */
-static unsigned char file_l_0[881] =
-  "\305\130\333\156\243\60\20\175\137\151\377\301\102\171\10\17\33\5\162\121\124\251\177\122\11\31\30\122\253\140\263\266\111"
-  "\333\375\372\5\14\31\300\64\70\152\126\53\125\25\36\316\234\271\333\46\353\102\244\125\16\144\225\110\375\363\7\41"
-  "\153\126\224\102\152\342\275\123\305\42\305\151\251\136\205\216\112\11\27\6\357\201\107\274\54\215\336\45\323\340\221\165"
-  "\126\361\204\254\346\221\117\75\216\254\113\52\151\101\330\56\364\335\236\45\250\52\327\355\302\367\335\234\242\362\254\242"
-  "\63\350\45\247\172\334\343\215\53\366\7\234\135\100\364\103\35\51\245\110\42\370\140\213\76\364\100\64\217\126\12\50"
-  "\204\374\154\33\342\251\173\136\303\207\261\154\326\236\117\102\203\75\347\42\246\271\301\106\165\140\27\204\266\313\32\271"
-  "\56\52\335\105\124\377\337\44\202\53\115\266\376\274\176\62\326\117\356\321\27\134\203\54\242\104\124\134\43\315\120\172"
-  "\17\233\52\127\110\122\57\276\322\335\207\373\160\116\135\323\344\55\212\251\2\144\101\231\347\67\74\16\64\257\100\313"
-  "\11\213\21\55\221\244\124\123\103\1\105\251\77\115\155\56\124\22\232\263\63\177\336\223\246\1\237\117\15\266\106\113"
-  "\310\66\250\221\252\303\312\274\40\215\160\123\126\72\252\21\104\144\231\2\375\334\147\153\254\100\214\13\206\76\60\364"
-  "\201\15\74\116\201\36\153\12\304\353\200\101\112\41\237\110\305\151\234\3\321\202\110\320\222\301\5\152\215\242\240\74"
-  "\375\225\63\16\244\216\244\52\200\153\365\302\137\266\133\17\115\214\272\240\351\176\205\111\33\112\75\337\116\104\20\236"
-  "\14\121\203\60\104\214\63\315\150\136\277\105\32\224\31\273\265\102\56\222\246\130\255\363\246\71\172\21\257\212\250\324"
-  "\122\215\245\355\364\307\125\66\226\66\70\133\312\147\100\300\323\31\102\333\116\134\256\306\202\154\52\140\301\124\20\116"
-  "\5\273\116\140\142\65\215\271\71\203\276\216\210\171\321\302\67\12\164\153\166\1\214\355\272\13\121\242\252\170\244\247"
-  "\54\75\27\353\331\14\30\367\246\251\375\55\12\70\164\317\331\220\363\214\21\335\362\114\202\256\44\67\317\220\253\216"
-  "\52\256\71\336\332\306\30\123\242\233\363\262\301\70\243\200\246\251\131\324\370\334\361\144\31\232\320\0\135\217\116\215"
-  "\34\17\207\335\141\140\210\247\16\151\212\145\304\262\57\143\103\174\56\150\172\335\66\372\211\273\301\17\277\377\1\177"
-  "\140\247\21\263\202\143\172\267\133\166\227\341\6\77\261\202\143\357\36\317\336\216\307\166\37\167\16\53\352\43\112\44"
-  "\24\121\145\7\176\43\342\263\356\25\254\211\130\60\71\206\162\153\302\147\43\121\66\55\360\164\301\60\276\260\153\150"
-  "\117\120\121\345\16\211\64\126\355\322\342\101\154\347\310\356\213\5\227\261\41\320\147\124\301\126\161\34\370\377\65\352"
-  "\30\302\3\206\324\275\122\355\301\165\303\161\245\205\4\313\336\202\363\326\346\216\7\306\375\161\315\263\45\337\75\131"
-  "\170\212\145\150\126\56\107\310\151\41\223\341\325\120\266\31\137\323\334\23\352\152\335\52\371\202\157\73\213\357\160\162"
-  "\363\12\65\302\357\273\31\270\120\4\307\373\316\152\374\72\66\320\124\212\22\53\61\167\171\137\154\123\313\343\307\67"
-  "\341\364\212\254\101\26\214\123\75\270\41\367\42\274\40\233\357\313\225\322\124\127\152\160\235\304\213\51\277\112\361\332"
-  "\24\134\157\110\242\44\253\320\272\326\331\237\174\167\234\146\230\145\373\233\341\176\103\301\362\55\326\326\137\266\340\266"
-  "\71\56\154\107\326\124\145\34\173\63\142\74\145\22\22\335\25\351\372\233\203\337\157\375\230\171\340\351\365\141\44\305"
-  "\122\141\123\165\305\106\113\313\277\103\314\264\132\375\367\27";
-
-/* lib/crt.argv.wo (DEFLATEd, org. size 4717) */
-static unsigned char file_l_1[876] =
-  "\304\127\321\156\243\72\20\175\277\322\375\7\13\361\20\36\66\12\44\251\242\110\375\223\112\310\300\100\255\32\233\265\115"
-  "\332\356\327\57\340\20\47\23\32\23\245\325\276\104\160\162\346\314\301\36\17\303\242\226\105\313\201\204\271\62\377\377"
-  "\107\310\202\325\215\124\206\4\357\124\263\124\13\332\350\127\151\322\106\301\201\301\173\34\220\240\54\322\167\305\14\4"
-  "\144\121\266\42\47\341\64\163\77\362\310\242\241\212\326\204\255\223\150\336\265\2\335\162\63\334\104\321\74\123\124\125"
-  "\72\255\300\370\114\215\274\357\117\256\331\37\230\145\301\261\277\335\110\243\144\236\302\7\363\172\30\211\27\351\121\26"
-  "\155\12\316\262\116\65\247\234\313\374\44\151\361\275\105\357\262\217\205\113\5\200\145\173\154\216\251\172\322\224\105\175"
-  "\106\152\250\245\372\34\112\176\177\274\136\300\207\115\140\357\203\210\44\226\133\161\231\121\156\271\51\125\325\301\121\207"
-  "\333\216\271\250\133\163\314\325\375\56\163\51\264\41\253\150\72\76\277\214\317\357\211\227\302\200\252\323\134\266\302\70"
-  "\231\163\364\36\65\335\204\116\244\273\371\52\166\223\154\222\251\160\103\363\267\64\243\32\234\212\303\202\250\327\231\41"
-  "\363\12\264\101\52\26\362\211\24\324\120\53\1\165\143\76\355\336\34\250\42\224\263\112\74\157\110\177\304\236\167\75"
-  "\267\143\53\50\227\56\242\320\353\320\376\101\172\160\331\264\46\355\30\104\226\245\6\363\74\256\326\145\0\261\26\254"
-  "\174\154\345\343\153\342\6\23\3\326\157\220\240\234\200\122\122\355\111\53\150\306\201\30\111\24\30\305\340\0\135\104"
-  "\135\123\121\374\342\114\0\241\252\152\153\20\106\277\210\227\325\52\100\51\306\52\350\353\136\343\52\260\150\20\135\57"
-  "\104\234\354\254\120\317\260\102\114\60\303\50\357\376\165\62\16\263\171\273\0\56\363\176\263\6\363\266\70\106\110\264"
-  "\165\332\30\245\57\321\241\277\145\155\171\215\116\220\263\46\274\4\112\14\260\30\3\11\6\326\107\300\32\266\325\265"
-  "\254\300\234\352\334\376\61\320\227\32\314\220\326\103\166\65\267\116\34\242\333\354\42\116\343\270\131\331\313\11\262\153"
-  "\60\70\377\312\1\2\216\327\345\271\146\205\237\150\332\231\2\323\52\141\257\201\353\243\124\326\151\274\15\273\213\44"
-  "\235\115\214\41\177\33\7\320\242\260\67\35\237\317\174\1\236\247\60\0\307\102\303\111\236\266\333\365\326\201\124\24"
-  "\63\226\51\123\51\53\75\317\326\363\271\244\305\351\354\217\307\346\206\76\374\376\1\375\30\55\43\132\225\361\254\375"
-  "\220\255\315\150\313\355\37\172\251\42\107\356\234\77\346\350\253\347\232\62\222\337\60\342\137\233\351\223\343\236\143\42"
-  "\141\251\340\124\112\147\366\101\24\130\305\231\360\350\373\116\306\77\74\23\356\21\36\257\346\63\240\156\371\355\322\146"
-  "\161\170\303\270\66\122\301\165\76\217\171\327\5\161\147\275\377\271\246\325\362\107\133\260\50\160\111\371\173\355\316\263"
-  "\222\311\230\10\215\73\233\320\273\240\367\147\307\133\356\361\266\276\322\333\356\274\256\120\104\362\270\315\170\216\104\374"
-  "\164\337\113\315\175\355\132\152\241\144\203\166\2\215\252\236\62\105\216\177\246\10\361\100\150\100\325\114\120\163\66\17"
-  "\216\220\33\7\355\247\125\250\15\65\255\76\233\273\334\4\47\34\172\232\57\342\160\164\52\33\22\46\123\363\17\372"
-  "\300\271\321\22\52\223\266\256\235\243\125\106\23\362\375\211\142\357\270\207\342\347\147\360\67\107\137\73\302\247\252\24"
-  "\256\66\123\46\12\246\40\37\77\352\117\337\276\221\173\207\45\241\353\67\343\305\5\152\267\12\25\225\335\354\31\247"
-  "\340\357\340\343\12\130\222\32\20\1\0";
-
-/* lib/crt.void.wo (DEFLATEd, org. size 1416) */
-static unsigned char file_l_2[450] =
-  "\224\122\327\222\244\60\14\174\276\364\17\52\152\3\274\120\7\227\323\267\120\36\143\130\327\72\225\55\157\372\372\63\30"
-  "\106\114\272\60\21\265\273\133\126\50\265\355\243\22\160\305\75\276\173\15\120\112\355\254\107\50\36\131\220\135\60\314"
-  "\205\73\213\235\363\342\101\212\307\246\200\302\171\313\73\361\44\261\200\162\210\206\303\325\171\352\367\75\21\112\307\74"
-  "\323\40\77\264\125\125\315\131\264\320\326\77\317\131\277\57\317\245\170\312\231\163\134\124\320\146\356\250\354\216\251\314"
-  "\355\230\37\71\121\347\60\61\113\35\161\266\207\62\375\326\334\232\200\320\124\247\172\153\120\170\335\161\33\15\222\315"
-  "\26\275\344\366\376\214\133\160\127\144\222\202\113\332\217\355\307\366\234\34\31\277\357\166\54\10\162\41\54\231\45\207"
-  "\177\260\271\23\314\35\271\144\350\157\46\75\103\106\155\175\40\371\34\46\351\3\363\300\224\34\315\257\217\20\344\213"
-  "\370\365\165\322\45\245\27\103\115\352\76\64\127\371\0\46\260\166\21\273\304\0\73\14\101\340\257\265\163\207\2\310"
-  "\327\311\366\115\266\157\16\210\64\256\151\315\2\135\157\213\236\273\145\323\176\315\106\23\43\33\111\43\121\62\225\116"
-  "\311\206\260\142\246\3\170\201\321\233\351\371\130\77\45\224\206\341\106\276\102\253\172\335\362\253\200\14\143\310\113\260"
-  "\234\50\313\247\151\15\146\213\356\22\172\17\127\153\357\224\265\16\256\332\45\312\3\256\107\201\247\213\233\31\233\325"
-  "\44\140\304\56\56\321\220\377\151\124\307\15\375\377\104\15\1\41\356\16\364\341\234\376\377\63\174\44\100\107\105\1"
-  "\353\173\12\224\145\375\176\271\326\321\347\343\271\321\65\12\61\65\73\103\11\120\235\64\275\364\202\343\62\244\152\132"
-  "\341\20\25\126\313\50\74\165\136\230\176\377\160\200\156\107\305\327\202\362\260\51\323\357\21\56\15\261\44\65\40\2"
-  "\0";
-
-/* lib/crt.wo (DEFLATEd, org. size 264) */
-static unsigned char file_l_3[121] =
-  "\215\214\103\2\2\121\30\200\327\351\16\331\256\125\207\31\173\346\331\247\317\366\157\176\175\200\2\121\204\365\266\117\171"
-  "\255\134\257\367\101\10\20\65\307\176\163\256\373\241\306\210\362\172\363\324\67\7\365\345\340\170\33\27\310\163\213\323"
-  "\55\303\355\333\341\276\151\16\366\54\301\353\351\152\271\257\366\161\352\43\310\170\175\275\134\57\7\157\336\271\353\347"
-  "\266\347\262\360\106\271\315\232\203\3\347\17\114\22\272\370\211\162\35\175\206\354\155\7";
-
-/* lib/ctype.wo (DEFLATEd, org. size 4203) */
-static unsigned char file_l_4[489] =
-  "\314\127\127\162\34\41\20\375\166\272\3\316\312\141\363\356\145\124\23\320\210\62\111\4\247\323\33\57\135\325\26\116\150"
-  "\252\107\265\177\314\243\323\343\65\141\216\224\351\243\344\354\135\27\276\131\376\352\71\143\107\102\131\343\2\173\323\271"
-  "\360\206\275\361\366\335\33\166\64\110\323\66\62\131\271\260\113\10\73\122\61\60\61\237\35\37\37\377\301\107\161\145"
-  "\334\267\344\226\7\331\15\306\127\340\161\33\165\7\131\167\302\67\122\107\305\216\370\327\34\6\200\67\173\323\144\154"
-  "\33\327\250\144\275\117\311\216\34\367\121\206\374\221\55\244\351\32\171\61\360\220\214\62\222\276\345\257\361\355\135\223"
-  "\47\304\355\203\0\31\114\243\213\316\150\37\330\165\6\270\364\274\56\164\57\6\21\300\111\367\171\340\170\210\116\377"
-  "\34\43\331\242\30\44\13\0\35\131\151\276\160\67\15\331\150\55\167\217\42\333\351\340\44\222\5\200\216\254\165\102"
-  "\7\344\305\357\277\127\124\225\105\303\252\0\30\127\125\271\250\213\15\42\76\266\345\364\26\1\311\157\142\115\265\203"
-  "\153\354\35\126\13\300\44\153\130\64\114\235\277\267\115\307\113\15\240\257\112\372\127\265\335\203\255\214\314\1\240\321"
-  "\151\273\106\144\340\67\276\172\1\212\75\64\233\75\120\324\23\160\107\125\220\73\0\64\334\347\63\42\356\253\211\270"
-  "\247\257\200\334\1\70\210\216\307\373\152\104\307\37\326\26\303\310\270\324\0\320\267\31\277\247\270\222\12\343\253\42"
-  "\76\322\246\115\264\175\242\74\327\363\62\121\215\216\170\65\243\216\0\320\350\270\132\222\34\27\333\253\151\116\213\257"
-  "\305\165\16\10\341\171\261\17\107\45\67\375\25\164\65\342\12\242\356\142\372\166\131\217\154\227\372\207\270\357\204\300"
-  "\266\1\200\146\313\234\137\317\66\210\65\272\177\364\33\265\225\215\376\204\325\1\100\364\366\231\366\134\236\317\106\36"
-  "\143\301\24\307\30\0\117\361\163\124\241\351\174\136\110\372\317\45\251\47\135\74\163\1\240\43\35\255\35\105\272\324"
-  "\322\270\261\224\177\14\210\0";
-
-/* lib/dirent.wo (DEFLATEd, org. size 21870) */
-static unsigned char file_l_5[2161] =
-  "\244\224\335\156\332\60\24\307\357\47\355\35\254\50\27\160\123\101\313\230\26\251\317\202\334\370\30\54\71\266\173\354\254"
-  "\353\333\317\362\241\46\73\115\24\165\334\300\341\227\363\377\210\43\262\31\274\32\55\210\126\31\4\227\276\177\23\142"
-  "\143\206\340\61\211\246\307\324\210\46\206\266\21\233\263\365\57\322\212\66\263\56\23\261\31\306\44\314\323\343\166\273"
-  "\235\321\14\60\170\174\317\62\32\110\166\235\167\125\261\236\222\3\330\366\233\214\346\24\235\14\361\342\323\51\40\374"
-  "\66\360\266\317\6\132\235\20\244\122\6\263\217\36\135\57\332\371\335\356\266\51\66\101\242\34\112\314\352\174\74\60"
-  "\216\20\107\73\173\10\61\241\161\147\72\207\76\274\327\102\304\73\242\313\201\137\14\311\103\357\255\345\51\127\174\207"
-  "\65\365\277\40\167\46\172\157\177\100\164\276\251\337\365\331\227\337\135\371\44\31\253\246\254\171\311\62\215\0\265\30"
-  "\321\56\63\230\306\57\151\7\151\255\357\271\232\350\152\175\156\206\60\353\106\230\331\175\321\372\65\172\114\334\270\100"
-  "\146\273\72\263\4\335\273\144\163\200\17\340\344\55\241\340\216\340\235\217\267\106\150\343\324\11\301\6\231\56\54\150"
-  "\172\351\177\42\106\147\142\122\71\243\267\76\102\65\47\334\25\270\146\105\12\172\367\165\132\371\0\256\274\27\340\17"
-  "\105\124\324\224\175\361\341\327\152\365\331\123\134\127\254\357\245\55\256\241\360\112\0\321\343\277\310\354\133\6\36\71"
-  "\170\342\340\300\301\17\16\216\34\374\154\247\15\363\370\320\173\27\223\70\354\210\344\55\313\376\10\164\241\30\74\44"
-  "\0\272\37\256\337\335\0\274\136\147\275\260\204\220\106\164\64\203\123\123\377\63\244\171\377\375\361\106\244\122\254\123"
-  "\71\276\317\267\364\353\270\174\123\165\71\46\217\40\274\326\21\322\363\116\110\153\316\356\371\260\122\312\172\251\76\64"
-  "\373\343\124\264\176\50\313\316\177\333\271\332\335\106\221\40\370\52\53\205\277\27\305\100\200\74\215\5\11\326\242\70"
-  "\261\205\155\345\156\237\376\160\270\243\324\56\146\313\223\61\34\253\133\51\77\342\206\231\256\351\351\257\231\156\373\214"
-  "\323\370\260\57\12\160\363\22\4\237\5\310\113\312\322\373\372\317\143\307\174\335\75\133\237\256\332\303\270\260\173\210"
-  "\65\353\10\115\33\376\151\102\227\34\262\307\307\344\21\304\262\227\215\143\113\336\153\271\45\132\132\274\145\356\271\364"
-  "\273\136\213\352\343\344\175\207\312\304\312\20\243\43\253\212\243\21\345\12\260\35\300\52\204\75\47\321\225\252\7\352"
-  "\50\232\342\72\325\174\20\160\122\206\163\23\61\304\251\140\374\350\366\153\241\274\223\130\360\316\46\132\164\242\234\171"
-  "\116\214\127\1\214\241\372\243\261\376\63\77\60\301\36\64\33\355\373\111\105\274\107\112\340\341\126\106\227\161\200\271"
-  "\115\356\235\170\256\44\236\312\323\141\131\142\157\376\111\271\312\43\266\146\40\215\354\314\220\212\201\364\136\276\325\327"
-  "\356\327\360\231\337\264\213\244\55\31\130\221\353\316\127\253\374\41\173\200\124\154\156\115\232\277\241\200\365\307\52\44"
-  "\263\142\251\3\11\145\273\204\246\27\204\157\126\303\254\154\52\336\323\137\332\335\336\5\24\234\257\125\21\122\20\250"
-  "\207\237\56\100\215\6\122\265\217\54\141\363\57\1\161\270\307\75\334\127\220\25\167\163\210\227\307\123\335\303\251\262"
-  "\301\236\306\151\356\237\200\135\32\153\350\170\27\332\112\7\264\261\343\300\127\325\66\317\274\123\31\240\45\271\222\174"
-  "\264\111\0\75\113\101\70\152\10\211\334\225\37\114\255\344\237\30\241\342\237\37\145\144\12\213\101\2\21\307\114\357"
-  "\210\51\202\7\205\147\267\73\221\150\317\147\10\3\266\47\174\55\272\127\247\315\246\156\327\333\172\163\264\156\241\343"
-  "\324\376\265\76\64\77\152\113\177\257\77\34\324\176\52\113\37\274\24\215\277\313\134\63\334\345\366\111\277\154\171\345"
-  "\340\166\154\363\137\112\130\102\161\111\170\42\140\17\104\131\21\45\41\112\114\224\164\122\137\236\304\223\371\362\252\43"
-  "\276\176\213\160\102\333\355\277\105\53\127\306\136\265\353\146\323\275\155\7\47\366\343\331\54\326\147\65\156\352\203\207"
-  "\343\210\13\316\136\365\40\270\33\222\20\242\213\61\267\237\235\235\266\307\341\44\270\231\34\172\112\320\211\377\44\141"
-  "\253\152\151\217\360\230\343\227\377\261\41\140\3\161\230\343\115\202\343\66\205\17\223\10\362\40\136\221\6\17\34\144"
-  "\70\160\317\1\163\353\44\70\374\252\141\105\133\7\232\72\67\142\10\226\113\354\364\61\272\152\341\33\130\275\310\50"
-  "\45\143\155\235\302\320\146\344\2\235\101\350\65\136\62\65\36\367\221\167\13\243\302\100\143\46\322\41\20\336\116\133"
-  "\5\273\5\312\176\63\373\177\14\25\313\12\365\30\140\16\263\267\245\60\122\171\144\62\332\314\202\375\353\55\153\20"
-  "\372\266\24\113\233\347\272\60\21\352\50\1\350\140\263\224\300\42\104\201\323\55\153\212\277\353\347\370\365\275\325\265"
-  "\205\233\305\4\62\116\320\26\20\23\324\115\242\63\212\76\5\207\171\262\121\172\52\334\254\202\56\143\303\135\146\242"
-  "\103\146\242\103\316\373\206\161\113\222\206\6\250\303\16\6\102\143\362\221\300\143\250\220\230\347\255\264\300\355\35\172"
-  "\356\362\105\7\37\131\254\241\104\204\26\67\103\341\46\23\372\356\21\200\174\365\201\300\240\221\215\212\113\156\73\313"
-  "\122\63\175\201\52\242\157\225\21\334\75\252\236\105\244\175\100\261\76\121\250\274\54\217\25\6\40\136\220\0\237\30"
-  "\40\6\41\250\6\307\120\76\3\6\0\364\303\42\266\340\111\26\75\131\270\67\251\170\257\36\74\24\23\212\67\113"
-  "\371\173\65\172\50\235\371\124\312\272\21\354\172\71\305\325\262\222\373\230\104\67\22\172\34\5\34\143\75\244\11\116"
-  "\142\47\203\373\245\302\173\254\2\44\102\203\204\307\377\305\133\232\156\337\132\204\264\56\346\203\100\240\256\177\245\301"
-  "\6\126\234\104\300\266\2\66\363\1\250\303\262\67\121\152\372\150\336\155\261\151\40\271\313\115\75\335\135\165\111\134"
-  "\145\230\333\4\236\171\133\255\24\234\133\271\317\331\274\147\270\363\324\172\165\250\353\127\243\125\75\301\255\123\3\245"
-  "\103\272\44\45\303\64\147\144\13\323\263\337\172\166\254\267\133\243\147\75\41\240\254\57\3\55\120\177\264\345\176\335"
-  "\144\327\331\303\166\175\154\117\365\5\252\332\201\211\56\105\324\364\317\345\145\347\131\107\362\351\74\263\204\363\271\151"
-  "\333\34\216\226\332\55\302\22\236\167\157\335\177\176\15\153\150\111\260\115\6\170\60\372\362\276\335\75\327\207\103\375"
-  "\62\326\72\160\30\45\202\1\75\71\321\104\317\273\335\153\123\367\337\226\12\152\235\320\115\22\0\302\243\261\36\361"
-  "\365\213\145\265\106\374\162\335\10\60\371\263\126\173\334\244\265\365\346\336\145\331\340\205\171\105\33\27\121\147\157\311"
-  "\304\133\341\307\123\147\353\67\0\32\353\27\137\167\241\101\23\267\166\336\136\32\270\147\257\112\332\156\222\4\264\207"
-  "\334\236\154\231\100\326\242\230\210\170\113\342\5\252\301\177\136\375\42\330\212\267\341\226\75\162\173\63\107\357\300\347"
-  "\354\65\362\157\277\304\20\336\337\311\272\212\302\101\162\7\0\13\316\277\335\107\346\343\214\104\113\361\77\155\355\211"
-  "\323\351\132\173\170\156\355\4\265\244\364\125\247\166\114\363\164\340\350\156\26\326\131\177\116\142\62\217\342\42\106\6"
-  "\265\265\150\335\237\254\167\5\6\316\261\213\347\241\245\13\237\60\215\205\13\303\103\71\150\76\313\300\104\241\55\36"
-  "\161\32\334\342\201\75\115\42\135\316\327\110\374\313\371\52\331\103\45\64\104\77\335\325\324\330\243\150\265\312\146\56"
-  "\247\46\236\345\324\142\321\345\324\70\135\116\71\25\130\202\277\70\253\204\353\121\237\247\364\125\252\61\316\254\220\351"
-  "\272\171\77\277\366\174\164\376\150\204\63\276\161\342\315\17\341\371\50\307\20\3\130\365\51\342\62\114\36\123\157\17"
-  "\265\340\45\102\63\102\216\70\244\60\3\57\306\51\61\366\210\312\256\263\225\207\350\177\372\155\326\252\205\247\34\213"
-  "\300\14\202\105\205\301\102\134\102\303\370\241\10\36\352\310\50\266\101\367\41\61\54\175\132\206\162\172\356\6\144\110"
-  "\231\263\72\151\352\304\111\346\301\160\66\354\266\376\67\25\141\262\4\306\43\123\73\377\122\56\157\220\103\111\2\56"
-  "\261\244\121\12\343\241\267\373\133\176\13\24\277\350\164\361\72\152\7\272\333\16\110\264\255\311\25\204\265\325\124\245"
-  "\275\256\313\43\255\24\15\116\242\243\135\241\215\102\155\342\41\234\374\17\223\334\346\221\1\126\10\31\32\376\36\176"
-  "\121\334\14\11\127\66\212\253\361\164\351\15\14\51\203\355\134\174\310\305\372\31\143\270\335\315\167\171\54\352\173\124"
-  "\335\103\155\317\253\220\267\151\266\307\272\25\265\274\337\77\70\260\374\37\33\340\111\27\362\153\3\42\50\340\101\257"
-  "\212\72\346\120\245\373\326\46\126\156\367\337\313\163\100\203\221\15\244\113\63\53\255\351\124\327\164\26\224\102\144\236"
-  "\47\335\52\160\72\10\326\376\354\346\210\244\272\277\277\1";
-
-/* lib/errno.wo (DEFLATEd, org. size 9609) */
-static unsigned char file_l_6[1474] =
-  "\154\315\201\6\303\60\20\6\140\0\306\336\341\104\220\100\125\73\114\351\263\124\266\136\52\44\115\135\322\331\366\364\113"
-  "\233\126\307\6\221\373\317\367\237\160\276\237\55\2\107\242\321\237\117\0\302\270\311\123\4\166\247\310\200\205\211\63"
-  "\20\203\365\67\145\201\247\254\111\11\10\67\107\60\165\45\245\374\143\34\72\117\257\304\362\47\263\355\137\146\261\67"
-  "\346\273\315\372\202\300\147\256\131\107\46\217\63\331\364\52\252\135\164\350\302\160\210\165\114\342\241\10\224\65\303\330"
-  "\136\40\230\67\266\165\171\135\154\322\204\272\370\156\350\103\305\363\12\226\270\230\346\330\21\152\360\132\7\214\155\271"
-  "\355\176\331\207\17\72\50\0\30\204\201\0\146\11\240\24\346\337\330\24\134\4\344\223\55\126\221\225\330\213\354\210"
-  "\315\25\135\323\165\164\127\156\345\225\107\227\133\76\272\374\62\207\340\136\31\116\302\316\160\11\326\310\160\23\126\206"
-  "\105\210\234\43\170\220\323\204\310\271\202\215\234\107\210\234\217\60\347\254\41\170\127\206\223\260\63\134\202\157\144\270"
-  "\11\53\303\42\104\316\21\374\220\323\204\310\271\202\163\140\347\131\242\347\263\314\77\173\120\316\225\345\264\354\54\27"
-  "\345\32\131\156\313\312\262\54\61\164\50\67\206\332\22\103\227\262\60\364\54\61\364\131\346\241\32\224\147\145\71\55"
-  "\73\313\105\331\43\313\155\131\131\226\45\206\16\345\305\120\133\142\350\122\76\14\75\113\14\175\226\171\350\14\312\157"
-  "\145\71\55\73\313\45\271\306\310\162\133\126\226\145\211\241\103\71\61\324\226\30\272\224\13\103\317\22\103\237\145\36"
-  "\352\101\271\127\226\323\262\263\134\224\65\262\334\226\225\145\131\142\350\120\36\14\265\45\206\56\145\143\350\131\142\350"
-  "\263\314\103\167\120\336\225\345\264\354\54\27\345\33\131\156\313\312\262\54\61\164\50\77\14\265\45\206\256\344\36\30"
-  "\172\226\365\127\142\36\313\256\244\60\30\176\25\325\335\116\162\16\263\232\234\163\332\114\304\240\266\51\323\250\257\20"
-  "\76\307\117\177\203\373\304\2\165\173\252\274\375\176\324\342\127\300\305\177\61\375\77\51\140\51\46\271\373\357\145\12"
-  "\57\176\40\100\146\142\40\153\63\63\272\277\46\223\27\65\164\136\240\37\363\76\267\30\5\202\117\2\102\4\201\342"
-  "\136\343\27\5\377\23\162\353\123\362\24\301\141\364\372\321\313\362\150\347\30\123\2\37\41\47\324\270\225\312\105\22"
-  "\60\47\343\203\331\5\25\137\253\170\143\132\37\316\27\225\224\273\216\130\364\340\67\205\312\57\230\50\263\105\310\361"
-  "\41\206\167\201\30\250\103\66\342\51\302\15\345\340\140\27\310\36\65\335\155\241\373\51\305\210\366\302\233\300\150\334"
-  "\31\174\204\216\151\317\230\222\246\63\235\24\102\237\30\7\215\17\10\16\223\145\337\11\261\112\117\253\164\213\51\231"
-  "\75\252\124\351\303\317\360\344\55\2\61\360\175\172\166\71\235\125\205\322\216\77\76\144\317\232\150\61\240\123\341\105"
-  "\255\14\354\301\7\7\35\223\305\224\60\251\360\162\60\361\273\101\63\114\127\103\60\143\223\323\0\274\36\206\23\212"
-  "\212\16\270\320\241\161\157\215\326\233\256\357\3\252\316\266\162\161\111\174\354\23\157\356\352\203\361\145\366\3\275\144"
-  "\126\172\356\173\43\7\154\215\170\233\300\334\67\26\312\2\324\200\243\326\370\10\324\100\223\343\345\153\125\341\151\355"
-  "\73\221\117\3\261\224\136\374\302\7\4\274\365\111\222\112\315\253\276\357\23\240\123\213\352\131\175\357\64\274\107\25"
-  "\54\115\367\25\45\1\237\40\107\106\143\17\103\215\154\126\272\356\153\207\121\174\343\221\201\261\245\241\374\254\113\70"
-  "\4\334\233\0\273\263\40\44\174\231\61\132\375\360\215\136\251\327\364\247\331\266\74\77\12\62\347\116\320\215\72\142"
-  "\76\251\340\47\23\274\173\260\231\212\116\113\364\203\37\373\161\251\62\245\233\176\45\173\304\313\125\331\276\132\7\146"
-  "\354\274\74\61\201\1\347\31\255\20\237\125\260\64\326\157\104\320\232\170\206\200\47\14\11\250\201\164\156\167\24\274"
-  "\205\340\343\61\251\132\313\272\111\37\207\1\234\114\310\127\270\166\276\322\243\32\16\141\135\366\207\176\242\134\161\350"
-  "\106\155\1\52\262\255\176\161\64\55\216\257\65\245\277\176\100\271\41\76\202\117\340\350\46\252\344\364\212\101\2\273"
-  "\63\304\136\117\325\231\151\21\134\323\33\26\163\375\216\32\37\60\1\165\170\51\324\164\116\202\255\252\123\235\251\273"
-  "\334\64\310\220\72\143\161\174\341\132\54\153\32\51\333\3\70\74\171\253\203\53\15\354\367\30\342\361\22\132\224\236"
-  "\373\374\26\155\226\267\21\367\62\15\161\153\144\270\1\54\66\265\120\336\316\327\164\105\2\266\377\333\273\313\212\377"
-  "\110\0\43\345\375\241\117\274\212\116\53\350\375\352\6\324\200\34\56\125\357\31\35\310\271\323\205\112\7\376\304\44"
-  "\144\51\134\267\151\57\347\265\110\172\327\4\154\4\50\216\70\140\131\231\254\167\223\341\272\65\175\271\54\353\340\200"
-  "\220\36\232\167\44\31\157\340\313\232\21\345\151\7\7\142\60\317\73\61\10\135\323\343\227\245\101\77\273\147\56\321"
-  "\141\333\211\116\227\276\374\125\214\340\205\144\264\164\102\36\274\242\255\362\145\175\206\64\154\125\265\347\343\165\74\276"
-  "\173\312\253\2\212\143\352\225\11\35\115\327\61\165\354\215\40\274\235\327\226\242\60\205\307\123\124\265\331\110\373\1"
-  "\342\261\15\157\125\72\371\217\347\303\22\204\140\207\220\204\30\35\370\10\27\201\241\362\132\55\52\345\205\47\117\71"
-  "\1\335\104\144\160\36\235\112\57\325\375\253\317\167\207\334\172\221\1\205\125\271\353\62\35\61\102\347\7\242\136\353"
-  "\115\141\260\203\256\66\72\170\125\51\257\266\272\300\15\123\334\137\262\15\15\361\210\275\326\223\132\73\316\101\306\267"
-  "\220\365\264\202\32\367\36\305\320\317\325\221\161\272\236\251\153\153\102\74\252\330\134\263\360\375\303\126\45\27\352\350"
-  "\121\221\301\227\260\370\26\35\120\26\25\257\154\207\170\53\175\166\206\336\376\353\312\73\230\51\245\367\372\52\275\364"
-  "\124\225\335\124\246\274\140\114\236\342\207\360\251\351\314\316\7\57\36\23\370\230\162\323\170\353\37\237\10\157\176\257"
-  "\1";
-
-/* lib/fcntl.wo (DEFLATEd, org. size 20902) */
-static unsigned char file_l_7[2337] =
-  "\324\125\301\156\333\60\14\275\17\330\77\10\206\17\351\141\101\234\25\135\21\240\177\62\300\120\54\312\65\46\113\232\44"
-  "\267\353\276\176\116\350\104\65\147\55\102\233\36\166\111\331\247\107\362\361\311\246\127\275\21\203\2\126\312\106\7\365"
-  "\371\23\143\253\256\267\306\5\126\64\56\24\254\360\266\54\330\252\125\146\317\25\53\107\154\67\42\154\325\17\201\165"
-  "\137\267\67\67\67\13\71\75\364\306\275\214\151\30\140\332\24\157\60\43\253\313\330\200\260\237\271\357\152\257\271\365"
-  "\217\46\324\326\301\123\7\317\325\130\100\212\232\213\247\316\303\130\106\16\272\141\345\62\165\167\46\262\225\345\216\367"
-  "\307\46\347\370\356\166\61\106\216\3\77\50\62\166\206\54\245\114\303\103\226\60\244\346\110\173\263\34\51\174\340\241"
-  "\156\41\144\10\212\144\42\51\306\357\223\341\41\324\122\361\326\347\210\41\51\327\226\144\35\144\133\63\143\177\224\20"
-  "\321\271\132\363\36\162\324\220\24\52\351\152\362\54\17\217\265\261\240\57\211\72\23\163\244\320\70\377\275\314\37\311"
-  "\7\241\272\375\70\102\163\174\315\316\372\21\337\41\372\256\302\322\1\320\262\7\54\26\112\347\366\213\242\20\315\27"
-  "\342\72\335\342\376\155\354\313\271\30\342\73\104\63\154\317\157\322\133\332\4\321\253\65\31\3\5\232\66\101\64\267"
-  "\30\70\247\115\161\372\33\277\62\307\377\167\307\137\114\113\112\20\203\245\22\20\275\44\141\152\205\37\327\235\165\140"
-  "\54\150\37\277\236\113\54\75\364\165\36\163\142\325\15\267\274\351\302\113\26\333\327\326\330\101\361\0\42\257\272\7"
-  "\33\211\154\65\376\256\33\243\175\140\267\337\246\74\301\3\77\145\11\137\155\112\206\4\256\272\126\77\124\254\130\177"
-  "\337\154\12\344\242\211\310\165\340\273\337\160\36\366\160\316\146\56\262\11\122\246\71\350\362\201\273\20\247\105\75\323"
-  "\231\121\42\161\242\341\71\235\23\235\246\71\344\4\225\274\32\36\201\43\177\355\41\120\165\170\214\216\256\133\10\251"
-  "\73\173\135\46\0\314\7\241\115\67\21\200\237\123\54\147\216\275\56\327\246\124\201\362\100\211\377\354\273\215\100\77"
-  "\250\251\210\26\324\2\264\72\317\0\117\222\347\267\101\5\334\23\271\113\255\306\43\105\266\71\61\167\176\257\131\346"
-  "\122\322\227\12\21\7\141\160\232\70\101\344\55\115\332\322\111\251\115\144\13\44\334\240\327\201\323\223\115\217\7\302"
-  "\31\233\226\107\25\370\364\105\245\255\117\47\23\136\332\3\172\177\322\1\44\56\50\132\377\367\106\71\314\157\17\165"
-  "\145\367\13\260\356\151\105\227\226\207\307\270\250\311\212\331\217\322\176\260\262\52\117\102\215\145\345\266\244\22\252\11"
-  "\220\144\36\254\36\331\312\160\161\137\173\146\244\364\20\36\66\247\125\170\151\53\170\260\351\247\220\166\113\202\124\60"
-  "\2\134\320\27\26\123\350\143\202\333\341\155\343\321\45\171\227\265\260\362\73\125\357\62\22\224\117\75\124\240\105\206"
-  "\331\164\43\146\370\372\177\270\111\115\271\252\167\37\377\240\356\35\276\272\121\15\11\42\155\273\100\233\241\261\22\125"
-  "\174\161\373\70\150\73\37\300\235\26\33\210\132\212\371\22\222\177\332\271\16\55\305\161\40\370\57\227\363\71\12\317"
-  "\327\370\221\361\46\170\206\215\137\177\142\204\137\141\152\364\112\326\211\315\167\233\334\26\255\126\253\143\111\303\152\124"
-  "\7\377\324\257\137\270\150\165\41\373\213\237\253\141\240\35\306\317\135\376\323\15\241\270\20\302\323\214\56\131\244\25"
-  "\42\236\123\245\47\123\357\253\165\270\275\105\247\147\250\235\104\245\24\202\367\243\312\237\112\13\360\113\133\124\250\12"
-  "\112\355\251\36\243\135\21\31\76\266\100\1\73\322\33\253\262\143\17\44\365\36\117\373\176\175\33\62\53\376\330\301"
-  "\123\270\373\304\351\12\236\173\263\122\363\106\224\52\103\27\26\332\376\40\166\14\317\226\73\10\276\20\261\270\300\250"
-  "\340\342\10\34\64\70\106\14\70\54\105\143\313\324\73\230\254\311\200\162\174\275\40\163\302\347\102\147\337\360\140\177"
-  "\217\353\363\271\214\166\31\213\142\341\274\376\111\176\203\217\13\251\120\164\162\231\131\362\232\127\50\114\71\103\141\200"
-  "\77\250\42\14\175\30\262\141\333\155\56\263\103\230\322\317\32\44\267\5\210\214\101\50\51\271\132\77\320\40\263\251"
-  "\353\262\6\161\316\112\156\50\240\142\41\44\146\370\14\102\157\144\76\171\22\363\361\50\25\245\332\153\52\12\203\22"
-  "\214\146\75\360\255\20\301\144\22\100\207\6\150\122\245\101\230\33\353\260\270\207\16\211\4\211\42\124\102\26\256\221"
-  "\167\322\310\375\214\260\114\250\300\4\332\42\173\341\224\316\113\104\122\155\74\266\36\51\5\115\262\75\265\257\165\323"
-  "\4\35\244\163\42\244\76\150\150\172\373\367\120\304\166\145\314\211\214\204\333\347\10\37\203\303\310\216\210\161\51\346"
-  "\303\170\20\67\156\276\164\45\142\31\347\126\356\42\361\200\26\61\141\11\301\25\241\133\174\373\162\176\132\356\10\274"
-  "\102\151\167\103\153\355\111\10\350\12\350\102\325\67\56\2\137\314\217\30\166\127\144\13\41\115\73\42\126\230\30\241"
-  "\300\10\321\60\262\22\110\74\45\65\103\263\57\17\121\341\76\23\242\322\364\144\351\235\2\73\307\234\272\173\106\323"
-  "\56\115\260\374\4\170\240\224\234\265\236\0\175\42\51\242\323\311\372\335\311\316\144\307\120\226\76\107\1\317\270\211"
-  "\312\45\263\40\235\171\341\121\41\206\67\6\100\257\42\316\156\272\127\253\166\276\70\102\255\34\71\7\212\35\166\301"
-  "\202\10\267\233\237\272\67\353\66\50\330\76\206\164\4\152\117\14\336\254\250\235\327\375\75\61\135\356\137\36\136\333"
-  "\26\63\24\31\24\41\341\223\37\163\104\0\305\61\376\306\166\5\246\330\77\17\162\107\325\4\64\132\375\24\6\301"
-  "\161\314\300\76\224\321\241\231\373\175\47\20\344\253\45\226\22\37\271\43\300\300\176\115\45\66\43\155\236\206\223\161"
-  "\332\247\162\40\150\124\62\322\306\246\213\150\74\51\33\25\166\16\6\33\233\135\171\102\270\6\112\164\256\72\343\22"
-  "\43\144\321\15\22\173\213\137\164\166\100\32\215\0\235\24\106\346\240\121\377\224\262\20\50\21\202\106\17\360\317\10"
-  "\363\44\250\273\242\156\344\372\322\23\63\215\255\205\151\207\74\341\31\331\151\24\203\314\50\353\314\110\1\370\324\375"
-  "\63\17\317\110\73\34\276\274\336\255\206\215\311\122\361\140\142\26\34\201\7\132\323\377\207\256\152\211\45\360\376\337"
-  "\324\76\362\0\205\170\112\277\143\313\327\345\234\225\351\261\22\373\155\375\316\135\337\273\246\376\360\73\227\171\21\345"
-  "\234\70\123\371\252\217\120\30\314\345\104\102\7\132\300\171\302\143\11\244\223\106\207\311\271\246\117\10\313\234\327\62"
-  "\77\301\262\334\63\154\212\16\366\75\66\266\167\227\326\165\257\360\316\135\161\36\10\66\126\357\373\261\275\331\100\371"
-  "\374\365\241\5\103\130\342\321\103\355\273\355\356\164\154\27\363\343\332\261\347\167\335\253\335\272\357\116\266\166\302\210"
-  "\317\342\10\261\54\356\146\377\166\241\103\366\253\212\74\317\362\202\306\332\15\341\36\11\217\263\361\243\241\362\32\217"
-  "\124\174\227\343\107\216\234\316\150\250\363\255\263\262\314\115\325\144\243\63\4\256\67\162\126\145\131\327\125\125\362\321"
-  "\13\306\362\311\132\115\154\314\54\317\232\306\124\223\330\24\34\330\112\253\364\331\254\150\46\361\61\304\247\60\115\125"
-  "\326\125\155\46\361\251\274\332\311\46\361\51\177\342\164\317\175\46\27\171\172\247\241\350\330\303\42\114\0\73\206\315"
-  "\347\246\154\14\210\373\336\153\374\10\336\102\144\332\214\324\62\127\371\103\145\212\172\212\324\214\355\303\246\351\205\361"
-  "\275\230\261\331\65\121\365\165\144\146\2\136\221\362\200\176\263\362\235\317\273\304\223\364\350\22\2\206\63\377\310\12"
-  "\126\140\320\70\371\6\272\104\156\146\66\312\345\312\43\164\143\302\263\173\232\223\175\57\344\236\346\323\125\366\100\373"
-  "\22\262\163\230\37\245\211\307\311\101\243\4\175\15\45\344\346\322\54\64\170\317\263\335\226\74\161\374\231\45\125\112"
-  "\332\27\131\361\301\27\144\5\242\45\154\356\272\150\332\365\155\352\75\335\152\55\153\215\221\135\114\234\376\300\61\271"
-  "\362\134\134\321\77\250\10\366\337\3\140\310\265\207\2\260\136\372\216\153\334\157\121\7\37\333\135\255\272\36\307\54"
-  "\137\127\67\317\41\104\125\5\214\237\220\13\130\175\305\242\217\63\363\351\155\27\342\53\213\26\100\24\142\54\224\7"
-  "\160\40\261\375\77\376\11\7\170\174\124\170\303\362\345\15\141\176\370\111\172\3\103\13\360\43\320\54\253\361\163\10"
-  "\356\0\376\77\32\355\157\137\50\172\0\104\40\145\317\157\267\122\36\54\270\356\363\64\137\274\130\237\171\234\331\236"
-  "\147\72\117\56\357\55\45\151\103\312\244\327\241\320\30\177\332\356\346\173\162\317\15\56\35\27\227\160\310\230\30\302"
-  "\141\130\125\335\14\105\265\100\40\174\12\167\157\335\115\220\326\276\153\217\240\142\33\22\310\143\252\273\10\3\235\11"
-  "\310\211\172\67\326\67\37\60\153\364\110\363\206\211\140\222\57\120\235\0\237\322\253\23\160\145\204\76\105\253\35\357"
-  "\324\236\263\151\233\376\51\344\315\17\117\14\363\227\247\174\304\211\117\350\332\11\237\170\122\227\31\63\146\351\356\216"
-  "\105\210\144\23\321\237\122\116\222\137\143\304\231\311\125\115\167\315\115\140\377\245\140\157\321\170\351\47\200\155\325\117"
-  "\376\35\273\167\355\306\175\13\31\312\374\21\131\225\373\316\351\316\61\22\64\213\15\215\11\147\126\313\265\257\13\300"
-  "\202\6\166\223\303\363\13\153\306\251\356\106\105\114\54\256\166\27\115\364\317\14\101\37\362\126\225\123\62\315\135\307"
-  "\204\6\267\367\301\26\204\257\213\33\331\20\136\374\77\53\372\156\61\11\55\106\156\275\333\262\247\66\337\376\372\17"
-  "";
-
-/* lib/fenv.wo (DEFLATEd, org. size 1286) */
-static unsigned char file_l_8[260] =
-  "\265\221\105\162\304\100\14\105\327\241\73\50\314\274\233\333\164\154\331\201\246\222\324\201\333\307\130\32\346\61\252\236\340"
-  "\367\57\135\271\220\47\213\160\126\240\377\76\332\7\270\372\160\61\220\300\111\106\162\2\47\34\317\116\340\252\264\341"
-  "\315\130\70\253\330\240\42\160\345\222\300\307\353\313\365\365\365\224\36\207\56\320\137\325\326\6\155\133\27\77\165\35"
-  "\105\362\131\53\72\50\60\263\150\10\177\63\214\2\127\370\333\316\32\301\47\115\127\325\27\15\31\7\147\316\360\127"
-  "\163\0\150\71\241\44\362\165\74\145\174\211\322\116\51\254\51\125\140\54\61\56\121\263\330\152\364\250\55\346\245\205"
-  "\311\174\60\216\373\122\254\276\326\126\340\131\326\170\307\326\4\131\306\235\51\135\140\354\212\220\223\225\41\261\72\174"
-  "\310\202\147\201\247\345\66\112\41\371\134\265\225\365\312\33\213\360\204\210\262\161\173\15\334\236\271\52\120\325\236\214"
-  "\153\126\50\56\275\257\367\140\363\311\175\51\235\71\174\163\77\74\341\207\67\367\223\142\156\4\107\347\52\134\151\164"
-  "\365\374\3";
-
 /* lib/include/assert.h (DEFLATEd, org. size 182) */
 static unsigned char file_l_9[137] =
   "\105\214\301\12\302\60\14\206\357\203\275\103\300\113\73\220\355\354\105\220\211\67\157\236\45\333\342\32\350\132\111\132\237"
@@ -2233,16 +2372,17 @@ static unsigned char file_l_16[557] =
   "\203\335\363\315\357\276\347\316\341\156\172\101\112\62\230\12\22\316\117\265\232\44\366\107\142\11\301\144\132\223\150\341"
   "\61\307\142\76\111\324\367\340\357\276\377\17";
 
-/* lib/include/limits.h (DEFLATEd, org. size 635) */
-static unsigned char file_l_17[230] =
-  "\164\120\63\202\103\1\20\255\127\167\210\155\227\153\306\256\222\174\333\274\375\142\366\33\123\215\37\332\265\314\207\40\363"
-  "\204\100\210\72\242\63\222\230\341\31\201\321\265\114\255\175\167\175\167\235\227\125\204\22\220\214\44\142\4\324\70\101"
-  "\62\42\221\171\172\177\130\237\37\77\266\231\111\244\67\173\70\146\272\275\161\264\373\61\317\124\232\335\336\244\352\17"
-  "\146\217\347\351\313\34\16\6\231\137\32\206\116\66\47\0\353\156\174\314\267\60\316\164\354\61\371\37\241\41\274\375"
-  "\373\333\364\27\2\0\323\305\374\15\356\335\77\277\40\26\242\11\375\236\213\342\255\301\47\367\143\312\32\354\171\164"
-  "\302\61\235\306\26\101\261\167\324\354\116\247\1\152\233\144\257\66\251\146\155\336\327\41\57\102\223\230\21\201\303\235"
-  "\207\324\33\16\3\155\357\141\307\16\373\272\3\33\334\1\304\56\60\365\134\330\375\14\177\250\206\242\204\127\32\32"
-  "\10\5\5\30\0";
+/* lib/include/limits.h (DEFLATEd, org. size 691) */
+static unsigned char file_l_17[265] =
+  "\175\222\137\153\302\60\24\305\337\5\277\303\5\137\266\102\351\237\115\354\253\212\314\100\254\140\315\330\233\4\115\107"
+  "\300\264\322\146\265\37\177\65\245\61\311\164\367\55\367\334\173\116\362\43\201\7\110\134\316\114\260\102\122\311\313\2"
+  "\316\134\160\131\203\27\214\107\343\321\344\122\321\157\101\241\54\216\114\235\117\54\347\5\203\345\172\276\73\54\320\36"
+  "\22\247\267\231\177\101\24\317\334\56\112\341\305\217\342\344\365\56\154\26\7\274\112\325\302\73\4\36\374\310\334\117"
+  "\124\354\60\201\322\275\222\41\154\147\171\137\216\330\331\336\174\375\373\200\21\200\267\351\207\332\37\174\272\220\53\255"
+  "\305\133\154\245\364\143\235\323\340\370\144\114\333\31\327\31\12\343\77\203\352\305\172\311\217\60\66\256\226\75\146\225"
+  "\75\205\225\255\167\26\13\127\261\101\30\213\104\47\305\323\251\321\326\206\141\153\163\45\3\255\136\270\25\61\124\115"
+  "\201\374\117\225\130\274\34\134\71\61\201\241\355\147\217\42\214\325\107\20\264\205\11\57\33\166\254\201\27\120\61\172"
+  "\152\202\153\305\45\153\124\304\57";
 
 /* lib/include/locale.h (DEFLATEd, org. size 215) */
 static unsigned char file_l_18[154] =
@@ -2252,22 +2392,24 @@ static unsigned char file_l_18[154] =
   "\171\226\2\32\261\346\11\337\41\277\243\312\133\34\301\142\247\174\121\153\236\336\146\143\72\64\103\311\353\143\243\356"
   "\41\236\326\300\204\353\214\351\317\374\173\215\256\253\115\205\266\75\122\360\152\122\122\374\2";
 
-/* lib/include/math.h (DEFLATEd, org. size 1519) */
-static unsigned char file_l_19[417] =
-  "\215\223\345\262\334\60\14\106\177\227\336\101\145\146\146\146\146\6\45\226\167\65\343\310\251\341\362\175\367\146\231\325\345"
-  "\44\347\130\363\31\164\372\30\274\304\324\246\12\23\227\21\216\235\336\263\163\317\316\375\165\300\126\205\340\245\244\346"
-  "\216\245\164\331\20\334\210\353\361\64\113\12\361\124\373\126\307\153\6\77\371\370\370\341\357\117\167\137\0\107\50\62"
-  "\273\164\222\145\120\305\220\145\41\170\165\367\25\34\371\235\61\332\43\147\326\56\77\272\177\246\363\372\170\364\350\310"
-  "\170\372\352\321\323\127\117\77\174\35\327\256\14\264\116\51\132\113\24\4\214\317\205\43\300\322\307\43\375\353\265\243"
-  "\327\147\160\144\321\160\302\377\341\163\103\176\142\360\170\175\326\324\123\350\41\324\14\235\312\155\275\264\206\23\252\230"
-  "\326\352\61\12\323\330\206\61\141\5\135\246\23\300\222\340\130\363\170\266\230\63\343\345\172\346\174\321\267\224\114\15"
-  "\75\173\106\341\225\67\166\62\323\200\34\343\72\205\331\1\265\137\135\152\17\343\337\220\264\215\40\166\12\266\130\104"
-  "\15\73\357\203\306\53\157\26\244\354\366\126\44\107\145\42\3\367\257\136\5\64\206\23\173\211\140\175\350\273\275\176"
-  "\45\311\25\154\302\243\67\277\233\116\73\321\371\357\367\323\303\356\315\267\207\357\136\167\57\336\177\274\367\352\365\273"
-  "\227\167\137\164\357\172\227\260\75\112\325\331\73\133\227\16\143\144\273\76\231\173\144\160\264\54\234\150\61\147\261\213"
-  "\241\240\50\320\207\12\335\42\36\271\45\5\253\333\345\353\365\216\265\334\326\227\350\12\231\72\273\62\353\5\237\305"
-  "\150\355\26\262\224\12\27\302\120\254\263\44\365\44\340\232\32\172\44\262\350\342\250\313\253\263\223\175\336\171\377\3"
-  "";
+/* lib/include/math.h (DEFLATEd, org. size 2048) */
+static unsigned char file_l_19[512] =
+  "\215\224\121\157\323\60\24\205\337\47\355\77\130\342\245\215\12\355\170\201\11\204\124\246\26\52\155\31\32\24\11\136"
+  "\52\47\261\333\53\71\166\260\35\110\64\361\337\261\223\264\13\115\162\227\276\324\366\167\162\163\222\173\117\346\1\271"
+  "\243\366\300\122\152\41\66\44\230\137\136\134\136\274\310\64\335\247\224\50\31\63\267\3\31\213\74\141\344\275\51\315"
+  "\34\244\325\346\325\341\203\327\315\3\362\171\373\151\265\373\276\274\45\140\110\224\203\260\57\101\36\253\44\214\203\144"
+  "\44\134\206\144\262\313\251\341\223\105\361\146\175\263\360\277\355\164\372\244\330\204\353\115\270\371\366\243\55\173\333\225"
+  "\35\357\265\76\135\340\157\303\12\313\264\44\211\312\43\301\10\215\225\231\64\353\142\372\256\203\15\110\14\133\372\34"
+  "\176\175\342\263\343\161\331\125\342\56\160\23\270\7\127\371\200\227\76\340\265\61\314\212\254\105\311\71\346\272\45\370"
+  "\115\105\316\146\304\315\3\11\334\161\267\230\110\332\345\152\145\277\120\355\21\117\216\136\55\20\236\252\204\237\171\152"
+  "\166\1\144\126\167\57\310\324\237\121\75\64\277\264\305\32\301\100\40\230\323\10\33\1\56\224\322\30\167\217\65\340"
+  "\262\312\235\141\202\305\226\45\344\346\372\232\320\44\1\13\112\32\302\225\156\264\165\226\231\314\123\362\110\326\137\166"
+  "\56\205\63\377\337\104\147\125\155\176\256\36\356\253\305\327\355\307\360\376\341\156\171\133\355\352\45\371\373\344\312\367"
+  "\216\147\261\240\306\0\57\373\174\173\5\30\227\123\260\154\230\203\344\303\120\366\17\176\3\225\116\251\30\342\6\366"
+  "\62\2\264\135\52\53\275\152\134\353\143\52\42\171\66\273\262\253\323\52\227\11\26\67\235\313\30\341\222\121\35\225"
+  "\256\70\72\11\264\30\145\232\247\60\356\351\134\10\323\253\377\163\376\334\114\271\161\245\266\31\251\272\126\165\122\145"
+  "\204\117\352\165\333\173\175\342\63\60\114\175\200\220\153\175\100\206\161\365\146\207\361\351\305\42\267\157\6\342\244\230"
+  "\65\240\354\172\161\55\30\45\203\61\325\114\113\325\343\12\171\143\256\161\303\320\175\47\207\241\373\346\365\73\373\7";
 
 /* lib/include/NDEBUG/assert.h (DEFLATEd, org. size 150) */
 static unsigned char file_l_20[116] =
@@ -2320,63 +2462,74 @@ static unsigned char file_l_24[490] =
   "\5\151\340\243\355\136\77\141\154\163\22\277\242\165\344\316\316\115\145\213\161\44\362\311\203\146\155\303\126\252\375\20"
   "\116\124\321\111\105\162\124\377\7";
 
-/* lib/include/stdio.h (DEFLATEd, org. size 3869) */
-static unsigned char file_l_25[1054] =
-  "\235\126\345\272\244\70\20\375\275\366\16\265\16\355\335\353\173\155\334\335\275\277\64\204\276\354\102\302\227\204\361\231\147"
-  "\237\242\302\275\35\322\356\122\71\347\224\102\322\157\301\125\121\224\246\57\113\203\137\320\352\177\367\365\167\137\377\130"
-  "\50\66\315\31\110\21\161\374\227\212\50\53\143\16\373\332\304\114\115\173\307\207\15\343\73\335\217\142\236\150\264\23"
-  "\31\177\247\202\303\305\333\227\40\350\16\303\231\345\334\303\113\367\257\76\203\341\140\364\373\314\170\377\34\31\377\236"
-  "\131\56\335\276\163\361\326\370\346\331\47\60\32\0\6\230\263\267\360\143\222\146\134\203\54\270\0\146\50\60\214\325"
-  "\341\134\275\161\361\326\331\233\27\55\355\117\342\145\122\114\271\66\120\121\101\260\234\327\331\231\167\5\107\32\255\333"
-  "\217\244\220\172\154\366\334\105\155\124\31\31\30\247\162\122\46\360\341\273\257\1\264\116\337\363\261\201\110\230\75\250"
-  "\37\225\237\350\230\51\26\31\256\64\144\74\261\65\4\50\205\116\247\202\307\264\14\255\11\323\174\317\106\25\61\223"
-  "\112\1\62\1\224\116\270\132\114\50\214\332\43\171\301\337\232\231\17\300\120\123\342\57\144\161\21\133\26\376\230\363"
-  "\220\12\3\111\306\246\32\41\156\2\232\233\12\73\276\172\373\311\223\47\26\341\62\142\27\116\14\133\322\230\353\110"
-  "\245\205\221\12\202\3\170\174\366\376\125\304\216\115\150\271\66\40\215\1\74\267\55\176\271\147\271\303\156\76\241\65"
-  "\47\266\117\324\300\75\167\174\60\232\113\347\56\41\145\200\217\206\371\336\305\263\27\310\74\154\230\37\337\173\140\321"
-  "\243\206\371\326\211\310\357\15\63\116\47\231\107\203\246\371\336\75\62\377\336\64\337\260\42\103\77\222\307\120\231\107"
-  "\236\371\346\123\234\164\100\215\101\225\20\266\217\53\101\11\322\70\75\77\235\357\227\173\63\232\66\161\52\0\202\137"
-  "\10\62\170\31\66\226\144\151\116\226\206\336\22\127\352\144\151\204\113\236\303\126\122\135\62\101\44\205\66\365\210\124"
-  "\275\253\256\206\16\270\326\134\306\74\334\363\311\61\261\355\24\154\202\127\174\13\167\235\232\245\215\342\54\167\304\310"
-  "\137\224\111\315\203\6\302\51\327\224\233\50\50\102\10\272\135\374\352\36\106\110\71\74\200\1\34\101\320\270\44\302"
-  "\26\255\27\106\265\333\360\57\214\61\234\14\7\17\215\116\31\213\22\325\336\166\140\261\240\253\160\0\301\333\220\164"
-  "\262\122\37\127\102\370\277\42\206\315\330\320\163\200\142\24\46\265\326\163\107\0\124\12\310\65\151\330\66\273\270\50"
-  "\343\114\161\245\50\321\340\265\114\343\60\240\130\354\45\372\313\1\174\16\354\314\176\264\23\35\272\354\204\313\204\230"
-  "\56\5\54\260\1\123\112\252\171\240\25\166\200\324\110\351\0\343\320\355\330\254\264\313\273\352\224\255\372\27\255\236"
-  "\0\52\336\22\100\75\133\10\321\201\375\255\73\304\22\253\65\251\334\33\370\106\234\156\214\261\136\211\237\207\173\200"
-  "\122\114\371\162\317\375\126\115\163\363\11\241\333\5\71\321\62\343\306\156\135\265\136\275\15\45\310\216\151\52\150\263"
-  "\350\324\166\372\72\375\43\344\344\277\171\177\236\320\33\225\32\136\207\277\223\236\133\71\315\371\377\215\256\165\354\36"
-  "\53\23\134\62\266\111\122\245\323\124\70\114\102\44\206\147\331\262\206\123\134\212\277\111\105\34\254\31\232\102\152\57"
-  "\0\273\277\123\132\163\341\56\302\123\51\126\261\150\214\127\305\201\262\257\375\153\241\123\67\31\355\266\14\164\23\164"
-  "\313\354\347\213\52\53\104\346\146\126\341\227\217\156\334\212\245\312\31\266\240\327\353\171\334\232\272\31\130\133\364\354"
-  "\272\333\220\46\174\236\315\34\351\245\60\233\252\274\136\21\352\153\66\316\122\264\62\65\365\131\233\27\147\205\210\227"
-  "\370\366\374\215\53\320\202\365\162\211\216\230\330\255\335\226\271\41\326\5\157\335\162\237\274\173\337\335\164\167\156\40"
-  "\111\154\113\162\131\273\267\176\247\112\170\232\264\123\64\116\134\46\57\252\175\331\36\16\366\252\35\103\110\203\56\351"
-  "\70\216\107\227\276\103\41\145\242\10\226\333\31\324\317\157\214\355\377\227\13\331\156\22\364\126\74\227\257\371\302\3"
-  "\236\227\262\42\143\3\51\263\170\376\44\50\370\33\142\173\267\276\202\216\45\363\173\52\345\323\142\6\13\243\122\46"
-  "\214\266\121\372\176\231\241\275\26\75\372\7\127\64\25\314\34\167\10\214\316\375\165\64\125\353\225\257\57";
-
-/* lib/include/stdlib.h (DEFLATEd, org. size 1993) */
-static unsigned char file_l_26[597] =
-  "\265\225\305\222\343\60\20\206\317\103\357\320\313\216\53\260\214\227\141\146\276\245\144\273\223\121\255\54\145\244\366\140\355"
-  "\273\157\144\205\144\55\103\320\356\376\376\277\305\156\305\260\206\22\65\23\120\20\27\234\70\32\210\133\163\323\163\323"
-  "\217\62\354\160\211\260\162\276\161\334\136\135\330\330\76\71\134\201\27\225\370\321\311\322\322\312\321\21\74\37\307\167"
-  "\26\333\113\47\207\355\235\205\163\170\15\175\377\202\72\215\367\245\147\53\206\335\223\355\155\340\6\222\202\13\152\160"
-  "\151\343\43\345\341\302\356\162\251\173\176\363\256\343\136\163\323\164\333\303\176\36\14\351\42\45\270\7\56\11\56\13"
-  "\105\165\320\230\177\202\57\220\361\253\66\175\372\6\51\224\354\372\250\370\41\373\55\301\110\321\212\301\360\73\154\123"
-  "\265\371\66\163\235\136\60\35\244\354\50\342\15\241\226\220\251\42\21\10\214\124\47\112\225\64\4\126\1\261\251\175"
-  "\32\61\134\222\5\370\167\1\333\74\113\210\37\23\43\54\344\52\315\61\244\111\145\76\125\37\134\304\50\263\212\263"
-  "\343\305\367\371\172\331\207\204\31\254\52\47\344\277\253\57\244\341\135\211\331\204\107\361\127\36\236\221\357\64\62\372"
-  "\246\213\15\151\46\263\350\112\361\311\261\261\267\140\312\314\250\220\101\14\220\70\145\102\250\64\32\254\43\131\207\301"
-  "\225\271\253\242\35\215\30\71\121\217\164\140\224\173\106\241\74\326\350\210\221\305\17\152\261\104\151\52\311\140\61\342"
-  "\15\167\31\210\342\116\41\323\232\303\252\16\45\146\25\206\30\25\146\42\355\206\263\213\204\362\312\33\151\311\162\254"
-  "\271\155\125\12\157\15\141\356\21\151\236\325\240\321\0\251\250\217\300\331\302\321\6\304\255\112\77\23\203\114\247\27"
-  "\3\241\213\175\306\333\72\114\6\354\64\326\141\156\32\276\61\360\156\242\243\270\6\236\207\157\20\164\370\322\330\41"
-  "\373\137\65\334\340\47\246\34\122\31\154\45\233\261\127\141\312\375\214\201\200\52\17\63\373\353\254\135\303\274\155\356"
-  "\10\373\67\250\121\167\56\36\64\244\306\230\307\6\2\133\45\117\4\312\312\266\35\15\126\300\222\272\116\243\341\251"
-  "\32\367\256\323\72\374\232\364\72\45\225\47\321\10\163\36\66\76\6\207\332\74\61\266\216\361\12\231\37\127\362\14"
-  "\372\264\255\146\306\345\234\324\367\363\14\6\53\336\272\60\1\202\47\232\351\133\110\30\27\252\350\13\133\71\32\303"
-  "\272\30\254\364\166\217\111\236\372\17\217\116\116\165\150\66\233\326\367\53";
+/* lib/include/stdio.h (DEFLATEd, org. size 4429) */
+static unsigned char file_l_25[1326] =
+  "\245\127\155\157\342\106\20\376\36\51\377\141\244\223\356\154\16\22\210\242\252\72\232\234\22\225\110\110\171\251\110\117"
+  "\111\33\105\150\261\327\340\306\336\265\166\327\44\271\153\373\333\73\73\153\300\66\340\343\122\244\304\170\146\236\171\37"
+  "\166\366\260\5\103\221\345\346\120\346\6\37\320\72\334\337\333\337\173\227\51\66\115\31\110\21\160\174\213\105\220\344"
+  "\41\207\137\264\11\231\232\36\314\116\53\304\127\175\30\204\74\322\104\107\16\176\217\5\207\301\315\5\170\235\236\277"
+  "\242\234\177\271\270\35\376\11\275\356\321\361\212\170\173\116\304\237\127\224\213\233\337\6\327\343\253\263\173\70\352\302"
+  "\141\13\122\366\2\357\242\70\341\32\144\306\5\60\103\216\221\257\113\314\360\162\160\175\166\65\160\260\237\10\227\110"
+  "\61\345\332\200\205\202\140\51\57\242\63\257\31\107\30\361\335\277\50\223\172\154\372\145\246\66\52\17\14\214\143\71"
+  "\311\43\370\266\277\7\240\165\374\225\217\15\4\302\364\141\361\101\73\301\214\51\26\30\256\64\44\74\162\71\4\310"
+  "\205\216\247\202\207\304\206\326\204\151\336\167\136\5\314\304\122\200\214\0\125\107\134\155\6\144\106\365\111\275\340\57"
+  "\146\145\3\320\325\230\360\33\121\134\204\16\205\137\326\54\304\2\223\221\260\251\136\271\117\262\232\33\53\73\36\336"
+  "\334\337\337\73\211\62\42\54\213\73\4\245\64\344\72\120\161\146\244\2\357\4\356\316\156\207\50\73\66\176\201\45"
+  "\207\64\72\360\340\112\374\330\167\330\136\47\235\20\257\344\333\77\124\300\176\271\175\320\233\213\363\13\204\164\361\123"
+  "\41\217\6\147\277\22\271\127\41\337\215\176\167\322\107\25\362\365\102\311\161\205\154\273\323\222\217\252\272\7\243\21"
+  "\221\217\253\344\113\247\244\127\367\344\316\346\3\165\124\311\127\177\140\247\3\352\350\332\200\260\174\134\11\12\220\332"
+  "\351\141\331\337\217\375\25\14\107\53\26\0\336\173\22\351\76\372\25\26\116\347\202\325\253\261\270\122\13\326\221\145"
+  "\125\15\266\42\73\62\136\40\205\66\105\213\330\332\331\151\150\103\231\232\312\220\373\375\72\70\44\264\353\202\135\344"
+  "\25\377\1\163\355\2\205\243\306\131\132\122\106\366\202\104\152\356\325\45\26\201\117\271\11\274\314\307\37\230\16\76"
+  "\72\247\70\223\160\172\2\135\370\14\136\145\44\374\26\361\161\232\76\176\204\117\60\106\167\22\154\74\44\226\322\210"
+  "\277\174\201\367\322\206\315\12\313\32\116\300\173\361\111\117\222\353\231\125\204\357\26\350\127\175\103\313\36\52\43\67"
+  "\251\264\165\163\126\0\65\171\144\232\164\270\62\227\345\202\204\63\205\365\245\100\275\271\214\103\337\43\137\334\210\276"
+  "\77\201\177\75\327\263\177\273\216\366\313\350\210\313\310\41\113\220\242\365\53\142\112\111\265\131\160\64\52\13\332\102"
+  "\312\222\140\350\127\52\266\114\155\103\125\127\151\263\157\101\163\7\120\362\266\10\24\275\205\42\332\163\337\165\233\120"
+  "\242\131\47\245\173\7\333\50\247\53\155\254\33\345\327\305\153\2\271\240\150\266\130\56\16\21\150\225\343\361\241\323"
+  "\1\71\321\62\341\306\35\135\205\276\342\30\302\141\143\41\165\5\35\26\355\5\335\76\226\57\102\116\376\332\352\371"
+  "\102\321\263\212\15\57\334\377\77\372\50\163\232\363\247\112\325\332\356\214\225\21\262\214\53\222\124\361\24\107\142\205"
+  "\164\247\260\341\111\262\255\340\344\227\342\317\261\10\275\357\64\15\236\220\65\7\334\371\116\141\255\273\273\101\336\245"
+  "\242\1\105\155\334\344\7\252\235\327\147\241\275\130\5\362\310\245\301\375\10\226\322\134\217\27\265\64\50\131\353\131"
+  "\205\217\150\143\50\305\270\110\225\62\54\301\301\301\101\275\177\35\164\67\141\275\220\136\14\306\216\60\121\307\55\366"
+  "\51\231\13\263\253\226\171\203\253\163\66\116\142\244\342\216\132\107\355\236\234\6\45\73\5\336\204\337\71\3\270\141"
+  "\175\127\135\244\3\46\336\126\156\207\334\121\166\135\370\7\112\276\21\374\246\272\357\34\156\123\1\266\306\335\4\332"
+  "\71\1\215\245\177\143\46\152\72\355\175\100\212\216\66\114\340\125\54\374\4\172\46\225\261\267\234\220\7\161\312\22"
+  "\152\34\273\315\207\140\146\170\123\262\207\204\206\11\13\236\200\277\340\15\42\171\55\37\45\326\267\320\110\114\347\266"
+  "\236\304\235\144\142\167\375\215\306\255\162\170\236\341\11\345\156\4\250\116\342\165\55\301\73\316\207\20\276\162\45\73"
+  "\150\46\215\5\63\270\216\115\220\374\124\266\356\316\232\50\221\170\216\225\143\317\230\231\55\375\150\145\270\166\154\264"
+  "\36\240\41\210\360\42\45\50\163\74\310\115\74\307\255\151\226\213\47\155\123\140\146\205\137\30\111\234\100\154\263\141"
+  "\162\45\264\125\144\275\103\255\320\132\22\273\200\232\161\15\223\12\157\232\221\370\200\327\71\246\55\106\347\211\301\330"
+  "\320\25\313\361\342\10\361\6\256\277\134\136\342\332\206\267\237\116\317\41\361\360\6\334\246\204\254\247\70\112\131\346"
+  "\334\332\36\247\343\323\131\153\41\136\53\22\176\105\232\4\226\342\230\224\166\221\300\74\364\127\137\35\232\74\55\222"
+  "\126\331\320\115\232\331\214\270\145\262\157\67\14\33\12\306\146\257\157\237\311\357\25\304\331\105\10\356\357\256\77\364"
+  "\303\345\330\275\77\156\101\227\242\266\177\212\247\162\316\67\136\10\152\43\242\210\130\221\224\111\270\176\163\20\374\271"
+  "\206\246\320\63\267\306\256\355\140\24\117\13\7\141\316\124\314\204\321\165\57\235\135\146\150\67\103\213\365\213\16\222"
+  "\134\235\150\273\344\317\165\76\222\54\337\332\372\17";
+
+/* lib/include/stdlib.h (DEFLATEd, org. size 2130) */
+static unsigned char file_l_26[661] =
+  "\265\225\135\153\333\60\24\206\357\3\371\17\7\166\343\230\174\164\60\330\240\127\131\327\215\102\333\213\146\241\275\63"
+  "\266\174\234\210\330\122\52\311\115\323\261\377\76\175\330\216\145\273\335\306\130\56\34\133\172\336\367\110\107\72\322\42"
+  "\204\157\310\120\304\71\224\212\346\124\121\224\20\56\306\243\361\350\135\212\31\145\10\227\17\127\337\243\257\313\253\353"
+  "\365\335\45\274\357\264\257\326\27\27\227\253\25\234\235\332\157\76\107\27\353\273\350\146\371\0\37\140\21\152\337\154"
+  "\366\311\172\352\217\333\365\365\65\120\11\111\111\163\65\243\314\266\327\312\273\345\355\27\253\73\173\376\230\271\337\170"
+  "\244\216\173\324\375\40\225\50\211\202\37\100\231\202\307\222\253\51\10\54\316\341\47\244\364\51\122\347\3\144\316\331"
+  "\306\107\363\267\331\1\101\243\320\203\227\364\5\43\325\33\276\356\71\220\155\54\6\272\306\43\174\126\50\30\244\274"
+  "\114\162\204\130\361\54\40\234\111\5\106\1\241\234\234\67\214\231\230\6\350\253\200\35\236\46\362\267\211\6\173\235"
+  "\253\206\243\147\257\170\352\123\323\352\45\104\226\166\235\55\237\277\316\117\355\34\222\130\342\340\230\234\374\157\365\45"
+  "\223\164\303\60\155\171\224\377\346\321\66\362\235\32\243\101\27\323\44\142\226\6\117\234\266\163\143\76\101\332\236\46"
+  "\220\104\354\41\41\211\363\234\223\240\332\107\154\132\357\50\371\322\105\63\201\30\70\321\136\211\236\121\341\31\365\345"
+  "\241\100\107\64\26\157\304\212\23\56\124\167\116\156\63\342\63\165\75\20\204\131\311\310\304\141\135\7\213\31\205\124"
+  "\261\52\333\33\315\245\163\203\12\331\223\227\151\26\27\66\265\272\170\254\360\50\25\26\36\101\212\164\2\263\31\60"
+  "\256\353\212\301\375\162\165\145\153\312\233\147\42\61\26\144\133\11\135\333\16\217\172\35\133\15\146\31\247\60\36\301"
+  "\100\342\335\102\7\341\4\74\17\337\240\67\341\107\151\122\366\337\142\330\344\47\322\246\224\365\112\311\364\330\67\66"
+  "\130\145\371\11\350\121\366\60\63\117\147\355\6\346\225\271\43\314\137\25\143\352\134\74\250\246\116\230\307\366\4\46"
+  "\112\241\17\34\326\55\333\72\131\75\126\361\3\11\352\123\65\334\37\110\235\254\337\111\17\104\361\42\11\32\254\366"
+  "\70\220\26\130\151\213\104\232\70\322\13\44\377\44\122\325\244\151\23\115\236\302\71\151\307\257\155\120\357\170\355\242"
+  "\357\334\234\46\42\26\107\175\320\320\234\227\132\270\50\120\312\170\203\275\235\36\355\143\106\211\177\171\144\205\276\250"
+  "\346\363\171\337\327\26\277\276\2\204\136\13\262\203\55\347\73\11\201\104\175\244\35\141\257\266\372\170\110\43\242\237"
+  "\12\47\275\120\101\30\271\363\45\62\342\311\340\151\167\142\112\346\123\277\0";
 
 /* lib/include/string.h (DEFLATEd, org. size 1854) */
 static unsigned char file_l_27[414] =
@@ -2401,13 +2554,15 @@ static unsigned char file_l_28[113] =
   "\25\200\346\330\52\204\73\6\173\52\204\173\270\372\71\273\202\44\200\372\321\124\73\207\6\51\150\30\142\252\6\111"
   "\140\252\166\365\163\121\320\60\302\124\15\222\200\272\15\0";
 
-/* lib/include/sys.crt.h (DEFLATEd, org. size 243) */
-static unsigned char file_l_29[154] =
-  "\125\215\1\7\303\60\20\205\1\10\371\17\247\203\266\120\66\300\300\60\100\67\146\30\63\25\351\165\216\345\122\311\145"
-  "\266\375\372\265\205\154\200\367\276\357\356\65\65\204\304\102\16\241\307\201\230\204\74\107\250\33\255\264\132\215\301\334"
-  "\235\1\317\26\163\162\276\117\17\204\302\6\51\26\153\71\104\70\36\316\373\123\333\265\273\13\154\326\132\311\173\304"
-  "\211\300\323\123\17\145\355\131\60\270\156\110\154\73\251\312\271\255\266\132\341\153\252\31\376\350\157\212\327\374\366\226"
-  "\375\110\37\314\242\365\211\45\303\145\161\6\304\106\260\44\26\210\142\44\305\171\120\253\57";
+/* lib/include/sys.crt.h (DEFLATEd, org. size 339) */
+static unsigned char file_l_29[213] =
+  "\125\220\61\153\303\60\20\205\167\203\377\303\221\56\266\50\230\266\143\246\16\31\323\102\351\120\10\305\134\244\163\162"
+  "\44\76\31\351\34\232\376\372\112\52\324\351\42\170\367\75\275\173\122\147\40\314\242\74\22\70\32\130\130\331\113\4"
+  "\323\325\125\135\335\115\1\17\43\202\27\113\213\32\275\233\317\4\53\33\164\225\135\235\1\22\7\176\200\250\250\154"
+  "\301\241\342\175\26\366\4\230\10\206\303\45\35\224\207\244\260\277\202\36\11\316\54\47\12\145\23\175\51\5\201\213"
+  "\147\7\346\110\70\365\173\214\264\56\25\112\53\202\327\227\367\315\333\266\337\76\177\300\323\143\135\351\165\242\104\176"
+  "\257\64\306\113\12\30\373\141\26\333\153\333\344\151\273\376\313\375\107\157\125\334\55\261\237\213\77\362\67\55\106\353"
+  "\323\377\354\36\156\170\131\232\31\13\52\65\54\132\136\76\307\266\124\376\1";
 
 /* lib/include/sys.intrs.h (DEFLATEd, org. size 3110) */
 static unsigned char file_l_30[612] =
@@ -2455,587 +2610,652 @@ static unsigned char file_l_31[634] =
   "\257\314\31\354\103\376\360\146\147\166\260\117\147\1\140\4\32\53\161\355\50\255\47\121\140\124\170\252\223\70\120\40"
   "\202\304\216\250\253\344\3\175\276\350\275\67\132\3\100\36\263\254\351\164\43\364\352\376\7";
 
-/* lib/include/sys.types.h (DEFLATEd, org. size 414) */
-static unsigned char file_l_32[150] =
-  "\165\317\201\6\303\60\20\306\161\0\112\337\341\30\120\246\154\63\350\303\124\233\134\353\64\271\124\163\35\335\323\57\121"
-  "\65\326\33\40\371\175\234\177\135\201\11\336\7\206\270\105\101\17\262\315\30\241\252\313\242\54\56\363\322\215\276\203"
-  "\300\6\363\73\215\43\275\261\25\240\10\375\112\116\256\304\151\273\313\177\42\226\131\26\305\362\61\213\103\36\74\37"
-  "\311\41\14\103\53\315\27\326\103\330\21\117\72\131\174\351\100\34\116\160\277\45\360\301\242\56\53\131\35\306\37\70"
-  "\376\241\167\323\36\336\234\163\62\32\26\335\204\74\352\142\134\60\173\353\7";
-
-/* lib/include/time.h (DEFLATEd, org. size 1301) */
-static unsigned char file_l_33[457] =
-  "\225\223\325\222\245\60\20\206\257\307\336\241\327\135\57\327\335\335\235\312\111\32\350\42\162\212\64\343\363\356\113\220\105"
-  "\327\216\166\345\377\332\303\205\323\160\117\60\202\260\12\230\14\302\351\13\33\253\33\253\107\226\271\110\214\0\147\45"
-  "\156\254\226\320\213\367\317\236\1\171\130\24\244\371\34\331\300\205\163\117\273\30\361\104\71\102\126\352\102\41\134\363"
-  "\73\376\2\357\54\321\237\117\157\214\317\245\302\270\76\57\225\322\46\213\160\367\331\313\273\117\337\106\257\356\277\211"
-  "\336\336\277\13\47\57\135\154\137\317\236\235\12\240\347\274\220\14\154\140\157\143\25\200\154\260\43\217\362\52\0\204"
-  "\212\120\72\253\174\50\243\223\15\331\106\56\255\202\161\44\247\256\310\257\126\162\260\306\276\112\354\324\142\151\200\213"
-  "\201\123\4\343\54\247\43\316\65\71\346\304\35\24\115\206\140\15\265\255\271\4\133\210\331\50\304\0\43\133\141\323"
-  "\150\344\225\347\253\15\246\51\111\31\274\330\44\233\164\373\75\270\32\6\211\333\214\271\5\251\235\314\42\256\377\117"
-  "\156\72\122\247\256\376\22\225\53\26\32\101\121\34\7\357\223\341\247\144\371\322\131\150\315\213\35\336\236\231\254\202"
-  "\273\115\235\136\262\231\142\275\210\201\350\1\62\15\135\11\57\53\104\72\353\31\146\243\165\160\37\235\213\331\367\117"
-  "\314\177\300\332\111\241\377\302\67\217\101\160\253\347\124\327\344\317\266\202\21\333\176\367\54\324\21\152\61\66\334\36"
-  "\114\133\253\356\261\106\311\250\340\325\313\267\217\77\235\323\224\41\10\245\210\251\364\251\326\330\344\16\53\3\336\365"
-  "\310\315\366\302\356\163\324\204\36\234\205\167\137\0\355\46\154\212\234\104\330\145\347\331\24\302\273\126\30\374\172\371"
-  "\173\327\216\166\315\165\331\165\26\377\60\302\50\237\14\345\354\77\54\152\336\261\321\27\105\74\177\23\72\257\121\212"
-  "\131\317\311\12\377\243\336\237";
-
-/* lib/include/unistd.h (DEFLATEd, org. size 1529) */
-static unsigned char file_l_34[453] =
-  "\322\327\2\124\116\125\133\163\302\100\370\272\366\16\123\7\352\356\275\251\273\313\35\47\44\3\344\154\10\234\144\350\376"
-  "\364\351\377\260\32\262\356\303\147\23\5\113\114\13\146\4\330\256\312\152\45\71\360\132\367\40\131\160\14\120\327\240"
-  "\205\210\145\106\212\2\105\14\311\215\63\47\317\234\74\337\30\126\124\14\152\315\321\75\111\315\125\53\20\236\332\316"
-  "\336\230\130\256\227\317\103\234\13\314\247\270\143\134\55\65\302\217\237\57\337\175\116\137\277\373\370\352\363\27\200\350"
-  "\146\74\240\276\374\372\71\347\242\133\103\352\325\367\357\13\352\266\107\275\116\277\174\30\346\374\165\310\320\376\307\41"
-  "\103\327\367\11\162\67\356\207\206\107\204\106\203\265\362\77\246\4\6\231\210\244\46\310\305\125\370\127\113\1\111\326"
-  "\346\127\141\106\353\370\311\212\145\154\44\341\334\63\135\317\75\235\315\256\156\131\107\170\25\352\74\117\251\377\265\110"
-  "\353\122\166\17\140\167\330\24\126\26\161\264\110\362\245\127\241\107\307\45\152\216\236\155\42\45\323\152\316\10\3\243"
-  "\102\135\120\31\210\271\252\355\134\30\120\322\62\242\156\225\233\116\305\146\146\62\262\206\114\112\116\317\343\47\160\43"
-  "\351\13\260\145\335\52\1\31\2\203\252\125\44\33\205\156\14\160\377\356\7\110\156\14\172\60\316\321\332\150\272\106"
-  "\274\144\6\222\206\121\171\165\112\126\265\10\47\327\152\45\365\210\221\277\274\353\254\224\53\126\254\365\256\64\13\124"
-  "\136\176\255\104\330\302\101\313\56\32\307\41\357\240\35\243\360\307\340\107\256\315\11\274\266\253\146\303\363\265\124\320"
-  "\64\140\335\232\50\75\332\34\264\66\146\207\335\277\231\73\367\142\132\373\307\336\325\175\265\45\60\72\60\306\233\226"
-  "\251\204\64\133\6\24\310\27\226\150\207\60\27\214\230\355\64\137\177\123\362\220\362\56\112\212\107\162\72\40\113\214"
-  "\132\333\363\307";
-
-/* lib/include/wasi.api.h (DEFLATEd, org. size 48950) */
-static unsigned char file_l_35[10409] =
-  "\234\130\327\172\342\310\22\276\76\351\35\352\344\350\100\234\164\205\101\266\365\15\40\126\22\223\156\370\32\251\200\336\221"
-  "\272\165\272\133\170\331\247\337\356\22\321\43\230\74\116\252\277\342\137\101\276\371\17\274\357\105\76\364\46\376\153\130"
-  "\31\123\350\327\67\67\113\156\126\345\374\72\221\371\315\173\234\367\264\306\174\236\155\156\234\340\15\374\347\346\117\277"
-  "\267\250\361\335\153\60\53\256\301\376\373\247\102\226\375\163\257\10\376\245\21\141\66\173\142\232\147\174\236\314\334\343"
-  "\353\344\337\4\375\323\357\377\132\50\266\314\31\344\62\55\63\204\277\70\261\231\26\254\320\53\151\146\205\302\65\307"
-  "\247\306\137\16\202\122\44\110\300\24\27\134\40\14\374\260\37\4\157\175\157\26\305\275\60\206\333\351\320\76\46\247"
-  "\244\270\22\270\144\206\257\21\26\74\103\320\374\127\4\251\40\103\261\64\53\220\13\140\240\160\311\245\200\47\156\375"
-  "\27\300\110\360\232\234\63\233\2\255\21\50\271\60\335\366\314\320\43\247\142\146\336\154\115\304\74\107\155\130\136\200"
-  "\305\12\46\244\306\104\212\124\237\121\140\166\342\7\15\176\212\302\360\5\107\245\141\41\25\44\231\114\76\327\340\133"
-  "\115\213\247\207\74\165\150\262\276\302\352\107\220\43\323\245\342\142\11\56\273\144\347\232\234\203\65\313\112\204\137\121"
-  "\111\110\244\122\250\13\347\37\205\373\247\337\303\177\240\361\352\305\355\325\155\303\376\213\157\157\137\323\277\117\144\175"
-  "\237\340\376\60\350\277\365\7\263\320\353\15\143\177\344\331\14\357\255\153\43\25\136\75\361\24\41\227\102\32\51\170"
-  "\122\271\364\77\170\132\361\144\345\10\121\351\111\201\151\140\317\375\45\37\366\76\73\220\324\73\247\23\46\254\112\230"
-  "\43\260\364\347\122\33\247\102\244\225\336\335\303\25\133\43\354\212\114\312\52\3\77\227\171\241\257\311\107\54\144\102"
-  "\265\46\202\322\143\347\125\51\266\176\125\122\154\256\145\126\32\44\77\110\21\71\361\14\147\126\250\320\226\11\255\141"
-  "\15\102\272\100\204\15\243\76\143\243\140\34\304\301\330\357\103\343\220\262\376\144\172\345\154\154\65\62\255\145\302\231"
-  "\301\224\152\342\54\100\122\52\205\302\100\241\144\202\132\327\53\237\204\101\337\213\242\231\325\347\252\62\363\7\320\374"
-  "\41\53\146\245\220\245\365\106\342\107\133\365\301\261\215\326\164\113\134\117\51\107\127\231\242\6\205\246\124\256\304\363"
-  "\15\54\112\221\30\56\205\276\246\54\216\245\1\226\145\125\36\121\43\340\21\216\51\74\306\72\211\3\336\205\277\346"
-  "\351\356\11\327\244\317\116\224\67\240\145\216\4\56\65\246\256\365\126\174\151\53\163\225\341\32\63\260\123\106\61\265"
-  "\201\214\155\120\351\377\21\151\244\253\34\31\334\253\45\165\71\52\314\66\324\171\54\343\113\221\273\214\120\212\46\101"
-  "\344\177\370\262\17\33\335\231\161\61\10\111\135\170\110\231\27\206\343\140\26\115\373\256\52\160\13\64\200\266\321\312"
-  "\204\222\155\223\34\155\264\301\34\22\227\222\104\346\105\206\256\46\272\114\134\241\27\145\226\155\310\344\63\255\315\73"
-  "\377\1\32\116\145\117\55\113\362\61\343\332\200\221\22\62\51\226\165\230\236\163\4\232\16\64\101\225\163\255\335\230"
-  "\113\121\160\114\153\345\7\203\320\37\117\43\17\132\144\50\115\25\152\15\134\270\44\237\3\130\176\367\336\365\374\41"
-  "\264\217\61\302\325\174\315\170\306\346\131\75\364\176\34\104\323\311\44\10\143\350\34\43\27\54\347\331\206\24\350\262"
-  "\50\244\62\147\234\175\350\371\143\350\72\150\210\132\226\52\101\50\305\336\346\377\300\45\275\100\305\14\315\166\131\146"
-  "\226\105\256\23\152\225\15\35\311\77\302\13\247\256\57\205\300\204\140\54\163\215\261\1\56\34\147\226\316\301\72\370"
-  "\135\157\160\17\57\35\366\216\245\325\236\111\121\47\212\27\106\252\63\200\121\364\0\257\166\220\334\52\146\113\254\25"
-  "\235\106\37\241\101\144\32\340\232\47\264\275\324\56\342\171\251\153\351\322\357\215\373\336\320\33\100\203\70\23\354\23"
-  "\221\60\221\140\206\151\55\350\321\37\132\104\163\113\334\144\305\263\164\67\201\120\327\42\202\361\270\167\147\153\350\54"
-  "\265\236\47\157\116\305\73\207\13\275\373\151\344\160\355\147\70\205\213\122\137\302\105\136\14\215\316\27\50\215\246\16"
-  "\63\260\225\35\276\205\306\51\125\122\144\251\143\303\226\31\324\236\365\350\50\166\64\17\275\237\240\361\242\252\202\66"
-  "\134\260\52\304\55\151\25\376\277\344\252\336\347\101\60\202\6\221\143\304\314\12\163\213\114\64\260\135\27\313\322\270"
-  "\311\230\312\234\161\341\276\332\115\277\132\135\77\115\3\33\373\253\155\50\250\326\365\66\275\17\176\24\103\223\130\163"
-  "\357\350\210\277\160\155\152\113\170\337\233\16\255\150\143\107\305\52\244\172\121\67\203\232\315\275\122\232\75\114\325\363"
-  "\366\61\210\342\251\55\126\257\377\10\115\242\306\243\324\246\132\273\12\131\262\72\67\31\374\101\70\202\146\33\116\56"
-  "\43\120\230\313\63\301\372\303\310\26\247\331\41\104\226\341\222\145\60\337\30\4\155\253\202\42\251\267\62\266\333\363"
-  "\41\164\203\272\331\75\155\221\113\315\116\310\70\204\346\13\262\46\14\52\125\26\6\323\363\145\43\310\273\336\20\232"
-  "\57\53\314\232\145\74\335\23\240\126\76\200\46\325\330\277\11\252\375\121\53\25\271\166\200\26\125\71\262\134\106\112"
-  "\157\122\365\4\246\365\230\201\37\102\253\101\312\65\60\110\271\262\302\122\325\116\221\141\20\114\240\105\5\217\245\204"
-  "\234\211\15\320\202\325\216\250\172\223\317\145\306\23\310\270\370\134\233\252\321\275\77\364\240\325\42\306\234\116\105\272"
-  "\255\276\102\241\321\320\37\277\205\126\373\304\376\171\143\321\103\344\177\262\346\210\10\43\232\250\137\63\140\251\357\77"
-  "\272\30\273\137\353\250\161\157\344\305\101\60\14\306\17\320\172\261\13\110\260\34\57\256\340\261\27\17\202\367\266\110"
-  "\124\373\61\232\47\251\350\366\114\345\223\70\3\250\6\134\353\125\355\70\245\123\110\124\172\352\361\373\256\153\337\36"
-  "\331\374\132\327\215\251\124\355\306\111\256\351\155\307\155\121\152\12\115\207\113\55\70\270\233\336\107\320\336\155\216\171"
-  "\271\130\240\2\135\260\4\57\234\1\204\34\170\357\240\335\332\2\165\231\254\40\245\65\127\57\355\215\143\150\267\217"
-  "\245\151\333\112\165\211\310\4\374\340\365\241\115\324\360\176\301\244\64\316\243\12\274\220\52\147\346\114\237\21\170\330"
-  "\177\13\355\356\326\52\275\235\175\55\52\142\156\373\305\127\131\25\214\274\21\264\53\162\110\3\50\144\271\134\125\211"
-  "\73\43\37\75\100\373\125\45\277\73\33\252\313\232\272\313\55\41\160\307\152\75\332\316\74\113\342\111\14\35\342\306"
-  "\104\111\43\23\231\175\345\134\43\150\64\351\103\247\261\313\74\125\66\303\205\1\51\56\26\54\372\30\101\247\132\31"
-  "\333\1\371\225\323\216\120\61\115\266\116\13\166\57\231\273\351\106\340\13\23\216\300\156\304\165\266\44\61\307\63\316"
-  "\361\204\235\316\55\60\362\130\342\214\106\157\64\211\77\102\207\350\63\330\311\222\57\230\27\346\34\52\364\372\301\73"
-  "\57\354\335\15\75\350\20\175\42\303\14\22\316\352\220\153\124\347\363\35\107\201\145\135\347\305\41\214\52\11\347\244"
-  "\247\23\350\354\170\164\110\357\351\31\174\232\172\220\342\262\116\27\162\265\206\4\53\12\45\13\305\231\101\132\112\211"
-  "\24\106\311\354\240\272\126\305\7\77\200\356\355\227\275\15\122\135\272\63\134\322\356\207\301\173\350\22\337\336\235\156"
-  "\12\127\261\371\366\367\16\364\346\227\62\303\316\162\336\16\137\57\164\47\40\164\233\25\345\255\7\262\324\140\347\57"
-  "\272\251\121\317\242\211\27\216\240\113\374\13\116\262\127\240\312\271\61\147\120\376\304\203\56\61\357\116\311\317\50\240"
-  "\340\365\156\121\43\102\267\163\334\205\347\47\20\111\37\336\227\272\335\143\330\327\373\211\340\361\107\347\333\213\23\344"
-  "\223\222\142\351\122\107\103\360\2\31\302\336\370\301\242\137\156\347\131\231\231\313\213\65\14\356\43\350\156\317\124\226"
-  "\136\111\221\375\106\253\165\60\71\252\303\340\277\342\151\327\353\366\66\205\113\330\62\227\115\156\10\271\62\215\170\301"
-  "\331\60\313\102\6\274\355\225\377\376\44\53\236\7\261\301\311\365\12\370\373\44\133\226\144\131\24\115\72\202\310\130"
-  "\315\336\376\207\172\222\124\11\161\143\375\66\200\370\266\377\261\156\131\266\112\211\376\72\364\6\200\274\345\362\306\130"
-  "\340\350\217\46\41\333\137\75\312\140\35\45\301\124\335\72\354\173\370\151\14\147\107\312\123\304\43\125\11\133\217\146"
-  "\337\61\342\355\323\361\245\54\252\352\55\355\11\345\215\332\274\241\367\105\71\221\375\75\212\137\122\344\170\224\77\142"
-  "\75\276\340\127\151\226\312\124\340\71\275\202\270\233\306\251\316\52\261\112\143\46\136\45\24\112\144\365\6\36\111\264"
-  "\145\254\135\55\13\152\174\131\165\271\345\117\260\303\320\324\61\64\212\244\245\224\111\100\265\112\350\134\320\63\334\241"
-  "\151\176\17\33\200\115\147\111\204\373\263\172\312\343\51\225\203\56\146\154\272\340\162\36\141\136\61\105\237\136\11\371"
-  "\6\6\304\331\35\126\204\244\11\203\343\32\203\260\74\203\330\263\214\137\127\107\107\11\301\67\46\57\270\70\73\17"
-  "\307\321\151\77\352\173\241\67\376\61\354\261\27\57\264\310\57\137\174\144\47\47\354\303\313\227\235\222\343\341\177\252"
-  "\212\107\123\334\33\360\377\370\276\246\205\32\2\364\360\45\32\352\132\272\20\360\2\221\133\5\306\132\204\51\354\107"
-  "\207\260\112\4\254\144\202\24\70\57\54\205\332\22\332\105\135\116\51\262\254\225\167\354\373\237\115\336\55\7\357\54"
-  "\251\44\227\100\57\43\265\34\155\360\360\13\66\142\10\54\141\164\72\360\316\306\46\325\266\203\352\317\132\121\211\360"
-  "\264\334\353\232\226\335\254\166\326\131\51\170\100\216\213\263\7\216\325\115\56\225\320\224\317\316\146\240\316\262\62\216"
-  "\205\201\12\153\133\231\24\30\362\136\244\357\304\273\67\154\372\60\307\303\355\321\121\174\127\222\56\313\141\252\324\377"
-  "\122\105\176\131\50\14\315\355\62\200\320\37\14\114\165\166\35\352\74\224\251\24\365\155\122\211\74\371\75\333\204\240"
-  "\333\304\375\26\134\204\276\51\357\236\103\136\236\334\247\125\73\252\327\377\172\61\266\300\356\273\140\263\254\210\271\354"
-  "\0\36\100\111\335\263\111\174\320\1\115\6\33\227\2\240\243\104\347\236\166\222\57\136\170\36\365\2\37\110\42\110"
-  "\202\375\136\70\12\176\230\164\207\104\327\266\207\254\253\141\154\233\142\271\101\224\144\156\161\360\170\151\361\151\37\234"
-  "\232\143\130\44\116\332\36\53\321\214\243\365\320\326\326\225\75\75\107\355\62\341\351\54\32\217\46\101\317\46\323\307"
-  "\337\50\223\304\14\111\256\55\123\350\5\147\176\150\221\311\352\204\315\265\151\207\37\175\361\207\26\334\355\65\42\40"
-  "\10\337\31\252\300\322\54\310\73\116\211\21\33\147\262\103\152\204\307\211\261\340\357\272\361\125\171\306\271\116\33\330"
-  "\115\340\143\31\250\335\162\366\176\233\114\353\333\15\311\324\156\71\373\116\231\120\4\25\302\201\261\143\55\160\7\253"
-  "\0\156\347\261\372\260\170\316\363\153\261\274\122\177\136\321\355\373\13\165\205\112\207\371\246\10\224\105\340\107\323\227"
-  "\233\207\171\267\257\222\345\135\36\273\125\244\34\5\213\211\26\75\17\327\237\117\124\106\335\367\257\113\211\7\220\261"
-  "\45\3\163\345\251\356\25\74\355\73\326\157\313\225\136\232\113\324\116\344\234\305\55\107\122\271\366\34\22\235\173\6"
-  "\267\235\253\6\125\41\207\63\32\377\240\202\264\211\356\366\165\164\175\261\126\374\16\374\313\321\327\316\370\275\345\366"
-  "\175\167\71\52\243\246\261\203\152\62\104\205\132\142\363\26\171\63\43\207\103\267\275\366\116\54\262\54\52\162\1\211"
-  "\351\24\237\127\167\127\350\351\256\260\210\243\343\213\75\125\244\254\362\267\361\20\232\175\46\106\203\201\16\145\55\31"
-  "\345\126\247\23\245\234\167\176\47\261\246\157\347\300\132\136\64\76\237\320\145\200\211\257\234\247\142\360\214\210\0\56"
-  "\64\131\355\107\322\335\100\63\152\4\242\221\272\217\251\230\261\133\161\13\106\106\105\235\230\113\51\312\367\327\34\335"
-  "\56\303\11\257\232\140\25\270\305\130\262\24\14\64\146\177\303\132\250\43\376\1\300\277\202\102\376\61\43\275\165\301"
-  "\116\27\233\251\306\117\305\70\224\131\337\51\303\160\152\220\302\57\242\114\344\32\100\267\134\271\306\377\113\222\154\252"
-  "\230\132\141\273\146\161\115\265\270\310\53\271\271\202\210\56\105\276\261\206\46\0\251\30\257\350\30\210\214\232\324\350"
-  "\10\327\325\213\126\157\105\113\104\46\171\263\2\263\50\252\224\56\304\65\244\54\250\276\203\377\100\154\71\327\64\44"
-  "\251\221\204\64\371\364\134\321\161\123\221\151\353\376\166\356\17\173\76\72\136\106\227\220\102\334\64\170\53\311\113\371"
-  "\266\230\275\325\152\30\143\173\223\200\175\264\216\325\315\111\132\41\353\160\177\330\147\133\326\341\42\117\352\304\65\133"
-  "\232\11\300\215\361\243\346\124\64\156\12\200\271\174\42\307\24\316\165\73\332\7\130\370\353\74\235\245\344\207\110\75"
-  "\232\104\43\177\64\312\145\360\76\56\212\233\124\64\327\113\127\137\25\306\64\211\40\77\314\60\163\1\222\54\101\354"
-  "\51\2\347\162\272\264\146\173\137\40\242\323\110\104\257\25\376\52\121\246\74\143\371\335\355\225\100\16\276\274\202\117"
-  "\341\152\134\133\131\52\53\243\70\153\312\237\346\105\142\223\35\47\316\160\132\105\251\36\331\55\11\337\340\263\225\366"
-  "\51\14\103\130\245\206\260\364\171\210\176\362\3\153\362\340\24\265\61\221\126\67\71\270\140\174\204\67\254\351\114\255"
-  "\64\360\225\305\55\303\373\114\202\240\116\60\5\132\261\152\41\142\134\120\162\76\246\54\237\6\350\272\241\144\173\321"
-  "\363\311\120\303\166\41\310\270\52\165\247\104\315\106\372\302\103\115\136\13\105\357\334\13\274\136\350\7\232\146\153\3"
-  "\32\114\261\113\36\113\121\272\251\352\111\305\366\332\34\215\155\321\5\36\370\147\223\201\27\104\164\223\274\1\76\372"
-  "\367\273\214\323\213\116\12\214\243\176\30\365\317\2\357\222\355\156\244\2\227\374\272\344\267\372\222\243\23\177\34\6"
-  "\76\20\354\155\102\200\35\47\157\53\131\12\47\307\217\313\117\160\77\334\213\124\62\271\257\71\14\300\346\65\45\316"
-  "\112\303\221\31\276\312\26\371\310\165\104\240\72\105\277\232\17\142\340\152\304\243\244\330\145\104\4\174\265\312\120\273"
-  "\162\303\136\314\125\207\307\110\106\205\14\377\322\300\115\17\104\370\165\155\21\121\26\272\301\323\256\25\253\273\67\106"
-  "\76\262\65\354\302\113\355\54\332\320\264\3\122\140\370\217\143\303\323\154\54\343\277\172\262\233\376\267\50\165\316\302"
-  "\125\203\47\133\250\254\45\147\252\12\111\133\212\32\20\60\304\131\335\45\176\31\257\72\113\257\217\256\42\32\216\202"
-  "\113\157\360\277\247\344\213\5\230\214\2\323\375\311\64\34\345\277\126\11\6\371\373\53\1\175\323\151\121\322\11\271"
-  "\24\350\7\245\16\211\225\166\212\152\333\240\124\6\61\264\134\115\374\141\170\1\344\37\155\344\342\21\1\311\224\111"
-  "\161\23\170\331\240\45\301\74\262\47\362\322\131\361\40\112\262\105\32\114\155\275\372\211\125\224\300\33\142\217\335\326"
-  "\117\213\241\22\255\222\347\11\10\120\224\211\50\255\64\337\56\6\203\241\357\367\331\366\257\20\321\346\102\137\167\47"
-  "\357\112\141\145\352\217\206\241\142\332\351\142\242\130\216\251\142\366\37\171\327\335\335\270\256\334\377\116\373\16\114\367"
-  "\356\341\326\164\157\232\267\335\353\363\266\305\145\375\122\55\130\244\154\144\51\122\41\50\227\224\357\36\314\17\243\71"
-  "\103\30\24\45\255\67\365\225\173\145\22\30\140\6\203\1\246\22\76\340\357\35\27\314\364\216\242\177\377\150\127\4"
-  "\221\231\101\216\0\172\127\163\234\303\322\225\64\115\30\175\314\254\53\333\65\276\111\330\151\6\42\256\331\45\263\312"
-  "\174\70\130\54\312\272\240\244\221\162\77\173\113\203\363\25\233\231\130\156\5\246\362\376\25\227\31\264\57\13\171\35"
-  "\54\122\145\35\237\374\157\341\234\72\77\370\342\55\246\344\206\223\161\43\247\341\31\51\34\104\13\317\62\266\276\44"
-  "\270\344\53\272\152\233\332\153\7\5\302\44\230\372\135\171\351\33\337\161\270\167\330\351\237\353\12\321\356\150\243\104"
-  "\253\236\272\206\227\236\345\133\170\240\342\111\302\131\50\11\60\270\210\320\14\211\126\111\60\176\345\77\341\242\243\41"
-  "\105\356\277\143\65\27\150\221\100\120\342\77\134\32\360\321\300\374\376\140\13\42\202\32\151\42\36\326\270\241\223\215"
-  "\232\36\364\273\3\336\60\201\163\374\262\4\214\342\60\201\5\101\203\373\333\124\116\100\325\315\322\371\265\132\56\74"
-  "\240\122\363\316\274\354\14\1\117\243\236\306\34\316\301\64\363\233\256\153\355\305\162\110\213\15\176\126\234\343\372\0"
-  "\233\71\130\171\344\24\43\250\52\32\46\223\175\203\246\370\51\355\6\266\136\46\256\175\352\302\277\57\214\13\3\34"
-  "\341\157\210\37\10\210\273\260\243\254\113\252\221\151\140\266\366\322\300\166\176\205\0\362\243\271\265\363\345\74\343\13"
-  "\110\253\106\340\130\4\133\173\344\311\106\220\21\104\212\305\51\157\342\361\270\7\45\170\4\167\31\211\241\26\1\165"
-  "\251\351\345\131\371\364\362\151\56\155\356\271\121\376\203\111\236\312\324\12\351\42\174\345\106\64\224\11\221\24\246\257"
-  "\111\275\61\165\166\41\111\52\304\273\27\266\26\126\143\363\64\356\115\144\267\142\275\314\223\324\206\221\356\0\57\12"
-  "\160\324\114\274\126\143\303\354\224\312\166\6\53\0\340\221\111\125\61\34\215\35\62\254\206\204\257\353\372\322\27\215"
-  "\61\215\312\270\16\173\114\316\5\311\210\3\143\260\362\254\166\340\144\145\335\335\337\67\276\361\44\332\77\307\47\54"
-  "\201\275\61\227\66\220\353\22\2\170\333\71\0\341\146\306\311\120\23\116\243\333\337\247\304\63\172\267\156\22\136\74"
-  "\236\245\46\362\142\315\104\110\330\332\31\37\236\133\221\144\276\206\44\37\7\110\362\162\367\231\354\112\230\217\303\204"
-  "\21\351\376\236\236\352\100\43\32\221\304\346\125\3\323\306\125\163\223\321\256\133\245\201\271\246\102\150\126\322\302\121"
-  "\171\305\145\271\350\163\241\103\340\65\73\315\4\0\140\252\134\307\224\102\225\323\235\304\72\272\326\230\272\210\217\327"
-  "\17\76\235\364\364\13\20\205\331\37\126\162\157\47\6\272\62\221\4\117\176\246\130\151\274\302\236\47\225\101\313\225"
-  "\364\346\152\172\110\275\201\354\342\123\157\106\323\54\232\62\4\276\42\213\243\77\323\317\141\222\360\262\373\271\65\351"
-  "\151\275\67\266\42\140\165\77\36\66\11\112\73\36\232\24\303\13\70\314\121\162\244\60\71\227\4\371\356\227\157\76"
-  "\50\150\161\140\21\171\345\4\345\256\11\136\302\347\111\110\47\107\247\70\125\233\4\303\205\13\217\250\231\127\246\55"
-  "\260\324\141\371\153\121\241\23\242\22\355\246\315\62\126\337\106\316\144\314\130\116\145\221\267\364\343\225\112\330\72\174"
-  "\113\363\271\167\126\210\20\217\365\147\150\317\111\3\136\102\201\135\173\370\153\274\62\270\204\320\154\200\110\361\204\124"
-  "\266\63\255\11\17\321\264\75\173\215\313\245\133\130\70\133\303\26\342\236\242\51\273\325\250\225\150\352\322\204\65\155"
-  "\354\127\250\355\30\126\347\110\147\164\100\140\334\17\203\42\376\151\242\333\134\272\215\210\301\124\347\151\257\63\60\243"
-  "\105\136\72\366\147\307\275\377\3\155\372\127\205\123\127\266\117\44\175\25\342\136\135\150\300\130\146\172\25\324\221\346"
-  "\342\237\225\106\207\134\132\203\164\151\62\271\343\236\120\336\166\60\362\25\320\222\23\27\327\64\133\223\14\152\13\323"
-  "\163\21\210\311\226\175\144\13\352\316\73\244\274\106\106\132\13\13\1\147\254\326\323\1\53\56\32\213\31\167\145\77"
-  "\221\204\163\165\246\330\142\102\306\10\16\147\143\264\345\34\232\320\317\146\31\73\256\337\175\365\346\205\140\37\205\146"
-  "\362\74\113\136\232\47\32\215\163\366\50\302\27\264\277\117\253\162\56\155\133\114\2\274\200\231\110\276\3\356\162\324"
-  "\15\131\334\24\77\311\204\140\315\261\153\355\345\45\222\363\143\326\37\230\261\304\160\276\170\240\71\117\315\302\114\155"
-  "\167\227\230\67\165\173\260\171\113\114\335\313\114\254\374\201\367\207\314\357\342\151\5\47\363\175\126\234\304\115\253\235"
-  "\257\351\303\17\123\156\157\344\10\24\77\126\131\266\222\172\317\371\37\240\105\325\320\301\212\13\261\223\114\220\4\106"
-  "\107\147\70\62\172\256\335\363\237\175\40\373\351\27\177\200\350\141\123\361\300\220\323\276\211\303\146\251\263\11\72\114"
-  "\260\45\203\225\320\272\115\60\225\243\2\375\173\213\215\103\103\313\330\32\102\121\154\221\265\110\151\74\117\63\154\246"
-  "\171\0\242\54\242\150\46\52\337\350\142\262\64\113\114\125\71\143\131\112\100\130\111\126\373\60\306\100\122\311\41\371"
-  "\371\152\235\220\274\154\272\236\204\234\254\172\115\4\111\344\337\163\326\26\260\73\244\353\115\375\204\202\137\51\341\77"
-  "\274\321\323\204\100\45\214\71\125\200\217\340\276\40\154\311\44\351\272\36\55\371\244\115\32\212\143\142\224\5\367\114"
-  "\21\61\123\177\2\124\314\151\230\17\172\346\174\367\263\216\160\321\214\106\300\25\257\361\225\175\22\272\271\314\136\326"
-  "\115\133\206\155\3\37\142\177\125\261\220\311\273\71\156\343\10\153\360\217\26\155\160\24\53\71\55\353\144\153\221\331"
-  "\3\233\232\110\212\131\251\135\115\13\304\361\245\36\223\215\200\147\6\310\113\135\16\151\56\147\13\11\104\234\57\336"
-  "\24\104\217\112\323\156\1\137\373\213\45\142\123\152\142\244\117\262\350\224\72\76\175\215\343\51\210\32\377\327\361\233"
-  "\243\303\57\47\207\237\77\205\143\353\374\340\365\61\52\246\354\355\11\115\66\23\71\375\123\42\26\74\200\224\26\64"
-  "\275\303\5\355\302\36\224\312\61\231\55\204\367\302\173\163\151\310\300\42\141\2\260\261\31\160\121\271\376\252\304\244"
-  "\24\170\262\126\115\53\324\135\17\301\163\332\324\122\66\313\253\114\200\314\351\306\112\124\240\206\330\134\211\53\17\156"
-  "\122\67\306\166\142\376\43\67\2\201\317\36\7\34\114\125\272\151\360\162\7\237\57\357\21\236\106\314\245\42\51\171"
-  "\163\260\161\373\56\44\310\224\0\0\202\0\147\154\315\44\272\330\156\211\145\300\76\330\141\261\167\71\155\64\270\304"
-  "\241\63\344\327\254\205\5\2\145\147\270\13\206\20\226\51\125\134\201\252\67\162\376\314\210\307\242\173\314\53\41\111"
-  "\152\122\233\123\46\222\67\265\177\326\7\273\364\377\345\103\47\265\2\201\341\137\305\257\7\344\364\46\355\360\63\106"
-  "\217\347\361\152\375\272\54\373\321\126\235\271\304\200\11\174\226\251\1\204\150\307\3\67\371\121\316\20\146\30\74\210"
-  "\255\353\235\303\361\161\311\246\110\336\164\321\376\44\77\220\224\366\21\53\53\146\266\277\37\37\350\311\53\2\75\117"
-  "\70\146\1\242\27\326\44\267\320\34\243\332\316\11\27\1\174\114\324\64\111\205\240\357\156\155\207\372\104\331\145\131"
-  "\227\255\341\264\173\263\272\71\204\375\131\336\202\355\323\346\52\274\45\20\152\231\354\145\155\52\232\130\141\207\275\275"
-  "\16\255\320\13\376\33\176\360\224\362\172\171\121\120\227\10\227\141\110\50\17\323\225\163\123\123\135\21\154\315\311\67"
-  "\133\125\173\13\133\344\376\170\231\344\234\34\201\53\1\257\55\224\314\124\42\344\361\341\117\237\16\76\220\77\350\335"
-  "\112\343\372\331\324\227\113\57\272\17\246\35\162\16\117\160\141\60\35\307\100\61\111\222\140\176\76\375\262\322\201\244"
-  "\127\146\271\150\306\12\325\135\40\123\21\216\354\145\17\162\225\371\22\54\337\5\363\157\116\17\175\331\5\0\225\72"
-  "\42\266\306\266\41\130\273\315\363\3\25\106\142\63\227\231\226\317\56\332\322\174\133\64\226\30\270\65\273\221\365\344"
-  "\350\300\47\173\7\250\137\102\73\124\207\370\56\354\17\136\123\146\61\200\372\356\200\31\104\211\124\111\313\50\303\230"
-  "\343\60\15\107\65\260\355\142\227\21\251\262\221\17\177\221\112\142\165\111\151\331\246\365\247\365\274\364\274\54\276\305"
-  "\335\50\377\336\47\23\377\151\200\376\13\133\355\106\223\137\320\362\375\31\1\141\21\311\224\140\72\147\57\166\202\172"
-  "\172\174\364\42\173\21\166\227\144\72\63\71\45\72\161\47\310\307\357\176\372\112\25\237\6\47\374\162\327\11\277\244"
-  "\262\120\312\143\113\342\235\222\333\371\166\125\67\376\11\256\321\360\14\133\305\20\207\320\107\322\142\6\31\337\57\170"
-  "\313\35\124\246\235\207\363\171\67\6\376\160\364\221\212\111\151\241\100\100\276\147\123\234\274\43\230\274\325\336\350\172"
-  "\130\131\267\202\122\344\344\307\131\54\270\330\2\235\73\266\136\226\305\146\44\170\363\63\225\334\342\175\367\206\373\146"
-  "\45\225\50\241\303\5\152\40\203\27\200\322\316\245\33\246\7\362\101\45\331\13\336\157\307\276\141\46\175\5\60\236"
-  "\53\240\151\46\73\371\374\205\12\132\365\204\57\206\26\112\157\3\356\344\370\304\203\343\115\366\332\114\277\135\266\315"
-  "\262\26\72\323\365\203\152\154\160\141\313\142\113\340\47\207\237\250\14\326\6\300\161\217\333\26\372\347\123\237\70\303"
-  "\307\244\365\267\233\13\123\27\67\266\350\256\70\362\103\33\155\214\324\360\330\160\167\234\36\121\265\55\100\247\142\216"
-  "\101\31\252\354\334\322\345\142\132\226\360\132\355\300\324\277\44\140\57\171\327\275\27\273\375\103\100\176\177\374\167\331"
-  "\113\336\202\137\155\333\55\271\252\147\113\176\66\333\356\10\366\353\11\366\366\113\71\362\232\231\255\150\315\276\33\64"
-  "\225\306\170\357\63\135\130\264\331\272\150\156\330\310\277\341\376\75\73\374\104\5\316\170\137\121\270\312\242\161\316\372"
-  "\5\337\155\76\237\77\120\241\60\106\24\301\160\63\143\253\145\273\43\270\63\137\252\114\366\126\221\71\251\75\271\233"
-  "\74\364\325\174\250\336\130\317\204\44\152\103\327\250\62\11\103\226\241\326\366\154\102\107\320\17\60\260\124\63\242\23"
-  "\205\364\153\344\114\321\62\333\116\334\36\274\201\176\237\356\257\323\222\264\155\157\256\133\226\161\322\15\7\37\275\173"
-  "\363\365\374\313\252\250\301\200\303\266\116\104\356\272\234\243\267\227\165\147\53\256\111\132\125\312\60\201\355\75\105\160"
-  "\207\350\70\153\46\161\166\160\170\162\300\271\365\151\227\52\150\251\53\241\156\102\313\46\246\145\252\363\276\324\102\303"
-  "\244\111\155\270\50\311\274\300\156\327\170\336\237\325\274\251\164\6\174\256\224\267\216\232\24\151\7\163\232\25\244\24"
-  "\0\71\352\103\322\247\151\245\352\54\212\174\146\0\7\15\205\257\52\160\314\317\227\16\125\177\221\256\322\240\240\301"
-  "\220\245\121\370\111\7\271\140\17\327\250\123\127\213\324\45\110\224\246\45\265\327\22\312\127\77\306\360\255\165\44\272"
-  "\235\137\375\226\346\57\114\67\24\366\166\274\12\173\43\132\271\144\340\140\2\52\21\151\24\344\331\21\100\246\271\47"
-  "\56\41\275\150\113\17\217\170\141\252\52\304\244\161\346\266\332\223\167\100\17\237\60\204\201\150\201\57\107\357\50\247"
-  "\174\225\126\0\155\161\300\204\363\73\213\26\336\321\310\206\251\6\336\337\367\243\244\55\131\334\227\122\47\141\256\110"
-  "\7\175\313\44\21\376\15\32\120\334\251\370\243\24\224\163\144\140\107\231\134\213\360\230\262\271\140\27\120\355\125\370"
-  "\227\104\152\223\121\232\104\224\1\241\142\122\337\45\254\124\2\121\314\123\275\41\10\1\75\160\332\172\304\57\323\146"
-  "\43\75\300\122\303\322\131\146\246\40\333\356\334\324\305\223\212\126\121\312\220\222\154\220\164\47\120\145\105\132\323\266"
-  "\346\316\157\34\324\111\365\330\117\257\140\205\350\313\52\17\307\41\53\330\41\7\31\370\227\267\10\164\147\117\15\15"
-  "\205\227\173\275\14\303\307\376\361\165\256\37\341\311\271\117\236\373\215\137\175\44\23\307\130\153\246\216\31\163\275\351"
-  "\277\16\63\303\157\71\137\264\77\115\272\72\216\125\216\21\146\300\256\223\372\344\64\6\135\357\305\261\364\164\20\105"
-  "\241\302\236\342\257\307\176\116\213\256\175\236\337\177\366\102\360\344\5\52\353\153\333\66\65\246\160\155\132\113\302\42"
-  "\261\76\121\242\242\33\133\42\6\253\126\51\211\3\67\113\254\24\277\351\57\26\77\114\257\127\12\223\35\226\53\5"
-  "\146\375\32\2\330\340\350\153\361\336\175\371\4\155\211\105\133\212\271\204\365\332\220\350\334\63\223\42\366\115\12\10"
-  "\323\31\305\247\150\146\304\237\11\253\35\244\232\252\336\7\210\34\145\263\254\343\347\71\107\133\140\102\23\40\271\277"
-  "\157\311\330\60\221\252\354\345\76\242\6\20\151\156\347\266\62\55\16\156\0\40\12\170\34\120\246\10\366\306\373\213"
-  "\165\22\243\11\304\321\273\267\125\62\73\203\165\340\312\54\40\50\223\344\17\203\266\212\364\332\103\5\324\305\332\333"
-  "\246\310\14\250\221\233\53\217\234\115\262\216\351\65\323\56\77\131\263\215\251\105\275\107\310\25\215\40\344\132\103\21"
-  "\352\261\35\111\250\307\0\61\4\302\234\3\256\251\114\330\236\127\371\252\245\263\327\345\43\161\265\211\344\120\63\206"
-  "\277\215\76\266\220\263\173\20\334\12\133\273\231\102\323\103\263\265\76\276\115\26\344\13\263\77\234\123\251\54\51\334"
-  "\351\142\337\325\330\62\121\26\361\355\371\14\360\324\62\45\51\57\65\242\210\350\354\316\122\344\213\222\264\45\222\102"
-  "\171\44\256\324\314\221\104\123\272\104\114\135\0\223\17\135\152\70\355\175\133\260\4\104\301\344\374\57\156\47\311\144"
-  "\374\103\350\216\300\276\151\211\61\270\222\25\157\352\120\353\125\222\321\67\44\64\303\330\204\324\334\162\204\330\106\334"
-  "\323\234\126\36\115\165\7\372\232\266\64\342\346\132\115\243\110\123\124\21\352\15\105\40\155\317\201\10\134\32\47\7"
-  "\232\151\132\360\310\121\16\216\144\266\100\124\11\377\25\326\215\112\254\231\24\144\34\235\314\252\345\300\174\176\102\220"
-  "\210\216\222\305\154\306\50\303\322\105\146\305\1\323\230\33\106\363\14\220\275\247\72\65\357\77\74\232\310\44\163\212"
-  "\7\271\51\111\17\167\312\347\37\242\134\134\112\340\112\15\206\33\50\237\211\220\247\337\167\172\362\246\345\230\374\364"
-  "\31\45\305\16\41\220\143\166\345\127\261\114\213\343\362\201\153\374\65\226\355\271\151\66\255\273\212\11\165\114\204\312"
-  "\3\344\107\343\213\32\27\154\34\330\170\122\116\32\142\335\15\5\0\2\104\42\327\210\376\235\246\0\322\173\66\45"
-  "\1\220\207\245\205\152\310\112\56\115\327\360\27\1\30\132\256\274\315\116\356\73\165\323\101\51\253\150\337\315\140\366"
-  "\102\10\220\252\271\310\337\177\140\103\160\310\203\51\30\350\70\375\320\156\204\200\2\55\115\300\221\224\253\174\64\203"
-  "\52\171\227\211\267\144\215\52\356\30\173\213\215\262\355\356\240\76\103\373\3\0\107\167\210\334\343\343\111\147\207\34"
-  "\12\152\153\112\356\162\245\123\263\104\227\34\17\20\51\275\12\230\154\321\240\142\16\203\31\311\215\156\54\330\305\306"
-  "\117\256\124\111\254\21\106\220\40\371\241\0\373\64\75\344\276\24\55\145\224\26\66\212\330\222\0\325\156\113\274\250"
-  "\323\226\42\142\323\50\175\4\367\217\202\333\66\172\177\256\200\36\144\27\266\233\33\107\365\23\12\364\226\142\307\322"
-  "\345\136\362\133\46\331\156\330\161\54\45\43\55\235\213\212\334\113\52\24\353\365\322\41\35\260\56\220\70\212\201\223"
-  "\347\17\337\122\306\126\17\25\203\257\307\364\213\70\144\230\72\15\255\62\40\246\26\366\203\165\260\161\107\5\226\256"
-  "\301\146\264\1\365\105\254\151\225\116\55\365\225\270\272\121\366\330\377\160\3\27\60\61\55\41\32\102\52\54\114\250"
-  "\113\154\236\243\147\144\233\33\277\204\353\173\242\240\237\276\27\12\374\165\172\241\221\305\122\72\56\25\122\250\225\221"
-  "\65\132\324\15\45\254\6\154\335\210\150\135\264\303\222\225\337\75\70\36\43\163\21\143\152\212\211\16\126\370\332\132"
-  "\7\152\301\313\212\261\145\324\310\166\213\101\265\205\11\331\101\172\261\220\117\327\277\222\237\5\260\315\177\345\206\4"
-  "\52\133\357\110\251\3\66\100\132\100\335\141\127\102\34\151\163\100\153\313\353\324\326\234\376\17\331\233\100\164\227\315"
-  "\71\42\201\307\326\355\301\345\350\216\142\264\153\376\173\305\350\10\165\243\42\67\266\164\114\357\370\302\161\166\125\326"
-  "\352\353\205\171\326\45\122\32\374\376\133\54\73\26\11\100\216\211\143\344\43\135\376\57\300\273\67\356\323\354\235\361"
-  "\144\212\213\21\61\20\7\50\122\44\215\343\321\162\200\232\65\25\325\223\201\371\233\33\354\357\113\205\65\136\332\253"
-  "\246\102\34\363\140\351\40\200\352\225\203\263\116\276\366\205\373\245\113\340\150\134\66\107\165\167\47\1\1\271\377\325"
-  "\161\271\233\0\225\257\232\30\136\122\266\343\342\102\30\317\20\46\141\34\150\61\340\345\313\266\271\311\154\47\211\165"
-  "\5\17\56\171\230\123\203\332\53\277\357\360\265\16\67\367\75\251\337\314\42\24\305\17\133\225\370\206\107\22\133\330"
-  "\160\335\67\273\10\330\135\227\55\201\55\342\11\156\264\201\242\362\33\152\256\270\330\127\241\234\214\251\43\73\76\267"
-  "\44\250\334\234\57\371\165\161\157\231\304\261\315\51\206\153\367\253\357\225\332\262\361\61\35\63\143\117\11\212\317\51"
-  "\337\61\277\137\33\122\203\26\253\232\310\105\75\202\330\265\70\262\236\341\353\222\135\341\307\310\356\75\350\232\271\45"
-  "\46\241\150\302\105\145\246\11\133\125\166\101\57\303\42\205\123\21\371\21\151\131\372\166\131\112\354\167\207\57\306\314"
-  "\232\51\175\101\207\60\300\2\71\63\53\273\273\34\12\132\317\355\42\231\353\354\323\40\170\210\35\45\377\274\165\163"
-  "\230\254\226\50\62\204\44\12\231\124\142\312\41\32\325\264\27\266\153\15\63\152\150\234\147\225\245\102\254\36\322\313"
-  "\275\107\23\336\62\374\311\117\4\264\160\154\42\321\102\302\257\135\316\371\105\301\172\15\170\361\230\122\246\333\231\271"
-  "\60\365\224\1\213\311\220\203\303\245\340\40\100\61\151\114\47\375\241\162\244\144\10\23\307\261\131\202\20\225\65\24"
-  "\212\304\163\163\374\171\145\202\307\270\26\326\221\213\305\220\307\105\250\221\335\370\71\161\21\122\376\210\42\61\263\245"
-  "\217\336\16\157\21\214\71\264\107\22\113\3\371\40\107\272\164\353\32\305\230\37\175\233\250\342\346\326\247\167\205\57"
-  "\110\214\235\336\345\315\372\2\247\171\234\371\305\73\117\265\36\42\15\215\237\42\113\102\350\21\154\242\267\120\104\12"
-  "\266\246\114\323\144\354\321\267\70\105\50\353\144\276\14\113\212\261\362\17\61\260\304\142\141\304\166\154\352\2\125\214"
-  "\166\64\44\157\146\104\116\32\220\43\203\225\104\5\175\67\163\300\46\372\74\317\350\143\66\124\135\366\321\10\267\310"
-  "\300\77\210\143\360\305\25\215\376\370\132\211\72\263\75\11\104\51\31\131\223\377\345\152\306\20\351\244\172\212\331\334"
-  "\56\66\377\346\233\232\156\204\146\311\257\260\14\10\2\64\356\51\73\241\143\377\300\217\350\165\345\247\363\170\110\325"
-  "\45\300\124\255\212\16\140\377\347\36\75\177\204\376\33\330\176\267\67\25\272\116\323\343\107\31\214\201\334\132\223\361"
-  "\206\45\204\272\25\311\255\213\212\10\145\122\65\110\171\45\342\225\222\115\34\223\51\144\103\243\62\346\66\213\225\17"
-  "\257\326\26\126\160\261\117\356\272\210\154\356\335\210\263\23\46\337\377\211\213\201\30\111\144\237\74\330\172\374\277\66"
-  "\144\213\260\224\62\100\143\114\105\155\66\343\50\152\51\74\224\65\125\161\376\203\370\10\260\143\136\342\217\372\0\102"
-  "\164\150\1\315\4\373\20\230\210\205\0\172\220\215\370\145\314\112\364\265\145\102\111\70\127\235\4\251\210\51\134\127"
-  "\61\117\134\51\234\276\100\323\273\363\330\345\42\237\237\137\173\316\310\222\246\160\45\260\61\256\374\54\171\336\360\273"
-  "\370\314\101\265\263\101\321\164\242\343\210\142\225\201\77\345\173\271\64\255\251\273\222\317\176\114\35\105\200\135\367\44"
-  "\134\247\313\42\245\231\241\263\4\222\303\43\366\52\224\313\340\102\276\36\47\16\246\103\266\60\140\250\162\266\174\223"
-  "\51\112\337\21\312\66\352\11\140\335\214\163\313\371\2\215\70\312\327\326\105\171\133\272\234\114\46\323\120\132\3\360"
-  "\254\13\1\156\117\202\206\151\75\210\145\325\331\47\101\365\53\213\140\6\273\245\45\35\241\5\300\305\264\120\146\221"
-  "\227\217\37\377\301\213\261\275\111\104\30\77\267\343\301\265\274\205\103\134\354\50\4\157\335\321\115\357\177\370\51\101"
-  "\114\25\157\156\271\213\157\164\142\324\171\242\316\107\326\373\24\44\175\160\146\242\330\367\101\17\27\101\375\342\116\66"
-  "\52\346\165\257\334\132\43\22\355\36\306\266\266\144\67\224\120\2\221\34\325\35\157\372\204\367\346\144\50\63\177\145"
-  "\120\54\13\25\73\150\322\326\217\131\171\123\266\74\56\103\3\113\112\345\147\144\36\222\42\211\0\15\113\63\153\234"
-  "\104\171\24\15\266\252\52\24\53\271\374\14\15\243\136\224\304\47\314\161\374\202\360\176\114\152\361\143\6\206\13\245"
-  "\52\16\213\322\327\2\132\145\120\4\137\217\320\227\341\351\35\327\271\262\232\345\134\17\250\243\201\254\4\124\14\15"
-  "\47\43\61\274\210\134\304\362\255\147\62\166\114\330\356\273\43\73\362\176\110\15\377\342\247\303\246\373\330\2\37\227"
-  "\276\334\304\103\42\347\374\126\156\22\130\33\305\312\313\6\336\101\371\301\343\14\232\123\324\346\356\43\20\35\350\4"
-  "\347\141\267\254\150\67\111\327\145\354\335\210\250\273\241\135\170\304\5\3\113\135\254\306\212\226\247\2\234\360\1\172"
-  "\277\120\261\71\234\17\130\274\36\125\25\352\260\336\260\235\200\154\331\301\11\177\210\314\347\366\214\305\224\45\277\160"
-  "\266\156\125\343\257\212\110\64\327\203\353\304\360\350\354\240\74\265\350\151\272\315\60\117\73\301\365\105\164\374\244\12"
-  "\120\376\57\135\114\145\363\10\166\151\354\37\372\202\232\145\11\25\147\73\21\350\33\157\256\351\160\143\211\320\37\223"
-  "\20\17\276\306\262\50\73\151\12\62\271\37\255\55\234\102\312\360\156\114\212\63\353\12\333\212\54\43\20\351\317\20"
-  "\355\40\317\236\217\11\261\370\263\211\243\362\113\114\345\241\323\203\212\56\224\202\20\365\46\243\317\33\256\276\21\246"
-  "\352\262\256\34\350\235\24\42\164\43\347\64\267\132\147\225\123\237\122\124\34\315\35\323\105\227\172\250\107\45\225\360"
-  "\365\361\74\1\50\250\32\327\202\217\34\341\150\200\216\315\122\74\44\257\33\242\172\17\25\75\16\222\300\342\352\156"
-  "\314\250\275\166\43\307\256\244\302\353\114\370\254\246\314\223\212\334\145\124\375\222\153\103\201\372\317\127\346\230\322\251"
-  "\30\10\320\275\143\120\42\117\1\217\76\101\365\224\225\2\103\272\21\104\104\160\276\262\261\310\72\126\113\341\224\300"
-  "\42\242\267\362\253\366\26\356\272\261\5\246\172\116\123\323\153\46\123\325\211\200\32\63\41\271\324\252\312\132\77\13"
-  "\355\65\42\127\273\131\225\217\351\32\335\233\321\102\100\202\307\204\75\236\243\47\253\31\117\300\1\66\150\250\321\161"
-  "\121\375\54\2\307\65\156\31\21\51\236\105\77\172\313\72\137\64\255\151\255\337\113\167\224\55\300\205\75\10\310\116"
-  "\110\70\12\60\70\7\250\21\124\124\113\302\5\253\25\173\172\360\221\243\47\377\262\64\224\73\314\366\13\371\164\114"
-  "\223\31\276\215\246\134\307\50\123\300\365\310\22\45\22\361\121\74\163\21\344\224\235\317\313\202\2\356\103\364\211\344"
-  "\31\72\17\335\116\255\357\64\70\221\304\320\224\16\306\144\364\40\252\306\153\242\171\346\32\114\205\203\112\120\55\1"
-  "\154\242\100\221\126\105\320\44\345\61\17\21\52\110\154\342\251\42\167\273\323\243\101\336\224\45\361\342\302\225\313\242"
-  "\171\22\100\252\50\0\256\325\26\234\165\360\132\101\121\125\31\225\240\220\232\12\37\50\151\77\70\67\204\137\42\245"
-  "\30\40\362\7\52\262\6\271\341\355\137\337\121\271\244\200\221\372\27\320\156\244\124\314\350\105\165\252\334\175\24\202"
-  "\201\62\173\266\13\237\260\341\264\120\267\12\52\21\151\42\354\25\154\126\213\112\362\210\127\352\333\334\324\165\220\264"
-  "\34\63\167\377\154\371\64\30\345\323\332\163\161\60\13\136\244\275\46\111\55\305\52\176\164\34\35\117\153\113\167\44"
-  "\367\212\75\222\374\130\107\371\174\274\217\152\46\45\117\320\103\124\370\124\152\261\124\364\110\145\27\263\54\26\162\66"
-  "\365\306\114\202\52\34\343\114\2\25\67\146\22\260\343\70\223\210\353\171\234\113\272\326\324\156\156\273\156\340\6\42"
-  "\205\103\166\346\206\204\167\172\300\71\355\166\142\10\227\146\10\267\41\103\70\141\10\267\206\41\364\312\257\252\226\360"
-  "\172\243\142\10\147\74\101\172\110\275\223\61\116\220\317\124\217\234\132\372\223\326\251\145\210\253\254\200\33\206\353\254"
-  "\144\231\124\56\41\363\57\243\6\344\310\354\116\147\120\313\125\15\162\16\304\340\224\56\123\331\113\316\221\67\216\77"
-  "\102\27\356\61\147\7\307\207\0\356\350\260\233\236\33\347\312\266\333\103\207\146\266\267\112\164\175\224\375\305\137\144"
-  "\57\362\354\267\274\250\276\245\143\176\272\254\114\127\62\344\337\242\211\244\1\4\46\141\0\377\331\332\131\350\66\0"
-  "\303\100\364\173\312\14\237\63\346\211\246\342\327\157\236\225\123\144\225\162\147\321\320\117\266\303\247\64\236\23\0\174"
-  "\370\232\46\74\75\127\61\254\31\0\56\17\112\14\333\220\53\0\324\356\244\63\341\35\323\355\247\214\175\174\215\35"
-  "\31\241\141\242\275\211\340\102\357\304\226\235\317\351\313\223\144\154\277\27\222\200\333\160\42\303\147\115\15\241\107\42"
-  "\266\246\127\376\341\135\120\247\52\224\11\22\174\300\163\116\122\46\352\317\26\321\361\200\302\23\260\106\323\123\116\71"
-  "\213\322\251\100\317\346\42\70\365\374\71\335\270\27\36\101\117\161\60\313\265\215\0\302\105\32\201\201\127\314\171\104"
-  "\271\332\313\117\46\376\64\36\72\256\275\42\264\273\377\171\367\175\360\327\375\341\117\127\273\154\76\233\242\131\31\363"
-  "\345\34\341\63\346\153\304\336\154\275\21\143\337\210\301\157\304\350\67\132\370\46\56\165\133\175\367\355\166\265\341\355"
-  "\333\41\357\237\62\76\321\373\374\337\157\344\270\332\341\36\61\54\154\76\373\136\124\36\171\325\110\276\35\365\54\57"
-  "\105\232\227\321\107\272\64\224\55\236\336\167\71\326\251\155\156\171\30\4\251\113\242\172\265\52\46\160\140\75\156\277"
-  "\104\5\377\4\120\355\242\322\272\0\242\75\46\142\210\145\135\340\323\205\35\167\277\56\371\234\306\103\27\231\152\260"
-  "\160\311\5\255\52\43\303\335\30\272\171\261\347\167\266\335\334\365\371\151\54\263\36\13\153\41\373\145\325\102\321\266"
-  "\32\11\135\45\51\143\230\206\145\322\67\162\57\263\274\270\251\167\340\271\12\63\41\312\323\65\343\106\103\322\102\232"
-  "\266\216\206\143\125\277\176\356\226\366\357\364\11\3\253\15\132\42\11\373\376\224\356\51\236\45\304\320\110\103\173\215"
-  "\60\354\3\105\156\134\173\143\165\255\244\314\30\171\223\344\262\266\350\331\0\274\105\303\265\377\73\143\36\25\334\165"
-  "\253\171\324\157\33\355\243\172\333\156\16\355\226\42\104\345\166\112\4\0\341\226\112\101\224\155\33\255\57\210\266\223"
-  "\45\311\162\363\31\351\112\224\266\132\10\20\154\351\134\276\74\11\246\366\153\262\43\234\326\152\11\202\175\53\1\252"
-  "\40\226\134\20\174\13\102\244\145\3\320\346\42\10\264\44\341\264\74\113\60\242\70\113\63\330\70\202\60\113\330\327"
-  "\262\54\141\176\344\207\360\111\111\226\234\221\32\24\131\202\130\40\153\215\262\51\234\161\63\7\152\54\335\123\240\305"
-  "\162\200\33\224\130\230\377\2";
-
-/* lib/include/wasm.h (DEFLATEd, org. size 22452) */
-static unsigned char file_l_36[2302] =
-  "\234\221\305\162\305\60\14\105\327\245\177\120\331\111\231\231\231\271\135\146\34\366\3\73\143\271\364\367\125\112\52\303\133"
-  "\11\257\316\334\321\220\17\373\373\227\7\275\10\267\22\353\1\252\172\74\62\72\75\230\17\240\273\257\45\120\227\221"
-  "\65\10\251\261\20\112\124\21\134\255\234\35\200\51\22\53\235\261\10\376\120\133\163\133\163\147\141\145\126\227\140\164"
-  "\224\120\245\164\124\273\216\23\230\107\27\53\355\6\363\305\162\211\110\124\214\215\6\356\11\245\50\215\214\106\47\42"
-  "\17\202\340\164\343\344\142\347\164\43\130\73\72\74\73\137\71\74\247\356\34\235\247\163\161\222\52\235\174\41\22\342"
-  "\371\240\360\75\341\171\64\27\64\37\174\234\103\124\266\230\73\71\376\312\245\364\237\134\26\61\267\74\310\134\232\177"
-  "\301\115\153\106\276\161\234\376\323\61\213\230\374\172\222\331\264\361\35\233\135\247\15\270\146\21\263\77\370\116\77\372"
-  "\376\356\323\44\215\305\323\346\215\121\61\370\305\27\100\336\54\76\174\227\225\76\77\272\334\4\223\246\230\270\205\141"
-  "\220\65\225\351\205\207\116\316\106\247\122\57\11\342\257\243\311\146\23\147\47\346\276\215\101\75\262\46\10\12\364\314"
-  "\235\171\372\155\304\275\345\377\66\234\252\46\237\216\123\105\377\254\333\207\363\1\372\363\326\275\273\237\73\245\200\22"
-  "\24\370\254\3\205\53\67\51\116\240\210\135\240\246\1\345\173\370\344\3\311\213\222\107\354\11\225\4\211\240\17\366"
-  "\110\110\46\373\375\161\242\40\220\352\35\162\172\230\256\121\356\276\243\330\77\130\114\142\201\24\54\246\301\130\204\141"
-  "\271\334\335\163\30\150\345\144\134\33\243\371\101\242\21\161\240\105\70\12\217\105\36\66\236\371\47\5\251\76\242\225"
-  "\256\1\213\311\54\220\42\30\16\303\273\46\346\42\165\15\264\162\62\274\153\142\64\42\16\264\172\70\7\273\346\77"
-  "\77\70\16\264\162\72\256\215\351\374\344\351\50\70\320\52\351\200\307\252\74\213\7\267\220\151\36\306\162\363\5\361"
-  "\257\313\355\250\331\342\201\336\225\215\23\175\372\26\232\117\216\213\33\203\374\123\35\151\126\177\4\132\362\217\100\376"
-  "\315\10\4\75\1\132\334\110\150\23\350\264\13\364\22\22\302\344\36\220\340\250\40\301\217\151\134\116\11\163\363\26"
-  "\324\116\116\160\20\50\44\365\222\116\12\275\161\312\66\323\51\327\115\247\170\143\244\114\167\367\62\24\34\31\52\327"
-  "\307\73\22\355\362\123\266\315\117\172\237\253\121\201\11\121\151\120\160\310\124\307\243\362\133\240\212\5\107\6\313\365"
-  "\265\21\270\263\130\53\37\177\157\52\15\5\121\163\265\104\13\135\344\242\133\127\335\356\127\102\41\64\361\143\250\11"
-  "\271\313\36\267\253\272\77\226\277\135\15\273\0\175\321\0\40\117\1\364\205\1\164\263\6\0\171\12\240\233\37\246"
-  "\32\202\255\327\264\157\14\126\205\260\135\10\273\120\330\26\206\261\44\332\134\22\155\62\211\126\110\242\315\46\321\246"
-  "\223\150\205\44\72\255\51\41\117\366\104\21\172\242\144\173\242\244\173\242\10\75\241\45\1\171\262\47\204\44\132\65"
-  "\11\30\322\75\301\222\270\377\271\336\223\331\24\261\165\117\16\363\102\270\47\207\112\50\204\151\351\161\277\46\176\334"
-  "\120\325\375\261\74\373\121\373\242\1\100\236\2\350\13\3\350\146\15\0\362\24\0\275\47\257\327\264\157\14\126\205"
-  "\260\135\10\273\120\330\26\6\355\272\66\227\104\233\114\242\25\222\150\263\111\264\351\44\132\41\211\116\153\112\310\223"
-  "\75\121\204\236\50\331\236\50\351\236\50\102\117\150\111\100\236\354\11\41\211\66\233\104\233\115\202\336\223\137\326\345"
-  "\50\366\315\56\305\77\42\10\54\21\4\127\331\334\110\227\17\6\322\27\31\4\226\74\110\137\30\110\67\313\40\260"
-  "\344\101\272\231\201\264\171\220\366\0\110\113\101\272\242\203\300\222\117\244\320\104\22\40\260\344\23\251\203\254\13\6"
-  "\34\354\174\201\354\15\137\130\42\10\256\262\171\322\123\76\30\110\137\144\20\130\362\40\75\115\244\233\145\20\130\362"
-  "\40\335\314\100\332\74\110\173\0\244\245\40\135\321\101\140\311\47\122\150\42\171\220\66\17\162\65\152\166\136\62\350"
-  "\152\247\62\20\361\123\31\27\125\117\145\236\146\245\322\254\124\232\353\225\336\207\367\247\176\46\305\240\243\365\126\135"
-  "\265\144\363\374\254\355\51\241\317\155\52\335\300\266\265\223\75\152\14\320\347\30\334\300\30\336\254\323\30\240\317\61"
-  "\270\201\61\74\277\376\322\30\240\317\61\270\41\254\46\343\323\140\127\145\366\370\127\40\106\167\371\140\61\226\310\130"
-  "\336\304\104\240\117\45\342\6\41\21\127\311\211\300\41\47\2\26\236\110\323\253\343\25\372\124\42\156\140\14\303\50"
-  "\41\100\236\43\30\106\6\160\116\22\234\263\10\147\316\60\375\267\323\30\240\317\61\270\201\63\210\71\100\237\145\30"
-  "\205\341\341\52\171\170\300\241\17\17\260\360\33\306\60\313\37\13\14\251\114\26\207\200\61\146\61\306\64\106\350\321"
-  "\360\102\144\307\117\111\261\106\132\225\233\247\244\141\215\24\52\315\112\245\131\251\64\327\53\141\215\124\51\6\35\255"
-  "\267\352\252\45\175\11\223\72\343\301\32\11\245\253\207\74\156\140\37\345\144\217\32\3\364\71\6\67\60\206\67\353"
-  "\64\6\350\163\14\156\140\14\276\154\320\30\240\117\61\354\256\221\200\141\353\145\63\147\156\127\40\253\272\166\352\6"
-  "\26\143\211\214\345\115\114\4\372\124\42\156\20\22\161\225\234\10\34\162\42\140\341\211\64\275\72\136\241\117\45\342"
-  "\6\306\60\214\22\2\344\71\202\141\144\0\347\44\301\71\213\160\346\14\276\204\321\30\240\317\61\270\201\63\210\71"
-  "\100\237\145\30\205\341\341\52\171\170\300\241\17\17\260\360\33\306\60\253\37\13\14\271\114\26\207\200\61\146\61\306"
-  "\64\6\172\164\367\265\375\346\161\272\251\276\360\7\131\23\136\331\337\70\363\165\241\27\255\125\354\113\133\257\10\231"
-  "\124\321\205\244\342\123\171\355\110\111\350\244\232\213\222\24\365\157\15\43\253\12\241\124\366\123\112\352\316\243\365\117"
-  "\254\56\204\122\335\117\51\375\130\233\261\114\63\257\14\251\124\373\113\114\252\117\37\43\53\15\235\124\327\225\254\250"
-  "\257\134\323\317\121\260\74\6\2\177\224\202\105\162\65\4\173\324\171\340\71\302\343\66\316\363\146\235\316\3\317\21"
-  "\36\267\161\36\137\121\352\74\360\34\341\161\233\220\317\153\257\363\300\163\204\307\155\2\117\163\326\171\340\71\302\343"
-  "\66\316\363\64\274\377\231\136\333\164\110\60\36\40\373\362\206\270\302\357\231\141\352\334\333\213\103\326\204\337\61\213"
-  "\17\176\342\324\31\52\366\245\255\127\204\114\252\350\102\122\21\123\347\156\111\350\244\232\213\222\24\305\324\131\251\12"
-  "\241\124\366\123\112\352\142\352\254\324\205\120\252\373\51\45\165\61\165\222\312\220\112\265\277\304\244\272\117\164\254\64"
-  "\164\122\135\127\222\242\230\72\365\207\251\230\72\201\240\74\117\165\33\35\313\230\72\45\36\170\16\360\270\215\362\140"
-  "\352\224\170\340\71\300\343\66\312\203\251\123\342\201\347\0\217\333\50\17\246\116\211\7\236\3\74\156\23\170\232\263"
-  "\316\3\317\21\36\267\121\36\314\200\111\50\30\363\144\230\72\311\3\202\337\143\363\276\154\152\367\316\261\243\222\274"
-  "\311\354\323\366\377\225\265\347\375\353\175\173\131\41\324\266\12\121\174\125\34\146\224\277\210\37\60\207\307\307\105\31"
-  "\4\213\10\246\62\230\222\202\247\212\176\140\51\304\217\0\146\20\134\304\142\12\34\301\42\202\251\14\126\175\256\121"
-  "\316\163\351\237\37\334\122\171\345\44\152\303\43\225\325\213\143\27\150\143\10\40\60\134\325\374\252\126\101\10\342\46"
-  "\34\212\125\40\110\12\372\210\200\70\246\0\63\20\56\142\22\203\216\140\21\301\124\6\226\2\157\307\50\216\51\254"
-  "\346\110\340\142\61\5\216\140\21\301\124\6\143\7\145\103\377\253\214\63\31\24\121\34\116\124\60\56\260\257\202\34"
-  "\131\20\16\66\64\242\72\202\130\215\104\115\204\314\126\121\34\100\60\145\201\3\162\75\21\277\264\311\40\266\11\142"
-  "\125\22\226\310\163\171\33\346\302\72\65\252\43\10\374\40\201\236\154\40\304\126\215\142\140\154\336\302\135\36\133\225"
-  "\162\360\126\215\352\10\142\125\22\23\110\170\253\106\161\0\101\253\202\3\162\61\21\336\252\121\35\101\254\112\302\22"
-  "\171\37\207\265\233\310\334\22\345\21\5\27\0\313\67\103\165\301\65\26\377\126\31\337\307\62\123\226\150\121\227\240"
-  "\127\226\352\204\67\102\313\107\162\264\210\223\337\225\205\334\130\240\26\47\40\30\344\111\350\312\102\372\7\152\161\124"
-  "\301\40\217\254\53\113\265\217\326\125\335\151\57\231\50\344\277\223\277\12\37\46\241\356\335\75\55\14\245\126\331\225"
-  "\136\232\257\322\117\173\321\107\41\175\345\351\113\250\324\165\74\132\30\112\261\262\370\43\173\77\263\322\120\212\245\61"
-  "\235\125\167\206\123\43\337\246\140\20\157\122\60\150\173\145\35\307\266\161\54\303\143\152\72\372\336\31\6\155\377\14"
-  "\203\236\16\307\211\6\244\43\363\360\75\224\336\73\301\240\355\50\141\340\373\51\35\47\32\220\216\314\303\323\321\173"
-  "\47\30\264\235\46\14\102\72\72\116\64\350\273\316\330\73\161\154\275\371\232\177\374\363\60\275\376\55\67\241\376\325"
-  "\377\157\376\205\324\125\360\357\105\260\174\253\122\243\35\207\337\173\263\130\20\126\46\61\24\135\204\310\32\177\331\347"
-  "\162\245\227\327\256\373\372\313\76\317\170\27\372\27\276\354\267\61\140\166\233\313\373\375\277\324\264\174\21\311\26\357"
-  "\355\305\274\313\267\34\332\202\157\375\142\242\164\260\272\151\332\246\3\144\140\133\234\267\27\253\263\375\17";
-
-/* lib/include/wasm_simd128.h (DEFLATEd, org. size 44179) */
-static unsigned char file_l_37[4173] =
-  "\244\324\305\222\334\60\20\6\340\163\350\35\72\154\171\231\231\231\171\367\250\32\266\252\144\50\301\320\323\307\30\352\112"
-  "\324\263\163\62\375\177\373\63\316\370\160\171\371\174\65\245\315\100\266\340\145\357\341\12\36\316\256\16\347\346\127\301"
-  "\237\371\360\366\303\333\317\211\252\165\302\32\304\121\243\225\155\247\205\156\172\224\33\20\32\352\126\110\63\45\242\74"
-  "\373\131\104\15\151\233\55\330\324\246\51\42\63\35\154\377\131\350\325\164\310\363\165\31\327\232\136\43\216\264\201\156"
-  "\54\232\340\47\154\243\230\321\154\265\105\324\372\73\232\60\360\274\142\212\347\263\337\232\76\143\151\62\77\64\235\45"
-  "\41\156\267\165\313\154\315\102\115\212\116\264\65\267\314\322\62\373\237\143\225\353\104\326\214\233\203\32\124\125\125\100"
-  "\70\247\155\156\231\214\103\25\252\256\152\40\336\274\223\267\60\117\346\241\12\225\127\65\20\157\321\311\133\136\44\363"
-  "\120\205\312\253\32\210\267\372\57\236\230\133\356\227\357\121\177\325\101\103\161\52\53\13\163\115\176\341\354\150\46\373"
-  "\172\223\45\233\304\302\174\177\261\174\245\373\213\16\24\316\223\124\125\232\153\362\313\157\107\144\331\161\130\226\314\22"
-  "\313\213\375\371\362\13\353\317\273\130\50\117\142\125\151\256\311\337\242\35\221\145\307\141\131\12\13\375\216\206\55\25"
-  "\43\330\324\24\144\207\65\310\132\112\233\205\70\222\203\35\314\105\163\376\2\213\310\244\107\14\302\346\141\244\205\131"
-  "\302\57\155\54\57\232\343\366\126\141\354\135\45\170\127\171\6\372\223\73\131\105\273\223\220\236\20\4\3\316\357\217"
-  "\356\236\316\356\217\370\301\315\365\303\343\336\365\243\47\176\260\153\135\333\225\333\60\360\71\355\37\374\226\136\124\126"
-  "\166\352\217\244\336\306\364\236\111\317\277\207\320\322\314\304\40\104\102\146\172\366\254\316\155\340\140\6\105\24\151\352"
-  "\362\320\270\21\113\100\314\52\271\165\305\202\362\150\165\47\212\100\53\142\165\116\356\257\211\201\167\210\242\341\352\216"
-  "\321\246\152\32\373\252\42\340\335\252\150\270\352\225\66\125\313\334\127\25\1\357\126\105\303\125\107\51\125\2\102\256"
-  "\277\376\346\363\257\56\117\335\325\161\320\124\331\136\20\17\302\120\306\11\77\213\331\152\135\174\202\26\200\55\112\251"
-  "\35\73\5\230\41\165\200\153\2\352\315\155\353\30\226\316\102\10\323\257\304\352\350\46\51\323\330\131\12\141\372\245"
-  "\130\155\334\44\145\231\73\113\41\114\277\224\266\336\325\17\150\67\337\307\174\256\267\6\231\146\345\373\323\113\317\135"
-  "\275\360\302\13\321\175\372\74\74\50\112\311\166\142\240\125\61\164\264\25\263\170\215\361\232\342\65\307\353\101\274\226"
-  "\170\135\307\353\46\136\57\213\315\152\50\226\203\230\16\142\73\210\261\220\170\353\211\107\257\142\104\276\376\360\323\363"
-  "\153\17\311\75\167\65\54\157\74\375\123\17\370\137\212\17\212\244\1\167\343\203\173\6\10\177\150\200\320\77\102\366"
-  "\272\61\27\320\260\160\204\362\27\327\225\0\135\333\153\314\226\370\250\322\30\26\121\176\123\25\136\116\72\371\205\322"
-  "\204\373\211\302\116\121\360\250\262\27\256\71\121\323\230\104\345\367\3\275\37\351\375\124\221\71\231\313\336\242\114\225"
-  "\253\151\24\125\263\122\125\316\15\341\202\145\200\165\200\205\340\176\112\320\250\4\16\51\264\326\315\11\131\346\244\44"
-  "\277\37\14\272\202\154\57\236\231\251\212\365\62\13\301\61\23\54\307\230\160\300\314\260\233\32\52\324\320\312\55\120"
-  "\66\102\174\146\375\255\0\350\323\360\273\117\43\175\332\131\3\241\261\6\304\217\257\10\202\4\206\365\54\63\351\251"
-  "\104\273\374\365\120\124\140\46\200\230\353\14\324\236\31\322\266\344\355\104\130\46\244\370\24\61\342\340\247\364\163\103"
-  "\244\321\376\277\274\327\243\74\301\117\27\66\135\364\244\313\223\36\5\167\130\134\164\31\204\350\252\111\325\23\105\205"
-  "\210\35\274\140\363\202\217\227\236\325\50\134\323\350\242\305\40\52\134\324\371\265\20\51\24\354\340\2\233\13\114\56"
-  "\366\334\302\141\131\146\37\25\2\41\52\172\252\61\3\242\306\143\7\13\330\54\320\302\42\250\200\322\154\320\116\43"
-  "\330\171\11\166\136\354\333\75\223\161\307\104\301\20\31\63\46\352\16\236\13\303\334\255\141\273\203\332\223\315\253\320"
-  "\325\354\205\325\354\351\150\147\336\205\251\12\114\227\260\135\242\301\147\202\46\366\227\357\277\371\352\160\372\46\255\325"
-  "\323\326\224\153\211\156\140\11\210\20\134\135\12\301\204\316\374\170\300\273\137\107\173\242\12\346\212\216\134\141\163\105"
-  "\63\131\44\262\146\365\174\165\211\261\77\135\212\134\363\336\301\261\235\265\102\25\326\2\165\244\52\310\274\157\75\60"
-  "\177\36\273\262\227\261\146\61\126\4\300\257\0\116\5\330\45\201\147\170\176\100\260\132\230\14\165\13\17\113\366\57"
-  "\166\225\36\46\50\154\72\205\355\24\55\136\223\15\51\350\325\306\32\213\332\170\130\70\101\314\260\322\307\304\26\35"
-  "\331\302\146\213\106\272\225\116\26\353\132\47\47\165\107\147\224\35\215\240\113\302\321\313\15\22\260\103\3\234\32\340"
-  "\25\241\237\142\371\371\325\352\146\62\74\154\374\221\164\265\253\164\63\101\141\323\51\154\247\150\361\232\154\110\101\257"
-  "\156\326\130\324\315\323\310\31\142\206\74\102\365\62\161\105\107\256\260\271\302\111\326\256\240\112\47\47\155\107\147\204"
-  "\35\135\240\313\301\321\311\15\22\260\103\3\234\32\340\25\241\27\136\274\344\262\72\231\14\165\47\57\163\366\57\166"
-  "\225\116\46\50\154\72\205\355\24\55\136\223\15\51\350\325\311\32\213\72\171\231\71\103\314\160\263\223\211\53\72\162"
-  "\205\315\25\116\262\166\5\125\72\71\151\73\72\43\354\350\2\135\16\216\116\156\220\200\35\32\340\324\200\175\42\150"
-  "\301\317\213\164\173\202\14\346\4\231\107\46\16\241\74\103\146\53\302\353\124\255\301\234\167\62\67\125\256\301\61\361"
-  "\204\372\135\233\344\35\235\304\35\311\56\105\332\221\155\272\63\12\222\165\23\45\123\43\333\124\161\241\174\27\315\126"
-  "\204\327\53\333\346\275\51\163\323\331\166\334\234\102\275\263\111\236\47\333\316\326\56\106\332\312\266\271\207\361\351\341"
-  "\343\313\326\261\7\115\224\7\366\374\233\275\261\5\322\363\207\377\35\171\361\122\223\113\232\236\273\172\230\260\131\336"
-  "\115\153\22\345\335\232\316\121\336\255\331\35\344\335\232\354\227\342\73\111\375\313\361\125\140\343\77\251\206\233\370\121"
-  "\52\343\72\276\56\122\51\361\125\52\106\34\10\276\300\13\272\200\13\266\100\13\262\0\13\356\113\326\176\126\252\311"
-  "\355\103\52\326\236\125\377\162\66\366\303\172\376\360\277\43\67\336\337\277\234\151\373\110\152\162\363\104\221\256\146\36"
-  "\331\166\266\306\330\256\352\370\103\167\107\12\57\145\265\157\16\220\43\151\37\201\262\262\200\135\131\200\226\332\361\7"
-  "\166\324\37\257\177\26\170\373\105\42\351\74\262\245\323\302\140\306\31\26\153\307\307\371\275\102\113\261\361\126\140\246"
-  "\353\75\350\145\350\107\223\176\150\235\316\357\65\232\127\77\55\330\205\256\165\72\314\134\345\223\306\254\315\330\3\120"
-  "\173\121\265\254\144\7\366\321\60\143\345\156\363\202\301\13\355\274\102\116\356\336\143\141\306\22\264\136\61\172\241\352"
-  "\375\136\243\355\252\230\220\203\274\161\224\254\250\163\63\73\301\310\116\260\263\143\255\267\56\137\322\162\61\275\73\376"
-  "\312\231\35\150\6\24\304\100\24\375\324\52\142\140\55\325\67\377\137\101\120\372\114\157\0\10\216\301\145\355\353\53"
-  "\253\317\77\137\137\200\177\374\137\177\315\223\357\25\160\13\1\156\41\300\255\10\70\17\0\364\71\2\234\347\343\73"
-  "\374\173\3\202\227\4\307\25\304\126\20\43\50\254\300\10\136\22\362\12\247\320\12\247\20\341\124\134\1\20\274\44"
-  "\344\25\304\126\20\43\50\257\0\10\136\21\176\257\360\362\336\1\155\354\163\320\306\76\17\155\354\23\320\306\71\47"
-  "\200\133\11\0\332\70\347\4\220\332\310\10\136\22\34\127\20\133\101\214\220\332\310\10\136\22\342\12\240\215\163\16"
-  "\10\261\215\214\340\45\41\257\40\266\202\20\41\266\221\21\274\40\204\66\316\3\22\264\261\317\101\33\373\74\264\261"
-  "\117\100\33\347\234\0\156\45\0\150\343\234\3\100\154\43\43\170\111\160\134\101\154\5\41\102\154\43\43\170\111\210"
-  "\53\200\66\316\71\40\304\66\62\202\227\204\274\202\330\12\102\204\330\106\106\360\206\220\333\330\17\160\320\306\76\7"
-  "\155\354\363\320\306\76\1\155\234\163\2\270\225\0\240\215\163\116\0\335\306\110\20\43\210\21\364\37\302\371\141\345"
-  "\214\222\133\65\202\50\272\236\254\112\205\155\160\124\301\302\1\332\121\262\372\114\143\373\246\62\117\314\321\105\376\313"
-  "\307\151\365\171\15\124\337\51\160\234\313\220\270\67\205\376\236\51\170\12\257\226\102\365\110\336\220\30\274\254\60\170"
-  "\131\141\340\254\60\130\131\101\270\41\0\131\141\260\26\265\160\113\140\134\101\300\330\221\302\35\201\127\20\60\326\223"
-  "\160\157\2\160\11\214\315\40\334\233\100\337\176\16\274\275\40\374\116\5\336\13\203\267\27\204\33\2\360\34\170\173"
-  "\101\270\41\0\317\201\267\25\204\33\2\360\34\170\73\101\270\41\0\317\201\267\21\204\73\2\360\34\154\377\175\231"
-  "\126\51\334\152\54\250\253\273\126\377\227\235\302\350\253\270\133\215\272\313\13\376\133\53\234\377\255\352\136\360\172\330"
-  "\265\300\64\33\375\223\66\332\117\63\165\277\172\355\257\136\377\53\12\344\100\363\62\242\103\135\341\150\174\126\124\46"
-  "\117\323\64\376\357\127\377\76\255\163\364\174\327\211\354\262\175\376\314\315\33\357\33\153\336\175\117\347\165\351\307\376"
-  "\371\326\0\364\137\157\335\362\307\236\215\176\41\7\222\65\11\67\306\162\153\74\372\211\242\252\337\150\276\20\354\236"
-  "\226\346\234\104\351\361\334\375\353\325\2\225\266\315\167\177\257\334\53\51\356\125\240\354\125\337\1\362\35\107\276\5"
-  "\204\266\356\1\165\374\346\366\377\130\151\343\362\52\346\320\271\263\310\156\367\117\220\324\374\13\155\217\367\175\172\177"
-  "\276\254\324\130\40\17\371\223\153\67\135\176\37\325\121\37\200\354\35\72\124\161\55\367\56\376\355\217\74\112\305\157"
-  "\133\111\323\143\266\75\146\333\143\76\55\15\223\260\115\342\1\223\300\231\164\57\274\20\53\336\172\257\126\170\174\271"
-  "\130\230\323\322\255\216\207\152\114\227\254\341\167\215\246\121\74\154\24\70\243\45\236\320\246\346\35\223\302\337\343\340"
-  "\136\47\325\230\56\174\235\16\30\305\303\106\174\235\336\316\27\264\251\171\307\244\360\74\27\303\42\16\133\4\317\242"
-  "\273\242\105\315\73\26\205\347\131\30\26\161\330\42\320\242\373\170\345\350\135\27\130\36\131\160\317\67\14\20\347\104"
-  "\101\234\113\250\31\347\22\340\70\47\212\172\355\305\71\371\122\234\23\112\161\116\35\71\316\155\34\306\71\221\34\347"
-  "\324\34\343\134\102\106\262\122\205\223\254\262\202\222\125\62\126\236\121\205\355\1\311\312\66\211\7\114\202\146\342\44"
-  "\53\361\316\133\171\110\126\311\130\71\246\252\161\135\170\143\37\60\212\207\215\202\146\144\44\53\361\226\111\341\311\301"
-  "\312\61\125\215\353\302\327\311\67\252\152\176\172\72\157\61\242\107\305\133\16\205\47\7\43\121\211\367\34\50\327\231"
-  "\26\161\324\202\237\30\43\121\211\367\54\50\327\231\26\161\330\42\310\302\312\165\52\260\74\224\353\340\373\53\310\165"
-  "\242\40\327\45\324\314\165\11\140\256\23\205\275\366\162\235\174\61\327\11\205\134\247\216\234\353\66\216\163\235\110\316"
-  "\165\152\116\271\56\41\43\327\251\302\311\165\131\101\271\56\31\53\115\251\302\366\200\134\147\233\304\3\46\101\63\61"
-  "\162\235\170\353\213\42\310\165\311\30\231\105\274\345\120\170\162\60\266\262\170\313\241\360\344\140\354\103\361\216\3\157"
-  "\145\323\42\16\133\4\315\302\330\207\342\35\13\336\312\246\105\34\266\340\131\274\114\353\147\366\260\46\242\52\313\110"
-  "\125\247\205\77\4\204\45\55\12\226\164\102\315\45\235\0\56\151\121\334\153\147\111\313\227\226\264\120\132\322\352\310"
-  "\113\172\343\160\111\213\344\45\255\346\270\244\23\162\226\264\52\214\45\235\25\264\244\223\261\126\243\52\74\17\136\322"
-  "\266\111\74\140\22\64\23\143\111\213\167\76\163\244\45\235\214\261\244\305\133\16\205\47\7\143\111\213\267\34\12\17"
-  "\137\173\302\311\104\24\236\114\6\72\231\14\160\62\251\50\356\125\240\166\257\345\317\171\205\146\302\260\133\122\355\166"
-  "\317\375\171\204\166\302\260\135\122\355\166\303\70\115\63\364\23\307\15\67\254\335\161\235\343\362\14\35\305\161\307\15"
-  "\243\273\245\233\373\205\57\242\110\356\372\5\66\372\132\207\10\361\306\307\247\164\210\30\314\103\204\170\313\241\360\340"
-  "\340\34\42\304\133\16\205\107\207\227\363\207\343\220\274\345\120\170\160\160\216\20\342\55\207\302\203\203\23\335\305\133"
-  "\16\205\107\207\167\143\20\52\260\54\262\200\65\214\131\250\300\322\310\2\376\76\34\66\247\50\330\234\164\134\30\340"
-  "\270\120\121\334\253\100\355\136\274\71\205\161\267\244\332\355\170\163\12\343\166\111\65\333\301\346\254\70\154\10\233\63"
-  "\21\330\234\25\207\35\141\163\46\302\233\263\46\271\53\155\116\63\331\213\267\76\127\207\315\151\46\173\361\226\3\154"
-  "\116\63\331\213\267\34\12\117\16\306\346\24\157\71\24\236\34\214\315\51\336\162\50\74\71\30\233\123\274\345\120\170"
-  "\162\260\66\247\12\54\213\54\140\15\143\26\52\60\65\140\163\236\377\73\43\344\353\350\317\15\315\57\161\352\12\176"
-  "\163\125\25\234\166\367\153\330\106\361\63\106\1\7\312\351\362\321\317\353\351\214\76\267\170\76\142\12\327\164\330\45"
-  "\114\227\70\342\22\20\27\276\340\161\372\13\146\323\252\341\40\121\227\150\106\354\5\163\152\325\370\136\232\27\77\153"
-  "\133\317\177\372\171\332\125\203\62\274\307\353\252\145\253\203\107\317\25\214\37\24\214\206\240\316\224\375\333\264\366\154"
-  "\327\256\301\247\340\227\222\366\375\366\76\117\33\377\57\155\127\260\223\100\14\104\177\145\116\46\350\145\73\235\166\127"
-  "\303\47\160\365\114\142\4\17\162\63\44\36\374\170\333\370\32\337\116\330\272\41\302\245\217\171\363\72\355\114\3\44"
-  "\320\241\34\204\356\153\126\117\263\342\274\171\211\361\252\336\117\347\267\303\223\354\367\263\153\31\347\343\361\164\220\237"
-  "\350\257\362\162\50\322\331\202\56\170\343\266\323\177\66\320\336\57\206\251\264\224\155\227\126\215\42\167\62\174\36\237"
-  "\167\273\215\154\267\222\207\215\174\111\41\102\261\63\221\62\10\165\212\244\40\242\43\154\252\4\72\75\127\7\363\16"
-  "\6\145\162\261\154\0\221\235\42\146\20\243\47\324\305\232\234\203\116\120\76\272\130\152\40\302\340\24\103\43\302\234"
-  "\10\331\305\12\352\34\264\51\343\234\220\251\21\346\10\153\104\372\45\352\303\237\175\137\316\213\67\365\372\375\333\173"
-  "\177\135\275\320\341\375\366\47\365\246\121\72\277\25\273\56\215\143\77\213\335\306\342\353\267\127\246\371\73\77\45\350"
-  "\346\136\333\50\17\22\52\16\325\206\43\212\247\215\122\270\53\331\42\154\221\154\66\237\302\210\112\160\117\144\313\260"
-  "\145\262\215\363\51\106\120\235\167\352\353\312\21\373\345\350\266\262\356\225\143\145\366\255\215\330\167\303\274\167\230\42"
-  "\212\143\30\233\244\141\45\34\111\256\220\50\44\204\225\160\104\21\215\244\221\44\300\112\70\166\276\235\133\127\15\302"
-  "\141\271\20\235\126\323\27\153\260\62\367\123\33\51\367\223\313\75\114\221\150\43\234\10\147\302\43\115\21\20\51\120"
-  "\44\140\45\34\11\33\313\51\22\160\46\74\326\32\320\207\203\345\75\177\254\275\155\3\231\174\227\162\6\50\21\303"
-  "\100\24\75\223\200\7\132\160\161\13\272\152\365\123\331\323\353\22\200\341\21\376\370\315\1\36\175\363\123\222\244\114"
-  "\332\364\174\214\107\34\333\355\226\374\107\266\60\321\55\265\301\374\301\350\172\332\367\267\43\152\221\231\200\211\133\5"
-  "\175\33\121\56\10\160\135\260\357\201\36\317\301\351\320\13\116\300\250\17\270\202\76\301\134\220\340\272\140\237\340\371"
-  "\373\353\174\175\32\207\314\373\10\330\263\305\34\351\57\215\221\250\47\154\43\165\331\236\57\201\25\230\136\213\210\361"
-  "\22\53\227\325\62\110\36\226\214\24\12\17\254\300\344\141\65\237\43\112\345\230\100\240\145\220\376\224\117\202\43\110"
-  "\251\132\105\140\5\246\327\2\142\274\304\312\145\265\14\222\207\45\43\205\302\3\53\60\171\130\364\342\206\155\0\375"
-  "\167\101\207\264\275\226\44\312\10\132\255\121\107\340\5\246\27\43\142\336\55\326\56\253\145\220\74\56\31\51\24\36"
-  "\130\201\371\107\130\152\227\236\373\245\305\367\323\266\37\333\347\331\56\77\206\13\226\40\142\375\62\104\110\326\321\160"
-  "\13\216\375\354\17\310\314\37\206\13\46\134\142\375\244\113\110\336\321\160\13\216\375\373\370\252\27\354\317\334\46\322"
-  "\301\321\106\222\60\166\273\106\26\373\266\300\26\164\246\13\332\372\212\371\50\320\235\300\313\341\312\312\62\236\330\26"
-  "\364\172\270\375\355\217\122\142\164\302\45\234\337\5\41\214\67\301\310\216\2\163\133\322\241\56\150\353\53\346\243\100"
-  "\167\2\57\207\53\53\313\170\142\133\320\353\341\252\155\327\57\45\46\7\367\71\34\65\362\23\356\177\44\135\343\311"
-  "\155\111\307\272\240\255\257\230\217\2\335\11\274\34\256\254\54\343\211\155\101\257\207\333\177\315\371\170\170\374\145\366"
-  "\350\57\26\340\242\165\241\160\165\350\177\0";
+/* lib/include/sys.types.h (DEFLATEd, org. size 443) */
+static unsigned char file_l_32[156] =
+  "\165\317\301\12\203\60\14\6\340\273\340\73\4\166\23\206\260\215\135\174\30\321\266\112\260\115\304\306\201\173\372\131"
+  "\67\31\154\361\230\174\177\110\122\26\140\70\4\46\210\113\24\27\100\226\321\105\50\312\74\313\263\323\70\65\175\150"
+  "\200\311\270\124\227\5\104\174\272\132\0\43\264\63\172\71\43\155\331\44\307\204\44\243\114\212\245\145\326\165\51\160"
+  "\277\255\16\334\165\265\124\137\230\167\41\217\64\350\144\335\103\7\44\376\203\353\145\205\300\326\351\62\243\325\241\377"
+  "\201\275\17\255\37\336\217\127\312\73\53\32\22\335\4\303\301\224\361\154\6\375\214\215\76\247\274\0";
+
+/* lib/include/time.h (DEFLATEd, org. size 1681) */
+static unsigned char file_l_33[596] =
+  "\225\124\121\157\332\60\20\176\107\342\77\234\324\27\212\350\200\356\221\151\122\25\220\206\226\2\42\124\233\66\115\221"
+  "\33\137\210\105\142\243\330\241\205\151\377\175\166\234\100\110\140\153\171\341\162\337\367\335\331\367\331\356\167\141\114\24"
+  "\2\341\24\24\113\20\272\375\166\253\335\272\331\246\144\235\20\20\74\300\166\253\337\205\331\223\353\2\223\360\234\261"
+  "\130\335\61\236\363\164\136\262\3\372\252\201\334\60\36\304\31\105\370\44\367\262\257\366\133\224\37\242\317\365\174\100"
+  "\61\264\171\215\350\230\161\4\307\235\73\137\75\177\61\131\372\336\304\201\316\160\120\376\134\367\326\20\165\323\40\26"
+  "\301\6\30\225\100\122\204\157\17\336\264\222\312\333\127\213\371\313\311\203\273\232\76\116\140\120\107\36\347\263\371\152"
+  "\76\233\72\60\254\103\213\345\334\231\170\236\357\54\236\214\326\237\216\341\276\316\131\175\321\245\307\125\312\107\263\102"
+  "\251\322\54\120\371\70\345\26\3\370\335\156\101\376\245\7\245\166\276\304\140\4\146\164\30\10\136\54\30\40\26\174"
+  "\155\120\236\303\6\347\204\213\52\347\317\250\132\74\261\145\31\67\261\255\11\315\252\5\234\60\136\300\72\312\24\326"
+  "\340\110\144\251\355\151\242\272\226\222\275\5\165\0\42\4\25\41\44\202\253\250\306\23\307\36\115\160\217\244\350\140"
+  "\242\163\354\345\122\203\27\304\115\255\304\31\115\237\63\103\153\126\143\222\112\65\52\150\61\133\107\12\44\331\61\63"
+  "\334\362\170\333\101\342\253\302\224\333\203\243\215\311\377\73\73\301\350\355\350\10\122\221\75\307\10\224\205\241\121\167"
+  "\112\23\207\275\243\237\203\12\275\310\45\233\234\174\162\252\273\125\111\223\126\255\250\31\25\102\20\231\135\21\31\344"
+  "\24\355\247\324\233\270\126\315\222\253\324\213\65\53\372\165\362\16\262\36\13\211\377\313\267\257\200\226\331\71\331\65"
+  "\311\136\11\44\344\125\36\172\140\53\130\60\114\124\231\150\156\55\77\307\61\6\12\51\54\346\336\364\373\135\314\66"
+  "\372\221\242\224\51\246\65\271\215\105\157\143\31\250\203\104\125\270\147\274\117\61\146\372\224\13\16\253\37\200\174\7"
+  "\73\222\62\142\274\254\50\355\102\324\201\223\4\177\336\377\72\155\307\336\105\275\221\203\340\370\217\21\372\151\143\50"
+  "\275\67\31\165\121\150\361\347\54\274\166\22\216\252\363\26\227\225\227\54\174\337\172\315\205\262\267\143\215\312\332\152"
+  "\276\30\315\157\313\346\244\54\337\271\256\222\327\344\51\312\67\252\377\2";
+
+/* lib/include/unistd.h (DEFLATEd, org. size 1861) */
+static unsigned char file_l_34[578] =
+  "\245\124\337\153\333\60\20\176\57\364\177\70\330\213\23\302\274\215\262\227\214\301\140\55\204\216\6\322\216\366\315\310"
+  "\322\331\21\221\245\40\235\333\172\143\377\373\144\71\111\35\305\115\312\366\344\363\175\367\175\367\303\167\116\307\340\210"
+  "\151\301\254\0\327\124\271\121\222\3\67\272\165\222\3\217\0\65\153\164\220\260\334\112\121\242\30\301\70\75\77\73"
+  "\77\173\267\266\254\254\30\30\315\321\277\111\315\125\55\20\276\270\306\245\201\362\176\371\65\366\163\201\105\347\367\210"
+  "\267\245\106\270\275\373\76\273\311\256\146\77\56\157\346\0\311\207\321\36\64\377\171\267\305\222\217\373\320\345\142\261"
+  "\203\76\365\240\253\154\176\275\257\363\20\74\175\372\175\360\364\131\213\340\271\30\265\245\245\176\50\234\21\241\115\113"
+  "\106\113\264\360\210\234\214\205\304\261\12\101\261\306\324\4\314\301\375\267\333\31\110\343\321\214\122\276\61\272\1\71"
+  "\262\65\247\16\204\337\347\147\0\217\106\12\30\173\107\226\63\207\123\110\303\350\55\201\51\300\47\201\12\53\143\33"
+  "\260\130\112\243\203\6\200\223\277\60\13\52\231\102\35\70\376\131\322\362\165\322\237\151\333\2\76\373\352\65\270\215"
+  "\200\105\46\22\251\11\12\61\331\24\222\327\305\144\253\257\107\323\3\312\223\225\204\73\116\130\211\67\62\333\144\217"
+  "\21\163\157\34\355\20\46\320\6\170\203\153\172\55\373\377\212\254\117\265\235\67\204\23\77\312\42\153\277\102\341\160"
+  "\120\345\215\223\70\52\326\271\225\103\134\355\224\372\241\135\47\117\113\364\327\324\243\205\120\337\265\366\353\210\21\261"
+  "\133\204\50\230\53\343\266\201\21\44\235\137\351\346\20\353\132\161\271\15\225\255\311\266\13\247\371\50\154\233\67\300"
+  "\55\115\255\4\344\10\14\252\132\221\134\53\154\367\357\363\305\165\330\270\136\16\306\71\72\227\164\63\342\113\146\141"
+  "\274\366\27\324\165\307\52\43\342\346\152\255\244\136\61\212\306\173\100\245\102\261\162\220\173\220\54\212\352\351\33\45"
+  "\342\24\336\365\222\105\343\123\214\173\327\211\52\16\152\330\111\16\350\104\134\377\307\335\224\327\217\245\222\136\162\306"
+  "\5\51\275\172\135\150\130\346\70\275\177\265\47\277\105\147\367\327\336\333\255\165\104\60\371\67\231\266\10\133\11\151"
+  "\217\24\24\157\370\226\162\152\47\12\301\210\271\106\363\341\113\51\206\241\160\50\31\76\313\256\40\377\363\246\332\265"
+  "\370\137";
+
+/* lib/include/wasi.api.h (DEFLATEd, org. size 48987) */
+static unsigned char file_l_35[10941] =
+  "\345\175\153\163\333\70\262\350\367\255\332\377\200\332\275\125\343\244\344\304\226\35\47\343\354\71\165\144\131\116\124\221"
+  "\45\257\44\47\223\375\42\323\22\145\161\103\221\32\202\264\343\275\65\377\375\366\3\40\101\22\24\365\360\336\163\37"
+  "\265\123\265\216\115\64\32\215\106\277\320\335\170\373\132\174\153\215\272\242\165\323\75\27\213\70\136\311\363\267\157\37"
+  "\274\170\221\334\277\231\206\313\267\337\334\373\226\224\356\362\336\177\176\213\37\276\25\257\337\376\371\117\157\137\213\376"
+  "\305\271\210\27\236\24\360\337\57\221\353\370\277\244\200\304\201\164\135\61\231\74\71\322\363\275\373\351\4\377\374\146"
+  "\372\212\206\376\371\117\177\135\105\316\303\322\21\313\160\226\370\256\370\13\176\66\221\201\263\222\213\60\236\254\42\367"
+  "\321\163\237\216\377\222\175\30\6\123\227\6\316\334\271\27\270\342\262\73\154\17\6\137\272\235\311\150\334\32\216\305"
+  "\321\155\17\377\214\110\205\301\141\340\76\70\261\367\350\212\271\7\320\245\367\57\127\204\221\360\335\340\41\136\210\160"
+  "\56\34\21\271\17\136\30\210\47\130\245\27\300\277\361\303\67\204\134\374\274\162\141\22\221\170\101\174\166\72\211\351"
+  "\117\10\142\22\177\124\123\214\275\245\53\143\147\271\22\60\66\160\202\120\272\323\60\230\311\12\0\261\376\74\203\320"
+  "\235\271\101\354\315\75\67\222\142\16\250\115\375\160\372\103\212\3\372\177\157\6\203\200\244\162\341\104\356\214\160\44"
+  "\30\157\26\257\170\206\277\172\301\324\117\146\256\370\233\174\226\157\161\76\371\146\361\237\214\332\302\145\140\142\351\72"
+  "\62\211\274\340\101\40\351\31\0\141\56\36\35\77\161\305\277\334\50\24\323\60\212\134\271\102\344\151\236\77\377\111"
+  "\274\26\307\277\276\77\72\74\72\206\377\306\107\107\347\364\337\77\324\304\212\372\355\336\240\375\245\173\71\31\166\132"
+  "\275\161\367\272\3\344\117\147\227\161\30\271\207\117\36\240\267\14\203\60\16\3\157\312\50\65\304\323\302\233\56\160"
+  "\151\14\147\46\34\11\264\57\340\113\70\244\70\343\40\240\257\102\172\352\4\0\122\334\273\302\231\375\63\221\61\202"
+  "\10\146\12\256\372\343\302\201\215\327\34\100\300\170\202\177\46\313\25\154\21\342\350\256\302\51\61\2\161\57\377\31"
+  "\176\110\2\205\27\177\345\334\313\320\117\142\227\360\40\100\214\104\176\134\274\160\43\27\366\320\205\211\245\10\102\134"
+  "\110\0\313\260\123\354\172\320\37\214\7\375\156\133\34\147\44\153\337\334\36\342\34\12\242\43\145\70\365\234\70\335"
+  "\173\334\323\4\66\52\210\305\52\12\247\256\224\166\340\67\303\101\273\63\32\115\0\36\356\312\244\173\51\232\73\315"
+  "\22\57\200\376\63\373\44\343\317\260\353\227\346\34\47\267\212\253\73\121\204\274\34\316\134\11\33\30\47\21\156\361"
+  "\375\263\230\47\301\64\206\343\46\337\20\25\373\260\111\216\357\63\35\135\330\133\327\30\7\54\237\33\213\150\245\343"
+  "\161\371\217\300\131\352\57\236\44\170\40\156\76\12\31\302\312\160\160\42\341\317\160\56\27\336\3\354\314\241\357\76"
+  "\272\276\0\21\24\71\321\263\360\235\147\70\162\15\142\232\20\167\216\47\324\140\11\334\22\366\323\177\246\143\351\370"
+  "\336\103\260\104\212\20\211\156\6\243\356\157\345\103\176\174\6\347\25\326\20\204\352\200\153\222\165\206\303\376\140\62"
+  "\272\155\343\256\210\43\101\322\111\255\66\234\22\261\201\310\243\147\340\343\45\160\57\220\4\304\355\312\167\161\117\144"
+  "\62\305\215\236\47\276\377\234\337\10\206\332\274\350\176\22\307\10\262\25\75\44\204\243\357\111\330\272\60\24\176\130"
+  "\144\77\36\323\102\104\104\23\7\335\270\321\322\223\22\145\40\210\42\317\235\131\277\277\274\34\166\373\267\243\216\70"
+  "\241\211\146\63\20\26\22\211\13\104\256\32\0\374\335\372\332\352\366\304\251\71\6\17\246\363\350\170\276\163\357\333"
+  "\207\136\365\7\243\333\233\233\1\10\363\167\346\310\271\263\364\140\73\20\200\114\126\253\60\212\53\220\375\324\352\366"
+  "\305\31\16\35\272\62\114\242\51\360\102\220\316\331\100\15\20\256\334\310\211\111\360\207\211\17\134\204\47\301\12\254"
+  "\207\114\376\135\274\107\160\355\60\10\134\142\100\140\10\74\30\317\110\2\340\231\207\250\164\24\171\370\105\353\362\112"
+  "\174\300\261\27\316\214\225\20\360\366\64\362\126\40\34\53\6\134\217\76\211\137\365\20\120\30\322\171\260\22\352\342"
+  "\166\364\135\34\23\63\135\202\232\234\222\152\213\364\212\357\23\151\145\227\166\253\337\356\364\72\227\342\230\170\146\220"
+  "\22\2\204\346\324\365\355\44\155\177\356\366\140\104\123\61\356\164\341\1\315\224\4\162\255\13\157\17\372\375\326\5"
+  "\354\41\316\164\122\44\336\175\345\346\341\270\141\347\12\130\15\306\235\26\306\201\170\305\103\135\75\156\324\31\213\343"
+  "\167\245\121\322\215\155\143\56\141\147\173\137\304\161\236\125\146\260\257\44\27\231\63\350\170\332\107\203\301\1\154\76"
+  "\354\374\135\34\277\347\135\220\261\27\60\65\35\305\264\221\373\173\342\105\166\234\57\7\327\342\230\230\343\332\1\21"
+  "\264\204\221\123\24\103\352\24\207\111\214\222\161\26\56\35\340\62\370\111\113\77\53\254\277\337\16\140\355\277\252\245"
+  "\270\321\243\175\316\316\157\335\321\130\64\211\153\256\220\35\335\237\40\54\254\133\170\325\272\355\301\247\307\232\25\325"
+  "\222\254\237\242\14\152\66\123\240\44\173\140\41\126\276\375\74\30\215\157\141\263\132\355\317\242\111\254\361\71\224\61"
+  "\253\135\70\124\323\105\225\144\350\136\16\257\105\223\230\42\63\233\200\302\313\260\142\261\335\336\10\66\247\111\14\321"
+  "\365\175\260\4\174\320\27\240\307\45\354\212\13\354\156\35\324\7\355\371\151\210\202\272\171\226\77\42\65\207\275\333"
+  "\37\17\105\223\130\241\33\304\40\335\223\25\12\360\165\333\326\355\177\155\365\104\363\3\217\1\253\302\233\245\14\140"
+  "\375\176\40\232\264\307\335\267\3\326\37\326\257\106\170\34\304\11\355\362\10\170\331\45\362\116\371\114\124\320\152\4"
+  "\226\264\70\241\335\356\242\61\66\3\266\235\202\224\262\112\221\336\140\160\43\116\150\303\307\260\327\113\47\0\225\212"
+  "\12\126\42\243\312\347\345\175\350\203\265\347\173\301\17\53\251\256\257\272\75\120\46\47\51\307\144\122\121\331\126\153"
+  "\131\350\272\327\355\177\21\47\247\371\371\53\47\33\175\32\165\377\1\323\21\43\134\263\104\255\231\0\130\277\373\31"
+  "\327\170\126\167\242\372\255\353\316\170\60\350\15\372\237\304\311\173\275\240\300\131\272\153\125\160\277\63\276\34\174\203"
+  "\115\242\275\357\273\361\123\30\221\355\71\13\237\202\212\1\54\340\116\176\265\213\123\64\205\2\206\123\61\136\237\272"
+  "\323\43\163\316\232\123\327\247\255\72\75\316\321\232\134\41\324\242\164\50\44\31\56\326\301\203\213\333\253\221\70\325"
+  "\232\343\76\231\317\341\314\312\225\3\222\166\255\31\320\37\134\166\276\212\323\23\65\20\254\240\5\60\11\252\71\373"
+  "\327\235\376\130\234\236\232\137\223\266\5\176\132\313\310\60\360\267\116\133\234\22\153\164\176\272\323\44\106\214\170\60"
+  "\130\176\40\224\253\317\131\177\320\153\177\21\247\147\152\126\166\335\152\126\105\234\173\372\276\226\253\6\327\235\153\161"
+  "\312\314\1\26\217\33\204\311\303\202\11\127\361\75\230\15\247\277\52\124\224\331\240\54\153\74\135\250\204\4\32\253"
+  "\366\321\40\363\200\211\157\300\344\42\336\270\211\300\137\233\206\176\275\271\6\306\332\115\133\274\73\326\224\247\235\365"
+  "\335\71\350\256\140\355\206\215\276\217\304\73\126\31\112\100\326\233\166\140\122\222\144\173\107\154\101\116\146\52\335\160"
+  "\360\132\11\7\203\121\304\275\73\325\64\65\144\34\362\211\223\227\133\160\172\353\244\40\100\354\134\337\214\277\213\167"
+  "\304\76\227\51\64\304\305\135\256\342\252\121\303\116\173\360\265\63\154\135\300\311\172\107\354\63\212\301\1\243\161\0"
+  "\3\364\131\124\115\357\361\10\374\57\361\356\175\266\14\46\102\325\327\267\67\342\135\312\107\51\171\13\146\160\216\364"
+  "\270\165\153\141\342\222\131\15\5\316\12\124\342\52\102\377\221\224\22\154\101\34\1\343\244\240\255\40\176\3\105\166"
+  "\166\124\76\333\264\17\325\166\6\22\355\252\67\370\46\316\210\337\276\346\65\5\356\330\275\212\73\220\347\67\163\142"
+  "\247\222\347\101\370\166\206\150\2\212\63\166\204\60\326\24\46\40\325\236\2\27\245\206\235\213\156\72\140\204\234\235"
+  "\344\15\3\244\336\12\35\251\270\202\367\156\272\67\35\161\106\234\167\21\205\77\100\154\256\74\73\132\164\20\305\331"
+  "\273\334\51\254\224\100\364\165\346\57\235\235\225\16\357\332\363\104\303\307\337\21\267\367\271\221\117\21\250\55\42\35"
+  "\271\277\325\314\60\154\365\77\301\350\17\112\236\45\176\274\136\261\16\7\240\16\316\224\231\352\314\16\303\300\177\126"
+  "\301\271\112\45\62\42\352\275\77\62\215\44\351\272\126\55\67\32\202\176\173\177\154\162\226\65\122\242\276\36\267\340"
+  "\4\276\157\326\111\143\14\160\134\16\156\307\342\175\321\225\301\70\312\14\115\165\353\260\337\306\27\340\243\275\147\73"
+  "\305\375\311\41\304\112\327\354\67\324\170\357\331\175\211\102\51\17\325\231\100\151\124\45\15\133\67\44\104\336\237\261"
+  "\376\212\335\0\135\371\163\321\166\126\316\275\347\173\261\347\242\237\56\101\357\172\123\57\265\52\51\112\123\64\274\42"
+  "\357\141\21\313\6\374\52\106\136\306\330\225\12\250\71\52\352\262\164\236\361\204\1\253\243\152\324\264\52\305\71\31"
+  "\220\21\46\5\101\115\277\303\23\352\5\217\160\0\304\335\174\66\301\363\51\237\203\351\35\207\203\272\163\161\267\2"
+  "\117\150\202\166\305\35\5\76\335\270\41\124\214\123\222\46\53\200\241\161\346\40\12\317\0\354\271\357\74\310\363\363"
+  "\31\203\317\21\157\330\375\364\171\74\232\134\135\116\56\133\343\326\350\173\277\55\16\16\64\312\257\16\216\305\337\376"
+  "\46\216\136\275\132\213\71\72\377\167\24\74\272\303\263\1\377\236\76\32\253\140\150\347\347\360\45\62\352\146\153\41"
+  "\300\53\202\134\205\60\306\42\312\310\36\327\40\113\50\140\44\23\260\100\272\10\157\271\362\221\57\114\74\143\327\367"
+  "\53\347\35\165\72\137\312\363\66\153\346\235\317\44\150\65\230\76\236\320\166\124\202\277\272\204\203\70\206\131\306\223"
+  "\253\136\353\323\250\74\325\111\335\22\377\255\134\24\21\170\336\356\15\131\313\316\126\247\233\354\24\131\324\50\270\34"
+  "\361\344\140\164\323\211\71\370\111\366\354\174\16\313\121\221\161\14\14\240\327\354\370\160\140\101\14\35\170\157\334\67"
+  "\15\161\367\264\100\347\366\374\174\232\104\152\55\74\214\102\375\257\110\363\307\41\301\60\346\136\313\0\343\116\257\127"
+  "\136\316\273\232\345\74\105\136\354\232\307\104\272\301\354\145\216\11\203\256\102\367\333\260\73\356\224\361\75\253\301\327"
+  "\231\75\172\262\32\152\353\362\153\167\144\1\373\276\16\254\17\236\201\263\6\335\126\257\67\150\267\154\30\177\130\7"
+  "\232\30\166\12\2\43\166\47\251\235\152\237\344\246\65\376\74\151\203\370\30\167\46\140\4\167\332\343\301\360\173\171"
+  "\272\137\325\164\25\147\50\256\304\302\74\66\241\72\40\204\131\75\72\344\136\226\145\332\121\355\312\121\55\336\145\127"
+  "\26\205\340\52\336\50\301\257\211\327\164\144\317\156\313\233\70\241\167\66\31\15\156\207\155\33\116\307\57\210\123\214"
+  "\26\122\274\61\116\343\326\360\23\370\376\145\234\232\265\70\321\336\124\203\37\334\164\372\26\270\47\33\150\100\100\176"
+  "\255\252\102\167\253\14\371\264\26\143\204\115\224\254\306\32\301\223\53\135\206\377\156\3\370\30\236\251\335\247\55\370"
+  "\146\330\301\60\120\65\347\234\275\30\116\233\363\215\302\251\222\163\336\327\342\104\121\36\124\341\60\343\232\275\300\23"
+  "\114\12\334\76\217\125\206\115\27\116\0\36\33\337\267\377\42\371\152\376\200\256\120\331\231\57\242\200\126\4\176\164"
+  "\367\152\147\65\277\106\126\305\121\122\245\314\363\113\104\33\205\202\211\345\165\376\272\71\75\161\61\224\14\260\351\224"
+  "\350\200\130\314\242\146\235\235\132\277\203\150\176\255\335\277\346\361\246\163\244\133\124\73\121\65\25\233\315\155\146\133"
+  "\103\303\342\164\125\24\74\251\335\65\371\274\254\21\106\243\357\327\166\131\324\334\104\326\341\365\305\106\372\173\330\271"
+  "\36\174\135\253\277\233\365\262\57\11\160\61\104\306\65\123\335\366\111\353\330\165\163\363\314\60\23\14\33\216\235\242"
+  "\15\117\142\350\373\223\60\160\301\60\275\303\337\313\344\36\45\335\75\5\161\122\17\313\152\52\52\253\362\205\346\131"
+  "\143\110\336\14\172\75\255\312\52\54\312\346\132\41\312\66\357\42\211\61\246\157\237\3\143\171\223\321\347\133\276\14"
+  "\50\303\47\341\111\63\264\112\32\1\104\350\254\230\254\4\56\370\111\23\163\225\146\231\373\335\322\111\116\341\134\54"
+  "\201\335\42\316\151\220\140\223\202\337\360\366\1\57\37\361\36\315\51\46\56\111\20\213\323\130\170\300\240\323\111\14"
+  "\216\343\377\204\375\40\67\377\3\114\361\372\76\231\177\324\161\130\175\337\251\2\316\52\316\317\1\71\300\73\275\127"
+  "\26\202\63\250\360\213\211\357\6\51\200\54\47\153\355\370\77\64\66\333\55\216\166\331\276\272\151\141\171\323\60\220"
+  "\361\366\213\304\31\142\67\330\175\225\71\0\177\244\150\351\165\16\135\237\63\331\224\53\267\46\141\315\314\127\233\271"
+  "\176\354\344\43\61\253\120\172\352\142\134\201\4\4\70\316\203\7\304\145\157\123\115\243\60\265\146\56\230\161\37\244"
+  "\25\273\235\64\231\346\362\157\237\73\375\166\7\5\60\147\275\214\300\315\313\315\13\242\74\212\17\303\371\141\266\214"
+  "\302\330\366\355\220\323\133\112\143\323\124\50\265\40\353\360\116\377\222\23\135\112\303\301\27\315\117\234\362\23\154\12"
+  "\256\4\77\312\223\302\274\61\200\231\301\372\42\1\205\124\345\133\313\43\330\370\207\0\57\246\225\5\211\313\113\157"
+  "\141\362\66\133\51\154\6\177\237\206\341\17\317\315\357\127\32\205\105\30\167\263\11\330\211\76\132\60\60\11\346\47"
+  "\200\160\104\300\101\174\247\70\272\14\235\44\2\174\304\43\63\350\24\0\224\156\344\71\276\10\222\345\75\362\42\106"
+  "\33\350\52\336\373\35\326\243\270\314\213\145\71\110\133\302\337\13\302\231\15\167\42\134\121\170\301\177\366\124\313\17"
+  "\212\163\361\167\205\64\52\124\107\30\255\6\365\364\245\217\362\362\110\24\346\261\31\316\152\46\136\325\217\0\104\61"
+  "\376\12\157\132\275\71\355\64\314\27\205\113\201\367\232\12\4\145\204\21\120\120\62\53\167\212\33\132\10\14\247\270"
+  "\134\140\72\334\344\262\363\265\13\226\377\261\106\250\12\11\142\56\311\167\113\224\164\244\57\76\210\170\25\123\264\77"
+  "\267\206\255\366\270\63\324\323\64\267\231\6\114\355\310\231\306\170\247\121\77\125\146\134\234\154\63\107\166\54\326\1"
+  "\37\166\76\335\366\132\103\66\53\116\267\201\17\62\76\361\35\275\221\153\246\100\175\12\326\336\345\247\141\353\232\323"
+  "\307\66\136\202\3\52\40\162\226\326\313\216\42\374\321\30\214\202\153\116\62\333\170\273\237\143\367\20\216\250\133\73"
+  "\307\367\353\213\101\257\333\46\317\237\63\317\322\71\114\200\371\353\112\203\52\112\220\25\145\225\115\373\261\350\310\264"
+  "\237\41\203\4\210\32\367\147\234\352\256\274\106\300\77\25\147\60\256\336\50\57\266\40\360\204\226\20\0\31\176\112"
+  "\1\347\45\220\171\212\151\265\164\161\35\352\104\117\373\252\204\51\336\204\226\221\25\152\227\162\63\212\62\71\17\55"
+  "\23\100\0\14\177\370\130\51\151\66\306\361\217\224\330\71\371\13\254\242\354\26\207\22\75\305\212\54\27\114\41\173"
+  "\364\44\37\51\116\104\110\125\134\121\134\342\227\323\242\260\304\150\45\350\277\376\140\170\335\352\145\222\322\131\255\200"
+  "\145\370\332\122\345\51\363\160\304\377\201\14\14\226\367\367\356\302\171\364\0\73\362\224\61\71\34\226\244\125\142\52"
+  "\24\351\330\344\371\130\115\74\352\374\375\266\323\37\167\141\362\143\333\344\356\117\4\310\254\314\13\57\3\126\211\132"
+  "\61\260\7\136\23\242\224\366\303\47\142\22\344\105\32\314\351\275\372\67\126\124\206\255\76\346\332\65\167\106\203\14"
+  "\255\10\314\155\100\40\214\146\156\144\235\346\133\267\327\353\167\72\227\231\350\334\145\42\76\134\50\353\222\70\211\134"
+  "\353\114\227\203\376\230\146\72\135\73\23\351\162\64\25\175\225\310\261\357\274\300\114\35\314\2\176\267\363\2\261\174"
+  "\203\56\4\340\157\201\312\167\110\244\213\150\122\360\307\231\307\232\272\326\73\112\212\327\124\144\136\253\253\31\72\7"
+  "\50\0\127\53\60\361\260\262\304\75\27\227\70\271\62\261\65\23\153\253\300\361\237\234\147\211\153\201\357\371\40\353"
+  "\77\377\42\321\114\54\310\351\113\272\244\232\264\156\156\320\270\74\70\110\347\55\134\36\176\103\247\3\151\1\54\203"
+  "\167\251\150\356\76\7\323\105\24\6\340\35\314\50\135\102\121\77\166\37\340\343\147\235\366\115\47\175\200\127\343\44"
+  "\243\350\44\30\242\65\103\335\204\147\307\362\122\335\104\25\221\324\121\35\254\222\41\103\4\61\134\226\25\253\2\323"
+  "\37\364\311\320\261\100\322\21\233\221\271\66\364\46\151\201\151\36\210\264\3\36\126\340\167\262\5\21\225\125\140\43"
+  "\142\67\40\13\35\143\325\174\137\157\16\47\170\325\4\346\13\17\274\54\165\61\37\223\126\301\205\1\16\10\153\137"
+  "\146\240\302\104\302\136\45\253\31\146\301\30\274\263\164\143\247\54\40\365\322\53\126\176\232\272\374\105\346\7\305\20"
+  "\171\367\111\225\47\313\367\255\254\307\15\5\66\227\23\375\257\217\131\206\156\232\25\43\262\163\103\237\342\217\37\305"
+  "\372\243\47\322\53\176\34\242\176\276\167\44\117\60\244\177\263\370\101\1\361\314\47\312\223\166\67\322\12\314\13\100"
+  "\32\300\226\5\17\37\71\101\372\247\267\114\226\102\31\40\221\61\203\312\111\360\300\153\167\60\116\40\20\42\346\344"
+  "\270\117\305\371\64\116\221\53\370\332\14\305\120\104\211\165\66\364\32\302\175\363\360\246\221\176\123\272\116\371\103\221"
+  "\334\126\316\305\145\43\332\344\306\254\50\207\63\52\234\274\47\325\166\2\104\137\27\253\0\357\336\253\34\162\142\65"
+  "\16\123\223\335\104\361\53\366\313\200\244\36\317\364\254\341\231\211\216\46\23\257\365\330\30\273\14\375\157\24\5\40"
+  "\170\124\40\224\61\34\111\165\252\264\252\22\276\62\316\113\137\372\230\320\360\35\370\201\316\230\326\13\151\331\234\22"
+  "\265\354\74\147\47\360\116\107\171\317\317\201\24\313\102\350\354\152\64\126\22\170\334\275\306\3\224\116\135\20\300\133"
+  "\341\100\13\6\336\342\242\250\73\125\200\167\176\216\5\150\370\267\165\110\200\170\374\146\103\344\170\35\42\40\154\201"
+  "\123\224\362\334\206\44\313\65\44\271\256\40\111\163\167\114\166\45\314\365\32\302\150\351\176\205\277\315\45\34\341\214"
+  "\40\66\27\41\205\66\26\341\23\332\303\13\135\16\46\103\377\321\226\166\104\21\16\37\34\227\144\225\347\102\111\11"
+  "\330\372\362\114\3\40\230\271\232\307\262\103\325\100\233\4\204\2\230\65\16\232\5\371\125\366\6\203\57\267\67\132"
+  "\216\137\163\264\174\320\353\321\162\163\210\24\170\162\200\71\323\364\47\76\363\340\62\224\344\112\351\160\205\271\105\265"
+  "\111\166\51\255\67\107\64\147\241\313\11\260\124\315\221\307\164\300\110\322\155\73\340\26\332\321\272\162\74\37\201\5"
+  "\371\274\130\53\50\363\2\42\264\63\274\6\107\70\352\132\51\133\251\211\2\331\371\255\335\53\103\113\357\202\360\166"
+  "\56\135\62\252\160\274\55\74\262\102\32\17\157\111\253\206\26\206\143\203\47\165\63\27\116\64\343\252\1\332\376\300"
+  "\164\241\113\242\22\277\233\206\111\311\175\253\323\311\352\324\52\357\132\311\133\374\341\243\121\270\325\275\244\112\237\222"
+  "\256\320\102\274\350\77\153\357\271\34\300\263\70\260\353\225\277\261\56\101\127\103\364\131\25\221\212\10\145\45\321\264"
+  "\47\74\5\225\241\145\361\32\331\310\114\126\332\70\220\146\30\13\1\202\341\247\352\172\115\175\245\74\165\375\211\366"
+  "\264\361\204\220\333\316\323\32\205\324\2\25\4\315\333\253\24\361\157\54\303\226\345\141\166\61\150\33\74\315\15\346"
+  "\225\301\46\47\122\337\153\27\106\377\221\362\101\306\75\267\260\157\207\151\31\253\52\172\61\14\32\140\54\147\272\140"
+  "\167\44\274\377\247\341\321\121\115\255\103\145\323\30\162\47\73\301\375\31\123\220\157\306\136\162\331\160\255\140\153\220"
+  "\101\21\56\336\10\333\246\41\133\165\127\266\322\206\63\234\20\367\221\52\323\42\212\20\250\312\325\264\216\252\30\226"
+  "\240\217\323\60\256\216\237\144\205\347\231\116\361\146\167\30\214\320\5\337\274\354\124\17\335\341\217\141\122\274\300\356"
+  "\174\355\364\307\34\37\45\317\344\110\130\215\346\73\163\31\23\165\263\110\367\101\347\347\270\53\223\354\133\102\202\170"
+  "\201\235\6\135\367\100\266\34\16\243\152\156\312\243\144\102\50\317\21\44\300\303\203\256\340\317\261\176\25\306\72\227"
+  "\363\370\205\160\236\72\53\147\12\276\217\5\357\47\66\243\137\14\157\276\11\155\12\43\312\57\251\170\241\42\374\236"
+  "\336\270\22\47\353\314\112\165\131\214\153\55\134\302\226\13\252\21\345\350\51\247\2\351\36\313\325\321\102\164\204\271"
+  "\16\204\150\341\207\250\130\311\40\226\125\25\41\270\242\341\67\126\31\346\25\357\344\163\253\377\351\366\6\24\110\176"
+  "\132\113\136\60\312\151\370\204\144\24\34\215\73\32\160\107\107\222\243\204\200\326\106\53\125\252\202\306\347\66\73\163"
+  "\345\224\214\15\110\50\246\261\310\54\142\312\302\322\312\260\302\344\1\26\145\371\245\211\314\345\253\333\114\55\315\312"
+  "\250\32\27\262\132\112\220\260\312\252\333\253\126\254\56\225\123\71\224\376\370\161\235\220\174\100\73\305\220\220\167\172"
+  "\324\135\272\110\256\303\347\332\11\132\135\27\315\233\340\20\223\140\33\44\314\250\376\76\207\46\336\203\372\256\56\31"
+  "\320\52\70\47\10\261\242\327\325\106\226\60\205\234\260\6\212\213\304\200\111\214\221\5\42\12\363\237\51\50\223\323"
+  "\20\37\32\331\120\266\37\6\260\202\34\243\41\160\223\327\330\144\277\343\141\122\170\17\1\66\251\120\36\257\353\317"
+  "\362\273\232\231\67\45\333\34\255\161\112\157\200\137\255\42\165\121\234\311\351\164\237\320\135\311\313\354\322\241\6\222"
+  "\22\126\271\123\15\33\304\171\246\150\340\156\2\234\332\206\4\371\376\34\374\271\326\55\234\332\355\141\112\175\27\177"
+  "\345\72\321\66\360\315\373\142\235\271\231\366\306\250\320\144\171\111\63\272\275\40\365\244\134\205\333\213\121\173\330\275"
+  "\31\167\7\175\126\133\223\326\305\210\72\247\34\34\24\150\122\47\162\362\132\242\50\170\170\317\255\307\56\247\134\30"
+  "\157\316\174\310\172\316\314\62\336\343\36\41\17\230\152\36\147\151\2\30\143\163\42\67\117\104\233\251\244\110\231\345"
+  "\120\350\275\42\11\245\251\273\16\2\160\332\324\303\252\226\217\42\5\262\104\213\225\216\3\156\102\232\42\237\67\171"
+  "\310\222\172\162\274\70\15\377\341\65\2\202\307\374\133\134\203\3\222\165\352\252\24\171\272\363\345\63\222\146\161\344"
+  "\167\304\220\224\174\70\70\270\375\314\205\62\56\137\32\53\202\140\365\76\36\115\333\162\371\270\225\267\41\177\167\276"
+  "\371\146\357\242\155\52\55\14\346\205\252\173\315\40\143\1\242\354\234\154\101\116\141\231\142\347\25\166\365\326\353\37"
+  "\114\116\22\5\73\346\143\211\44\166\365\122\107\231\202\274\11\220\17\162\140\23\370\237\122\72\266\35\140\206\377\130"
+  "\372\263\135\116\157\362\35\313\362\322\362\10\217\217\353\367\45\311\147\134\305\316\103\171\102\136\117\142\233\40\45\332"
+  "\250\302\222\257\345\214\224\31\52\25\61\362\270\241\207\113\352\222\103\221\352\320\25\316\47\336\3\245\55\176\322\50"
+  "\53\141\166\176\136\122\350\66\23\301\140\125\363\142\126\351\134\63\255\111\133\241\334\362\7\335\227\224\213\322\263\236"
+  "\243\235\215\244\51\101\73\77\275\230\372\24\211\7\67\300\13\16\216\344\70\332\162\340\363\351\376\64\330\276\24\256"
+  "\302\277\116\163\31\63\43\120\315\16\366\376\11\146\136\365\155\257\244\257\264\316\304\52\107\372\305\33\254\357\125\233"
+  "\102\375\211\310\30\46\11\5\60\245\273\164\2\352\57\202\107\363\356\207\347\373\7\53\157\326\0\365\162\327\120\105"
+  "\22\154\22\360\336\222\223\151\53\210\34\165\77\365\133\75\274\17\352\150\217\353\63\270\274\11\210\356\26\125\11\236"
+  "\213\61\31\14\116\254\162\240\254\365\227\12\314\147\60\265\225\17\224\216\142\373\2\233\147\244\53\333\1\162\267\77"
+  "\46\47\45\203\354\213\337\23\157\57\230\177\277\355\216\305\11\3\325\375\104\120\55\342\261\241\355\332\5\317\36\66"
+  "\110\122\141\56\147\352\276\275\7\361\361\143\25\172\310\300\221\263\33\131\307\303\326\215\170\307\120\157\24\107\122\227"
+  "\210\175\126\337\272\300\12\143\6\332\122\21\26\22\45\151\267\64\201\225\306\52\27\323\321\131\15\34\273\330\151\306"
+  "\213\333\221\170\57\322\216\142\201\213\345\331\16\210\323\305\322\5\136\66\153\314\167\200\176\165\323\21\37\30\372\27"
+  "\70\16\73\301\370\202\333\367\253\310\2\72\232\22\114\147\161\274\23\324\333\321\360\30\73\73\61\243\251\212\147\105"
+  "\316\64\73\161\47\310\243\316\247\257\330\371\251\22\341\346\256\10\67\261\75\224\161\143\213\342\235\212\334\331\272\12"
+  "\102\370\15\231\321\164\63\354\31\14\321\45\177\304\56\146\250\362\373\130\35\271\226\357\104\113\326\317\273\61\160\157"
+  "\170\215\115\245\162\342\206\354\203\335\17\305\30\333\1\34\253\243\326\66\373\142\211\130\103\1\51\53\343\160\265\122"
+  "\115\27\120\357\170\101\202\53\336\204\4\355\317\330\172\113\235\273\266\32\13\312\3\133\225\200\162\41\67\120\201\317"
+  "\0\352\357\144\325\207\266\211\6\40\62\217\325\171\33\301\207\331\330\14\60\376\136\232\177\260\61\331\170\160\203\215"
+  "\255\362\302\27\247\56\121\172\23\160\343\321\370\6\73\133\21\270\13\147\372\343\1\14\205\40\243\63\246\113\55\127"
+  "\261\152\160\71\333\22\370\270\333\307\166\130\33\0\47\73\156\133\350\203\133\354\240\305\152\322\3\353\346\36\254\217"
+  "\47\157\6\47\202\63\77\314\240\215\143\366\362\330\204\65\156\207\324\165\213\71\343\346\226\235\41\337\133\172\150\134"
+  "\114\135\167\146\262\304\26\114\375\33\2\153\236\30\261\111\212\333\277\4\344\253\321\77\260\205\27\101\376\352\105\161"
+  "\242\272\173\106\170\317\306\215\322\166\0\373\165\114\147\273\231\251\74\360\56\50\172\263\67\350\233\341\340\12\33\201"
+  "\261\150\363\202\131\370\244\202\374\33\236\337\157\335\76\66\72\123\347\12\323\125\126\241\224\36\265\167\331\5\237\101"
+  "\217\32\206\361\102\51\31\156\16\14\104\31\133\273\200\373\66\304\216\142\212\375\147\52\55\201\172\120\356\246\140\276"
+  "\217\260\357\130\56\204\224\272\15\30\247\63\332\45\330\43\103\221\227\213\11\15\311\77\220\352\136\230\273\32\241\106"
+  "\101\377\232\152\247\160\233\275\70\273\366\340\3\364\13\332\257\123\27\275\355\337\23\67\161\213\305\67\52\371\250\323"
+  "\376\72\271\321\315\15\52\56\154\3\113\346\256\154\250\354\355\4\344\254\257\172\223\372\276\21\230\240\343\75\345\344"
+  "\16\355\343\254\101\342\133\253\13\74\334\263\340\161\234\273\52\67\73\242\156\100\313\320\102\313\322\340\363\264\47\32"
+  "\41\215\156\303\275\213\341\5\165\355\132\304\173\140\340\215\55\64\370\316\265\205\255\36\1\375\252\13\346\12\126\340"
+  "\226\0\170\121\317\305\237\224\234\303\21\66\152\366\311\61\27\362\120\224\251\102\27\363\113\314\142\300\146\77\56\371"
+  "\171\30\323\255\212\64\32\374\144\44\271\340\31\16\250\137\135\220\112\135\162\24\27\111\154\364\140\53\71\137\371\34"
+  "\303\113\117\242\350\6\257\52\211\124\25\25\63\135\125\332\333\110\247\275\41\255\144\105\342\140\11\52\22\251\26\344"
+  "\267\241\5\244\346\236\142\237\351\125\344\142\302\1\354\304\324\350\24\143\137\263\372\326\274\311\153\341\57\17\25\204"
+  "\212\154\201\233\141\7\153\313\165\131\201\70\22\225\41\234\377\1\320\350\226\74\37\303\64\46\76\77\317\212\315\13"
+  "\361\12\65\26\113\50\163\261\253\174\322\167\226\34\105\367\310\110\3\314\73\115\357\243\14\50\23\252\304\56\124\162"
+  "\255\370\327\124\315\205\161\1\363\373\54\375\53\313\324\106\177\53\211\51\42\220\22\52\45\365\263\55\112\245\41\246"
+  "\341\251\334\24\270\200\334\304\326\350\221\246\243\65\154\144\116\220\344\140\31\125\146\240\3\246\341\162\11\146\312\241"
+  "\217\273\230\266\43\245\74\306\264\334\211\133\251\63\151\235\50\162\236\341\340\120\277\124\130\75\106\134\60\12\221\223"
+  "\125\0\107\122\165\260\244\132\144\132\277\373\223\22\335\365\115\15\175\2\177\74\310\125\31\276\206\137\77\66\162\277"
+  "\302\337\114\356\223\371\237\377\364\52\103\34\347\132\203\72\141\254\372\116\377\27\143\106\77\233\372\45\273\117\323\103"
+  "\245\316\125\56\54\130\1\6\252\353\76\345\70\7\231\367\372\142\351\115\345\22\123\52\34\30\374\365\32\160\132\305"
+  "\321\121\243\374\273\343\334\72\141\203\334\340\321\3\167\230\120\170\4\177\230\254\307\362\376\24\12\25\145\335\26\51"
+  "\260\306\56\131\327\240\77\53\357\224\372\113\176\263\364\347\326\375\252\134\311\166\333\145\5\263\166\17\71\151\242\222"
+  "\216\353\326\275\337\366\321\262\323\134\264\44\13\227\260\137\313\5\317\271\60\251\316\175\343\106\302\250\243\224\26\205"
+  "\101\372\76\123\105\355\250\362\65\355\342\307\157\11\160\226\115\22\24\177\337\120\331\26\204\320\35\55\362\374\334\303"
+  "\140\303\135\332\235\335\75\347\254\1\274\140\7\343\37\323\3\120\161\163\250\34\50\0\153\240\166\105\334\17\275\264"
+  "\131\343\322\62\143\175\243\224\73\52\350\231\142\164\140\101\51\370\332\336\50\220\237\47\215\14\322\347\156\250\50\325"
+  "\101\107\173\43\33\231\265\100\67\257\271\32\305\313\46\275\217\366\75\313\137\371\345\366\154\3\152\121\262\144\15\271"
+  "\362\63\244\344\132\103\21\34\261\35\111\370\5\210\12\142\50\10\113\225\160\215\355\302\16\300\345\363\23\11\146\315"
+  "\253\354\252\55\213\333\147\30\343\175\33\76\272\320\320\327\203\304\255\30\153\167\246\344\351\321\147\153\357\370\66\331"
+  "\220\33\305\376\234\134\150\251\222\142\233\256\230\273\120\263\115\130\105\374\163\62\127\75\240\262\155\262\121\76\355\25"
+  "\165\220\135\147\345\310\227\57\322\116\63\51\262\33\211\205\201\71\25\321\270\322\222\123\307\140\32\225\106\215\52\175"
+  "\337\26\54\0\61\141\162\375\227\376\116\27\223\251\37\14\272\203\34\231\362\215\257\352\150\245\16\65\367\174\315\212"
+  "\321\67\44\264\356\212\125\117\152\365\145\15\261\35\343\172\232\353\256\363\250\356\100\137\140\141\47\273\346\122\150\314"
+  "\354\24\65\10\325\306\14\244\355\71\220\22\227\352\311\101\237\231\264\60\146\66\152\160\262\312\226\254\376\32\146\231"
+  "\171\262\126\142\315\323\306\214\265\310\350\57\53\360\371\244\222\104\214\102\2\133\65\170\11\241\110\251\171\215\25\47"
+  "\114\23\156\64\33\60\200\270\302\176\65\127\275\127\31\222\15\314\7\171\162\321\17\227\306\235\77\147\271\110\273\300"
+  "\125\75\30\236\310\371\264\244\74\375\42\115\344\121\23\163\116\176\25\101\124\105\210\26\310\46\273\352\142\21\233\114"
+  "\63\362\362\171\255\305\127\131\266\346\246\371\24\74\150\105\250\21\22\252\301\220\137\325\157\152\261\161\143\325\301\323"
+  "\155\245\111\254\313\252\4\300\134\335\220\121\153\304\176\275\215\2\252\274\147\103\22\320\342\61\322\102\275\144\165\55"
+  "\15\251\74\154\255\223\266\65\315\156\233\145\152\357\4\141\114\116\231\217\347\156\116\141\57\116\1\62\172\57\362\73"
+  "\20\52\20\314\165\60\63\215\142\55\375\370\273\72\2\52\150\353\222\356\52\113\256\32\265\25\124\166\133\246\160\44"
+  "\3\356\346\236\11\360\215\16\312\326\247\303\350\107\125\76\37\151\216\164\315\11\321\166\174\16\151\314\357\342\67\310"
+  "\2\54\356\222\52\130\151\364\27\343\14\163\312\224\326\11\223\221\356\56\303\34\206\246\264\254\75\130\72\56\266\301"
+  "\101\52\266\306\252\143\204\64\111\276\42\301\336\116\217\324\136\52\155\145\276\377\175\335\302\22\4\24\310\55\327\105"
+  "\263\157\47\42\66\316\322\307\344\376\15\301\155\236\275\277\64\200\266\304\275\27\57\35\211\375\23\146\64\72\155\172"
+  "\154\120\265\120\374\46\214\152\67\374\161\122\224\145\344\245\163\123\221\162\121\241\216\136\47\224\137\212\122\211\12\107"
+  "\315\172\217\274\376\141\53\245\326\254\302\313\257\307\72\377\242\230\62\234\75\357\125\336\145\202\150\333\330\36\276\57"
+  "\205\206\137\276\311\322\43\261\31\75\13\145\30\142\230\153\232\371\324\272\277\222\352\156\44\136\303\17\162\235\1\206"
+  "\241\45\312\206\110\73\54\334\341\220\142\170\16\177\67\51\330\265\25\106\270\151\47\146\313\257\262\13\13\376\175\131"
+  "\226\72\351\146\31\76\56\66\122\10\214\40\253\125\161\325\112\130\23\60\356\366\132\321\252\143\171\66\311\232\306\371"
+  "\136\172\35\65\270\350\140\252\215\211\132\172\275\260\267\106\242\26\347\40\362\65\223\133\14\60\123\354\66\315\7\323"
+  "\21\46\252\16\62\67\213\133\261\346\114\162\116\112\240\52\277\377\155\7\222\226\262\365\211\314\365\1\263\220\226\240"
+  "\356\160\52\111\34\231\341\200\310\163\37\155\107\163\372\177\310\331\124\367\355\273\36\316\112\11\134\267\157\57\56\107"
+  "\167\24\243\271\364\305\377\16\61\132\103\335\174\223\33\354\170\246\350\135\60\70\276\341\235\116\366\212\41\133\141\305"
+  "\222\6\70\177\253\44\326\42\1\27\247\210\343\244\217\165\301\277\70\322\136\234\367\215\350\70\370\202\110\241\31\221"
+  "\2\242\263\204\165\223\64\316\107\343\350\347\74\364\261\237\14\207\277\371\203\363\363\254\303\32\157\355\42\364\147\132"
+  "\26\130\133\7\251\130\262\321\16\16\53\53\364\243\66\150\137\112\313\32\301\105\135\122\227\167\231\46\4\64\340\247"
+  "\130\267\273\341\56\321\154\152\352\351\271\144\273\330\134\210\346\303\350\304\23\317\103\136\14\361\362\103\24\76\141\374"
+  "\115\27\326\315\322\7\230\124\35\346\324\241\336\53\277\110\172\265\103\56\361\351\111\30\67\367\50\25\5\246\365\135"
+  "\365\266\212\145\265\24\303\225\77\274\25\257\356\321\215\44\265\344\260\366\310\253\73\100\371\366\33\6\256\144\330\373"
+  "\334\116\306\11\112\167\61\364\45\101\345\317\225\221\37\314\312\27\177\351\305\266\52\61\134\167\136\141\124\225\111\233"
+  "\123\323\345\103\220\71\101\105\75\5\3\33\345\336\220\271\123\253\243\152\206\134\314\146\110\343\132\72\263\76\355\174"
+  "\225\266\354\342\37\152\116\157\53\16\227\336\224\132\52\105\356\312\247\247\270\112\136\373\75\376\221\67\211\265\42\327"
+  "\107\130\145\351\145\222\366\112\224\61\275\34\63\17\247\11\135\255\363\3\262\102\72\163\67\176\156\260\203\146\136\273"
+  "\244\225\353\352\116\203\13\30\305\322\305\373\171\117\56\51\144\225\160\223\41\125\104\241\70\247\214\62\147\243\72\21"
+  "\130\364\370\306\53\201\342\217\33\302\367\260\41\53\100\152\36\274\322\157\141\250\247\77\51\241\105\345\46\72\134\177"
+  "\315\221\43\331\320\365\105\24\275\146\211\121\230\63\155\327\55\121\62\50\324\246\32\160\32\62\344\344\360\264\341\40"
+  "\237\155\46\215\212\247\323\170\212\314\133\144\210\42\216\324\141\11\130\250\271\207\152\332\142\267\23\365\314\62\367\21"
+  "\41\224\146\236\304\53\26\207\156\134\64\65\304\23\331\233\41\147\252\320\143\212\310\314\36\76\176\133\175\104\170\316"
+  "\252\63\142\331\32\224\17\171\225\216\303\360\35\212\224\61\257\61\134\123\354\270\271\245\366\366\323\67\64\326\151\157"
+  "\367\151\175\203\323\106\261\362\53\337\311\63\53\201\57\223\6\347\257\42\113\121\350\1\154\244\267\151\344\250\206\255"
+  "\226\320\64\6\173\162\126\134\106\50\212\230\62\276\32\226\156\306\252\176\150\24\214\50\213\130\260\306\216\321\32\326"
+  "\135\214\166\10\44\157\26\104\136\23\100\66\2\126\272\356\156\137\346\240\230\350\121\103\340\243\66\330\135\366\125\35"
+  "\267\224\47\176\131\216\301\227\127\354\301\260\312\275\252\166\147\352\110\120\162\112\52\220\372\277\334\315\250\46\235\352"
+  "\236\342\154\36\27\133\376\200\117\235\270\206\146\326\327\130\252\4\1\365\237\61\235\35\36\150\153\23\234\322\153\1"
+  "\350\274\256\162\165\21\60\166\253\102\5\14\377\74\300\337\277\242\361\33\304\176\267\17\25\242\167\137\167\154\366\17"
+  "\30\227\36\241\260\221\163\223\26\102\272\205\210\52\153\62\232\10\211\174\327\40\276\225\50\355\224\171\344\163\215\266"
+  "\250\32\232\72\143\156\263\131\215\352\335\332\42\12\136\210\372\156\277\211\52\334\273\31\147\157\26\362\375\357\336\14"
+  "\316\221\304\352\223\27\333\217\377\257\3\331\251\260\114\333\0\325\252\130\370\146\63\216\302\57\63\36\2\47\173\362"
+  "\357\342\43\202\135\344\45\365\270\17\101\310\53\255\354\275\305\74\373\40\230\42\13\351\337\131\331\110\377\261\300\112"
+  "\370\352\62\56\51\343\334\114\23\130\63\246\320\134\45\74\311\244\220\71\3\32\376\66\51\135\271\244\317\320\257\323"
+  "\63\331\226\132\326\212\140\213\153\325\277\263\351\33\375\267\202\316\241\156\147\225\242\151\154\346\21\25\135\6\365\244"
+  "\357\103\342\104\16\250\176\245\373\31\165\14\332\310\370\220\315\151\167\146\365\314\350\75\340\64\221\34\43\311\37\125"
+  "\273\14\156\344\113\241\12\112\246\243\152\141\166\74\263\166\266\312\222\231\271\330\24\226\312\330\261\237\0\355\233\43"
+  "\145\262\134\251\324\74\312\362\205\43\347\376\304\106\127\322\243\167\3\340\134\360\363\172\222\23\334\16\331\303\204\63"
+  "\261\114\374\330\73\144\327\17\123\361\60\14\366\23\267\264\206\26\4\256\104\213\54\54\322\174\375\372\344\270\356\154"
+  "\42\21\352\365\166\251\346\337\220\267\164\41\236\306\121\302\352\154\275\264\245\335\277\137\113\0\123\225\16\167\152\213"
+  "\157\242\61\202\206\245\317\207\310\75\11\211\17\317\334\355\146\231\155\242\134\324\322\301\262\115\17\52\135\341\26\333"
+  "\255\205\251\104\53\255\30\350\210\161\303\102\52\1\34\113\140\176\335\354\264\164\173\63\256\252\314\327\1\105\235\110"
+  "\241\156\210\254\321\217\271\213\105\110\74\257\156\256\201\54\231\166\176\246\312\103\164\44\51\101\303\103\314\60\77\112"
+  "\141\72\13\271\351\140\326\50\66\255\345\127\320\370\321\134\227\16\41\163\234\372\3\256\373\65\272\305\257\323\224\221"
+  "\310\315\65\207\245\326\327\51\350\254\202\102\335\365\150\372\52\170\346\211\213\245\353\317\33\252\37\20\176\367\72\113"
+  "\250\250\234\116\317\144\42\156\266\237\235\1\200\107\335\243\315\213\367\316\354\150\24\122\152\146\31\133\320\221\253\12"
+  "\335\307\245\12\214\134\353\313\115\156\110\112\172\176\243\50\57\105\33\323\50\257\16\360\126\311\17\75\317\132\57\112"
+  "\161\172\376\61\204\242\27\232\335\362\276\324\221\315\336\356\261\134\135\26\157\67\362\324\335\42\56\274\356\12\206\222"
+  "\233\112\156\354\60\237\320\15\107\213\36\242\277\343\163\147\206\223\225\202\345\167\352\353\134\205\200\367\233\142\47\104"
+  "\66\321\32\253\7\311\56\273\303\127\233\330\173\305\227\316\326\356\152\341\125\221\64\233\353\305\175\142\272\321\331\301"
+  "\171\342\367\32\67\263\164\371\333\252\365\232\206\350\72\115\305\120\376\137\62\114\315\303\303\253\263\257\376\245\15\124"
+  "\41\154\56\316\126\42\120\165\55\335\154\377\325\307\271\14\375\115\44\304\213\356\261\75\71\153\43\117\241\26\271\27"
+  "\362\26\156\111\312\344\322\310\13\342\314\223\130\6\250\145\31\341\154\175\206\150\7\171\166\264\221\20\63\236\117\254"
+  "\227\137\72\124\316\203\136\130\164\265\303\40\163\157\360\231\303\364\215\260\254\57\253\276\100\217\323\106\204\262\116\117"
+  "\253\46\201\353\242\162\331\223\212\46\107\253\201\326\246\113\371\245\347\133\52\321\53\344\15\13\40\166\65\36\335\102"
+  "\17\111\335\70\21\7\202\357\245\107\136\204\352\42\56\133\212\71\17\27\201\25\272\273\51\106\315\175\127\243\166\263"
+  "\56\105\106\45\74\350\321\10\257\316\101\120\265\270\353\23\367\206\2\34\216\164\70\6\257\270\323\34\10\276\377\63"
+  "\72\220\350\66\307\121\210\117\120\275\121\116\201\203\276\21\211\10\276\174\125\301\42\174\140\210\334\122\272\224\10\324"
+  "\145\242\153\336\253\346\66\356\61\364\270\241\305\4\121\313\355\131\212\252\131\10\130\252\361\27\106\257\52\21\75\342"
+  "\125\150\166\153\204\127\355\216\156\37\243\354\167\115\27\135\302\4\264\141\163\233\54\261\72\315\352\324\27\340\320\152"
+  "\350\103\163\71\262\320\77\213\320\341\36\267\331\236\163\363\54\374\41\267\255\313\125\30\71\221\7\147\351\231\336\325"
+  "\123\215\75\214\262\265\255\26\41\61\301\140\102\240\152\226\142\174\111\153\301\335\52\335\364\340\43\107\207\277\47\16"
+  "\326\16\353\207\210\364\323\61\364\266\30\133\322\226\253\143\152\123\240\372\221\131\132\44\322\243\170\124\367\210\241\354"
+  "\345\322\235\141\302\275\312\76\321\165\206\22\240\173\123\17\331\255\12\21\333\324\130\16\306\144\4\20\340\114\372\317"
+  "\15\354\62\106\250\160\122\11\165\113\40\66\61\327\4\136\225\112\130\341\222\307\6\147\250\120\141\223\106\25\153\267"
+  "\343\334\154\364\166\245\213\274\270\222\156\62\13\17\31\244\221\5\240\173\265\321\145\235\243\272\65\72\201\131\121\111"
+  "\146\216\201\12\53\224\212\173\160\376\260\130\173\227\71\6\230\371\243\136\317\62\10\265\231\365\237\263\121\271\245\200"
+  "\223\366\277\120\171\126\252\125\114\255\241\72\175\64\113\144\60\327\361\141\201\241\60\176\302\206\313\102\245\116\52\111"
+  "\245\111\306\136\24\263\132\371\131\35\261\162\337\226\330\101\201\44\255\312\231\53\353\226\176\145\226\117\344\115\214\13"
+  "\146\265\256\254\122\244\170\110\164\263\212\177\167\36\235\102\153\313\353\110\65\252\170\43\251\176\155\146\371\134\227\227"
+  "\52\262\226\47\70\42\163\341\155\245\305\151\173\15\133\165\261\222\305\232\234\106\147\213\132\161\205\135\70\66\140\222"
+  "\47\135\121\142\62\11\261\343\6\114\242\256\236\353\271\44\206\363\42\227\230\6\73\253\346\6\104\171\117\156\310\335"
+  "\116\127\134\116\313\235\30\102\332\31\102\156\310\20\151\317\22\34\121\311\20\346\316\353\256\45\272\223\11\165\14\341"
+  "\212\47\226\36\272\337\111\55\47\350\347\252\153\264\226\371\264\265\155\33\312\135\126\262\346\74\226\76\53\42\353\254"
+  "\202\341\137\275\64\132\334\322\371\201\72\50\122\135\15\32\372\255\77\56\351\2\125\364\240\152\344\35\251\36\241\143"
+  "\73\346\133\153\324\45\340\170\157\351\115\47\216\224\156\24\37\320\200\160\176\240\13\135\137\211\377\370\17\161\334\20"
+  "\177\1\121\375\23\325\374\64\361\51\134\112\37\376\5\21\261\3\320\114\102\0\116\167\1\240\213\257\167\206\240\37"
+  "\24\41\0\37\166\1\220\45\17\356\3\203\14\362\175\0\350\267\73\167\246\204\142\114\32\337\334\145\274\245\33\373"
+  "\316\13\122\36\312\176\343\271\337\316\316\334\231\231\354\73\323\164\76\333\153\60\147\61\354\114\4\43\33\156\57\30"
+  "\54\65\367\3\261\377\112\366\334\115\365\362\317\316\50\354\53\252\214\147\202\166\306\41\327\107\152\147\112\344\272\42"
+  "\355\274\236\264\42\152\147\10\251\216\336\131\344\150\137\164\147\122\30\234\275\323\12\54\355\317\167\336\334\65\115\320"
+  "\137\6\301\27\102\55\331\3\220\221\173\263\63\214\254\213\371\316\40\164\152\357\36\302\204\132\343\245\214\213\135\204"
+  "\236\34\351\261\35\354\73\317\141\22\257\37\216\15\314\323\155\335\176\70\76\75\225\56\177\373\341\37\214\265\157\71"
+  "\72\331\163\355\311\236\213\117\366\134\175\262\337\362\61\270\364\172\133\334\331\334\66\14\336\6\72\171\4\345\310\302"
+  "\175\374\371\306\160\320\31\252\224\20\365\260\264\361\331\340\107\345\53\17\325\166\220\330\34\145\52\237\355\17\15\234"
+  "\247\75\310\145\202\102\345\311\274\273\33\54\233\231\253\33\203\354\116\72\73\124\176\255\152\217\205\53\63\272\301\111"
+  "\124\173\343\207\13\65\120\334\147\167\123\200\351\176\34\357\271\104\255\27\366\40\227\266\270\33\346\223\317\57\6\57"
+  "\145\221\346\376\300\214\44\227\75\166\325\6\62\313\215\331\147\173\63\233\277\101\231\273\54\237\216\366\206\65\325\260"
+  "\336\355\217\27\270\376\373\354\255\1\51\307\52\57\100\261\375\304\260\11\151\231\322\176\177\130\164\7\313\14\174\272"
+  "\67\60\264\274\11\326\311\156\247\341\205\24\351\13\352\321\234\133\325\60\333\335\356\201\237\315\303\60\265\315\216\73"
+  "\141\7\353\315\136\34\323\264\55\341\76\107\303\16\132\275\21\266\307\101\131\343\161\65\212\257\153\275\24\145\120\121"
+  "\275\24\312\173\51\75\74\200\233\304\160\361\273\352\341\271\10\356\207\355\207\327\306\157\327\217\257\215\336\326\14\337"
+  "\40\166\133\13\41\13\124\66\117\167\31\137\33\270\135\17\241\56\154\133\63\272\52\150\153\75\252\233\300\212\253\245"
+  "\372\6\303\153\102\133\65\20\352\3\266\353\1\314\147\173\14\65\242\141\73\60\302\46\261\332\172\10\65\221\332\15"
+  "\0\144\213\70\333\155\21\173\355\140\135\220\266\146\364\136\262\150\223\0\355\172\10\233\205\147\153\141\154\20\234\335"
+  "\14\306\256\353\250\17\314\326\215\257\11\313\326\15\377\327\356\107\270\62\44\273\203\104\332\45\42\273\5\304\270\332"
+  "\60\337\2\212\16\307\132\235\253\365\160\66\211\306\256\207\260\101\54\166\75\200\332\110\154\72\374\177\1";
+
+/* lib/include/wasm.h (DEFLATEd, org. size 26441) */
+static unsigned char file_l_36[2960] =
+  "\245\234\133\157\354\266\21\307\337\3\344\73\10\310\103\167\215\364\234\332\307\60\26\110\123\40\50\362\120\40\111\321"
+  "\44\155\36\27\362\256\104\13\320\112\173\50\361\170\235\117\137\122\127\136\206\234\31\371\315\227\31\315\217\177\16\71"
+  "\103\255\126\37\357\262\237\176\372\337\317\177\351\262\327\274\273\34\273\352\162\276\177\70\174\170\371\153\327\277\325\105"
+  "\166\311\117\262\355\262\262\225\331\163\336\125\247\354\217\37\176\373\71\153\257\205\314\373\126\166\331\335\307\257\277\372"
+  "\372\253\157\256\62\27\227\74\153\233\123\241\177\253\232\123\255\316\105\366\367\256\77\127\115\377\341\345\37\306\350\343"
+  "\135\246\177\371\364\160\354\307\120\225\376\361\324\66\135\277\73\355\263\343\361\327\37\377\363\337\177\375\372\343\361\237"
+  "\377\376\345\267\337\177\370\345\167\375\327\357\206\313\177\163\56\312\252\51\0\247\335\156\272\340\356\156\277\333\357\365"
+  "\377\167\372\377\37\206\377\147\47\363\247\65\356\323\343\22\127\377\310\217\153\73\15\161\315\5\255\270\117\217\100\334"
+  "\262\156\163\153\304\345\226\21\227\356\210\227\113\256\261\113\160\314\203\341\72\352\162\313\250\113\167\324\313\45\255\330"
+  "\341\270\341\231\326\256\347\335\150\371\245\255\316\331\335\65\66\275\203\345\325\233\335\325\363\156\235\150\143\231\265\145"
+  "\331\25\375\367\177\313\362\272\22\315\367\217\173\355\33\235\167\42\305\154\171\365\346\72\244\320\303\207\50\16\66\5"
+  "\220\5\64\216\322\121\303\231\371\200\244\244\350\1\344\4\221\304\121\304\311\203\220\204\242\11\230\37\7\172\202\34"
+  "\350\31\162\70\166\76\312\275\215\242\34\26\105\147\121\56\213\242\301\250\44\14\250\313\375\23\135\30\155\113\126\346"
+  "\376\51\224\346\1\227\206\202\243\74\34\105\344\121\111\36\160\75\37\350\13\372\100\137\321\224\254\131\131\24\235\105"
+  "\271\54\212\6\203\146\115\250\13\51\153\126\133\262\62\244\254\11\245\41\145\215\207\243\210\74\33\262\346\323\3\135"
+  "\35\155\113\126\107\47\171\227\334\203\141\165\50\70\312\303\121\104\36\225\344\31\2\56\133\110\247\273\272\142\67\101"
+  "\174\273\154\107\171\154\313\31\355\265\145\156\210\214\237\241\31\70\26\357\165\221\17\326\20\215\361\7\200\364\350\102"
+  "\240\101\274\74\66\137\30\220\361\136\25\2\201\16\121\240\62\124\150\55\356\171\254\204\47\221\26\377\265\214\63\125"
+  "\52\103\225\326\72\237\307\252\71\16\265\52\125\362\225\132\162\343\300\115\246\3\57\233\16\320\306\210\60\351\355\205"
+  "\11\145\66\44\16\325\375\23\264\43\41\131\176\340\246\371\201\227\347\34\251\346\20\236\124\4\250\244\124\0\325\46"
+  "\251\364\26\310\304\62\233\46\7\353\323\103\162\5\302\315\132\361\371\317\35\232\120\306\50\367\132\264\40\213\264\321"
+  "\176\227\307\333\302\342\363\32\150\115\342\347\170\314\235\66\173\206\243\2\111\134\174\336\217\16\121\200\246\140\1\150"
+  "\163\26\100\123\140\0\165\317\2\320\346\54\200\272\77\166\51\4\65\136\123\131\14\52\11\241\242\20\152\241\120\20"
+  "\206\302\224\20\74\45\4\123\11\101\120\102\160\225\20\154\45\4\101\211\232\227\224\65\63\51\353\202\220\23\5\67"
+  "\47\12\166\116\24\204\234\340\51\41\230\112\10\202\22\202\253\204\140\53\41\60\45\364\306\76\355\311\351\22\21\331"
+  "\223\335\272\220\334\223\207\213\254\201\326\262\364\34\217\31\321\334\270\1\145\11\331\223\265\361\270\47\223\1\242\173"
+  "\162\4\0\331\223\315\351\244\147\1\104\367\344\10\0\272\47\217\327\124\26\203\112\102\250\50\204\132\50\24\204\201"
+  "\146\235\340\51\41\230\112\10\202\22\202\253\204\140\53\41\10\112\324\274\244\254\231\111\211\356\311\343\65\231\71\121"
+  "\260\163\202\260\23\11\236\22\202\251\204\40\50\41\270\112\10\266\22\330\236\134\216\355\250\165\156\266\17\321\317\261"
+  "\103\64\274\133\56\216\340\101\72\275\143\226\143\133\312\5\201\167\315\64\110\172\347\54\307\316\220\13\2\157\134\151"
+  "\220\272\307\100\4\37\104\154\0\21\50\110\315\237\232\172\303\324\324\350\324\10\76\210\330\0\42\322\40\143\303\140"
+  "\335\330\261\357\362\74\307\356\362\44\126\315\270\176\201\73\75\310\252\31\33\7\56\110\142\325\104\101\32\124\221\171"
+  "\325\60\100\22\253\46\12\202\254\232\261\164\162\101\304\6\20\201\202\324\374\251\251\67\114\115\215\116\215\340\203\210"
+  "\15\40\356\252\211\74\144\120\23\356\312\30\43\364\256\214\66\112\336\225\71\365\224\110\75\45\122\237\216\164\155\257"
+  "\247\246\307\203\115\166\150\274\321\56\31\62\77\237\131\147\112\143\317\72\124\152\7\354\130\333\251\147\26\203\261\147"
+  "\61\150\7\214\341\242\152\26\203\261\147\61\150\7\214\341\134\175\141\61\30\173\26\203\166\10\272\311\360\323\140\163"
+  "\131\336\31\337\6\121\304\123\276\141\101\157\170\310\342\302\122\304\330\263\24\321\16\4\105\314\145\171\212\330\40\124"
+  "\105\14\13\252\110\336\60\327\153\303\135\257\15\272\136\133\311\102\320\346\54\202\126\142\0\67\46\301\215\213\160\303"
+  "\31\272\27\336\206\141\354\171\233\326\113\215\63\110\46\203\344\62\110\302\362\60\227\345\55\17\33\204\272\74\14\13"
+  "\276\141\264\75\157\132\6\7\336\226\241\75\10\30\222\213\41\331\30\100\216\172\17\104\326\204\273\244\166\217\64\77"
+  "\170\20\234\377\303\36\311\213\324\123\42\365\224\110\175\72\322\332\43\245\203\171\75\122\64\36\330\43\271\41\247\36"
+  "\211\174\217\307\353\221\274\320\300\115\36\260\107\162\31\246\36\211\314\340\365\110\70\3\330\43\271\14\123\217\104\146"
+  "\360\172\44\234\1\354\221\134\206\251\107\42\63\170\75\22\316\20\353\221\334\247\173\346\36\211\176\317\315\357\221\146"
+  "\222\324\135\267\110\217\344\52\62\365\110\144\105\274\36\11\127\44\326\43\271\212\314\75\22\135\21\277\107\242\50\22"
+  "\351\221\274\365\332\60\327\153\303\135\257\15\272\136\307\16\205\214\340\66\50\70\101\213\356\375\67\46\301\215\213\160"
+  "\303\31\246\36\211\276\151\275\60\67\14\260\107\362\31\44\223\101\162\31\44\141\171\314\75\22\175\171\370\75\22\145"
+  "\171\104\172\44\157\303\230\172\44\372\216\341\365\110\204\55\3\354\221\2\14\311\305\220\154\14\77\107\201\307\366\363"
+  "\347\156\107\170\340\317\230\345\301\43\373\300\75\137\155\150\267\23\100\304\246\20\224\210\306\214\24\121\33\42\21\117"
+  "\105\125\123\102\16\166\244\230\306\22\11\252\377\244\67\25\102\324\321\220\24\166\60\105\342\366\122\65\47\112\334\321"
+  "\220\24\167\60\105\247\65\227\105\327\323\246\166\64\45\116\357\140\214\104\357\76\113\122\350\301\216\24\327\130\42\101"
+  "\115\253\313\375\34\305\156\217\141\4\360\243\224\260\111\206\104\320\155\57\227\307\156\225\31\74\141\303\14\360\230\26"
+  "\230\313\143\267\315\14\236\260\171\6\170\114\27\312\345\261\73\127\6\217\166\43\350\123\65\174\175\264\317\26\175\252"
+  "\206\300\223\337\370\74\332\147\13\117\176\303\171\116\355\365\255\253\4\137\244\305\161\3\331\354\13\341\271\337\63\133"
+  "\112\147\372\261\164\267\164\316\165\33\370\340\7\52\235\156\304\245\164\246\43\272\245\63\21\21\52\235\336\367\53\227"
+  "\322\231\16\351\225\316\104\114\260\164\272\101\255\322\231\216\352\227\316\104\130\270\164\272\161\255\322\231\216\353\227\316"
+  "\104\134\270\164\372\323\152\225\116\154\152\375\322\231\234\136\270\164\272\321\327\322\211\174\275\302\55\235\211\270\140\351"
+  "\364\326\316\134\72\31\37\246\6\245\63\100\0\77\117\215\224\116\117\204\271\164\62\170\202\322\111\343\211\224\116\227"
+  "\147\51\235\14\236\240\164\322\170\42\245\323\345\131\112\47\203\47\50\235\64\236\110\351\364\364\231\113\47\107\37\277"
+  "\164\22\365\251\10\265\140\51\235\34\36\277\164\22\171\340\322\351\177\57\336\56\235\14\50\270\164\322\310\42\245\63"
+  "\370\200\340\125\346\127\163\250\105\356\143\333\226\351\47\231\165\331\236\55\223\237\367\17\233\261\351\20\260\243\202\153"
+  "\234\307\236\172\132\303\57\306\107\247\206\207\37\27\221\21\124\210\240\250\14\212\242\202\126\25\331\365\135\343\74\366"
+  "\24\113\100\140\366\106\222\12\70\202\12\21\24\225\101\45\77\327\50\156\175\321\234\315\30\221\107\116\134\133\340\43"
+  "\25\153\26\314\263\146\213\155\50\202\173\127\154\262\324\103\264\76\100\214\335\20\263\214\163\350\246\130\24\42\255\2"
+  "\175\105\70\306\276\12\176\66\316\215\17\274\42\134\31\350\53\42\104\120\124\6\222\12\204\25\341\30\203\52\270\67"
+  "\341\22\53\2\124\201\260\42\102\4\105\145\120\330\215\262\266\371\122\310\36\137\24\276\161\170\107\305\111\311\351\165"
+  "\56\263\371\261\43\162\340\113\303\267\16\101\124\222\204\254\10\126\255\174\143\120\21\253\134\332\34\176\166\244\24\321"
+  "\227\126\144\20\5\202\250\44\11\246\310\271\270\264\175\101\311\124\317\72\162\327\315\45\131\355\261\203\51\71\125\75"
+  "\343\360\4\343\46\310\370\366\237\104\252\302\34\204\124\365\254\103\20\225\44\121\124\105\320\124\365\214\101\105\374\316"
+  "\56\225\252\21\105\360\124\365\254\141\105\342\44\230\42\127\331\216\331\204\327\26\337\74\162\316\165\147\307\162\110\66"
+  "\134\262\320\177\52\344\125\26\75\265\371\364\135\10\55\250\347\222\54\170\216\55\255\354\371\56\204\342\347\271\40\33"
+  "\213\155\115\52\100\276\3\241\10\171\56\110\376\70\326\224\125\345\73\20\126\226\347\222\376\206\374\320\325\35\10\337"
+  "\307\237\14\361\357\344\217\206\356\232\216\304\275\177\242\6\326\226\304\310\346\305\73\204\56\375\100\370\272\253\67\344"
+  "\350\43\117\261\41\103\161\307\41\123\2\133\103\106\42\23\207\74\56\0\112\150\370\120\2\205\366\313\131\344\144\330"
+  "\345\75\357\214\74\73\220\317\311\223\3\355\224\110\304\121\60\216\342\360\50\252\72\234\263\363\354\100\76\77\117\16"
+  "\14\165\70\347\150\7\107\161\170\50\147\50\152\356\4\16\344\23\145\64\167\240\363\24\65\167\140\34\305\341\41\253"
+  "\303\71\145\372\271\203\236\362\242\271\23\125\207\163\342\14\162\207\314\263\252\23\256\255\213\356\371\345\333\261\253\376"
+  "\54\166\120\174\347\377\320\33\122\107\203\17\306\300\175\103\152\20\103\310\366\65\135\305\154\303\144\21\233\202\32\103"
+  "\133\353\365\315\76\323\225\312\252\256\247\67\373\234\327\147\241\277\254\77\66\11\214\301\131\273\151\363\46\376\246\46"
+  "\357\1\351\211\314\370\356\27\347\50\237\271\151\273\362\215\77\164\64\272\301\125\73\165\60\35\364\72\251\211\315\170"
+  "\356\27\327\65\57\372\27\131\344\347\56\333\165\57\271\54\316\331\150\276\317\362\276\275\124\247\356\273\354\232\135\124"
+  "\327\147\317\105\326\344\275\222\171\135\277\215\357\62\322\306\343\213\173\301\357\215\14\356\214\27\266\332\16\244\167\117"
+  "\216\16\33\136\337\312\103\363\34\110\257\360\113\240\35\342\157\315\233\302\160\137\236\347\270\121\337\57\66\21\156\170"
+  "\225\136\224\62\275\271\22\51\275\347\136\23\224\376\133\343\142\31\50\57\257\303\307\230\154\101\147\307\31\326\312\107"
+  "\104\125\355\151\76\2\305\164\215\45\46\104\114\22\27\40\236\323\24\121\70\102\314\321\330\174\64\273\111\143\343\270"
+  "\115\143\355\371\36\215\175\142\262\306\36\61\103\143\200\230\225\307\315\326\74\156\66\347\161\363\276\74\156\266\346\161"
+  "\263\71\217\233\167\345\161\53\267\111\254\375\266\51\334\312\367\10\354\341\222\365\165\161\31\362\206\270\34\165\157\133"
+  "\345\275\155\326\367\366\76\201\157\133\25\276\155\226\370\366\116\215\117\57\142\243\310\306\163\243\312\332\365\135\62\373"
+  "\320\164\235\75\150\216\320\0\64\107\351\323\345\12\213\135\254\77\112\202\356\363\165\364\25\264\247\114\252\237\236\206"
+  "\351\112\360\114\14\327\246\114\6\64\256\301\270\130\177\224\204\251\201\307\5\117\120\172\246\42\343\72\200\343\12\316"
+  "\240\23\322\153\136\365\336\73\137\255\331\32\106\325\164\211\303\227\173\231\61\260\166\100\147\153\35\325\164\26\233\6"
+  "\66\136\50\72\127\372\322\304\101\75\75\46\247\212\72\50\175\31\164\120\300\124\205\203\172\172\214\116\24\155\120\115"
+  "\333\127\345\133\70\123\15\76\220\311\365\72\35\220\221\135\314\145\37\175\341\11\201\316\363\123\310\262\150\116\360\175"
+  "\24\327\300\72\361\214\321\247\260\303\277\307\333\50\377\7";
+
+/* lib/include/wasm_simd128.h (DEFLATEd, org. size 45138) */
+static unsigned char file_l_37[4821] =
+  "\355\135\353\157\343\306\21\377\36\340\376\7\2\1\12\313\325\135\254\207\155\45\271\244\50\332\174\10\160\111\321\74"
+  "\332\57\5\4\132\342\322\102\150\111\107\162\356\164\327\336\377\336\175\221\134\76\166\147\206\222\13\24\110\20\237\151"
+  "\161\36\277\171\354\316\54\271\244\276\270\216\336\274\371\307\17\57\213\362\103\226\104\377\374\363\317\77\104\77\177\377"
+  "\303\137\147\363\125\164\375\305\213\317\136\174\366\371\61\217\323\247\70\72\354\67\211\372\373\213\353\350\235\74\273\56"
+  "\243\135\21\75\300\56\53\137\356\366\232\366\363\335\176\223\301\66\211\136\27\345\166\267\57\137\75\176\333\146\170\37"
+  "\27\117\153\175\234\35\342\355\325\346\260\57\312\350\335\141\267\215\256\217\223\257\215\214\155\42\166\373\244\113\172\234"
+  "\104\127\127\106\312\325\365\304\341\274\236\114\44\245\76\365\112\121\106\7\41\212\244\374\346\46\212\263\135\272\377\146"
+  "\166\67\221\314\223\20\216\325\272\70\146\161\311\200\123\161\220\121\131\206\36\70\24\333\354\216\15\256\146\41\243\253"
+  "\70\272\360\346\50\274\305\234\15\257\146\41\303\253\70\272\360\226\50\274\273\45\33\136\315\102\206\127\161\164\341\255"
+  "\174\360\166\263\273\223\315\243\323\12\207\326\46\247\247\234\144\52\310\11\7\74\114\60\36\23\220\61\355\26\363\323"
+  "\322\246\364\151\111\160\124\233\236\221\376\222\255\40\47\77\60\141\301\71\260\200\14\153\167\267\74\315\355\10\73\315"
+  "\11\336\152\323\63\106\243\144\53\310\143\21\230\260\340\34\130\300\237\42\344\344\362\61\311\17\75\140\57\137\106\352"
+  "\164\21\145\261\204\166\43\253\137\366\341\117\341\151\115\313\351\0\226\125\120\236\51\373\63\232\42\356\241\215\156\50"
+  "\123\332\105\360\126\162\110\170\55\161\157\206\43\340\225\377\112\100\155\270\323\212\364\335\64\222\12\243\335\44\132\257"
+  "\177\372\356\357\277\176\377\323\167\353\277\374\355\307\237\177\371\363\217\277\134\355\220\22\254\345\52\131\123\45\300\223"
+  "\45\225\252\136\75\326\156\352\316\104\122\220\226\210\326\344\347\261\251\22\74\322\50\313\336\233\61\150\126\311\260\77"
+  "\217\125\225\340\221\126\131\366\376\130\41\131\45\63\367\171\254\252\4\217\264\312\262\367\107\124\317\52\5\271\121\135"
+  "\224\207\74\271\352\332\21\173\241\32\172\111\31\153\204\222\117\341\363\41\323\324\203\35\264\22\20\202\144\207\343\205"
+  "\34\354\212\34\164\160\320\0\362\340\36\260\243\32\202\227\64\44\70\254\203\226\320\107\364\200\51\325\270\273\244\51"
+  "\301\261\34\64\205\76\214\7\114\251\6\333\45\115\11\16\340\240\51\264\261\333\157\320\126\47\31\117\75\65\250\62"
+  "\253\76\337\334\114\243\127\257\136\151\53\364\337\263\333\101\123\152\72\105\60\324\313\71\242\25\355\146\46\177\346\362"
+  "\147\41\177\226\362\347\126\376\334\311\237\173\371\263\222\77\137\52\32\115\250\50\147\212\164\246\150\147\113\243\43\372"
+  "\327\213\317\42\351\221\142\367\264\175\155\300\115\243\331\335\267\223\177\137\102\374\247\301\106\321\261\1\272\376\201\63"
+  "\35\4\317\352\40\370\337\170\310\54\4\353\4\222\6\265\63\310\174\160\217\70\350\336\277\306\244\370\247\227\32\112"
+  "\353\64\132\241\206\177\362\57\73\233\240\267\155\202\363\214\202\221\106\301\271\126\231\205\150\35\50\325\120\153\243\352"
+  "\343\231\163\74\167\216\27\210\231\13\377\262\167\310\314\136\254\224\226\151\264\354\131\365\311\277\316\155\142\123\233\1"
+  "\256\35\340\32\2\347\131\2\104\113\200\153\212\131\353\326\1\221\23\170\35\20\163\74\363\302\225\247\274\213\147\27"
+  "\151\317\327\112\360\64\232\327\0\77\371\127\307\215\217\153\144\60\32\32\40\320\200\212\115\70\321\20\262\147\155\22"
+  "\300\371\153\326\372\153\336\372\153\124\16\10\142\16\324\172\310\111\40\34\307\150\356\332\331\316\137\76\157\17\177\74"
+  "\30\0\201\4\240\326\326\217\100\250\147\260\227\45\253\102\70\14\10\151\16\252\253\241\262\331\351\367\15\22\6\375"
+  "\377\11\122\302\255\46\340\303\5\77\134\270\54\134\247\350\65\316\65\365\206\341\335\236\220\306\273\156\375\141\170\261"
+  "\47\21\106\340\2\77\56\30\207\313\251\63\215\273\314\110\147\270\253\47\244\161\227\73\362\21\27\365\244\300\10\54"
+  "\340\307\2\164\54\116\51\150\334\142\46\23\206\133\172\102\32\267\270\323\211\327\41\75\176\30\201\2\374\50\200\202"
+  "\102\364\34\352\124\3\72\14\341\217\213\240\307\105\364\214\161\246\171\6\30\277\117\4\305\47\146\212\155\315\335\261"
+  "\177\226\66\164\161\357\232\154\275\12\325\144\257\64\331\344\52\16\314\302\355\371\67\366\317\264\203\52\201\240\323\212"
+  "\166\320\47\247\62\217\67\245\135\253\333\113\123\354\45\372\200\254\330\56\320\215\112\275\100\167\126\346\6\237\313\260"
+  "\56\324\132\274\201\12\56\126\270\40\126\360\143\5\62\130\150\203\355\147\117\236\110\337\157\222\101\254\365\265\203\7"
+  "\256\207\133\122\225\270\251\222\321\272\12\242\217\52\15\56\176\227\127\243\127\274\376\144\14\33\0\174\13\200\151\1"
+  "\234\141\202\51\343\355\6\41\366\267\2\276\41\254\370\254\176\105\207\214\141\107\24\4\225\202\137\51\120\264\126\302"
+  "\35\13\56\64\214\373\262\234\141\254\164\366\206\206\106\210\215\343\6\55\134\20\55\370\321\2\35\156\150\44\153\5"
+  "\350\110\326\326\75\160\275\314\32\312\335\224\240\217\145\202\11\60\302\6\140\332\0\347\30\141\272\314\166\377\32\373"
+  "\73\125\337\150\156\156\222\152\72\144\64\73\242\40\250\24\374\112\201\242\265\22\356\130\160\241\321\334\227\345\214\146"
+  "\245\263\67\74\64\102\227\243\77\226\33\254\160\101\254\340\307\12\43\301\366\63\10\35\311\332\266\7\256\207\131\43"
+  "\271\233\16\364\221\114\60\1\106\330\0\114\33\340\34\43\314\302\250\275\344\212\375\213\53\337\110\126\174\126\277\242"
+  "\103\106\262\43\12\202\112\301\257\24\50\132\53\341\216\5\27\32\311\175\131\316\110\126\72\173\203\103\43\14\217\344"
+  "\6\53\134\20\53\370\261\302\110\260\375\14\102\107\262\266\355\201\353\141\326\110\356\246\3\175\44\23\114\200\21\66"
+  "\0\323\6\70\307\10\341\124\275\346\212\101\354\277\66\60\70\254\152\116\203\101\14\127\310\106\276\43\357\62\331\52"
+  "\374\165\247\326\332\115\127\301\50\74\202\60\153\67\346\75\160\201\323\203\75\350\151\172\264\235\231\261\271\44\23\373"
+  "\57\276\370\243\335\144\234\30\236\105\33\371\216\274\13\105\333\77\67\325\132\173\321\146\114\116\202\60\262\33\363\36"
+  "\270\300\231\321\356\172\332\37\155\317\65\214\247\370\267\44\264\355\301\173\231\102\63\136\362\236\275\347\22\310\45\117"
+  "\374\256\210\55\317\136\133\225\141\232\106\46\140\113\165\244\343\267\120\107\72\234\163\165\244\243\73\123\107\72\330\67"
+  "\362\110\205\376\113\371\133\213\215\42\225\15\53\371\347\275\276\271\77\215\124\226\334\311\337\52\143\224\2\45\137\211"
+  "\137\350\373\212\323\110\311\326\242\365\335\272\151\244\344\336\4\256\147\351\234\14\156\122\361\136\263\172\236\164\6\237"
+  "\353\57\162\342\167\105\154\171\377\47\351\154\56\37\125\163\263\167\107\221\367\302\23\41\233\333\323\156\357\122\317\45"
+  "\117\134\132\121\117\236\215\352\205\247\224\306\223\341\55\120\336\113\147\334\50\200\317\7\27\71\161\151\105\75\171\317"
+  "\22\5\163\371\245\32\11\234\55\133\336\153\71\3\141\151\17\206\176\333\315\374\274\57\315\372\206\231\201\15\334\21"
+  "\33\275\274\327\201\60\373\301\143\47\375\363\276\264\121\366\233\5\173\25\373\241\335\141\336\125\276\143\143\73\266\375"
+  "\46\273\167\55\12\213\112\243\300\273\65\314\273\162\367\341\2\17\56\240\343\22\115\160\107\156\13\363\56\101\261\214"
+  "\21\236\314\240\177\336\227\66\52\143\104\343\344\300\126\62\357\342\313\27\35\341\211\216\10\104\307\263\336\112\336\72"
+  "\313\105\173\364\20\270\335\376\326\54\341\6\127\200\3\367\257\337\206\56\314\152\211\255\365\52\16\300\254\102\311\0"
+  "\366\11\12\40\53\131\0\44\71\7\100\126\256\13\364\276\67\31\2\214\204\0\250\27\122\236\27\122\36\204\224\342"
+  "\205\224\347\5\76\4\334\13\31\57\31\63\136\62\146\11\45\27\22\136\56\260\41\20\162\201\347\205\224\7\41\245"
+  "\170\41\345\171\201\17\1\302\327\242\314\155\176\362\334\130\221\23\101\230\35\1\157\321\315\44\364\271\261\42\347\0"
+  "\10\317\215\346\311\375\222\5\200\76\61\151\0\330\334\310\203\0\43\41\0\352\205\224\347\205\224\7\41\245\170\41"
+  "\345\171\201\17\1\367\102\306\113\306\214\227\214\330\334\310\203\0\43\41\20\162\201\347\205\224\7\41\245\170\41\345"
+  "\171\201\17\1\231\33\315\355\53\362\334\130\221\23\101\230\33\135\157\321\255\71\364\271\261\42\347\0\10\317\215\346"
+  "\115\35\45\13\0\175\142\322\0\260\271\221\7\1\106\102\0\324\13\51\317\13\51\17\102\112\361\102\312\363\2\37"
+  "\2\356\205\214\227\214\31\57\31\261\271\221\7\1\106\102\40\344\2\317\13\51\17\102\112\361\102\312\363\2\37\2"
+  "\62\67\232\233\275\344\271\261\42\47\202\60\267\205\337\242\233\235\350\163\143\105\316\1\20\236\33\315\173\171\112\26"
+  "\0\372\304\244\1\40\163\243\221\231\362\40\244\74\10\51\5\102\306\13\103\306\13\3\62\53\130\263\170\20\122\36"
+  "\204\356\220\364\134\3\44\217\7\301\353\25\4\336\53\10\136\257\40\170\275\202\300\173\5\301\53\324\202\127\250\205"
+  "\55\324\50\200\224\7\40\345\1\110\161\0\31\57\4\31\57\4\31\36\202\224\7\40\345\1\110\223\360\70\340\325"
+  "\5\301\253\13\2\257\13\202\127\27\4\257\56\10\274\56\10\136\135\20\274\272\40\154\135\100\1\244\74\0\51\17"
+  "\100\212\3\310\170\41\310\170\41\310\360\20\244\74\0\51\17\0\62\16\364\361\376\320\4\301\373\356\35\105\24\17"
+  "\151\165\336\262\43\151\174\273\342\364\161\274\337\22\155\255\311\151\266\152\355\222\74\340\154\175\174\310\71\372\45\65"
+  "\103\375\41\307\264\237\170\352\117\74\375\47\34\200\364\220\33\153\132\10\164\340\131\121\60\151\340\42\171\70\34\262"
+  "\226\324\17\353\62\207\4\317\272\232\122\247\236\22\63\230\170\25\131\60\373\36\166\145\221\144\311\146\310\1\365\321"
+  "\123\134\374\346\105\323\110\120\326\115\15\161\300\55\3\356\251\105\114\134\31\241\33\202\361\103\21\364\123\103\25\30"
+  "\236\346\62\273\44\12\77\260\272\117\122\202\56\105\205\352\222\104\256\256\46\3\54\336\54\303\123\240\103\352\315\1"
+  "\153\235\245\363\77\254\144\344\311\20\50\247\23\64\127\224\161\360\21\44\255\334\222\206\335\173\74\34\67\373\222\240"
+  "\330\22\242\116\66\164\141\245\305\143\346\44\274\363\164\220\377\141\166\311\161\122\357\103\243\74\373\143\236\61\177\314"
+  "\46\206\45\204\43\147\343\310\331\70\162\265\0\362\42\1\66\22\70\3\11\240\76\211\267\133\326\235\75\105\317\271"
+  "\257\46\351\321\233\213\222\146\135\304\45\27\207\346\141\142\121\74\204\173\215\74\104\160\66\42\374\6\154\1\17\54"
+  "\377\50\172\16\22\111\117\301\300\216\123\305\303\304\102\214\23\17\21\234\215\10\217\323\323\156\317\362\217\242\347\40"
+  "\221\364\4\277\320\121\300\150\24\4\137\304\47\236\57\44\75\13\105\174\242\370\202\214\2\106\243\0\174\106\171\227"
+  "\346\274\351\104\61\260\346\22\311\100\332\303\200\266\163\65\125\250\372\353\73\203\241\166\316\356\77\110\11\272\260\166"
+  "\316\356\115\360\265\163\6\57\251\235\153\223\372\333\71\143\35\336\316\151\171\244\166\256\105\31\156\347\264\162\254\235"
+  "\63\373\231\71\235\125\315\101\356\43\314\173\77\302\235\225\225\232\263\161\344\154\34\110\147\305\106\2\147\40\1\324"
+  "\47\214\316\252\246\347\334\225\107\72\253\112\46\247\142\267\170\230\130\360\212\75\2\21\234\215\10\337\276\301\350\254"
+  "\152\172\16\22\244\263\252\144\262\343\304\354\143\52\54\304\70\61\73\253\163\20\241\336\171\202\214\345\31\105\317\301"
+  "\40\351\161\14\364\276\256\246\147\141\300\372\72\46\12\30\215\2\37\61\214\276\256\246\147\241\300\372\72\46\12\30"
+  "\215\2\360\371\214\321\327\65\14\254\231\214\320\327\351\373\123\150\137\127\123\205\172\55\175\357\52\324\327\331\373\241"
+  "\51\101\27\326\327\331\173\245\276\276\316\340\45\365\165\155\122\177\137\147\254\303\373\72\55\217\324\327\265\50\143\374"
+  "\115\101\130\137\147\236\54\341\364\165\65\7\271\213\61\357\267\10\367\165\126\152\316\306\221\263\161\40\175\35\33\11"
+  "\234\201\4\120\237\60\372\272\232\236\263\243\10\351\353\214\155\364\236\245\246\347\140\100\252\262\171\342\212\136\225\153"
+  "\172\16\6\244\52\33\231\364\252\134\323\263\60\140\125\231\211\2\106\243\300\267\332\61\252\162\115\317\102\201\125\145"
+  "\46\12\30\215\2\367\305\366\120\232\336\203\345\221\206\213\203\250\346\102\66\76\231\355\124\150\221\256\251\102\205\123"
+  "\337\130\17\25\151\273\131\43\45\350\302\212\264\335\310\341\53\322\6\57\251\110\267\111\375\105\332\130\207\27\151\55"
+  "\217\124\244\133\224\341\42\255\225\143\105\332\74\124\311\51\322\65\7\271\44\231\327\22\205\213\264\225\232\263\161\344"
+  "\154\34\110\221\146\43\201\63\220\0\352\23\106\221\256\351\71\333\34\221\42\155\154\243\27\351\232\236\203\1\51\322"
+  "\346\161\141\172\221\256\351\71\30\72\105\332\263\321\16\233\364\4\145\145\42\260\225\211\40\255\114\4\145\145\42\206"
+  "\126\46\3\357\235\173\233\227\4\145\232\14\325\246\250\302\352\66\311\56\43\250\323\144\250\72\105\25\126\47\262\203"
+  "\263\135\310\257\317\320\241\12\65\131\130\243\234\357\367\33\202\106\103\207\152\324\144\130\266\304\171\122\224\244\214\61"
+  "\224\204\254\321\204\141\275\364\371\111\60\27\21\202\260\210\20\314\105\204\140\56\42\4\141\21\41\230\213\10\301\134"
+  "\104\10\302\42\302\310\334\356\336\261\60\50\172\16\6\111\217\373\201\274\204\20\314\45\204\250\226\20\70\6\162\353"
+  "\56\230\255\273\250\132\167\24\303\221\353\210\43\327\23\107\212\53\216\134\137\34\271\316\70\166\274\341\331\232\213\126"
+  "\116\312\162\101\140\313\5\101\132\56\10\312\162\101\14\55\27\6\336\341\211\126\316\206\14\325\26\254\234\346\233\126"
+  "\320\312\331\220\241\352\202\225\123\313\41\124\116\207\16\125\30\256\234\132\22\241\162\72\164\250\306\160\345\264\171\100"
+  "\250\234\55\112\102\326\204\53\47\263\263\27\314\316\136\20\72\173\301\354\354\5\263\263\27\204\316\136\60\73\173\301"
+  "\354\354\305\120\147\77\210\201\121\71\153\172\16\6\244\162\32\273\350\5\243\246\147\371\41\134\56\354\113\231\116\74"
+  "\14\364\142\141\60\204\53\247\226\171\344\72\342\310\365\304\221\342\212\43\327\27\107\256\63\320\312\271\153\326\10\372"
+  "\146\267\56\270\204\233\70\135\16\364\316\125\207\141\135\204\277\305\203\203\10\56\203\10\220\5\345\141\377\56\311\113"
+  "\143\77\145\145\331\242\307\227\230\56\371\272\240\141\1\46\26\30\203\5\220\166\301\22\147\207\367\24\337\170\170\360"
+  "\106\242\313\262\56\350\270\140\4\56\30\213\13\302\267\53\235\264\323\72\77\46\371\201\67\340\32\66\116\216\233\342"
+  "\252\371\310\103\217\6\20\56\10\20\202\0\355\232\62\171\72\224\11\25\235\217\7\35\5\75\226\160\276\35\363\203"
+  "\246\127\211\40\210\371\326\347\101\363\255\307\342\242\372\55\203\64\371\52\132\257\133\217\145\200\20\131\22\31\355\333"
+  "\350\41\221\254\55\100\3\324\366\151\247\113\276\100\173\355\125\143\336\276\174\165\165\265\271\211\242\77\104\67\47\361"
+  "\353\233\67\223\350\365\353\350\356\146\22\375\107\236\331\314\344\347\356\211\333\73\173\142\336\341\270\235\333\23\213\316"
+  "\211\345\112\235\260\157\172\126\4\313\56\301\322\162\336\166\164\55\53\20\167\35\216\105\5\342\276\173\142\336\321\265"
+  "\352\20\314\127\226\363\313\216\256\171\5\142\166\323\341\250\75\61\153\237\230\335\165\164\315\346\35\202\312\43\263\105"
+  "\373\104\124\201\230\55\73\47\152\20\267\315\11\365\137\340\141\41\23\316\241\47\365\220\367\267\7\277\272\72\364\205"
+  "\5\317\230\251\317\253\45\264\63\170\214\33\357\61\57\336\207\166\26\123\315\163\136\156\355\367\217\372\6\357\353\171"
+  "\365\73\372\243\172\305\253\172\223\252\372\314\246\250\371\263\72\65\267\344\163\347\263\205\375\154\341\174\266\154\213\130"
+  "\72\247\156\55\371\255\363\331\235\375\354\316\371\354\276\55\342\336\236\12\156\350\31\23\216\5\26\216\105\150\103\220"
+  "\77\34\104\357\57\253\337\225\335\366\330\265\335\176\264\260\301\131\126\277\235\200\131\226\372\170\341\260\317\55\313\334"
+  "\141\231\73\54\163\107\374\102\323\326\254\13\207\145\341\260\330\343\105\360\316\55\55\32\315\364\342\17\104\350\125\323"
+  "\103\61\40\372\176\125\375\166\174\277\352\373\176\125\71\307\36\57\235\343\133\347\370\316\71\276\157\17\240\225\15\315"
+  "\312\11\331\312\11\331\312\11\257\125\321\142\257\64\315\34\115\366\370\336\304\240\156\16\374\66\27\344\47\302\154\13"
+  "\122\20\276\300\246\170\277\373\370\221\371\36\331\212\207\365\224\232\341\41\40\332\307\171\256\232\173\316\26\231\76\43"
+  "\353\255\313\16\43\341\241\255\21\0\341\202\0\361\75\320\25\171\253\53\46\275\221\325\145\144\275\233\325\141\44\154"
+  "\217\36\1\20\56\10\20\367\140\162\52\223\375\326\54\62\125\4\10\217\117\365\130\320\207\306\272\34\153\344\171\65"
+  "\113\377\270\113\37\271\250\34\36\52\254\206\45\160\355\250\153\71\240\260\74\54\174\147\1\11\224\266\202\211\312\341"
+  "\31\341\54\344\162\204\153\107\153\2\11\176\75\155\233\5\135\345\167\71\326\5\11\224\261\202\207\312\341\241\302\152"
+  "\130\260\253\222\156\232\240\260\74\54\174\147\1\11\224\311\22\36\52\207\147\204\263\40\274\345\317\265\3\277\252\74"
+  "\314\202\356\265\354\162\70\21\14\303\62\166\360\160\71\74\124\140\15\113\40\267\272\266\343\227\53\75\54\174\167\1"
+  "\11\224\311\23\36\52\207\147\204\263\0\55\75\352\241\305\143\274\313\337\357\212\204\123\176\6\370\50\263\152\237\215"
+  "\120\206\132\114\214\131\177\200\157\44\106\174\366\157\63\321\47\333\1\76\312\34\322\147\43\114\272\155\177\320\347\270"
+  "\1\276\221\30\361\174\174\202\154\240\77\43\175\361\101\227\231\365\65\10\35\346\360\113\115\135\175\3\175\33\3\255"
+  "\333\301\361\341\166\232\271\160\167\356\230\10\14\270\36\346\263\234\13\124\260\3\175\36\3\255\333\361\235\345\134\374"
+  "\351\17\327\104\366\103\40\75\146\326\113\352\73\314\341\314\165\365\15\364\205\14\264\156\207\310\207\333\151\26\303\17"
+  "\370\270\311\307\131\235\17\63\237\345\134\240\202\35\350\43\31\150\335\216\362\54\347\2\272\135\337\65\221\163\145\141"
+  "\230\231\365\12\361\16\63\341\105\322\55\3\307\242\165\373\117\76\334\116\53\32\376\252\173\67\371\70\127\105\206\231"
+  "\317\162\56\120\301\16\164\251\14\264\156\277\172\226\163\361\253\71\157\147\267\222\47\147\277\305\302\345\343\324\5\207"
+  "\157\350\271\273\144\123\36\362\350\51\56\37\277\212\262\335\103\36\347\37\42\1\373\115\271\73\354\213\110\344\207\247"
+  "\250\174\264\100\212\335\323\126\312\217\236\16\133\310\222\257\243\74\51\40\53\213\27\237\105\327\121\234\113\242\135\371"
+  "\270\333\107\161\44\222\367\21\144\307\42\72\10\315\135\154\342\54\66\132\32\341\137\107\73\21\305\373\17\221\371\176"
+  "\163\111\14\245\26\145\231\362\170\237\46\321\143\274\337\146\352\316\365\7\375\241\305\273\71\154\223\350\112\312\114\223"
+  "\151\124\356\366\37\324\67\111\212\151\264\217\367\223\251\42\324\202\336\77\36\262\232\105\52\330\34\236\216\120\112\141"
+  "\132\343\203\325\374\156\27\273\40\33\343\125\40\174\157\243\76\35\273\115\250\132\306\344\173\224\326\377\162\343\103\112"
+  "\26\331\246\365\357\276\164\66\272\141\42\333\264\201\215\65\5\131\144\233\326\377\206\173\232\57\7\150\375\57\114\247"
+  "\371\162\200\326\377\14\10\315\227\3\264\201\215\134\5\131\144\327\227\377\5";
 
 /* lib/include/wchar.h (DEFLATEd, org. size 292) */
 static unsigned char file_l_38[159] =
@@ -3045,1392 +3265,1951 @@ static unsigned char file_l_38[159] =
   "\230\26\153\371\1\332\256\167\300\27\216\207\143\136\226\331\230\37\226\333\266\305\204\223\211\365\306\331\174\176\6\276"
   "\47\206\353\235\321\372\366\376\313\171\57\77\73\134\334\262\121\124\160\227\112\204\17\112\360\121\165\175\166\1";
 
-/* lib/math.wo (DEFLATEd, org. size 168538) */
-static unsigned char file_l_39[14260] =
-  "\214\126\167\163\333\76\26\374\373\332\167\340\351\122\344\124\200\115\200\123\310\364\344\327\173\335\73\5\65\126\42\121\12"
-  "\105\367\233\174\366\3\100\131\215\216\117\36\316\140\275\170\157\337\242\12\375\311\124\37\216\115\164\155\42\232\203\177"
-  "\374\65\212\372\243\311\154\132\67\121\117\325\115\57\352\315\147\327\172\121\377\335\170\52\305\70\272\346\270\175\307\104"
-  "\375\311\141\23\215\222\170\157\157\357\222\234\211\231\114\353\123\227\326\202\66\155\201\111\310\330\255\112\50\260\21\155"
-  "\115\165\324\363\115\55\106\163\143\116\224\231\65\56\321\36\126\52\272\346\73\367\67\272\242\376\114\324\142\262\356\124"
-  "\213\106\264\203\335\227\263\350\110\324\221\30\217\336\125\217\130\324\3\41\333\237\45\305\145\54\53\172\35\65\75\33"
-  "\36\134\255\327\371\112\220\4\222\301\304\227\353\215\167\325\313\241\11\224\175\6\43\141\365\127\217\273\152\177\230\172"
-  "\332\125\333\375\143\244\253\171\40\306\57\377\257\246\41\305\245\54\244\355\52\216\253\370\365\233\256\144\233\140\315\323"
-  "\173\60\171\321\141\76\47\365\325\267\233\122\107\17\117\63\30\313\141\304\243\65\14\251\273\351\337\357\264\65\154\12"
-  "\112\100\351\352\23\24\322\202\145\77\303\32\120\16\341\142\351\37\5\344\0\132\102\10\360\100\53\3\232\102\132\376"
-  "\203\367\317\162\50\1\145\241\311\343\273\120\11\232\312\47\130\15\46\40\115\327\335\117\233\356\324\317\376\17\72\53"
-  "\316\140\315\206\45\105\13\107\75\201\114\100\45\244\360\6\205\54\234\233\34\304\125\116\141\123\15\236\27\340\11\130"
-  "\132\301\160\230\344\6\130\134\364\101\222\137\240\70\172\223\111\1\232\201\45\355\244\103\61\150\371\153\1\102\15\154"
-  "\354\77\315\236\77\53\16\174\145\246\101\5\354\340\6\51\40\162\360\170\0\341\130\366\11\64\55\274\272\30\300\222"
-  "\30\304\102\62\320\270\230\377\370\326\251\101\311\103\330\4\322\100\247\147\220\266\231\335\202\225\227\354\344\121\65\152"
-  "\206\357\77\254\315\100\352\327\47\136\133\234\144\15\247\153\70\137\342\256\354\167\157\246\361\147\326\274\204\225\377\204"
-  "\345\33\33\371\356\363\346\361\372\361\0\147\57\141\331\303\45\367\366\173\50\165\362\140\43\206\205\125\260\204\257\264"
-  "\243\353\147\154\43\246\7\26\303\44\371\172\61\120\15\233\214\262\256\355\346\170\72\234\36\231\172\70\33\155\315\210"
-  "\253\145\71\204\237\227\347\337\124\136\304\252\75\320\314\43\115\177\305\315\0\164\12\353\51\31\326\300\327\172\10\316"
-  "\301\75\367\4\234\74\163\255\372\36\326\370\150\351\242\14\204\14\170\40\240\174\324\176\165\55\50\305\137\77\165\355"
-  "\33\220\34\46\170\156\140\304\275\140\136\201\307\320\324\143\43\101\165\53\267\7\111\135\137\140\331\143\210\101\360\230"
-  "\145\140\301\63\244\14\331\134\301\160\260\64\24\115\157\314\274\261\117\303\120\62\7\247\334\241\37\301\22\276\210\265"
-  "\151\100\114\16\333\234\76\54\207\324\101\233\201\332\260\40\332\300\132\360\120\221\70\300\100\262\340\224\336\207\261\36"
-  "\125\177\70\11\7\46\240\166\342\11\145\77\345\355\250\224\14\163\367\362\133\310\40\300\215\55\374\206\200\21\301\226"
-  "\24\270\171\350\201\311\140\44\224\17\172\164\16\113\203\207\1\7\151\323\342\37\300\104\340\344\7\230\200\250\205\244"
-  "\101\204\260\177\203\171\327\44\234\102\102\234\200\172\31\242\11\204\113\40\44\202\124\120\336\155\16\233\202\7\5\223"
-  "\100\160\120\237\371\37\1\116\133\55\120\11\23\354\263\14\234\33\217\4\1\115\207\201\323\345\101\150\11\64\203\265"
-  "\36\337\234\177\175\161\144\362\40\242\304\57\240\131\100\34\202\315\203\45\23\277\165\355\7\60\5\165\371\261\252\146"
-  "\243\151\74\74\70\336\332\234\213\3\25\332\246\374\57\64\7\215\333\163\106\171\171\366\36\324\266\154\257\204\224\260"
-  "\372\172\350\334\53\367\137\336\161\335\367\113\340\25\15\21\56\213\253\17\351\42\54\53\241\45\230\35\204\160\136\206"
-  "\113\57\335\167\151\17\313\77\240\331\43\227\134\224\137\175\52\275\300\223\162\14\112\236\6\231\247\45\230\202\210\237"
-  "\5\271\347\45\204\112\137\54\104\135\253\44\124\376\162\41\376\252\204\221\277\275\16\45\336\224\335\61\73\124\35\214"
-  "\66\57\223\157\41\245\0\311\336\71\141\150\135\200\262\273\317\177\12\3\66\274\0\227\260\71\30\205\216\101\344\34"
-  "\306\256\107\130\136\134\136\145\274\375\233\156\142\163\37\75\14\354\355\263\207\40\3\0\64\115\156\100\170\355\207\220"
-  "\32\112\302\222\63\60\346\172\147\133\41\234\76\274\244\314\117\133\45\352\345\217\15\124\12\43\301\31\70\137\174\212"
-  "\103\132\130\13\226\264\173\374\332\33\250\270\370\10\232\377\13\326\100\345\37\41\25\244\255\242\257\240\62\50\375\2"
-  "\162\120\114\300\105\3\141\141\143\110\2\231\100\332\357\37\101\23\10\142\121\103\322\302\105\300\152\150\363\303\335\160"
-  "\11\151\110\353\253\327\107\327\276\74\207\340\305\375\361\373\73\317\41\123\210\330\167\121\12\55\320\203\111\366\175\60"
-  "\47\213\51\14\157\305\305\330\354\114\215\305\174\76\262\247\121\337\234\264\57\314\25\327\306\107\27\157\310\153\47\221"
-  "\315\323\275\250\137\233\371\341\270\175\375\106\213\210\361\124\371\167\153\155\232\43\327\206\236\13\156\62\77\336\44\306"
-  "\333\304\160\350\304\274\162\20\363\175\367\324\264\232\67\121\332\22\41\354\336\334\64\27\5\326\351\167\236\76\11\214"
-  "\27\271\127\233\121\325\230\172\346\42\207\66\337\120\150\214\11\305\266\313\44\361\52\335\234\64\246\322\103\327\71\234"
-  "\257\330\371\101\75\74\134\245\35\327\142\66\164\174\307\236\33\153\307\233\53\330\311\354\332\32\167\62\203\332\266\125"
-  "\112\122\226\15\262\25\55\52\275\372\147\132\167\34\355\250\33\323\64\117\223\214\14\342\256\364\272\315\356\0\103\211"
-  "\256\205\225\64\131\21\346\343\2\333\116\375\53\127\332\214\347\146\207\121\354\126\52\331\275\324\116\23\266\113\115\322"
-  "\131\307\253\147\261\223\125\231\26\317\315\330\250\346\352\21\124\272\13\72\345\326\63\34\76\254\53\217\73\27\304\150"
-  "\156\375\163\323\254\256\207\13\346\177\355\175\151\167\342\270\323\357\127\231\363\114\356\332\207\34\355\226\357\362\362\356"
-  "\373\377\74\357\373\260\230\16\111\232\60\100\47\300\247\277\230\144\122\143\27\342\47\53\302\115\147\310\177\231\221\261"
-  "\245\252\122\355\52\111\121\312\41\136\116\351\207\127\334\113\45\275\167\336\350\102\251\302\10\253\45\11\51\161\146\344"
-  "\373\365\304\100\104\147\363\51\141\171\150\236\35\105\245\165\241\204\166\336\232\242\260\136\24\147\106\161\76\234\23\212"
-  "\207\146\167\25\377\143\103\272\72\115\7\327\175\364\62\335\263\151\3\21\6\61\7\303\130\241\155\131\72\125\350\102"
-  "\230\322\236\204\101\320\203\171\105\332\203\113\61\11\41\236\241\247\345\367\341\143\143\222\16\117\76\302\212\373\366\43"
-  "\263\367\314\324\322\203\50\126\132\355\275\241\341\343\154\376\255\53\377\334\155\146\55\167\200\36\60\167\340\62\315\174"
-  "\215\103\244\231\147\346\230\177\111\275\21\250\126\31\345\75\75\335\74\55\31\206\14\10\352\236\261\137\370\245\325\217"
-  "\321\51\343\255\45\75\151\121\47\4\22\263\223\205\361\332\231\42\340\263\220\71\55\155\251\235\240\137\276\255\353\341"
-  "\0\47\326\174\70\232\255\111\142\336\36\234\131\167\17\270\362\366\361\312\2\313\127\125\125\205\65\137\127\173\320\106"
-  "\363\343\230\274\65\347\65\56\204\130\375\133\113\342\36\232\342\165\267\151\313\337\257\47\176\311\322\167\104\370\30\53"
-  "\212\46\313\257\370\13\234\231\233\330\77\304\72\246\4\13\0\17\12\124\212\7\316\146\227\270\222\154\126\340\265\51"
-  "\161\366\106\336\212\277\376\55\276\130\363\333\277\376\367\277\311\133\57\244\321\245\267\325\27\41\335\157\377\376\337\320"
-  "\247\337\177\74\62\252\1\366\312\312\112\244\261\342\43\241\156\134\142\15\123\262\15\136\174\10\223\370\41\314\161\170"
-  "\16\303\323\65\234\114\342\246\170\336\36\177\240\353\171\245\247\217\353\167\174\247\307\330\301\272\112\116\307\152\352\247"
-  "\332\226\213\101\131\26\7\176\250\352\176\336\331\200\164\243\224\336\251\32\107\357\113\255\224\67\262\27\315\374\56\51"
-  "\323\146\257\304\50\304\251\51\124\153\21\355\33\21\215\373\245\54\66\14\104\242\17\47\206\245\11\156\160\216\343\40"
-  "\20\2\201\11\54\52\243\307\336\13\121\330\162\274\370\122\226\356\165\2\277\34\237\300\122\224\246\364\276\124\122\52"
-  "\137\12\57\275\377\25\147\20\23\27\351\371\300\164\177\200\30\106\225\246\164\205\342\261\10\62\24\203\167\115\246\231"
-  "\46\343\150\207\165\333\143\313\264\160\275\373\43\105\77\77\306\317\42\67\22\170\52\31\65\254\241\107\217\325\125\177"
-  "\141\222\131\303\270\237\131\260\174\154\175\145\153\340\125\15\136\275\52\173\153\255\224\322\112\125\15\204\54\270\127\25"
-  "\31\132\114\227\325\146\161\62\262\250\26\353\45\12\56\130\64\61\213\214\56\350\3\171\323\352\101\265\37\350\303\203"
-  "\317\31\220\0\367\236\311\2\61\74\353\154\306\241\250\247\220\221\142\117\361\23\166\153\265\176\132\126\277\75\115\247"
-  "\373\76\377\243\370\163\305\222\365\74\213\162\234\277\125\31\174\36\216\27\321\15\307\73\244\360\22\2\37\16\6\137"
-  "\214\161\1\277\370\223\7\116\200\163\63\260\251\272\11\30\161\314\250\64\177\150\20\175\303\136\254\237\321\224\76\15"
-  "\47\111\322\200\342\103\51\224\342\21\42\31\133\214\146\242\241\344\200\24\322\31\343\12\305\144\212\351\270\336\314\75"
-  "\347\317\376\35\114\144\101\307\325\354\61\230\144\14\230\313\231\150\332\266\373\126\173\326\372\271\365\253\374\325\122\165"
-  "\63\221\150\31\147\222\13\231\310\221\252\143\122\250\231\24\66\310\163\37\36\25\151\174\376\151\370\313\204\20\34\47"
-  "\172\46\313\247\5\40\43\202\252\251\120\336\64\274\347\323\305\73\345\357\234\64\362\202\77\222\221\106\176\136\61\220"
-  "\111\267\51\127\152\225\16\61\137\111\47\34\302\265\31\41\66\40\271\151\216\23\105\16\316\310\230\132\231\122\300\375"
-  "\163\47\316\251\200\57\311\77\203\23\262\342\246\227\161\12\221\2\14\72\220\374\45\276\220\307\247\61\235\55\211\33"
-  "\201\366\261\22\220\62\374\251\24\312\144\317\100\63\340\21\47\322\7\220\352\100\161\223\252\357\44\225\22\112\345\347"
-  "\27\73\114\146\214\165\100\136\261\34\206\355\207\144\275\361\105\365\60\360\234\43\36\117\247\176\357\217\103\100\146\364"
-  "\107\46\304\201\2\272\217\67\132\34\330\164\275\225\70\252\310\354\336\163\234\302\151\74\34\214\234\67\134\230\76\76"
-  "\75\55\251\116\241\361\230\252\25\256\201\304\65\220\370\305\3\11\226\371\143\257\235\57\174\200\351\250\163\104\31\3"
-  "\51\12\123\224\302\10\161\15\63\76\201\277\363\170\236\60\343\307\65\314\270\206\31\327\60\43\115\354\256\141\306\65"
-  "\314\210\30\365\32\146\54\237\176\314\47\331\243\11\211\126\361\133\357\377\156\133\35\246\257\340\137\303\213\153\170\301"
-  "\27\40\260\167\203\160\34\310\4\373\301\26\25\310\25\6\352\24\371\132\127\207\277\147\156\242\75\66\230\252\141\3"
-  "\175\365\314\77\261\147\376\273\105\276\71\275\366\11\274\363\30\347\126\176\142\347\226\40\303\176\53\315\373\325\163\315"
-  "\344\271\256\227\373\147\347\366\134\127\233\153\346\73\311\247\132\155\76\257\243\213\277\134\235\247\60\215\200\300\222\305"
-  "\146\144\23\66\237\161\263\65\220\311\256\46\122\174\270\254\376\347\322\354\163\70\116\34\213\376\155\11\347\246\274\76"
-  "\31\340\263\314\246\14\60\17\266\340\361\346\356\373\323\144\172\162\377\305\54\146\377\305\214\331\73\140\17\263\155\307"
-  "\240\7\246\375\300\266\37\270\233\153\376\347\63\232\305\131\170\177\111\272\343\361\223\155\6\375\160\264\364\336\143\221"
-  "\377\144\151\34\60\333\352\206\123\4\323\360\327\345\17\34\341\204\14\62\336\200\222\274\332\373\11\104\210\21\213\372"
-  "\77\272\13\307\323\317\157\372\220\173\107\371\235\75\74\241\346\46\151\353\227\70\44\161\330\136\57\100\311\4\7\24"
-  "\234\215\5\312\34\154\46\65\323\345\304\254\331\64\73\105\71\243\174\162\175\364\11\152\31\260\350\331\217\230\242\253"
-  "\51\162\67\227\20\104\262\227\372\217\1\57\337\222\361\225\201\57\363\341\74\276\26\171\37\174\236\214\75\267\60\361"
-  "\72\77\175\252\330\335\266\325\336\235\76\47\140\266\75\235\247\145\207\6\266\332\333\126\173\27\212\163\351\301\357\122"
-  "\375\215\16\72\333\166\301\251\246\315\31\321\332\62\350\150\110\204\331\26\157\175\116\117\152\163\232\323\133\244\202\320"
-  "\64\21\212\270\36\231\21\237\21\207\160\216\217\335\322\17\133\270\353\166\256\3\151\242\364\61\21\312\204\46\177\47"
-  "\333\61\226\0\141\72\213\22\173\245\134\352\310\367\354\370\1\65\46\263\147\354\271\142\146\344\107\37\165\371\66\307"
-  "\11\146\217\233\223\23\371\30\113\150\114\13\60\26\367\57\227\325\364\266\165\143\120\130\27\40\336\242\27\110\7\321"
-  "\224\322\62\65\366\13\30\226\140\352\23\116\50\141\337\143\147\174\264\377\360\341\267\233\43\207\164\110\141\64\70\365"
-  "\203\146\47\20\77\74\55\176\273\71\226\106\204\273\24\11\334\335\33\234\313\257\263\51\301\371\6\266\276\211\71\337"
-  "\205\353\27\216\322\141\52\216\167\30\356\217\274\141\216\374\150\111\250\327\135\67\33\352\206\144\253\201\221\75\66\21"
-  "\112\205\240\6\174\203\101\245\171\62\71\347\311\66\347\311\345\236\47\227\165\236\14\115\115\253\141\251\201\255\155\307"
-  "\163\143\164\64\276\300\57\111\120\21\333\356\52\302\307\252\210\220\33\20\146\275\42\47\353\371\46\353\225\107\372\336"
-  "\102\326\143\50\21\113\224\131\131\257\40\6\153\65\174\110\105\110\31\253\43\266\170\342\273\351\10\51\162\316\224\224"
-  "\315\251\222\52\367\134\111\225\127\237\13\232\40\326\222\324\302\116\162\146\125\261\305\347\235\61\146\1\133\74\231\126"
-  "\141\217\55\74\332\16\37\104\105\124\142\20\206\61\11\54\235\316\271\113\227\356\60\317\31\123\60\247\207\305\325\254"
-  "\17\220\164\305\304\341\43\142\30\51\306\146\24\306\335\161\224\70\2\174\264\260\327\311\41\302\305\223\333\36\31\166"
-  "\333\201\141\267\235\31\166\173\66\206\335\166\146\330\355\171\31\26\31\375\50\206\145\24\306\335\245\63\154\320\7\342"
-  "\20\1\206\335\240\231\147\375\316\233\166\117\337\64\214\254\271\341\250\142\344\45\36\62\76\135\0\340\277\333\105\5"
-  "\351\240\227\307\370\136\160\61\71\1\205\111\102\130\320\244\302\316\104\174\370\315\37\261\164\1\262\46\22\155\137\111"
-  "\260\27\217\1\60\240\301\10\115\371\16\44\64\77\101\206\46\100\2\172\4\146\166\167\206\231\15\317\4\357\205\33"
-  "\136\362\146\315\15\327\156\315\307\244\233\122\25\306\125\141\220\313\2\300\100\263\16\146\25\314\21\275\376\211\305\225"
-  "\114\252\155\232\124\167\223\220\146\375\314\172\76\103\230\115\212\304\35\123\44\215\307\64\43\311\256\176\374\4\62\310"
-  "\21\252\102\151\116\261\16\127\16\220\123\17\26\36\351\213\374\225\30\64\263\375\327\323\237\71\56\122\2\304\105\60"
-  "\252\45\1\303\154\204\43\43\300\15\340\252\62\10\343\12\47\113\350\353\364\60\62\27\352\11\364\307\344\142\302\23"
-  "\113\215\273\304\304\6\121\77\31\52\34\53\176\176\355\300\204\71\275\304\223\53\232\34\373\165\126\177\54\327\135\167"
-  "\247\356\16\17\251\250\151\366\255\125\66\265\154\66\327\355\335\252\262\135\65\325\172\360\7\173\101\264\172\20\255\17"
-  "\232\315\357\255\361\343\66\13\165\71\31\274\306\371\162\267\375\154\222\367\375\154\130\245\42\365\206\157\23\304\257\45"
-  "\155\25\44\1\110\330\111\210\261\301\326\224\76\105\205\235\304\31\140\3\75\165\232\377\44\222\23\167\316\244\355\211"
-  "\2\223\103\106\243\363\7\240\10\10\347\32\361\256\64\176\333\177\367\305\136\331\10\237\324\15\0\44\176\352\70\60"
-  "\12\104\32\337\103\143\163\266\12\254\154\142\327\43\276\123\205\126\13\67\222\2\43\165\64\56\122\254\52\204\350\156"
-  "\102\167\72\205\126\144\65\236\32\36\30\341\212\375\360\242\255\151\2\154\243\306\207\104\23\104\222\243\135\362\47\135"
-  "\17\16\241\3\123\150\176\64\315\104\243\301\212\141\2\174\10\142\346\114\154\215\135\364\131\140\334\144\256\347\317\40"
-  "\327\207\165\326\367\140\274\235\100\34\260\223\11\62\176\200\6\30\346\346\60\310\144\342\147\310\220\162\144\160\262\210"
-  "\32\351\23\275\1\202\324\161\252\121\154\365\375\357\114\102\256\345\311\150\257\270\342\377\43\342\53\311\277\342\66\114"
-  "\224\205\264\212\275\271\154\325\354\201\22\255\310\123\266\331\34\211\100\117\301\3\246\326\101\176\300\76\354\32\14\306"
-  "\3\235\70\356\133\63\5\6\171\345\217\256\240\320\245\207\177\117\41\301\34\307\0\15\261\164\263\322\56\124\162\347"
-  "\156\302\304\12\13\212\157\10\112\231\117\120\144\127\206\131\113\40\155\130\234\262\154\17\0\143\304\157\137\136\207\30"
-  "\207\104\377\107\344\6\144\260\25\201\215\204\25\205\4\235\4\205\215\277\321\235\62\53\64\24\366\360\61\331\240\16"
-  "\217\166\277\127\324\151\76\365\212\265\314\32\34\104\10\143\26\14\2\241\204\141\1\35\112\156\62\144\147\233\41\63"
-  "\32\215\253\321\50\217\32\215\222\327\151\107\20\65\365\206\222\270\324\71\123\363\273\264\304\373\267\244\321\31\15\167"
-  "\101\136\106\107\67\343\4\10\227\12\356\32\113\40\46\141\333\225\114\270\65\141\200\121\7\31\342\124\264\210\133\61"
-  "\14\12\364\25\264\357\201\51\220\40\146\6\243\201\64\150\0\53\34\160\342\153\222\261\112\302\30\222\52\301\112\35"
-  "\320\211\375\32\346\24\254\263\101\346\3\130\13\234\274\25\361\7\5\123\217\371\227\67\11\233\276\327\67\167\321\53"
-  "\217\213\247\27\160\130\103\307\165\310\341\246\331\336\175\275\153\77\170\154\76\130\264\337\130\264\337\330\312\146\173\335"
-  "\156\253\146\173\331\154\256\132\157\67\233\77\232\315\347\146\363\205\232\370\352\273\207\146\163\73\133\355\247\211\236\45"
-  "\34\155\301\217\262\300\147\125\300\263\51\124\321\174\266\122\55\172\265\47\144\325\236\220\165\373\215\65\275\101\343\150"
-  "\35\72\3\343\172\6\206\52\172\77\3\103\25\271\316\300\0\347\115\220\52\317\171\170\105\170\13\147\216\125\333\175"
-  "\373\361\117\325\270\252\155\324\360\161\66\377\106\137\201\3\161\310\140\165\365\322\360\122\171\334\31\22\31\362\43\170"
-  "\250\56\311\200\307\115\206\43\332\362\34\3\102\314\203\251\230\177\314\114\344\334\346\47\47\340\0\166\41\15\45\12"
-  "\322\352\270\61\276\351\47\357\320\262\160\174\6\51\135\130\151\214\170\275\20\167\135\317\233\327\200\350\1\212\106\100"
-  "\155\261\124\136\271\242\50\134\334\6\106\25\0\22\60\77\344\44\66\50\350\42\171\127\62\131\221\7\336\47\72\221"
-  "\223\4\20\337\306\367\0\26\275\331\45\45\11\75\202\375\224\60\167\301\307\270\7\301\37\203\200\263\2\330\146\216"
-  "\124\30\207\27\63\102\74\345\127\210\362\240\107\114\371\331\5\120\76\341\137\362\116\16\260\162\27\140\163\62\250\174"
-  "\0\177\222\246\333\162\260\304\121\260\370\35\114\350\334\24\32\167\125\75\126\343\65\102\12\364\311\254\115\43\63\160"
-  "\12\261\171\365\215\306\353\202\57\261\154\132\171\42\60\105\230\103\61\61\22\271\213\7\42\254\26\63\375\52\263\370"
-  "\63\172\12\135\30\351\323\157\22\301\107\40\143\60\170\12\24\114\311\6\363\74\216\367\170\21\176\32\217\341\214\6"
-  "\345\371\112\245\264\56\224\320\316\133\123\24\326\213\202\45\374\342\266\70\15\303\233\354\260\26\314\36\371\245\206\230"
-  "\34\300\74\301\327\46\116\350\161\114\64\334\340\165\244\236\124\304\216\251\10\6\26\41\223\20\75\344\63\317\344\236"
-  "\174\74\103\263\73\105\7\76\60\376\0\120\221\163\25\107\51\141\61\144\307\155\41\37\66\122\335\354\272\252\375\356"
-  "\33\241\145\376\311\275\234\35\15\70\100\26\126\226\245\24\6\7\207\301\56\164\351\205\222\122\341\56\220\240\25\240"
-  "\256\60\101\13\261\327\310\50\116\253\371\363\277\233\126\313\341\154\125\125\233\161\265\130\263\64\307\154\76\15\220\66"
-  "\241\337\346\353\64\320\163\265\134\123\12\234\217\225\331\21\307\256\364\247\43\140\2\45\213\34\207\71\136\131\221\63"
-  "\324\225\25\271\323\305\355\21\357\217\51\177\120\126\272\156\204\53\330\35\33\310\103\40\172\153\217\71\144\353\143\337"
-  "\333\277\376\55\6\352\365\173\375\347\137\240\37\10\307\133\77\312\262\55\311\234\2\360\27\346\176\274\34\203\240\220"
-  "\326\24\256\345\230\336\32\243\134\151\205\12\43\22\34\345\107\34\346\146\130\211\321\324\333\311\144\152\314\36\163\367"
-  "\72\160\251\154\351\124\131\126\3\41\374\21\52\120\317\0\43\253\106\136\115\253\66\106\6\121\266\211\314\63\33\222"
-  "\243\367\114\135\34\335\104\40\243\343\306\301\173\201\210\143\361\142\206\313\113\327\62\0\73\50\45\376\301\151\24\44"
-  "\330\132\301\325\31\166\66\34\327\252\351\207\343\14\143\266\375\133\135\363\104\271\177\134\310\262\124\266\372\42\44\27"
-  "\71\34\213\363\3\36\254\106\207\341\161\200\1\173\234\147\337\172\130\55\343\71\111\135\244\141\5\132\230\17\300\256"
-  "\73\234\363\47\233\14\12\322\160\332\136\151\353\234\12\270\351\220\325\37\110\56\360\120\205\53\234\214\164\246\44\30"
-  "\12\301\205\231\132\346\232\74\207\12\321\261\337\212\345\5\227\333\161\160\63\126\7\246\24\363\21\126\255\23\317\106"
-  "\13\276\142\225\367\64\263\260\46\377\361\201\64\326\317\106\210\336\145\31\240\64\303\136\3\302\266\74\362\47\137\357"
-  "\56\304\326\23\50\161\13\60\334\153\201\250\244\313\131\174\321\264\325\316\27\242\224\352\124\22\312\52\243\274\157\360"
-  "\11\146\62\351\121\375\160\317\332\200\46\217\210\317\4\212\36\321\153\77\135\153\120\203\343\301\135\166\44\170\304\274"
-  "\14\131\354\267\203\36\36\123\43\247\325\21\104\126\374\11\320\27\212\177\241\140\244\252\351\117\350\367\110\325\221\314"
-  "\362\336\232\35\214\334\344\360\337\351\160\64\235\276\207\230\106\171\133\110\243\112\320\21\213\171\245\237\52\147\46\54"
-  "\346\215\357\107\26\306\211\141\51\47\106\12\111\61\157\241\12\345\245\62\361\35\115\274\63\303\122\217\313\75\166\166"
-  "\61\320\157\35\151\341\234\50\114\7\22\15\213\112\171\63\64\326\124\325\224\72\22\256\54\254\220\74\14\345\146\246"
-  "\337\137\70\157\55\217\110\300\143\224\124\254\72\215\317\67\253\241\356\271\330\122\67\341\31\361\115\73\165\340\172\304"
-  "\142\107\25\377\22\4\347\77\323\142\143\245\277\74\255\6\61\275\200\226\124\51\312\34\53\152\220\40\302\274\12\272"
-  "\371\26\204\7\363\157\316\324\316\342\142\270\207\100\11\233\132\376\26\316\356\260\121\216\332\250\152\134\210\262\152\147"
-  "\123\113\47\213\322\25\342\150\174\260\100\134\262\343\214\76\70\214\245\246\225\220\306\216\204\234\326\231\127\137\17\66"
-  "\50\156\205\362\306\111\147\353\304\141\331\165\304\157\10\271\311\130\17\205\236\116\132\310\271\322\40\343\300\335\263\111"
-  "\75\120\157\121\20\247\53\37\174\36\310\273\163\35\300\76\255\247\211\77\213\243\302\135\357\124\40\345\361\353\346\154"
-  "\331\14\6\136\133\63\121\356\177\16\70\4\234\165\342\23\313\51\33\160\270\277\321\143\341\4\376\350\3\145\255\203"
-  "\20\332\203\0\336\301\224\332\226\361\377\366\142\370\177\53\71\270\374\211\74\315\151\153\311\124\64\350\161\255\200\122"
-  "\147\126\221\203\204\241\300\46\234\165\115\357\205\265\327\256\333\66\105\255\317\267\320\160\317\240\247\21\321\32\5\116"
-  "\223\113\341\265\54\112\41\160\355\7\354\1\234\335\237\170\204\106\364\322\72\57\41\225\336\73\157\164\241\124\141\204"
-  "\325\362\110\366\40\136\110\171\105\252\117\330\202\16\226\365\211\145\341\252\354\300\232\132\125\371\133\41\274\165\116\271"
-  "\152\40\144\101\276\124\300\154\357\370\150\101\43\362\155\375\267\234\12\274\302\4\166\344\62\371\120\132\52\255\122\45"
-  "\154\40\205\63\312\52\43\335\205\211\230\370\245\4\52\135\20\36\77\73\301\360\242\341\175\362\206\364\63\134\232\372"
-  "\220\124\27\1\66\123\340\142\263\373\340\232\54\17\0\360\372\57\307\377\250\53\62\357\104\370\374\144\116\137\377\312"
-  "\276\372\65\347\232\61\366\266\320\207\166\70\2\116\275\347\347\320\364\267\164\205\360\116\77\76\71\303\376\120\40\144"
-  "\367\311\365\254\14\151\130\6\24\326\366\167\70\224\347\201\3\365\227\43\202\130\377\364\360\217\0\341\256\244\123\225"
-  "\321\254\170\323\225\132\232\102\172\5\13\271\176\104\21\151\215\115\54\157\160\100\325\264\232\16\165\131\115\31\240\22"
-  "\226\67\256\217\307\374\166\354\244\30\17\275\33\353\162\61\120\345\153\320\177\133\12\343\254\321\224\0\75\163\52\34"
-  "\154\227\342\235\356\76\224\173\176\211\336\3\104\110\343\364\145\347\162\137\135\275\57\20\112\367\372\107\161\13\234\73"
-  "\67\226\365\177\107\325\150\122\352\305\340\165\352\152\263\244\212\327\77\37\135\72\54\255\163\303\341\124\331\111\245\306"
-  "\213\201\64\165\137\356\326\111\135\130\247\125\315\6\66\36\260\321\150\142\344\330\116\224\33\115\353\105\131\361\306\124"
-  "\316\152\135\12\165\350\316\105\303\346\164\341\312\102\215\252\241\231\210\175\157\266\356\315\334\112\355\245\166\276\356\353"
-  "\47\57\252\22\223\341\164\53\116\344\360\337\161\206\362\240\14\110\127\241\155\153\337\142\105\340\5\320\41\210\372\362"
-  "\103\365\136\113\16\32\226\155\312\130\365\132\3\113\245\242\334\150\247\37\62\170\17\175\330\324\353\220\166\34\322\360"
-  "\6\347\375\263\321\274\323\206\307\135\166\127\367\376\247\126\120\201\155\262\53\154\65\342\216\125\174\174\372\326\365\76"
-  "\267\273\351\352\217\346\31\172\323\360\61\206\374\334\305\177\64\233\57\335\116\114\234\74\64\333\17\341\143\12\361\61"
-  "\210\217\33\176\10\341\47\76\10\20\127\121\347\277\345\67\41\147\201\217\114\111\137\133\262\346\315\45\360\102\32\135"
-  "\372\303\256\11\162\11\242\343\154\260\163\27\20\42\377\115\152\271\0\307\171\24\153\100\306\202\303\313\100\14\315\113"
-  "\160\132\2\5\143\110\52\317\44\201\140\226\301\351\24\340\324\217\54\327\26\142\111\316\277\375\5\217\31\271\375\205"
-  "\177\346\244\121\306\360\341\321\35\155\170\65\56\357\76\214\200\206\236\201\375\74\74\11\366\264\374\351\316\307\6\63"
-  "\125\174\142\71\222\145\22\356\273\15\207\2\323\0\363\61\230\361\105\364\247\56\156\210\124\343\323\64\75\115\326\215"
-  "\117\107\222\121\304\303\102\335\22\250\263\142\162\74\171\70\221\116\252\216\347\275\100\66\51\324\351\41\67\245\155\121"
-  "\352\161\341\26\3\255\337\366\341\12\257\244\51\353\154\222\24\70\126\207\250\207\246\65\175\223\166\206\55\331\323\324"
-  "\375\0\377\110\145\51\114\226\177\160\60\56\234\257\376\161\76\116\3\273\74\246\50\305\200\271\62\66\121\3\330\7"
-  "\356\67\133\45\115\332\212\250\231\270\367\204\342\141\134\365\126\172\143\75\330\242\371\361\44\354\113\173\134\143\204\21"
-  "\62\14\140\0\224\373\270\323\0\312\267\277\142\72\24\206\266\277\320\174\202\357\307\205\34\133\71\361\125\341\207\264"
-  "\67\104\325\177\262\364\361\375\350\162\50\312\211\50\374\330\225\324\217\264\132\152\257\213\42\123\72\24\147\63\201\352"
-  "\54\65\51\0\236\336\6\70\52\123\52\123\32\245\112\155\313\167\132\277\355\64\362\361\375\24\306\71\123\272\361\110"
-  "\350\111\105\264\362\322\153\133\50\25\17\317\124\112\65\231\352\312\52\143\250\37\123\224\136\226\336\141\232\347\235\215"
-  "\246\273\4\153\334\236\226\100\374\2\235\256\45\3\12\30\257\131\344\61\64\11\106\32\231\133\364\63\201\135\347\316"
-  "\316\143\166\203\275\257\342\136\373\7\146\217\64\3\225\307\140\367\213\153\137\16\147\156\237\40\77\113\255\22\274\75"
-  "\206\163\357\334\222\33\215\313\166\16\161\212\137\212\256\111\376\155\60\207\117\151\165\234\204\277\246\331\257\151\366\153"
-  "\232\375\232\146\117\227\300\153\232\35\335\13\2\156\233\241\271\301\327\55\246\147\360\31\106\334\75\147\70\202\42\205"
-  "\140\374\160\27\227\232\346\124\304\131\212\155\217\13\4\27\225\333\337\36\315\72\114\253\251\226\162\52\325\110\273\305"
-  "\300\34\102\141\175\353\112\243\164\51\174\355\316\150\256\74\170\77\243\361\250\30\111\253\134\145\105\105\331\13\135\123"
-  "\314\120\251\43\70\374\236\274\31\76\40\332\105\206\60\325\306\110\155\105\71\165\177\75\301\122\13\51\124\131\226\70"
-  "\306\216\362\303\252\315\342\203\136\330\335\254\331\176\174\152\266\307\341\373\43\271\227\266\131\215\216\273\155\174\62\172"
-  "\57\154\112\336\317\32\136\374\253\361\315\343\70\5\340\223\302\53\253\255\51\233\27\74\320\255\351\51\146\14\164\201"
-  "\147\206\110\234\175\301\226\264\157\342\246\47\174\75\10\173\55\371\376\31\342\0\340\341\262\353\147\0\74\250\140\372"
-  "\113\131\303\123\210\362\266\360\252\220\232\337\172\235\373\160\144\14\62\367\337\13\123\112\61\261\152\242\205\225\157\60"
-  "\17\12\143\157\245\326\112\226\15\240\37\71\320\75\37\2\216\271\266\220\102\110\151\33\247\342\3\121\144\135\250\102"
-  "\33\137\372\106\0\1\104\221\35\116\360\70\127\377\365\277\141\106\74\337\1\210\167\263\20\134\377\363\377\234\27\56"
-  "\36\33\77\61\42\7\41\40\77\21\274\0\316\15\115\72\127\31\134\33\304\251\171\67\174\374\317\175\115\162\243\40"
-  "\141\275\334\273\31\265\272\347\313\244\361\113\163\353\210\350\150\215\270\33\103\116\50\43\136\305\343\22\367\166\31\227"
-  "\363\42\327\47\34\14\172\75\14\371\246\311\164\330\250\152\255\265\124\42\250\133\70\337\126\106\217\275\27\242\260\345"
-  "\170\257\240\113\167\340\334\352\213\26\334\326\361\160\66\251\252\206\254\123\364\367\30\224\254\267\21\47\234\21\214\315"
-  "\17\126\134\350\123\316\322\370\116\56\250\163\242\45\366\272\5\350\272\5\150\234\266\42\224\101\320\33\117\306\34\144"
-  "\376\163\376\55\106\233\204\345\263\144\254\37\237\22\11\221\130\260\63\106\204\240\137\270\135\213\336\314\264\375\51\71"
-  "\137\314\265\3\51\224\214\114\362\342\376\320\356\50\14\340\266\257\374\140\117\373\337\151\362\271\215\115\42\260\24\102"
-  "\160\252\136\147\0\316\0\256\122\21\102\274\136\1\242\265\162\332\311\262\32\150\301\167\216\103\215\307\356\203\307\211"
-  "\314\357\362\247\246\62\253\126\147\233\125\353\301\164\323\174\260\224\255\27\124\253\155\132\233\324\144\253\255\132\155\235"
-  "\226\133\45\164\137\132\57\314\276\335\361\47\277\313\362\310\103\45\56\66\121\213\27\244\350\123\234\217\303\253\167\264"
-  "\160\3\256\36\16\337\147\271\45\241\70\157\172\270\360\322\226\306\307\345\166\77\103\206\271\346\362\114\71\146\352\52"
-  "\75\313\234\153\325\167\223\162\210\345\65\15\315\141\307\324\110\77\47\55\141\216\176\271\214\163\272\372\114\55\260\303"
-  "\271\273\304\202\70\234\52\6\211\336\214\30\222\56\0\30\16\202\50\16\222\160\34\204\221\234\117\362\247\265\363\355"
-  "\134\32\204\136\37\320\373\351\52\360\62\122\337\311\274\224\236\366\116\27\246\236\23\337\240\23\160\121\66\32\143\334"
-  "\61\271\56\235\50\204\64\246\337\344\172\72\127\345\205\3\47\275\372\110\231\217\3\126\64\175\337\305\6\155\254\330"
-  "\100\252\323\133\341\156\66\253\344\144\40\175\317\127\254\376\337\361\325\52\37\136\255\12\357\174\221\201\121\331\63\200"
-  "\252\352\2\251\164\115\120\323\161\126\46\5\151\305\207\15\76\12\243\154\272\0\252\125\56\224\215\110\101\131\67\206"
-  "\15\115\275\342\157\51\74\12\175\157\370\367\272\3\224\113\371\241\233\217\226\22\312\50\70\353\54\112\30\226\370\146"
-  "\11\210\204\252\221\160\1\325\4\156\227\6\11\373\0\273\126\271\266\365\304\250\306\212\301\302\251\232\140\137\300\240"
-  "\150\165\3\57\37\205\227\60\52\210\104\12\305\7\62\114\362\164\343\306\51\203\350\20\75\126\206\315\143\62\226\313"
-  "\160\130\240\336\302\2\145\3\65\145\240\23\322\47\203\243\253\143\70\26\304\364\42\165\207\46\201\263\174\274\357\220"
-  "\276\10\230\306\60\70\307\25\305\13\203\300\345\321\357\271\377\72\65\315\31\210\110\4\107\260\216\155\334\45\340\22"
-  "\26\251\41\203\134\370\262\150\235\363\357\141\325\213\206\111\137\57\275\374\125\63\342\214\274\145\1\300\61\1\264\4"
-  "\233\323\162\234\343\16\16\240\42\230\312\102\132\25\177\172\73\121\357\47\116\374\372\223\210\371\357\262\354\101\322\151"
-  "\244\137\123\330\371\222\137\17\2\243\64\70\251\37\20\357\2\56\65\110\361\307\327\300\37\112\126\277\254\337\313\20"
-  "\100\45\372\22\100\45\76\201\0\42\367\161\13\213\112\276\176\175\250\226\363\352\361\353\152\66\77\136\123\362\326\334"
-  "\66\233\263\155\215\145\270\344\204\37\132\260\154\66\237\233\315\331\45\355\176\233\45\27\36\360\57\245\60\106\173\351"
-  "\112\327\155\53\74\137\144\111\313\74\320\374\347\50\205\6\33\74\161\242\370\371\150\15\362\333\237\230\372\241\133\14"
-  "\212\327\160\120\10\177\352\340\275\335\361\365\100\41\207\102\226\143\351\344\304\56\6\122\277\227\106\13\131\172\43\225"
-  "\53\75\354\215\226\365\46\225\266\305\110\116\253\142\262\357\254\254\73\123\267\205\265\205\226\272\140\305\314\0\264\312"
-  "\126\316\17\325\250\34\127\243\305\100\271\3\150\352\326\12\53\12\47\164\335\135\74\154\166\122\352\241\35\216\247\23"
-  "\133\214\151\71\312\372\322\225\22\37\200\223\377\27\160\261\373\154\233\53\171\366\174\224\272\226\376\114\371\126\133\77"
-  "\0\305\365\234\173\227\311\330\343\52\221\320\360\311\151\253\55\3\211\321\51\12\73\234\352\333\362\167\63\316\10\74"
-  "\347\52\336\212\215\237\126\300\212\241\102\311\141\253\62\161\107\155\154\324\376\330\344\267\152\127\253\226\276\73\51\277"
-  "\275\3\333\172\314\136\25\333\67\363\145\44\120\75\301\175\75\143\151\145\121\324\45\306\357\326\113\152\177\370\53\43"
-  "\15\4\131\302\221\264\145\255\110\334\253\361\62\136\110\353\13\335\330\330\203\41\123\105\145\246\136\224\143\253\206\173"
-  "\123\250\324\1\262\77\155\241\61\165\167\105\64\154\262\252\312\152\64\31\231\221\34\233\175\157\157\206\125\370\302\26"
-  "\352\165\323\121\31\17\233\237\16\253\162\124\171\257\375\144\337\233\56\336\152\200\244\266\245\63\205\253\255\241\304\326"
-  "\260\377\137\260\321\74\126\246\46\274\260\136\112\46\170\211\302\222\152\176\330\31\255\11\306\25\10\343\26\333\207\56"
-  "\253\141\230\264\112\151\143\112\27\177\162\245\152\220\213\116\53\225\312\362\254\144\155\37\60\104\74\33\210\223\175\351"
-  "\247\327\244\337\257\307\221\232\117\316\311\121\64\120\260\222\153\327\235\373\141\367\244\373\207\74\221\260\273\140\256\7"
-  "\333\114\260\57\265\36\376\324\214\300\113\263\271\342\236\125\374\16\17\356\327\21\174\227\270\207\43\335\61\243\315\355"
-  "\375\247\33\362\357\126\230\155\360\116\4\36\147\342\253\207\351\343\314\356\147\372\371\145\374\156\353\242\221\305\4\372"
-  "\230\52\132\200\361\303\104\42\324\33\262\34\302\215\6\110\337\222\301\160\40\365\25\171\123\67\66\355\102\12\345\5"
-  "\336\273\232\176\222\45\336\356\4\324\75\332\37\305\31\261\124\162\72\262\306\30\65\221\376\335\270\26\336\352\322\113"
-  "\247\1\261\231\21\15\372\353\103\247\234\326\322\330\261\50\26\3\153\137\217\242\23\116\72\131\247\301\144\1\362\23"
-  "\251\227\261\276\204\323\114\11\7\122\1\322\246\7\206\211\127\30\360\12\306\177\306\205\252\64\112\347\156\224\311\323"
-  "\217\21\171\372\261\56\117\77\205\312\323\217\217\56\10\276\210\224\352\256\13\156\62\23\255\165\46\132\233\114\74\355"
-  "\114\246\271\317\304\323\45\321\371\242\323\15\74\77\234\260\232\263\342\72\77\242\123\376\325\22\136\25\216\263\323\230"
-  "\34\114\151\57\273\114\154\230\77\126\37\222\342\115\200\32\301\56\136\362\73\74\344\21\342\275\45\317\154\254\230\173"
-  "\201\320\61\314\212\5\72\224\361\0\200\21\313\344\55\351\174\301\367\142\243\17\236\361\355\116\64\353\40\270\307\313"
-  "\66\140\35\12\371\376\140\367\366\113\367\33\267\51\36\170\57\315\160\54\250\311\220\201\12\45\135\200\156\3\4\347"
-  "\114\237\36\341\274\260\271\147\251\45\126\122\167\31\264\135\177\50\376\135\363\171\350\240\54\127\260\77\226\225\213\374"
-  "\352\371\174\353\274\57\361\31\266\145\365\375\353\142\366\244\332\151\266\72\161\105\151\266\146\263\22\315\366\274\365\372"
-  "\176\42\307\315\104\34\255\100\322\105\334\273\326\305\334\233\126\373\271\325\136\264\332\17\315\366\170\270\134\156\233\217"
-  "\346\135\156\2\157\165\367\275\331\374\103\264\372\272\243\366\221\264\342\364\245\325\176\156\267\177\127\202\77\222\315\107"
-  "\243\305\115\163\224\151\373\301\114\266\37\250\366\3\335\176\140\332\17\154\373\201\153\77\50\332\17\174\373\101\311\0"
-  "\23\354\211\144\117\24\173\242\331\23\303\236\130\366\304\261\47\5\173\342\331\23\6\263\22\354\11\247\257\142\117\64"
-  "\173\142\330\23\313\236\70\366\244\140\117\152\230\111\162\276\75\76\215\336\67\76\55\327\377\156\265\270\141\352\152\317"
-  "\62\341\227\331\56\13\321\166\162\350\303\25\373\20\17\177\140\320\243\376\354\154\76\133\177\275\347\307\215\327\232\242"
-  "\15\226\11\37\221\113\215\143\136\61\317\152\323\210\164\335\342\202\1\61\347\256\53\270\262\361\110\331\254\140\356\346"
-  "\351\322\140\302\262\266\306\137\127\34\366\347\310\364\37\173\215\303\333\310\147\42\300\225\141\57\21\54\40\241\115\63"
-  "\26\242\335\37\42\324\173\343\121\347\113\63\331\234\320\354\207\116\222\373\376\372\144\264\177\364\360\333\215\272\201\204"
-  "\244\353\121\236\26\277\335\310\33\164\17\42\215\101\133\245\50\303\275\173\33\176\371\165\66\245\341\337\240\321\274\363"
-  "\51\227\140\57\70\206\34\236\270\343\247\371\302\316\21\4\357\61\117\362\254\175\327\4\51\345\363\231\36\131\277\74"
-  "\175\175\172\256\226\173\227\205\303\226\133\221\360\160\217\247\301\127\353\247\145\305\302\363\367\27\217\116\344\214\77\1"
-  "\342\25\340\303\311\362\151\301\311\200\11\3\172\277\157\367\76\132\22\267\357\221\152\64\30\347\332\256\162\144\60\205"
-  "\110\226\261\40\331\46\70\256\331\364\10\72\302\77\61\243\77\175\371\53\162\5\107\56\254\273\60\162\276\211\115\331"
-  "\354\235\206\7\151\205\373\174\307\322\247\252\51\240\273\147\340\13\146\36\162\141\203\3\103\232\147\222\201\362\246\57"
-  "\71\54\110\364\132\15\37\145\62\214\70\253\315\120\1\216\214\125\227\356\314\352\222\10\151\210\166\255\206\145\60\34"
-  "\165\44\167\177\225\363\145\65\176\372\276\370\261\256\32\362\51\145\224\62\144\243\355\370\150\151\163\313\72\76\343\345"
-  "\36\15\172\110\321\315\171\370\266\16\253\75\242\343\73\135\325\115\104\231\227\62\265\222\266\267\245\23\306\31\103\207"
-  "\265\343\174\20\57\106\301\11\140\322\12\154\242\60\7\233\56\102\246\171\207\61\145\147\257\364\220\256\50\12\105\167"
-  "\76\6\104\225\245\171\101\215\316\121\311\66\171\270\26\204\147\147\264\145\140\355\177\367\127\237\110\135\262\247\107\224"
-  "\302\236\236\40\145\310\132\362\46\42\253\375\207\10\336\335\267\332\77\33\315\31\113\307\260\257\256\271\67\44\277\340"
-  "\153\272\350\102\131\136\205\35\200\165\272\127\145\150\273\12\103\202\211\10\43\372\74\202\202\363\200\276\101\165\63\330"
-  "\330\334\5\147\13\136\233\17\64\33\231\30\314\203\71\202\64\220\267\40\324\150\154\266\376\207\54\361\34\73\246\150"
-  "\162\63\23\11\133\7\26\117\321\63\100\114\206\147\72\171\171\26\10\233\211\313\345\54\375\141\316\272\243\304\106\250"
-  "\57\134\4\172\371\104\112\47\302\56\365\214\246\157\301\363\241\125\0\202\350\32\316\273\124\305\70\357\150\345\347\130"
-  "\161\37\226\267\232\116\260\351\234\261\4\311\50\316\102\217\247\335\162\323\162\313\355\115\136\357\27\163\41\10\224\210"
-  "\162\111\22\166\237\164\56\271\14\117\336\231\3\3\226\173\173\367\366\71\152\11\12\232\235\101\175\146\164\134\10\35"
-  "\233\17\35\162\155\155\157\251\7\251\311\247\146\55\163\223\356\241\65\245\321\265\244\323\267\332\5\36\211\233\217\67"
-  "\361\137\17\107\217\325\241\217\103\307\64\132\215\5\365\375\123\35\41\6\3\75\213\67\153\136\173\357\4\337\3\203"
-  "\331\153\264\144\124\361\27\100\25\16\3\75\213\246\212\221\245\321\102\147\240\12\265\42\155\260\312\276\101\146\7\242"
-  "\52\140\121\200\151\340\143\245\103\212\3\153\214\111\254\367\263\353\274\12\122\277\313\346\4\56\264\320\2\254\350\56"
-  "\11\300\337\51\273\56\55\175\73\275\106\53\156\232\20\7\126\110\173\367\200\370\116\64\242\60\255\323\311\104\3\207"
-  "\11\316\14\134\111\42\335\154\5\246\71\332\75\43\332\353\233\250\13\102\210\33\224\212\324\276\17\340\230\267\174\163"
-  "\7\320\16\362\241\156\361\241\151\20\330\160\234\302\50\101\107\206\110\311\347\131\51\32\270\335\142\100\72\40\336\10"
-  "\12\46\336\312\306\206\63\34\167\76\107\270\102\303\265\20\52\156\172\134\374\114\134\217\53\157\272\327\121\74\3\200"
-  "\372\251\263\0\353\205\64\15\145\317\113\372\312\347\135\323\127\145\223\257\264\270\214\125\375\353\252\276\26\275\55\353"
-  "\53\117\272\223\265\312\113\130\331\227\342\203\113\373\252\350\55\300\126\226\350\307\132\356\46\301\106\360\325\177\32\215"
-  "\326\376\303\356\65\173\53\277\247\235\352\66\323\7\40\25\240\14\52\355\154\352\61\171\363\127\265\251\125\154\360\333"
-  "\207\177\5\250\227\201\240\304\227\71\111\273\44\102\66\371\253\361\230\210\37\116\266\163\302\340\5\216\14\13\272\270"
-  "\36\201\47\365\177\331\72\17\300\314\130\347\312\137\267\322\3\373\366\351\72\210\167\102\202\322\313\274\4\312\334\222"
-  "\350\106\122\332\3\340\341\322\41\14\67\110\241\367\221\331\142\22\110\326\306\40\263\316\3\110\255\43\62\63\42\66"
-  "\73\244\115\313\217\267\27\341\266\61\272\144\50\122\313\36\350\121\177\300\225\344\150\244\33\7\32\32\204\1\266\267"
-  "\304\231\156\254\5\65\132\234\277\212\4\216\167\131\71\276\150\101\344\233\155\43\156\62\304\335\370\202\112\102\257\304"
-  "\251\57\332\2\206\357\57\2\375\354\70\55\331\234\323\60\350\332\315\172\226\303\264\66\242\105\133\31\220\153\236\354"
-  "\371\277\377\355\111\161\164\372\115\26\140\55\207\43\260\237\234\15\60\262\267\274\252\156\144\314\233\55\43\242\314\212"
-  "\62\214\340\11\334\233\156\166\354\7\263\5\332\367\247\164\35\321\267\331\342\52\316\250\146\333\332\326\357\276\325\156"
-  "\177\257\157\302\233\140\151\141\275\176\357\360\361\241\307\303\60\64\366\33\37\350\34\312\225\0\263\335\255\211\61\71"
-  "\255\211\151\223\322\141\317\45\221\367\147\347\320\46\130\201\270\336\130\332\30\142\25\326\262\34\214\355\21\11\46\150"
-  "\141\105\34\76\263\221\317\141\40\346\171\341\107\21\306\357\270\34\55\231\224\24\215\226\377\240\314\74\67\205\137\44"
-  "\310\114\231\123\146\254\150\251\243\143\136\301\363\57\46\63\264\133\235\20\352\103\146\32\146\266\331\262\42\116\146\212"
-  "\163\311\314\363\51\231\171\116\223\231\60\133\360\103\33\117\174\364\334\110\36\101\231\101\353\366\114\142\254\352\134\265"
-  "\172\132\146\164\113\146\314\147\223\31\323\333\102\213\125\44\45\254\245\103\62\323\40\10\360\43\375\245\113\24\266\102"
-  "\334\113\264\11\241\273\355\26\272\203\35\225\266\150\101\344\157\362\163\174\177\173\365\56\137\76\177\127\242\177\220\271"
-  "\70\61\357\203\36\2\344\176\135\326\40\352\223\225\342\263\105\122\175\341\330\363\131\125\342\6\340\214\343\155\333\137"
-  "\274\155\33\21\166\243\305\364\222\23\11\232\62\306\305\226\261\232\322\211\26\104\362\252\51\317\254\51\345\5\150\112"
-  "\305\246\231\36\176\156\115\51\77\263\246\124\67\10\147\174\104\211\354\117\123\66\202\320\146\213\351\245\14\371\300\216"
-  "\212\326\251\10\105\253\142\163\31\116\267\20\62\237\54\377\347\114\157\214\343\24\261\12\153\351\344\220\52\46\7\242"
-  "\250\373\204\304\2\326\55\351\261\244\62\235\40\363\371\40\223\16\201\226\276\134\102\21\54\232\30\227\74\61\24\12"
-  "\367\60\113\105\302\54\345\7\23\117\231\17\117\131\74\24\254\214\317\250\33\274\235\74\174\45\327\67\176\10\54\77"
-  "\313\65\174\62\64\225\335\4\16\206\146\367\257\241\143\236\167\47\157\124\133\237\274\215\155\72\157\266\53\321\345\100"
-  "\347\371\46\174\32\164\312\355\155\365\225\375\364\344\172\76\163\346\363\231\71\204\76\363\371\314\347\71\105\131\253\63"
-  "\34\242\374\11\357\4\54\224\62\132\226\226\247\351\143\75\13\31\44\313\131\355\21\337\136\224\276\155\211\367\223\244"
-  "\270\73\336\73\247\113\345\155\241\42\157\217\273\333\244\36\173\262\71\165\75\134\243\4\364\326\26\242\50\235\246\333"
-  "\341\340\356\153\200\242\52\145\121\304\335\42\262\375\300\211\172\43\343\344\237\67\321\55\6\332\324\330\270\133\121\24"
-  "\122\10\53\351\226\147\206\322\71\131\324\4\240\147\275\342\100\206\301\234\37\167\354\301\142\372\37\230\11\300\0\130"
-  "\12\160\204\215\344\10\55\113\77\124\225\320\205\50\364\142\340\376\274\106\134\51\345\234\262\173\210\324\117\340\10\227"
-  "\235\43\362\343\16\174\142\46\344\351\332\222\230\54\263\306\42\342\367\256\261\212\374\32\213\120\72\73\177\372\213\324"
-  "\130\4\153\377\32\13\263\24\342\210\62\277\306\352\221\43\244\270\70\225\5\220\307\52\153\220\256\263\22\257\30\56"
-  "\215\162\265\142\1\116\166\277\127\103\263\133\305\370\264\30\73\325\302\115\306\345\330\173\375\176\320\237\323\316\311\262"
-  "\50\24\333\257\221\160\126\40\115\46\337\354\304\200\234\107\357\3\234\203\233\276\350\245\164\63\303\167\350\341\53\35"
-  "\151\314\4\215\210\257\15\6\11\52\315\202\15\260\305\202\70\232\357\137\230\327\151\250\257\167\140\330\176\316\272\234"
-  "\127\61\333\70\240\41\7\173\74\371\164\276\244\272\325\130\153\50\201\16\356\274\217\302\103\345\307\43\101\377\367\224"
-  "\45\41\342\324\151\101\174\112\304\341\65\104\371\37\374\5\123\200\113\111\33\163\300\223\330\70\162\347\23\265\202\132"
-  "\14\370\67\31\64\312\32\163\16\326\200\251\16\0\203\27\103\267\144\320\1\340\301\235\364\120\332\364\245\111\333\125"
-  "\332\114\231\117\332\0\367\36\376\0\367\136\202\264\215\274\56\207\312\52\141\312\261\134\14\244\70\250\7\177\153\12"
-  "\157\124\341\334\36\140\255\176\5\161\63\347\20\67\174\30\143\172\70\145\1\300\11\341\124\16\164\161\236\231\73\215"
-  "\151\273\225\0\166\375\57\154\313\42\32\104\237\12\42\130\137\230\163\215\226\71\241\66\357\67\342\125\322\70\243\255"
-  "\50\170\225\121\74\353\224\147\332\247\260\11\75\111\225\30\32\5\363\364\317\131\203\2\131\5\154\340\353\145\367\224"
-  "\230\205\247\102\214\73\135\67\125\211\300\70\350\172\124\1\356\271\340\136\116\202\67\324\64\202\104\30\376\331\217\166"
-  "\252\346\375\56\166\313\63\64\251\327\332\347\277\43\225\272\140\251\202\14\127\244\346\53\3\26\361\7\346\244\57\12"
-  "\363\336\363\143\225\230\63\305\207\113\1\157\163\327\373\145\250\370\272\122\134\102\52\135\102\175\370\256\253\366\325\14"
-  "\231\371\246\271\7\276\161\204\236\305\34\117\175\364\127\77\236\361\340\102\14\72\247\27\125\113\37\75\27\317\262\173"
-  "\36\61\5\267\1\73\0\140\125\354\14\253\257\137\37\252\345\274\172\244\152\72\206\300\171\375\142\245\56\336\57\126"
-  "\372\23\370\305\300\45\232\237\247\106\163\65\233\37\57\317\244\235\257\240\36\223\27\105\342\12\307\63\26\323\111\167"
-  "\236\142\272\364\155\21\273\213\50\305\233\375\314\122\274\115\304\371\241\101\315\107\74\232\41\320\314\33\13\342\370\54"
-  "\77\330\233\260\375\341\107\37\2\253\101\67\371\360\33\330\271\17\101\156\63\167\351\321\152\36\143\61\72\252\250\356"
-  "\241\356\264\36\207\206\6\236\126\302\6\72\144\14\270\313\220\237\31\311\217\355\17\263\0\42\343\247\125\16\104\314"
-  "\245\116\21\131\367\34\150\332\113\230\257\354\130\311\33\174\10\353\227\371\360\74\276\7\141\324\253\357\161\365\75\256"
-  "\276\7\26\262\253\253\161\165\65\176\115\203\254\377\36\6\331\174\112\203\154\57\162\362\176\175\127\143\75\274\246\71"
-  "\256\256\306\317\114\163\140\101\133\17\377\256\151\16\246\22\316\345\203\364\257\127\273\135\354\36\330\263\24\130\52\316"
-  "\315\111\130\215\16\23\322\305\353\223\333\367\27\315\346\37\315\346\370\344\346\376\25\65\371\366\173\256\242\37\337\332"
-  "\237\162\147\264\53\265\62\36\313\163\206\362\12\46\221\161\40\61\105\101\235\321\345\263\335\117\220\1\73\360\214\232"
-  "\110\37\271\65\2\365\371\347\256\7\143\307\242\130\14\354\133\241\262\124\132\151\123\227\51\27\254\137\266\157\204\51"
-  "\276\4\135\233\132\43\64\231\75\47\333\14\51\12\351\214\161\170\17\370\211\56\214\321\136\272\322\5\273\140\44\57"
-  "\52\243\307\336\13\121\330\162\274\370\122\226\356\60\221\325\27\55\310\11\341\250\23\305\343\357\23\242\233\303\326\210"
-  "\325\370\34\306\107\320\33\316\40\160\157\223\375\353\337\142\240\137\67\46\111\367\372\127\34\41\4\357\147\120\167\144"
-  "\46\116\52\241\253\221\233\26\223\305\100\325\35\15\304\255\126\326\72\353\145\211\172\42\361\32\113\153\105\345\275\61"
-  "\226\40\122\102\52\251\254\126\35\40\362\112\371\221\165\336\117\365\150\61\260\157\20\11\43\204\265\126\33\33\17\122"
-  "\65\255\104\141\205\34\51\357\27\3\51\137\141\22\102\24\245\264\332\224\245\211\356\113\351\111\45\305\144\72\231\26"
-  "\242\334\367\165\0\113\337\232\242\324\132\212\303\15\100\26\311\172\377\277\60\125\275\350\56\0\160\302\264\36\252\102"
-  "\216\375\120\115\314\150\361\105\36\46\114\335\32\241\165\151\112\330\21\201\241\206\225\55\307\266\364\303\261\177\353\107"
-  "\355\237\212\322\330\302\305\303\343\204\163\143\71\362\23\41\155\75\125\157\14\344\274\127\136\227\205\212\6\110\217\374"
-  "\330\216\244\252\112\345\325\142\140\336\330\247\50\204\366\322\12\327\347\174\263\73\351\30\12\107\256\204\144\212\36\24"
-  "\251\157\42\236\274\44\231\263\154\167\272\365\263\273\224\154\45\123\307\57\251\373\104\257\272\375\252\333\123\176\271\352"
-  "\366\253\156\137\207\57\262\374\143\271\146\35\254\142\343\61\43\274\54\101\210\230\156\137\222\243\60\300\304\207\131\77"
-  "\72\325\53\374\204\300\2\163\224\41\336\203\373\304\326\47\2\205\25\67\75\321\266\157\360\136\257\357\2\365\372\24"
-  "\116\343\2\376\364\315\176\230\360\104\30\64\155\154\246\302\234\67\376\70\363\56\63\360\141\60\227\260\314\306\150\351"
-  "\40\216\3\60\100\236\135\100\261\176\167\200\12\157\165\351\245\113\227\153\314\72\134\173\246\303\207\130\46\101\262\347"
-  "\223\214\147\341\255\343\22\106\153\276\10\31\225\312\115\257\276\211\313\335\56\117\346\175\127\47\23\275\223\351\65\265"
-  "\173\115\355\166\20\236\356\53\227\74\7\12\335\27\371\32\51\110\43\155\251\34\5\11\114\102\57\46\267\73\237\364"
-  "\225\332\225\252\124\306\110\27\136\51\115\363\15\1\76\11\31\326\135\246\50\174\227\55\12\337\145\212\302\167\371\242"
-  "\360\135\172\24\216\372\272\106\341\104\231\134\121\370\56\117\24\276\313\26\205\357\376\206\31\326\145\272\226\313\264\364"
-  "\210\165\343\22\307\1\274\21\66\230\351\273\16\323\123\302\174\36\263\244\147\257\206\341\152\30\360\57\127\303\160\65"
-  "\14\273\204\364\154\212\145\41\315\264\304\51\247\154\311\113\234\322\305\61\121\316\224\356\13\232\70\154\244\322\115\15"
-  "\37\40\247\251\1\54\104\257\363\344\360\144\172\51\331\341\311\24\237\77\102\57\361\107\211\11\142\372\74\41\103\174"
-  "\265\365\127\133\317\176\271\332\372\253\255\357\313\124\363\225\231\20\110\57\351\346\224\351\135\154\117\231\11\305\233\165"
-  "\42\127\33\72\157\300\341\53\6\262\325\126\324\146\213\23\370\162\266\331\204\137\326\366\111\327\20\244\221\276\54\225"
-  "\63\275\254\41\74\275\244\156\101\11\235\362\316\20\112\337\355\102\113\16\370\70\171\102\206\347\64\360\111\356\134\200"
-  "\322\266\327\340\302\361\224\265\22\166\102\176\55\240\167\263\320\25\231\264\275\45\360\351\343\23\372\24\140\104\64\114"
-  "\5\214\257\201\246\103\311\103\212\304\333\64\12\251\275\262\312\177\244\150\136\51\157\254\61\237\255\150\36\137\171\102"
-  "\347\363\261\22\373\176\153\104\31\100\261\353\244\336\227\336\272\17\114\176\15\155\341\175\210\177\360\121\232\223\144\377"
-  "\201\57\245\45\160\6\11\122\6\30\160\240\267\11\53\344\0\127\361\261\322\121\114\357\52\1\105\276\355\4\337\341"
-  "\130\110\45\104\34\53\251\144\162\371\143\70\336\132\106\260\44\362\340\141\40\27\347\141\47\35\41\152\203\20\116\3"
-  "\11\300\304\23\117\377\222\165\125\234\107\157\361\127\0\354\216\333\335\177\356\272\313\366\245\123\77\322\145\352\110\253"
-  "\114\35\31\237\251\43\147\62\165\344\211\330\27\236\112\131\311\17\242\232\213\366\52\27\355\115\56\106\267\271\30\275"
-  "\40\106\277\214\71\127\334\176\115\122\17\260\335\200\47\1\46\133\51\0\60\210\11\100\340\302\121\313\162\170\162\176"
-  "\134\101\350\164\146\114\260\57\205\113\161\167\351\165\11\215\144\124\300\274\121\214\211\56\361\44\276\210\113\217\251\146"
-  "\176\154\173\200\42\275\70\367\241\231\336\372\176\72\33\166\267\75\135\140\73\333\262\202\333\146\273\365\373\327\257\353"
-  "\72\252\152\74\370\135\212\346\263\335\135\142\306\215\374\226\272\337\63\136\25\305\345\211\306\353\130\110\233\224\321\133"
-  "\5\356\224\330\166\41\120\115\370\63\322\150\313\240\243\41\21\231\370\267\167\333\144\62\155\143\156\343\170\344\312\40"
-  "\370\16\73\354\236\227\61\153\311\157\4\143\57\203\244\347\217\217\45\75\71\352\104\132\200\347\266\147\74\23\62\241"
-  "\333\14\231\320\176\153\326\267\154\155\237\57\202\100\14\266\150\2\126\340\30\41\114\23\55\100\217\212\367\110\204\151"
-  "\312\336\367\70\226\114\44\356\171\16\216\374\176\372\150\310\300\235\37\241\43\26\267\340\230\302\34\33\13\10\147\352"
-  "\155\20\352\156\200\373\153\240\210\225\147\242\170\140\170\305\1\136\264\57\24\227\322\2\61\12\172\176\253\352\261\32"
-  "\343\335\126\111\353\113\1\301\10\164\200\104\300\65\271\132\212\146\273\154\66\175\263\131\104\310\100\161\123\177\126\367"
-  "\164\350\235\106\334\323\202\172\110\332\155\307\271\317\43\156\246\376\6\121\35\226\107\341\123\223\262\30\27\123\255\225"
-  "\234\250\367\22\10\155\235\54\215\51\303\275\111\301\341\13\365\67\210\351\320\335\220\15\157\316\243\154\315\253\155\265"
-  "\115\253\255\133\155\254\336\16\57\35\276\74\164\167\30\203\6\176\103\130\45\234\0\311\311\246\71\331\102\335\14\116"
-  "\365\223\127\165\312\354\272\63\160\242\151\202\270\177\122\175\11\274\362\206\23\206\57\23\247\220\346\241\375\211\3\273"
-  "\2\23\250\302\62\12\351\173\36\160\235\1\307\150\340\130\77\270\322\40\161\63\144\74\266\133\260\146\321\313\112\54"
-  "\360\255\71\56\114\100\111\157\266\355\151\331\152\373\126\33\233\320\303\113\207\57\17\335\321\30\365\340\307\173\330\205"
-  "\24\214\17\274\333\363\205\331\273\273\256\140\340\253\44\171\217\167\114\4\336\3\177\117\77\155\236\226\341\53\54\123"
-  "\156\310\304\25\317\114\375\4\347\253\114\66\130\214\272\270\236\137\277\52\56\245\214\63\256\56\225\225\16\236\106\302"
-  "\200\46\366\74\313\370\351\324\140\100\343\153\314\356\362\36\114\173\167\272\234\360\376\222\117\40\270\317\130\75\230\361"
-  "\260\150\220\303\211\337\134\301\223\220\374\102\377\344\53\20\357\170\236\237\17\25\137\0\126\50\57\12\367\241\2\60"
-  "\255\265\226\252\303\146\312\161\61\222\123\75\36\216\13\243\365\136\310\204\54\337\53\300\212\113\255\0\343\357\377\24"
-  "\107\242\332\54\276\113\176\300\113\342\301\30\220\323\322\353\242\326\247\353\312\327\211\37\344\50\130\42\375\315\107\204"
-  "\251\317\170\114\362\3\237\124\33\17\230\302\53\253\255\51\243\325\317\245\111\3\46\103\317\207\320\20\131\135\51\71"
-  "\131\323\227\122\320\120\11\365\343\254\267\201\364\136\73\135\70\335\274\124\342\107\122\51\171\272\331\354\221\263\210\173"
-  "\0\233\241\2\63\56\32\57\370\300\125\374\1\344\346\144\23\313\307\301\67\342\345\163\143\57\377\244\254\331\145\372"
-  "\251\174\322\172\367\371\12\51\204\224\326\202\56\56\336\141\112\77\236\26\155\212\303\64\224\126\50\151\243\247\341\45"
-  "\60\341\311\150\44\370\140\57\135\16\302\304\121\325\245\361\11\344\22\154\300\60\71\323\73\303\324\315\355\375\45\101"
-  "\174\365\14\257\236\341\325\63\214\107\256\17\257\221\357\216\236\315\247\135\156\47\114\165\373\2\325\237\367\360\300\324"
-  "\100\275\346\305\326\142\336\147\254\305\354\77\77\212\63\223\374\313\164\327\203\57\314\165\356\12\157\324\355\37\62\274"
-  "\236\321\213\237\236\377\372\262\40\46\171\75\334\115\256\171\313\227\34\303\247\33\247\345\107\57\300\204\345\17\220\122"
-  "\23\305\335\277\206\211\135\130\66\300\267\101\362\361\6\277\322\274\221\167\300\227\207\362\23\33\227\62\244\252\141\336"
-  "\141\272\205\2\33\146\10\122\260\231\46\176\303\314\270\232\75\376\366\257\367\63\363\264\134\377\366\117\165\353\237\376"
-  "\15\366\234\116\351\262\272\17\70\354\364\361\351\151\111\343\36\232\37\35\370\320\11\34\171\371\364\143\76\241\221\17"
-  "\315\264\221\203\174\176\350\23\2\262\136\356\377\235\0\71\64\77\112\202\103\47\160\344\171\65\134\216\266\173\1\246"
-  "\321\337\37\175\24\202\272\243\152\265\306\14\260\334\17\115\343\37\232\241\261\337\232\325\142\275\254\45\6\102\303\236"
-  "\324\137\6\147\353\60\64\204\367\161\322\200\267\156\42\170\347\151\300\316\203\220\256\366\317\106\163\10\352\353\153\4"
-  "\353\153\373\102\201\375\376\64\231\22\250\165\13\0\72\113\346\202\331\51\56\250\107\306\114\273\177\213\200\255\133\0"
-  "\330\155\234\364\304\357\170\251\307\304\140\16\107\53\2\263\156\175\124\252\367\135\140\113\362\264\330\256\146\337\346\64"
-  "\362\237\117\316\104\44\2\357\317\201\40\214\365\141\240\4\137\335\372\50\145\352\76\340\260\213\247\27\32\165\337\350"
-  "\233\153\366\103\142\5\367\364\215\140\334\67\62\333\304\175\217\61\40\110\321\0\102\212\374\140\110\1\1\151\250\172"
-  "\122\364\271\200\210\261\67\7\137\231\200\70\64\363\203\361\135\106\350\274\341\206\340\250\133\210\173\23\241\132\315\207"
-  "\163\260\7\20\106\304\133\320\155\102\252\0\52\237\75\105\42\210\70\233\23\21\353\326\225\210\115\42\316\42\224\367"
-  "\137\151\270\157\144\26\207\175\217\21\66\156\105\40\354\33\231\101\330\367\210\303\206\341\234\100\330\67\62\203\260\36"
-  "\142\52\14\33\63\61\314\77\25\165\227\30\212\306\144\14\363\317\106\335\45\206\242\61\37\303\374\23\122\167\31\5"
-  "\205\152\202\241\10\216\216\347\137\60\11\215\7\124\305\10\361\135\103\212\357\362\213\361\135\214\34\337\65\4\71\67"
-  "\24\165\227\61\242\374\27\50\352\126\176\141\76\6\305\376\277\377\37";
-
-/* lib/stat.wo (DEFLATEd, org. size 9195) */
-static unsigned char file_l_40[1077] =
-  "\264\227\313\156\343\40\24\206\367\43\315\73\240\310\213\144\123\371\156\22\251\317\202\210\215\123\64\30\54\300\155\347\355"
-  "\307\70\27\142\202\144\63\162\273\110\71\77\234\303\377\301\151\354\356\73\321\14\214\200\110\151\254\177\377\2\140\117"
-  "\273\136\110\15\166\265\324\73\260\123\175\264\3\373\13\23\147\314\100\64\152\247\121\1\373\156\320\200\146\351\341\160"
-  "\360\344\164\244\23\362\357\230\166\35\134\323\156\343\330\146\54\355\142\66\160\126\177\141\105\221\342\270\127\37\102\243"
-  "\136\222\117\112\276\222\261\100\333\240\226\62\142\40\320\205\350\261\130\73\360\32\104\376\204\223\263\34\354\173\54\161"
-  "\67\155\70\37\113\242\6\346\240\56\130\351\261\376\100\265\44\130\23\324\120\111\152\75\162\57\31\362\46\271\266\66"
-  "\265\30\164\136\57\11\353\254\205\133\126\132\122\176\331\115\3\106\370\303\327\125\77\135\325\265\305\210\224\134\354\356"
-  "\277\155\177\115\361\151\372\364\364\130\133\163\315\114\113\121\336\40\111\230\141\177\370\230\46\117\317\123\353\51\55\13"
-  "\326\47\115\73\163\230\135\217\264\100\123\320\223\332\54\2\367\42\321\143\11\240\145\176\170\310\375\265\244\215\271\272"
-  "\12\267\154\46\152\3\111\223\150\222\255\220\106\317\353\46\365\355\102\264\251\370\54\151\102\246\154\167\231\365\63\315"
-  "\230\132\157\265\340\112\203\44\276\377\114\63\306\356\33\371\326\204\67\150\134\204\224\125\33\372\211\6\33\52\55\44"
-  "\1\242\155\25\321\357\61\300\214\136\370\73\174\365\307\325\253\301\364\107\14\112\322\241\301\246\177\111\334\243\121\267"
-  "\212\327\362\155\136\22\75\110\156\306\257\327\55\120\77\234\31\255\221\11\347\367\114\371\374\102\305\240\203\56\324\12"
-  "\231\53\344\256\120\270\102\351\12\225\53\100\127\70\272\102\22\373\73\313\240\254\153\55\312\355\25\60\201\33\177\117"
-  "\4\364\214\335\331\166\1\264\2\156\32\117\107\255\367\5\267\364\225\224\13\306\262\365\306\322\174\113\147\131\272\340"
-  "\54\137\357\54\113\3\235\55\227\314\203\140\362\330\205\131\114\51\163\117\312\230\300\26\276\304\127\332\207\101\366\141"
-  "\270\175\370\223\366\213\62\304\176\121\6\333\257\322\377\266\177\36\53\377\1\121\22\315\102\70\17\253\171\130\316\303"
-  "\142\36\346\363\60\233\207\336\257\16\353\336\34\33\104\303\375\344\222\373\311\45\56\362\223\240\206\363\155\13\211\64"
-  "\76\63\142\166\61\33\33\57\306\236\161\154\40\14\227\105\45\274\361\330\361\236\157\232\57\374\165\27\156\231\207\146"
-  "\261\174\217\102\147\227\242\52\255\50\344\272\147\351\131\72\114\331\66\114\245\207\251\14\145\202\311\61\335\0\51\337"
-  "\6\251\362\40\125\241\110\111\231\301\174\3\246\142\33\46\350\141\202\241\114\131\132\225\160\3\246\362\71\250\266\1"
-  "\74\172\0\217\241\200\371\61\51\266\150\104\270\15\123\22\273\165\254\30\102\25\37\313\170\3\52\23\54\274\226\267"
-  "\346\23\354\311\367\355\137\77\23\356\16\363\327\363\266\371\327\236\131\340\66\0\303\120\364\102\243\342\171\312\314\355"
-  "\375\265\130\372\222\222\127\205\306\220\255\350\260\363\277\251\310\267\256\314\357\30\252\133\202\171\274\204\101\362\344\204"
-  "\250\171\41\201\206\132\156\52\235\251\376\21\350\362\152\162\67\107\246\63\103\27\270\22\215\273\162\134\321\352\213\23"
-  "\157\327\164\103\221\272\311\123\227\26\140\200\45\151\360\356\114\203\101\157\340\141\360\60\143\17\17\66\207\271\76\57"
-  "\260\305\212\311\241\63\277\160\300\341\217\35\56\203\353\202\332\201\114\203\154\104\227\114\206\257\14\204\230\134\122\47"
-  "\365\33\313\122\206\244\51\240\215\325\112\110\244\360\373\370\266\330\215\227\131\162\355\254\227\206\376\171\302\361\56\331"
-  "\111\332\340\25\113\227\34\336\51\45\317\374\34\45\217\26\344\314\260\327\221\115\306\160\16\121\374\134\206\242\230\120"
-  "\244\100\261\260\302\100\261\342\371\73\115\124\63\121\241\123\207\117\207\61\252\360\352\256\56\277\230\175\257\221\351\14"
-  "\77\313\310\220\117\71\332\334\27\302\101\20\351\53\2\102\132\31\246\376\303\357\107\266\267\175\252\41\37\316\222\16"
-  "\304\73\371\41\47\372\261\74\330\205\104\330\375\60\46\64\46\64\46\164\276\206\11\373\255\73\203\317\5\11\352\203"
-  "\326\375\161\66\257\311\377\242\261\316\373\203\32\65\324\374\242\374\167\202\30\142\226\33\54\203\4\0\1\70\124\134"
-  "\377\273\315\143\63\217\315\74\32\270\140\17\205\323\367\333\103\367\170\5";
-
-/* lib/stdio.wo (DEFLATEd, org. size 192049) */
-static unsigned char file_l_41[13209] =
-  "\354\227\327\222\363\46\24\307\257\323\336\201\321\350\142\113\212\333\370\163\172\357\345\46\75\361\214\7\13\360\236\54\2"
-  "\5\320\266\247\17\6\331\310\110\356\116\367\14\263\13\77\161\376\247\350\170\4\27\271\44\45\247\50\325\206\200\174"
-  "\351\171\204\56\40\57\244\62\50\311\224\111\120\242\213\64\101\27\63\56\247\230\243\324\262\67\54\101\27\171\151\20"
-  "\364\173\227\227\227\55\66\71\315\245\172\264\146\176\342\315\252\171\47\130\154\365\142\35\104\273\357\261\206\211\26\270"
-  "\320\67\322\114\12\105\357\200\336\167\255\100\201\315\315\104\121\201\163\152\205\130\51\62\224\266\157\176\243\266\25\135"
-  "\24\130\341\334\71\72\156\256\250\56\171\153\111\250\122\102\46\213\377\41\111\267\176\303\375\155\111\64\63\217\5\265"
-  "\126\240\11\314\300\54\163\162\374\215\212\156\17\41\26\323\5\316\150\54\346\351\276\142\106\162\171\117\125\44\126\321"
-  "\135\305\264\121\40\146\276\145\262\233\40\346\371\33\236\36\371\6\202\23\73\341\124\304\116\74\75\104\214\52\45\33"
-  "\61\127\374\260\22\144\305\143\254\127\341\123\266\244\66\204\303\324\347\140\44\11\36\35\177\303\323\255\302\154\70\330"
-  "\54\314\171\103\331\343\375\342\337\346\246\134\343\247\74\241\43\246\50\215\235\314\131\135\150\235\155\216\71\227\131\154"
-  "\355\351\336\157\14\33\372\0\46\26\363\164\127\61\226\11\303\255\226\54\152\77\6\7\337\230\243\272\314\276\222\14"
-  "\4\231\50\312\13\154\156\42\351\372\243\103\134\224\2\154\266\326\207\242\70\264\254\247\157\314\131\54\172\260\203\173"
-  "\5\206\306\36\34\74\231\13\256\51\275\215\135\70\330\52\73\34\154\157\331\330\105\306\245\156\144\341\340\336\321\202"
-  "\306\306\74\306\132\236\356\55\126\12\16\342\26\233\130\156\301\117\126\143\225\23\120\115\77\25\336\135\72\174\262\335"
-  "\31\351\15\20\140\0\163\170\242\44\234\203\320\205\375\373\152\46\205\66\313\43\16\301\6\57\214\46\40\247\350\202"
-  "\76\370\30\347\253\344\22\335\141\205\254\320\114\274\75\100\311\270\323\331\163\164\143\162\342\321\373\223\175\15\143\137"
-  "\347\161\36\347\161\36\347\161\36\177\371\110\232\37\155\242\7\335\24\371\217\272\377\116\167\121\362\371\67\237\174\376"
-  "\315\347\337\375\274\326\244\327\60\371\346\375\157\56\256\56\333\15\12\171\337\355\324\116\2\243\326\223\0\353\274\333"
-  "\244\351\173\115\366\163\314\336\33\217\130\143\337\150\64\316\372\61\375\155\314\106\253\154\144\307\340\325\367\127\30\351"
-  "\214\273\275\154\225\215\6\143\362\154\374\372\263\25\112\307\31\261\343\375\326\42\15\233\165\25\130\254\53\351\260\131"
-  "\122\46\340\225\265\333\373\155\333\257\327\156\37\264\155\17\273\227\67\55\220\356\22\303\212\71\106\53\7\105\124\41"
-  "\56\63\314\121\312\212\72\235\132\172\213\322\136\352\227\212\262\127\343\243\241\177\342\254\137\325\324\314\25\26\110\26"
-  "\50\355\246\365\15\63\277\141\233\132\70\220\16\7\235\200\60\41\141\301\315\244\14\53\372\373\123\25\261\232\0\363"
-  "\21\327\22\350\267\106\21\264\44\46\110\62\246\251\171\273\73\134\34\154\343\130\272\375\156\100\130\220\370\171\247\36"
-  "\116\65\147\33\262\67\245\22\176\116\235\230\237\154\15\326\73\353\367\342\272\264\277\205\251\12\357\300\252\107\213\136"
-  "\332\110\42\216\256\321\111\376\46\206\71\217\33\7\216\357\34\330\332\72\360\317\350\35\70\121\363\260\365\332\226\360"
-  "\345\217\327\325\334\163\242\144\261\163\333\300\376\175\3\373\64\116\173\237\304\267\315\325\116\201\156\352\72\45\200\136"
-  "\132\157\35\177\147\365\31\304\112\244\345\265\1\153\64\161\250\140\164\347\17\26\273\166\121\167\270\266\140\206\122\227"
-  "\115\134\367\300\376\150\357\113\264\333\306\231\164\137\245\317\264\357\332\47\71\4\167\146\36\306\107\226\304\104\167\24"
-  "\111\107\224\223\364\74\375\245\105\147\352\7\76\214\76\225\101\310\264\232\263\374\177\0\213\130\12\265\243\252\340\342"
-  "\107\42\350\341\342\252\364\354\217\362\357\356\264\77\256\361\153\71\176\147\261\301\33\47\230\242\200\113\352\201\113\172"
-  "\43\270\310\56\375\214\113\200\144\271\41\205\300\140\267\26\152\166\136\324\224\331\51\151\264\307\365\213\277\122\334\52"
-  "\257\35\203\334\376\343\267\127\347\241\335\154\317\267\75\226\257\347\241\277\370\262\172\104\152\137\20\354\207\355\163\147"
-  "\223\335\276\335\56\276\72\175\355\152\150\123\132\225\216\314\355\310\335\216\312\355\50\335\216\302\355\250\103\71\202\34"
-  "\61\174\41\347\304\305\154\42\35\273\65\225\351\127\260\354\155\267\206\337\212\156\6\62\234\54\225\252\37\26\106\40"
-  "\122\313\232\354\361\5\363\370\54\262\274\200\351\172\224\126\116\105\24\27\371\265\110\162\143\13\366\302\156\346\36\261"
-  "\217\212\14\256\231\157\304\134\22\271\362\211\260\305\372\261\163\171\233\201\317\66\6\224\267\246\362\213\42\1\243\245"
-  "\350\144\60\200\61\271\152\204\334\63\102\243\32\41\175\20\165\243\270\254\232\246\145\235\127\151\226\46\0\212\201\223"
-  "\201\336\42\172\21\16\224\65\105\221\351\6\302\315\226\225\111\352\272\314\65\343\310\66\31\356\2\302\226\175\123\324"
-  "\343\12\60\122\205\111\233\326\32\273\266\247\62\306\151\47\166\273\231\36\71\40\302\344\331\5\15\4\121\261\101\144"
-  "\116\23\305\10\2\245\341\314\255\103\107\200\11\222\330\152\127\126\24\171\76\140\271\50\76\14\301\152\231\113\226\301"
-  "\47\63\145\126\347\1\23\131\133\254\145\363\75\162\242\211\142\365\12\66\373\205\216\177\365\42\70\345\322\27\64\317"
-  "\26\55\163\313\364\353\364\42\204\210\336\64\41\272\260\317\66\133\161\155\26\46\306\221\163\17\63\321\217\13\224\103"
-  "\366\123\135\343\242\250\311\40\345\65\203\230\224\214\122\4\3\100\6\41\166\211\152\310\62\174\110\16\34\146\203\325"
-  "\1\134\107\234\24\370\53\275\252\231\326\242\375\301\37\201\236\330\252\101\376\302\242\273\365\166\275\74\201\241\114\200"
-  "\115\371\45\314\4\73\217\11\160\61\103\374\200\114\354\375\262\245\135\340\224\145\376\171\375\353\324\17\364\330\377\355"
-  "\21\126\237\12\53\266\143\100\164\343\225\271\360\143\276\241\120\333\13\206\125\231\132\304\240\167\314\171\237\61\177\321"
-  "\220\7\303\135\126\60\174\251\60\231\4\26\342\152\270\142\13\53\147\17\53\257\107\142\245\330\202\370\206\303\275\12"
-  "\334\147\300\375\16\265\333\321\270\35\46\201\36\163\73\127\4\372\4\200\245\23\273\377\366\252\215\211\246\332\170\57"
-  "\47\342\313\314\354\135\64\252\162\14\215\252\10\327\250\106\122\51\67\271\132\375\211\257\244\335\263\63\250\272\312\31"
-  "\124\5\71\203\310\10\51\167\6\221\21\162\346\14\32\135\33\336\324\332\33\11\243\271\220\40\56\251\310\252\30\334"
-  "\26\12\204\303\0\331\170\0\331\150\1\231\352\1\371\61\135\151\323\167\235\231\204\371\316\360\147\350\74\223\43\112"
-  "\320\363\25\212\162\306\214\21\302\361\11\115\105\264\122\365\110\211\356\267\140\257\230\302\376\20\213\107\224\367\241\15"
-  "\312\73\277\46\354\377\42\335\26\350\20\157\372\337\372\27\253\17\213\221\261\270\212\32\61\364\102\73\164\316\375\1"
-  "\0\16\270\5\43\266\154\273\175\356\276\41\74\370\41\340\106\122\101\135\24\32\142\63\353\75\247\171\356\336\217\133"
-  "\131\202\12\134\222\75\152\16\77\227\175\361\373\133\74\37\375\34\314\152\2\165\137\341\275\31\25\103\323\242\14\103"
-  "\376\34\121\306\312\43\123\234\32\154\25\203\115\206\124\333\317\355\146\273\365\263\10\306\10\173\150\77\75\267\310\366"
-  "\204\245\5\206\66\20\47\104\171\265\23\42\32\373\31\301\32\65\17\1\110\36\140\233\247\74\246\50\230\45\324\272"
-  "\125\13\271\206\203\325\143\143\45\231\245\300\133\51\226\174\155\121\330\343\230\76\204\220\305\231\4\61\214\237\144\124"
-  "\337\120\361\240\166\113\20\226\274\77\336\24\3\313\211\22\166\365\36\204\255\227\133\65\367\60\350\267\101\26\312\145"
-  "\336\343\213\270\354\245\236\250\377\277\173\364\6\200\304\161\213\105\260\130\55\245\153\2\242\123\72\232\167\17\23\44"
-  "\107\252\317\14\220\345\210\72\63\252\65\204\72\3\102\45\174\226\264\326\353\46\267\14\270\66\1\54\30\54\31\260"
-  "\132\307\74\260\322\17\311\71\315\302\13\254\2\201\205\341\344\234\22\67\227\15\361\211\344\140\214\51\272\322\150\242"
-  "\53\276\207\205\306\31\363\5\244\143\50\325\335\363\323\45\107\115\57\107\375\243\243\231\240\367\350\4\372\61\144\205"
-  "\350\31\352\373\107\14\126\323\137\24\342\361\12\274\143\336\114\242\364\376\272\26\37\130\70\315\161\323\1\346\30\307"
-  "\2\61\112\115\331\276\121\170\166\177\1\62\220\20\37\131\47\112\127\275\175\132\352\355\40\36\261\207\174\74\232\35"
-  "\147\112\255\301\44\175\12\74\120\31\242\23\120\13\243\337\356\176\112\141\175\152\43\222\210\144\274\110\345\241\26\234"
-  "\106\130\272\331\142\45\326\341\271\351\232\206\275\231\141\107\166\165\275\15\144\367\54\367\317\273\223\76\361\354\164\264"
-  "\255\266\335\166\335\236\234\256\361\354\113\200\173\277\61\220\305\375\232\340\167\57\373\215\232\123\65\300\57\132\226\23"
-  "\314\104\166\370\375\171\13\160\71\37\15\130\26\140\53\300\202\2\322\356\25\322\167\313\244\257\150\56\266\143\4\151"
-  "\306\157\6\160\50\332\60\102\330\242\124\365\253\55\344\373\325\346\307\343\63\176\200\347\36\254\202\30\275\12\302\355"
-  "\357\110\132\234\130\135\74\162\120\273\51\232\255\34\101\257\102\123\122\117\56\110\302\127\42\354\316\153\247\267\374\153"
-  "\231\5\227\14\274\225\154\243\226\155\340\362\344\76\260\7\357\341\357\253\46\332\301\11\0\337\17\247\31\140\153\322"
-  "\107\16\212\54\65\246\175\245\130\230\216\64\365\350\266\6\164\3\236\313\230\235\114\304\127\217\22\16\75\66\21\352"
-  "\244\14\165\67\361\62\232\153\114\117\213\156\75\226\176\244\165\13\0\107\31\226\23\114\321\303\60\344\154\106\221\147"
-  "\144\342\320\200\364\160\167\156\224\230\41\342\321\42\47\241\117\223\102\152\103\147\211\4\14\301\366\140\224\160\177\227"
-  "\27\115\167\350\316\32\350\62\112\110\216\130\252\172\371\21\327\371\240\272\267\120\162\271\323\362\333\177\50\170\34\141"
-  "\141\23\270\313\43\76\14\44\140\14\153\106\227\125\170\24\143\302\157\356\124\307\34\206\304\343\304\343\232\212\0\123"
-  "\215\343\37\364\302\266\16\361\343\23\37\105\64\251\45\310\27\314\76\231\234\215\177\157\103\220\53\200\105\76\236\157"
-  "\16\355\0\215\241\13\43\64\226\152\377\332\323\301\341\244\355\201\152\207\46\106\270\106\355\217\337\360\161\364\327\147"
-  "\122\120\325\74\74\220\37\43\207\222\3\224\357\72\370\216\317\176\6\34\241\161\24\171\74\226\16\31\262\314\200\173"
-  "\306\265\43\367\346\376\271\61\313\136\326\351\345\53\365\222\363\312\0\276\107\110\136\356\345\236\321\21\371\101\175\143"
-  "\172\67\22\347\237\156\54\151\215\167\170\176\367\27\271\371\203\245\373\251\0\227\23\116\5\234\262\226\214\232\321\114"
-  "\47\116\142\251\52\21\272\370\360\300\176\102\226\127\122\345\3\67\117\364\350\23\271\130\215\76\22\2\205\7\267\13"
-  "\345\207\2\307\350\370\34\77\74\71\276\141\31\16\12\164\317\215\254\274\212\240\40\76\77\5\373\40\127\24\372\0"
-  "\204\370\241\60\145\140\50\214\302\332\120\11\336\112\51\170\25\361\20\121\5\157\175\221\163\16\131\334\165\17\66\275"
-  "\54\256\271\54\306\233\147\276\12\206\335\142\272\10\161\12\236\53\44\160\0\365\146\50\350\302\5\261\77\114\342\114"
-  "\313\142\244\15\355\51\7\112\54\345\33\375\325\300\175\105\112\350\347\342\26\336\124\242\61\364\176\15\275\355\45\206"
-  "\124\264\374\150\142\61\7\235\243\100\13\163\310\140\167\170\250\1\32\46\122\11\254\7\325\114\220\35\73\266\237\335"
-  "\172\162\71\24\250\51\206\337\35\341\117\270\2\202\302\200\305\50\354\256\216\277\41\231\35\243\105\111\111\63\267\306"
-  "\52\342\371\102\201\3\10\206\14\222\5\265\113\304\330\360\110\55\321\242\357\74\122\13\352\32\141\41\33\51\322\363"
-  "\236\61\74\162\372\204\311\221\60\35\205\207\137\372\342\6\252\334\101\340\17\105\5\44\126\371\210\353\154\261\63\326"
-  "\246\236\15\104\122\322\303\224\273\201\345\131\117\204\163\245\210\53\53\334\45\41\343\160\45\225\273\143\302\243\360\242"
-  "\5\135\265\207\347\123\47\46\334\271\351\132\160\235\332\64\333\255\366\273\265\322\22\73\70\77\330\235\256\265\324\150"
-  "\271\332\141\75\321\356\252\270\165\23\201\212\71\127\232\265\255\367\324\266\360\127\341\52\16\327\71\272\253\155\4\140"
-  "\255\313\303\337\0\305\67\276\357\163\200\36\70\60\242\104\2\1\123\172\342\346\332\364\365\45\256\346\305\326\227\204"
-  "\127\362\101\71\203\125\242\117\200\6\205\54\162\2\304\55\377\100\360\252\365\206\116\173\44\235\106\147\360\252\173\235"
-  "\207\123\364\377\265\135\357\140\262\136\132\217\341\27\202\115\312\300\350\23\302\33\44\374\52\74\136\323\326\217\374\352"
-  "\21\252\103\270\263\220\207\4\345\20\104\147\213\200\256\240\267\217\267\334\45\7\364\120\57\102\100\75\264\5\330\372"
-  "\120\331\61\242\6\170\14\251\106\40\351\157\362\325\17\266\211\162\66\112\370\175\316\1\140\235\105\44\230\207\277\336"
-  "\21\136\355\55\366\72\302\102\132\45\211\340\231\56\65\334\100\26\331\222\172\225\327\24\44\16\260\41\130\131\324\233"
-  "\117\316\176\372\111\227\302\175\316\115\65\363\341\126\152\270\342\32\77\314\301\114\42\314\341\143\247\251\152\202\0\323"
-  "\242\270\310\362\24\131\333\374\75\135\21\311\266\327\147\31\36\131\215\270\237\315\304\60\23\103\214\150\311\115\26\30"
-  "\340\23\20\315\303\345\110\147\313\21\264\30\130\100\14\43\66\164\227\166\11\270\133\243\125\240\104\343\6\215\317\4"
-  "\75\220\350\361\367\166\52\75\103\362\211\350\45\342\350\344\343\143\6\46\250\270\167\131\254\243\113\260\53\364\145\54"
-  "\321\7\347\162\33\367\137\156\3\211\130\115\5\133\222\362\14\63\205\224\112\223\75\220\54\372\116\157\262\1\250\47"
-  "\342\167\357\124\156\365\160\177\243\276\126\243\364\115\331\63\317\53\205\304\367\314\23\254\0\131\205\336\144\102\270\73"
-  "\56\151\65\76\145\104\46\376\16\261\122\15\354\22\256\220\75\357\154\313\176\150\337\324\332\341\105\327\226\21\334\271"
-  "\21\312\136\107\210\136\216\355\20\333\362\30\326\251\247\231\47\212\264\373\60\257\237\202\43\306\317\334\214\137\126\74"
-  "\376\335\154\220\132\311\47\214\156\157\307\257\116\34\46\22\257\271\127\172\171\334\121\330\377\271\211\216\135\233\375\17"
-  "\363\72\175\307\315\327\315\216\212\205\45\106\65\115\377\45\210\11\4\307\143\151\223\370\325\165\257\13\32\30\16\36"
-  "\234\266\140\305\114\367\12\52\362\75\240\142\131\43\24\154\104\327\335\360\11\206\115\362\223\104\51\252\211\151\172\163"
-  "\304\203\372\321\132\163\351\321\332\341\207\77\217\213\303\143\77\216\45\141\110\134\251\234\34\207\51\212\16\64\21\344"
-  "\253\361\364\320\264\16\275\201\136\162\217\137\30\131\21\34\21\105\64\352\124\321\362\334\0\227\276\52\167\62\231\310"
-  "\270\103\200\262\21\325\237\161\100\110\207\107\206\104\246\102\305\311\106\170\371\156\372\117\327\205\227\307\327\113\26\344"
-  "\340\27\344\13\112\106\255\224\101\131\102\253\70\0\356\52\214\276\150\105\1\133\305\313\302\112\137\177\345\335\361\374"
-  "\156\104\6\353\213\354\301\155\302\371\314\35\322\53\312\11\135\220\326\201\373\55\25\41\130\247\365\166\53\226\372\271"
-  "\251\17\301\262\215\367\327\276\305\352\377\75\167\322\247\217\23\345\22\30\215\301\150\241\241\321\35\275\170\353\33\0"
-  "\43\257\245\60\34\110\74\346\316\367\2\213\211\20\272\372\117\362\11\104\160\116\107\166\316\23\344\224\205\5\370\235"
-  "\247\352\41\20\26\44\222\107\361\214\33\361\24\10\14\101\50\123\167\1\14\315\5\307\161\375\163\263\133\211\344\30"
-  "\332\42\72\142\75\153\37\244\66\306\307\211\344\2\116\310\142\242\110\250\111\77\260\71\201\152\364\237\362\6\230\347"
-  "\264\155\202\10\341\21\0\23\65\110\24\61\231\207\275\23\225\331\167\260\153\40\311\121\347\332\146\231\63\155\23\370"
-  "\314\75\253\237\263\372\71\253\237\263\372\71\253\237\104\331\44\323\110\157\200\12\112\106\46\212\51\177\263\115\24\26"
-  "\352\323\361\362\323\372\55\145\133\72\127\242\165\52\211\246\210\140\360\11\270\203\64\47\36\325\40\7\46\247\340\223"
-  "\27\365\105\34\220\221\346\370\210\10\22\144\16\130\220\250\157\274\76\106\346\65\5\276\56\74\355\371\111\32\376\60"
-  "\203\71\14\200\10\241\17\37\34\300\366\167\17\41\3\342\77\233\170\20\201\54\165\16\53\210\351\75\232\303\12\270"
-  "\253\161\16\24\230\3\5\346\100\201\111\120\140\374\253\177\246\5\150\3\2\372\345\376\260\236\1\174\355\140\126\56"
-  "\74\71\361\175\277\132\143\316\75\261\204\107\172\10\260\104\103\127\157\327\302\72\22\350\61\320\203\253\317\240\47\207"
-  "\236\2\172\176\357\140\122\226\137\256\40\371\24\164\266\200\267\214\303\74\264\105\71\246\121\55\142\147\273\171\372\322"
-  "\36\327\153\115\312\123\36\162\3\47\22\4\106\11\276\140\10\160\227\120\16\74\235\53\300\54\55\124\262\15\113\275"
-  "\111\263\260\233\371\305\32\276\351\3\343\356\3\307\164\74\350\222\135\234\303\0\271\156\0\134\101\251\33\101\266\144"
-  "\327\317\225\241\47\160\241\231\7\75\367\241\247\327\162\24\172\55\306\240\327\142\34\172\205\104\363\14\213\42\207\36"
-  "\165\300\113\150\210\254\232\343\206\207\167\336\136\43\47\341\117\157\102\22\77\74\144\245\227\324\174\141\165\204\312\204"
-  "\100\20\314\2\201\255\206\233\371\151\64\43\102\363\362\112\255\367\357\10\360\365\107\207\70\20\172\106\203\46\253\130"
-  "\216\214\3\332\317\367\276\261\137\52\17\127\26\300\171\125\370\15\370\50\352\224\211\202\132\14\334\361\75\143\6\45"
-  "\267\164\322\303\1\15\233\363\141\40\212\160\134\316\36\102\254\221\170\354\310\4\270\103\103\120\2\235\14\50\322\105"
-  "\125\40\141\15\362\135\130\341\212\342\126\256\141\230\271\34\247\12\64\367\232\270\116\23\215\317\304\273\25\256\60\340"
-  "\112\311\127\134\161\1\375\110\230\276\355\40\22\127\53\207\316\343\246\173\334\57\117\217\253\76\201\346\344\324\0\372"
-  "\306\53\271\277\374\312\363\70\54\100\243\326\125\1\125\14\135\24\157\313\51\346\140\131\255\227\37\30\54\125\54\260"
-  "\174\133\377\372\47\202\105\137\320\111\267\262\246\212\266\151\223\244\372\135\337\170\373\145\21\155\373\125\22\270\173\102"
-  "\23\335\351\270\333\256\167\303\300\102\20\175\267\343\165\137\374\272\312\315\336\15\235\264\142\354\351\210\346\54\53\370"
-  "\352\126\11\356\274\265\216\70\340\137\367\342\355\327\27\255\225\257\350\301\350\352\321\362\7\144\160\215\341\357\307\300"
-  "\74\160\160\0\16\202\142\213\323\176\3\330\305\357\153\340\266\346\332\7\342\66\354\35\15\330\21\67\113\10\336\201"
-  "\66\203\62\130\137\1\164\203\254\20\237\125\304\235\114\247\352\56\267\60\24\40\106\71\253\250\216\263\321\277\161\1"
-  "\147\301\325\213\335\143\257\277\266\353\243\215\354\347\67\167\54\136\272\131\375\2\346\332\363\140\273\257\237\226\353\44"
-  "\347\261\240\157\30\356\252\367\161\207\345\171\107\5\200\222\343\21\370\220\253\150\16\306\166\263\135\107\6\242\60\232"
-  "\326\175\254\122\237\353\203\240\24\2\234\37\103\230\137\6\211\363\62\10\74\244\211\344\246\167\374\367\377\201\132\12"
-  "\66\102\43\257\371\233\15\122\356\327\133\274\134\137\73\362\174\216\75\167\71\71\234\245\73\261\27\34\66\103\206\204"
-  "\260\215\370\257\60\364\253\272\360\100\31\175\67\114\232\145\350\335\62\367\346\177\112\201\23\235\365\332\323\342\151\273"
-  "\176\31\345\145\340\227\271\136\246\177\131\21\321\73\145\373\234\153\142\230\254\327\246\42\45\122\311\5\45\133\130\372"
-  "\246\205\231\22\126\146\112\167\151\251\167\151\162\160\154\151\231\142\151\352\13\334\342\312\105\344\61\27\121\222\105\134"
-  "\12\326\145\311\134\304\152\342\334\246\355\205\203\236\337\264\177\264\32\176\23\217\171\150\370\1\22\374\130\104\376\272"
-  "\356\266\337\314\152\375\175\177\352\301\132\346\322\307\261\45\210\244\141\31\343\142\213\330\310\73\33\117\66\242\312\212"
-  "\6\114\25\336\247\105\347\40\323\317\315\352\364\315\356\72\364\272\263\243\26\43\276\311\320\257\35\253\345\105\75\371"
-  "\353\376\324\365\140\260\73\373\341\355\354\302\176\315\62\371\153\337\323\301\301\354\366\100\105\253\211\221\223\130\323\140"
-  "\116\223\360\150\116\134\253\201\236\314\42\335\257\333\375\323\177\51\62\307\323\227\356\360\0\26\154\17\244\13\77\146"
-  "\246\261\174\327\301\167\174\366\363\211\160\277\113\217\61\374\107\253\45\377\315\53\52\1\5\236\121\71\374\371\202\117"
-  "\27\374\275\147\332\40\206\3\131\227\130\17\276\27\152\6\2\260\330\152\317\115\16\143\254\103\306\26\53\355\331\362"
-  "\62\342\114\150\265\6\115\357\103\1\24\273\73\321\364\173\175\174\265\71\256\227\247\337\314\251\377\120\376\337\265\334"
-  "\271\311\223\27\243\276\146\201\343\147\70\76\267\163\330\2\375\326\25\47\12\41\115\351\23\112\304\76\205\323\130\276"
-  "\340\246\272\2\233\76\250\147\222\243\271\31\33\315\271\275\202\166\360\40\377\25\65\321\203\51\176\146\70\65\201\256"
-  "\222\54\364\311\242\44\206\375\336\310\2\223\360\120\253\140\274\115\76\10\305\300\231\0\114\232\304\25\271\165\255\20"
-  "\271\72\122\323\276\372\106\222\11\356\225\324\40\364\123\150\211\310\34\244\70\257\303\270\366\217\311\213\46\231\104\361"
-  "\45\227\224\246\234\105\345\107\22\225\205\236\176\365\71\373\263\250\234\11\140\26\225\245\222\324\344\23\350\273\153\122"
-  "\343\62\120\316\4\376\301\75\362\265\335\54\130\62\150\115\344\36\315\345\64\211\156\204\2\107\50\65\43\310\26\301"
-  "\221\216\61\162\22\330\345\273\20\363\34\174\146\40\52\146\26\361\12\124\217\21\161\260\224\345\370\343\372\365\161\6"
-  "\323\360\216\325\101\336\61\175\332\252\76\373\365\76\275\143\343\251\74\202\164\117\107\53\50\127\72\163\117\70\241\325"
-  "\53\337\341\375\71\206\152\10\103\253\356\204\241\315\14\115\242\201\77\70\103\63\111\20\107\153\224\34\115\76\201\276"
-  "\121\70\332\314\321\112\37\107\253\274\34\255\202\230\33\344\150\240\236\66\26\107\63\311\235\260\264\231\245\111\66\335"
-  "\107\147\151\201\127\230\332\73\114\371\6\72\107\342\152\63\127\153\174\134\315\44\36\266\146\167\17\137\362\74\51\77"
-  "\213\130\372\103\356\40\10\34\243\161\326\307\343\156\377\345\374\237\232\312\316\62\73\104\7\101\224\17\104\375\51\210"
-  "\220\25\111\300\45\223\163\307\57\70\110\144\125\22\10\301\243\324\151\266\25\0\0\372\100\72\245\0\22\164\155\140"
-  "\101\223\356\164\74\355\267\133\300\340\343\32\62\72\157\273\246\147\377\242\50\242\40\247\312\122\165\62\27\71\42\75"
-  "\355\340\222\145\77\152\212\41\361\232\335\30\361\232\35\215\314\304\204\45\47\306\262\355\217\360\215\31\114\334\143\211"
-  "\22\2\176\362\62\277\42\343\122\227\310\373\17\121\305\320\13\152\102\300\46\127\156\51\116\300\137\61\222\63\45\261"
-  "\154\306\73\172\170\262\262\2\347\204\157\316\101\150\321\356\65\370\155\172\247\313\221\136\236\376\76\254\277\364\22\161"
-  "\377\163\175\104\104\43\77\215\203\157\172\374\211\237\255\170\107\370\43\150\43\332\65\171\204\100\153\356\355\102\263\274"
-  "\167\310\240\341\67\302\172\324\272\47\55\230\15\72\306\52\100\307\320\145\200\264\341\31\40\275\67\0\263\77\372\161"
-  "\245\143\267\376\152\375\302\233\16\262\163\232\177\232\204\347\213\160\215\207\245\207\144\274\326\367\173\346\213\360\132\337"
-  "\345\25\325\277\253\71\357\344\302\157\172\4\346\77\352\161\170\116\114\371\140\136\327\71\61\45\252\212\74\253\310\61"
-  "\362\176\204\337\114\75\347\147\251\114\130\11\247\347\71\224\60\211\314\117\52\306\117\140\263\24\340\0\274\343\272\375"
-  "\374\362\243\337\32\357\252\313\315\203\367\210\4\220\340\201\263\340\204\227\211\243\102\11\206\347\361\226\103\302\370\253"
-  "\174\337\354\240\357\257\241\117\346\21\232\17\67\61\302\157\11\202\157\57\144\263\77\326\307\123\350\365\205\2\201\215"
-  "\111\42\123\110\375\56\24\222\6\122\110\157\116\371\210\4\13\73\41\372\356\26\273\173\305\51\364\103\160\147\366\34"
-  "\301\60\11\267\271\100\27\234\113\110\307\223\214\312\347\30\225\362\25\372\165\104\355\175\101\270\274\14\137\103\341\5"
-  "\227\42\304\44\0\62\106\126\305\223\227\42\126\136\346\332\173\134\74\320\357\226\327\270\65\17\223\62\144\362\207\71"
-  "\113\373\235\302\176\160\162\356\207\43\261\77\262\174\30\201\52\320\61\343\341\324\321\301\323\216\227\53\37\356\47\137"
-  "\163\216\225\303\173\70\370\207\342\72\155\126\215\47\340\146\366\147\260\317\151\121\163\132\324\335\45\117\316\201\371\134"
-  "\321\11\260\122\146\175\147\116\171\222\101\347\44\116\374\311\314\64\143\63\115\70\324\145\174\123\217\137\54\244\221\375"
-  "\205\11\167\200\261\65\46\46\356\32\313\346\322\32\11\63\237\223\275\146\176\76\363\312\71\6\111\103\173\132\177\253"
-  "\174\3\235\367\33\206\64\55\156\233\7\105\12\101\235\43\61\127\313\331\134\235\113\143\114\114\265\50\303\124\13\255"
-  "\147\134\276\201\316\177\240\152\201\146\136\341\63\363\112\217\15\147\365\342\167\370\217\370\71\340\64\342\145\152\111\340"
-  "\125\364\44\360\121\63\243\61\11\172\345\113\201\366\216\77\147\76\377\350\166\335\162\261\153\345\115\372\337\135\362\54"
-  "\175\120\272\122\273\77\176\137\234\354\276\37\13\232\25\55\131\116\257\135\362\262\222\364\74\55\72\247\347\362\343\217"
-  "\47\147\100\273\271\132\167\316\17\66\147\372\164\163\234\116\313\157\316\270\277\354\127\161\376\266\323\244\66\143\344\73"
-  "\105\170\37\247\242\11\120\15\117\200\62\6\172\322\67\345\73\25\127\144\100\125\320\123\103\17\254\71\115\240\7\341"
-  "\233\102\117\334\67\175\322\52\175\207\344\252\1\307\371\257\6\34\277\206\43\247\145\302\304\11\256\212\152\45\344\225"
-  "\262\201\245\300\252\17\344\301\361\3\177\344\123\373\242\67\37\236\344\114\157\272\356\260\130\212\244\160\137\163\224\15"
-  "\25\232\31\215\142\106\30\124\247\114\37\274\132\232\255\203\111\43\147\65\22\161\156\56\137\211\252\316\344\175\132\336"
-  "\271\145\206\7\317\155\62\16\330\60\266\60\47\332\163\367\117\234\22\177\170\367\245\143\142\240\224\127\34\75\271\33"
-  "\122\305\324\160\5\334\121\31\276\111\231\142\164\346\51\325\300\205\33\66\367\317\15\147\156\70\207\37\207\160\303\332"
-  "\307\15\33\17\67\264\172\345\73\31\355\203\223\213\134\250\223\67\325\103\24\342\230\164\60\277\340\244\247\3\176\203"
-  "\367\211\237\237\143\356\341\307\370\303\361\222\122\145\33\70\313\370\31\200\134\365\341\110\41\310\312\251\47\270\176\33"
-  "\132\355\341\272\206\37\344\77\26\236\56\30\277\274\74\201\174\101\211\27\366\5\171\232\206\73\63\244\36\12\226\244"
-  "\16\66\313\345\376\312\237\374\344\74\344\142\370\123\53\130\300\345\373\363\66\200\47\313\51\260\242\75\0\63\21\205"
-  "\262\360\120\314\302\272\274\320\342\147\52\57\320\13\144\63\307\363\122\73\355\312\151\227\116\273\160\332\271\323\166\307"
-  "\117\235\266\161\332\211\335\116\33\247\135\73\355\312\151\227\116\273\160\332\271\323\316\234\166\352\264\215\323\166\326\147"
-  "\32\247\135\73\355\312\151\227\116\273\160\332\271\37\141\2\121\210\243\75\174\263\301\307\211\312\342\122\172\21\276\217"
-  "\124\343\10\215\156\4\264\322\252\104\65\102\226\340\10\106\67\2\322\125\135\353\106\100\356\325\50\327\120\340\10\225"
-  "\16\222\71\216\320\350\326\200\43\230\104\167\30\246\361\14\141\164\373\50\74\103\244\272\41\112\317\20\231\156\210\312"
-  "\63\104\256\203\205\17\234\112\372\112\74\103\224\272\125\370\140\121\353\206\360\234\210\121\22\151\345\31\102\211\27\306"
-  "\63\104\252\133\105\351\31\242\320\15\221\171\206\120\236\110\355\31\102\111\353\51\16\221\46\272\41\62\317\20\72\160"
-  "\212\344\73\212\132\361\252\252\344\1\212\44\222\334\350\156\103\260\325\122\237\42\5\336\55\60\356\360\3\174\151\41"
-  "\263\0\123\214\4\230\372\66\200\321\302\345\255\140\51\37\24\63\373\6\250\244\345\47\61\335\160\226\273\53\115\254"
-  "\226\261\132\251\325\312\254\126\156\265\12\253\125\132\255\312\152\325\126\313\132\113\226\130\55\143\265\122\253\225\131\255"
-  "\334\152\25\126\253\264\132\225\316\242\361\131\111\7\77\140\205\115\40\51\5\271\52\144\32\45\141\301\312\117\266\261"
-  "\342\50\377\171\346\264\123\247\155\234\166\102\25\103\231\323\303\142\163\303\224\72\362\175\102\104\67\35\40\25\36\57"
-  "\273\357\41\56\143\323\312\257\166\340\261\324\323\142\24\52\243\101\52\232\221\125\311\31\15\177\102\173\34\335\77\66"
-  "\371\353\335\324\370\6\315\63\106\362\236\175\237\275\227\362\344\165\237\171\160\311\216\127\310\213\371\376\352\376\357\257"
-  "\346\347\244\103\356\257\362\334\233\276\352\213\243\261\273\345\123\144\41\322\372\320\64\364\141\156\61\320\171\235\73\56"
-  "\264\332\70\355\304\156\127\215\323\256\235\166\345\264\113\247\135\70\155\67\312\252\164\332\205\323\166\177\237\71\355\324"
-  "\151\33\247\355\354\47\157\234\166\355\264\53\342\270\43\102\275\52\230\333\216\174\137\61\247\35\371\276\301\357\65\132"
-  "\121\315\34\166\344\373\322\4\152\145\15\161\326\261\375\347\201\132\135\115\34\165\24\0\71\161\323\321\35\224\304\111"
-  "\107\7\360\155\41\323\340\100\102\274\153\24\6\45\161\111\321\1\62\342\220\242\3\44\304\35\105\361\240\242\236\44"
-  "\262\202\202\370\221\350\0\226\171\120\132\2\266\262\132\265\325\362\110\330\23\222\304\250\351\271\47\17\254\161\2\226"
-  "\120\207\322\21\162\123\136\17\340\373\372\373\376\370\367\347\166\263\335\372\107\302\122\116\372\264\41\365\56\65\233\63"
-  "\114\153\255\303\127\354\237\330\220\211\233\130\23\247\274\376\115\244\231\63\66\263\211\65\163\316\146\116\43\315\234\145"
-  "\221\236\123\305\2\41\267\17\125\151\124\236\353\20\227\255\230\110\334\243\62\44\144\61\243\27\277\120\344\110\312\67"
-  "\243\161\106\223\207\143\340\333\342\215\212\167\72\104\102\71\171\311\50\307\43\330\311\61\211\43\127\221\134\34\10\337"
-  "\46\233\46\174\33\312\23\313\110\360\45\345\367\13\143\347\64\45\17\43\37\203\270\324\40\150\153\230\335\132\115\32"
-  "\70\75\146\205\217\172\53\20\215\5\200\26\252\117\301\120\370\35\203\47\43\347\255\130\212\175\374\221\43\231\4\23"
-  "\360\3\325\235\316\322\242\231\354\141\344\320\156\271\325\360\123\115\356\120\115\361\160\225\136\206\253\104\70\360\52\4"
-  "\361\70\224\177\47\113\354\121\42\300\122\170\265\330\226\105\46\366\43\264\162\151\51\40\253\73\155\25\354\353\33\300"
-  "\76\215\106\174\0\373\104\340\13\55\43\255\53\224\111\357\325\34\0\260\243\367\134\310\213\112\133\60\126\354\156\122"
-  "\310\64\300\247\260\141\223\10\147\20\370\334\377\5\135\204\107\123\10\113\111\213\102\272\26\210\212\204\174\165\372\212"
-  "\234\246\360\370\22\27\331\41\324\261\107\111\237\33\306\171\232\267\24\31\213\231\246\234\250\157\66\345\33\354\274\327"
-  "\273\115\341\265\276\134\144\273\173\300\66\41\30\213\15\326\66\33\154\156\310\6\147\66\70\263\301\372\41\234\305\305"
-  "\344\106\372\222\265\362\15\166\336\77\67\362\346\2\113\367\320\252\245\205\353\11\347\64\341\227\104\32\166\305\155\142"
-  "\0\310\224\43\52\70\354\110\370\230\102\33\347\352\17\241\316\64\330\335\57\377\300\13\311\62\261\132\306\152\245\126"
-  "\53\263\132\271\325\52\254\126\111\123\362\206\52\153\166\274\207\33\217\222\71\355\324\151\33\247\235\330\355\262\161\332"
-  "\165\140\174\104\23\30\137\120\245\201\167\353\225\11\275\133\257\3\257\306\253\54\360\152\134\16\351\50\47\376\212\65"
-  "\265\325\152\244\45\237\101\336\60\240\224\177\164\57\354\152\335\0\251\264\374\200\110\64\343\111\113\257\326\241\152\20"
-  "\362\210\60\164\313\252\375\302\100\257\157\340\233\303\73\330\306\57\200\47\24\251\203\162\226\41\260\103\101\14\222\206"
-  "\111\257\270\202\310\30\375\203\256\376\112\174\101\176\155\30\35\45\24\370\216\255\323\374\171\134\34\36\67\145\316\264"
-  "\73\131\131\100\250\372\257\13\21\347\124\26\126\271\325\52\254\226\375\113\233\65\324\126\313\56\12\223\130\55\63\21"
-  "\242\217\115\337\150\301\374\375\117\242\357\0\44\26\120\41\22\267\375\276\51\32\113\113\303\27\50\100\24\346\252\174"
-  "\204\126\122\66\156\141\10\331\267\323\110\37\142\34\55\226\72\156\235\72\307\255\267\310\161\173\340\345\213\27\207\7"
-  "\126\277\130\112\34\277\266\217\153\371\231\275\253\176\64\157\51\225\141\77\355\147\253\134\363\146\367\330\156\266\76\367"
-  "\12\232\151\254\156\252\124\172\1\54\226\272\320\236\122\332\254\200\54\326\223\221\357\310\31\71\107\4\47\64\335\23"
-  "\221\277\276\360\162\371\353\376\351\76\16\306\75\31\357\321\74\75\267\123\247\236\176\211\355\372\10\303\364\335\276\76"
-  "\33\376\307\315\356\353\227\376\277\104\52\177\244\43\204\102\357\103\7\77\304\345\376\171\167\272\307\163\225\276\141\217"
-  "\236\243\352\117\173\327\37\367\143\367\1\17\374\207\53\361\176\160\221\247\257\330\77\5\31\305\101\341\102\2\1\241"
-  "\337\370\204\104\1\337\77\0\200\320\176\0\110\46\315\161\71\244\166\0\252\140\76\311\301\167\7\214\215\74\64\262"
-  "\177\76\375\353\136\4\152\354\121\221\376\205\45\357\53\43\2\67\174\70\3\126\337\17\102\357\244\360\125\61\264\320"
-  "\161\124\22\320\160\361\326\163\110\300\257\37\73\345\65\1\207\364\356\171\273\35\37\316\154\132\141\177\121\216\267\75"
-  "\260\167\122\262\377\356\341\24\172\236\235\110\50\176\132\152\363\134\6\247\350\261\11\271\232\305\40\74\374\72\174\302"
-  "\304\172\50\257\343\376\116\277\364\257\357\352\211\0\54\346\35\116\363\130\337\233\207\71\240\137\213\255\2\316\11\371"
-  "\174\273\175\356\276\365\334\133\330\220\334\266\53\71\323\161\375\303\346\20\175\147\20\217\370\157\345\61\374\102\336\224"
-  "\22\1\275\135\174\355\250\331\322\235\26\307\323\143\277\12\207\273\60\141\43\254\105\206\200\137\237\227\0\276\133\214"
-  "\203\241\101\10\174\124\103\106\175\113\24\175\112\136\151\24\67\70\74\316\243\215\301\172\126\75\317\203\117\307\51\104"
-  "\72\364\51\34\237\134\335\220\356\63\372\277\41\344\345\377\200\243\66\102\244\246\120\70\167\342\112\103\367\206\221\150"
-  "\140\124\237\225\337\163\371\47\374\30\137\74\344\217\372\335\35\246\50\336\147\12\340\117\55\171\333\211\1\20\331\44"
-  "\236\51\343\15\355\375\23\276\346\331\37\151\170\67\307\105\366\356\264\137\74\212\111\370\36\142\173\267\376\272\70\155"
-  "\176\254\235\357\26\235\323\163\350\341\27\46\360\247\373\2\343\150\132\203\237\224\106\326\51\302\363\2\345\324\161\27"
-  "\322\300\31\302\336\241\342\233\115\175\273\325\155\133\123\164\220\227\361\107\221\153\247\330\162\365\254\357\33\150\7\371"
-  "\251\37\200\354\241\366\24\7\342\260\321\253\0\361\37\1\307\274\365\232\32\155\302\236\123\57\173\116\55\25\12\264"
-  "\126\71\71\21\305\52\2\124\35\33\242\241\376\350\146\74\111\303\360\44\367\340\211\325\213\317\326\160\234\50\275\110"
-  "\101\301\41\300\246\63\44\151\316\244\215\4\360\160\4\341\114\51\74\11\205\243\275\314\22\312\324\103\354\24\334\40"
-  "\106\175\342\201\343\26\342\257\134\110\4\303\330\365\313\16\320\102\262\64\314\265\61\163\61\157\274\270\242\236\312\4"
-  "\316\173\76\142\372\272\36\244\125\214\175\302\126\44\364\14\162\317\263\70\265\352\262\17\376\241\7\336\44\1\123\276"
-  "\105\151\212\14\217\100\223\163\222\160\256\20\316\5\207\263\322\54\6\115\160\172\160\250\21\16\331\350\160\250\247\17"
-  "\207\306\177\63\242\247\73\374\7\372\67\271\347\225\370\114\31\344\270\122\17\147\46\76\127\377\265\44\367\206\156\367"
-  "\273\257\161\174\241\77\26\333\347\365\273\73\77\145\131\257\35\347\267\60\355\256\76\24\337\356\150\245\303\161\241\142"
-  "\362\210\204\354\13\366\102\174\77\376\30\261\126\154\22\222\27\300\147\77\357\200\307\142\42\262\275\236\32\167\266\12"
-  "\6\102\24\140\205\174\103\46\225\257\374\145\212\214\177\101\221\314\170\274\374\25\217\25\272\263\370\312\120\217\74\256"
-  "\277\313\115\57\104\52\10\130\6\264\344\205\46\156\357\61\224\151\144\221\260\33\70\10\50\67\302\175\35\171\255\235"
-  "\117\126\356\127\247\313\2\53\303\7\130\144\202\72\372\105\42\204\200\342\205\36\270\364\122\142\341\152\363\343\361\31"
-  "\120\100\276\304\253\167\34\74\276\341\203\45\114\370\25\175\44\131\255\44\104\275\326\215\107\205\336\302\60\105\0\57"
-  "\73\303\223\317\100\163\210\257\76\224\371\165\352\103\231\317\352\303\304\324\207\62\177\27\365\1\337\3\353\156\247\124"
-  "\0\304\360\161\62\351\335\255\157\243\207\224\271\350\41\220\34\377\116\232\311\254\231\314\232\111\231\207\153\46\172\212"
-  "\213\257\314\314\312\14\262\231\217\244\336\264\375\320\61\225\232\366\166\312\112\333\16\263\15\75\266\12\45\275\77\277"
-  "\355\267\116\327\351\373\301\376\262\75\56\226\366\117\44\105\214\253\102\123\17\106\273\67\225\254\77\272\337\77\372\225"
-  "\174\116\376\365\177\16\177\45\177\374\357\177\377\43\371\343\337\377\217\107\326\267\55\345\343\320\333\242\56\23\203\205"
-  "\101\26\352\252\53\15\102\176\114\377\151\110\251\45\6\261\127\205\67\371\145\76\267\377\372\77\207\277\114\222\146\57"
-  "\107\364\311\174\256\232\252\154\62\223\255\377\312\222\272\77\61\371\174\173\172\27\200\173\342\203\76\26\300\57\300\373"
-  "\22\270\277\106\5\167\300\315\24\150\62\376\163\313\240\112\261\347\107\20\275\205\163\13\235\51\327\314\325\325\311\243"
-  "\315\152\271\52\13\141\243\151\163\106\232\365\137\111\322\40\256\250\202\273\24\274\302\273\210\117\236\125\154\245\144\123"
-  "\154\324\305\245\307\320\370\326\275\132\26\176\334\104\210\202\332\113\155\16\353\224\136\236\221\20\237\3\162\152\304\0"
-  "\335\334\42\156\277\22\253\151\74\357\6\256\273\204\271\345\170\25\21\334\112\133\13\311\11\121\14\314\152\351\370\32"
-  "\30\172\203\146\323\364\303\267\11\204\170\70\244\174\242\10\3\47\164\163\72\366\306\326\143\133\346\350\154\32\54\221"
-  "\53\130\212\374\226\120\237\154\312\225\167\207\375\117\223\20\20\101\44\304\367\347\255\165\122\62\217\57\33\273\226\77"
-  "\367\37\302\251\366\66\226\17\52\350\17\351\155\57\140\236\362\265\364\311\17\1\42\317\10\21\131\212\50\376\256\310"
-  "\263\55\207\117\346\154\71\174\56\270\152\44\353\321\75\357\310\267\360\276\347\370\125\354\34\52\110\144\53\210\265\24"
-  "\46\100\25\374\55\315\220\143\104\61\45\23\220\3\115\102\302\332\325\50\3\121\72\301\150\47\147\305\3\202\20\277"
-  "\30\40\342\60\63\41\230\360\63\37\361\111\200\160\66\302\243\233\21\144\343\144\360\105\246\124\242\17\167\122\337\110"
-  "\225\105\25\22\42\52\323\21\175\0\227\210\252\321\4\63\226\30\107\110\60\116\107\46\12\57\162\102\246\305\300\14"
-  "\24\201\130\35\102\120\102\225\156\45\217\22\131\10\125\106\122\307\1\123\302\161\16\10\370\116\64\373\54\54\341\256"
-  "\364\140\200\325\53\107\256\73\344\111\2\53\107\140\225\241\317\370\126\26\105\324\367\3\254\202\61\106\21\130\204\63"
-  "\166\341\234\121\61\257\260\306\16\66\145\177\6\274\261\172\20\312\250\75\224\141\365\312\317\247\123\300\50\44\353\76"
-  "\152\51\202\271\24\101\143\207\345\44\17\141\211\350\361\103\20\246\53\363\312\60\231\147\22\37\151\133\335\162\134\323"
-  "\317\253\222\363\230\363\252\6\70\314\171\125\172\70\314\171\125\34\162\361\357\33\325\261\106\353\217\25\153\104\2\211"
-  "\372\62\323\51\364\364\13\261\373\376\363\274\52\151\246\166\373\373\146\47\313\222\110\42\350\203\122\226\267\216\102\212"
-  "\32\101\144\312\150\21\104\372\330\36\255\326\27\71\24\103\370\211\162\135\21\142\162\356\372\312\275\35\361\312\175\214"
-  "\213\164\242\164\211\20\213\240\247\175\324\213\170\24\215\160\267\114\66\351\57\26\135\137\170\53\355\362\75\232\254\277"
-  "\110\131\304\166\367\355\70\64\55\173\74\311\53\362\241\5\102\11\104\106\250\147\227\14\302\101\242\161\60\212\37\132"
-  "\11\20\371\363\157\275\73\311\212\246\51\323\52\253\222\274\51\140\77\326\217\313\244\62\165\232\233\272\116\222\304\124"
-  "\171\122\313\117\366\107\371\267\377\374\174\354\270\254\27\151\135\77\225\311\262\176\312\16\237\262\341\242\306\124\145\322"
-  "\230\264\220\0\43\331\244\100\10\111\327\67\103\226\347\46\53\222\246\255\232\366\351\360\51\35\146\310\22\223\244\115"
-  "\277\361\141\6\271\64\227\306\142\345\307\147\166\163\213\113\250\75\341\260\106\156\243\344\246\15\77\115\353\152\121\225"
-  "\131\331\346\131\151\176\257\276\357\155\212\264\51\213\202\255\36\43\40\0\217\6\205\111\1\320\105\223\345\155\322\124"
-  "\315\42\253\114\57\250\136\226\224\175\316\122\323\244\165\322\340\212\364\267\163\174\375\204\140\364\233\112\313\247\47\363"
-  "\364\364\124\24\205\51\137\67\225\366\130\222\26\165\201\233\12\305\311\62\135\347\151\273\156\27\131\263\156\377\13\0"
-  "\57\102\76\257\114\155\160\272\113\367\261\230\24\361\237\326\327\0\261\377\344\14\106\156\12\160\237\227\171\232\234\33"
-  "\346\304\251\131\361\226\261\224\353\66\2\327\230\322\107\10\31\265\72\74\137\364\335\372\177\307\116\51\140\30\301\16"
-  "\374\63\234\127\171\365\310\236\243\16\370\66\247\4\322\273\340\201\1\304\370\213\220\24\105\54\242\362\162\171\100\3"
-  "\350\205\135\51\135\307\362\21\247\0\270\222\223\76\5\5\44\212\23\44\220\275\46\342\273\270\26\116\311\365\111\226"
-  "\164\260\117\326\150\137\207\321\230\327\33\343\314\345\240\304\277\100\24\163\321\65\211\307\216\332\270\213\254\134\247\353"
-  "\47\263\314\263\164\325\213\227\174\220\57\57\72\233\155\330\322\354\104\62\321\272\316\353\104\24\33\63\4\250\17\115"
-  "\64\124\365\167\7\150\131\342\371\341\131\251\107\0\52\123\105\253\222\235\301\357\203\14\265\375\21\306\364\176\225\20"
-  "\54\204\137\2\143\41\261\104\74\74\2\21\53\300\62\15\103\35\375\241\152\174\312\2\126\353\130\374\64\217\275\160"
-  "\70\0\104\204\33\37\5\267\207\13\343\130\213\137\40\0\70\152\151\157\273\241\154\122\330\22\201\324\333\61\245\273"
-  "\110\76\342\227\121\276\164\24\301\217\27\373\156\376\354\126\277\302\201\305\375\243\74\12\226\123\203\277\336\107\232\344"
-  "\15\342\33\172\41\371\343\44\210\370\350\56\153\220\271\231\340\272\13\367\370\44\113\34\104\47\272\236\266\66\207\174"
-  "\103\264\10\104\160\374\265\140\270\176\245\210\125\154\231\202\253\114\30\242\16\56\344\1\165\34\21\133\302\136\100\342"
-  "\171\134\363\13\110\341\344\246\310\255\302\237\360\235\207\137\122\57\356\374\222\372\373\142\167\332\164\135\277\201\62\267"
-  "\172\317\25\164\72\373\307\120\145\3\356\267\177\364\363\322\252\141\107\136\255\143\370\354\117\163\136\55\364\146\37\276"
-  "\364\206\54\54\201\36\3\75\51\364\144\320\223\107\275\222\317\353\273\277\222\237\257\344\347\53\171\105\355\230\371\132"
-  "\336\237\327\237\251\74\115\363\275\74\271\105\214\170\235\56\223\212\32\300\217\123\164\203\253\152\62\261\37\15\52\3"
-  "\271\335\143\71\246\370\43\313\213\236\42\74\161\277\366\347\160\143\50\145\75\57\72\330\301\133\111\167\305\343\60\56"
-  "\32\151\334\102\43\220\302\261\370\112\120\234\341\171\206\307\237\207\126\6\345\251\75\41\45\100\311\53\370\223\116\11"
-  "\125\126\307\124\124\275\324\244\65\41\166\223\223\234\176\345\112\75\222\117\31\265\170\272\146\1\75\31\54\105\370\201"
-  "\360\114\202\127\167\16\127\376\234\127\2\223\230\64\334\131\313\0\257\177\372\75\176\25\43\223\351\223\235\77\40\16"
-  "\24\223\50\162\244\177\131\236\234\33\307\0\374\10\307\206\35\60\4\200\135\36\307\257\16\32\240\313\124\130\210\100"
-  "\376\130\77\60\145\25\363\44\120\133\345\265\317\121\313\371\23\171\214\0\216\337\257\353\52\242\10\320\363\263\207\105"
-  "\242\137\75\127\230\137\255\65\262\310\37\41\60\162\176\107\375\23\251\362\211\140\240\176\313\147\337\115\75\162\341\304"
-  "\200\311\371\13\217\170\4\341\351\334\310\253\265\163\1\47\275\360\131\251\260\36\31\145\204\143\67\54\257\10\104\153"
-  "\1\167\0\207\223\123\211\66\346\207\220\306\345\3\101\307\10\257\52\310\370\23\172\105\101\26\25\341\325\4\371\145"
-  "\250\300\43\217\52\310\170\60\21\370\262\270\30\300\357\244\274\6\31\376\366\6\254\135\16\307\152\124\322\210\25\126"
-  "\307\267\164\277\32\175\305\353\365\304\61\175\271\113\324\350\335\255\310\46\120\106\146\377\120\165\50\273\241\72\224\51"
-  "\361\124\76\373\170\122\270\346\256\114\331\40\214\245\244\63\275\314\224\213\260\231\17\252\12\152\230\64\321\127\26\271"
-  "\167\47\240\111\160\145\1\17\251\337\75\270\2\252\202\117\276\54\322\364\241\237\116\241\152\322\364\301\224\115\241\250"
-  "\322\364\301\224\337\107\315\45\6\330\351\127\144\372\321\355\16\307\315\356\324\52\43\136\375\1\256\303\13\165\177\272"
-  "\121\257\44\164\325\16\160\175\355\202\2\110\203\211\272\351\66\373\235\335\355\64\241\100\322\117\34\305\356\171\175\222"
-  "\137\172\344\71\136\247\353\317\106\176\47\235\46\361\366\32\273\167\353\54\303\371\353\237\46\167\366\321\75\156\267\163"
-  "\324\53\364\344\320\123\100\117\11\75\25\364\324\320\3\153\116\23\350\101\370\246\320\223\101\117\16\75\5\364\224\320"
-  "\123\101\117\15\75\260\346\54\231\166\241\56\20\6\327\106\3\276\362\26\231\336\33\17\230\123\377\276\60\172\224\10"
-  "\150\343\311\53\34\257\154\123\270\361\356\171\273\205\301\373\77\250\137\6\102\241\342\215\367\313\355\77\327\217\35\110"
-  "\110\131\165\274\301\105\142\127\240\323\306\232\372\176\223\316\24\25\226\244\217\200\222\354\225\321\216\244\347\240\116\252"
-  "\251\327\42\175\221\226\253\170\345\114\264\52\177\214\13\276\33\40\115\270\257\67\251\323\66\116\73\261\333\215\335\254"
-  "\355\146\25\207\25\40\136\373\165\156\54\115\343\72\201\45\62\56\301\21\12\335\10\306\153\36\51\106\150\160\0\335"
-  "\22\270\213\221\14\40\125\327\5\23\164\5\326\15\257\250\20\136\130\45\26\315\361\107\375\274\317\65\10\340\25\331"
-  "\231\141\320\51\75\320\51\247\12\235\346\112\350\344\143\101\7\220\125\372\246\6\35\341\74\32\317\110\30\170\0\133"
-  "\245\157\202\340\61\327\162\236\162\54\370\0\276\112\337\4\341\223\222\327\304\341\143\305\353\62\73\367\275\42\371\265"
-  "\325\310\311\32\304\45\24\105\35\100\217\122\357\140\130\255\227\217\166\146\200\336\135\55\343\112\376\364\306\277\63\324"
-  "\51\243\32\50\171\172\345\23\165\336\56\240\34\13\127\61\247\201\54\37\37\167\121\44\361\214\42\65\171\66\320\117"
-  "\260\355\125\147\370\323\377\205\66\21\20\171\275\164\106\67\45\256\267\51\304\35\171\33\144\366\107\63\216\136\305\213"
-  "\36\217\141\173\203\161\344\33\354\214\175\244\253\343\376\160\227\14\125\260\157\146\252\202\236\74\212\255\323\46\246\360"
-  "\360\14\55\127\200\173\125\40\215\364\135\270\35\372\54\263\7\273\335\70\355\332\151\127\116\273\164\332\205\323\316\157"
-  "\345\373\350\167\202\114\321\307\251\262\13\316\213\302\63\106\251\34\243\362\214\121\53\307\310\161\14\243\135\107\211\143"
-  "\244\251\162\214\372\137\75\41\215\245\160\347\327\32\373\305\150\26\11\316\51\235\61\51\51\2\372\42\206\274\135\366"
-  "\27\46\35\15\302\150\375\110\147\174\136\45\270\146\331\125\262\52\372\354\136\75\32\44\112\37\44\312\273\300\265\374"
-  "\355\270\126\216\247\145\242\173\112\72\337\17\325\312\167\140\153\265\17\22\361\135\121\176\0\340\261\304\347\72\340\152"
-  "\222\316\333\3\240\276\75\6\244\140\20\113\347\215\1\40\162\36\376\204\332\142\232\330\355\302\151\347\215\323\256\235"
-  "\266\133\362\243\164\332\205\323\316\235\166\346\264\123\247\355\216\357\254\57\155\234\166\355\264\53\247\135\72\355\302\151"
-  "\347\116\333\205\127\352\264\315\255\264\343\176\46\274\334\207\271\345\147\250\14\312\141\332\11\153\232\41\122\317\20\215"
-  "\156\210\14\325\374\52\121\16\141\160\10\243\34\242\360\7\166\153\140\201\103\64\225\162\210\32\207\320\256\242\302\41"
-  "\264\47\122\172\14\236\104\271\14\343\31\103\173\46\251\147\214\124\71\106\342\31\43\123\216\221\173\306\320\22\212\147"
-  "\57\306\50\307\50\75\143\50\341\221\327\236\61\12\345\30\306\63\206\26\323\63\34\43\325\342\130\56\162\115\44\325"
-  "\120\366\307\130\255\324\152\145\126\53\267\132\205\325\52\255\126\324\250\17\204\203\154\131\237\141\27\173\215\65\130\267"
-  "\230\370\204\116\103\21\140\103\0\157\374\105\43\301\361\352\2\365\24\326\332\324\327\54\65\145\113\5\266\165\341\3"
-  "\132\11\337\124\220\303\200\372\61\365\123\306\306\314\0\277\113\166\265\1\24\163\67\50\147\340\22\2\171\101\374\205"
-  "\340\155\210\52\13\222\143\127\246\307\56\145\161\124\365\232\122\374\170\112\10\61\121\341\40\270\202\322\101\357\4\25"
-  "\350\307\277\266\142\205\133\241\130\357\255\53\65\53\112\240\372\357\315\310\173\53\100\321\144\46\30\106\176\13\105\106"
-  "\302\267\264\75\301\264\42\300\340\303\147\370\51\336\363\251\362\272\360\75\13\362\250\205\100\123\345\172\272\21\262\23"
-  "\232\107\144\377\263\211\217\356\62\127\350\225\60\216\345\107\156\66\75\101\144\266\130\206\264\221\320\163\64\314\54\121"
-  "\200\42\330\337\13\113\241\64\256\166\167\46\255\77\314\366\114\11\373\173\257\105\241\126\17\274\302\44\67\144\26\46"
-  "\31\221\133\230\104\317\56\56\124\327\142\77\237\76\303\300\23\27\360\204\153\162\21\20\344\366\332\41\34\347\35\253"
-  "\51\167\160\222\212\53\270\144\226\335\267\0\163\132\24\270\326\73\23\344\162\311\126\144\174\267\23\25\353\346\226\142"
-  "\335\114\231\32\231\247\223\7\11\170\323\205\157\227\57\154\337\230\324\126\253\271\315\135\107\131\334\336\133\73\175\11"
-  "\305\237\20\216\202\355\13\362\212\55\301\146\314\46\227\316\133\143\163\146\267\314\155\260\271\112\146\154\236\14\66\267"
-  "\141\330\214\221\311\322\171\163\154\116\255\126\146\265\162\253\125\334\350\216\72\311\46\177\15\121\231\21\156\41\322\44"
-  "\257\247\166\51\130\66\167\10\373\370\54\161\146\211\353\60\226\210\274\105\72\157\316\22\313\7\236\133\276\125\344\341"
-  "\362\367\63\45\350\324\176\31\46\253\21\56\133\354\41\160\340\153\237\337\40\77\12\260\55\163\313\356\226\3\222\37"
-  "\115\347\156\342\276\216\144\204\147\373\263\306\242\246\74\231\251\351\146\324\224\47\76\152\262\272\345\200\24\216\15\314"
-  "\271\221\316\133\113\212\334\74\114\46\323\231\110\166\53\34\212\375\126\136\171\160\244\174\167\72\356\172\154\201\107\74"
-  "\207\202\245\143\6\116\341\230\270\124\375\317\205\36\141\237\260\27\101\313\10\162\76\117\155\316\224\75\360\355\110\47"
-  "\307\145\166\62\63\213\72\12\324\155\26\145\165\313\111\341\253\230\271\175\204\36\25\366\240\267\156\22\105\114\146\370"
-  "\333\355\172\303\216\120\241\374\105\373\256\236\174\47\320\16\10\4\75\140\217\2\23\125\207\167\207\204\341\175\5\324"
-  "\352\26\374\37\103\121\313\113\233\226\252\231\35\276\303\251\127\276\123\267\272\345\244\24\32\33\34\246\164\336\136\143"
-  "\253\37\170\116\206\140\3\367\43\145\157\50\264\305\236\11\21\350\15\125\337\3\236\25\271\303\10\12\214\162\341\317"
-  "\235\225\323\17\217\271\227\343\41\7\61\211\373\164\312\262\320\355\46\235\67\147\131\15\311\306\376\307\124\100\307\300"
-  "\1\351\274\365\251\24\311\130\267\141\163\151\373\14\141\51\235\267\75\130\151\15\177\362\152\104\326\225\51\46\54\47"
-  "\341\16\132\74\20\376\224\76\216\206\122\6\307\345\106\232\154\76\42\232\20\100\204\277\154\324\236\237\65\352\41\326"
-  "\77\164\272\77\236\376\370\267\327\216\177\33\46\227\47\213\16\276\47\214\354\276\305\341\201\75\141\44\257\34\275\266"
-  "\217\153\371\231\275\257\176\64\217\244\275\360\320\110\273\331\372\156\132\271\233\357\165\63\36\115\100\16\15\137\202\202"
-  "\305\365\133\41\325\120\121\341\220\357\310\71\271\307\204\247\64\341\123\221\77\277\220\267\24\2\335\77\241\25\211\314"
-  "\352\303\237\135\347\36\136\347\77\275\247\347\166\362\104\326\257\261\135\37\141\234\276\373\116\316\152\7\207\265\273\362"
-  "\264\226\373\347\335\351\303\37\240\364\15\33\372\210\207\370\303\75\303\37\234\135\362\147\370\76\30\177\43\40\152\1"
-  "\106\172\311\317\201\66\35\121\115\300\321\1\70\364\114\232\303\143\142\134\225\200\144\207\60\11\347\205\34\116\123\144"
-  "\136\4\126\307\365\156\361\175\275\70\11\250\176\367\270\220\332\157\127\355\352\165\323\322\165\130\234\276\331\235\273\365"
-  "\317\166\5\135\303\357\210\360\130\37\217\373\243\137\134\14\323\143\357\260\202\113\375\2\233\36\44\137\277\364\377\205"
-  "\166\316\353\252\175\275\366\360\322\117\206\227\77\374\134\164\233\307\156\267\70\164\337\366\247\307\303\161\375\143\263\376"
-  "\151\276\274\174\377\70\300\32\354\347\63\34\170\42\320\333\174\305\232\301\305\62\33\76\334\355\277\234\377\23\151\333"
-  "\302\64\362\304\2\307\107\27\33\5\27\1\361\364\130\326\177\334\133\261\355\312\126\124\372\257\245\227\74\310\372\101"
-  "\136\337\354\320\77\143\121\7\173\235\240\135\356\116\333\57\155\157\364\367\210\272\35\276\260\60\125\140\211\10\101\160"
-  "\21\350\210\275\277\234\203\372\241\130\146\77\117\300\62\255\135\352\375\203\260\145\345\130\271\214\45\233\266\271\167\200"
-  "\153\205\75\213\122\225\112\116\240\137\13\141\10\337\367\77\54\206\320\267\201\41\134\105\370\36\372\76\376\23\310\175"
-  "\44\132\247\24\44\351\5\357\213\104\176\7\147\30\5\133\102\114\300\366\274\333\364\150\372\345\171\267\335\354\376\143"
-  "\161\2\230\35\365\321\100\366\131\23\110\145\46\54\273\103\61\125\125\302\124\1\61\75\241\147\2\107\160\374\336\17"
-  "\266\70\241\271\256\332\144\221\217\201\316\74\305\367\70\62\227\74\234\265\72\341\222\103\333\345\222\235\207\53\212\225"
-  "\54\112\270\374\354\72\337\100\11\302\331\145\112\364\20\120\215\76\357\0\206\352\173\1\164\335\10\41\167\35\277\310"
-  "\13\302\364\16\173\210\365\0\24\153\121\10\352\2\355\317\343\346\264\226\107\261\0\265\353\353\206\71\74\237\226\60"
-  "\12\270\201\364\243\40\41\310\171\102\337\215\141\143\222\267\355\12\310\262\377\277\377\17";
-
-/* lib/stdlib.wo (DEFLATEd, org. size 70385) */
-static unsigned char file_l_42[6320] =
-  "\264\226\147\217\253\70\24\206\77\157\373\17\26\303\207\144\53\46\5\222\355\275\367\276\213\204\14\330\271\350\202\215\154"
-  "\63\145\177\375\72\230\70\140\23\45\167\212\64\223\230\207\363\276\347\270\147\126\263\242\255\60\360\205\54\252\62\173"
-  "\355\145\0\146\145\335\60\56\201\227\163\351\1\117\64\276\7\146\273\212\145\250\2\276\142\133\105\300\254\156\45\50"
-  "\27\341\174\76\237\320\324\270\146\374\116\311\164\103\313\372\166\140\24\347\263\250\4\126\264\220\274\244\73\235\42\157"
-  "\366\51\110\113\163\340\153\276\325\24\314\32\304\121\335\311\117\267\71\26\155\65\331\11\223\104\65\150\136\67\166\226"
-  "\36\77\132\32\125\265\300\322\316\242\351\143\366\245\302\324\116\242\351\245\146\230\163\312\74\363\155\346\253\173\336\166"
-  "\237\147\346\114\334\40\147\70\173\174\276\247\356\152\223\167\15\126\306\245\50\312\135\51\215\161\307\267\75\75\337\71"
-  "\333\114\64\50\307\266\231\246\57\156\166\73\135\332\355\275\152\223\254\142\67\230\133\156\75\275\324\254\106\362\231\362"
-  "\252\12\174\333\30\247\75\334\166\350\140\103\326\313\351\125\246\136\330\226\55\55\205\54\224\251\310\370\163\343\251\351"
-  "\166\317\56\255\355\6\211\62\25\24\65\342\31\223\151\303\361\165\211\157\240\62\46\105\172\303\113\211\215\371\164\344"
-  "\366\20\167\331\276\171\140\121\230\136\227\234\321\164\207\345\271\272\6\241\117\122\202\50\377\303\342\322\102\214\340\321"
-  "\313\151\70\313\123\174\133\236\55\303\4\16\123\116\136\15\214\112\314\353\164\357\46\254\73\142\370\112\33\234\326\347"
-  "\254\245\322\325\233\127\47\365\373\220\222\42\263\364\264\324\120\267\176\223\102\337\251\333\264\37\162\60\303\267\332\370"
-  "\100\274\271\271\110\125\113\175\276\235\63\52\244\271\43\13\44\221\261\51\4\364\201\176\217\252\162\107\337\207\300\233"
-  "\375\360\373\167\337\315\223\40\360\46\4\315\376\120\20\51\43\51\14\300\65\342\275\54\6\236\22\130\177\376\107\56"
-  "\373\333\141\161\234\344\213\61\215\227\111\21\45\233\350\343\356\41\110\160\20\335\251\240\217\77\115\140\104\223\140\225"
-  "\144\372\57\116\66\213\57\22\262\112\310\346\303\4\157\222\140\361\143\374\175\230\300\42\120\344\253\233\44\16\377\171"
-  "\57\311\210\110\42\222\24\305\217\11\134\265\336\364\40\270\243\360\365\17\137\174\375\303\327\277\375\355\214\203\321\204"
-  "\216\346\207\217\177\230\275\176\152\344\70\242\305\62\116\5\306\305\140\340\102\260\337\63\357\257\47\4\270\156\344\235"
-  "\231\347\243\144\251\45\313\311\252\26\156\125\45\225\230\123\124\1\314\71\343\133\320\122\224\125\30\110\6\70\226\274"
-  "\304\327\30\364\111\152\114\45\320\27\250\110\350\211\176\144\155\376\34\113\341\26\4\203\170\42\274\225\44\116\145\227"
-  "\161\250\360\366\363\32\234\373\213\310\64\307\203\166\76\174\265\76\266\211\322\106\272\75\312\105\116\370\4\371\110\113"
-  "\206\251\343\3\217\247\175\140\150\153\341\120\16\73\156\374\307\76\60\36\153\165\352\205\46\240\243\130\77\330\56\20"
-  "\273\312\361\220\55\115\373\105\377\314\344\353\343\311\154\177\104\313\174\217\301\341\210\362\305\350\220\367\251\176\354\143"
-  "\52\226\357\17\55\122\164\324\74\147\215\77\6\304\6\45\264\101\350\17\235\365\161\370\366\16\113\363\313\136\277\350"
-  "\302\337\26\130\166\131\316\4\37\117\107\270\76\22\321\146\43\235\260\165\27\145\47\156\222\320\15\52\206\150\147\164"
-  "\107\46\61\356\106\303\211\23\203\202\45\343\30\60\102\224\347\373\301\141\217\271\316\156\105\313\43\100\105\341\346\15"
-  "\335\274\364\305\363\26\227\224\2\57\11\212\47\352\125\361\325\331\237\156\72\264\340\254\161\322\144\215\177\146\272\71"
-  "\226\55\357\372\75\261\45\322\156\117\220\343\105\334\3\157\76\336\47\244\226\343\235\202\32\177\142\257\50\74\136\370"
-  "\142\374\170\215\252\61\300\343\107\113\135\73\352\253\310\322\137\155\54\207\53\30\130\46\127\20\272\76\60\264\215\340"
-  "\322\161\132\71\116\353\11\247\310\161\162\152\12\235\232\102\253\246\107\74\143\14\130\330\140\151\203\225\15\326\66\210"
-  "\154\20\333\140\363\304\107\133\360\44\147\233\265\215\220\33\247\230\106\231\142\317\201\17\115\4\153\200\37\272\36\244"
-  "\226\307\122\53\206\212\70\25\366\371\2\373\10\162\117\265\65\72\213\350\110\50\376\277\275\63\121\123\34\327\365\370"
-  "\243\334\245\346\356\33\11\153\235\363\60\174\20\122\335\231\16\41\223\204\132\346\351\157\102\65\237\332\371\341\22\52"
-  "\7\252\172\232\263\116\134\136\44\131\376\113\226\154\163\354\333\331\247\170\220\52\315\353\324\107\3\252\373\61\66\230"
-  "\352\364\217\357\364\24\33\105\64\1\244\326\276\26\202\301\160\22\24\31\331\70\216\242\51\130\6\247\242\162\50\202"
-  "\265\7\243\320\133\41\20\66\16\263\130\367\207\30\235\122\53\32\161\226\210\100\173\1\265\163\45\135\245\17\377\213"
-  "\115\136\237\274\231\322\133\261\31\106\137\6\127\203\321\350\23\251\1\132\264\326\354\54\267\153\364\66\46\244\350\30"
-  "\354\310\120\344\136\376\46\103\376\117\34\115\346\223\305\170\66\131\370\4\350\251\16\132\266\236\111\305\310\130\11\171"
-  "\263\254\145\104\126\103\137\60\134\66\102\120\137\224\133\376\101\354\323\304\261\117\343\337\234\77\116\151\256\250\120\16"
-  "\275\230\326\362\54\307\176\113\235\227\222\52\335\56\367\120\247\5\325\111\34\364\5\27\325\221\173\162\245\215\277\311"
-  "\36\227\173\260\41\115\70\347\137\232\143\203\165\265\314\36\104\256\355\370\316\207\310\77\100\237\206\235\235\230\53\167"
-  "\172\276\164\241\235\203\322\66\46\155\13\3\155\240\10\45\47\251\6\221\264\40\237\324\160\104\363\117\156\70\356\346"
-  "\357\66\35\6\313\162\167\117\333\162\27\1\174\205\40\110\11\344\12\276\336\105\221\203\231\163\7\120\147\56\240\56"
-  "\260\332\205\22\303\312\150\233\160\161\20\111\204\270\53\41\353\302\104\202\37\134\331\112\301\327\231\100\252\363\41\323"
-  "\201\125\65\250\354\247\3\3\23\265\23\152\54\25\177\146\200\212\76\73\100\105\361\131\61\272\120\204\212\70\172\27"
-  "\111\302\330\102\22\4\5\212\35\220\232\271\121\211\221\203\122\367\56\112\105\360\320\204\32\333\122\231\162\251\314\116"
-  "\142\304\14\22\275\34\112\105\221\201\4\5\245\146\26\224\272\27\140\352\175\104\43\300\324\45\144\77\37\30\246\250"
-  "\241\320\145\251\371\123\343\124\114\234\322\43\146\3\23\21\217\224\0\330\47\102\115\335\257\23\216\102\140\363\224\147"
-  "\27\323\166\12\115\176\330\74\345\333\305\221\13\214\143\7\66\243\270\207\233\160\301\204\34\323\332\215\107\134\273\364"
-  "\255\204\76\316\247\0\47\172\332\240\211\273\273\334\237\124\157\14\276\121\20\331\253\376\36\12\40\21\371\363\375\374"
-  "\124\317\205\15\364\47\6\371\51\250\37\233\174\323\50\26\244\307\327\230\270\177\1\335\271\37\32\367\271\304\144\61"
-  "\262\346\165\161\137\110\66\375\303\272\352\322\63\374\253\123\52\371\234\341\222\251\253\146\367\103\46\265\375\102\32\265"
-  "\346\271\301\177\144\20\235\72\111\131\327\115\325\354\66\347\21\225\71\104\145\12\121\310\352\36\217\105\310\147\372\105"
-  "\152\71\204\142\52\13\275\112\333\233\55\317\126\353\26\127\4\346\236\126\65\347\62\14\132\133\113\226\336\256\207\302"
-  "\76\2\267\10\362\332\305\1\314\30\163\51\267\344\276\236\164\352\306\354\310\350\6\143\210\223\62\341\164\42\102\173"
-  "\151\111\267\103\101\160\63\107\215\346\103\250\221\234\240\26\65\242\371\363\237\70\331\356\363\213\110\303\76\377\13\314"
-  "\277\174\140\102\105\233\347\47\265\171\316\220\215\60\44\32\241\73\42\205\130\120\75\277\122\200\152\241\113\105\304\334"
-  "\101\304\374\206\210\67\104\274\41\342\15\21\177\145\104\354\101\242\212\211\263\11\61\261\55\74\37\23\333\312\377\233"
-  "\76\67\55\205\313\366\157\313\372\206\224\67\244\274\41\45\327\5\327\271\324\373\324\370\11\116\244\364\172\250\72\233"
-  "\350\250\332\325\42\304\100\332\26\124\225\55\372\162\223\276\175\347\240\114\334\357\226\15\267\240\35\255\364\306\15\176"
-  "\100\333\26\276\173\147\206\253\125\322\144\273\242\253\57\245\35\312\27\151\321\270\245\345\306\155\233\270\237\47\373\106"
-  "\341\166\125\64\365\237\156\331\146\327\224\273\32\275\365\253\225\47\107\20\213\22\172\344\131\263\45\107\11\352\365\316"
-  "\251\164\24\217\126\361\50\62\34\140\43\66\276\312\121\257\370\52\134\325\52\2\16\354\307\77\313\104\307\11\104\60"
-  "\23\15\27\17\51\221\77\275\203\46\100\236\331\240\107\240\41\146\104\205\323\145\55\50\340\204\207\1\111\316\354\162"
-  "\56\245\27\110\326\202\330\322\200\103\33\372\221\106\166\27\4\344\203\300\126\53\131\117\247\232\206\202\315\60\153\372"
-  "\131\73\373\54\121\127\164\21\223\172\151\204\271\127\72\135\110\311\27\360\202\172\332\200\224\235\161\46\210\162\72\17"
-  "\347\235\175\356\254\235\1\217\320\162\260\313\147\42\254\7\161\17\236\107\377\73\372\361\137\345\177\215\376\361\337\377"
-  "\376\217\243\177\374\373\177\364\75\2\335\301\20\41\302\213\27\270\236\50\250\62\240\72\122\340\324\66\256\340\20\354"
-  "\12\65\43\64\3\324\256\17\41\30\215\22\321\51\127\43\30\41\21\225\360\73\371\111\230\3\116\276\134\105\254\104"
-  "\357\134\350\237\360\370\63\50\167\26\315\143\132\65\313\166\104\354\357\305\75\365\102\223\130\15\231\172\213\370\105\72"
-  "\263\373\1\117\175\274\217\204\150\24\351\207\76\270\4\351\330\331\325\67\134\176\23\375\372\122\310\122\102\3\372\345"
-  "\3\317\306\144\174\51\206\224\133\32\123\36\52\306\220\341\261\5\364\332\112\220\12\311\70\354\307\101\245\36\212\305"
-  "\0\302\27\170\265\70\276\330\64\125\316\301\143\337\161\344\251\174\350\24\174\234\373\23\177\224\373\103\311\310\142\306"
-  "\126\17\37\46\326\351\207\102\353\75\336\17\200\305\324\255\242\225\176\345\60\155\124\164\154\144\167\341\202\120\143\45"
-  "\126\36\247\121\4\247\362\72\113\140\374\6\310\352\153\0\256\304\202\107\204\122\171\355\255\277\144\376\47\53\36\372"
-  "\145\377\165\50\343\312\10\132\26\165\232\247\111\203\125\170\172\31\107\47\227\161\164\134\306\62\325\22\56\344\355\27"
-  "\367\266\56\137\130\242\65\330\60\254\16\265\321\71\25\231\110\354\145\341\6\360\357\265\276\141\23\374\247\157\105\2"
-  "\320\42\221\354\311\23\265\13\371\263\143\140\41\131\230\32\73\3\365\327\212\56\266\264\1\325\312\273\44\234\66\104"
-  "\346\235\17\231\201\213\203\275\154\33\74\363\44\122\337\144\217\312\256\3\270\157\34\201\363\252\357\153\206\107\270\111"
-  "\70\302\5\101\21\350\166\62\25\136\371\212\30\217\43\52\363\141\117\276\174\115\237\77\113\362\305\236\126\341\253\71"
-  "\267\74\313\55\317\22\220\147\171\276\45\132\156\211\226\133\242\345\315\116\247\147\46\132\246\27\114\264\140\351\41\122"
-  "\163\113\303\334\322\60\201\241\272\133\32\6\141\107\277\11\314\217\306\210\46\117\263\233\323\71\272\361\306\131\230\24"
-  "\260\347\175\160\207\323\77\340\375\374\102\74\107\243\170\160\246\101\267\60\215\321\275\232\103\231\350\243\315\246\241\243"
-  "\301\266\63\11\70\263\47\1\245\347\133\236\217\257\67\174\130\236\57\212\177\201\74\337\55\317\167\313\363\335\362\174"
-  "\267\74\337\55\317\167\313\363\301\365\233\334\22\175\37\223\350\123\42\347\103\257\117\372\125\166\345\344\212\344\302\22"
-  "\43\50\277\311\244\170\231\267\144\313\365\223\55\307\225\356\313\255\230\157\125\77\354\363\334\55\111\14\267\254\65\114"
-  "\355\172\37\376\362\340\260\101\174\305\267\100\114\74\370\162\37\367\56\372\226\105\144\251\305\52\224\67\2\303\257\253"
-  "\351\163\115\235\17\164\377\321\155\310\55\101\371\351\72\112\123\251\72\274\120\303\205\44\262\21\227\73\242\313\115\120"
-  "\54\214\103\25\241\231\224\202\11\77\324\21\45\32\302\162\353\170\52\27\262\137\277\75\67\262\255\231\152\7\121\5"
-  "\244\75\17\133\334\215\245\340\52\271\141\152\256\127\261\164\334\246\346\206\337\372\16\130\17\241\132\372\23\206\164\176"
-  "\362\170\116\70\301\13\65\42\151\31\47\322\337\224\274\140\350\123\241\141\261\360\104\76\3\142\377\347\330\241\230\163"
-  "\113\17\233\256\275\54\171\317\251\41\101\351\101\165\170\76\376\4\227\121\246\172\220\32\203\170\176\236\45\372\315\57"
-  "\311\32\76\55\54\355\260\322\100\367\176\235\274\146\336\133\11\270\26\324\140\173\334\316\26\203\200\113\2\145\377\5"
-  "\142\226\103\256\352\305\47\110\75\215\206\133\325\261\155\125\337\215\375\353\272\35\354\243\243\200\50\22\202\103\327\134"
-  "\261\52\76\150\375\114\76\164\375\250\377\240\133\161\273\235\346\323\52\372\156\352\220\61\153\163\345\356\356\51\361\104"
-  "\243\376\252\147\102\70\173\127\72\12\22\307\141\274\52\257\311\45\130\306\140\313\50\212\331\364\102\242\270\37\135\135"
-  "\22\344\112\227\4\203\40\132\260\242\150\166\373\355\252\167\322\276\50\233\12\21\12\224\255\127\165\352\226\24\352\103"
-  "\163\333\254\330\367\177\130\326\75\301\316\307\214\30\303\70\53\40\161\30\352\275\17\330\75\332\302\24\305\171\152\325"
-  "\311\325\356\33\304\323\51\157\73\371\343\35\26\245\44\155\54\64\155\307\245\211\347\107\217\13\226\30\317\133\26\41"
-  "\17\356\171\246\55\170\246\16\312\324\325\361\47\2\120\211\201\236\201\34\320\263\206\34\333\374\115\73\33\376\5\371"
-  "\363\353\235\356\66\165\340\150\75\136\342\241\53\166\274\361\375\45\241\206\41\57\35\117\354\324\134\77\60\106\52\76"
-  "\66\64\306\71\326\165\117\137\41\261\276\102\40\256\31\252\211\346\12\163\312\262\371\374\352\171\15\74\270\70\250\101"
-  "\63\365\271\243\343\311\6\100\63\350\266\202\153\321\354\243\201\355\6\154\67\140\123\102\32\372\325\240\13\270\362\342"
-  "\252\43\244\241\375\44\24\56\124\16\247\264\232\267\222\67\201\141\215\107\377\0\334\172\361\236\4\111\265\335\222\170"
-  "\374\253\240\175\300\75\217\343\226\335\32\264\144\133\45\45\42\104\333\217\320\311\236\200\117\77\353\317\73\77\112\25"
-  "\34\111\104\105\31\377\254\230\110\326\306\104\344\20\207\224\311\101\216\341\43\45\212\136\141\152\270\300\320\1\360\207"
-  "\61\37\375\64\13\144\21\52\212\13\361\316\370\127\70\357\171\217\361\174\50\256\333\217\353\163\55\325\237\252\125\331"
-  "\335\371\72\133\16\20\104\376\113\314\377\276\317\367\376\127\325\200\175\16\121\374\52\72\100\374\333\377\2\370\367\173"
-  "\265\52\66\223\205\313\344\163\153\151\63\365\60\370\363\273\37\245\1\157\207\1\135\107\73\232\55\367\175\27\43\146"
-  "\316\144\72\146\330\34\236\344\336\72\140\34\72\40\67\317\352\57\156\174\315\341\357\132\110\236\14\115\362\70\16\41"
-  "\271\76\220\334\167\357\342\151\34\115\356\107\343\373\150\116\376\270\107\160\216\116\150\324\170\10\360\110\121\167\171\175"
-  "\50\252\213\126\174\344\150\346\121\141\122\244\357\205\171\62\207\364\132\165\256\132\356\77\222\315\211\302\346\130\147\223"
-  "\172\372\141\154\16\77\13\12\170\167\330\55\66\253\373\72\232\53\302\66\317\20\275\42\377\262\116\123\47\331\110\303"
-  "\240\276\150\250\230\127\227\314\356\223\107\345\133\42\332\160\11\314\214\325\256\350\214\162\345\203\305\361\150\76\322\247"
-  "\136\37\54\174\121\37\345\62\234\252\352\364\6\254\116\322\313\330\261\250\173\60\103\272\352\255\326\255\312\211\352\35"
-  "\76\133\325\243\116\213\372\77\255\352\154\131\27\253\262\376\272\153\226\145\225\76\146\351\123\364\267\262\332\45\313\364"
-  "\71\153\316\31\265\351\52\312\260\257\337\175\225\177\50\64\17\113\124\337\271\350\372\345\370\243\327\273\242\111\253\355"
-  "\62\331\355\213\306\203\212\370\245\171\127\13\234\176\72\36\152\175\44\275\206\32\20\223\366\265\336\236\257\153\241\63"
-  "\305\222\77\24\172\350\212\361\263\201\116\337\270\252\100\105\350\52\256\232\175\355\361\214\137\377\50\12\372\52\255\116"
-  "\126\131\321\352\325\31\4\144\105\326\144\55\237\177\246\313\264\170\314\252\135\41\344\360\157\257\304\211\12\246\125\265"
-  "\253\134\270\55\366\333\145\331\124\265\133\372\275\375\162\275\177\70\375\7\66\131\227\75\40\177\220\2\5\373\261\42"
-  "\344\147\340\221\374\352\312\374\225\271\152\44\76\254\374\326\274\76\172\307\22\53\37\147\346\50\163\173\364\326\370\133"
-  "\370\22\62\225\24\111\132\141\213\51\304\242\114\261\13\12\170\36\125\240\156\25\255\136\266\335\142\331\36\324\114\67"
-  "\12\232\244\344\272\255\217\75\147\377\4\34\60\275\340\43\53\101\77\2\362\56\262\46\102\26\334\263\155\373\261\113"
-  "\50\107\131\205\141\104\371\130\73\105\113\362\46\55\272\204\174\52\356\162\203\141\37\252\124\256\255\12\23\114\100\200"
-  "\24\165\24\135\227\57\246\305\1\302\120\330\36\112\200\104\35\342\131\20\124\25\33\122\243\141\322\102\165\13\274\67"
-  "\51\306\361\157\272\177\140\247\300\346\113\307\350\157\72\265\172\55\161\70\231\321\71\135\104\63\253\1\170\330\54\237"
-  "\252\254\111\373\171\117\314\106\272\55\233\27\321\243\101\25\115\167\225\332\76\332\236\305\75\172\375\106\10\170\265\115"
-  "\125\327\75\117\13\270\101\36\27\257\353\317\2\11\154\51\353\272\312\212\57\135\0\270\35\36\256\110\127\106\20\240"
-  "\13\350\270\11\261\356\276\140\240\266\134\216\137\360\110\256\324\320\55\61\176\111\102\50\302\121\17\212\305\76\244\64"
-  "\241\300\104\272\105\262\55\225\103\30\241\243\162\211\32\176\114\55\12\77\100\67\34\375\252\117\105\370\347\221\7\322"
-  "\244\243\53\24\22\357\133\364\76\142\371\240\250\164\364\130\327\351\252\112\276\12\174\174\57\350\343\307\267\364\105\75"
-  "\70\260\115\267\153\267\250\363\235\335\222\126\11\125\30\332\146\233\154\363\374\275\232\224\355\326\277\273\145\233\354\341"
-  "\101\332\33\256\104\164\204\102\173\360\127\117\24\154\223\75\56\367\230\255\127\232\365\263\17\376\272\7\141\51\101\3"
-  "\31\361\50\21\364\322\116\24\312\74\125\333\271\20\250\130\146\305\46\253\322\244\71\116\125\73\56\147\12\76\100\67"
-  "\7\106\77\231\104\51\57\216\251\243\360\75\70\214\243\110\233\2\306\334\101\73\70\243\72\150\370\17\161\111\277\151"
-  "\256\353\14\233\211\334\14\227\116\354\170\121\244\117\137\126\245\213\15\155\201\176\176\240\253\246\275\42\312\240\66\227"
-  "\235\253\176\47\372\14\377\121\116\225\150\323\123\274\121\344\314\232\164\52\315\324\21\375\141\121\126\63\15\244\117\370"
-  "\37\265\23\215\76\174\212\161\10\265\5\204\177\121\47\211\237\271\237\75\53\120\106\275\357\330\375\256\237\126\145\231"
-  "\156\250\224\134\317\224\33\153\172\177\345\204\30\6\207\124\174\113\70\203\230\32\101\146\254\75\22\253\136\71\74\112"
-  "\201\257\11\53\355\262\223\46\15\325\312\110\71\273\234\251\222\27\316\11\224\242\371\76\7\173\352\312\164\246\123\40"
-  "\143\171\55\0\254\206\360\251\230\170\315\336\250\51\201\62\36\316\134\333\155\46\330\4\101\302\22\366\32\355\274\326"
-  "\117\136\20\243\116\322\122\235\71\177\231\361\20\163\46\73\171\215\143\335\103\220\106\70\11\335\373\230\362\64\264\77"
-  "\172\1\271\350\226\101\46\164\357\76\277\42\313\103\337\77\50\331\360\165\365\355\260\262\172\270\257\237\267\52\75\270"
-  "\273\346\344\171\156\153\101\207\373\263\50\166\173\137\124\351\52\371\272\132\347\162\163\110\27\67\111\231\372\34\267\257"
-  "\371\217\372\276\57\262\126\76\7\341\160\375\62\357\146\170\4\123\363\207\113\75\136\13\250\34\102\226\244\103\327\235"
-  "\162\237\347\357\324\235\143\35\51\350\177\307\203\275\43\50\5\323\176\301\354\355\223\32\353\175\362\55\155\152\115\257"
-  "\224\234\260\22\260\200\176\111\357\226\360\233\64\324\306\272\174\277\23\65\372\15\112\14\267\71\56\75\125\214\203\333"
-  "\305\241\363\302\56\211\16\66\154\345\16\102\151\352\15\233\163\175\103\107\337\253\112\3\203\266\142\305\327\361\137\151"
-  "\145\7\34\206\22\151\130\126\31\33\353\117\233\13\251\6\365\217\255\354\115\355\10\162\135\340\230\15\56\177\23\102"
-  "\310\102\206\223\247\30\365\175\221\147\305\133\56\341\361\273\134\207\37\217\44\217\372\301\3\75\34\171\315\171\216\116"
-  "\315\163\270\175\20\207\315\56\42\232\260\113\121\130\154\2\272\326\347\220\22\260\17\140\107\112\135\312\66\371\350\136"
-  "\164\375\365\234\345\366\56\77\172\215\337\163\136\147\135\36\74\141\151\275\117\222\13\372\334\77\106\221\132\171\124\57"
-  "\237\304\62\327\142\265\260\3\102\255\140\207\154\60\307\207\71\15\374\6\34\10\226\152\330\114\76\30\333\112\4\117"
-  "\326\222\50\127\77\107\274\267\75\67\126\244\147\145\263\365\341\242\271\214\107\141\207\46\245\245\53\205\62\261\305\260"
-  "\257\350\311\20\367\122\206\206\366\112\104\113\326\37\337\336\60\51\1\1\125\260\344\172\112\200\341\76\136\11\110\331"
-  "\225\225\300\60\375\376\177\220\252\340\354\222\33\31\335\301\12\367\117\350\41\15\260\215\261\273\36\24\143\370\250\321"
-  "\314\174\340\205\233\72\252\244\376\74\244\220\275\300\132\277\256\127\76\175\227\322\350\276\332\103\126\154\326\337\232\143"
-  "\276\136\234\263\325\113\207\72\152\334\163\235\177\333\146\305\351\254\46\51\176\355\24\242\217\46\363\311\142\74\163\256"
-  "\324\40\252\256\366\143\120\23\236\152\70\162\302\13\13\30\35\25\163\315\211\210\117\273\101\360\250\364\174\230\317\252"
-  "\161\4\220\44\350\241\135\273\211\347\347\134\215\114\17\207\322\45\333\376\275\240\237\157\57\361\142\213\242\121\160\370"
-  "\63\367\273\50\335\357\135\365\245\350\267\270\233\364\167\3\167\323\341\166\2\24\377\73\155\7\25\130\363\106\3\135"
-  "\220\364\217\213\145\127\110\32\136\116\3\77\353\214\252\307\225\61\74\271\152\112\117\106\266\237\306\271\154\144\130\301"
-  "\63\157\102\115\244\60\274\60\75\367\253\40\112\66\324\21\174\170\1\352\326\145\75\200\107\127\330\335\36\140\263\307"
-  "\163\127\237\247\22\164\346\31\274\322\36\32\102\47\35\342\222\212\167\200\240\207\42\355\331\141\320\240\125\43\242\310"
-  "\261\3\36\10\111\312\27\317\33\305\372\376\10\123\201\150\30\131\327\177\226\45\144\114\164\252\350\17\334\102\202\366"
-  "\335\304\4\333\62\226\64\66\344\345\356\246\357\264\256\154\251\137\22\12\131\310\34\230\73\43\132\146\175\223\301\316"
-  "\303\367\77\234\104\356\200\6\42\156\146\270\216\20\164\75\140\333\163\110\267\360\107\175\16\150\60\306\52\224\45\75"
-  "\312\22\17\145\356\31\324\77\15\7\226\224\223\221\104\324\372\317\353\170\3\330\336\221\12\36\232\126\115\164\341\351"
-  "\111\166\323\60\174\101\163\114\130\12\365\370\25\52\170\112\61\155\274\106\311\176\332\111\256\247\212\122\166\137\334\274"
-  "\135\166\303\63\122\104\16\156\365\367\110\152\341\250\375\70\177\365\353\376\254\74\352\153\330\256\263\133\375\267\337\13"
-  "\13\307\271\303\162\376\153\360\334\143\332\303\365\154\242\76\17\210\347\161\245\200\134\353\117\352\262\333\1\271\156\1"
-  "\122\170\156\77\372\34\127\345\157\275\130\313\176\353\26\154\322\202\146\344\63\76\23\22\315\2\237\11\1\140\77\240"
-  "\314\263\157\333\157\121\326\212\315\65\123\165\300\165\366\40\137\124\43\256\112\267\166\342\72\305\61\134\154\157\215\321"
-  "\256\172\151\313\312\227\241\257\207\347\216\212\347\177\75\35\277\351\370\115\307\173\112\176\276\226\317\46\256\226\267\5"
-  "\146\55\277\151\271\230\146\321\362\356\363\264\42\55\206\170\32\45\266\23\47\132\256\23\147\327\362\150\166\161\65\337"
-  "\256\363\264\20\65\77\174\342\135\66\75\65\244\173\230\265\262\203\72\222\323\354\236\264\255\272\124\24\302\17\337\132"
-  "\122\253\266\346\270\262\136\16\53\31\365\276\335\317\242\367\235\273\237\215\147\211\123\126\274\146\126\72\127\21\263\274"
-  "\116\377\100\263\254\324\323\116\320\372\204\121\210\134\17\124\24\11\211\106\62\43\340\62\122\341\273\225\51\274\343\46"
-  "\54\163\374\373\346\141\261\154\272\60\10\30\150\224\207\131\232\113\76\313\222\170\212\54\77\236\222\170\57\36\312\234"
-  "\32\370\101\104\21\255\225\324\203\376\70\103\176\156\267\121\354\247\112\124\327\322\341\214\35\312\266\221\172\305\120\210"
-  "\142\303\162\263\237\123\44\206\205\200\226\10\276\201\11\0\3\212\254\27\135\113\50\234\15\171\60\136\274\220\242\347"
-  "\135\245\205\271\211\134\350\361\76\106\13\105\62\174\120\230\231\110\317\357\202\356\52\2\347\333\357\365\64\54\1\323"
-  "\243\267\147\1\301\305\263\37\362\71\112\0\122\246\367\220\126\125\261\373\333\341\177\337\365\322\353\123\322\354\266\353"
-  "\145\362\365\333\233\176\304\123\342\176\157\127\317\171\252\333\344\334\144\202\33\233\133\55\163\323\222\67\224\141\104\253"
-  "\200\133\273\227\265\173\307\111\0\61\146\173\202\364\355\147\264\225\1\126\211\77\261\176\156\77\13\157\276\336\243\72"
-  "\260\76\146\353\254\363\234\340\65\173\201\271\41\362\217\62\307\23\347\331\222\51\271\111\354\17\114\170\32\162\113\253"
-  "\212\33\45\106\125\253\241\151\350\13\73\116\130\105\373\164\201\363\61\146\110\231\101\314\266\66\233\225\363\10\205\357"
-  "\151\12\231\155\315\363\271\276\351\364\240\36\212\15\347\123\245\221\325\116\7\30\132\331\4\277\176\163\373\116\263\253"
-  "\346\231\152\217\75\124\236\100\206\355\127\66\361\165\267\153\257\205\203\143\11\66\362\155\131\340\136\176\347\356\345\261"
-  "\267\227\267\244\364\15\172\107\16\217\133\225\346\215\74\336\25\14\360\254\231\363\263\237\376\263\137\102\11\337\0\350"
-  "\27\302\374\33\16\113\70\111\160\367\60\325\226\267\124\6\337\112\135\367\227\373\145\116\51\124\26\31\236\23\335\351"
-  "\173\102\343\353\107\376\171\145\67\232\10\104\143\57\57\1\172\150\203\152\215\175\211\351\141\210\341\265\55\344\315\110"
-  "\116\3\21\27\204\140\242\220\26\123\314\147\335\31\253\132\314\317\261\104\61\241\142\215\114\173\127\332\234\335\240\66"
-  "\310\263\350\250\264\201\66\210\152\245\33\40\172\123\227\267\102\44\224\46\150\256\154\56\240\222\346\321\50\1\335\153"
-  "\12\267\125\227\366\152\155\270\252\3\277\352\224\243\57\205\326\341\114\100\64\214\11\320\265\45\174\233\55\14\333\315"
-  "\317\304\340\264\14\217\357\75\160\47\170\267\377\371\177";
-
-/* lib/string.wo (DEFLATEd, org. size 23745) */
-static unsigned char file_l_43[2033] =
-  "\314\126\335\152\363\70\20\275\137\330\167\30\202\56\334\233\22\273\24\112\240\354\213\54\4\105\232\44\336\310\226\42\311"
-  "\64\351\323\257\353\111\52\224\161\352\232\302\107\357\74\307\147\146\216\346\107\250\150\254\356\14\202\10\321\327\355\356"
-  "\357\277\0\212\272\161\326\107\130\50\37\27\260\10\116\54\240\330\31\273\221\6\104\217\255\172\4\212\246\213\120\77"
-  "\125\17\17\17\43\76\15\66\326\237\173\67\372\40\267\313\367\62\171\114\145\241\4\31\73\104\155\352\315\107\12\151"
-  "\214\125\275\317\266\153\25\10\302\127\204\102\341\244\227\315\340\16\205\307\320\231\121\261\350\175\153\373\130\153\154\302"
-  "\56\245\27\3\276\32\320\21\11\52\236\35\366\136\321\166\316\241\377\224\60\340\253\13\72\45\201\7\63\366\215\5"
-  "\43\164\42\130\322\115\75\134\205\350\243\75\254\367\326\150\364\251\123\304\325\62\312\117\246\16\117\117\2\224\155\103"
-  "\4\151\352\135\373\132\302\342\237\256\75\264\366\255\5\364\336\372\177\227\313\5\171\222\260\213\347\346\35\275\205\2"
-  "\117\164\214\301\44\36\134\325\12\35\50\361\47\320\222\111\54\143\225\64\217\73\214\3\221\260\376\367\43\251\131\62"
-  "\122\113\10\115\321\343\266\66\206\0\217\261\363\303\317\21\231\75\133\51\167\116\102\57\300\244\324\340\125\16\334\230"
-  "\55\157\6\134\102\16\232\101\34\11\274\232\56\67\325\76\267\353\122\114\25\207\260\360\201\35\31\53\170\305\130\216"
-  "\220\115\17\35\100\224\342\112\260\16\104\45\170\201\71\162\333\225\62\1\241\333\260\204\127\376\226\105\72\162\344\213"
-  "\330\122\353\257\217\34\21\207\222\261\250\216\43\163\362\344\174\143\245\176\131\7\260\333\155\300\370\272\274\256\110\142"
-  "\340\51\142\373\301\141\342\324\76\261\102\264\36\137\130\30\46\165\360\141\221\31\153\214\224\240\343\124\17\322\276\0"
-  "\364\336\227\31\361\151\44\10\244\217\14\115\63\304\366\164\162\11\367\76\355\40\331\267\53\30\176\270\157\301\335\131"
-  "\240\300\172\34\176\321\146\204\157\14\334\117\147\200\147\143\103\300\170\34\232\267\111\311\101\173\353\376\320\224\65\56"
-  "\115\31\331\154\312\312\233\173\276\232\73\147\212\42\44\273\312\155\175\157\14\113\126\41\125\162\126\305\131\25\53\7"
-  "\343\350\337\63\320\252\34\207\346\214\216\52\47\227\202\205\254\236\237\23\44\331\114\123\35\31\64\127\130\365\163\141"
-  "\167\13\33\21\123\47\375\272\336\122\47\347\155\16\173\76\174\157\165\330\43\151\346\33\151\142\171\330\173\206\275\136"
-  "\46\336\173\312\272\363\275\120\323\247\153\260\111\247\43\373\366\164\173\171\16\121\252\3\73\121\146\42\152\203\71\326"
-  "\114\336\30\347\374\202\70\345\346\177\271\171\310\115\63\132\305\44\227\115\50\257\22\211\146\304\23\43\66\137\335\12"
-  "\273\270\356\256\73\237\35\366\316\6\241\11\310\63\44\62\36\337\377\157\347\12\173\33\66\201\350\237\351\347\151\115"
-  "\263\356\347\114\155\112\324\65\266\353\6\147\113\377\375\254\10\351\11\136\331\63\47\346\146\51\122\245\312\27\0\356"
-  "\270\343\216\307\1\324\331\322\56\215\63\337\256\162\47\50\315\35\146\206\77\270\354\2\170\116\227\210\123\336\241\353"
-  "\72\367\250\3\26\163\214\261\363\70\20\127\124\244\203\140\165\341\203\356\262\203\104\245\337\172\53\363\133\157\13\74"
-  "\131\37\257\257\220\253\203\2\133\344\117\165\76\171\170\302\233\320\207\122\22\255\154\54\221\3\165\103\22\317\231\321"
-  "\231\47\227\333\322\22\100\205\262\346\172\56\317\123\71\227\356\222\230\217\215\237\327\22\223\215\32\270\25\115\142\240"
-  "\171\243\373\225\326\57\343\120\170\175\123\272\323\151\335\261\356\32\301\54\354\175\33\331\373\303\135\364\343\157\167\314"
-  "\166\205\225\125\114\213\20\271\224\351\47\123\12\103\314\117\354\232\40\103\222\206\14\331\71\262\34\242\310\362\1\63"
-  "\224\174\154\361\141\334\207\365\357\177\71\304\133\201\160\103\341\244\167\123\304\336\374\55\271\253\305\333\156\11\60\152"
-  "\347\354\357\247\21\254\5\102\312\133\237\354\241\373\115\36\346\115\360\317\34\72\72\365\43\343\241\61\141\223\3\110"
-  "\173\216\122\106\56\264\141\104\361\172\366\314\32\3\142\36\247\76\13\166\12\220\364\103\367\126\6\136\146\360\131\26"
-  "\42\6\255\233\256\17\352\142\115\255\17\115\33\161\56\155\224\363\277\335\223\167\21\264\5\232\206\267\354\170\26\116"
-  "\52\256\37\337\342\371\132\23\234\72\331\301\51\234\27\40\274\115\116\377\126\2\262\230\11\61\42\201\140\231\267\363"
-  "\20\206\222\37\357\367\327\204\316\140\236\123\142\232\123\101\254\243\2\0\262\15\314\112\64\210\327\143\66\14\342\302"
-  "\43\5\231\105\301\2\372\214\31\227\207\72\31\246\13\274\260\257\176\132\202\315\265\261\63\50\242\1\157\242\356\210"
-  "\122\164\344\142\366\104\271\256\225\16\220\137\152\76\351\346\174\322\167\271\236\346\141\260\136\107\106\126\160\70\123\220"
-  "\242\102\126\65\256\235\242\262\211\154\350\76\306\203\36\130\174\334\107\313\52\41\124\107\247\230\320\122\107\316\21\32"
-  "\117\372\14\115\267\307\21\176\34\240\337\201\120\301\213\370\104\275\227\73\11\137\30\224\54\77\256\336\63\0\252\235"
-  "\21\272\377\172\122\313\303\24\114\351\226\120\127\73\167\366\61\361\220\30\370\104\333\114\51\165\101\34\47\11\104\324"
-  "\306\37\131\16\311\225\111\5\214\240\202\55\342\323\343\141\77\54\255\371\345\24\107\204\363\67\331\262\64\335\156\141"
-  "\174\367\365\376\246\163\203\226\143\264\260\166\150\50\311\45\246\242\31\120\134\355\45\226\204\373\35\143\324\230\107\133"
-  "\350\320\271\170\151\235\277\313\147\303\373\345\251\165\245\113\247\57\135\72\271\62\223\112\54\250\346\236\311\127\261\240"
-  "\201\1\77\20\327\117\150\333\275\266\4\267\377\61\206\170\32\307\153\301\20\61\242\206\41\222\311\117\261\271\27\240"
-  "\210\53\334\112\220\247\160\166\250\262\135\150\370\211\27\32\30\61\145\165\252\166\135\101\35\123\222\342\112\126\355\233"
-  "\335\201\34\373\365\73\365\346\324\33\10\333\134\164\212\302\16\165\163\344\311\64\205\313\276\272\213\203\260\252\232\26"
-  "\273\106\346\106\363\301\25\315\351\303\176\225\327\344\117\123\274\151\310\2\116\5\66\350\143\0\212\361\50\141\203\32"
-  "\240\242\311\365\35\313\111\122\120\55\276\243\341\135\347\166\323\12\40\230\341\334\273\42\64\46\232\31\230\137\266\165"
-  "\123\344\147\160\37\21\22\27\10\102\117\373\247\363\134\350\33\341\271\60\2\226\222\276\26\144\104\372\164\122\374\312"
-  "\150\40\13\103\313\110\370\65\124\272\72\350\161\174\76\36\240\245\201\120\43\241\3\104\271\161\260\35\100\331\327\243"
-  "\333\76\353\153\147\175\355\254\317\310\22\31\17\346\120\130\30\217\32\343\43\21\350\125\211\62\15\15\251\206\274\46"
-  "\355\337\117\103\10\344\24\33\241\160\365\124\305\274\57\133\365\121\210\74\267\327\237\250\210\261\152\75\112\363\114\132"
-  "\232\111\163\75\67\340\172\304\72\375\3\163\120\374\24\373\213\371\117\277\367\200\7\36\164\152\76\352\213\37\304\316"
-  "\237\36\150\40\262\150\46\275\16\75\377\55\24\221\33\43\201\204\237\306\130\36\57\256\373\263\57\135\1\235\371\20"
-  "\61\214\41\126\372\124\343\267\14\235\374\227\131\370\101\10\20\167\272\137\242\341\70\133\206\220\143\112\241\45\272\132"
-  "\20\7\311\206\346\107\137\365\163\111\77\74\215\305\127\16\360\266\141\144\336\27\212\210\7\241\311\40\205\7\22\225"
-  "\166\113\164\257\160\242\103\277\213\240\147\257\205\210\271\262\47\122\143\104\132\361\261\174\220\43\40\307\146\220\226\0"
-  "\221\54\61\210\0\224\314\31\316\5\12\233\252\53\53\253\141\331\175\36\223\205\165\37\23\110\165\57\357\204\206\261"
-  "\207\47\126\151\22\347\106\263\205\151\71\172\114\175\63\352\171\324\23\15\302\6\56\34\224\330\5\232\374\372\361\123"
-  "\203\16\2\73\227\206\147\267\67\260\251\215\255\31\33\144\246\343\2\350\137\251\116\200\102\66\100\272\254\257\64\274"
-  "\167\35\154\76\20\254\173\115\35\42\157\62\231\126\375\270\154\270\347\375\261\307\160\3\201\316\266\135\245\27\73\134"
-  "\321\223\35\304\325\300\327\127\271\245\174\314\254\245\161\171\367\30\342\10\224\44\300\10\257\104\153\206\103\301\177\261"
-  "\307\156\372\303\33\223\51\104\47\277\77\106\47\65\76\163\210\162\164\373\137\370\135\350\154\270\214\12\321\123\331\313"
-  "\206\264\5\241\77\321\173\103\332\274\243\311\233\377\376\1";
-
-/* lib/time.wo (DEFLATEd, org. size 46152) */
-static unsigned char file_l_44[4434] =
-  "\354\132\347\262\243\74\22\375\275\351\35\124\56\373\313\343\102\10\60\366\346\234\163\216\24\66\302\103\55\351\202\270\351"
-  "\351\27\220\55\33\132\255\145\264\71\114\24\115\237\116\352\76\142\140\76\50\252\244\313\71\131\213\254\340\237\373\64"
-  "\41\37\144\105\135\65\202\254\116\215\130\221\125\133\257\127\344\203\163\136\35\343\234\254\173\331\241\227\220\17\212\116"
-  "\220\214\271\37\176\370\241\6\123\360\242\152\136\172\230\134\110\330\145\355\0\4\352\105\72\230\150\77\305\155\26\265"
-  "\145\134\267\157\53\21\325\15\177\314\370\23\355\15\234\362\352\364\347\150\310\41\72\163\321\333\112\273\362\104\326\172"
-  "\375\303\124\233\174\120\307\115\134\214\356\324\72\360\76\234\312\33\336\166\271\66\351\126\44\171\166\354\203\350\155\361"
-  "\362\121\71\227\362\203\224\56\67\326\144\345\171\65\56\116\365\213\62\46\345\7\51\235\30\263\60\134\352\55\227\6"
-  "\323\126\361\27\65\364\62\110\377\126\303\71\57\241\341\101\272\324\30\157\232\262\132\251\277\125\347\215\327\207\361\317"
-  "\1\6\67\72\33\120\155\131\367\76\105\252\142\30\157\34\256\142\220\235\105\71\145\100\162\52\17\221\170\155\271\220"
-  "\103\47\1\375\237\333\123\125\266\202\70\72\300\360\307\153\125\162\362\1\177\226\241\137\45\253\17\315\146\222\130\304"
-  "\27\43\111\374\322\106\131\31\25\125\51\336\222\307\270\41\161\236\235\313\57\172\144\365\7\232\376\301\161\56\277\50"
-  "\127\353\145\362\277\27\66\121\353\25\10\276\17\72\32\22\300\343\376\274\132\375\116\255\236\157\326\367\273\333\372\350"
-  "\337\326\211\167\133\247\354\56\32\372\7\207\312\265\243\126\77\122\253\102\255\140\254\117\175\240\121\31\27\174\22\154"
-  "\233\275\362\57\272\341\240\114\206\16\111\267\367\173\323\262\265\274\103\6\351\266\356\104\324\253\220\52\115\133\56\276"
-  "\350\134\356\1\224\147\102\171\30\312\67\241\102\14\25\230\120\324\305\140\73\43\54\300\140\241\11\346\242\5\331\33"
-  "\141\36\234\212\241\362\104\316\214\334\51\112\126\77\357\112\270\261\262\336\100\367\207\25\246\353\3\335\137\164\34\321"
-  "\15\200\356\257\171\202\350\356\240\335\267\35\242\33\2\335\157\65\31\242\273\207\165\210\5\336\340\151\227\347\357\334"
-  "\345\224\132\265\71\165\255\372\234\62\253\106\247\236\135\247\123\337\256\325\151\140\327\353\164\367\356\315\116\251\256\333"
-  "\373\375\104\232\202\272\272\216\67\350\63\135\327\267\6\200\247\153\375\322\10\361\165\23\320\230\20\201\156\16\14\372"
-  "\73\335\54\164\15\104\250\323\11\31\5\17\37\205\275\325\50\270\216\325\50\270\324\152\24\134\327\156\24\134\146\67"
-  "\12\256\147\67\12\256\157\304\341\145\61\217\36\136\27\343\350\61\274\56\241\21\207\327\305\330\54\36\132\27\146\356"
-  "\26\75\105\300\203\340\173\61\166\310\271\16\234\54\176\304\224\51\44\223\270\301\224\41\363\174\265\106\225\31\264\214"
-  "\116\267\353\301\4\73\64\101\137\243\234\143\312\1\214\271\73\143\312\32\222\341\65\246\34\2\345\37\237\4\246\14"
-  "\167\360\107\325\43\242\314\340\16\176\203\237\60\232\63\35\373\70\327\61\327\212\353\30\263\342\72\346\131\161\35\363"
-  "\355\270\216\5\166\134\307\166\166\134\307\102\73\256\143\173\73\256\363\34\73\256\363\250\35\327\171\256\35\327\171\354"
-  "\335\271\216\271\72\256\353\342\6\343\16\306\164\174\327\230\20\236\216\364\116\157\61\165\137\107\173\131\216\251\7\357"
-  "\100\174\154\247\43\76\216\151\207\72\346\103\155\357\165\324\327\265\30\107\171\216\216\375\170\161\344\15\206\240\72\12"
-  "\254\14\0\127\107\203\106\27\114\307\205\70\42\156\117\303\337\321\261\113\357\350\220\112\72\164\3\240\177\56\200\272"
-  "\142\117\6\325\43\361\72\60\55\64\355\123\127\247\374\30\347\232\60\174\255\341\44\315\305\104\171\105\10\321\46\171"
-  "\11\102\275\172\222\327\253\17\141\12\132\376\127\336\226\237\0\313\201\332\241\366\141\53\376\342\167\310\216\7\240\15"
-  "\307\114\250\116\25\66\307\246\45\233\166\303\22\262\331\272\311\101\375\101\66\311\37\112\304\341\16\66\345\227\61\125"
-  "\266\134\325\203\261\305\144\163\44\233\76\230\147\262\371\55\206\323\260\315\17\61\135\110\65\77\101\165\167\60\236\144"
-  "\273\51\266\170\44\41\104\174\347\260\371\341\141\363\163\14\261\207\10\245\52\137\344\252\267\247\263\67\247\122\207\134"
-  "\137\332\256\153\61\171\161\53\277\26\134\124\362\352\164\171\223\134\65\243\226\22\35\353\365\124\220\316\5\31\235\13"
-  "\334\271\200\315\5\336\105\40\335\313\327\300\333\63\27\352\63\212\274\61\252\157\333\101\176\224\62\203\362\355\275\60"
-  "\15\156\222\266\73\116\160\355\4\267\300\273\340\174\110\32\312\62\12\34\73\27\101\340\155\371\263\340\145\22\365\367"
-  "\242\366\46\155\105\325\160\105\10\227\75\15\161\63\327\204\234\353\17\25\305\65\142\25\131\57\311\27\176\73\2\251"
-  "\214\373\76\217\42\360\175\346\337\204\161\231\334\56\370\303\353\345\42\5\21\151\153\345\256\201\236\222\15\171\346\125"
-  "\234\300\272\340\145\120\167\222\354\61\352\226\25\230\347\55\137\26\55\133\317\135\277\241\13\175\224\11\160\121\13\270"
-  "\301\112\120\162\130\110\205\203\221\171\153\64\3\274\216\366\241\57\265\255\40\160\120\341\300\65\134\164\115\71\254\1"
-  "\213\215\175\172\243\261\361\122\361\330\337\237\267\160\22\372\77\11\271\140\372\376\55\270\307\74\102\140\152\255\333\363"
-  "\337\147\46\222\54\115\247\247\273\224\300\23\136\120\71\34\352\332\31\257\325\344\244\303\5\10\116\120\50\272\353\41"
-  "\325\273\251\54\353\43\157\104\324\337\220\35\145\214\274\345\247\66\22\125\44\212\131\234\323\60\153\1\77\51\317\47"
-  "\174\370\54\72\242\224\144\60\76\225\274\360\270\231\211\32\136\110\44\163\47\302\1\14\204\22\77\221\76\234\242\323"
-  "\313\51\347\63\261\136\372\240\225\216\137\242\147\262\341\333\322\124\362\2\44\71\217\353\277\337\203\226\22\370\163\101"
-  "\60\27\354\346\202\360\42\200\155\2\346\55\330\355\235\320\17\203\75\165\174\352\273\367\7\165\56\24\7\245\223\235"
-  "\6\304\211\237\326\320\343\325\141\270\13\303\275\33\336\73\74\53\207\134\321\107\252\234\51\206\100\207\336\354\170\357"
-  "\323\336\153\350\350\46\105\261\233\354\322\271\317\60\360\34\23\111\253\347\232\26\34\100\103\63\203\330\254\175\64\274"
-  "\210\356\220\117\115\134\17\223\15\222\270\14\14\116\301\223\315\5\361\1\70\14\161\340\370\44\1\351\112\44\314\130"
-  "\225\1\264\15\310\26\154\17\122\117\16\217\30\206\133\204\321\50\325\70\1\206\166\177\237\215\220\274\141\267\13\172"
-  "\354\16\57\277\202\200\221\60\156\202\27\70\373\335\262\336\6\351\2\377\212\175\55\174\377\35\172\136\71\261\353\171"
-  "\143\214\346\246\327\216\271\252\6\60\12\37\64\361\52\302\255\304\243\145\201\357\172\112\50\267\15\24\12\213\352\16"
-  "\310\37\320\72\131\346\264\70\45\263\103\74\327\242\313\261\10\144\332\370\6\323\277\126\261\7\44\4\327\137\124\262"
-  "\7\313\66\260\52\31\100\202\134\355\53\246\12\157\56\230\172\66\263\152\61\24\155\256\227\202\131\324\113\41\361\114"
-  "\315\345\152\27\133\127\57\143\360\7\53\270\221\366\217\141\140\210\140\14\252\120\12\10\331\123\351\250\164\345\343\356"
-  "\142\136\242\23\6\5\163\24\242\4\173\126\256\60\15\301\271\174\32\307\166\317\154\111\135\234\71\176\72\330\333\67"
-  "\267\314\213\351\274\306\247\10\355\23\320\255\150\311\251\343\340\115\202\133\61\237\325\327\370\200\155\160\246\341\46\244"
-  "\113\171\241\75\155\357\112\162\34\137\76\255\135\370\106\5\240\344\77\352\256\342\252\46\153\52\121\362\353\16\362\377"
-  "\221\101\32\243\24\333\20\163\335\165\57\36\74\174\200\24\214\107\272\251\75\66\121\226\252\324\257\225\370\113\173\347"
-  "\275\50\73\152\203\361\227\231\77\123\14\256\363\62\333\157\157\247\246\75\175\346\372\344\52\61\277\145\77\30\341\170"
-  "\122\266\133\73\126\343\103\200\100\270\77\145\31\36\157\153\121\364\264\336\0\143\320\212\112\123\304\234\74\42\176\171"
-  "\370\162\367\315\257\206\214\125\213\355\103\74\225\312\356\104\140\21\257\307\274\263\62\176\110\272\206\136\146\351\116\206"
-  "\310\44\4\165\235\26\305\330\37\206\171\130\372\151\220\13\201\67\376\174\104\123\315\177\157\252\57\352\355\217\355\62"
-  "\33\153\366\15\116\344\262\234\111\347\274\47\270\256\242\157\330\311\177\65\53\75\224\250\33\46\241\156\161\77\213\355"
-  "\165\213\102\267\174\214\5\253\346\312\305\101\50\67\234\104\32\301\41\173\21\262\307\23\61\326\110\266\22\75\235\112"
-  "\163\130\375\324\165\130\275\370\25\124\355\62\27\53\70\121\275\374\17\56\74\256\323\237\32\56\102\103\207\2\230\235"
-  "\211\175\10\73\221\364\360\317\35\224\157\224\314\31\211\242\255\11\356\43\322\63\172\243\210\276\264\35\65\356\242\224"
-  "\45\243\340\341\220\156\76\155\152\6\311\365\332\161\243\217\172\334\240\260\172\270\351\6\177\365\164\71\126\265\236\340"
-  "\335\266\357\343\303\317\333\6\376\345\325\343\223\154\341\247\277\135\252\64\113\367\142\364\342\141\145\7\273\56\252\155"
-  "\147\274\313\367\217\251\67\102\312\174\134\162\333\240\66\211\137\175\156\313\224\170\162\10\126\333\257\234\106\271\345\14"
-  "\3\5\351\314\302\136\312\364\267\244\314\170\113\312\54\134\240\354\44\152\234\271\232\125\226\163\305\353\167\225\165\144"
-  "\144\161\107\204\345\142\171\251\210\65\76\145\210\305\313\123\360\101\74\146\233\220\126\56\256\256\145\55\364\57\370\201"
-  "\162\270\126\305\336\261\325\170\74\231\323\261\22\347\32\275\114\203\116\347\241\255\11\304\11\340\165\340\117\56\116\110"
-  "\223\12\6\45\162\347\312\7\272\112\257\323\170\340\100\17\275\57\114\305\340\273\36\375\221\243\357\45\57\224\14\265"
-  "\376\23\252\203\74\70\21\257\77\70\161\213\347\311\50\175\365\223\43\44\53\374\343\107\324\170\163\355\3\124\131\321"
-  "\321\160\16\51\217\177\212\103\226\265\213\264\276\210\313\42\270\104\377\224\331\230\350\144\152\71\313\336\313\22\370\6"
-  "\76\55\41\334\142\252\244\1\372\173\255\201\163\60\44\2\375\63\121\132\344\326\25\343\143\365\366\310\73\354\214\44"
-  "\350\301\312\221\123\246\262\35\212\3\42\30\361\301\226\375\157\237\111\313\123\377\154\146\275\333\303\4\340\201\223\123"
-  "\266\13\206\337\342\200\351\26\372\177\60\114\234\17\165\355\305\212\21\215\57\36\202\115\260\320\100\375\77\120\313\43"
-  "\272\275\45\377\303\114\261\367\364\230\302\205\150\263\241\143\134\166\237\24\230\256\271\245\64\67\334\331\31\313\5\277"
-  "\253\332\105\107\40\140\137\36\162\263\317\361\154\24\357\316\260\120\141\51\127\301\217\136\102\324\253\345\324\271\274\315"
-  "\220\313\15\265\162\1\235\26\300\377\343\137\202\316\247\352\376\257\302\260\110\272\264\254\47\172\271\227\321\266\302\326"
-  "\107\333\7\263\35\217\257\145\366\377\57\4\316\347\114\170\337\340\171\123\14\267\271\107\25\20\132\375\133\76\140\120"
-  "\332\324\101\67\143\152\100\332\330\264\271\226\23\13\254\352\130\207\44\246\111\67\244\46\72\41\263\371\351\116\357\52"
-  "\61\376\225\61\227\211\371\127\337\77\3\16\360\220\160\337\153\277\47\230\343\115\314\6\7\23\311\73\64\260\165\214"
-  "\175\120\100\120\224\164\62\245\233\107\135\175\310\316\373\320\354\101\362\117\144\320\105\220\25\242\312\223\173\321\257\210"
-  "\365\245\312\106\6\254\47\350\252\101\300\306\53\154\201\376\124\244\334\376\55\60\234\334\136\22\212\212\51\277\153\20"
-  "\376\364\141\133\322\273\76\263\240\367\223\274\262\343\211\125\253\247\247\265\346\25\325\244\11\351\371\351\347\357\337\76"
-  "\74\362\167\337\177\145\371\102\6\230\326\360\107\320\176\372\365\316\36\363\331\336\63\16\2\242\371\161\52\50\73\130"
-  "\2\327\146\106\3\125\347\356\267\353\132\136\132\0\200\23\326\341\124\26\15\340\211\134\212\52\257\111\323\212\232\165"
-  "\116\105\351\177\316\55\312\32\45\114\131\374\44\153\45\117\266\312\114\320\53\123\232\215\212\27\72\335\217\216\343\235"
-  "\316\76\347\136\41\173\32\335\344\323\371\315\332\236\35\236\336\347\0\341\166\260\116\102\330\250\307\233\343\235\72\320"
-  "\370\246\331\123\335\114\210\255\165\106\305\122\243\240\266\226\131\134\322\107\174\121\136\46\256\10\203\125\226\306\370\330"
-  "\340\16\116\306\77\137\211\17\73\300\17\351\232\14\42\224\35\72\55\67\171\271\23\202\366\72\27\170\314\5\211\102"
-  "\265\374\44\317\156\116\114\16\36\33\211\47\217\77\155\17\307\134\356\117\164\34\75\276\274\215\61\147\312\345\22\372"
-  "\212\214\112\304\366\2\226\150\331\131\61\363\301\1\2\346\312\15\13\54\12\371\205\212\374\21\142\114\2\1\304\126"
-  "\161\17\366\204\111\33\304\40\137\156\17\205\354\153\117\37\205\75\245\52\107\41\150\130\332\10\132\204\234\151\150\43"
-  "\147\20\162\226\256\215\34\325\100\147\15\70\256\317\50\133\57\236\344\42\73\204\130\245\112\66\277\221\174\302\250\210"
-  "\31\353\216\262\261\312\22\162\214\255\62\364\257\77\117\203\277\21\375\205\47\256\214\374\177\301\235\167\204\246\377\16"
-  "\104\235\351\150\175\271\245\236\177\250\333\214\264\111\124\136\125\34\131\275\124\333\224\27\346\102\331\231\120\375\104\310"
-  "\272\213\356\33\373\40\177\130\366\330\151\142\143\211\204\75\202\17\300\152\355\355\252\345\131\271\60\54\102\23\233\356"
-  "\326\256\376\234\160\63\20\247\45\177\4\133\26\133\360\273\115\310\170\323\271\350\102\172\215\200\25\202\51\52\7\4"
-  "\66\14\125\265\206\20\215\124\72\252\161\114\333\337\263\4\267\324\67\161\155\306\261\345\321\145\7\365\331\67\271\61"
-  "\353\254\320\164\140\101\24\172\374\371\325\253\17\311\216\305\335\66\170\77\76\375\370\360\364\375\247\365\153\132\322\317"
-  "\137\331\345\256\232\274\313\314\74\71\215\57\274\333\316\124\67\51\133\155\315\371\132\25\265\170\324\365\101\246\121\362"
-  "\46\347\123\60\2\31\126\160\364\252\37\250\204\326\310\20\331\136\265\142\341\332\277\63\63\355\342\112\333\247\207\344"
-  "\62\336\27\12\343\312\143\322\21\76\375\370\227\55\345\365\47\233\350\130\337\321\221\350\41\271\211\366\313\363\347\247"
-  "\55\351\202\366\213\116\240\131\11\63\172\233\121\336\176\171\176\10\161\113\303\153\172\325\161\364\75\265\106\70\103\261"
-  "\16\224\0\112\4\245\7\145\0\145\4\145\2\145\6\145\1\5\72\307\16\24\372\67\202\322\203\62\200\62\202\62"
-  "\201\62\203\262\200\2\235\373\16\224\0\12\101\321\203\62\200\62\202\62\201\62\203\262\200\2\235\207\16\224\175\57"
-  "\210\137\272\177\113\101\37\176\165\211\41\372\44\351\32\127\162\153\142\124\3\131\251\217\250\316\131\203\136\375\301\346"
-  "\176\276\256\74\347\45\22\312\72\257\157\341\161\243\373\260\65\45\316\311\363\224\74\217\311\163\372\176\237\74\307\344"
-  "\71\44\317\335\366\71\234\223\347\45\171\236\223\347\51\171\36\223\347\41\171\356\223\347\230\74\207\344\71\321\57\121"
-  "\57\321\56\121\56\321\155\24\60\301\54\204\273\166\25\300\262\206\147\206\320\300\306\74\42\0\150\5\151\23\70\114"
-  "\143\25\207\211\14\246\52\6\13\30\314\261\212\101\10\344\320\327\161\210\344\60\327\161\30\31\40\53\165\230\311\141"
-  "\254\343\260\220\103\245\25\147\162\130\352\360\24\310\341\134\307\141\0\207\163\127\307\141\44\207\72\77\214\144\120\347"
-  "\206\231\14\352\274\300\206\10\135\235\27\102\107\26\335\124\307\242\47\213\256\316\216\60\220\105\250\354\336\23\131\204"
-  "\112\114\165\144\21\53\101\25\311\42\206\72\26\66\110\75\330\210\374\217\42\40\2\256\317\216\362\366\322\164\152\272"
-  "\270\167\174\342\302\245\301\124\122\67\304\155\377\71\236\374\63\46\326\4\144\77\241\357\266\324\277\153\115\113\315\127"
-  "\206\253\341\137\141\65\137\3\253\245\34\126\141\72\20\126\102\203\20\256\304\125\277\43\256\370\211\146\267\245\7\300"
-  "\352\134\166\65\110\227\363\360\220\101\330\146\265\146\271\252\144\53\233\352\330\110\247\67\72\271\357\245\375\257\117\347"
-  "\341\222\112\64\201\270\260\110\372\62\350\313\132\366\261\14\307\330\133\133\26\205\145\303\325\127\100\21\47\241\20\47"
-  "\243\307\233\313\15\303\144\332\335\260\203\120\62\67\104\111\74\65\160\111\114\134\2\225\137\222\325\145\133\55\140\216"
-  "\270\155\334\54\156\27\300\174\321\150\240\236\67\203\345\263\137\373\3\1\33\272\206\210\355\13\343\132\10\236\376\37"
-  "\363\150\327\37\327\70\30\54\41\36\143\71\201\46\372\321\1\110\354\217\161\315\356\135\260\127\206\267\234\132\14\245"
-  "\135\320\65\267\10\223\337\333\107\365\300\351\30\303\217\217\364\55\347\46\143\51\314\26\217\267\207\33\236\302\206\363"
-  "\76\226\35\17\224\330\162\112\60\271\46\261\345\345\174\176\51\241\367\336\67\315\4\303\230\113\341\244\314\371\352\164"
-  "\272\62\51\22\346\322\54\204\153\26\326\335\160\337\214\161\167\313\216\352\233\175\303\276\271\154\236\316\231\236\12\141"
-  "\154\12\377\321\204\145\344\202\363\361\325\307\127\77\363\360\204\35\230\324\107\21\263\310\37\64\76\214\337\315\201\173"
-  "\164\50\177\70\176\247\166\370\215\305\351\326\331\265\262\30\156\71\322\55\173\231\166\74\124\316\15\241\22\234\73\5"
-  "\163\333\235\202\30\235\372\54\215\365\51\315\334\364\235\13\157\30\132\17\310\120\70\66\67\302\361\306\37\326\35\373"
-  "\330\260\73\16\245\160\353\367\361\70\257\115\142\223\334\0\336\206\343\254\327\210\74\76\143\330\217\307\371\347\370\150"
-  "\325\53\357\114\107\171\147\377\140\65\50\333\347\206\301\152\74\351\233\375\264\103\373\130\227\336\330\373\124\5\355\234"
-  "\116\271\331\306\371\124\311\152\56\215\357\113\346\334\360\376\261\365\354\76\124\277\347\141\203\206\51\70\216\265\326\170"
-  "\305\173\276\264\106\47\246\50\317\377\165\104\152\144\147\235\256\76\370\105\105\305\125\270\74\27\306\323\153\160\21\76"
-  "\125\151\305\41\11\325\176\231\273\237\151\55\201\333\204\214\147\270\6\77\205\130\165\65\333\157\326\303\76\344\34\227"
-  "\261\205\316\374\214\273\172\245\10\372\205\5\71\76\27\263\154\307\74\340\50\253\170\264\67\14\74\132\113\266\363\307"
-  "\127\150\147\370\13\64\251\44\35\210\120\24\166\14\224\355\375\313\157\47\150\336\277\47\163\127\234\262\243\326\342\163"
-  "\13\2\6\262\273\123\15\215\143\12\364\136\27\161\371\353\357";
-
-/* lib/unistd.wo (DEFLATEd, org. size 25993) */
-static unsigned char file_l_45[1892] =
-  "\314\127\327\162\344\40\20\174\276\364\17\224\312\71\347\354\157\121\261\142\130\123\207\100\7\43\247\257\77\214\164\50\260"
-  "\127\302\71\233\35\365\164\67\43\342\132\251\131\55\201\54\325\112\130\144\277\276\23\262\46\312\112\33\44\131\141\60"
-  "\43\231\255\226\62\262\66\227\172\106\45\131\162\261\13\27\41\153\145\215\104\34\36\254\257\257\57\310\51\241\324\346"
-  "\301\245\65\215\46\255\155\357\371\214\64\25\47\60\102\337\121\53\162\253\150\145\157\64\346\225\201\133\1\167\373\216"
-  "\200\263\334\0\145\216\204\327\252\40\113\213\201\27\55\214\254\125\324\320\322\13\244\265\15\330\132\206\56\247\132\272"
-  "\63\2\41\301\223\307\175\224\251\102\152\233\142\312\343\336\102\220\121\244\366\101\25\323\232\1\372\26\262\234\131\244"
-  "\230\317\1\23\204\73\360\133\227\233\13\11\236\333\202\373\25\217\51\245\217\162\26\232\72\71\172\261\251\52\161\262"
-  "\124\111\263\45\62\365\372\252\125\111\123\47\0\77\303\242\5\370\75\155\320\303\322\154\274\336\122\342\54\173\223\31"
-  "\126\121\274\361\3\65\165\226\105\11\317\135\360\336\306\262\24\152\362\265\5\140\202\225\17\264\156\200\262\124\373\1"
-  "\374\25\154\227\372\26\162\46\14\24\250\315\103\212\375\50\351\175\55\332\207\62\261\260\1\373\71\265\254\325\223\266"
-  "\237\106\123\146\307\370\367\63\146\164\221\303\275\300\51\107\1\30\44\143\25\213\106\250\171\346\33\22\124\240\154\342"
-  "\27\115\64\325\62\30\243\164\26\376\207\3\246\377\174\341\377\56\70\144\362\102\241\164\131\134\50\226\33\220\117\205"
-  "\14\76\374\303\213\376\243\364\132\266\34\355\141\373\242\331\133\341\276\121\365\73\262\107\221\226\305\211\261\1\353\322"
-  "\254\346\303\200\232\75\40\304\152\244\245\221\272\150\273\353\303\41\60\253\226\206\1\76\16\210\375\161\340\140\251\117"
-  "\335\124\162\147\16\30\216\353\315\3\17\337\261\200\136\145\2\354\10\167\12\255\54\222\375\223\56\142\353\331\40\317"
-  "\106\171\23\352\10\340\273\24\305\304\176\57\346\363\175\115\173\322\250\15\20\315\271\323\274\336\43\124\212\271\272\76"
-  "\212\162\170\334\201\243\56\100\31\213\225\17\142\145\377\362\236\257\315\122\354\354\247\200\316\26\170\166\170\71\165\175"
-  "\212\172\7\306\214\271\117\216\217\17\217\173\374\212\215\21\173\135\100\101\333\346\221\355\27\121\237\366\106\23\374\371"
-  "\307\75\230\42\377\251\5\110\13\257\361\0\212\105\143\267\277\334\214\171\266\243\27\25\115\233\170\370\33\300\332\250"
-  "\221\340\337\166\256\160\71\131\40\6\276\121\247\125\112\351\323\70\124\120\235\42\70\200\343\127\237\376\3\257\215\345"
-  "\326\114\232\236\364\254\275\231\376\41\122\10\311\146\67\71\0\56\325\105\225\146\37\250\112\10\125\56\47\75\103\145"
-  "\246\11\47\56\73\156\6\62\13\144\166\345\144\166\304\151\140\263\241\17\201\315\266\303\316\154\353\330\232\221\311\370"
-  "\155\46\377\337\315\160\121\162\101\206\153\114\226\221\123\114\274\270\112\213\243\273\374\137\333\41\146\326\375\66\153\116"
-  "\326\242\245\255\205\375\317\223\304\67\240\3\231\63\151\36\211\343\267\267\325\261\352\343\35\153\202\6\313\341\20\3"
-  "\360\323\250\14\354\106\360\207\70\201\257\161\64\340\365\111\364\16\261\204\176\377\250\136\62\120\14\65\304\160\12\54"
-  "\0\113\316\30\60\226\311\63\163\375\117\367\116\107\4\1\326\343\353\17\312\266\65\205\230\355\337\50\334\101\270\203"
-  "\160\7\341\276\235\351\54\50\167\34\5\351\146\1\26\244\273\70\336\45\47\345\76\156\362\302\15\242\114\266\375\52"
-  "\57\347\366\32\142\34\71\10\365\365\257\20\242\14\43\315\110\224\155\342\6\232\373\310\240\36\200\42\261\122\237\317"
-  "\233\140\162\340\12\257\13\155\100\230\343\221\1\220\75\365\23\311\245\311\140\321\326\335\146\372\271\225\47\223\104\12"
-  "\105\136\56\333\225\330\251\67\7\263\13\20\2\134\213\71\40\224\133\163\340\366\364\337\364\312\51\105\123\163\220\12"
-  "\231\171\62\355\72\253\332\75\142\350\236\200\132\363\270\44\41\266\337\344\321\372\205\31\222\311\232\234\242\356\314\104"
-  "\106\41\55\353\46\155\333\267\123\136\314\366\67\22\343\271\143\230\116\374\164\14\264\233\142\362\0\360\325\337\3\126"
-  "\255\2\315\375\117\164\302\311\154\147\353\337\3\260\66\136\234\320\106\74\140\27\41\353\157\302\315\132\323\330\151\326"
-  "\42\247\51\40\50\114\217\317\36\122\3\41\273\150\327\321\274\324\237\46\220\156\13\6\220\165\71\27\131\242\314\367"
-  "\103\132\250\212\214\341\363\356\160\174\131\164\273\120\112\20\73\170\34\75\263\73\55\6\300\36\131\135\155\355\303\354"
-  "\312\72\117\347\253\364\245\260\0\205\336\223\53\207\341\171\314\113\43\167\324\150\160\43\324\252\0\320\10\147\143\216"
-  "\123\317\166\100\224\135\116\45\100\323\116\344\362\262\256\366\300\203\35\30\120\352\60\23\30\345\150\234\106\20\375\301"
-  "\260\312\355\172\72\237\347\115\47\253\247\352\41\223\324\256\367\317\117\16\55\351\246\312\162\313\324\56\212\164\51\226"
-  "\136\121\125\257\273\355\254\337\267\31\324\140\37\251\312\222\357\315\272\244\11\300\213\236\77\377\304\12\200\211\46\240"
-  "\43\321\66\175\16\362\145\222\207\0\325\272\200\24\344\375\326\0\106\200\262\61\104\243\324\146\11\373\233\62\141\214"
-  "\324\231\15\237\220\326\265\161\374\73\32\347\346\210\152\314\111\242\272\376\25\122\254\53\371\32\265\153\377\161\344\270"
-  "\366\37\322\246\354\174\251\166\217\342\360\265\214\107\256\301\243\223\31\267\110\203\247\111\144\33\47\252\341\344\41\346"
-  "\246\223\51\366\33\115\136\344\363\366\164\302\252\146\102\242\251\206\311\70\261\211\43\205\237\170\70\305\170\105\353\233"
-  "\70\115\261\76\226\71\53\122\236\320\317\227\301\345\106\47\323\355\235\332\77\263\115\275\237\320\353\111\175\135\266\256"
-  "\27\331\137\270\135\203\52\217\272\215\257\37\1\325\367\361\372\346\230\361\24\173\227\126\162\137\340\72\356\251\6\131"
-  "\243\51\230\60\300\134\272\56\314\313\167\237\7\43\143\321\317\105\362\20\204\243\16\323\212\217\241\141\224\60\247\226"
-  "\225\176\320\275\31\12\265\105\355\10\215\44\76\274\305\27\60\31\107\331\112\360\337\263\171\132\266\247\322\261\13\207"
-  "\227\224\240\37\101\77\334\364\103\124\12\102\345\345\205\302\226\211\363\42\121\25\31\1\371\144\102\251\50\363\375\42"
-  "\3\23\355\67\312\272\32\104\117\136\20\221\245\311\165\204\200\323\302\252\15\31\252\132\166\230\133\102\325\255\346\120"
-  "\322\170\73\57\71\260\346\14\347\246\134\363\166\107\105\353\301\11\244\361\227\265\152\250\124\250\123\174\231\12\372\105"
-  "\167\220\120\302\372\377\276\175\141\303\302\160\323\66\212\45\242\201\7\42\226\220\376\341\155\235\233\224\134\265\233\24"
-  "\57\7\25\204\113\126\36\53\322\50\252\273\236\342\142\207\257\226\204\271\257\374\266\261\345\235\114\66\117\264\313\26"
-  "\171\2\36\161\53\137\373\235\34\106\101\72\21\143\127\110\20\0\203\374\143\354\356\372\363\36\275\40\101\10\62\200"
-  "\30\13\60\0\124\30\244\0\251\141\226\102\232\160\234\261\50\172\110\217\356\274\213\137\127\262\211\227\154\252\5\70"
-  "\172\117\20\14\375\163\51\12\36\276\255\262\31\155\135\15\136\246\103\233\11\275\313\115\156\3\5\222\221\160\247\124"
-  "\133\313\143\325\53\124\53\210\230\276\66\203\244\5\75\163\323\55\5\51\121\104\1\332\43\210\334\246\273\244\201\302"
-  "\31\203\54\157\272\1\342\52\357\370\204\326\237\40\140\1\0\31\63\264\367\201\13\107\351\341\11\202\227\47\267\5"
-  "\175\15\236\320\115\46\44\70\167\72\343\271\10\276\117\357\203\201\374\177\67\116\341\105\356\217\20\27\26\144\74\302"
-  "\345\226\241\62\271\5\254\230\257\121\23\126\372\115\350\235\372\147\152\167\15\203\4\363\43\217\6\374\366\365\31\257"
-  "\272\277\377";
+/* lib/include/ftw.h (DEFLATEd, org. size 1266) */
+static unsigned char file_l_46[576] =
+  "\165\123\115\217\332\60\20\275\43\361\37\106\273\27\210\120\151\267\237\52\125\57\335\256\250\324\122\264\120\125\75\125"
+  "\46\31\203\265\216\35\331\16\37\252\372\337\73\143\7\330\64\54\207\210\144\146\336\274\171\157\146\234\201\124\32\41"
+  "\70\344\207\330\242\363\102\103\66\356\367\372\275\353\312\211\165\51\240\264\105\115\71\127\205\162\150\302\325\71\140\115"
+  "\216\364\246\114\256\353\2\341\203\77\370\261\17\42\74\333\174\344\372\161\6\133\241\153\364\140\45\204\15\65\70\124"
+  "\10\302\255\353\222\160\216\37\163\241\365\112\344\17\261\351\165\201\122\31\204\273\345\317\337\167\100\277\27\0\343\206"
+  "\343\377\361\133\216\337\304\70\63\313\203\165\207\21\70\254\254\13\130\300\12\245\165\10\52\170\310\255\11\324\321\167"
+  "\41\146\367\0\57\333\20\104\112\4\142\145\214\15\4\102\200\242\350\26\316\251\367\253\47\173\13\31\320\265\133\17"
+  "\142\331\347\371\162\72\354\240\315\26\204\366\72\242\261\174\40\5\315\333\155\272\370\112\151\157\122\332\241\134\131\255"
+  "\162\320\312\74\44\354\371\364\327\142\170\241\146\6\360\366\102\115\260\40\300\130\203\173\345\231\341\131\343\13\306\111"
+  "\55\326\276\345\234\221\141\327\151\306\24\210\342\363\175\162\255\260\300\32\112\253\265\335\265\333\167\255\370\366\375\307"
+  "\154\311\265\67\107\35\16\260\123\141\243\114\142\300\354\150\277\2\226\107\122\225\10\233\256\61\254\60\303\44\163\222"
+  "\43\47\217\24\215\224\274\41\0\345\236\136\214\117\323\333\57\367\14\363\56\302\250\265\241\135\52\336\163\31\357\224"
+  "\247\301\40\257\35\337\303\243\315\111\352\371\340\352\74\60\14\374\351\367\0\24\345\254\204\307\111\204\262\122\172\74"
+  "\55\177\34\313\210\222\60\115\173\250\124\247\161\213\172\22\305\304\212\42\16\265\10\152\213\154\37\247\73\153\117\130"
+  "\73\241\323\21\375\235\64\46\266\306\166\315\52\123\43\131\153\175\274\217\2\175\216\246\120\146\315\15\43\152\71\2"
+  "\117\333\21\350\360\175\40\46\104\232\144\71\217\311\45\116\125\364\237\225\260\25\32\116\26\20\24\315\41\114\1\262"
+  "\320\252\124\201\243\215\162\221\27\356\111\171\23\347\342\365\31\220\372\236\56\155\43\34\144\74\367\10\216\143\17\62"
+  "\151\206\255\370\10\322\133\43\156\74\23\372\110\311\43\170\44\170\66\74\203\64\54\106\351\205\67\170\110\302\374\3";
+
+/* lib/crt.args.wbo (DEFLATEd, org. size 940) */
+static unsigned char file_l_47[622] =
+  "\145\221\315\162\323\60\20\307\167\145\45\70\37\155\135\332\246\315\107\251\342\70\63\134\70\264\100\17\345\302\233\170"
+  "\234\104\151\75\44\266\307\126\32\312\20\213\47\340\300\33\345\2\207\276\111\312\1\236\240\254\354\176\34\360\314\112"
+  "\277\377\152\275\253\135\301\162\24\343\320\32\247\252\265\14\262\320\317\242\40\311\256\142\345\47\251\274\16\345\362\324"
+  "\236\116\374\145\32\52\151\7\351\145\346\137\112\265\135\100\26\176\221\205\254\45\151\74\366\345\347\120\125\347\162\36"
+  "\247\67\25\237\2\256\213\165\154\145\211\127\317\124\60\376\344\217\202\114\326\256\144\220\24\124\227\363\104\335\24\221"
+  "\174\222\275\367\150\71\367\232\161\244\144\72\367\247\213\150\234\75\212\161\274\210\124\75\214\102\25\6\63\52\132\221"
+  "\151\32\247\166\264\230\373\211\112\263\362\132\243\305\324\66\312\0\106\45\312\150\122\53\16\215\262\106\211\147\115\311"
+  "\302\123\262\63\262\267\144\357\74\213\262\325\114\235\60\12\224\254\322\125\325\42\143\323\210\235\172\354\314\103\340\234"
+  "\131\134\323\207\232\63\316\312\275\362\260\127\121\303\26\342\13\4\146\241\215\250\161\15\140\141\355\211\352\45\375\350"
+  "\133\330\100\170\304\346\43\62\334\2\344\66\260\25\156\303\127\140\264\2\42\20\354\20\174\300\320\114\40\12\146\242"
+  "\150\371\102\54\242\140\64\223\102\305\42\225\52\15\345\265\24\343\170\76\17\242\311\233\131\30\111\101\335\56\346\62"
+  "\122\131\335\344\160\20\371\267\42\333\56\21\7\340\370\222\344\167\314\367\164\276\257\363\3\235\267\164\176\250\363\43"
+  "\235\267\165\336\321\171\127\347\75\235\37\353\374\225\316\117\364\0\353\156\147\15\342\16\334\223\176\167\200\66\265\364"
+  "\13\370\107\321\361\260\276\123\141\102\164\105\167\15\174\3\342\204\74\16\253\270\173\153\270\277\267\376\102\21\271\105"
+  "\1\257\201\21\377\174\146\334\200\273\377\340\32\140\303\75\40\77\147\344\154\255\301\371\3\356\41\235\335\232\42\106"
+  "\213\303\73\330\100\277\325\0\321\22\364\27\377\115\322\75\32\140\363\326\144\154\271\155\161\340\60\376\137\331\366\103"
+  "\261\62\276\107\356\163\140\242\355\241\135\34\170\130\53\173\150\10\312\114\55\330\24\165\274\242\241\233\260\122\27\175"
+  "\271\257\326\160\161\156\62\75\273\321\220\263\1\207\131\235\25\275\237\147\346\202\117\51\71\366\351\315\241\237\273\72"
+  "\37\230\161\62\317\32\256\160\27\312\111\230\326\126\350\200\361\270\75\321\53\147\162\127\24\356\75\337\231\310\35\354"
+  "\2\64\207\15\150\14\33\236\160\35\126\335\371\7";
+
+/* lib/crt.argv.wbo (DEFLATEd, org. size 936) */
+static unsigned char file_l_48[612] =
+  "\145\121\113\122\333\100\20\355\36\215\377\66\210\204\257\261\141\54\13\127\66\131\360\51\26\144\223\233\250\144\171\14"
+  "\252\130\237\222\306\70\244\142\211\63\344\106\336\44\213\334\4\262\311\11\110\153\204\361\42\252\352\231\367\336\364\274"
+  "\351\156\301\142\34\341\310\360\22\265\277\160\123\337\111\103\67\116\357\42\345\304\211\274\367\345\342\274\76\235\70\213"
+  "\304\127\262\356\46\267\251\163\53\325\226\6\251\377\115\152\332\210\223\310\163\344\127\137\125\123\65\231\371\343\252\347"
+  "\316\146\221\307\247\211\224\325\100\343\152\40\203\50\171\250\70\164\365\136\257\236\221\306\166\63\125\256\367\305\31\273"
+  "\251\154\334\111\67\326\250\51\203\130\75\350\114\76\111\57\155\132\256\354\166\24\52\231\4\316\164\36\172\351\232\170"
+  "\321\74\124\115\77\364\225\357\316\250\234\212\114\222\50\251\207\363\300\211\125\222\226\5\217\347\323\206\6\205\144\214"
+  "\143\333\230\122\370\347\24\27\24\227\24\127\266\101\67\33\205\247\37\272\112\122\37\256\232\247\154\32\262\163\233\135"
+  "\330\10\65\316\14\236\323\207\71\147\234\225\173\345\165\257\142\16\274\126\57\131\255\241\131\23\211\164\20\133\10\314"
+  "\300\66\22\135\1\30\330\171\103\133\45\372\61\60\160\33\141\15\315\65\144\270\3\310\353\300\226\370\16\276\3\243"
+  "\25\20\201\300\173\2\237\320\57\106\20\272\63\241\173\276\21\363\320\35\317\244\120\221\110\244\112\174\171\57\205\27"
+  "\5\201\33\116\76\316\374\120\12\32\301\74\220\241\112\233\205\307\56\42\177\324\156\173\204\70\0\307\175\242\217\230"
+  "\35\344\331\141\236\35\345\131\67\317\216\363\254\227\147\375\74\73\311\263\323\74\23\371\20\267\254\343\25\210\147\260"
+  "\304\240\67\304\66\165\362\13\370\147\161\154\343\326\166\205\15\104\117\364\126\300\237\100\10\122\114\126\261\16\126\360"
+  "\362\142\374\5\235\331\241\204\17\300\10\377\334\140\174\2\353\160\43\161\146\326\232\326\321\132\240\23\156\326\352\126"
+  "\127\13\364\324\221\131\153\264\7\55\20\135\202\214\377\367\100\367\325\226\377\1\62\356\223\174\15\114\164\155\154\353"
+  "\3\33\73\145\265\255\302\203\212\255\123\326\311\222\246\132\244\225\134\167\140\235\256\340\346\272\160\332\310\130\40\363"
+  "\11\114\146\164\227\364\203\354\142\2\370\146\311\321\242\237\12\203\154\230\147\166\61\70\166\146\214\226\270\7\145\317"
+  "\277\251\374\45\356\102\241\130\175\321\57\273\177\326\17\367\67\65\23\262\354\35\200\366\250\5\255\121\353\114\14\115"
+  "\126\335\376\7";
+
+/* lib/crt.void.wbo (DEFLATEd, org. size 361) */
+static unsigned char file_l_49[269] =
+  "\65\214\301\116\302\100\24\105\357\233\31\220\322\152\51\115\134\3\351\302\55\56\134\373\47\315\120\7\231\50\323\246"
+  "\63\200\32\241\176\203\177\304\332\77\21\77\302\151\225\344\345\345\334\373\336\275\330\55\112\112\171\121\273\353\235\264"
+  "\72\267\106\126\166\125\272\274\252\325\126\253\335\74\250\352\262\310\325\213\166\375\265\132\227\365\153\57\227\365\143\301"
+  "\155\225\15\255\223\305\123\276\220\126\5\53\45\253\216\272\363\126\74\330\171\26\225\306\251\172\235\57\67\246\260\147"
+  "\121\224\33\343\206\332\150\247\345\263\176\123\101\353\152\43\235\352\373\72\267\261\154\151\270\236\147\314\317\155\106\40"
+  "\301\70\65\10\211\4\301\143\217\250\241\43\210\123\377\217\76\247\234\56\10\147\34\234\221\121\340\63\3\260\75\15"
+  "\361\16\346\67\210\340\241\355\372\350\50\362\44\0\101\227\136\122\54\350\312\167\142\172\210\233\303\250\71\44\15\33"
+  "\363\164\117\21\156\300\216\300\27\304\375\236\102\264\316\54\231\44\235\113\47\334\201\375\13\361\203\357\366\171\66\112"
+  "\200\50\15\21\246\341\170\22\217\30\217\177\1";
+
+/* lib/crt.wbo (DEFLATEd, org. size 85) */
+static unsigned char file_l_50[71] =
+  "\143\50\117\312\147\144\145\116\56\52\141\313\115\315\315\57\252\144\56\56\120\341\52\56\111\114\316\216\117\112\54\116"
+  "\345\314\110\115\54\0\263\30\31\30\130\30\31\231\30\31\230\230\31\231\31\31\353\31\17\62\114\122\144\146\144\141"
+  "\144\200\61\131\141\114\0";
+
+/* lib/ctype.wbo (DEFLATEd, org. size 731) */
+static unsigned char file_l_51[331] =
+  "\145\221\273\122\303\60\20\105\127\361\333\171\22\122\121\271\340\3\370\43\306\21\236\104\203\37\32\133\231\220\6\363"
+  "\153\56\342\12\370\0\72\32\32\252\120\122\144\220\327\126\154\15\325\135\355\271\272\273\32\301\176\235\221\225\105\305"
+  "\201\107\6\315\205\121\360\133\73\211\222\54\77\70\254\10\343\164\227\20\212\25\337\206\122\37\330\206\11\251\161\266"
+  "\217\162\251\73\316\121\151\52\362\130\52\317\131\332\360\115\36\362\255\324\202\207\64\152\372\273\224\12\227\25\117\52"
+  "\40\54\50\143\122\327\161\230\76\72\42\153\203\104\206\301\4\106\306\310\40\45\31\231\0\163\223\130\104\326\245\377"
+  "\154\227\201\275\40\216\131\126\100\254\246\164\307\15\166\64\354\365\330\107\74\106\154\165\170\162\154\172\56\366\34\354"
+  "\125\160\367\15\25\170\157\15\230\42\30\53\263\211\62\73\202\125\1\140\232\207\206\111\167\363\23\336\301\304\352\27"
+  "\136\173\323\104\63\5\312\163\36\172\346\350\131\352\223\54\65\351\377\340\31\372\157\124\146\15\352\235\25\370\65\336"
+  "\120\107\117\77\116\353\66\300\327\226\252\56\233\177\14\267\132\240\51\350\266\162\373\224\376\245\137\27\377\160\112\237"
+  "\127\17\270\114\274\302\104\273\33\373\122\236\0\177\140\251\155\343\15\237\23\164\13\137\153\177\341\265\351\367\47\220"
+  "\46\344\53\215\373\55\17\176\72\376\7";
+
+/* lib/dirent.wbo (DEFLATEd, org. size 5475) */
+static unsigned char file_l_52[2720] =
+  "\215\130\335\167\23\307\25\337\331\135\111\66\222\100\70\4\34\33\314\254\244\200\10\46\310\106\266\144\233\204\220\17"
+  "\314\127\10\1\132\76\32\60\53\151\205\25\144\111\326\312\26\16\315\14\17\171\151\377\221\276\44\377\102\17\356\71"
+  "\174\225\236\236\226\207\236\76\366\331\344\45\157\175\243\367\336\231\225\204\217\41\75\260\263\73\163\357\334\357\373\233"
+  "\221\215\116\261\301\276\17\227\253\55\257\336\266\112\255\266\345\67\323\341\45\157\251\321\132\333\335\161\375\352\202\137"
+  "\167\233\376\142\243\275\320\154\171\253\125\257\63\261\255\122\136\150\171\156\31\366\204\375\166\253\132\277\203\374\245\346"
+  "\132\4\146\245\106\255\106\323\105\42\326\274\172\310\153\265\352\15\230\224\153\325\242\135\151\171\136\170\311\255\325\32"
+  "\245\10\10\301\167\150\331\157\264\332\241\112\251\336\256\205\33\115\257\356\266\143\225\152\35\225\324\232\156\173\61\274"
+  "\122\257\302\356\120\251\326\360\75\333\157\273\355\120\15\307\301\112\31\271\301\14\263\122\266\341\325\104\125\215\226\125"
+  "\235\110\133\325\111\170\162\360\34\203\147\12\236\151\170\362\360\24\340\231\111\333\325\211\54\16\23\70\114\246\301\45"
+  "\222\16\102\6\265\114\320\2\143\245\34\201\261\356\56\171\341\226\347\257\324\332\21\115\266\212\315\264\125\151\246\7"
+  "\202\175\21\35\222\150\161\245\122\361\132\13\65\257\322\36\250\173\235\5\277\372\235\267\15\77\24\141\33\304\271\265"
+  "\106\253\166\227\204\37\251\351\130\217\53\225\267\121\151\217\70\23\357\43\116\144\301\352\143\150\172\16\207\51\34\362"
+  "\70\114\343\120\300\1\135\234\104\27\47\321\305\311\311\264\11\377\47\322\346\261\164\14\15\135\100\53\252\236\157\346"
+  "\322\346\124\332\234\116\233\371\264\131\110\233\63\351\210\357\171\167\101\117\270\324\150\334\255\172\126\263\341\263\322\140"
+  "\313\353\100\106\320\115\44\243\377\230\300\266\127\303\4\262\272\15\243\117\123\214\240\137\162\125\4\55\30\7\320\217"
+  "\32\44\320\362\275\32\10\135\152\272\255\210\52\67\77\246\337\344\142\167\262\2\361\144\325\201\106\255\114\225\143\227"
+  "\32\315\265\50\172\257\31\254\242\133\216\150\35\341\112\265\326\366\132\203\156\255\271\350\142\31\61\227\25\267\201\246"
+  "\205\172\243\334\150\373\146\331\33\354\270\265\273\13\130\110\146\263\143\101\101\332\105\327\367\102\65\157\325\253\331\355"
+  "\265\246\147\101\146\303\376\112\21\110\21\62\26\130\220\335\256\127\332\35\263\122\217\124\240\162\227\252\120\241\65\367"
+  "\216\317\214\41\313\264\230\144\246\155\30\360\145\110\73\24\16\111\51\205\144\322\216\14\130\360\211\37\203\246\172\157"
+  "\13\26\242\260\107\132\261\30\154\210\157\147\322\260\343\73\160\305\216\47\24\147\174\247\15\234\260\76\364\216\336\62"
+  "\264\113\121\336\335\115\214\173\366\250\351\236\141\172\17\331\354\75\206\204\77\60\61\42\305\250\24\173\245\330\47\305"
+  "\230\24\373\245\340\122\70\122\44\245\110\111\221\226\342\175\51\16\110\161\120\212\214\134\67\36\32\211\370\216\344\350"
+  "\272\141\74\66\354\117\340\265\43\152\160\230\356\335\60\222\373\326\215\7\34\310\323\206\311\107\63\173\115\315\304\107"
+  "\23\361\355\232\163\104\23\36\160\130\370\211\341\316\314\206\221\10\205\223\173\327\215\127\257\254\137\14\130\177\102\233"
+  "\200\17\366\321\146\36\20\323\261\130\240\62\71\306\107\110\321\272\61\0\272\367\343\107\2\76\224\340\274\141\161\176"
+  "\310\260\360\15\204\141\40\70\100\230\65\310\130\16\323\44\114\365\376\64\114\123\150\223\236\217\303\74\335\43\147\141"
+  "\372\376\272\301\364\64\7\323\3\75\152\1\246\7\173\324\343\60\315\4\324\35\66\73\104\141\36\302\20\217\110\160"
+  "\312\60\235\221\236\157\231\161\375\316\365\174\35\201\135\37\60\112\323\250\70\54\305\70\356\24\107\44\77\314\307\327"
+  "\215\37\36\102\210\207\336\111\216\254\33\262\57\3\43\11\366\136\362\110\20\360\221\304\273\273\107\140\365\10\210\372"
+  "\220\14\110\242\30\20\166\124\212\54\146\72\145\132\311\243\20\260\227\220\65\47\313\307\171\226\357\113\233\126\142\150"
+  "\127\362\160\127\362\337\164\274\371\121\40\241\226\303\74\13\16\44\330\7\152\305\146\207\111\270\15\336\221\153\260\62"
+  "\101\53\41\132\111\260\103\140\10\54\116\322\342\337\55\214\302\61\51\162\122\114\111\61\55\105\136\212\202\24\63\122"
+  "\314\112\61\47\305\161\51\30\125\142\140\45\326\43\247\222\174\103\75\212\217\244\370\130\212\23\122\174\42\305\111\51"
+  "\76\225\342\63\51\76\227\342\13\51\116\5\116\162\160\362\224\223\65\347\255\323\340\114\174\336\74\303\107\217\14\33"
+  "\217\300\107\363\54\330\235\301\152\345\46\160\35\203\112\171\246\212\217\26\323\346\63\25\342\156\4\160\15\52\345\101"
+  "\102\263\245\115\275\144\376\154\164\227\234\234\171\316\72\317\163\233\110\71\372\164\162\261\363\121\43\172\76\172\216\312"
+  "\0\270\116\141\340\343\211\344\124\267\251\262\233\342\36\364\27\237\352\253\330\61\236\203\31\210\62\142\147\201\47\233"
+  "\344\112\40\372\262\1\155\64\374\307\377\132\60\102\312\22\60\167\246\351\243\333\222\252\11\366\363\375\220\66\76\275"
+  "\201\365\32\73\3\142\216\361\351\256\37\311\174\317\325\274\62\76\257\143\300\247\171\36\237\347\306\150\317\355\202\371"
+  "\245\165\201\27\66\323\12\152\153\41\166\1\214\275\20\375\122\231\131\350\372\75\363\153\176\73\174\246\317\357\44\57"
+  "\220\337\344\365\353\36\3\165\26\367\243\247\112\174\144\133\27\117\224\307\51\236\332\344\361\150\46\13\141\31\324\161"
+  "\202\116\336\10\62\231\65\235\71\363\53\353\42\237\333\212\76\247\334\232\213\135\4\267\56\106\277\242\156\346\163\350"
+  "\321\361\267\171\104\350\302\217\367\203\13\237\43\217\110\102\222\45\17\360\354\241\1\202\56\246\300\355\40\317\36\331"
+  "\105\340\5\13\203\210\60\174\226\354\201\24\353\45\155\136\362\243\36\312\341\316\217\101\124\27\5\321\377\23\374\104"
+  "\317\177\316\264\141\147\225\151\0\305\311\156\244\116\122\122\221\353\44\354\320\346\42\302\176\312\107\265\171\32\131\77"
+  "\13\164\146\64\360\353\306\0\56\55\125\45\143\13\224\357\3\366\100\332\347\20\142\220\26\233\217\166\261\372\13\5"
+  "\250\321\63\261\323\321\323\321\371\156\100\155\366\265\141\42\150\134\103\144\271\44\304\145\51\256\210\176\354\0\10\40"
+  "\0\160\262\260\311\271\14\66\45\54\347\12\365\177\200\235\346\151\153\236\137\341\227\136\164\33\377\362\113\103\3\201"
+  "\106\327\54\264\36\371\165\71\150\254\176\106\35\372\76\376\313\275\325\15\324\212\71\160\256\240\107\321\371\350\351\300"
+  "\253\61\176\271\357\0\343\374\22\204\24\174\7\257\176\3\170\151\14\243\117\344\7\262\300\231\226\140\137\77\322\225"
+  "\74\240\116\133\175\320\351\300\215\251\300\105\15\220\360\133\74\100\214\34\212\270\112\221\121\202\256\376\304\234\113\374"
+  "\52\40\374\123\303\206\323\134\360\253\57\61\157\307\1\350\102\353\270\227\142\220\63\65\11\64\375\14\56\240\371\227"
+  "\60\35\374\322\146\43\310\352\255\54\270\146\40\346\327\321\202\353\204\364\67\136\103\164\122\232\274\16\72\237\203\45"
+  "\244\223\303\214\365\353\244\12\372\147\327\60\260\232\137\177\251\116\177\62\21\173\14\234\140\41\176\35\126\12\346\343"
+  "\176\373\65\61\21\102\261\320\250\121\0\57\245\46\117\32\260\117\157\154\352\123\251\133\64\107\236\335\350\73\341\307"
+  "\170\76\150\121\145\50\331\210\220\333\153\205\343\4\250\327\11\41\200\31\103\210\346\332\354\167\164\374\155\247\63\21"
+  "\330\377\2\45\377\352\125\344\137\352\152\304\256\221\122\130\377\23\246\376\33\206\367\101\74\374\377\314\360\300\276\51"
+  "\305\55\51\26\244\270\55\205\113\347\143\121\212\222\24\145\51\74\272\270\101\144\53\122\334\351\5\27\13\335\305\241"
+  "\210\103\51\25\213\71\36\234\334\67\341\330\356\273\267\241\253\346\42\114\301\161\352\0\260\144\62\311\202\276\134\120"
+  "\37\22\20\142\141\47\132\377\110\247\41\76\217\130\250\60\47\21\211\152\100\114\346\361\126\130\41\351\361\105\136\201"
+  "\350\61\236\307\76\51\361\42\35\70\140\314\300\63\312\310\100\10\47\52\43\105\356\342\304\126\351\270\23\234\116\25"
+  "\270\7\305\26\41\54\167\34\27\106\27\244\224\110\217\123\42\146\112\110\5\1\134\267\124\212\120\366\11\352\366\10"
+  "\112\22\154\142\204\337\16\274\161\161\273\315\157\47\342\73\101\334\55\110\233\213\271\55\355\210\56\252\235\275\42\200"
+  "\250\234\303\270\225\255\63\274\314\113\317\340\232\20\77\147\236\7\21\145\255\32\157\100\361\355\321\363\270\200\46\225"
+  "\341\24\71\3\247\271\253\156\160\240\30\243\153\263\52\263\125\42\63\72\211\337\122\22\337\174\11\273\371\266\113\230"
+  "\334\164\11\343\267\370\267\340\20\373\46\100\302\273\352\312\30\23\65\51\226\44\257\145\260\2\361\140\130\12\276\22"
+  "\221\101\340\253\123\137\246\104\3\157\135\274\241\316\223\331\161\3\22\371\41\266\14\237\35\147\106\177\157\251\171\100"
+  "\63\25\115\25\103\124\277\37\141\225\67\15\355\357\217\226\130\226\242\45\205\57\105\133\212\25\2\0\250\327\125\272"
+  "\347\165\244\270\107\125\273\366\177\335\363\164\214\376\143\100\220\16\44\1\305\377\155\150\354\243\26\63\34\204\20\147"
+  "\225\57\323\345\206\375\202\126\56\143\174\262\374\0\306\162\317\160\350\365\371\236\150\367\360\351\356\171\324\333\5\33"
+  "\372\34\204\345\154\146\30\157\174\17\351\320\172\360\320\174\334\207\107\21\147\5\46\41\147\5\2\261\211\361\1\123"
+  "\351\63\201\145\13\31\110\12\323\156\206\273\361\237\66\307\44\27\126\100\354\223\36\44\267\203\316\130\126\260\73\26"
+  "\34\353\41\372\340\313\0\37\57\136\277\252\222\110\210\327\77\24\116\371\130\360\172\12\205\114\120\325\306\65\320\144"
+  "\352\150\120\224\126\2\56\130\330\145\356\324\71\355\126\237\342\122\151\170\301\130\35\64\46\130\225\200\374\151\117\312"
+  "\72\330\364\53\142\320\127\233\102\337\333\144\156\271\311\131\205\246\234\127\115\171\32\232\362\372\123\154\112\274\306\257"
+  "\6\141\311\146\256\231\375\15\112\125\355\314\362\226\323\341\263\0\123\316\75\336\11\216\32\122\326\241\243\146\303\240"
+  "\272\77\332\27\151\105\45\72\110\350\250\337\215\107\351\120\203\345\173\32\357\200\315\66\237\53\176\133\135\361\373\250"
+  "\132\215\46\204\372\50\164\10\221\212\74\2\336\332\346\363\307\131\205\152\205\33\356\32\146\146\131\345\51\245\217\36"
+  "\60\240\353\257\262\222\56\222\263\374\36\211\106\260\135\126\252\140\154\323\132\202\65\251\65\200\271\245\176\304\32\263"
+  "\206\256\214\115\21\103\110\73\323\203\64\272\147\21\23\242\232\326\53\173\151\173\75\136\131\104\327\67\245\216\257\6"
+  "\20\365\135\200\210\367\261\371\357\113\361\173\51\276\17\220\142\365\155\160\320\367\113\56\5\110\271\306\123\164\271\217"
+  "\72\55\322\115\307\165\13\132\313\124\327\332\54\66\10\304\137\377\55\42\113\25\361\172\244\273\225\210\104\350\217\65"
+  "\334\257\302\150\316\103\335\370\120\152\76\154\372\53\272\275\206\237\133\324\213\52\103\210\233\42\73\176\20\67\375\67"
+  "\11\140\372\221\156\150\131\165\163\166\370\367\272\15\167\321\17\231\373\64\343\55\322\244\222\225\125\271\10\202\366\77";
+
+/* lib/errno.wbo (DEFLATEd, org. size 3437) */
+static unsigned char file_l_53[1761] =
+  "\145\126\73\160\34\307\21\355\1\110\211\244\110\361\377\21\305\317\212\2\45\212\42\105\362\276\40\105\111\44\1\122"
+  "\204\104\2\20\304\162\71\160\225\275\267\67\7\154\161\157\347\274\37\200\127\65\133\162\340\300\201\3\5\12\134\56"
+  "\5\12\24\70\160\340\100\201\3\7\16\34\70\120\240\100\201\2\5\12\34\70\120\240\300\201\3\7\176\363\366\156"
+  "\201\3\120\205\171\250\351\176\63\323\335\257\173\41\33\35\243\126\166\353\44\211\315\164\220\144\323\351\140\346\271\276"
+  "\356\233\144\270\373\227\272\237\256\356\352\246\265\31\54\165\267\64\334\322\164\113\313\55\155\267\314\272\345\346\314\356"
+  "\156\172\343\72\327\33\134\153\134\353\134\33\134\233\134\133\134\333\134\147\271\222\133\43\267\106\156\215\334\32\271\65"
+  "\162\153\344\326\310\255\221\133\43\267\106\156\235\334\72\271\165\162\353\344\326\311\255\223\133\47\267\116\156\235\334\72"
+  "\271\15\162\33\344\66\310\155\220\333\40\267\101\156\203\334\6\271\15\162\33\344\66\311\155\222\333\44\267\111\156\223"
+  "\334\46\271\115\162\233\344\66\311\155\222\333\42\267\105\156\213\334\26\271\55\162\133\344\266\310\155\221\333\42\267\105"
+  "\156\233\334\66\271\155\162\333\344\266\311\155\223\333\46\267\115\156\173\166\106\311\324\364\324\264\372\104\115\355\22\131"
+  "\232\126\370\371\104\246\324\156\245\166\175\65\45\177\124\205\172\116\254\24\352\171\261\273\12\265\107\354\236\102\355\25"
+  "\273\277\120\373\304\36\52\324\13\142\217\25\152\277\330\123\205\72\40\366\114\241\136\24\353\25\352\240\330\231\102\35"
+  "\22\173\251\120\207\305\136\51\324\21\261\327\13\165\124\154\243\120\307\304\316\26\352\270\330\333\205\72\41\366\116\241"
+  "\116\212\235\57\324\51\261\17\13\365\222\330\107\205\72\55\166\271\120\57\213\175\122\250\63\142\177\136\250\263\142\177"
+  "\121\250\163\142\177\125\250\363\142\273\205\362\304\256\25\352\25\261\121\241\56\210\35\24\352\125\261\131\241\146\304\76"
+  "\53\324\105\261\266\120\257\211\375\15\302\170\135\354\157\1\227\304\376\16\360\206\330\337\3\56\213\375\24\360\246\330"
+  "\317\0\127\304\376\1\160\125\354\347\200\267\304\176\1\270\46\366\113\300\165\261\177\2\334\20\373\147\100\115\354\137"
+  "\0\165\261\137\1\32\142\377\12\150\212\375\33\240\45\366\357\200\266\330\177\0\146\305\376\23\160\123\354\327\200\133"
+  "\142\277\1\274\55\366\133\300\155\261\337\1\336\21\373\75\340\135\261\77\0\336\23\373\57\300\35\261\377\6\334\25"
+  "\373\43\340\236\330\237\0\163\142\377\3\230\27\373\137\300\175\261\377\3\74\100\174\123\205\172\37\361\1\36\42\76"
+  "\300\2\342\3\174\200\370\0\37\42\76\300\43\304\7\170\214\370\0\213\210\17\260\204\370\0\313\210\17\360\21\342"
+  "\3\254\40\276\251\51\224\136\324\21\265\150\74\114\1\223\170\46\10\362\44\321\135\201\100\236\207\351\244\272\233\254"
+  "\346\175\35\147\136\24\246\231\227\31\343\105\46\136\165\366\75\244\56\353\244\37\246\151\150\142\257\253\343\260\244\356"
+  "\205\351\240\272\333\355\46\72\115\275\60\366\362\124\273\375\175\330\77\121\355\307\46\363\374\165\77\214\374\116\104\363"
+  "\13\60\237\255\314\75\277\37\106\103\172\245\371\140\140\222\254\74\174\77\274\256\251\25\235\232\74\11\264\227\307\325"
+  "\31\127\74\27\302\100\47\176\346\336\263\141\362\250\353\165\42\23\74\165\274\3\340\235\127\163\46\216\165\100\273\37"
+  "\45\332\357\16\335\373\6\211\131\165\227\72\277\27\341\167\114\335\363\273\136\57\214\64\242\112\203\44\34\144\46\161"
+  "\306\203\60\356\247\261\17\167\177\225\357\76\204\315\123\152\136\257\207\170\17\236\220\214\337\326\311\323\241\163\70\14"
+  "\207\243\152\251\172\131\340\307\201\216\312\160\216\320\206\12\4\153\41\236\213\227\4\70\131\363\51\107\151\333\372\344"
+  "\116\225\206\143\333\155\211\356\41\315\264\35\207\355\360\244\55\325\231\263\234\200\345\334\146\362\272\110\200\313\317\50"
+  "\127\54\277\163\73\311\112\314\353\64\13\343\362\311\376\250\52\211\376\165\36\216\24\162\212\225\170\354\147\153\272\17"
+  "\257\40\365\374\261\132\114\216\337\236\327\65\175\37\351\305\137\275\74\346\123\34\357\45\360\366\272\107\350\144\275\74"
+  "\351\64\323\372\300\345\133\77\203\320\30\375\313\125\256\107\227\273\315\63\224\26\75\51\106\334\310\32\234\145\325\36"
+  "\32\210\64\114\41\12\224\66\130\33\13\353\34\163\265\0\201\146\141\57\324\256\102\175\63\272\372\74\65\271\20\105"
+  "\172\325\217\274\316\60\323\136\212\30\65\52\344\314\36\315\233\245\333\46\226\127\140\76\256\26\342\14\375\223\17\120"
+  "\232\211\100\57\260\16\13\361\272\37\205\335\52\71\316\362\52\54\373\324\302\265\245\262\361\334\326\14\43\370\30\325"
+  "\320\214\41\50\313\127\276\362\42\303\136\100\206\275\56\322\37\100\216\124\326\153\330\277\240\236\40\23\175\77\36\172"
+  "\221\136\327\121\352\362\235\16\373\35\23\205\1\372\66\176\312\247\276\16\127\257\314\334\246\246\75\74\55\337\226\312"
+  "\113\274\153\363\314\361\1\157\260\341\37\227\272\237\244\134\336\121\321\67\351\354\156\213\375\276\236\30\34\127\140\72"
+  "\244\26\165\266\141\222\247\56\322\256\331\140\272\256\122\234\73\345\216\252\170\161\351\356\334\336\142\242\306\374\155\245"
+  "\276\306\63\252\307\273\26\116\335\114\140\345\322\141\232\351\276\163\273\16\267\323\256\353\72\171\257\7\101\244\3\37"
+  "\355\60\61\215\156\60\15\160\111\363\140\15\51\163\335\355\366\153\143\52\367\71\43\220\307\211\252\324\331\76\367\237"
+  "\351\40\317\334\161\245\127\317\44\150\223\315\202\67\306\235\357\72\60\235\274\274\271\43\241\55\152\151\21\323\120\307"
+  "\46\137\135\53\237\354\54\155\16\66\234\63\32\111\256\374\150\111\127\145\327\251\136\66\34\320\157\226\3\175\71\61"
+  "\231\11\114\264\163\374\336\344\30\163\201\61\31\221\356\241\207\343\55\221\337\342\1\17\106\2\337\71\231\337\206\375"
+  "\214\172\202\253\323\112\305\316\151\102\311\267\341\124\143\34\133\244\354\62\350\117\152\26\222\331\56\366\167\130\370\371"
+  "\212\344\316\326\375\101\106\343\273\154\324\217\63\37\15\354\14\160\102\213\47\343\340\336\203\371\300\350\332\362\165\156"
+  "\367\16\166\33\334\255\2\331\366\21\231\10\322\245\143\223\174\27\344\31\164\267\77\300\104\30\44\241\273\331\165\64"
+  "\302\315\22\44\270\72\304\71\337\233\120\115\267\372\126\154\31\155\163\160\271\254\176\66\331\220\56\15\35\44\24\1"
+  "\343\176\150\270\353\147\176\125\322\171\146\144\71\301\161\46\207\316\67\142\355\244\130\146\372\76\353\271\64\21\312\300"
+  "\175\256\263\121\51\36\224\3\66\61\117\321\36\203\260\74\362\175\312\276\122\111\245\326\207\73\325\63\121\374\5\252"
+  "\260\262\157\44\350\166\276\323\351\176\113\326\76\240\216\241\354\74\312\46\207\310\207\254\340\12\76\111\127\115\34\225"
+  "\275\273\245\145\37\261\202\343\141\232\152\315\141\360\270\34\46\243\274\216\276\236\316\260\270\243\203\226\70\253\267\214"
+  "\227\54\354\273\232\346\174\327\162\71\365\364\263\254\274\170\374\355\376\210\203\154\56\61\151\172\165\124\66\47\117\147"
+  "\132\201\351\42\332\74\323\261\373\7\350\226\67\347\17\374\116\30\205\131\250\335\277\75\51\146\113\30\204\34\371\377"
+  "\7";
+
+/* lib/fcntl.wbo (DEFLATEd, org. size 3428) */
+static unsigned char file_l_54[1786] =
+  "\225\126\113\157\33\107\22\356\356\231\241\51\223\224\106\266\145\313\262\142\367\14\207\242\31\311\17\322\222\34\313\172"
+  "\46\122\374\210\23\331\161\162\46\106\344\120\32\204\217\1\147\344\307\2\356\26\222\0\13\354\257\330\323\236\366\266"
+  "\327\75\210\1\142\37\222\123\162\335\137\220\344\260\136\140\201\275\354\172\253\273\147\110\321\116\202\104\202\324\135\135"
+  "\325\125\137\125\175\325\44\172\274\323\301\237\32\215\132\73\152\152\265\156\244\205\201\223\152\171\255\116\367\351\351\307"
+  "\156\350\127\303\266\33\204\173\235\250\32\164\275\107\276\367\270\74\322\250\127\335\372\43\77\364\62\142\327\154\166\152"
+  "\156\344\345\140\337\250\207\221\33\125\167\275\350\344\100\12\275\250\332\150\272\273\341\50\234\201\217\243\46\211\130\367"
+  "\273\325\266\333\362\106\2\67\332\253\166\2\257\235\12\243\172\323\337\111\325\244\177\275\321\365\274\124\113\356\101\323"
+  "\365\333\273\2\143\55\170\52\227\126\40\16\233\136\333\360\272\335\166\107\10\365\375\40\15\336\205\253\60\333\336\157"
+  "\125\23\301\214\67\325\232\33\270\65\77\172\172\42\321\124\203\116\260\337\204\124\352\231\304\46\364\2\243\36\226\257"
+  "\72\143\0\324\377\203\327\367\62\12\260\273\121\337\107\266\323\254\17\204\266\367\170\130\63\0\2\232\104\320\374\262"
+  "\63\52\162\11\304\121\303\177\342\205\272\110\237\224\35\122\161\46\272\336\256\37\106\136\67\261\367\104\101\111\243\76"
+  "\322\365\232\312\76\245\26\22\4\232\137\161\306\23\364\203\0\135\57\322\166\2\107\153\4\16\271\346\214\52\363\152"
+  "\313\215\152\173\136\170\74\26\241\152\330\327\233\156\30\145\33\176\33\372\271\23\12\24\307\141\215\161\345\40\242\33"
+  "\371\217\300\63\50\106\344\175\161\115\3\265\6\153\272\326\151\5\373\120\66\62\357\220\5\207\54\72\344\272\243\234"
+  "\11\254\160\47\45\360\270\121\252\43\171\240\265\334\47\242\121\235\156\266\331\351\174\266\37\50\172\244\33\141\302\223"
+  "\260\332\365\167\367\242\260\272\343\206\336\251\201\350\267\367\274\256\37\101\367\165\341\321\0\332\64\352\132\255\125\327"
+  "\134\110\321\15\14\171\377\230\364\235\137\314\5\235\20\22\154\50\256\102\360\6\120\61\45\244\232\67\226\350\142\366"
+  "\142\164\102\43\32\346\230\350\10\301\16\161\335\110\351\234\61\216\141\167\114\203\235\330\244\11\227\7\43\361\172\74"
+  "\136\63\32\127\233\354\10\27\77\160\117\210\271\121\245\317\215\141\216\364\234\211\205\60\176\42\66\36\77\231\154\116"
+  "\11\205\66\61\1\121\307\117\213\375\11\15\237\101\160\107\303\223\152\71\253\226\51\265\234\203\5\367\320\25\202\247"
+  "\21\302\4\137\106\110\307\157\301\226\137\141\347\71\273\300\31\345\314\342\314\346\54\317\173\110\267\316\347\361\131\373"
+  "\102\17\241\347\110\347\364\274\101\141\117\176\102\31\144\321\74\76\143\131\75\224\246\324\314\215\332\266\262\131\357\41"
+  "\76\226\101\324\266\363\324\312\343\111\320\377\204\376\364\37\215\332\16\76\103\251\203\317\122\313\314\215\201\361\230\216"
+  "\35\201\206\157\260\2\47\63\132\261\207\260\276\116\13\163\10\345\361\71\341\212\26\150\1\16\177\100\126\141\312\220"
+  "\212\36\272\54\161\24\346\260\62\62\300\121\106\232\2\54\141\370\246\235\304\65\260\73\342\62\73\223\101\342\67\133"
+  "\204\377\305\314\14\55\0\246\213\110\126\376\32\53\161\366\66\147\263\234\315\211\132\260\113\34\262\201\142\10\277\46"
+  "\176\13\374\275\350\173\215\163\176\333\304\216\71\176\332\236\35\52\5\224\111\336\234\224\161\235\270\44\77\40\173\16"
+  "\112\64\273\210\10\235\203\102\203\174\211\226\100\122\225\271\54\132\362\107\54\100\134\221\40\256\162\126\116\160\20\315"
+  "\276\332\103\346\217\160\305\52\347\361\224\210\204\350\125\207\150\20\16\242\70\170\212\100\65\65\253\244\315\320\222\104"
+  "\372\65\312\25\111\205\226\150\231\136\2\73\323\70\156\137\351\241\127\257\264\227\160\41\375\34\264\164\40\203\275\160"
+  "\211\23\227\264\174\11\241\70\47\132\276\250\23\231\211\231\63\355\331\257\245\45\351\133\226\350\254\264\60\215\214\375"
+  "\206\103\255\157\246\214\40\347\74\50\227\0\274\362\212\276\21\115\233\115\142\374\10\125\222\315\374\307\221\16\12\311"
+  "\301\347\124\54\23\137\234\202\377\71\360\231\251\210\124\105\147\113\320\327\231\114\261\137\23\35\137\103\152\136\356\211"
+  "\112\316\163\340\33\133\340\154\221\47\144\173\41\302\316\17\21\5\134\11\240\5\100\63\157\216\237\354\347\200\304\351"
+  "\274\265\40\10\113\27\6\220\27\6\170\207\211\251\24\326\302\200\144\164\101\232\35\142\173\361\20\53\252\303\250\141"
+  "\203\202\50\61\144\4\3\256\307\230\277\304\2\356\73\234\335\340\154\111\342\6\116\334\224\234\130\346\154\45\346\204"
+  "\204\63\64\72\61\313\223\260\340\330\132\2\102\132\45\262\12\134\264\26\264\112\14\37\250\261\112\326\200\245\61\324"
+  "\204\236\67\141\22\354\131\163\374\224\265\54\52\313\373\60\227\351\322\67\42\67\221\366\62\55\230\370\132\77\331\233"
+  "\320\70\253\104\227\255\45\372\116\314\156\10\277\66\50\102\45\123\311\254\46\356\240\234\163\316\304\104\74\75\5\272"
+  "\4\200\127\310\272\266\101\127\216\144\262\242\62\131\311\156\200\253\215\314\272\124\306\154\174\6\317\230\265\2\227\157"
+  "\300\364\254\210\131\52\101\351\336\305\162\204\247\105\341\156\14\106\347\310\334\344\345\334\10\362\322\274\30\7\174\171"
+  "\112\42\50\323\33\361\301\365\204\73\357\141\325\207\277\311\141\4\217\233\234\155\61\366\76\147\267\70\273\315\331\35"
+  "\306\356\262\237\31\117\252\306\363\53\364\367\377\376\357\231\265\105\146\310\6\131\47\153\144\225\124\110\221\156\366\320"
+  "\301\301\301\77\361\113\144\345\345\326\244\171\230\302\65\271\247\162\137\224\373\103\44\205\165\51\34\140\51\254\112\341"
+  "\317\112\250\100\135\212\262\252\312\47\355\17\34\335\372\12\175\176\200\277\304\326\26\44\267\31\173\30\122\367\76\77"
+  "\40\112\17\63\263\6\177\353\360\267\321\103\323\252\55\361\274\316\34\171\67\322\366\373\303\143\115\23\171\350\212\320"
+  "\132\267\342\240\351\227\375\327\343\26\64\363\137\240\121\200\136\135\20\32\171\333\272\115\267\150\271\144\152\137\140\353"
+  "\216\334\130\167\41\354\55\361\140\3\7\205\165\366\337\150\350\12\275\103\357\322\333\211\120\356\241\111\170\224\214\354"
+  "\157\4\10\217\314\44\111\232\374\201\142\214\23\367\367\336\57\221\106\122\104\21\344\135\373\136\237\305\337\276\356\373"
+  "\36\170\7\62\156\232\370\275\44\4\216\171\364\27\311\243\17\71\373\210\13\22\101\264\155\316\356\113\52\75\170\43"
+  "\54\125\141\201\74\11\161\76\224\223\64\252\147\213\331\112\166\65\53\172\126\34\74\325\225\301\7\301\252\154\132\376"
+  "\167\65\215\226\341\213\201\265\11\345\117\153\222\73\137\210\7\351\257\370\73\371\360\313\303\103\164\364\154\63\146\42"
+  "\264\164\323\110\10\50\204\14\62\176\345\302\301\320\205\103\244\156\10\116\304\110\326\350\107\366\66\335\206\272\303\344"
+  "\157\103\51\255\373\202\120\333\364\376\353\244\51\15\30\240\162\35\261\37\274\226\353\203\137\42\150\102\357\327\370\256"
+  "\343\217\161\374\5\156\132\364\352\41\143\313\214\175\302\351\103\231\307\367\375\167\60\26\325\307\305\264\372\370\173\10"
+  "\117\342\47\20\20\346\314\64\122\340\353\123\254\276\2\116\366\135\375\126\77\246\161\154\354\377";
+
+/* lib/fenv.wbo (DEFLATEd, org. size 360) */
+static unsigned char file_l_55[204] =
+  "\135\215\135\122\303\60\14\204\45\333\151\103\322\22\12\75\2\27\63\211\134\230\346\307\143\247\1\136\342\263\161\63"
+  "\24\333\303\164\170\260\146\127\237\166\15\237\157\23\236\225\241\161\221\255\233\245\267\257\273\201\206\311\175\37\15\265"
+  "\75\151\107\137\55\331\131\15\332\137\33\103\27\232\323\302\364\372\122\154\303\356\323\302\163\300\351\17\117\311\362\255"
+  "\277\277\75\30\166\76\57\252\130\344\246\333\330\125\361\56\312\42\316\62\175\62\56\212\237\345\330\373\324\167\51\126"
+  "\246\316\161\251\15\335\154\247\147\142\215\40\244\220\30\120\50\200\132\141\201\30\100\254\273\320\50\334\243\10\1\344"
+  "\132\206\365\141\363\125\142\121\327\377\330\201\31\6\311\346\7\200\375\21\1\203\110\372\61\263\46\263\247\324\163\332"
+  "\162\317\231\235\62\173\271\143\347\77\375\13";
+
+/* lib/math.wbo (DEFLATEd, org. size 30324) */
+static unsigned char file_l_56[12073] =
+  "\325\175\11\174\24\105\366\160\127\367\14\207\23\44\52\356\32\320\245\146\214\232\204\65\220\223\103\144\202\201\40\310"
+  "\55\247\61\204\0\31\23\10\111\110\2\4\110\146\42\240\340\215\270\53\162\10\111\70\104\304\125\274\160\105\216\0"
+  "\42\2\42\272\272\177\135\24\121\1\65\331\135\71\25\104\310\367\336\253\76\252\47\223\210\356\361\375\66\114\317\164"
+  "\127\275\172\365\352\135\365\352\152\224\351\343\12\330\46\325\61\71\253\44\107\33\137\124\242\25\27\106\66\233\234\75"
+  "\271\240\150\206\303\227\235\77\255\225\57\273\50\53\267\70\73\273\164\174\166\141\211\72\256\320\61\241\60\63\7\277"
+  "\362\34\167\145\27\25\70\162\262\362\322\234\171\371\361\267\367\305\357\376\203\330\20\66\254\171\156\176\156\111\346\304"
+  "\111\216\301\175\13\342\135\45\323\13\62\13\246\145\27\145\26\346\266\310\57\314\55\210\317\314\231\336\54\253\44\53"
+  "\77\47\227\176\362\12\324\254\141\315\263\113\13\343\63\23\342\57\363\25\216\317\313\52\56\316\365\315\140\245\315\212"
+  "\262\113\246\145\345\151\223\213\247\153\171\160\145\146\226\264\310\55\366\41\366\154\147\156\161\156\276\17\276\363\263\362"
+  "\325\251\245\220\236\137\120\64\71\53\317\225\13\205\357\311\317\312\313\315\277\107\313\51\315\325\362\112\163\233\143\312"
+  "\270\334\222\313\163\263\263\263\73\47\45\146\26\217\317\312\33\227\317\362\331\44\65\247\124\315\53\155\145\144\370\212"
+  "\200\16\7\264\264\110\315\55\325\162\343\42\265\334\170\270\22\42\303\14\210\361\331\271\171\152\156\47\165\142\47\226"
+  "\313\46\252\271\161\126\331\274\202\202\42\363\251\250\140\152\376\4\55\367\372\44\63\245\244\150\152\376\170\265\270\324"
+  "\104\65\271\140\202\317\221\13\165\151\271\211\120\111\22\134\311\126\105\76\310\146\63\324\34\370\314\124\163\147\250\171"
+  "\360\231\331\14\130\160\175\134\274\32\37\251\306\105\252\11\221\152\122\244\232\30\251\46\107\252\135\42\325\316\221\152"
+  "\327\110\55\16\210\216\353\4\27\20\36\227\0\27\340\216\3\334\161\22\356\342\51\105\45\154\246\3\331\302\212\324"
+  "\222\70\265\70\116\313\55\215\123\247\340\117\47\265\270\23\233\302\46\263\22\227\1\137\130\60\135\315\52\325\146\146"
+  "\346\300\225\247\201\6\300\225\247\316\210\123\113\342\131\61\233\312\246\261\351\315\146\240\104\112\210\302\370\316\152\161"
+  "\274\126\14\140\305\0\136\2\277\45\231\171\224\223\220\140\42\315\53\270\307\221\343\53\236\302\174\154\250\72\141\122"
+  "\53\51\75\256\223\11\5\362\120\163\162\325\274\2\66\136\53\55\36\327\112\112\237\34\307\262\101\304\305\132\216\257"
+  "\124\55\212\123\163\342\325\234\104\165\150\234\72\64\136\35\232\240\345\25\114\167\344\344\336\223\323\34\277\256\217\353"
+  "\52\176\343\73\205\145\146\116\312\56\312\317\316\313\4\172\255\207\361\5\305\54\113\235\122\152\245\200\156\136\141\76"
+  "\24\145\117\316\104\345\125\263\73\251\371\245\216\302\242\354\361\352\304\231\352\304\122\165\342\64\165\142\241\72\161\222"
+  "\163\174\126\121\321\14\165\112\47\65\67\107\365\115\127\175\323\234\276\151\120\37\175\307\151\343\12\43\65\37\134\271"
+  "\235\341\352\2\127\327\110\107\56\10\12\276\342\360\53\36\277\22\360\53\21\277\222\360\53\31\277\72\343\127\27\374"
+  "\302\22\361\130\42\36\113\304\143\211\170\54\21\217\45\342\261\104\74\226\210\307\22\361\130\42\276\153\144\113\40\264"
+  "\140\162\341\324\222\154\15\220\150\200\115\213\107\355\0\115\1\54\32\224\327\0\221\6\50\64\50\254\1\26\55\36"
+  "\141\60\37\340\23\0\66\1\340\22\0\46\1\140\22\0\76\1\140\22\0\46\1\340\23\0\46\21\141\0\76\21"
+  "\340\22\1\56\11\362\23\61\35\140\22\1\76\21\237\241\154\42\300\47\1\154\42\300\46\1\154\22\344\45\41\74"
+  "\344\45\1\154\22\346\103\271\144\200\111\2\230\144\200\111\6\230\144\200\111\116\214\14\67\115\313\20\205\57\337\124"
+  "\23\20\245\171\17\222\64\357\101\206\246\326\147\1\20\53\264\36\1\116\235\340\263\236\1\126\315\235\320\112\176\216"
+  "\27\6\327\111\235\231\23\46\125\225\303\254\107\300\142\75\240\127\153\356\113\210\47\265\235\64\101\235\224\113\117\240"
+  "\322\132\311\344\102\272\207\342\364\13\345\302\360\327\154\115\341\14\165\102\251\3\375\213\223\134\211\223\134\210\223\334"
+  "\106\313\374\354\254\242\161\63\300\276\234\344\242\234\171\23\340\273\231\360\143\16\162\44\350\57\34\276\254\161\305\55"
+  "\306\27\24\316\100\323\166\240\231\153\140\273\140\12\367\70\311\254\64\54\113\246\3\360\131\245\360\225\233\257\1\105"
+  "\32\120\243\1\361\16\344\221\3\71\343\300\346\73\211\7\16\154\261\3\333\351\300\366\71\21\255\317\211\125\371\234"
+  "\110\256\257\31\321\353\153\106\244\372\56\63\151\365\265\64\110\1\160\250\16\277\301\151\43\76\37\342\363\71\200\24"
+  "\237\3\50\363\71\200\114\237\226\237\175\17\123\34\232\252\261\0\123\35\212\2\167\112\300\341\154\306\2\212\117\145"
+  "\315\25\326\42\234\51\364\167\334\53\176\317\172\25\225\265\220\62\350\57\105\173\375\113\314\150\151\313\150\166\340\275"
+  "\324\272\13\375\173\100\306\145\301\45\360\257\2\62\134\122\306\141\275\216\303\133\41\43\114\317\70\174\361\266\330\143"
+  "\136\375\27\63\132\121\306\264\356\63\222\276\353\132\173\253\376\273\31\62\56\207\214\116\46\271\247\303\257\200\277\252"
+  "\255\367\15\277\30\121\311\356\362\156\74\270\156\171\304\376\66\133\273\16\75\166\377\236\367\16\364\270\171\107\313\374"
+  "\215\27\36\334\2\5\133\103\301\34\66\176\70\376\175\344\235\171\21\113\326\170\57\366\174\271\335\33\125\317\171\73"
+  "\377\265\331\334\323\23\236\364\76\61\67\377\333\257\156\234\355\215\322\106\274\343\231\74\331\173\365\234\303\27\167\37"
+  "\34\351\145\331\47\117\176\334\53\325\233\23\376\110\333\37\156\354\344\135\263\260\163\345\174\177\33\357\267\317\34\217"
+  "\157\375\372\225\336\342\73\307\36\334\73\365\324\226\17\147\156\55\51\214\71\217\334\10\127\230\43\234\251\100\247\6"
+  "\227\3\131\205\104\253\354\12\240\44\5\233\220\162\336\175\216\270\161\163\257\222\36\310\252\247\322\316\166\207\337\261"
+  "\103\366\225\336\202\317\163\332\35\357\212\160\374\206\231\135\360\331\63\373\253\144\204\277\356\124\156\22\40\272\22\152"
+  "\230\257\262\71\347\252\225\136\3\363\225\237\242\257\126\336\37\171\223\362\131\342\31\145\334\301\155\112\367\305\177\124"
+  "\172\56\110\125\306\17\271\250\154\72\364\234\262\61\353\55\245\133\176\244\362\301\200\333\224\276\315\16\53\55\153\143"
+  "\225\153\27\276\257\324\135\167\121\211\336\160\255\362\115\217\147\224\63\111\263\225\136\233\142\225\145\337\316\125\136\271"
+  "\261\120\351\351\317\124\376\372\170\127\345\316\71\135\225\145\247\273\52\17\145\316\125\242\316\155\126\316\266\277\105\71"
+  "\124\277\110\151\375\224\123\271\242\343\167\312\145\167\75\244\114\156\77\131\171\317\237\254\264\334\173\223\222\66\150\243"
+  "\262\334\347\125\156\256\315\124\336\270\151\252\162\264\356\155\345\326\131\47\224\37\272\66\127\26\16\175\120\71\77\251"
+  "\126\151\277\41\123\151\221\361\210\322\111\33\241\314\372\51\115\71\376\334\44\205\277\371\236\222\174\172\211\362\325\263"
+  "\327\51\143\262\36\127\132\264\73\246\334\267\70\133\251\154\223\251\74\222\222\243\124\174\134\257\334\124\74\100\151\326"
+  "\54\116\331\63\342\152\345\235\265\305\312\254\57\307\52\223\36\336\206\254\275\12\70\122\301\30\362\365\274\273\145\112"
+  "\331\47\127\2\217\43\122\146\116\154\17\367\236\224\115\27\156\200\347\350\224\156\151\277\207\264\216\51\167\367\211\203"
+  "\364\370\224\145\223\22\41\57\51\345\340\143\235\41\277\153\112\273\127\272\1\114\367\224\273\76\276\25\340\274\51\375"
+  "\375\51\0\333\63\45\57\374\66\200\277\55\345\341\352\124\50\323\53\145\175\142\157\50\327\73\145\357\256\64\50\333"
+  "\47\245\156\324\355\120\276\157\12\120\322\6\204\314\331\240\115\131\316\173\326\177\346\275\346\346\136\303\316\273\277\365"
+  "\56\375\376\336\17\134\305\337\351\317\347\320\232\256\46\300\57\263\73\172\2\35\146\166\157\176\167\233\204\33\327\334"
+  "\333\175\363\336\343\63\347\67\57\324\237\37\357\16\200\277\1\300\121\254\225\256\300\73\353\236\132\274\170\361\73\133"
+  "\353\347\50\13\43\373\156\367\116\371\315\365\27\167\115\171\163\153\76\357\377\326\273\275\67\172\47\57\51\171\341\344"
+  "\213\57\157\35\162\353\201\112\137\253\15\336\45\27\16\15\275\371\320\363\133\353\132\115\213\274\143\326\263\336\216\171"
+  "\23\177\337\353\225\352\255\127\374\315\363\125\267\347\27\40\45\277\205\12\52\124\323\266\112\356\273\372\57\57\216\76"
+  "\356\155\375\300\271\274\121\257\36\367\16\111\277\362\0\273\352\204\167\326\220\362\356\257\27\235\360\256\373\163\116\334"
+  "\274\17\117\170\273\214\233\232\77\263\313\111\357\27\207\332\237\171\172\371\111\357\325\33\343\56\273\330\354\224\167\357"
+  "\263\335\72\77\63\345\224\327\223\170\145\377\65\207\116\171\157\176\40\153\154\213\201\247\275\67\305\44\177\364\267\255"
+  "\247\275\263\7\75\75\242\103\342\31\157\364\260\333\77\153\376\334\31\357\175\303\273\275\350\217\374\336\373\356\55\1"
+  "\337\362\312\357\275\45\231\177\377\146\152\373\37\274\363\130\135\161\233\252\37\274\127\355\357\277\370\201\33\316\172\17"
+  "\126\306\334\166\164\375\131\357\321\267\336\175\261\163\347\163\336\5\307\127\316\176\174\347\71\157\306\15\75\136\322\206"
+  "\377\350\175\376\57\167\55\136\361\315\217\336\76\143\316\237\234\26\70\357\135\66\364\276\317\226\106\374\344\315\135\360"
+  "\335\247\174\343\117\336\171\253\316\177\172\315\250\13\336\314\245\263\22\26\375\164\301\373\267\5\253\252\137\130\165\321"
+  "\233\322\73\77\175\332\340\172\257\342\140\327\60\126\306\2\335\374\21\145\376\266\1\177\273\200\377\332\200\377\72\177"
+  "\215\342\160\267\345\21\233\231\347\272\32\205\257\147\363\331\63\314\335\216\137\367\14\363\134\313\333\325\50\365\365\336"
+  "\23\312\111\305\115\17\25\25\333\352\233\237\120\74\355\370\265\47\225\32\105\331\245\70\122\152\24\325\335\326\211\271"
+  "\372\243\246\77\22\260\110\2\130\306\257\205\337\267\225\166\356\266\56\5\377\361\266\255\35\354\167\104\123\13\240\11"
+  "\111\330\16\145\350\357\154\275\62\307\366\364\276\2\300\355\203\200\353\215\277\120\300\234\200\257\302\326\272\375\324\76"
+  "\167\123\350\35\1\356\66\61\66\307\134\345\3\305\11\24\273\20\231\207\220\65\243\232\303\331\65\300\263\135\230\174"
+  "\275\202\311\156\254\43\62\340\277\1\331\31\314\311\110\344\244\373\6\36\211\374\340\247\24\117\44\277\1\260\362\33"
+  "\352\24\344\140\373\357\341\307\23\131\103\65\3\147\21\352\160\175\363\275\210\375\306\320\274\251\250\10\350\344\1\314"
+  "\115\212\132\26\140\145\353\30\322\20\25\360\107\7\374\61\1\177\207\120\224\304\20\45\35\170\114\215\322\346\14\124"
+  "\124\337\32\4\31\255\113\215\123\272\116\204\51\132\36\321\32\344\24\261\123\357\364\6\247\126\63\17\140\65\161\172"
+  "\142\114\225\320\221\46\327\51\356\150\50\23\215\370\5\12\16\175\30\242\211\252\121\16\374\321\277\33\322\166\52\243"
+  "\117\235\335\336\76\177\65\64\343\223\143\137\55\372\151\307\301\17\130\303\66\316\145\133\131\265\121\364\305\132\266\7"
+  "\204\4\172\344\344\321\74\252\26\352\272\330\172\17\110\7\321\55\233\252\314\357\176\244\263\177\273\262\254\356\336\155"
+  "\273\347\235\133\172\121\151\12\37\41\240\266\357\41\22\15\145\152\75\207\11\66\154\255\50\75\101\215\150\163\32\270"
+  "\361\274\150\361\375\204\301\103\74\201\254\176\373\176\115\123\240\140\162\55\360\350\227\126\152\310\140\101\167\300\343\140"
+  "\277\27\162\37\213\142\277\231\144\36\253\213\335\337\61\340\357\24\360\307\5\32\221\277\56\145\36\163\102\161\307\362"
+  "\233\75\35\201\13\311\212\312\143\165\121\356\67\270\34\313\73\350\212\340\62\125\101\0\51\273\51\241\111\265\320\125"
+  "\211\252\350\4\314\202\52\240\374\315\236\70\36\27\45\152\43\175\271\330\274\116\251\245\372\55\26\140\35\25\365\32"
+  "\370\234\230\40\56\255\17\22\204\203\305\243\5\226\155\46\365\117\10\370\23\3\376\244\200\77\71\340\357\34\312\2"
+  "\22\210\3\235\171\202\144\1\360\15\44\170\22\41\211\132\5\67\312\156\233\122\241\376\266\305\62\224\116\304\125\224"
+  "\272\361\331\335\331\311\23\170\147\342\322\333\172\336\266\172\115\317\103\37\347\44\377\311\23\277\127\334\111\0\232\4"
+  "\362\355\154\267\256\120\365\220\122\46\10\126\163\10\173\100\137\22\200\171\220\22\340\111\247\24\340\252\121\203\23\351"
+  "\115\330\243\23\136\321\102\262\70\47\241\167\142\31\154\134\235\102\64\164\106\32\56\251\176\54\264\113\47\204\41\5"
+  "\116\336\31\356\152\224\104\236\130\247\234\6\242\74\311\274\363\73\62\4\320\230\54\332\215\240\6\255\42\41\301\224"
+  "\35\357\374\274\45\123\123\220\135\320\331\225\155\375\357\10\162\277\350\224\54\41\232\372\332\100\232\263\376\145\151\356"
+  "\266\111\363\373\377\272\64\167\377\177\220\146\127\62\313\152\111\232\44\107\224\151\67\24\353\277\131\240\144\222\310\110"
+  "\4\12\354\262\30\116\136\4\132\42\344\374\153\304\7\235\266\20\232\347\137\27\130\67\20\130\267\246\5\46\204\222"
+  "\320\244\120\74\44\216\156\277\100\34\267\220\70\356\261\111\243\373\317\30\226\301\323\356\227\44\24\336\335\44\1\102"
+  "\23\254\330\35\341\344\124\66\140\262\35\51\226\72\66\23\260\111\106\142\246\334\76\102\150\61\25\161\6\65\31\21"
+  "\142\330\2\15\277\125\164\223\357\221\42\366\10\140\353\73\33\316\105\352\52\375\336\200\77\45\340\357\371\57\351\45"
+  "\357\341\351\50\61\56\270\231\135\25\15\110\152\132\7\173\170\72\361\10\4\154\34\15\310\323\11\160\161\222\377\10"
+  "\131\23\357\321\101\321\252\220\175\66\356\366\360\170\255\216\373\270\267\232\200\15\226\7\204\43\364\112\156\120\104\300"
+  "\162\157\217\205\132\13\377\325\4\211\115\71\252\36\236\224\113\154\145\317\140\311\33\15\266\311\273\101\173\321\254\364"
+  "\51\237\0\50\301\155\240\4\240\376\273\35\250\4\251\24\46\103\274\324\53\340\357\115\121\123\32\331\102\22\205\117"
+  "\175\2\376\333\111\63\372\66\32\76\247\102\162\137\53\271\27\357\13\337\175\170\214\154\61\61\274\373\51\214\136\172"
+  "\231\375\212\247\27\357\143\310\131\204\127\61\146\274\345\62\222\0\6\207\6\175\244\241\201\16\264\127\27\2\207\120"
+  "\113\174\257\44\41\100\25\30\205\342\357\156\3\113\7\336\347\35\51\144\203\107\344\172\71\273\114\341\335\11\153\215"
+  "\322\342\357\340\133\200\137\304\55\235\22\241\303\61\272\220\324\176\65\312\77\246\103\364\326\301\235\244\335\301\223\50"
+  "\52\170\113\151\325\117\355\217\261\33\203\60\77\326\325\37\323\331\151\20\160\330\35\256\73\134\375\234\352\200\32\145"
+  "\166\51\224\2\64\56\114\327\6\132\105\7\250\203\254\242\203\254\242\3\135\3\135\3\120\111\315\201\111\163\2\121"
+  "\220\175\46\141\275\14\302\6\23\141\151\274\17\140\37\142\141\37\254\16\345\151\2\173\232\153\250\205\175\210\153\210"
+  "\153\260\123\275\223\10\113\103\64\202\260\141\126\321\73\325\341\126\321\341\126\321\141\256\141\256\73\221\260\136\62\141"
+  "\151\42\14\236\135\272\337\210\21\24\141\323\61\64\114\216\161\142\36\217\5\17\1\243\226\366\272\164\242\116\203\40"
+  "\100\151\170\24\32\4\105\266\35\60\321\335\1\345\5\200\34\375\275\33\271\357\356\100\102\111\13\125\105\57\252\242"
+  "\227\250\42\115\256\242\27\125\321\107\256\2\264\211\252\350\343\304\33\243\12\344\243\273\17\125\21\213\50\334\121\352"
+  "\10\155\44\217\102\10\344\100\224\320\46\270\353\215\252\3\277\267\13\215\202\364\336\2\244\67\224\355\155\70\275\30"
+  "\36\123\113\155\153\117\221\15\266\253\103\55\265\253\67\277\335\364\154\215\151\37\0\365\206\342\267\133\305\157\347\267"
+  "\327\22\17\302\106\2\221\43\135\43\56\225\232\375\224\206\30\260\64\224\352\360\263\265\253\243\264\321\166\355\157\244"
+  "\61\246\172\204\215\6\242\106\273\106\131\342\61\312\327\221\310\352\233\343\300\224\306\157\36\160\2\47\25\313\175\165"
+  "\150\320\113\331\304\330\146\237\30\205\107\175\117\6\111\142\104\64\70\140\347\121\147\120\261\270\245\120\46\200\50\101"
+  "\140\335\21\44\106\227\364\31\75\105\30\170\323\224\170\154\276\35\173\117\352\73\357\242\240\341\15\15\275\146\172\231"
+  "\377\356\200\77\43\340\37\23\360\147\6\374\143\3\376\254\200\177\134\300\77\76\340\237\20\360\147\7\374\76\275\113"
+  "\65\206\107\167\7\273\317\161\344\76\307\362\161\322\214\201\71\101\204\135\75\72\66\61\121\0\40\12\65\163\34\172"
+  "\374\273\321\343\363\261\162\240\346\44\220\335\172\301\52\46\276\127\32\316\37\163\301\136\75\331\206\313\270\103\353\107"
+  "\45\250\70\244\136\15\242\314\346\343\370\130\160\6\304\74\272\275\32\254\143\154\130\77\300\320\317\165\207\72\20\355"
+  "\44\111\353\257\23\254\350\335\27\270\213\201\352\0\114\104\37\61\316\65\200\47\221\303\0\55\111\152\33\326\337\325"
+  "\337\65\220\147\123\112\235\142\325\302\171\222\156\224\360\310\223\260\42\40\63\133\367\50\331\210\216\272\135\121\25\201"
+  "\101\46\73\101\114\100\24\374\356\23\212\256\225\265\2\311\330\132\23\11\73\43\52\152\34\16\110\367\214\167\117\300"
+  "\237\114\167\26\311\210\271\63\324\101\340\100\63\364\321\16\37\317\63\40\336\364\361\161\304\172\37\76\271\307\3\116"
+  "\137\35\42\232\100\317\23\220\271\115\324\203\330\30\164\370\31\340\166\25\160\274\203\370\335\120\315\140\155\250\125\115"
+  "\46\41\32\303\307\143\125\146\237\5\367\24\177\214\341\143\337\325\143\16\352\301\306\20\164\46\374\102\205\374\156\202"
+  "\311\24\225\203\60\314\340\144\274\220\300\170\42\117\20\74\226\217\171\107\327\41\264\334\161\220\5\111\165\110\144\26"
+  "\41\315\272\344\266\14\5\142\206\272\6\43\254\71\70\264\54\306\223\156\335\37\263\345\270\323\171\226\76\34\101\145"
+  "\312\342\23\4\231\23\234\134\52\163\4\251\4\70\77\151\247\1\2\304\101\232\212\164\72\201\340\54\322\6\101\265"
+  "\256\344\23\110\360\372\134\11\21\236\45\10\36\113\131\330\46\106\50\241\201\47\205\256\220\126\265\241\161\305\70\313"
+  "\35\214\15\166\7\351\140\374\367\210\230\351\301\226\172\314\4\16\40\247\314\237\133\346\237\130\346\237\124\346\317\53"
+  "\363\117\56\363\217\51\363\347\227\371\63\312\374\5\145\176\137\231\277\260\314\77\245\314\137\124\246\217\334\243\3\376"
+  "\342\200\25\154\211\110\113\304\130\20\140\225\370\375\123\313\374\323\312\374\323\313\374\245\145\376\31\145\376\231\115\206"
+  "\134\45\162\310\125\142\204\134\326\54\223\24\152\245\131\241\126\12\116\327\136\157\11\5\342\101\53\70\74\356\265\246"
+  "\264\352\233\233\263\213\261\226\143\12\140\137\140\106\301\146\234\226\146\26\151\220\104\205\372\330\13\245\30\50\65\350"
+  "\44\314\136\51\40\205\214\157\231\252\54\321\346\264\21\55\306\260\305\24\240\221\347\243\32\53\226\70\366\353\123\360"
+  "\305\46\21\332\176\75\337\14\132\160\252\263\15\305\377\175\160\304\37\215\316\310\223\254\337\142\334\240\317\343\363\144"
+  "\322\34\260\222\142\214\173\372\30\114\104\134\10\172\206\112\265\321\113\245\205\52\145\375\263\25\267\134\175\50\136\330"
+  "\232\155\102\120\63\122\167\232\153\256\24\3\356\127\332\265\246\210\14\271\120\306\123\227\60\247\5\341\122\214\56\300"
+  "\140\305\56\43\166\334\155\253\205\107\254\64\206\350\106\234\131\121\341\260\272\242\326\146\252\216\42\306\210\60\100\237"
+  "\356\62\52\151\260\10\1\275\172\16\251\214\334\322\346\273\44\315\22\263\251\66\105\323\364\11\326\34\360\27\41\50"
+  "\115\137\311\334\351\42\112\27\202\227\30\130\154\351\171\72\117\207\216\220\276\261\200\223\27\33\366\237\276\204\20\20"
+  "\305\351\146\304\117\261\20\263\343\10\356\114\165\35\173\314\261\307\222\342\12\361\20\113\263\265\365\332\76\231\277\360"
+  "\23\356\154\146\322\216\152\53\222\340\173\43\223\214\115\210\266\227\76\325\370\263\305\104\101\252\157\367\257\253\157\317"
+  "\57\252\217\347\0\153\66\262\52\6\175\224\257\232\31\220\207\275\334\267\123\31\256\57\125\342\275\370\73\0\121\123"
+  "\25\23\227\273\210\122\307\366\271\372\7\57\226\165\27\42\134\257\317\63\316\272\376\64\254\7\304\70\220\177\161\166"
+  "\207\154\314\307\22\356\51\274\220\117\251\144\236\61\306\222\101\341\34\163\142\144\14\237\2\75\137\141\25\302\345\243"
+  "\207\160\107\331\146\340\163\14\12\122\140\100\10\232\7\241\137\22\206\360\74\107\232\214\247\221\124\224\71\341\136\117"
+  "\23\356\2\21\305\34\150\321\306\114\131\54\232\362\243\33\56\337\247\167\131\321\116\114\370\361\357\261\202\333\14\22"
+  "\50\231\6\13\265\22\71\142\300\206\234\223\347\353\143\355\363\365\71\345\254\71\255\157\30\41\70\64\253\120\322\364"
+  "\6\371\225\250\312\304\240\152\346\51\360\114\13\301\242\151\226\361\173\112\155\165\133\335\143\205\52\306\321\274\226\260"
+  "\137\211\35\240\215\62\167\51\317\341\245\15\251\3\372\146\160\254\177\32\57\105\141\301\357\14\135\314\323\171\1\57"
+  "\0\252\246\362\251\250\40\132\2\376\175\345\345\123\167\52\365\317\25\34\174\155\362\101\272\37\160\343\143\103\110\131"
+  "\340\236\365\274\356\331\261\45\357\323\175\366\301\167\236\350\167\377\273\164\377\335\300\336\375\242\374\173\100\35\52\131"
+  "\303\313\223\301\247\103\275\5\342\331\235\1\367\323\240\376\251\106\273\133\244\360\251\225\214\147\200\12\225\206\340\117"
+  "\51\317\340\245\26\54\264\141\252\336\56\152\23\250\347\164\374\345\63\260\65\225\226\72\116\12\201\153\22\360\142\222"
+  "\256\216\171\204\363\160\313\267\377\351\345\223\0\117\356\116\345\14\113\157\163\270\143\217\55\370\314\41\377\202\326\355"
+  "\123\314\107\274\345\254\145\220\144\335\23\171\324\106\346\366\361\134\76\21\363\133\4\345\163\137\243\106\61\21\214\302"
+  "\127\325\240\14\264\55\127\230\212\334\305\273\13\354\336\216\176\32\366\73\133\335\5\240\275\251\236\311\41\152\234\314"
+  "\123\371\144\300\76\6\332\225\312\363\211\117\171\174\62\76\3\117\362\370\44\240\64\35\102\224\231\226\315\45\363\231"
+  "\360\235\304\205\155\315\245\116\332\174\0\62\222\244\125\6\364\74\362\132\64\57\10\265\172\210\156\51\317\360\35\213"
+  "\272\127\242\257\237\124\305\216\374\62\24\144\317\326\122\363\123\73\44\322\340\241\54\44\151\115\121\44\250\70\172\111"
+  "\320\344\40\254\372\75\111\362\264\112\264\160\157\111\172\247\273\307\142\30\11\31\274\15\256\203\341\110\331\44\137\52"
+  "\54\171\1\237\354\5\242\314\351\347\150\143\252\130\266\173\37\217\12\32\171\231\201\16\320\222\154\165\63\70\330\166"
+  "\107\1\371\223\120\363\334\223\250\351\50\167\137\103\175\361\350\35\103\152\354\61\57\131\130\36\14\157\46\241\146\202"
+  "\255\167\375\221\366\204\201\46\1\124\327\274\265\141\131\167\363\55\262\345\101\20\60\5\230\52\254\254\10\73\364\152"
+  "\244\63\35\341\173\120\327\363\26\165\75\117\154\336\362\233\274\32\337\126\274\377\375\241\33\136\230\70\342\12\112\77"
+  "\61\351\203\267\172\156\336\264\5\357\17\254\332\122\224\333\331\327\243\241\127\251\102\73\112\47\215\36\143\362\56\5"
+  "\273\175\216\165\26\41\24\300\144\110\336\71\3\103\213\52\322\164\153\241\67\31\31\50\106\24\311\272\100\304\320\75"
+  "\235\107\205\263\233\60\16\111\227\345\221\154\367\273\30\327\24\140\13\141\304\61\213\246\33\266\253\70\340\50\53\363"
+  "\227\323\250\2\206\35\176\32\122\210\241\106\240\114\337\340\40\106\30\115\155\163\20\375\124\320\324\246\261\310\327\60"
+  "\360\34\274\303\122\41\175\152\325\66\305\20\234\33\255\157\165\150\142\25\34\47\137\244\131\136\171\53\104\264\155\256"
+  "\263\126\247\124\164\307\160\163\144\313\15\265\212\61\355\0\136\304\276\10\56\154\4\72\354\123\312\311\240\176\54\2"
+  "\60\13\253\252\265\321\166\334\13\302\54\247\32\60\136\217\251\245\351\14\21\114\225\133\115\373\2\237\243\203\70\243"
+  "\50\104\361\106\346\11\140\322\141\103\177\341\311\330\310\210\332\202\100\345\274\134\216\226\244\130\251\134\357\66\375\46"
+  "\172\0\366\127\261\320\250\375\166\344\340\172\313\121\365\250\12\113\133\171\71\305\7\5\210\300\35\20\375\61\130\17"
+  "\360\357\307\265\327\324\41\337\204\361\24\325\50\357\37\157\313\143\40\51\31\303\57\307\217\213\26\57\136\374\211\27"
+  "\357\137\50\175\364\272\267\246\354\243\373\25\273\112\17\264\134\262\103\352\207\321\106\300\322\250\21\107\11\146\364\23"
+  "\236\77\104\366\375\200\356\17\151\173\237\234\220\366\66\335\367\32\332\343\363\53\117\154\17\352\303\335\371\34\272\200"
+  "\223\110\112\76\37\123\211\315\117\322\143\120\51\246\4\336\340\345\56\223\171\123\6\355\51\343\176\141\253\242\351\166"
+  "\36\111\0\301\242\220\371\45\241\54\20\54\257\16\211\316\314\154\204\365\16\126\301\310\100\3\326\204\100\322\245\154"
+  "\67\372\237\262\103\34\47\353\103\162\212\31\100\160\61\146\7\121\337\34\147\361\364\331\135\150\36\230\132\55\214\27"
+  "\334\251\115\155\122\1\223\204\21\154\162\207\23\127\234\272\70\372\126\264\216\313\217\336\170\365\254\275\20\36\302\110"
+  "\162\26\212\313\223\116\203\334\261\53\6\137\325\353\57\244\101\300\355\173\5\267\27\251\72\273\147\263\62\377\34\270"
+  "\346\62\232\152\1\276\337\307\220\367\74\170\337\215\210\164\300\155\334\307\44\116\143\316\366\117\237\232\353\170\317\232"
+  "\262\256\157\376\236\276\371\11\170\144\71\40\36\155\6\0\101\333\277\240\33\274\217\221\274\332\351\351\242\73\273\77"
+  "\345\110\350\121\25\202\14\351\164\363\107\341\175\347\155\373\312\4\221\106\165\104\325\307\27\265\275\72\125\57\275\265"
+  "\275\136\243\151\273\210\162\26\46\252\223\6\13\263\41\346\153\145\117\165\317\141\270\265\360\76\214\355\360\13\106\50"
+  "\326\0\13\107\362\345\314\145\57\121\311\326\61\117\64\205\236\21\334\207\325\100\42\365\210\263\31\76\267\22\317\200"
+  "\30\12\102\322\34\314\212\60\326\353\116\20\171\366\125\173\373\134\236\74\311\100\132\46\317\155\220\65\20\3\210\160"
+  "\374\235\315\304\134\2\22\53\150\372\67\167\364\163\131\3\237\216\264\361\271\150\355\163\131\120\367\37\241\173\16\11"
+  "\164\16\323\241\45\337\73\227\41\64\270\207\331\344\237\74\251\66\203\303\12\347\350\313\43\372\206\66\132\116\111\265"
+  "\31\212\175\207\133\152\153\247\0\376\306\130\103\371\371\42\6\101\205\142\163\235\155\325\367\176\141\101\37\152\241\55"
+  "\150\36\374\314\207\353\1\270\36\204\353\41\270\36\206\353\21\270\36\205\353\61\46\131\231\177\1\374\74\16\327\102"
+  "\270\236\140\15\255\116\167\32\36\335\76\120\201\335\251\116\36\261\4\334\203\320\163\311\20\177\74\360\310\154\323\20"
+  "\233\264\312\5\314\62\313\5\114\262\113\303\201\131\75\374\326\137\150\233\272\125\110\201\276\205\352\347\214\123\152\245"
+  "\325\211\220\1\131\175\207\60\114\234\101\220\140\52\155\60\233\11\46\200\373\105\203\214\126\216\41\214\163\25\146\373"
+  "\354\6\54\367\142\272\15\313\35\130\220\31\343\35\316\161\315\21\206\141\130\365\221\20\126\155\240\227\323\310\66\144"
+  "\43\236\313\344\335\6\207\211\170\367\3\150\57\17\140\377\77\137\362\15\174\76\370\242\313\225\16\55\64\12\367\37"
+  "\141\220\0\37\200\172\110\144\204\153\6\310\65\2\344\121\306\37\302\17\200\74\54\62\270\11\22\45\100\36\143\374"
+  "\21\202\172\224\354\235\77\314\370\143\142\242\340\101\46\315\20\74\310\210\236\52\154\24\324\12\217\76\253\53\275\6"
+  "\365\311\127\115\6\15\125\315\263\334\5\352\31\237\207\156\142\276\336\164\172\46\343\257\26\77\236\171\42\123\57\26"
+  "\330\145\217\155\20\274\212\311\2\65\303\22\266\313\266\255\344\300\326\257\344\240\163\33\326\23\141\25\253\44\64\326"
+  "\234\370\161\257\344\214\214\132\52\365\156\5\260\373\367\231\233\205\153\224\56\173\202\346\326\11\171\103\277\365\70\263"
+  "\273\233\307\231\351\274\32\161\74\307\275\101\316\22\30\34\155\154\14\222\107\242\172\310\56\226\336\160\60\132\27\204"
+  "\322\327\10\115\13\203\150\132\330\10\115\350\156\354\25\102\274\22\255\307\53\301\243\136\222\242\257\222\52\263\150\257"
+  "\14\252\372\211\240\252\237\150\264\152\342\172\52\70\335\77\60\105\53\303\35\127\43\165\257\233\26\300\110\61\203\126"
+  "\206\142\203\374\146\254\345\25\151\32\261\342\244\30\221\104\254\143\362\26\71\243\163\204\70\11\255\153\312\116\145\315"
+  "\131\74\346\164\257\27\243\363\217\262\152\300\60\143\266\342\175\371\305\15\43\277\272\356\355\36\170\137\267\254\303\203"
+  "\307\216\336\265\5\357\313\76\172\357\256\156\237\34\275\65\270\173\164\147\340\244\266\241\352\200\270\257\350\167\1\31"
+  "\317\60\200\310\235\132\13\166\240\324\270\7\147\12\2\220\25\244\202\73\221\212\352\361\272\203\375\221\211\45\264\351"
+  "\72\47\236\204\16\245\167\231\316\215\105\354\327\260\303\266\160\145\261\145\247\322\237\52\137\115\14\231\76\244\6\342"
+  "\205\21\304\220\5\127\357\5\346\374\110\14\171\176\350\262\212\101\376\205\304\220\235\33\136\331\274\374\237\156\112\377"
+  "\260\313\374\55\337\376\270\166\163\350\351\107\140\21\20\363\362\261\175\27\65\373\272\204\304\17\30\144\11\206\211\235"
+  "\111\125\206\257\240\126\254\22\163\71\6\370\7\136\367\42\143\351\243\2\342\265\6\273\6\27\61\233\77\105\334\213"
+  "\320\277\364\226\254\27\23\74\117\62\336\73\104\265\101\121\300\123\206\102\56\120\103\150\144\21\115\62\304\232\135\374"
+  "\223\24\33\360\106\366\262\13\261\100\10\330\100\113\215\316\72\226\172\151\332\55\122\33\142\222\321\33\152\305\210\26"
+  "\242\322\204\77\204\252\235\122\217\36\261\222\131\53\132\120\371\332\265\117\352\113\47\326\240\150\11\15\61\104\234\261"
+  "\123\61\116\144\241\47\161\203\160\215\203\127\250\245\64\233\124\4\132\57\5\364\24\235\30\326\105\203\345\162\326\32"
+  "\373\50\56\156\256\61\156\242\214\233\56\306\315\355\306\315\50\55\224\352\200\342\244\123\166\270\1\307\215\233\116\306"
+  "\115\212\161\63\330\270\31\253\65\242\206\70\47\206\326\137\300\123\341\256\200\147\340\134\31\132\237\200\360\144\120\161"
+  "\105\323\247\261\63\240\121\31\225\330\144\33\333\322\240\313\236\202\343\5\340\337\357\160\330\247\342\262\345\106\62\140"
+  "\251\67\51\302\11\60\370\236\202\23\14\74\243\312\134\335\321\327\304\30\5\141\105\236\364\20\223\305\351\70\121\46"
+  "\34\271\173\212\44\313\242\225\250\262\241\346\13\335\76\111\101\174\50\205\112\154\247\217\77\211\303\162\37\56\176\130"
+  "\236\250\10\164\172\61\123\234\1\374\143\201\347\57\363\107\4\374\251\1\377\22\320\336\245\160\55\203\353\151\270\226"
+  "\303\265\2\256\112\270\252\340\252\146\264\24\157\256\314\147\7\374\53\41\151\25\43\153\130\15\172\277\6\256\147\340"
+  "\132\13\327\263\220\274\16\256\6\373\143\375\317\101\352\172\270\236\207\353\117\160\275\0\327\213\160\155\200\353\45\270"
+  "\136\206\353\25\270\136\205\353\65\270\66\302\365\72\134\177\206\353\15\270\66\301\365\46\134\233\341\332\2\327\126\270"
+  "\266\301\125\303\2\327\253\232\347\131\260\251\27\35\165\212\247\206\271\327\101\244\23\256\360\145\220\344\300\261\133\224"
+  "\242\172\200\251\20\345\54\145\142\123\307\162\306\227\300\255\206\275\334\65\377\120\74\53\230\65\143\353\136\201\201\37"
+  "\146\137\303\61\35\14\362\357\270\114\5\2\135\301\370\162\106\263\101\200\240\12\327\261\262\161\273\243\42\166\72\362"
+  "\354\175\306\106\107\264\360\3\120\63\316\332\320\360\321\323\321\230\24\56\263\154\310\131\316\256\244\171\155\203\312\215"
+  "\120\163\127\105\303\355\221\326\336\40\236\114\313\344\160\237\334\126\354\226\304\315\222\372\26\111\240\142\237\276\105\22"
+  "\367\67\2\214\144\242\253\231\66\204\43\255\373\214\175\216\253\321\345\45\133\103\132\213\120\150\120\22\374\44\327\111"
+  "\33\335\110\237\126\63\327\120\33\11\264\57\222\12\56\320\344\26\166\2\354\110\374\40\333\306\46\332\243\11\124\272"
+  "\237\146\332\166\206\273\51\161\156\344\151\134\350\60\121\74\55\17\313\323\265\141\304\52\143\203\245\71\122\353\201\12"
+  "\276\216\155\104\222\240\54\326\101\174\363\304\131\175\154\141\117\40\2\55\156\35\303\223\101\146\15\311\44\166\251\335"
+  "\253\261\151\351\270\147\263\1\243\353\250\225\264\205\23\354\21\244\136\303\42\125\55\234\335\144\355\327\341\51\126\225"
+  "\333\140\370\20\316\272\124\323\14\367\72\346\216\302\31\154\134\2\166\247\143\133\127\61\100\141\234\214\1\252\237\146"
+  "\72\51\206\314\121\315\126\62\132\70\110\342\121\50\4\100\321\0\320\343\345\136\74\375\224\144\200\237\6\225\24\115"
+  "\14\205\362\267\6\312\125\320\145\256\64\273\233\106\200\165\70\51\122\71\246\157\15\131\305\364\76\144\225\331\6\143"
+  "\1\27\33\127\315\324\221\102\25\107\160\24\352\156\224\331\110\165\224\54\36\250\2\144\135\155\322\220\154\16\35\31"
+  "\224\267\11\122\34\221\152\201\112\110\207\276\234\266\334\236\324\235\66\67\163\135\243\154\212\66\302\65\302\65\322\342"
+  "\265\72\132\335\301\324\235\202\373\320\340\313\325\260\235\54\154\7\13\33\355\332\311\102\360\367\71\306\237\143\304\16"
+  "\250\104\73\201\125\0\350\216\120\240\353\31\364\360\6\50\63\100\107\353\134\122\203\72\356\164\324\4\321\176\162\376"
+  "\322\6\56\240\15\324\252\112\332\144\141\237\121\47\173\126\337\62\11\0\76\357\142\144\363\373\221\321\157\61\365\155"
+  "\306\223\203\230\175\22\312\270\336\146\72\157\352\210\67\273\230\13\76\200\50\331\330\330\270\133\214\261\265\167\250\201"
+  "\20\210\106\333\165\102\154\130\334\315\324\75\314\265\7\162\365\225\64\167\164\333\260\167\230\13\76\220\265\127\47\14"
+  "\371\257\355\143\244\1\74\272\126\41\157\263\227\251\357\262\140\367\142\270\212\347\31\171\276\25\172\242\345\376\300\177"
+  "\250\373\131\10\77\366\36\263\34\331\176\246\36\140\277\322\225\35\140\66\137\366\36\163\301\147\77\13\341\316\376\304"
+  "\164\177\366\56\263\351\331\76\346\202\17\265\35\33\13\176\55\154\273\260\222\355\54\130\200\246\340\236\26\172\170\15"
+  "\165\43\352\373\114\373\300\124\54\33\317\251\210\124\252\255\124\54\354\3\254\6\276\336\107\133\305\245\105\264\161\233"
+  "\137\52\354\51\357\43\154\340\61\315\352\74\57\260\106\175\246\41\122\203\344\132\352\371\154\245\137\104\326\20\264\323"
+  "\236\261\1\320\122\272\74\267\141\350\71\20\241\376\5\241\101\133\76\44\225\125\110\215\377\302\324\217\102\11\340\45"
+  "\222\261\135\271\67\62\161\356\144\65\263\32\131\115\202\375\310\256\361\37\62\27\174\0\365\137\365\32\377\117\252\361"
+  "\257\114\375\230\251\237\60\233\212\321\334\214\366\67\324\365\112\206\163\0\160\3\74\110\252\3\175\26\173\354\240\344"
+  "\47\114\75\210\144\225\263\53\154\73\10\44\362\121\51\32\352\335\101\273\15\375\215\271\340\363\211\150\366\161\106\175"
+  "\240\130\43\20\155\177\331\120\276\217\355\315\372\77\346\202\17\320\377\51\123\77\143\352\41\246\176\316\324\303\14\102"
+  "\235\313\35\141\207\131\330\347\54\354\20\13\373\214\205\175\312\134\207\355\355\123\277\320\71\361\245\304\211\57\230\372"
+  "\225\316\146\235\216\44\333\126\13\240\374\53\73\5\137\62\27\174\0\127\252\347\25\46\272\5\32\176\254\6\245\134"
+  "\315\226\210\0\6\253\377\234\271\16\311\24\254\141\352\21\235\202\243\22\5\107\230\172\214\361\65\215\122\260\206\271"
+  "\216\331\51\70\312\134\360\71\202\24\274\52\123\260\6\50\130\143\120\0\350\72\34\147\32\44\124\41\16\365\153\362"
+  "\167\111\332\67\302\115\221\37\371\232\251\337\376\114\325\337\332\155\377\33\346\202\317\327\120\65\0\202\230\136\153\264"
+  "\176\344\0\10\250\126\157\161\35\263\16\215\324\62\365\357\366\72\355\241\111\43\324\74\23\202\116\17\14\100\66\262"
+  "\340\102\166\164\317\0\7\52\131\327\106\141\74\257\63\200\101\135\373\273\235\317\165\314\5\37\240\366\37\172\43\376"
+  "\111\215\140\324\210\177\60\365\273\137\321\210\265\241\32\361\147\306\377\374\63\215\130\373\163\215\170\203\1\14\66\342"
+  "\73\173\43\376\311\134\360\1\152\217\333\255\101\264\350\4\265\110\45\105\74\316\324\223\77\143\12\47\355\270\117\60"
+  "\27\174\216\133\72\220\2\52\271\211\351\252\207\304\352\152\362\46\245\235\65\323\302\41\155\263\156\341\116\50\263\305"
+  "\50\263\204\111\245\266\32\245\314\124\54\267\215\221\231\141\123\25\327\247\264\117\5\327\103\237\305\30\25\106\170\247"
+  "\30\235\133\14\124\213\43\153\64\106\53\242\145\213\214\62\377\151\30\240\341\160\117\214\345\226\212\201\135\254\155\231"
+  "\342\337\63\176\333\250\217\341\102\214\337\214\261\32\257\103\276\300\120\255\251\71\223\363\73\126\351\33\105\123\141\0"
+  "\25\41\61\247\23\315\242\103\2\366\203\242\361\142\246\343\247\227\36\252\160\230\7\322\366\230\63\305\51\364\176\31"
+  "\212\305\10\361\221\172\355\155\201\230\206\17\161\343\307\265\315\172\345\300\255\125\262\4\40\170\343\251\264\200\30\4"
+  "\240\307\312\143\365\24\300\231\352\241\310\256\270\120\213\175\60\142\345\55\66\64\75\45\64\66\0\27\275\334\104\120"
+  "\357\224\311\254\14\101\346\163\114\246\263\122\256\140\75\13\101\150\145\3\102\53\5\241\317\63\231\122\33\242\77\261"
+  "\20\244\126\32\244\6\114\106\13\126\3\165\17\70\366\331\136\203\141\115\116\341\136\246\71\273\337\231\334\51\363\210"
+  "\127\236\305\247\65\30\334\277\167\232\161\37\77\315\254\106\323\52\103\6\45\31\155\300\151\45\72\226\204\307\75\170"
+  "\154\71\273\112\321\117\233\131\41\201\164\322\64\25\343\232\14\136\244\313\110\154\134\205\301\107\52\106\54\106\72\265"
+  "\57\150\356\76\231\77\16\11\155\276\327\317\351\326\321\16\263\160\122\236\14\267\101\345\130\213\44\37\342\322\151\65"
+  "\330\204\33\263\160\306\7\263\150\312\54\25\303\241\137\134\153\134\120\255\212\216\74\250\326\232\276\374\206\45\163\146"
+  "\165\15\121\353\113\126\255\372\260\102\227\356\313\230\41\244\153\120\145\316\6\122\157\216\171\66\27\364\52\246\265\20"
+  "\151\372\136\66\123\135\243\202\264\301\332\44\221\212\335\222\325\103\322\356\13\104\372\32\72\371\140\223\265\146\100\365"
+  "\375\24\117\266\0\357\272\4\147\104\161\12\246\15\216\163\255\23\47\13\130\360\131\270\164\151\2\6\134\371\156\153"
+  "\6\306\352\140\136\247\260\224\334\5\350\267\224\243\153\272\21\7\343\56\40\373\334\213\230\157\241\56\41\134\364\124"
+  "\351\324\0\315\275\224\251\3\265\1\210\154\51\13\352\255\202\306\0\306\234\323\122\26\66\0\230\65\300\65\20\113"
+  "\245\102\363\50\113\345\157\212\371\205\305\70\167\40\11\344\215\20\2\331\324\250\100\150\253\266\321\13\234\21\53\330"
+  "\305\372\1\74\341\345\55\327\156\370\340\160\120\271\216\340\202\245\236\61\275\251\225\5\313\35\107\210\1\110\107\42"
+  "\374\17\226\17\213\15\332\54\123\45\271\67\154\265\50\160\12\132\252\336\241\16\120\7\252\375\325\176\150\321\60\340"
+  "\276\134\13\353\27\326\77\154\40\60\11\31\56\342\1\150\53\60\117\252\302\325\137\316\13\147\177\64\63\6\206\50"
+  "\264\304\314\35\20\134\314\312\272\303\176\354\333\144\342\367\202\211\105\377\111\46\352\14\371\343\177\224\203\62\227\372"
+  "\67\311\245\201\215\163\151\100\23\62\151\214\203\77\10\16\366\371\317\252\241\301\223\247\56\201\211\372\342\227\215\217"
+  "\101\15\243\16\206\316\300\241\353\221\320\72\330\131\321\236\371\264\40\344\243\300\352\34\204\124\23\304\326\20\161\232"
+  "\315\170\237\322\317\54\5\351\313\12\302\373\165\10\175\264\11\43\2\343\305\170\325\264\246\155\274\375\316\132\135\224"
+  "\217\335\30\213\143\372\131\27\171\51\260\251\155\107\342\165\43\372\132\216\171\114\105\154\41\52\57\250\323\256\374\353"
+  "\207\264\205\150\170\257\371\227\17\257\171\207\322\157\171\54\347\325\250\331\253\50\175\376\113\154\352\341\357\372\122\172"
+  "\313\37\56\264\372\342\126\265\221\23\11\356\163\362\256\6\0\277\343\346\7\257\275\251\233\266\15\357\167\77\70\172"
+  "\331\321\30\45\5\357\107\263\107\332\345\65\73\106\350\147\57\214\335\360\326\353\57\67\100\351\236\300\317\61\76\141"
+  "\45\166\172\270\333\240\310\134\305\267\115\75\204\10\115\252\230\247\310\12\110\376\327\32\355\13\147\167\271\13\304\332"
+  "\352\233\272\32\31\214\260\364\105\132\225\52\200\177\105\2\201\245\101\24\55\370\234\274\300\123\24\142\135\211\142\15"
+  "\54\124\205\13\111\105\264\133\166\56\63\252\311\220\221\203\142\146\310\210\155\73\275\304\332\52\161\300\130\137\224\362"
+  "\11\277\173\202\264\366\210\25\10\312\364\355\233\24\14\371\120\325\175\113\160\151\374\107\141\201\53\124\335\245\350\346"
+  "\227\141\54\310\242\35\236\147\377\136\53\214\11\332\170\253\50\270\231\104\320\334\62\305\134\117\267\237\177\13\141\211"
+  "\137\151\342\265\157\206\210\132\313\353\360\246\376\245\113\372\227\56\351\137\272\244\177\351\222\376\245\377\62\375\113\227"
+  "\364\57\135\322\277\164\111\377\322\57\305\350\62\254\206\310\236\11\127\117\245\205\374\230\20\347\47\53\231\315\370\376"
+  "\247\32\237\56\214\117\360\300\223\201\352\57\333\224\145\201\55\123\154\26\130\44\166\124\312\273\220\344\75\311\202\21"
+  "\200\333\123\340\71\317\102\30\344\171\34\230\301\327\171\246\333\344\171\146\30\345\377\240\362\10\306\201\177\250\64\116"
+  "\75\12\76\101\3\211\121\255\33\274\210\347\47\141\367\367\223\335\203\251\147\226\341\31\360\164\143\7\306\5\106\63"
+  "\30\77\143\355\225\216\375\366\75\27\115\236\337\136\300\202\317\142\233\173\47\15\217\120\316\332\340\106\207\162\166\65"
+  "\376\340\253\273\364\224\45\114\117\253\142\322\370\350\370\105\331\35\234\270\264\216\231\6\336\356\13\100\135\250\63\303"
+  "\21\2\331\76\331\321\74\45\36\160\124\164\101\336\170\53\355\216\304\315\147\162\16\351\22\276\125\204\101\21\373\341"
+  "\17\371\111\200\141\260\100\25\75\52\46\132\160\235\120\56\165\126\102\156\355\366\71\113\73\34\315\212\64\211\66\261"
+  "\137\105\274\173\53\170\123\11\156\5\371\15\115\1\26\321\115\270\161\303\215\233\116\306\115\212\161\63\270\261\255\40"
+  "\231\72\100\13\3\362\32\343\46\312\270\351\142\334\334\36\2\211\173\52\277\300\244\103\5\74\23\117\120\352\307\42"
+  "\120\364\224\155\116\132\232\371\250\14\266\254\52\175\303\236\70\164\42\316\243\247\57\301\145\35\172\147\354\105\175\3"
+  "\330\213\52\156\73\22\75\235\330\171\21\362\205\10\365\314\357\257\120\3\115\274\265\325\172\331\1\276\20\241\236\311"
+  "\157\104\250\147\364\112\4\353\55\10\356\64\174\201\47\16\357\72\204\172\235\224\361\332\202\113\170\343\224\151\55\41"
+  "\172\325\324\160\60\152\375\260\174\373\63\342\344\201\274\271\346\44\276\231\104\176\37\203\64\334\311\276\334\141\214\164"
+  "\140\200\336\17\6\65\251\60\166\221\373\344\1\346\303\66\32\236\110\257\44\225\272\340\255\122\37\46\116\206\267\223"
+  "\337\353\320\340\15\4\352\40\165\230\72\124\35\254\16\41\22\206\204\15\16\33\32\66\54\154\220\153\210\25\303\264"
+  "\166\15\66\37\266\266\166\15\335\251\174\340\116\10\224\175\242\2\125\303\314\7\240\152\220\123\275\123\35\245\216\124"
+  "\107\250\303\11\335\360\260\21\141\43\303\106\205\335\351\32\56\237\240\32\141\76\124\264\166\215\224\33\71\112\156\344"
+  "\235\362\313\13\232\137\112\63\323\360\125\123\342\175\67\321\65\112\367\75\266\340\4\317\337\351\252\31\300\165\253\136"
+  "\273\33\274\150\2\207\151\116\236\212\266\333\320\63\241\164\305\262\266\72\132\335\305\364\265\370\154\30\242\212\125\370"
+  "\135\372\102\174\172\153\134\143\227\117\6\272\53\124\373\311\277\12\125\337\45\177\52\150\343\53\224\335\305\54\206\160"
+  "\163\327\132\125\167\261\241\157\264\75\311\2\245\155\226\367\252\324\247\74\301\254\321\334\154\225\172\24\334\2\25\34"
+  "\73\56\147\15\202\107\373\221\40\253\57\167\317\126\371\162\323\117\314\126\227\60\110\61\364\352\343\173\35\322\273\30"
+  "\214\116\40\241\144\175\367\366\263\326\7\32\355\4\102\171\377\160\140\204\333\147\106\255\172\155\222\137\367\321\354\240"
+  "\117\34\31\225\235\270\261\43\15\10\365\341\77\173\256\336\5\43\142\72\143\240\43\16\115\302\275\72\260\24\103\357"
+  "\377\132\24\62\73\125\112\60\136\212\162\341\370\327\27\112\345\127\365\310\233\276\33\326\120\115\165\100\107\0\4\24"
+  "\341\130\15\277\365\203\12\6\327\350\24\350\34\41\316\71\222\70\103\14\1\142\33\227\142\265\25\270\113\102\332\201"
+  "\7\31\166\67\62\311\55\44\40\17\357\214\235\203\240\257\107\104\261\42\373\221\30\41\217\42\61\250\252\64\130\27"
+  "\212\257\26\342\303\336\340\227\111\30\105\145\21\65\315\307\377\236\244\44\50\131\140\322\31\22\7\233\53\204\125\252"
+  "\313\12\372\67\264\271\330\106\16\4\56\147\172\127\326\250\21\222\271\355\157\360\242\26\131\257\355\261\367\112\26\264"
+  "\21\277\201\350\155\23\61\326\220\116\227\152\204\175\104\123\335\340\35\45\162\170\25\232\127\166\325\221\315\326\272\27"
+  "\306\12\176\126\72\336\320\50\72\17\214\221\203\13\243\17\166\312\57\226\162\51\46\263\40\346\160\142\330\101\61\307"
+  "\175\102\42\75\365\160\343\176\325\230\320\232\247\372\261\265\342\220\115\237\24\61\142\23\177\135\240\207\367\334\257\156"
+  "\146\356\171\52\277\137\265\222\201\344\373\301\213\103\232\165\164\375\111\74\322\236\121\316\176\253\360\171\340\321\333\257"
+  "\147\163\100\266\126\114\264\231\121\272\23\145\136\243\44\242\227\377\111\1\57\137\40\237\44\17\165\177\230\356\315\61"
+  "\220\171\277\72\304\230\6\32\72\137\64\264\37\66\64\326\357\177\100\365\143\154\145\36\32\317\240\115\334\236\330\355"
+  "\312\273\77\374\364\362\261\47\326\236\362\136\120\74\17\250\104\322\74\161\340\61\226\107\257\67\150\274\0\64\312\252"
+  "\344\151\160\316\330\43\336\367\141\216\323\216\322\100\152\311\342\305\342\54\61\334\57\214\354\273\220\316\6\303\375\265"
+  "\157\117\201\317\76\272\117\373\155\106\311\373\275\337\246\373\66\267\154\270\352\226\15\73\274\215\156\266\217\336\150\177"
+  "\113\100\1\276\371\243\22\177\63\364\223\241\17\212\226\337\250\213\270\110\227\260\75\340\336\251\224\174\275\347\313\163"
+  "\212\70\27\361\114\332\55\17\317\173\167\127\17\143\137\266\276\223\72\202\203\124\246\257\337\73\114\34\171\330\251\274"
+  "\164\76\377\201\360\53\356\65\251\23\123\116\146\315\17\211\232\335\162\315\301\325\336\364\273\326\337\314\333\46\116\37"
+  "\344\16\376\347\341\333\236\70\247\127\153\37\201\336\73\46\354\102\175\375\347\133\251\32\50\167\133\67\347\27\167\352"
+  "\302\306\127\20\110\325\76\254\52\152\171\200\5\100\251\313\375\217\250\1\377\243\252\130\4\217\152\270\320\55\117\106"
+  "\307\321\262\364\46\346\176\24\72\275\207\330\16\345\265\326\357\14\370\14\315\376\121\125\136\325\134\116\253\230\217\250"
+  "\236\216\220\141\254\327\15\66\326\62\51\201\26\62\303\207\364\300\4\134\307\71\315\326\131\163\321\130\12\36\343\254"
+  "\251\150\300\325\111\236\217\26\253\263\326\302\316\143\52\275\354\334\101\377\263\303\122\154\343\2\71\145\31\246\74\56"
+  "\247\204\263\256\220\264\120\116\172\32\201\236\220\123\226\143\312\37\124\106\157\74\156\46\376\143\0\20\317\315\341\354"
+  "\367\170\34\105\316\210\302\14\174\101\3\144\74\331\130\306\42\71\243\7\146\364\10\147\267\342\231\12\314\50\323\63"
+  "\122\121\5\140\30\160\33\156\114\227\311\131\214\344\54\151\10\272\6\323\227\312\220\53\60\145\131\50\244\367\100\306"
+  "\323\166\106\314\202\244\345\366\244\12\54\277\302\236\166\57\246\125\332\323\356\307\264\52\275\236\53\215\172\302\31\307"
+  "\201\14\12\62\125\334\213\123\317\74\165\65\302\127\137\72\374\52\204\137\151\257\363\14\246\255\262\247\175\217\151\253"
+  "\355\151\77\140\332\32\173\332\131\114\173\306\236\366\43\246\255\265\247\375\204\151\317\232\374\243\301\46\106\364\341\60"
+  "\4\205\234\165\101\234\121\41\355\71\173\332\34\114\133\157\117\233\213\151\317\103\132\71\53\207\264\162\36\361\70\142"
+  "\373\223\234\362\20\246\274\40\247\74\202\51\57\312\51\217\142\312\6\71\345\61\114\171\111\116\131\200\51\57\103\13"
+  "\312\41\251\31\332\171\152\71\162\364\51\114\177\105\117\157\143\244\157\142\262\14\214\47\103\12\213\260\314\253\277\254"
+  "\314\223\130\346\65\101\321\30\54\22\325\324\12\227\360\46\60\222\353\372\231\10\72\255\145\160\314\70\330\272\257\367"
+  "\163\312\330\144\54\120\75\250\276\46\371\13\151\345\352\141\365\222\126\0\355\30\372\33\211\17\111\211\3\55\310\45"
+  "\354\265\340\5\77\204\225\223\357\330\41\166\300\33\36\151\243\150\373\260\113\154\173\210\46\76\364\57\67\361\241\120"
+  "\115\264\267\146\140\350\326\14\10\305\245\340\46\276\56\232\330\206\24\16\363\136\272\355\20\64\201\4\51\136\126\200"
+  "\267\7\266\177\246\47\212\367\236\220\342\334\7\150\1\303\237\5\6\217\211\101\121\16\141\220\35\41\160\174\46\275"
+  "\54\35\113\315\307\122\6\136\105\71\150\124\126\57\45\32\225\155\23\24\100\45\157\350\232\73\126\150\56\306\325\233"
+  "\324\0\116\3\156\122\115\305\203\272\240\336\124\353\111\257\71\140\340\375\124\242\305\252\211\247\76\306\170\352\247\266"
+  "\72\15\44\167\10\224\153\231\276\156\152\116\232\122\275\17\213\327\2\203\341\30\155\253\66\337\163\244\244\214\110\221"
+  "\136\174\0\117\264\360\143\344\126\244\157\223\116\366\302\23\345\156\122\41\160\365\41\153\161\302\214\156\134\212\316\57"
+  "\334\36\201\225\334\3\317\377\17";
+
+/* lib/stat.wbo (DEFLATEd, org. size 1553) */
+static unsigned char file_l_57[804] =
+  "\265\123\133\156\323\100\24\235\207\235\7\161\33\267\220\222\276\47\356\264\115\112\323\46\151\233\26\361\303\116\254\64"
+  "\261\133\213\74\54\333\120\361\63\123\261\6\126\300\17\77\54\242\221\20\360\301\22\130\101\373\5\33\200\73\176\124"
+  "\25\110\40\41\120\62\236\271\347\334\173\317\315\31\7\135\234\116\160\127\13\243\136\104\373\101\104\103\237\347\106\316"
+  "\150\22\274\134\270\350\205\236\35\216\173\176\170\76\211\154\77\160\136\170\316\105\273\354\16\154\327\33\72\252\302\76"
+  "\163\242\212\337\213\316\355\176\340\364\42\307\36\170\201\323\217\240\170\56\106\357\346\345\302\50\360\306\147\152\33\72"
+  "\143\335\11\202\361\104\167\373\343\150\150\270\336\170\140\7\316\120\325\124\42\157\244\152\106\276\35\115\354\70\360\235"
+  "\176\361\26\45\176\104\375\161\110\275\66\247\136\207\317\102\222\377\374\164\350\365\155\45\104\274\61\235\74\217\250\167"
+  "\0\354\41\254\43\130\135\130\307\260\116\140\75\346\232\327\156\251\107\233\23\370\236\160\162\314\111\227\223\43\116\16"
+  "\71\71\340\244\303\165\67\156\345\16\210\37\252\71\47\1\75\365\71\165\175\236\217\231\136\244\251\111\163\275\310\35"
+  "\366\316\162\103\365\14\165\370\351\356\100\37\252\204\374\350\31\104\220\66\232\14\34\75\16\60\52\122\102\261\304\104"
+  "\103\10\116\110\152\172\216\110\211\141\317\123\231\34\12\272\224\311\261\170\17\122\45\55\225\40\317\230\211\363\12\32"
+  "\236\105\124\110\211\52\242\54\204\51\305\234\24\363\122\334\227\314\264\346\131\171\212\56\137\337\174\241\357\360\45\76"
+  "\106\224\315\131\367\357\140\257\360\133\334\105\244\254\341\7\10\272\241\67\130\124\244\130\110\33\210\207\122\124\245\130"
+  "\224\142\111\212\145\51\126\244\130\225\142\115\212\165\311\26\240\167\245\201\250\352\271\60\105\205\153\4\215\53\215\102"
+  "\6\230\0\74\4\240\232\1\125\0\252\123\204\100\116\205\14\302\105\340\131\314\127\32\365\70\251\176\215\324\166\205"
+  "\256\221\211\147\1\156\305\160\53\201\337\337\302\47\61\174\222\300\237\22\230\60\122\43\26\331\40\234\154\222\55\262"
+  "\315\52\115\23\115\21\276\101\263\171\143\333\330\62\66\15\156\154\30\226\121\63\130\151\73\33\151\211\55\325\21\1"
+  "\103\256\360\67\65\33\160\133\31\267\314\226\123\16\145\334\146\306\255\260\225\204\273\274\255\343\31\267\312\126\123\216"
+  "\144\334\106\311\312\330\65\266\226\262\64\143\153\31\267\316\326\123\305\333\112\6\227\123\307\361\125\157\213\206\24\73"
+  "\122\74\222\142\127\212\246\272\245\15\102\255\135\145\330\15\262\346\153\115\326\140\115\66\317\11\65\365\234\365\150\212"
+  "\276\177\247\137\301\3\364\21\151\117\131\26\363\122\151\212\44\333\205\264\162\11\101\301\216\211\37\100\122\202\150\170"
+  "\17\153\311\353\366\104\351\355\307\222\55\51\332\277\23\206\362\132\233\265\300\356\130\357\203\322\153\103\364\15\140\320"
+  "\150\260\66\333\207\117\74\132\361\36\153\232\172\341\257\347\303\211\33\233\351\150\235\137\206\62\123\63\366\63\63\214"
+  "\31\253\3\55\325\124\123\364\371\147\201\16\153\202\351\154\7\44\114\274\227\251\34\374\67\25\174\107\345\20\47\177"
+  "\362\152\152\365\221\62\31\354\2\263\300\47\123\317\377\301\45\350\14\4\64\352\46\343\362\264\311\277\32\367\310\304"
+  "\207\11\366\3";
+
+/* lib/stdio.wbo (DEFLATEd, org. size 39798) */
+static unsigned char file_l_58[14880] =
+  "\355\175\151\200\124\305\265\360\255\272\335\103\303\235\221\26\227\147\206\20\157\17\44\321\50\276\31\140\6\64\17\30"
+  "\215\262\310\316\7\52\111\336\33\206\351\156\350\314\60\323\366\64\213\21\273\21\1\167\21\243\306\227\105\105\105\114"
+  "\2\106\215\211\211\232\310\20\331\21\5\167\134\120\4\205\101\331\134\342\2\362\235\245\352\56\335\75\14\30\363\276"
+  "\357\307\33\270\175\353\326\255\72\165\352\234\123\247\116\125\235\252\153\314\230\324\44\226\230\301\346\164\64\321\144\326"
+  "\245\322\146\163\262\107\321\324\330\324\246\324\145\47\317\250\155\116\324\64\67\326\46\233\247\64\245\153\222\251\330\364"
+  "\104\154\106\105\347\170\264\46\236\150\210\65\247\153\323\65\223\143\151\53\131\233\236\122\223\212\65\326\116\215\5\143"
+  "\251\124\143\123\260\56\175\131\62\326\41\321\34\115\114\116\244\341\336\234\254\255\213\165\110\67\65\64\315\210\245\212"
+  "\232\323\251\104\343\144\54\244\156\12\75\65\304\32\103\160\203\274\115\251\16\30\135\227\274\14\342\243\15\211\111\370"
+  "\72\335\24\355\100\267\206\206\20\335\247\65\64\4\342\251\130\254\150\152\155\103\103\123\135\207\124\214\356\105\265\351"
+  "\330\314\104\72\30\257\153\114\67\4\232\222\261\306\342\170\242\61\12\250\65\40\212\105\323\32\23\0\64\0\251\243"
+  "\301\31\251\104\72\126\104\277\323\203\111\212\152\150\216\305\352\203\165\15\115\315\261\242\104\163\155\72\175\131\150\132"
+  "\143\103\242\261\276\66\335\41\65\65\232\110\325\246\255\104\143\42\235\250\155\110\374\64\26\15\324\44\232\46\5\243"
+  "\315\175\372\364\300\337\312\36\341\232\324\145\323\152\222\115\63\52\153\232\223\15\211\164\257\23\335\210\104\343\164\25"
+  "\171\274\33\331\24\217\67\307\322\315\47\371\223\251\330\316\156\154\272\166\122\103\14\312\350\127\201\45\365\353\105\277"
+  "\275\351\267\117\217\42\254\142\74\51\341\177\257\36\262\242\207\354\335\43\104\165\0\222\230\361\144\242\50\116\117\235"
+  "\134\314\315\104\105\17\63\321\13\256\336\75\72\0\31\221\120\41\144\50\62\60\60\265\51\32\13\44\33\246\65\27"
+  "\65\305\33\152\47\67\313\170\324\114\364\201\304\175\341\252\202\253\22\256\176\75\144\145\17\331\247\207\254\352\41\373"
+  "\366\220\375\172\230\25\0\263\242\274\207\74\273\107\60\216\0\3\10\254\50\36\305\260\231\70\273\107\40\1\157\341"
+  "\7\222\245\142\315\105\361\70\224\60\245\250\66\32\235\64\55\36\102\161\152\200\100\20\371\120\27\214\343\315\204\347"
+  "\100\63\240\33\254\153\232\326\230\66\223\351\124\260\261\41\26\117\213\306\20\261\15\337\117\252\155\106\46\246\353\246"
+  "\324\167\254\41\220\20\53\352\314\111\311\36\120\167\240\15\245\14\324\101\346\100\43\26\20\117\116\113\67\213\346\140"
+  "\143\264\251\61\46\222\46\110\112\0\243\350\5\224\14\342\314\277\315\262\271\34\4\206\237\121\60\212\230\57\105\115"
+  "\51\220\351\306\140\74\35\153\150\0\374\177\62\255\71\135\224\212\315\0\46\164\300\174\311\246\346\16\230\16\357\160"
+  "\233\216\130\46\52\172\141\325\173\343\117\37\374\251\304\237\252\36\105\220\0\336\103\172\250\146\74\32\114\122\165\251"
+  "\25\4\343\15\115\265\321\0\212\55\60\43\326\30\304\127\321\120\123\103\224\32\230\11\121\46\204\72\305\247\326\46"
+  "\353\246\114\153\254\157\356\310\67\110\46\343\215\162\32\344\5\72\233\200\164\111\115\242\271\246\251\56\135\103\215\121"
+  "\326\115\241\210\150\254\216\43\350\151\112\154\46\77\165\252\201\6\6\144\156\254\151\66\41\324\141\152\355\114\102\252"
+  "\246\66\335\224\20\211\116\40\241\65\200\162\74\226\12\104\153\323\265\146\42\72\23\32\341\114\104\7\52\37\302\327"
+  "\50\111\35\233\323\115\251\30\74\245\315\150\163\332\342\47\254\122\132\304\11\126\243\4\32\316\110\104\261\172\0\103"
+  "\106\353\72\114\156\112\67\47\46\67\42\70\210\11\100\236\44\45\155\16\304\241\275\123\60\152\2\242\146\143\154\162"
+  "\240\261\173\105\71\320\260\57\22\262\137\217\216\65\323\233\33\233\353\152\33\343\105\361\246\324\324\332\264\234\136\53"
+  "\322\201\50\250\250\42\150\122\261\124\32\240\202\220\324\211\231\342\62\310\201\342\330\13\305\261\127\5\376\40\167\172"
+  "\41\167\172\201\234\3\257\114\140\225\331\33\204\272\67\310\174\157\220\371\336\40\363\275\341\135\157\214\207\367\275\101"
+  "\212\173\227\367\60\173\235\15\27\244\353\5\351\172\101\272\136\220\16\141\0\60\23\240\232\0\336\204\162\114\50\320"
+  "\254\300\106\2\351\200\357\46\10\200\131\201\360\40\276\17\244\355\3\151\373\100\332\76\220\26\324\211\11\312\304\354"
+  "\3\351\240\301\233\375\40\256\57\244\353\13\371\373\102\376\276\20\337\27\336\367\205\164\125\20\256\202\160\25\206\1"
+  "\116\25\300\251\202\74\125\10\7\141\103\236\76\220\247\22\342\52\41\256\22\336\127\102\332\112\110\133\11\371\52\41"
+  "\177\45\276\207\164\225\220\276\12\341\303\273\276\220\256\57\344\351\13\171\252\60\276\37\64\45\242\257\131\233\304\6"
+  "\234\16\62\265\233\351\326\101\21\277\303\164\116\124\64\135\75\362\353\220\146\216\125\323\64\55\255\304\247\43\205\33"
+  "\201\263\235\50\104\322\53\223\165\41\172\202\236\306\204\173\220\64\20\10\123\155\52\135\3\102\121\134\323\230\156\252"
+  "\255\141\36\207\100\16\152\323\211\351\61\224\364\272\116\374\252\241\251\161\162\160\172\155\303\64\320\227\50\317\235\335"
+  "\150\372\11\325\114\233\72\255\241\242\127\77\121\53\46\231\311\51\11\131\133\56\153\53\344\244\162\71\251\302\114\226"
+  "\227\303\5\367\12\270\127\124\230\123\23\321\343\152\232\247\44\342\320\141\115\236\222\206\154\262\241\111\116\111\4\242"
+  "\320\221\164\44\345\74\51\1\372\44\326\11\200\117\256\50\207\210\136\156\260\322\242\24\361\332\72\20\177\61\275\243"
+  "\243\320\203\250\266\172\5\243\261\6\150\101\200\216\230\32\200\216\261\34\177\52\314\346\151\123\113\174\35\2\77\101"
+  "\62\102\104\374\44\200\317\41\350\221\123\151\220\357\100\62\126\121\136\224\214\315\204\122\344\324\136\162\352\164\71\75"
+  "\45\247\47\345\364\251\105\100\101\320\152\62\326\313\204\64\342\122\350\46\247\66\115\217\105\73\114\235\112\240\2\261"
+  "\351\240\247\247\117\115\377\64\60\75\225\376\151\307\206\132\64\2\200\150\242\76\120\337\275\342\354\100\242\173\257\362"
+  "\16\51\320\276\321\151\111\253\46\12\355\257\206\312\61\41\125\60\31\215\315\114\312\306\111\146\264\242\74\130\127\233"
+  "\112\135\26\150\356\136\121\41\146\4\51\145\240\21\23\305\23\63\143\121\321\40\242\40\63\123\213\361\205\346\136\0"
+  "\263\167\200\13\37\315\150\123\72\200\215\77\120\13\61\301\232\70\244\13\326\304\350\27\232\175\155\0\142\173\205\246"
+  "\326\66\246\301\224\250\355\10\1\302\263\331\4\116\7\246\243\76\100\23\2\270\22\217\207\350\115\367\212\136\72\320"
+  "\273\23\52\207\44\130\34\151\320\264\124\166\367\216\50\61\211\346\104\123\143\7\222\225\356\147\207\370\136\121\256\3"
+  "\25\201\206\356\25\175\202\240\33\301\326\110\364\102\215\15\55\34\176\120\345\100\233\207\37\324\42\275\121\213\200\72"
+  "\0\15\24\327\145\360\275\110\75\66\363\75\344\340\60\135\105\350\14\320\74\70\320\321\301\263\10\10\5\332\67\304"
+  "\66\125\155\72\10\172\77\36\355\0\277\330\41\4\33\143\63\340\11\176\311\252\341\104\330\65\200\211\22\217\102\263"
+  "\230\101\201\42\146\167\220\36\104\12\144\4\73\26\141\234\152\112\123\144\205\14\30\6\204\214\154\40\130\44\263\131"
+  "\1\367\16\105\131\372\23\131\63\24\202\27\35\73\11\214\357\150\361\255\230\156\45\307\231\224\44\120\322\231\237\303"
+  "\174\73\76\300\131\3\135\116\100\160\263\2\135\116\244\204\231\100\227\223\164\340\144\221\65\2\135\376\215\62\164\71"
+  "\205\113\355\362\15\172\54\355\312\217\245\337\344\173\267\157\251\142\272\235\252\3\266\16\104\260\250\14\206\312\314\154"
+  "\6\41\167\353\116\100\272\365\340\333\267\165\312\357\20\260\311\122\174\327\20\102\30\206\24\247\11\21\230\35\204\240"
+  "\377\57\57\42\347\117\266\223\246\110\245\371\337\277\377\375\73\252\77\51\116\7\211\352\50\206\216\34\64\164\344\320"
+  "\161\23\60\346\173\20\323\101\214\74\167\344\151\337\73\35\237\317\60\104\350\71\221\53\166\141\35\370\113\37\263\327"
+  "\143\37\55\73\61\374\132\351\37\102\267\214\73\256\244\374\212\333\116\34\374\170\151\74\264\140\304\167\226\255\232\372"
+  "\361\35\117\315\333\366\330\5\307\257\273\175\136\377\133\376\332\155\367\301\105\247\114\174\175\357\330\223\377\343\226\7"
+  "\313\254\77\267\74\172\325\257\173\376\50\70\151\313\67\313\207\147\26\214\274\376\221\37\235\374\321\330\273\256\277\150"
+  "\161\227\57\136\230\63\375\7\37\134\267\157\301\173\237\125\234\24\373\306\51\243\367\377\362\325\13\117\330\363\350\151"
+  "\303\367\335\77\277\345\333\247\232\65\53\222\353\357\34\172\362\273\347\135\363\253\363\167\333\47\76\24\13\125\55\153"
+  "\134\74\157\336\276\165\47\156\73\144\226\132\327\376\367\145\57\76\334\277\343\53\133\176\176\116\345\356\147\303\113\253"
+  "\6\376\127\363\23\375\236\35\60\171\354\347\347\377\376\361\223\240\146\147\102\315\366\211\334\252\331\175\106\307\226\327"
+  "\254\275\177\354\23\47\254\177\360\351\352\25\247\24\255\331\172\251\361\342\3\263\76\156\352\274\345\222\203\337\75\241"
+  "\161\360\105\225\127\364\260\143\162\365\173\123\266\337\160\137\267\135\357\312\51\57\77\163\166\355\145\63\16\256\250\376"
+  "\321\336\223\57\273\341\315\37\34\136\62\346\263\205\37\76\62\363\343\277\376\355\370\235\27\357\172\151\347\337\166\136"
+  "\376\320\270\245\13\346\336\70\255\153\153\367\373\376\173\327\147\317\137\377\330\275\227\126\327\156\31\160\322\306\167\6"
+  "\254\157\376\154\110\350\206\237\77\372\335\27\273\46\303\367\74\265\367\57\273\347\365\72\151\304\243\43\36\375\345\23"
+  "\115\337\270\375\117\35\32\76\175\157\317\262\252\127\37\375\170\141\345\203\47\224\225\235\362\373\221\77\231\62\142\341"
+  "\226\337\366\37\125\235\376\326\135\177\275\363\255\242\105\313\357\270\170\305\222\103\367\35\167\363\277\35\167\305\320\113"
+  "\233\337\261\27\74\142\277\62\75\170\342\367\273\314\353\237\356\163\345\11\77\170\150\331\351\77\255\371\356\107\225\337"
+  "\204\232\367\64\104\140\134\41\115\122\175\333\204\304\204\361\343\307\215\77\151\374\370\213\2\301\223\316\15\217\33\137"
+  "\175\301\230\361\347\127\137\60\372\374\321\343\307\137\140\124\33\325\325\201\363\157\217\215\277\150\374\5\325\27\214\33"
+  "\163\356\111\325\343\27\216\207\277\352\61\244\320\244\70\13\200\137\42\306\135\60\156\334\5\343\203\1\43\34\10\237"
+  "\30\250\106\315\125\75\176\374\111\347\216\3\215\177\76\153\261\352\163\41\70\372\374\13\106\217\63\260\310\330\30\4"
+  "\56\120\305\1\244\343\307\215\31\63\156\374\370\240\161\322\271\243\15\43\120\35\26\201\240\222\331\177\147\211\324\370"
+  "\7\325\375\33\352\176\205\272\137\252\124\141\145\61\337\73\366\347\173\317\12\316\371\366\307\234\63\366\114\67\272\177"
+  "\46\157\243\373\33\307\355\242\234\143\56\274\361\70\274\337\326\274\142\10\336\167\235\273\241\36\163\336\70\364\120\151"
+  "\7\270\267\64\35\230\337\35\356\53\317\172\362\236\207\341\376\352\256\245\75\147\232\206\321\177\341\304\355\227\34\157"
+  "\30\25\57\155\233\366\344\105\206\361\361\131\215\43\36\174\130\30\153\133\277\163\325\344\231\41\343\203\333\126\54\10"
+  "\376\360\173\306\242\17\66\154\354\272\342\171\343\333\367\31\235\256\137\127\26\200\232\225\103\345\3\242\261\266\21\253"
+  "\131\1\17\101\21\157\114\364\304\247\136\372\351\14\174\352\115\11\341\11\110\43\372\300\103\66\222\251\314\312\252\53"
+  "\304\151\106\244\322\354\153\127\142\250\305\230\35\154\65\326\32\53\215\222\52\331\317\256\74\55\54\133\214\253\304\176"
+  "\170\141\254\2\232\332\225\235\55\303\202\27\55\206\335\12\371\212\373\132\175\255\52\170\331\71\40\316\206\32\235\232"
+  "\71\107\303\74\7\140\236\123\0\346\71\16\114\0\167\116\130\174\277\224\40\236\303\20\317\141\210\0\356\77\0\334"
+  "\231\231\376\331\314\200\154\146\140\366\12\350\12\241\126\53\41\23\224\26\356\326\43\120\315\260\303\255\106\131\177\273"
+  "\377\151\6\0\135\156\34\60\252\14\151\101\264\360\44\1\270\234\156\200\75\300\237\156\263\20\147\207\273\174\243\24"
+  "\241\227\15\204\134\347\30\206\205\165\251\26\334\25\357\20\231\163\263\231\363\262\100\252\314\17\262\231\363\263\231\13"
+  "\262\16\116\231\101\331\314\340\154\146\110\66\63\64\233\271\320\213\142\130\374\207\145\40\221\214\325\104\64\254\145\60"
+  "\54\372\104\52\125\64\320\62\13\305\5\355\163\351\301\322\217\347\351\107\254\45\220\132\366\225\303\344\160\331\117\126"
+  "\331\347\341\113\1\44\72\357\114\303\210\364\157\61\336\66\354\376\253\214\222\176\55\120\33\12\15\157\61\376\301\241"
+  "\252\342\141\310\225\331\167\317\231\55\42\347\3\111\41\321\225\167\317\126\17\220\156\366\354\331\66\205\207\121\71\175"
+  "\345\10\163\244\215\200\3\325\162\224\34\55\307\310\261\71\5\16\150\61\316\260\7\0\354\261\55\306\247\6\205\306"
+  "\24\217\266\306\332\347\23\264\273\305\1\3\0\216\262\306\160\204\176\34\155\215\52\36\11\14\36\151\215\260\317\265"
+  "\317\17\227\166\55\273\0\212\134\343\324\20\311\161\42\360\146\240\175\1\260\304\256\54\33\4\361\24\152\61\2\20"
+  "\77\30\3\41\10\14\301\100\61\4\206\252\4\103\201\227\170\37\242\356\225\314\344\13\35\214\120\152\51\300\324\236"
+  "\55\202\120\237\26\110\311\11\354\375\106\127\213\40\301\63\212\143\66\77\347\152\3\362\20\173\154\104\173\51\146\17"
+  "\167\53\243\340\363\372\235\142\60\74\60\177\101\176\376\217\40\13\256\103\146\34\112\217\75\216\30\33\26\325\360\152"
+  "\74\277\272\127\240\50\261\144\71\2\305\242\304\142\165\141\66\163\121\66\163\161\66\163\111\236\144\201\44\225\51\51"
+  "\312\241\142\177\115\305\1\56\25\221\50\3\375\104\35\242\211\72\124\23\125\123\175\220\42\246\42\156\233\362\67\230"
+  "\344\157\260\43\177\30\252\42\371\303\320\160\224\77\227\41\27\122\253\23\324\350\120\30\175\264\54\265\206\353\224\27"
+  "\331\27\121\112\251\123\26\224\316\174\331\274\30\145\363\142\224\315\342\61\40\221\12\332\45\112\175\315\42\156\252\322"
+  "\101\100\75\22\211\254\372\276\100\343\173\20\362\141\2\110\111\66\62\101\267\320\152\173\2\221\326\253\260\370\41\260"
+  "\237\44\312\10\42\347\177\150\31\230\347\264\23\241\66\335\35\331\76\263\107\50\104\320\240\50\204\21\220\254\15\262"
+  "\24\306\42\116\151\65\126\173\104\210\0\317\226\252\224\200\14\167\71\231\263\102\12\320\141\327\177\152\2\72\1\361"
+  "\43\320\334\306\217\175\122\63\210\244\146\210\222\32\17\212\325\232\337\375\125\171\112\4\212\111\27\62\116\41\212\15"
+  "\352\224\40\50\327\204\302\135\376\215\122\72\110\127\73\142\242\42\147\207\120\247\206\132\275\62\66\224\204\6\353\160"
+  "\300\7\162\110\176\341\203\175\205\353\152\206\110\130\360\15\104\102\125\177\114\234\171\112\140\145\317\311\146\376\263\315"
+  "\52\103\103\311\127\276\214\374\52\325\74\177\344\60\22\370\270\322\103\160\241\351\344\355\110\130\130\200\67\331\316\212"
+  "\175\230\366\151\3\323\36\125\367\326\142\240\320\55\347\342\241\223\373\141\241\116\316\255\365\0\135\153\277\174\101\207"
+  "\120\171\132\61\63\142\67\340\21\371\117\150\331\3\111\324\130\212\376\63\334\355\133\112\153\122\313\205\54\273\235\146"
+  "\14\265\337\250\352\106\115\375\64\154\326\212\107\202\10\17\4\353\214\105\140\114\166\265\207\16\103\110\251\2\262\56"
+  "\47\303\304\266\301\24\35\76\140\270\270\372\51\250\33\173\146\277\346\54\326\262\354\42\126\57\110\320\200\370\57\241"
+  "\306\334\33\105\246\46\233\231\230\315\324\222\32\234\224\315\324\145\63\321\134\66\333\65\221\111\366\104\157\247\131\233"
+  "\323\113\332\265\366\304\367\215\110\235\254\62\373\102\214\62\135\210\2\33\260\305\325\241\300\76\353\252\162\106\374\105"
+  "\342\21\164\16\236\66\10\204\235\144\327\1\125\313\242\234\71\117\64\302\100\25\73\112\10\164\145\62\324\332\165\366"
+  "\104\154\16\100\173\173\342\36\143\67\241\64\311\216\2\247\1\230\35\175\6\301\324\142\44\74\354\6\74\213\373\221"
+  "\114\151\4\111\100\177\14\264\41\151\51\14\116\13\12\62\121\233\61\314\353\122\224\11\214\36\150\17\364\360\266\124"
+  "\25\21\211\142\251\153\21\162\135\44\112\210\125\236\26\222\166\364\72\120\50\32\111\5\235\205\10\343\130\250\130\132"
+  "\20\147\174\56\124\23\253\237\327\2\214\31\330\140\253\221\227\161\37\43\111\132\43\161\56\71\16\31\243\272\310\376"
+  "\166\134\165\130\336\106\246\164\53\312\176\34\5\37\223\40\315\327\41\367\242\314\247\270\35\15\167\73\325\253\101\125"
+  "\127\247\310\300\262\313\115\230\321\233\114\350\15\166\164\147\1\235\201\30\164\101\261\220\253\135\35\61\107\251\14\206"
+  "\345\12\4\277\155\242\344\312\240\54\254\166\102\334\134\127\271\262\207\265\134\351\101\235\252\357\264\164\145\303\42\316"
+  "\123\330\132\330\40\62\11\152\43\77\311\146\352\211\250\375\75\172\220\215\320\13\311\132\270\10\15\206\356\322\54\373"
+  "\11\240\271\33\172\301\110\275\135\151\137\322\103\232\141\61\131\151\163\250\210\375\23\210\101\3\23\232\214\143\350\157"
+  "\246\26\261\102\141\317\150\27\313\147\241\101\71\354\102\171\160\264\44\311\11\240\236\0\263\331\36\320\23\373\251\116"
+  "\104\267\204\6\217\45\45\220\20\61\22\357\256\72\136\25\170\62\226\127\104\305\325\3\343\10\216\307\2\104\66\327"
+  "\223\55\177\52\65\124\57\344\334\136\307\141\267\116\140\365\363\320\272\204\244\224\20\51\125\321\313\215\375\36\355\210"
+  "\372\316\326\152\117\125\154\60\43\64\230\53\246\131\32\203\226\5\262\351\232\65\334\72\56\314\327\270\150\314\330\332"
+  "\246\121\60\57\46\230\250\25\25\151\10\27\64\105\31\357\200\150\320\332\361\105\131\130\73\116\315\146\32\265\40\264"
+  "\335\41\262\345\230\43\10\155\153\122\325\333\150\101\121\272\325\41\266\122\260\312\166\1\311\170\326\147\14\51\323\206"
+  "\140\50\145\353\123\250\14\266\333\251\145\240\214\126\27\120\252\314\74\152\342\364\263\321\350\112\272\52\212\12\120\43"
+  "\341\200\166\205\23\33\113\244\21\144\307\355\100\353\225\35\143\67\252\47\126\154\223\334\47\116\60\324\256\363\312\230"
+  "\124\50\332\256\152\32\342\166\312\144\260\24\322\116\272\147\46\354\355\106\273\256\325\130\135\240\67\324\365\263\33\225"
+  "\6\153\334\255\32\177\231\257\212\100\147\55\275\206\247\63\223\303\315\141\272\274\220\54\233\12\334\164\273\47\305\262"
+  "\130\333\375\207\206\11\106\271\141\15\3\163\333\337\41\114\305\156\0\173\203\112\145\200\153\205\257\350\160\261\175\261"
+  "\247\127\40\305\137\126\347\350\70\217\145\224\147\274\324\100\263\141\321\141\44\113\216\43\101\261\174\170\227\222\211\120"
+  "\353\151\266\252\127\162\172\26\335\62\232\130\27\136\55\62\111\152\21\227\352\346\220\312\146\232\125\133\300\101\330\245"
+  "\330\114\135\135\147\270\372\46\340\114\144\34\55\165\135\302\262\366\167\150\70\325\116\222\264\206\113\216\57\113\151\53"
+  "\71\145\103\156\242\74\121\266\122\11\170\16\101\271\377\326\4\275\224\152\173\251\355\0\361\253\247\134\4\0\354\245"
+  "\114\246\44\145\114\62\231\202\166\62\134\322\71\322\314\2\235\264\233\241\265\225\332\315\116\337\227\46\133\272\13\120"
+  "\316\116\72\263\42\141\321\344\203\15\354\362\274\233\6\331\176\110\331\6\162\227\251\60\223\332\200\56\353\257\255\72"
+  "\236\252\60\253\134\62\257\164\373\72\110\357\261\274\324\220\302\23\243\132\362\172\337\160\72\126\132\14\366\61\330\310"
+  "\300\45\144\252\107\121\2\132\323\11\255\62\247\47\167\50\355\250\343\376\216\72\316\26\266\235\264\1\334\142\34\206"
+  "\356\235\6\162\77\246\251\237\151\54\145\337\125\35\56\367\263\137\275\10\335\255\15\354\211\112\203\372\302\51\124\316"
+  "\14\65\305\64\217\304\171\42\25\6\202\74\263\220\5\234\214\314\204\21\370\104\324\335\50\133\23\113\141\360\61\221"
+  "\354\241\225\271\326\256\337\230\234\151\47\335\111\202\142\317\210\303\337\221\73\206\144\201\12\240\41\71\221\12\130\203"
+  "\65\235\310\3\6\13\155\270\44\161\17\33\171\156\63\110\252\26\240\144\224\206\55\3\363\133\202\337\340\344\374\45"
+  "\125\40\333\23\311\274\234\310\262\155\47\151\316\7\251\70\23\10\167\31\63\150\164\16\203\200\124\166\302\47\316\356"
+  "\200\317\333\345\71\2\367\214\356\243\374\346\231\301\366\233\327\254\14\171\207\206\255\71\103\103\157\233\166\144\3\37"
+  "\74\6\215\36\234\161\75\23\120\211\237\52\356\277\110\243\333\313\263\231\131\131\254\117\352\110\135\172\156\257\331\264"
+  "\337\63\14\343\121\330\254\26\305\246\102\15\315\151\232\236\1\17\14\20\22\366\345\221\24\346\144\215\236\42\253\344"
+  "\104\251\246\150\300\370\52\133\2\265\2\66\246\202\366\345\166\2\370\162\271\103\333\331\102\65\365\4\111\243\123\30"
+  "\0\331\340\175\162\354\206\335\320\136\162\111\253\364\141\112\17\73\224\250\244\166\273\312\305\127\240\233\163\220\333\105"
+  "\373\255\101\75\374\144\165\170\371\122\141\317\242\172\100\105\53\313\206\260\332\12\172\314\173\156\66\77\304\46\60\330"
+  "\261\76\333\36\335\136\261\337\53\305\27\151\54\12\225\247\114\75\124\141\51\266\201\201\373\127\220\376\32\257\130\237"
+  "\121\312\225\52\273\306\247\132\275\102\314\26\31\46\3\26\144\374\330\143\267\227\161\365\355\221\5\40\107\276\75\246"
+  "\124\306\62\274\223\36\71\102\120\166\271\66\160\57\267\63\255\54\6\227\103\155\262\120\33\243\167\316\224\224\246\247"
+  "\13\304\300\311\76\267\152\5\346\76\374\3\270\121\373\333\344\203\156\120\263\24\233\1\211\331\202\325\302\217\225\255"
+  "\174\171\206\351\112\252\373\377\163\322\22\141\227\212\127\25\151\227\212\203\114\334\111\100\234\313\373\32\46\167\341\127"
+  "\252\32\256\26\252\212\11\252\145\52\163\44\225\61\351\164\303\214\134\176\24\232\303\77\103\331\266\252\50\203\246\15"
+  "\342\235\123\203\103\6\240\234\152\137\51\54\25\57\267\241\26\260\372\155\51\206\45\42\127\65\54\21\137\237\162\140"
+  "\311\374\37\322\14\272\260\34\265\260\124\154\42\305\60\107\350\321\337\156\342\162\15\55\21\114\364\217\370\207\350\101"
+  "\277\147\240\227\271\112\144\63\163\341\232\7\327\174\270\256\26\331\257\74\353\254\147\156\7\350\371\132\335\144\373\363"
+  "\252\200\73\372\326\155\365\11\256\267\273\134\200\25\73\217\327\244\2\24\250\102\223\226\102\375\274\213\3\272\45\7"
+  "\16\344\255\117\24\130\353\301\305\3\167\271\200\247\43\355\363\324\310\177\166\210\55\44\234\231\213\114\304\301\7\327"
+  "\34\242\102\353\175\262\25\40\206\325\170\46\244\231\121\74\156\12\355\146\31\340\174\154\334\5\150\34\64\221\270\252"
+  "\146\307\57\146\245\342\237\200\52\126\353\16\16\54\337\14\371\125\302\276\112\24\234\43\237\53\362\47\311\347\211\274"
+  "\131\162\136\22\1\45\322\127\113\330\174\341\31\245\136\55\134\203\74\40\256\41\175\141\34\307\162\4\3\56\240\110"
+  "\0\371\122\303\64\102\212\205\101\342\112\41\355\265\302\40\335\162\56\56\112\135\7\342\163\275\360\115\61\250\171\204"
+  "\345\60\232\54\33\20\251\267\57\260\353\355\1\70\176\13\26\225\135\17\245\36\76\154\352\131\200\152\333\211\340\45"
+  "\20\147\160\133\337\63\214\203\357\325\71\163\13\365\247\333\346\12\310\160\370\160\347\55\364\352\344\234\174\327\11\120"
+  "\134\230\152\211\240\312\11\75\40\274\101\151\304\347\104\346\106\300\367\46\101\313\263\13\340\166\63\134\13\5\231\322"
+  "\65\107\232\56\361\314\217\14\51\253\367\14\150\42\13\221\226\221\32\373\106\301\213\205\366\20\254\256\177\371\322\231"
+  "\104\273\105\40\105\302\100\306\262\5\202\336\227\100\324\2\261\222\147\266\6\40\210\0\361\320\73\105\135\343\65\113"
+  "\51\161\326\136\50\354\172\220\20\335\211\220\134\325\150\302\342\34\131\75\311\17\122\313\134\117\171\61\330\41\250\342"
+  "\345\373\74\31\1\124\253\121\121\2\45\366\224\262\106\147\275\260\34\310\133\174\213\200\44\215\221\32\370\135\40\362"
+  "\313\55\251\302\350\152\250\125\15\274\152\65\350\45\204\166\33\360\263\14\64\176\44\22\15\26\170\33\356\366\55\236"
+  "\270\161\210\300\123\345\0\17\112\300\261\300\102\241\347\214\355\13\302\335\272\227\52\20\64\351\207\326\362\115\102\327"
+  "\366\46\1\32\173\241\320\265\141\132\337\42\272\207\102\221\233\205\135\3\232\112\101\270\131\220\300\70\363\4\77\23"
+  "\42\250\34\2\237\147\311\270\25\256\333\340\272\35\256\237\373\245\144\2\13\312\35\42\243\204\305\57\51\36\1\31"
+  "\30\251\107\221\230\140\173\345\144\251\210\334\221\53\51\3\363\44\45\333\216\244\334\52\34\356\314\236\275\334\210\334"
+  "\52\64\137\210\262\267\212\265\256\226\141\256\32\244\231\60\214\213\332\226\312\162\253\0\345\124\126\223\317\152\357\164"
+  "\307\60\26\157\163\70\262\4\101\303\30\162\230\34\221\303\360\133\5\263\373\16\101\34\77\150\344\362\134\45\150\223"
+  "\343\303\254\21\56\317\213\207\133\303\255\141\366\102\241\245\1\201\330\267\13\373\66\161\74\17\204\312\46\250\321\237"
+  "\306\12\102\116\331\100\143\107\152\74\214\377\271\43\53\77\27\320\131\115\320\363\346\355\313\112\126\313\312\177\13\132"
+  "\24\70\56\363\13\350\57\177\41\226\3\304\162\32\321\163\270\257\36\305\100\322\137\36\71\351\331\236\244\277\342\244"
+  "\147\265\227\124\265\175\216\175\333\360\44\171\327\330\340\252\0\157\252\26\157\252\125\236\124\120\354\257\225\26\217\144"
+  "\356\4\221\276\13\256\144\126\126\331\167\212\110\322\354\153\47\161\1\75\153\337\45\340\77\317\43\334\45\70\63\117"
+  "\42\340\224\22\57\252\47\365\270\33\262\356\106\300\167\163\175\276\115\160\27\11\154\36\50\104\213\4\115\372\334\211"
+  "\175\332\231\350\337\360\113\207\41\213\40\324\351\175\3\336\25\132\63\70\23\347\135\312\151\120\271\110\350\211\36\310"
+  "\3\105\335\43\14\145\1\205\63\367\102\111\367\301\265\30\256\373\201\222\367\11\173\261\240\231\313\173\5\74\264\32"
+  "\147\222\375\307\253\212\113\234\214\347\344\146\304\36\60\241\7\3\367\212\262\257\153\266\250\54\301\353\246\131\373\176"
+  "\320\336\53\275\346\62\115\364\134\206\163\47\70\332\177\100\30\40\345\31\343\7\231\337\10\62\347\26\211\134\253\335"
+  "\376\15\365\26\354\363\63\302\361\272\0\223\43\263\333\70\56\130\134\125\334\257\170\170\361\260\342\21\305\310\231\337"
+  "\140\227\270\10\352\274\34\135\226\310\247\342\67\330\4\60\252\105\174\337\20\350\346\203\121\3\51\112\171\123\140\304"
+  "\40\117\304\10\214\30\12\21\60\306\100\226\3\246\277\45\114\147\301\170\105\141\372\73\61\113\21\316\213\40\241\166"
+  "\234\44\254\34\174\176\47\376\44\372\51\17\17\302\346\167\342\154\7\360\122\141\150\67\355\314\375\201\314\62\200\176"
+  "\257\342\120\74\233\171\20\156\277\127\175\366\103\202\270\365\60\52\347\114\346\21\321\306\242\27\257\170\15\326\213\136"
+  "\150\377\136\342\230\300\112\155\203\210\201\31\305\172\233\73\364\207\350\367\141\141\77\50\234\336\67\33\264\177\217\42"
+  "\14\161\255\270\312\376\210\220\177\20\52\352\21\361\254\121\2\117\367\352\210\305\230\317\136\46\354\171\2\64\210\366"
+  "\36\107\111\350\351\364\345\360\160\306\52\45\7\24\217\242\201\205\326\243\162\103\104\4\151\105\62\261\11\162\241\106"
+  "\102\105\11\50\112\27\102\13\107\166\134\117\324\264\203\240\27\265\362\125\252\321\100\111\5\326\212\363\112\52\265\37"
+  "\122\110\76\44\216\245\234\117\15\57\15\136\121\213\364\252\140\232\352\313\231\12\313\53\30\272\332\110\234\31\5\155"
+  "\51\24\211\323\260\271\23\335\261\352\341\177\246\352\5\134\40\376\147\252\136\140\165\261\120\325\261\114\166\231\240\106"
+  "\66\12\264\0\14\233\102\166\234\307\117\235\50\0\335\167\230\2\243\260\345\311\176\324\217\267\30\247\256\75\106\302"
+  "\260\342\112\204\241\13\164\155\213\74\371\274\120\325\200\106\132\332\377\243\155\371\364\20\57\210\136\16\320\357\33\320"
+  "\363\243\222\30\106\136\134\377\34\252\277\74\22\252\27\53\124\13\54\273\266\213\352\10\100\125\71\205\1\252\243\344"
+  "\130\163\314\77\211\352\257\216\204\352\125\12\112\331\45\10\347\22\373\222\143\301\165\54\340\72\6\160\35\143\215\245"
+  "\176\32\120\172\110\260\177\302\67\330\20\136\52\334\301\25\133\327\163\5\233\327\360\13\111\354\207\251\273\162\206\25"
+  "\270\0\152\203\111\27\147\245\26\356\162\142\144\102\260\100\364\111\350\315\6\106\247\315\35\270\132\137\303\102\41\172"
+  "\202\66\251\36\25\206\66\277\223\76\75\237\144\35\17\146\366\37\205\333\41\243\330\203\311\50\42\177\144\153\202\314"
+  "\224\352\166\250\14\342\317\6\115\213\361\75\265\300\1\371\261\345\235\116\355\135\33\62\14\67\170\14\112\226\126\367"
+  "\21\162\270\143\61\360\261\143\261\17\236\2\124\300\70\310\7\24\4\356\30\154\31\143\336\250\143\347\104\321\376\374"
+  "\243\313\2\234\370\371\223\103\264\131\117\7\175\124\53\320\65\76\206\135\343\254\314\237\341\366\10\23\364\57\376\341"
+  "\72\166\221\3\135\317\344\266\172\111\234\44\242\311\242\307\341\172\302\351\65\237\303\121\376\23\5\272\315\307\350\367"
+  "\317\137\103\347\371\304\121\165\236\307\300\65\157\107\373\347\302\35\55\73\136\34\113\143\336\345\323\351\153\265\116\137"
+  "\106\331\26\213\53\304\351\10\56\14\22\217\53\306\246\223\30\36\102\234\366\151\265\263\140\337\141\47\224\265\377\354"
+  "\141\275\353\50\243\332\356\143\252\355\122\221\173\174\10\154\314\107\340\173\16\2\177\1\374\315\215\236\42\77\75\334"
+  "\46\154\356\137\314\52\242\320\300\143\126\161\330\42\212\373\22\112\155\364\172\10\227\327\323\352\251\215\236\341\244\342"
+  "\347\236\230\316\231\7\256\77\123\30\324\121\373\6\105\304\75\17\214\162\167\116\144\45\266\376\174\26\17\72\6\13"
+  "\207\164\241\120\22\15\132\325\176\314\243\22\265\2\347\56\247\15\35\76\344\30\214\212\134\25\336\227\373\170\107\43"
+  "\174\45\76\234\265\352\153\351\262\35\13\142\340\127\353\353\230\160\16\63\217\202\162\377\114\107\355\261\51\110\271\36"
+  "\63\342\221\104\56\253\133\214\175\76\51\176\216\244\230\202\73\174\57\126\322\213\257\253\113\377\112\44\77\202\232\234"
+  "\113\231\346\12\173\256\70\262\246\314\307\175\236\120\312\121\16\63\107\374\63\262\320\236\211\166\265\46\322\174\2\64"
+  "\137\330\363\105\73\164\12\242\307\15\332\147\326\10\153\230\62\216\363\55\236\307\362\54\236\307\375\26\17\31\63\313"
+  "\15\260\146\236\140\133\346\4\234\310\73\255\372\210\226\314\223\356\104\342\365\235\174\235\362\137\341\372\233\352\234\47"
+  "\322\10\66\105\75\363\123\154\346\54\207\133\13\134\53\340\372\73\14\365\237\206\101\364\42\161\264\116\173\205\326\162"
+  "\164\27\235\131\11\327\52\270\126\303\265\6\256\265\160\255\163\272\356\233\45\164\335\353\124\327\275\234\224\333\12\201"
+  "\125\237\53\335\145\34\30\273\377\125\104\122\146\137\73\105\356\257\64\31\215\101\173\35\321\246\243\25\250\46\247\250"
+  "\124\117\141\320\23\256\121\41\23\123\332\375\11\155\171\332\114\303\26\344\275\70\173\74\127\36\131\64\72\132\216\144"
+  "\334\353\342\164\224\246\224\327\100\107\357\351\24\115\306\174\333\361\72\104\124\341\131\265\10\365\226\375\31\24\352\162"
+  "\224\71\366\353\101\371\250\106\320\301\342\121\200\62\330\352\326\130\153\124\260\355\342\42\11\234\43\42\214\127\345\224"
+  "\163\124\3\346\240\343\364\142\257\20\150\130\256\20\135\265\5\261\302\323\337\63\325\10\116\31\223\307\61\234\227\13"
+  "\207\110\101\373\157\2\376\323\162\125\344\157\330\66\341\55\350\205\321\230\356\101\1\243\42\314\33\356\330\11\244\146"
+  "\264\134\217\223\174\140\370\275\317\374\150\345\111\75\110\147\255\167\101\302\130\145\214\105\371\47\312\15\102\76\43\344"
+  "\106\41\237\25\362\71\41\67\11\271\131\310\347\205\174\101\310\27\205\174\111\310\227\205\174\105\310\127\205\334\42\344"
+  "\153\102\276\56\344\33\102\276\51\344\126\41\337\22\362\155\41\267\11\371\216\220\333\205\334\1\45\70\145\100\341\221"
+  "\241\70\67\152\17\205\221\301\313\2\165\65\5\137\242\111\122\12\276\10\301\325\34\174\101\240\255\102\301\347\41\370"
+  "\32\7\237\243\71\130\12\276\6\301\167\70\270\11\202\333\71\370\226\300\36\201\202\133\150\212\226\202\257\102\360\75"
+  "\16\276\2\301\235\34\334\41\320\174\244\340\126\10\266\162\360\35\10\276\317\301\355\2\315\73\12\156\204\340\136\16"
+  "\276\51\260\67\242\340\263\20\374\220\203\233\41\370\21\7\337\206\340\307\34\174\103\320\116\74\14\276\16\301\317\71"
+  "\270\115\24\77\43\54\244\16\61\171\247\341\153\4\55\106\46\62\21\375\20\42\23\101\44\66\10\153\273\116\370\176"
+  "\156\102\111\11\205\116\210\250\103\24\6\267\11\13\321\20\374\364\226\260\266\12\353\115\141\275\41\254\327\205\365\232"
+  "\260\266\10\353\125\141\275\42\254\227\205\365\222\260\136\24\326\13\302\172\136\130\233\205\265\111\130\317\11\353\131\141"
+  "\155\144\1\331\215\2\2\100\236\21\356\42\311\6\106\51\362\224\220\357\12\371\236\220\73\205\334\45\144\53\163\352"
+  "\51\260\11\113\166\61\177\50\334\312\204\244\360\116\121\374\236\260\132\171\200\42\170\355\105\240\74\32\326\56\121\374"
+  "\256\260\166\12\33\244\175\42\267\305\145\140\71\77\40\240\141\100\31\273\205\371\276\370\172\324\303\121\115\366\4\213"
+  "\167\3\126\305\357\43\152\360\263\233\260\173\127\264\135\156\33\215\34\332\346\7\102\356\21\162\257\220\373\204\334\57"
+  "\344\1\41\77\24\362\43\41\77\26\362\23\41\377\41\344\247\102\176\46\344\347\102\176\41\344\101\41\17\11\371\245"
+  "\220\207\151\55\201\311\366\21\67\30\12\37\340\26\103\341\175\334\144\50\274\207\333\14\205\277\360\260\342\20\267\32"
+  "\12\177\354\141\313\227\334\156\50\374\51\67\34\12\177\310\55\207\302\373\271\351\120\170\57\67\30\12\177\302\15\202"
+  "\302\237\161\213\240\360\101\156\22\24\76\314\15\201\302\377\340\226\100\341\317\105\361\7\302\72\54\254\57\205\165\110"
+  "\100\34\242\344\130\115\117\21\4\325\113\324\223\3\306\225\22\267\326\325\223\167\7\332\145\72\11\47\350\204\6\265"
+  "\172\3\217\26\372\12\270\217\270\114\177\261\373\130\202\253\377\356\343\161\144\26\272\317\21\317\104\14\32\230\76\155"
+  "\374\246\366\276\323\55\260\24\105\267\205\254\51\270\221\141\323\42\134\164\347\151\300\234\275\147\156\156\54\360\54\162"
+  "\20\100\311\153\201\226\206\306\224\112\375\206\121\50\371\233\6\231\150\236\364\64\120\234\55\315\53\245\223\161\65\32"
+  "\14\263\245\234\43\225\365\340\133\337\364\140\223\245\76\331\165\366\241\16\372\15\217\277\204\274\112\172\60\0\40\255"
+  "\270\33\47\222\60\347\112\325\41\256\301\262\256\222\162\36\157\3\261\23\255\206\262\354\134\14\347\141\342\4\3\111"
+  "\224\26\317\225\26\374\277\12\227\214\51\13\367\113\255\70\237\341\315\65\307\133\164\151\361\225\322\202\377\263\171\365"
+  "\60\262\10\225\104\131\122\251\2\71\137\232\127\343\364\306\112\55\104\213\120\277\254\161\333\175\333\172\302\35\366\42"
+  "\212\207\311\23\125\40\72\104\71\313\50\231\217\276\332\0\157\221\262\222\27\241\100\254\144\163\334\253\123\126\221\275"
+  "\274\112\330\253\216\154\334\27\137\215\176\42\360\63\137\6\345\65\322\274\366\137\205\370\65\322\203\263\27\323\325\204"
+  "\351\152\141\257\156\7\323\153\21\123\370\271\6\171\265\310\105\322\155\261\214\357\152\257\53\104\236\366\123\311\127\253"
+  "\111\72\25\260\211\216\153\234\266\6\232\26\224\302\101\141\175\41\254\317\205\365\231\260\76\25\326\77\204\365\11\131"
+  "\310\161\171\235\224\327\113\171\203\224\67\112\171\223\224\13\244\274\131\272\352\156\201\164\125\331\15\322\125\115\67\112"
+  "\127\65\141\172\255\216\256\227\256\72\272\111\26\137\47\255\233\245\265\100\132\67\111\132\335\300\10\314\32\342\340\15"
+  "\322\302\14\235\370\351\72\311\154\101\252\352\151\36\73\16\144\320\4\16\213\245\42\362\167\244\146\167\34\326\20\13"
+  "\27\101\111\135\211\72\76\262\360\260\326\136\56\374\156\112\40\333\153\205\375\167\136\5\14\162\177\370\167\352\12\231"
+  "\114\37\13\353\43\141\175\50\254\3\302\332\57\254\175\302\332\53\254\75\242\0\136\136\254\376\44\42\117\37\31\53"
+  "\125\324\323\120\324\157\125\121\37\10\215\235\342\55\312\323\12\101\333\33\34\373\221\327\242\127\70\136\77\13\245\362"
+  "\235\356\202\353\272\70\22\273\105\362\150\354\147\62\153\337\42\301\156\335\54\240\166\270\222\233\205\221\16\330\263\141"
+  "\30\312\105\176\106\176\75\140\337\376\14\67\27\337\52\331\167\350\370\43\100\340\315\20\155\303\270\115\143\162\2\72"
+  "\216\264\5\347\36\141\327\330\65\341\222\316\155\302\271\135\152\257\277\223\20\120\155\173\260\354\332\260\370\265\150\23"
+  "\334\317\65\132\235\64\201\0\114\41\222\100\332\73\24\31\72\372\322\345\125\34\75\45\64\124\113\127\226\123\27\250"
+  "\36\244\376\205\123\245\22\117\225\274\71\162\53\201\36\26\222\227\360\215\56\70\226\366\56\342\367\57\260\370\137\326"
+  "\337\116\54\167\116\354\370\225\316\33\314\311\213\176\21\372\335\71\271\160\357\224\236\35\36\367\212\310\235\22\141\252"
+  "\165\156\373\116\311\233\335\171\353\341\235\122\155\37\23\374\2\177\15\31\26\15\245\364\52\340\16\260\51\53\45\166"
+  "\336\24\30\346\222\373\44\327\0\160\274\113\32\241\154\126\37\144\66\65\163\267\364\143\132\303\53\0\70\341\260\10"
+  "\136\335\43\311\21\3\10\21\271\7\232\232\263\55\47\113\141\341\165\335\225\70\317\13\355\326\354\313\12\125\157\125"
+  "\307\215\314\104\112\370\317\155\215\110\154\337\55\131\111\143\43\364\165\115\245\172\333\72\115\16\54\104\167\241\32\236"
+  "\337\331\155\224\55\144\167\214\43\103\164\166\117\51\204\1\71\134\24\204\124\367\310\335\6\341\206\346\104\73\170\351"
+  "\211\0\40\363\175\50\66\367\112\303\312\272\177\42\373\264\154\213\174\367\111\232\254\131\54\135\112\36\301\171\172\221"
+  "\147\267\323\203\302\245\255\143\324\334\47\75\63\211\334\305\102\212\342\375\356\354\166\65\17\105\170\124\254\47\335\355"
+  "\305\162\55\73\373\101\135\75\256\135\65\171\23\146\40\120\345\350\340\241\46\212\151\256\126\41\301\116\173\17\272\256"
+  "\141\107\3\157\200\202\347\114\241\22\264\360\176\75\151\317\317\263\103\130\351\256\134\302\142\271\312\235\222\207\362\126"
+  "\171\53\347\162\37\22\363\362\174\356\73\364\370\123\176\13\341\125\132\100\355\375\336\71\343\366\361\36\210\75\52\31"
+  "\260\271\140\216\1\310\40\354\322\65\20\136\236\150\77\323\320\26\143\233\66\42\324\174\263\275\266\160\322\41\114\334"
+  "\234\164\136\31\51\224\13\306\35\75\11\251\105\316\251\35\371\211\140\10\162\206\223\50\324\106\42\30\230\330\16\246"
+  "\200\303\335\122\265\243\305\202\123\103\177\275\10\24\326\135\330\111\334\57\215\116\336\66\323\234\327\144\226\310\202\355"
+  "\5\233\321\3\262\220\167\260\315\316\301\274\152\150\57\221\324\156\26\361\166\203\310\42\76\226\11\242\175\42\126\255"
+  "\66\240\103\164\174\237\261\134\104\36\220\5\346\215\373\333\17\110\64\24\72\255\41\121\54\247\307\126\144\33\376\173"
+  "\333\320\302\320\125\275\200\224\270\53\27\215\150\4\274\307\210\54\221\26\26\222\313\362\22\175\20\207\227\126\124\76"
+  "\263\15\114\257\305\222\351\306\376\316\240\154\264\35\362\33\105\301\14\374\103\12\316\52\100\301\14\123\60\363\25\51"
+  "\370\134\1\12\56\315\245\41\244\136\46\66\33\76\122\316\41\327\260\177\11\61\147\13\115\114\135\360\61\323\164\211"
+  "\150\233\252\277\225\206\231\301\303\61\57\311\374\16\310\267\24\256\145\110\73\270\377\36\256\207\340\172\30\256\107\340"
+  "\372\3\134\217\302\365\107\270\376\44\321\241\316\376\235\124\236\344\127\211\310\203\22\36\1\257\245\342\32\21\371\275"
+  "\264\227\172\336\75\204\217\372\335\303\200\213\264\37\222\137\32\221\107\50\370\60\6\377\40\355\337\253\330\107\51\110"
+  "\261\177\224\366\43\72\243\375\7\27\342\101\303\176\324\373\24\371\223\264\227\111\240\65\144\370\203\316\100\211\334\360"
+  "\237\334\160\137\303\324\217\363\5\224\340\100\232\213\35\334\143\232\46\235\63\177\206\172\376\5\256\307\301\50\374\13"
+  "\155\23\266\37\247\335\63\220\355\317\22\302\10\217\62\75\41\311\147\263\143\346\111\110\372\44\44\175\366\376\165\306"
+  "\373\300\315\23\76\341\301\34\244\371\53\247\351\340\244\151\331\31\300\44\135\76\301\267\177\313\175\373\305\33\147\342"
+  "\333\23\351\355\123\360\66\43\262\335\62\313\45\272\116\223\33\7\365\157\313\41\145\160\231\230\43\110\76\66\321\220"
+  "\203\243\100\164\226\313\2\376\20\0\255\105\242\353\252\161\273\240\165\222\11\244\165\126\110\364\313\316\146\376\16\367"
+  "\247\341\132\11\5\255\202\153\65\134\153\340\72\12\237\376\110\75\331\57\245\37\30\145\240\363\113\337\207\321\5\16"
+  "\114\354\25\270\45\353\16\260\163\317\240\216\111\142\265\102\357\243\77\352\323\322\276\103\70\347\77\1\3\237\226\247"
+  "\33\46\362\147\202\336\224\4\61\41\212\121\203\255\53\304\277\33\224\211\40\100\352\262\225\222\23\251\23\7\170\357"
+  "\0\210\166\144\265\264\371\35\344\256\247\230\125\320\104\361\151\265\74\10\43\126\176\170\101\115\76\205\170\207\315\351"
+  "\270\3\114\54\145\61\241\301\162\30\270\13\165\300\33\324\343\357\22\20\35\144\3\44\310\377\167\210\175\114\136\41"
+  "\172\32\124\363\360\7\270\345\2\361\102\3\224\142\366\42\373\77\62\120\12\314\375\306\62\45\175\23\364\201\140\204"
+  "\3\240\316\200\234\152\6\304\132\146\321\257\377\65\54\372\6\52\32\227\117\145\304\47\305\244\63\377\237\61\11\50"
+  "\265\114\34\62\276\72\257\230\111\212\145\205\171\105\145\34\4\4\317\372\332\131\266\16\25\7\172\334\366\47\316\40"
+  "\207\326\303\125\200\73\36\216\340\376\36\127\110\225\202\376\255\54\265\163\10\246\151\165\104\222\364\267\373\347\222\104"
+  "\143\273\136\362\206\42\304\131\43\274\1\106\152\263\310\107\370\201\40\164\237\263\62\317\0\272\33\341\172\26\256\347"
+  "\0\345\115\160\155\206\353\171\270\136\200\353\105\270\136\202\167\57\303\365\12\134\257\302\265\5\256\327\340\172\35\256"
+  "\67\340\172\23\256\255\74\136\312\274\5\367\267\25\31\266\311\43\255\310\172\272\344\301\334\45\277\112\243\354\327\351"
+  "\367\15\372\175\123\342\146\20\350\12\317\106\122\101\105\131\157\343\216\34\350\144\236\143\162\264\30\175\120\51\57\21"
+  "\221\227\44\257\60\330\317\271\175\47\31\326\364\142\3\364\235\135\43\133\44\75\251\15\34\33\146\100\46\176\377\207"
+  "\20\36\55\201\62\364\222\4\0\53\160\257\11\376\205\346\142\111\26\3\5\111\272\112\353\135\362\205\172\15\215\312"
+  "\145\2\136\102\347\265\111\301\246\75\274\0\145\60\261\366\257\34\153\256\103\267\257\127\144\344\145\170\0\221\177\205"
+  "\44\127\35\44\22\331\212\371\40\335\156\174\1\215\145\253\344\231\277\127\244\43\15\153\245\275\111\77\221\300\257\223"
+  "\221\315\322\176\106\262\153\74\24\371\54\36\26\264\11\340\76\45\41\343\106\62\51\66\342\76\371\227\151\3\333\146"
+  "\351\114\137\155\302\221\27\312\171\16\274\347\45\275\342\106\271\105\162\333\364\245\170\1\101\267\30\47\321\121\10\233"
+  "\362\273\42\117\361\104\240\67\200\274\257\371\114\364\334\2\374\351\137\207\364\12\13\102\320\171\273\24\222\2\176\154"
+  "\173\7\35\152\61\215\377\346\220\17\140\53\102\303\43\320\360\145\57\141\41\376\155\42\73\162\0\250\376\26\202\266"
+  "\337\102\246\257\227\366\333\56\255\133\274\264\136\57\13\323\172\20\121\142\271\101\7\2\154\2\211\101\166\241\245\240"
+  "\352\347\110\12\333\155\212\33\103\217\202\33\252\304\43\160\103\245\120\334\20\33\324\122\334\33\62\207\330\133\44\171"
+  "\171\171\110\113\272\102\221\62\110\271\7\256\141\266\264\135\1\305\111\65\356\171\75\157\124\376\6\305\320\144\10\132"
+  "\50\130\110\47\64\107\354\27\164\350\45\54\302\227\121\277\233\343\247\222\302\124\201\324\151\337\364\36\32\241\260\1"
+  "\12\52\0\320\364\337\164\36\301\10\2\322\72\50\40\21\35\54\220\136\257\362\4\21\150\33\307\100\362\342\125\115"
+  "\163\0\271\270\1\362\377\23\10\271\323\6\371\245\5\135\377\75\202\54\363\110\207\42\20\200\202\41\373\146\222\257"
+  "\27\344\46\114\375\232\226\132\146\326\353\352\321\362\373\3\122\31\33\341\231\266\307\277\50\151\141\154\233\44\227\245"
+  "\266\30\272\331\45\23\250\201\55\114\210\155\137\245\346\312\1\311\207\70\241\265\115\211\226\302\312\242\66\64\4\332"
+  "\20\344\346\245\217\27\235\336\355\35\350\216\147\341\120\361\72\223\72\267\355\320\1\355\120\126\23\330\330\231\167\125"
+  "\47\25\315\146\336\223\270\365\46\223\331\11\257\222\331\314\56\211\276\105\31\260\265\271\53\153\225\107\362\44\202\256"
+  "\253\305\330\207\132\243\136\171\127\33\221\367\110\135\354\44\67\40\247\303\332\51\375\75\326\112\311\221\116\227\125\366"
+  "\244\333\27\155\234\21\171\22\132\350\112\177\327\3\131\236\124\275\23\274\306\145\67\320\361\53\161\164\172\353\356\327"
+  "\115\26\66\337\271\134\236\167\263\105\241\144\274\167\237\213\271\371\211\307\137\132\266\257\144\266\176\173\132\110\42\335"
+  "\115\140\76\155\4\256\77\55\40\273\132\106\344\135\306\202\217\170\170\122\102\155\325\144\333\223\322\75\7\152\251\210"
+  "\354\124\351\326\161\272\26\243\33\377\256\201\236\67\211\372\45\211\352\45\362\73\1\321\164\210\315\223\44\147\360\204"
+  "\232\273\204\107\314\374\10\361\45\120\362\56\111\226\345\56\351\132\226\52\373\56\124\357\110\22\71\234\127\25\115\232"
+  "\117\175\127\322\262\346\160\71\314\146\313\127\233\172\320\113\377\116\174\151\330\73\301\224\212\74\45\274\157\101\51\77"
+  "\225\117\53\117\324\154\254\32\210\247\73\131\133\334\17\267\312\323\364\352\116\307\332\100\237\74\40\325\273\112\256\361"
+  "\316\360\207\120\242\34\370\73\245\37\276\343\200\245\147\43\307\62\244\335\124\271\121\124\270\201\335\144\311\130\71\46"
+  "\247\162\21\34\2\166\214\264\112\46\1\345\322\376\107\255\122\216\66\327\13\32\45\12\72\336\255\125\41\10\311\61"
+  "\262\323\36\3\362\27\257\307\211\104\370\31\235\17\33\210\274\103\160\66\62\126\314\15\302\336\52\65\72\73\320\143"
+  "\310\336\216\7\260\241\335\302\223\156\345\14\172\37\74\322\34\274\247\44\364\212\331\352\300\102\377\224\15\344\122\23"
+  "\205\22\160\344\152\215\141\102\123\305\213\107\131\243\254\261\366\16\131\166\41\15\155\241\43\177\217\133\276\174\107\230"
+  "\333\204\173\160\345\166\251\22\320\114\271\327\343\271\132\275\200\101\361\66\254\344\66\364\267\241\161\361\156\151\4\147"
+  "\361\14\335\46\126\32\357\103\323\377\0\56\255\74\320\32\106\325\260\107\222\23\42\350\216\275\20\263\257\355\301\227"
+  "\63\277\355\261\371\57\102\115\1\175\152\344\51\132\21\335\43\171\172\107\265\132\240\367\105\144\306\154\100\53\203\332"
+  "\25\310\247\243\104\137\301\12\140\106\170\372\222\104\167\217\342\337\36\267\17\333\201\223\41\173\44\265\130\326\213\37"
+  "\370\272\220\35\122\57\215\330\357\103\202\40\374\132\6\35\51\265\101\371\45\31\153\264\316\335\314\146\35\224\371\245"
+  "\361\202\333\103\170\243\251\143\251\307\63\267\234\305\143\357\231\3\333\45\116\205\127\40\333\167\310\62\277\57\237\163"
+  "\300\100\320\116\1\306\154\272\100\325\42\173\245\34\156\247\42\121\150\307\121\170\341\64\343\275\122\127\175\57\266\101"
+  "\147\176\203\132\40\166\27\173\345\34\21\331\47\71\310\235\316\76\111\331\244\352\252\62\144\365\4\175\321\120\205\14"
+  "\125\141\245\373\176\263\266\361\271\163\134\52\370\34\21\335\272\67\113\65\322\52\333\214\352\201\112\123\270\155\362\364"
+  "\207\214\302\16\231\163\60\25\31\117\51\334\344\215\245\102\162\315\106\210\131\42\121\174\167\200\125\367\16\36\51\233"
+  "\262\243\64\210\210\172\50\212\7\70\221\134\127\256\323\34\361\106\256\342\223\17\171\131\327\227\302\327\46\310\102\166"
+  "\27\120\54\275\106\224\362\264\42\137\216\263\75\255\310\161\51\323\7\174\247\364\44\1\60\174\250\313\160\277\167\226"
+  "\303\160\125\15\5\35\317\27\241\22\40\25\71\332\70\36\127\243\314\261\371\210\257\362\41\240\34\77\335\114\344\112"
+  "\63\306\34\355\265\111\264\351\346\143\213\243\11\106\103\226\321\326\30\271\101\350\270\224\311\176\225\254\325\66\220\23"
+  "\44\223\30\27\10\312\227\12\27\370\101\103\355\15\366\1\47\277\100\215\342\172\164\323\104\157\273\250\266\117\366\113"
+  "\243\70\353\133\111\133\34\310\233\324\106\275\3\112\346\200\132\35\370\120\372\227\7\160\141\362\43\270\76\206\353\23"
+  "\65\331\215\66\15\130\55\152\261\162\261\76\276\300\131\60\13\357\327\106\352\107\62\167\115\255\247\273\60\2\117\147"
+  "\0\253\155\275\114\25\242\3\374\55\134\65\370\130\332\7\244\243\42\14\170\200\16\32\176\241\203\376\204\113\244\161"
+  "\367\107\56\354\256\64\262\305\310\217\245\362\101\350\112\63\344\366\207\276\1\12\116\155\103\241\105\366\47\344\5\262"
+  "\106\245\242\305\60\117\221\42\110\117\264\7\212\117\271\60\376\225\253\262\116\57\257\347\332\235\112\0\312\30\156\7"
+  "\106\101\344\34\324\206\51\324\206\173\120\33\46\107\140\237\171\144\260\43\274\250\321\221\17\120\222\217\236\360\226\71"
+  "\24\135\343\16\27\266\243\27\76\74\225\133\355\254\37\173\31\210\260\316\152\257\232\162\24\216\72\301\36\30\11\35"
+  "\72\310\301\6\254\312\50\60\134\266\72\373\375\41\336\217\13\331\10\107\211\220\305\220\360\315\126\264\217\106\132\243"
+  "\132\10\301\35\236\145\224\43\102\0\11\307\257\27\50\121\152\47\261\22\302\215\174\270\207\172\372\200\54\230\366\50"
+  "\241\323\167\302\331\305\116\173\217\42\217\223\343\150\22\7\235\306\120\335\256\230\4\331\235\34\270\62\6\251\177\200"
+  "\271\202\356\344\137\33\133\24\50\305\27\362\100\267\276\202\364\354\20\272\125\73\66\45\104\200\34\265\32\33\134\303"
+  "\362\353\102\172\273\17\151\155\165\272\155\25\132\46\133\224\307\352\57\341\332\224\332\145\342\37\312\333\204\346\132\263"
+  "\177\24\5\226\56\147\371\324\172\224\265\175\236\111\251\154\310\207\212\300\210\34\244\206\233\150\65\76\120\344\71\66"
+  "\154\11\376\337\206\252\311\263\44\170\205\50\307\351\154\265\14\70\210\354\313\273\334\71\247\45\362\151\65\62\335\173"
+  "\370\235\274\254\25\70\105\176\24\131\263\333\163\262\272\235\311\25\242\227\21\274\102\364\246\266\21\100\114\324\253\256"
+  "\155\301\205\152\335\135\104\213\13\172\374\174\167\21\14\225\7\342\120\131\331\140\50\137\145\376\25\377\45\362\27\264"
+  "\142\352\165\255\100\246\25\105\26\113\205\254\376\333\306\351\271\277\342\55\113\110\107\205\311\156\351\34\264\243\275\223"
+  "\211\312\3\35\247\43\377\202\53\360\341\264\7\212\74\35\252\273\350\312\0\367\73\23\23\237\372\304\341\215\243\26"
+  "\207\17\333\230\101\367\112\305\320\66\244\2\25\363\207\256\154\160\37\352\147\235\125\40\32\204\301\312\345\51\221\114"
+  "\125\155\50\125\355\37\377\142\256\121\44\273\315\54\166\147\110\304\221\131\152\170\130\72\364\50\131\112\54\154\61\146"
+  "\155\344\343\236\220\237\213\345\32\327\342\135\314\303\124\176\5\146\35\225\3\164\15\352\67\204\122\260\155\61\153\65"
+  "\216\5\261\101\32\261\166\244\115\165\372\271\154\161\45\356\63\237\304\265\6\332\225\70\24\267\317\341\372\2\6\266"
+  "\7\225\135\171\10\356\137\112\166\246\70\14\327\154\163\126\346\112\63\233\231\143\176\325\255\166\236\163\143\346\213\110"
+  "\375\327\56\235\363\105\256\170\172\31\363\316\261\110\142\11\13\233\177\375\251\305\350\263\214\344\372\160\147\34\45\56"
+  "\21\221\317\145\376\302\324\27\22\263\37\364\234\163\367\245\264\77\167\345\30\312\236\63\323\376\202\317\67\333\144\164"
+  "\215\34\2\171\302\367\207\73\200\100\35\302\142\17\111\317\61\170\207\44\105\143\3\370\122\172\235\237\224\107\312\41"
+  "\266\42\224\103\12\57\20\24\362\114\123\16\47\347\30\14\37\114\25\54\14\363\267\351\143\342\372\131\265\1\167\240"
+  "\62\260\276\224\135\171\377\177\273\71\6\341\26\140\362\354\326\26\34\357\215\145\247\107\316\234\245\306\123\342\71\126"
+  "\262\15\140\103\331\47\314\323\32\35\37\110\202\260\226\204\250\4\36\364\27\1\42\207\75\22\21\231\155\172\250\71"
+  "\322\34\41\107\21\137\302\113\171\26\377\112\323\76\254\206\123\325\366\154\123\147\54\257\6\351\273\322\174\114\334\55"
+  "\20\302\141\125\370\141\140\243\233\310\256\336\256\45\330\33\371\66\326\356\112\323\63\42\240\372\121\14\124\10\357\141"
+  "\75\163\7\305\373\13\155\61\72\253\102\203\276\112\200\12\312\171\156\213\140\103\250\44\307\67\351\112\263\240\147\22"
+  "\106\273\176\111\0\115\21\145\66\12\267\175\120\325\367\240\204\21\370\301\174\341\31\141\215\0\113\335\160\107\242\171"
+  "\176\200\155\40\67\30\214\306\34\51\242\326\42\164\353\351\32\231\143\36\45\211\347\344\221\170\16\223\30\100\264\115"
+  "\36\34\347\103\302\126\125\155\307\227\362\350\353\160\221\343\112\331\156\113\270\130\71\114\132\107\325\156\56\321\356\217"
+  "\155\72\77\266\221\21\227\361\162\135\40\333\110\212\333\247\162\35\41\333\110\212\33\244\332\164\207\164\363\370\364\362"
+  "\135\116\377\164\225\351\34\142\263\300\162\72\47\354\230\346\232\354\226\277\110\165\116\363\114\66\207\4\257\312\54\146"
+  "\217\111\164\375\233\17\157\256\206\353\32\270\324\354\354\265\20\274\316\374\127\156\4\317\134\17\340\157\200\353\106\270"
+  "\156\202\153\1\134\67\303\265\320\364\116\370\56\64\361\270\123\173\256\251\216\73\275\17\307\167\330\261\154\26\342\127"
+  "\62\162\267\136\77\251\347\243\375\324\271\223\147\352\115\327\316\143\33\43\17\173\241\351\34\360\302\113\102\136\317\367"
+  "\342\252\40\235\145\72\320\67\371\110\213\44\22\324\154\77\71\114\216\200\321\40\177\207\122\216\222\43\165\151\221\101"
+  "\70\330\31\204\337\236\154\61\272\123\140\64\52\367\101\374\135\312\236\24\30\205\115\4\3\43\161\212\153\44\317\156"
+  "\34\100\330\120\250\377\240\16\354\261\242\305\43\100\113\54\342\317\16\162\242\274\351\101\112\64\226\305\123\47\362\237"
+  "\254\241\23\215\141\301\324\211\234\217\4\371\22\215\346\131\57\235\310\177\4\206\116\264\236\72\146\14\341\272\143\264"
+  "\204\146\223\171\33\266\103\174\242\262\367\330\305\372\60\152\337\7\105\320\145\27\155\363\316\333\326\135\326\352\54\227"
+  "\271\125\307\276\274\125\222\257\172\20\2\344\262\16\370\135\254\316\72\166\147\211\21\215\171\246\133\6\37\105\302\366"
+  "\211\256\125\201\163\60\112\165\216\174\224\347\231\355\243\274\130\352\71\340\305\122\365\225\210\204\347\130\145\27\103\20"
+  "\337\15\205\366\214\153\101\232\313\133\265\347\12\265\25\273\125\205\267\361\16\155\12\357\340\155\327\24\176\207\167\130"
+  "\123\370\155\121\374\26\255\7\55\122\47\71\163\205\347\341\231\200\336\75\157\116\175\324\336\152\112\356\310\117\356\341"
+  "\27\316\176\154\112\346\10\354\325\302\276\272\60\324\235\56\124\374\240\55\47\177\134\330\217\347\103\175\47\27\327\47"
+  "\360\10\46\157\213\244\155\335\71\30\256\24\366\312\334\104\157\347\102\312\335\223\310\133\302\171\366\2\267\355\137\51"
+  "\325\206\343\135\307\274\353\337\141\326\152\40\376\267\355\325\172\273\61\350\0\12\277\304\333\226\51\274\231\267\55\123"
+  "\370\5\336\266\114\341\347\170\333\62\205\267\360\126\145\12\343\31\1\333\124\370\25\336\266\114\341\147\171\333\62\205"
+  "\337\344\155\313\24\176\236\267\55\123\370\105\336\266\114\341\115\274\155\231\302\157\360\266\145\12\277\312\333\226\127\353"
+  "\255\320\37\252\360\56\336\266\114\341\327\171\333\62\205\137\23\270\11\265\320\56\172\227\341\236\303\226\234\270\127\234"
+  "\17\41\206\43\161\117\374\136\145\312\207\174\261\333\124\254\204\130\332\162\350\163\56\247\136\322\7\131\211\227\175\200"
+  "\23\270\57\167\361\242\235\363\274\335\273\301\20\263\64\53\230\316\240\105\305\147\366\347\203\312\257\325\166\275\105\233"
+  "\5\162\177\236\72\300\125\166\30\127\371\207\131\64\134\171\21\127\315\226\110\136\35\203\300\41\203\6\131\352\213\275"
+  "\166\34\117\356\64\365\116\210\337\110\350\261\202\112\242\367\27\122\72\221\371\246\257\224\371\246\326\101\363\115\362\14"
+  "\230\157\242\21\312\361\153\350\254\74\7\372\375\56\164\372\232\123\66\17\372\162\135\270\50\370\272\105\344\237\307\201"
+  "\114\212\134\355\107\352\152\7\251\253\31\251\253\31\251\253\333\102\212\134\324\274\304\365\102\313\45\64\2\154\217\154"
+  "\155\346\347\203\165\217\221\54\372\224\335\43\221\206\117\230\157\203\76\327\370\351\163\215\131\20\7\55\361\145\153\204"
+  "\275\306\247\303\266\252\263\53\134\211\154\51\320\32\332\254\364\31\60\32\167\313\372\14\313\202\122\326\12\173\155\156"
+  "\51\164\66\206\133\312\252\257\136\312\77\124\51\353\204\275\56\267\24\317\331\33\156\131\357\25\150\167\253\175\355\56"
+  "\234\327\354\127\266\227\347\130\261\376\124\141\175\275\151\137\157\346\140\375\54\235\61\262\307\273\273\261\132\156\24\346"
+  "\63\350\137\340\161\61\70\352\151\360\147\220\343\317\340\331\43\200\140\176\123\154\147\351\305\235\204\177\127\230\255\137"
+  "\25\207\126\304\241\25\217\372\40\311\273\301\264\157\310\255\367\256\374\46\124\226\2\232\341\206\334\171\146\127\334\65"
+  "\33\271\326\364\52\326\153\211\244\364\273\26\206\240\327\232\276\365\275\152\271\123\230\357\11\174\177\255\32\141\136\153"
+  "\36\65\302\357\41\302\357\341\311\51\140\122\321\51\51\166\312\71\63\53\353\235\223\142\271\230\147\22\252\70\374\236"
+  "\147\172\166\12\272\307\55\264\277\113\324\75\25\305\103\365\17\204\171\370\253\126\342\60\2\74\214\373\315\211\352\67"
+  "\232\366\215\271\124\307\116\72\24\171\220\113\214\150\163\230\346\343\256\63\275\203\330\43\251\272\145\202\246\3\302\205"
+  "\264\145\73\52\22\117\365\315\323\117\200\353\115\246\175\123\56\256\207\310\36\72\262\270\326\227\55\60\355\5\271\71"
+  "\257\224\355\14\334\334\354\67\233\366\315\271\331\267\12\367\253\174\356\222\40\155\313\306\325\375\40\37\363\100\175\117"
+  "\201\141\340\175\316\26\376\133\114\203\367\222\367\361\354\120\307\215\356\205\277\276\160\63\156\61\35\110\3\326\112\217"
+  "\57\241\372\306\75\214\130\177\115\161\152\277\72\177\177\1\106\360\221\237\261\273\221\236\37\253\167\366\157\327\323\307"
+  "\160\160\353\66\140\372\63\147\320\377\63\123\155\161\17\267\171\262\200\135\251\167\254\337\142\346\236\50\140\36\361\104"
+  "\1\347\313\212\155\2\270\315\164\16\66\70\302\161\2\277\224\370\101\20\147\157\376\125\271\120\156\67\365\316\373\23"
+  "\332\71\114\0\41\331\265\155\2\372\271\231\163\64\100\201\32\340\11\2\32\353\220\207\227\136\62\341\331\1\246\163"
+  "\42\201\357\354\200\274\272\340\311\1\16\376\126\336\311\1\271\30\343\231\1\4\172\226\310\256\222\52\71\256\34\334"
+  "\355\161\122\121\333\276\321\155\26\267\252\45\216\270\144\125\316\53\126\316\327\203\250\320\40\115\212\200\135\161\267\164"
+  "\374\151\17\374\123\113\127\10\36\52\262\204\133\76\55\301\350\205\53\122\26\365\364\61\40\317\324\376\51\307\262\144"
+  "\125\140\261\207\244\236\231\7\267\36\316\102\317\6\364\236\244\317\65\105\242\146\137\362\201\4\370\57\351\123\1\161"
+  "\135\107\373\263\251\111\372\245\354\250\351\367\62\262\372\351\110\332\343\307\156\51\374\245\221\255\322\34\116\13\343\240"
+  "\310\77\340\43\175\360\153\43\365\172\151\174\271\210\44\324\23\176\336\106\373\120\156\225\312\265\212\16\117\362\307\226"
+  "\15\322\47\77\214\360\256\230\223\303\211\34\151\216\242\324\144\17\327\37\205\307\345\50\320\150\243\254\221\164\256\65"
+  "\176\256\204\343\321\167\210\26\377\147\371\34\174\216\337\230\313\103\44\321\1\167\225\325\343\357\311\45\160\201\76\46"
+  "\357\167\172\204\302\60\14\135\335\3\344\166\354\205\306\236\115\155\200\124\123\63\313\161\273\67\50\333\132\107\55\327"
+  "\152\255\134\353\121\361\256\72\376\225\323\344\272\145\176\155\146\63\167\302\165\27\134\167\233\364\41\50\373\327\246\175"
+  "\47\376\307\103\76\356\2\323\32\377\103\70\34\354\320\356\307\237\234\17\320\56\122\332\244\202\240\43\344\173\340\272"
+  "\327\63\27\352\231\235\354\17\55\360\116\334\174\326\237\76\245\363\315\262\173\114\76\165\255\32\13\147\365\217\321\367"
+  "\72\321\367\360\154\224\175\257\111\312\75\14\165\162\75\357\132\214\15\206\377\263\57\367\231\364\5\306\363\351\353\100"
+  "\213\1\211\373\333\106\344\106\341\101\144\261\351\174\142\164\103\356\367\255\26\233\372\343\74\341\156\337\56\273\337\124"
+  "\52\244\73\246\72\125\33\316\364\264\301\360\235\242\240\62\206\273\175\47\162\277\111\11\252\74\105\320\40\345\176\147"
+  "\117\337\22\104\335\50\127\337\100\276\105\253\145\74\333\64\122\11\231\303\45\341\310\55\102\37\206\224\245\263\314\235"
+  "\222\222\364\231\140\224\122\352\375\132\214\163\60\60\255\24\115\50\12\100\121\220\371\26\341\117\325\211\137\166\376\277";
+
+/* lib/stdlib.wbo (DEFLATEd, org. size 17163) */
+static unsigned char file_l_59[8327] =
+  "\325\73\173\174\124\305\271\63\147\167\363\332\4\26\53\126\103\151\347\54\261\5\65\153\66\211\274\202\45\24\133\345"
+  "\41\25\102\2\304\332\164\167\263\11\33\66\233\165\167\103\22\115\316\11\362\50\152\261\136\51\250\140\225\122\100\11"
+  "\340\363\126\133\355\303\240\40\50\42\25\212\310\325\253\74\132\113\302\323\342\55\126\41\367\373\146\346\234\75\233\104"
+  "\364\237\336\337\357\156\70\147\316\174\363\315\67\337\153\276\371\146\316\201\64\371\33\350\75\112\132\74\121\35\16\371"
+  "\155\201\130\302\26\217\346\245\325\7\353\33\142\55\0\215\205\42\265\130\13\104\133\322\241\26\11\324\107\261\32\17"
+  "\46\260\61\34\214\70\202\261\130\244\41\35\141\115\276\250\43\220\150\211\6\323\103\361\352\120\155\50\1\145\74\352"
+  "\13\4\63\102\361\146\1\110\64\204\33\232\202\61\173\275\57\61\327\21\256\16\66\107\323\32\43\41\30\334\36\367"
+  "\307\346\135\326\344\213\207\252\342\21\137\64\76\267\41\121\25\215\5\347\207\202\115\336\214\232\352\252\246\130\50\21"
+  "\164\6\43\363\103\261\206\110\125\155\60\61\310\170\216\207\356\10\306\21\222\31\215\65\4\252\202\315\241\104\166\103"
+  "\44\21\214\325\127\325\64\106\2\161\243\22\150\150\214\44\62\361\61\24\361\45\202\31\125\222\100\166\125\275\57\34"
+  "\206\236\160\315\33\140\124\32\43\130\265\127\307\275\171\256\150\103\323\165\125\336\302\321\125\276\110\140\156\103\54\236"
+  "\4\64\324\324\200\46\342\351\34\60\262\370\222\140\263\57\0\174\243\210\161\150\254\362\26\70\252\343\205\205\171\170"
+  "\57\312\163\306\174\221\352\342\321\125\361\140\260\72\47\130\37\115\264\30\74\100\173\161\121\136\272\277\61\60\17\310"
+  "\145\65\46\152\106\127\45\174\376\160\320\21\365\105\102\1\32\247\21\245\246\332\346\217\346\331\152\340\12\171\341\52"
+  "\204\13\372\124\161\214\32\133\115\175\302\346\213\346\51\276\250\155\276\57\114\203\64\112\353\35\360\64\154\224\55\70"
+  "\154\214\75\72\314\133\140\257\37\346\365\246\41\314\133\150\17\16\363\26\43\364\72\204\216\24\320\121\10\105\334\102"
+  "\304\55\364\322\152\133\250\30\206\271\16\256\221\160\215\202\153\64\134\143\362\354\41\157\101\236\342\315\123\12\363\224"
+  "\342\74\245\50\117\271\56\117\31\225\247\214\314\123\0\1\333\306\100\1\154\172\213\340\2\126\275\305\171\166\137\242"
+  "\241\6\275\46\321\120\215\317\41\133\44\130\213\17\141\7\336\302\351\215\365\215\141\320\52\365\121\277\55\72\67\244"
+  "\370\12\24\237\127\361\27\50\176\257\55\132\120\0\27\224\136\50\275\136\133\175\250\72\303\60\3\275\335\26\13\306"
+  "\151\310\6\346\120\302\167\50\320\65\334\140\17\64\304\142\112\264\100\211\172\263\203\241\170\60\134\25\16\326\207\142"
+  "\101\332\4\316\27\111\70\32\243\321\40\264\27\346\370\103\265\221\306\372\52\30\333\127\135\115\233\225\150\304\21\360"
+  "\305\142\55\64\61\40\331\204\103\321\171\131\22\20\237\33\126\232\342\212\77\156\140\300\254\230\353\13\327\50\321\200"
+  "\22\251\166\4\346\66\106\346\71\342\1\137\70\350\24\342\126\305\301\355\101\364\120\140\136\13\15\144\111\140\165\60"
+  "\140\17\106\252\243\266\352\6\260\135\244\305\221\210\201\303\246\201\126\140\136\50\221\46\33\26\321\152\45\132\257\104"
+  "\203\112\44\241\104\23\106\327\271\301\346\214\232\30\70\133\250\41\222\216\17\70\223\120\256\370\35\151\100\55\332\20"
+  "\167\0\44\176\207\75\12\205\35\21\62\14\116\354\65\215\341\260\55\62\254\50\203\117\111\60\74\22\215\44\32\32"
+  "\353\175\315\366\110\64\21\113\103\246\22\61\273\337\27\17\72\140\266\64\306\351\174\211\23\2\234\114\116\11\237\204"
+  "\61\303\351\242\220\145\143\70\103\226\141\201\211\164\323\353\204\357\73\232\343\215\376\220\35\53\216\70\336\323\161\62"
+  "\0\17\16\237\277\41\226\110\203\211\11\363\127\251\211\330\261\4\372\276\104\143\374\222\120\44\224\10\371\302\60\321"
+  "\315\11\3\121\247\41\226\201\272\7\116\343\146\140\360\67\326\144\33\317\330\140\3\274\64\61\245\323\2\274\0\145"
+  "\4\203\151\20\56\0\315\36\361\325\7\155\20\304\154\120\111\367\307\203\276\130\140\256\155\136\260\305\21\201\170\346"
+  "\267\143\150\261\361\210\27\252\16\125\67\143\321\340\257\263\127\207\152\152\300\112\115\265\60\327\340\162\334\36\7\326"
+  "\151\135\72\6\300\150\260\72\23\103\231\37\303\207\342\17\145\106\101\17\242\22\5\257\366\207\24\177\35\24\205\116"
+  "\10\60\241\210\100\3\234\370\134\376\144\363\307\357\310\0\44\14\175\1\376\20\157\14\4\34\261\140\42\326\222\125"
+  "\23\212\124\373\347\45\200\221\364\250\257\45\334\340\253\116\363\207\347\201\175\322\233\205\204\31\315\261\40\177\120\42"
+  "\121\173\103\254\66\222\156\324\343\167\330\174\376\270\75\14\67\107\30\357\266\352\320\174\33\150\317\126\35\214\330\303"
+  "\120\1\60\336\353\41\346\104\322\352\375\211\206\246\200\22\212\52\201\2\45\22\240\141\107\50\34\17\336\236\325\24"
+  "\110\64\324\373\253\2\163\347\51\115\1\120\153\63\42\13\140\106\275\77\216\235\342\366\50\334\224\206\150\6\24\330"
+  "\20\247\344\62\233\142\243\72\125\354\204\300\23\321\355\216\64\233\256\353\24\36\322\215\207\14\343\41\23\60\165\133"
+  "\126\26\242\71\21\110\354\331\71\10\263\147\17\20\305\100\121\270\170\61\350\22\245\125\247\255\366\257\135\312\253\203"
+  "\57\263\353\202\320\340\257\53\242\274\134\226\127\120\35\206\317\45\272\115\31\2\304\225\157\100\175\252\215\16\245\320"
+  "\261\23\70\243\337\64\237\276\45\237\24\312\10\241\351\164\370\264\362\251\123\107\140\135\45\64\343\176\33\255\334\137"
+  "\362\300\376\262\263\47\307\227\374\52\155\104\307\370\101\347\356\376\143\327\276\107\322\72\263\26\105\102\57\275\374\350"
+  "\303\115\333\352\26\372\167\37\137\135\170\74\153\342\247\265\107\246\271\67\276\63\370\212\113\217\175\366\304\213\176\362"
+  "\130\317\231\51\163\327\326\257\175\377\275\266\67\62\317\267\275\165\333\265\277\330\330\334\235\263\254\354\62\337\272\214"
+  "\277\45\116\57\376\343\273\63\112\306\157\177\373\203\175\73\26\305\77\234\100\316\276\173\174\304\332\362\330\332\325\276"
+  "\45\373\377\160\341\302\200\73\313\262\166\374\362\201\347\74\203\136\230\274\145\173\331\316\267\37\12\167\56\31\171\352"
+  "\212\355\363\273\76\273\267\362\371\362\161\377\65\255\173\126\341\214\367\131\330\71\374\360\323\207\226\275\22\70\270\375"
+  "\312\77\357\50\177\51\224\363\364\363\356\234\363\333\36\274\363\47\327\247\337\66\364\201\373\116\76\260\174\317\143\23"
+  "\375\236\302\236\261\4\177\303\347\235\44\362\367\334\340\364\235\167\356\176\360\145\136\161\75\66\245\151\161\166\121\311"
+  "\324\345\253\257\355\136\372\330\331\362\135\201\252\261\273\47\117\152\236\375\331\260\327\202\245\153\156\332\144\377\106\371"
+  "\46\332\236\235\371\306\266\153\322\367\376\351\223\55\77\372\150\303\336\47\266\375\116\131\267\41\323\377\110\230\135\126"
+  "\365\102\246\247\365\266\325\255\213\6\35\174\361\302\165\276\25\241\63\113\312\353\376\122\342\334\237\170\172\357\201\141"
+  "\207\157\277\347\316\317\234\357\375\151\334\107\233\235\345\324\165\363\366\160\40\367\221\322\347\117\335\267\351\336\373\146"
+  "\376\163\353\363\167\357\311\235\136\375\366\113\145\243\67\34\212\207\306\254\71\27\157\376\361\320\33\27\174\143\272\347"
+  "\306\347\147\34\73\267\345\350\370\257\175\10\226\161\23\152\137\107\351\212\215\165\165\301\140\145\135\105\345\252\125\345"
+  "\53\126\155\130\325\261\361\341\212\362\340\212\212\225\353\37\256\334\130\131\261\276\174\103\167\135\107\107\307\252\225\165"
+  "\253\126\155\10\255\350\250\10\255\137\377\160\371\234\162\370\315\351\130\261\276\143\343\52\376\214\277\212\340\312\115\377"
+  "\232\200\117\256\33\312\255\277\365\35\17\127\324\204\66\156\14\165\164\124\166\124\316\131\137\207\235\127\224\227\7\153"
+  "\52\140\310\120\315\306\272\215\35\33\67\166\124\126\166\254\252\353\250\133\137\131\21\54\137\131\1\264\73\102\33\67"
+  "\325\15\106\77\32\6\176\164\200\122\52\365\355\220\345\25\262\154\223\345\355\212\50\257\313\26\145\346\365\242\314\367"
+  "\212\236\207\76\21\75\203\157\16\345\345\247\312\12\136\276\77\340\30\357\71\175\362\262\1\130\256\210\157\275\11\313"
+  "\143\23\166\315\303\236\313\46\235\317\115\207\262\263\341\343\45\303\240\334\346\371\375\332\147\240\174\367\330\346\374\146"
+  "\33\41\327\377\307\117\216\316\36\104\210\167\377\341\306\337\127\20\362\211\47\162\363\223\317\120\262\263\353\333\13\153"
+  "\233\63\310\211\25\133\177\356\250\274\212\374\352\304\256\335\103\266\356\45\127\256\43\131\367\276\356\266\377\256\330\126"
+  "\370\302\331\55\227\202\204\171\40\341\157\15\1\117\217\27\145\136\251\50\347\210\262\364\347\242\134\372\212\50\353\316"
+  "\361\262\175\221\147\2\226\173\56\11\360\162\321\73\17\116\20\122\276\211\45\253\132\243\174\17\312\277\317\277\151\24"
+  "\226\153\177\221\133\17\145\351\137\37\51\130\13\345\375\337\174\365\367\373\241\54\376\366\47\363\262\47\222\366\17\107"
+  "\265\274\62\141\42\131\163\140\361\254\342\371\23\311\216\151\265\365\235\233\46\12\21\17\115\54\375\331\157\232\207\76"
+  "\65\370\206\133\116\35\336\177\64\167\312\15\17\374\345\346\264\267\116\267\337\0\22\134\11\163\77\223\116\232\366\203"
+  "\111\323\46\315\234\203\126\373\66\217\6\323\46\114\33\176\25\217\6\337\41\124\111\303\207\341\340\174\166\174\0\60"
+  "\35\115\103\230\161\106\174\141\306\127\251\261\254\61\202\271\34\113\64\60\214\344\241\340\374\40\223\213\124\175\60\222"
+  "\140\42\313\216\147\41\201\253\200\122\30\37\256\206\207\237\121\332\116\222\77\135\226\37\302\205\123\23\206\46\75\140"
+  "\106\304\71\55\341\350\50\75\75\160\313\40\344\234\204\137\302\141\337\202\73\45\237\23\1\277\234\303\172\300\326\214"
+  "\134\200\147\204\177\123\300\160\30\73\351\357\147\247\327\20\210\246\344\73\132\276\256\171\164\355\132\135\53\320\65\257"
+  "\256\25\352\132\221\256\25\353\303\24\233\273\240\223\270\272\211\273\130\365\166\22\105\275\226\171\335\205\54\177\44\121"
+  "\30\324\355\135\304\135\304\74\130\273\26\353\24\157\31\135\204\101\16\151\163\15\276\54\227\101\346\150\33\150\247\327"
+  "\121\34\347\67\66\155\244\256\215\322\265\321\72\216\70\106\327\306\352\132\211\256\215\323\265\353\165\355\273\272\66\136"
+  "\327\112\165\155\202\256\175\117\327\46\352\332\15\272\366\175\135\373\201\256\335\250\153\67\351\332\244\336\354\151\223\165"
+  "\155\212\256\115\325\265\233\165\155\232\256\375\120\327\156\61\170\136\103\201\351\133\124\57\33\245\216\126\246\333\146\260"
+  "\221\327\200\300\245\274\350\44\127\276\106\354\72\360\353\140\43\341\16\122\110\360\166\342\344\110\22\254\142\301\156\101"
+  "\141\350\65\16\331\367\37\144\73\342\214\146\243\101\63\200\63\172\70\121\334\371\260\274\274\206\340\174\370\343\35\34"
+  "\231\330\247\15\226\234\116\222\146\320\160\22\223\262\101\356\150\77\344\324\61\250\310\341\300\327\130\265\204\215\201\346"
+  "\61\235\244\35\176\315\210\53\37\325\161\16\4\223\35\34\104\330\230\156\302\101\352\70\47\110\241\224\331\146\52\345"
+  "\254\4\106\3\105\224\200\321\306\165\222\254\323\60\140\101\27\201\5\302\131\316\1\47\211\33\12\362\6\311\231\351"
+  "\234\351\54\63\11\46\73\26\165\222\174\304\47\216\44\254\30\250\160\30\53\141\143\131\111\67\61\344\353\43\335\47"
+  "\375\111\167\275\224\116\210\370\135\165\74\273\36\160\256\127\113\225\12\333\54\145\66\33\57\306\31\357\236\314\112\123"
+  "\231\236\315\1\300\164\251\140\172\226\163\226\263\302\221\354\60\305\144\154\74\373\56\33\177\21\306\116\365\307\330\4"
+  "\144\154\17\61\70\373\236\72\221\115\0\244\11\352\15\312\34\133\245\162\53\233\50\6\232\350\236\312\156\0\117\267"
+  "\160\166\53\7\0\147\67\10\316\52\235\225\316\71\216\144\207\233\115\316\46\262\357\261\211\27\341\354\64\162\46\235"
+  "\223\3\316\21\351\226\251\314\176\37\231\75\147\62\373\3\365\106\366\175\100\372\276\172\223\362\43\333\155\312\217\331"
+  "\215\142\354\33\335\323\330\115\320\357\64\161\117\2\345\355\4\342\154\22\347\333\201\145\126\67\20\70\4\144\234\134"
+  "\216\37\163\134\220\343\46\41\307\155\316\333\234\77\162\44\151\375\320\224\343\106\366\3\166\143\77\162\240\367\31\177"
+  "\331\63\340\76\303\71\335\210\3\125\230\211\265\72\140\366\63\234\61\56\372\23\0\372\20\250\117\223\101\310\17\242"
+  "\23\325\203\67\77\237\270\371\240\4\127\366\0\61\267\304\30\371\271\6\141\5\234\134\51\343\70\235\344\352\156\62"
+  "\300\226\135\236\75\63\273\54\33\234\31\160\125\77\370\271\245\233\163\246\62\313\126\41\111\346\340\274\311\142\236\343"
+  "\304\202\302\11\25\164\23\230\114\236\354\12\30\244\302\71\213\371\101\145\36\7\116\62\117\67\110\5\74\7\376\37"
+  "\362\134\215\74\153\323\71\317\232\340\171\63\375\77\344\172\63\145\236\13\375\361\275\231\236\117\345\134\3\316\267\42"
+  "\347\347\5\347\101\142\323\64\340\175\266\126\243\151\265\232\66\127\327\102\232\126\247\151\363\64\55\254\151\365\232\26"
+  "\321\264\6\115\213\152\332\355\32\54\17\254\146\53\256\174\75\3\27\122\65\304\152\72\11\333\114\227\122\265\216\325"
+  "\46\341\363\130\255\1\17\263\20\233\167\201\250\365\120\206\241\214\260\72\136\157\200\22\353\121\126\57\121\131\304\44"
+  "\360\71\141\15\226\212\172\73\233\13\101\66\312\42\22\25\333\223\217\267\233\217\243\210\115\326\226\120\126\157\122\130"
+  "\104\101\316\30\137\216\367\122\55\256\153\11\135\153\324\265\32\135\233\257\153\115\272\326\254\151\55\232\166\207\246\215"
+  "\323\264\73\65\255\125\353\273\26\132\126\353\311\260\360\305\73\311\176\5\2\103\143\47\31\162\202\250\65\14\37\116"
+  "\21\165\176\33\154\173\120\51\312\161\120\177\306\161\230\372\43\210\115\155\116\1\323\56\153\133\13\233\17\136\362\72"
+  "\304\240\66\110\165\261\142\64\271\307\261\26\346\145\223\171\14\10\252\167\262\161\254\131\46\1\120\167\267\62\57\40"
+  "\175\116\344\303\76\214\142\242\25\164\125\10\20\30\151\263\120\12\104\24\357\210\14\333\247\344\161\352\156\202\321\170"
+  "\170\106\210\332\314\132\325\26\7\177\146\115\134\155\255\235\220\60\261\46\364\234\245\240\71\304\220\55\167\366\152\151"
+  "\301\50\324\6\273\11\224\336\165\2\204\262\43\347\20\77\71\340\24\212\172\226\374\17\24\266\63\144\13\165\337\1"
+  "\43\157\241\177\306\261\133\130\13\347\16\174\263\45\11\155\66\140\315\270\42\266\60\350\100\267\100\35\144\114\126\366"
+  "\45\61\77\347\230\40\134\2\62\245\146\64\176\102\310\137\314\132\260\46\3\143\33\121\320\301\217\121\15\176\140\175"
+  "\260\265\256\241\335\333\251\256\55\240\51\231\217\264\63\3\73\27\241\235\215\244\253\210\33\41\306\64\324\241\332\304"
+  "\64\241\23\267\46\124\347\105\3\265\160\73\164\222\36\333\26\272\220\212\222\313\205\110\56\33\222\272\234\233\56\27"
+  "\355\72\342\162\33\227\13\37\204\355\372\61\33\67\34\202\306\243\316\141\344\166\312\1\254\35\350\147\166\161\113\250"
+  "\20\154\272\326\345\260\70\372\226\353\23\270\215\7\206\333\301\313\320\126\300\106\72\150\144\1\356\321\167\311\154\146"
+  "\1\355\66\334\360\145\262\133\0\267\120\241\56\30\121\117\301\301\41\334\72\2\51\212\5\74\353\234\103\16\65\272"
+  "\264\360\326\3\270\374\301\324\150\335\115\60\70\72\145\365\353\273\222\125\350\53\265\103\121\71\22\136\312\364\244\104"
+  "\113\204\210\134\163\372\126\242\101\74\321\271\46\276\200\211\255\74\145\203\237\353\40\164\61\153\31\252\316\120\152\214"
+  "\206\13\50\166\27\361\0\176\115\110\222\67\366\14\334\155\355\163\256\207\44\265\0\10\233\1\245\30\71\132\104\15"
+  "\147\272\213\22\176\154\102\156\5\306\164\155\21\345\51\66\204\222\305\340\136\20\124\226\120\14\222\30\64\212\40\124"
+  "\156\241\352\142\252\314\300\145\240\321\66\235\65\262\105\260\377\121\166\220\155\44\147\206\62\223\55\244\70\123\214\131"
+  "\3\46\30\267\205\102\24\137\214\236\15\152\260\64\203\157\54\1\373\343\156\140\11\65\142\353\142\352\234\211\30\50"
+  "\142\143\366\164\347\164\347\14\350\313\215\371\66\52\233\17\326\111\16\102\326\151\52\32\150\56\242\356\42\234\244\105"
+  "\254\210\267\103\367\221\130\212\201\212\201\4\37\210\257\16\77\245\204\37\54\345\231\322\56\245\272\62\3\144\131\112"
+  "\171\330\112\112\262\210\362\0\206\360\34\161\337\101\206\44\243\331\343\224\47\45\167\41\317\274\25\126\324\245\124\160"
+  "\15\3\335\55\7\172\201\132\107\322\356\201\353\136\312\303\265\7\165\214\12\356\275\111\341\344\30\204\341\173\250\170"
+  "\204\100\174\57\25\322\253\36\166\57\225\373\7\264\102\252\65\74\137\140\211\376\224\17\164\316\242\151\76\46\246\21"
+  "\0\324\15\361\355\213\355\200\73\41\346\351\153\1\17\2\21\333\143\214\120\4\35\270\316\301\363\356\21\232\305\256"
+  "\360\214\263\364\40\61\247\120\51\154\74\74\74\141\4\31\312\160\124\230\301\40\104\271\62\213\263\54\173\30\266\114"
+  "\225\13\107\230\305\71\305\356\331\145\316\62\147\271\62\133\350\243\202\367\345\12\231\255\124\246\210\77\31\60\260\153"
+  "\145\122\310\12\310\46\146\113\376\124\17\60\15\116\65\205\357\126\301\226\77\23\163\104\243\372\277\24\155\31\330\353"
+  "\76\270\40\360\102\166\221\317\115\11\353\54\354\116\177\16\320\373\351\227\154\74\145\100\376\320\1\21\171\232\33\267"
+  "\20\16\64\10\360\41\367\311\373\260\16\33\51\24\316\310\101\340\227\16\163\174\34\246\41\305\42\162\272\307\312\165"
+  "\257\223\354\156\122\307\72\330\270\144\244\130\204\250\320\376\134\6\250\145\254\23\324\307\347\342\5\302\303\15\314\305"
+  "\161\20\234\213\205\22\160\310\277\343\322\77\231\215\173\234\132\0\142\307\76\5\167\176\114\14\11\215\74\365\273\117"
+  "\332\223\73\340\317\61\44\251\367\123\245\114\250\235\73\116\346\16\264\266\304\23\206\6\63\224\201\251\227\121\236\310"
+  "\171\370\212\275\114\206\263\145\30\316\220\120\26\244\252\313\250\5\156\144\175\135\70\20\273\137\240\300\150\220\77\32"
+  "\246\343\303\240\375\357\243\331\142\137\352\145\122\255\320\1\310\262\151\174\255\273\213\232\33\214\70\167\62\134\242\114"
+  "\314\270\304\372\51\354\244\244\2\14\143\340\352\21\207\275\213\201\340\104\354\261\174\114\260\141\176\137\132\371\56\230"
+  "\375\375\222\311\357\46\330\6\73\156\314\167\275\303\367\70\60\134\361\251\341\65\253\335\226\304\203\333\330\234\151\206"
+  "\267\114\145\123\105\240\353\106\13\32\271\260\62\333\126\11\104\366\131\150\32\34\110\340\105\51\163\277\273\231\335\154"
+  "\245\134\11\224\53\141\136\160\326\4\31\21\170\164\176\176\223\204\102\144\64\26\32\330\371\46\45\1\207\230\223\234"
+  "\323\267\52\267\201\234\226\371\153\162\150\201\131\7\370\62\334\235\311\141\235\267\45\343\300\34\347\34\347\255\250\157"
+  "\271\306\375\7\45\16\235\117\140\310\205\55\363\367\1\312\347\360\162\252\343\104\113\256\231\142\335\225\23\357\237\75"
+  "\104\255\5\261\320\363\153\371\132\264\137\370\56\70\36\70\102\255\114\343\134\20\45\334\313\345\314\320\370\142\356\140"
+  "\274\16\256\256\261\7\350\66\320\200\10\241\106\253\321\125\46\1\116\156\216\315\24\143\246\134\363\162\246\163\44\236"
+  "\103\326\46\67\127\20\47\123\370\335\227\302\120\222\223\35\306\331\200\301\207\56\371\330\226\114\140\152\345\350\173\44"
+  "\310\111\162\146\312\101\77\307\101\313\0\124\6\313\101\55\350\361\27\62\127\240\255\57\333\61\362\241\52\375\272\266"
+  "\2\12\370\255\204\342\101\270\36\202\353\141\251\344\125\102\321\253\241\170\4\256\137\302\5\332\326\36\205\353\61\52"
+  "\14\260\106\254\206\137\375\264\316\45\16\353\270\212\124\15\243\316\112\24\117\175\220\337\37\342\367\207\371\235\7\40"
+  "\165\25\277\343\234\127\127\363\307\107\50\32\23\104\64\316\341\170\234\341\52\363\160\45\255\114\125\122\51\106\270\225"
+  "\134\215\342\0\43\73\147\33\100\263\247\73\260\341\101\52\2\35\357\211\64\12\54\363\152\245\305\354\245\30\167\320"
+  "\101\343\270\33\270\117\164\303\20\146\164\107\106\200\71\210\57\310\362\327\304\131\135\26\104\156\15\162\50\116\31\267"
+  "\52\140\25\215\43\140\327\125\364\42\103\360\56\257\111\376\37\102\272\206\140\22\261\213\43\32\177\226\260\153\106\312"
+  "\7\223\35\126\230\352\132\101\345\261\256\223\274\152\236\17\233\171\46\310\360\113\152\304\371\155\311\363\51\11\371\253"
+  "\161\100\45\107\163\77\52\340\371\134\1\217\112\26\170\11\126\164\60\331\174\165\257\146\316\60\157\63\114\2\231\4"
+  "\116\14\16\343\125\206\326\136\263\54\215\37\121\256\226\253\313\243\326\45\145\65\345\104\14\232\246\257\77\112\371\222"
+  "\4\215\51\102\27\1\317\134\152\366\260\105\347\260\45\0\352\335\240\157\54\361\150\114\215\63\315\330\4\12\331\101"
+  "\331\35\155\73\204\334\232\221\317\202\131\136\45\171\131\131\270\47\342\253\361\26\12\173\44\216\374\237\312\353\311\166"
+  "\150\235\154\235\355\34\351\41\303\60\72\323\222\33\206\3\51\373\224\272\324\155\313\145\273\54\361\36\26\166\355\105"
+  "\72\6\166\136\161\343\24\327\213\353\312\325\304\326\106\363\214\65\117\146\273\0\374\65\342\302\232\206\53\204\304\301"
+  "\236\106\363\132\154\106\237\363\272\247\301\366\60\56\17\372\332\160\327\372\120\212\262\64\231\203\260\70\64\363\215\321"
+  "\333\111\266\160\46\264\247\311\2\326\24\365\61\76\141\37\340\241\355\61\134\324\112\331\43\124\135\103\225\131\42\333"
+  "\200\64\0\340\74\311\233\245\124\260\65\326\354\142\215\64\354\32\264\262\245\122\221\314\372\312\235\345\260\156\126\332"
+  "\146\103\73\373\45\335\331\67\102\2\341\112\145\216\101\270\200\213\140\214\362\232\211\263\15\171\164\316\261\214\222\75"
+  "\333\71\33\226\116\64\355\17\201\145\140\22\224\262\12\367\260\217\201\257\310\101\270\370\56\130\236\214\43\15\334\31"
+  "\133\375\6\41\126\323\377\131\206\43\351\67\162\336\372\223\372\155\145\136\260\306\52\354\172\65\247\51\127\300\137\231"
+  "\221\373\163\245\127\344\306\120\275\226\266\362\270\214\161\372\327\224\277\155\131\7\305\172\270\66\300\365\70\134\117\210"
+  "\175\240\21\235\223\101\126\304\324\137\363\373\72\270\353\352\172\176\337\360\105\121\326\225\75\220\7\24\36\157\315\167"
+  "\53\330\11\262\4\47\256\171\353\50\320\110\11\110\154\235\174\134\227\214\115\20\150\36\307\100\3\155\335\34\147\75"
+  "\65\134\231\23\160\210\116\335\330\11\210\141\145\240\230\126\3\5\144\275\350\312\323\11\20\200\143\210\70\374\45\261"
+  "\156\40\36\70\252\117\120\36\160\326\121\313\70\62\61\356\223\304\232\213\113\337\46\165\71\305\365\276\0\364\261\313"
+  "\130\102\306\130\246\252\14\374\352\30\7\36\275\133\261\376\106\172\241\35\42\50\115\126\27\42\163\100\147\22\200\236"
+  "\262\225\270\330\23\270\41\37\303\227\221\47\222\21\357\11\372\73\252\256\105\245\300\316\102\106\352\75\175\142\367\151"
+  "\31\273\321\324\33\114\61\14\374\374\136\71\275\21\301\227\131\43\270\65\345\207\244\252\334\66\113\264\47\43\366\305"
+  "\366\0\253\51\333\40\341\33\150\366\54\40\61\13\146\60\341\300\176\54\127\324\327\162\275\202\167\51\3\273\143\364"
+  "\6\322\16\361\154\254\13\253\251\371\276\214\12\127\67\21\205\363\113\234\366\214\327\373\14\134\154\254\24\162\252\32"
+  "\14\234\356\61\237\164\313\264\35\202\154\255\245\251\313\212\61\240\203\41\73\256\101\227\200\175\122\107\231\154\256\107"
+  "\51\21\140\55\305\371\217\306\204\211\277\221\22\376\15\314\55\174\312\213\67\20\35\42\13\223\257\41\250\332\101\315"
+  "\23\375\224\144\10\64\12\223\121\234\274\137\265\135\332\275\203\162\317\32\301\265\155\34\316\13\52\216\24\353\72\344"
+  "\171\276\213\341\224\167\245\340\133\20\35\331\323\171\20\63\16\20\314\351\15\0\235\165\120\213\222\354\364\47\370\152"
+  "\230\266\166\122\224\144\205\210\141\50\27\10\265\51\365\30\205\277\250\140\371\60\0\227\115\372\330\200\24\17\264\104"
+  "\222\57\164\140\377\105\375\327\150\53\340\311\37\124\250\174\5\227\234\67\10\71\300\347\215\71\125\205\370\270\225\361"
+  "\203\31\135\20\234\7\232\243\354\354\63\351\216\45\23\246\66\172\45\354\63\66\122\67\350\306\146\342\101\45\103\242"
+  "\364\212\133\60\215\74\374\54\54\71\5\122\75\160\10\14\374\345\63\306\144\145\167\37\346\116\132\231\373\266\140\156"
+  "\23\20\264\355\356\167\116\260\115\264\27\77\347\172\172\263\60\271\77\26\344\112\207\232\223\112\373\5\276\3\331\114"
+  "\11\276\132\33\45\334\371\313\102\350\100\47\351\35\102\377\145\11\241\370\256\154\71\77\154\302\70\312\221\73\123\220"
+  "\17\366\213\334\151\40\353\300\320\26\143\235\325\26\53\332\223\340\222\117\301\365\264\360\320\147\240\170\26\126\321\111"
+  "\142\17\124\310\175\364\31\52\336\254\75\53\374\324\3\103\75\51\124\333\103\317\240\307\232\102\74\111\341\237\160\276"
+  "\47\151\256\74\162\303\267\170\271\311\51\303\321\240\367\313\270\1\174\231\12\227\66\266\200\130\277\172\273\241\21\331"
+  "\12\14\134\204\62\127\372\323\146\160\5\270\362\26\111\262\230\334\351\160\120\57\347\177\262\137\347\107\32\110\233\17"
+  "\251\360\41\141\113\247\76\55\34\231\366\117\276\324\312\124\57\176\301\373\261\67\30\4\12\47\377\366\0\71\166\375"
+  "\73\71\26\356\310\227\177\323\142\56\360\106\174\151\116\54\131\367\44\140\305\162\122\372\54\205\372\146\134\200\47\361"
+  "\5\370\131\172\21\271\314\265\371\51\163\166\74\205\223\372\111\31\363\237\241\166\15\337\173\76\113\317\203\310\317\212"
+  "\160\377\34\245\322\377\262\172\271\37\122\177\12\307\147\36\27\270\51\340\376\47\245\374\303\113\55\323\212\152\342\201"
+  "\103\113\304\337\110\104\75\353\142\210\217\43\352\363\137\225\346\13\137\235\346\157\277\52\315\337\175\125\304\27\105\330"
+  "\230\244\275\4\50\13\55\211\55\173\211\136\213\11\153\117\17\177\303\207\125\45\131\5\247\302\167\47\260\167\1\270"
+  "\335\12\147\2\256\56\244\133\311\211\135\317\375\363\175\302\26\122\74\156\165\156\26\140\350\1\246\133\110\37\67\172"
+  "\225\20\204\161\177\202\240\273\120\320\136\332\267\335\56\117\275\315\103\130\113\273\245\27\10\365\173\212\122\71\332\350"
+  "\167\300\25\137\104\77\372\4\75\342\17\224\122\235\14\321\376\150\131\37\21\7\217\234\357\373\33\322\301\232\301\310"
+  "\37\55\364\5\134\60\200\160\27\276\371\64\32\201\362\237\360\13\77\174\273\347\32\174\5\124\137\246\374\63\207\241"
+  "\132\47\345\303\24\352\155\312\20\161\322\310\166\342\333\140\45\227\40\304\135\210\207\171\205\254\260\237\167\65\105\254"
+  "\223\362\152\62\242\156\345\374\333\265\127\300\222\257\120\227\362\15\200\275\212\43\307\264\155\60\320\166\270\136\203\153"
+  "\7\375\202\357\321\230\370\36\155\30\35\152\314\42\276\45\162\50\73\251\70\262\265\233\237\240\135\356\336\146\210\317"
+  "\161\163\20\305\340\322\275\135\146\104\34\150\127\134\364\165\352\176\55\11\303\146\273\213\276\101\335\73\314\170\371\32"
+  "\254\123\273\150\366\116\114\25\167\120\254\16\376\172\257\61\114\54\100\260\42\347\321\241\362\104\205\3\214\367\340\155"
+  "\164\204\161\150\237\141\34\321\27\165\222\121\134\151\111\60\377\266\316\325\105\360\263\272\66\72\234\230\324\354\364\115"
+  "\141\246\261\332\156\320\330\133\160\355\1\305\356\66\103\314\156\352\162\144\252\157\1\57\257\122\145\6\150\115\335\103"
+  "\155\323\331\36\174\367\44\137\55\355\246\242\312\0\313\221\156\234\174\31\240\56\302\3\355\365\226\330\235\154\342\232"
+  "\304\345\174\46\0\71\367\100\136\274\140\342\147\236\300\337\237\51\345\147\265\300\343\30\355\155\31\276\366\302\265\17"
+  "\256\277\300\265\37\256\167\340\72\100\165\276\144\356\245\60\304\136\234\112\47\211\272\237\107\70\270\357\243\350\120\352"
+  "\73\224\275\115\31\334\377\102\7\361\74\330\175\300\264\316\73\24\323\356\3\346\236\355\35\354\5\175\200\300\136\244"
+  "\301\231\205\310\274\27\126\206\375\24\212\344\47\112\202\325\167\105\30\31\252\35\4\25\36\24\133\227\116\222\163\222"
+  "\270\261\222\151\56\53\274\311\330\71\71\325\203\150\120\204\341\171\3\337\135\110\10\220\374\57\31\277\311\254\76\162"
+  "\37\24\347\244\357\101\321\52\136\363\277\17\303\356\305\336\160\307\35\65\36\276\317\260\115\7\23\35\4\373\275\213"
+  "\55\230\142\274\117\225\162\176\132\2\252\121\133\361\35\33\312\167\20\26\235\235\306\213\266\106\250\202\344\357\121\326"
+  "\212\372\173\317\320\237\173\101\122\163\206\232\132\331\2\154\166\71\234\310\372\373\270\26\42\1\343\114\45\27\20\270"
+  "\32\133\305\353\70\347\114\164\307\367\251\220\370\15\62\44\307\170\103\372\337\102\175\171\332\7\24\277\354\144\37\0"
+  "\202\363\55\261\315\310\165\360\103\160\312\201\216\56\162\226\270\276\166\251\273\4\102\202\334\207\240\351\112\344\104\332"
+  "\146\351\303\112\200\362\207\202\362\317\50\47\175\10\256\303\160\35\201\353\50\355\347\214\31\6\121\217\210\374\353\10"
+  "\362\200\307\100\155\364\52\302\153\375\277\57\71\42\327\351\43\346\46\242\117\7\367\41\163\122\35\22\357\255\123\52"
+  "\166\361\326\117\144\303\251\235\41\14\162\44\150\162\0\324\5\232\22\304\222\262\313\344\343\10\52\350\15\101\25\265"
+  "\165\104\34\104\270\217\30\132\3\26\217\322\276\254\35\66\131\73\154\256\61\107\145\136\161\24\123\360\303\374\115\340"
+  "\121\331\70\105\360\331\213\313\251\242\213\231\247\34\102\7\376\53\337\157\222\253\115\315\233\113\53\210\144\127\244\20"
+  "\234\322\7\64\371\72\72\51\57\107\263\150\0\70\62\324\207\75\35\126\375\25\13\154\343\335\376\337\304\330\113\250"
+  "\364\50\156\165\344\341\43\270\376\16\327\261\76\326\267\165\321\124\136\360\145\371\141\312\112\324\103\302\367\234\162\216"
+  "\46\35\121\375\210\302\260\354\43\110\317\271\336\341\11\64\376\167\232\57\222\166\176\102\10\265\101\110\324\342\61\37"
+  "\120\200\272\100\77\234\22\372\16\207\250\45\331\135\174\263\314\11\201\114\307\122\10\35\353\227\320\261\76\204\16\31"
+  "\204\370\137\27\145\175\55\214\112\66\364\11\372\25\26\76\144\230\137\276\14\306\272\113\306\151\160\3\34\1\367\41"
+  "\143\11\351\145\262\51\202\32\150\275\133\114\266\157\151\307\101\273\47\304\27\110\354\70\40\236\306\267\326\157\42\13"
+  "\307\115\252\20\116\117\360\57\15\116\320\217\360\355\51\176\263\342\330\51\116\73\34\374\13\26\7\377\0\21\47\77"
+  "\156\370\117\12\342\327\340\376\251\217\107\101\42\333\115\335\310\323\220\235\102\63\56\230\372\51\363\316\20\335\43\204"
+  "\303\265\262\207\202\64\142\276\160\27\262\310\150\210\77\120\276\202\3\6\116\311\363\223\26\364\47\217\140\0\31\71"
+  "\15\327\31\203\31\214\104\142\304\22\361\172\352\220\141\304\355\326\320\4\120\112\222\374\232\160\356\147\157\30\253\205"
+  "\230\311\246\273\161\245\141\214\163\132\273\170\370\7\267\142\163\42\64\233\354\361\146\77\242\227\300\56\33\324\165\222"
+  "\252\247\251\230\64\352\31\312\116\233\232\72\215\56\121\2\273\221\63\224\337\166\222\41\367\234\263\161\336\0\335\5"
+  "\123\13\120\370\121\200\11\300\12\47\71\320\320\325\307\224\37\317\350\227\111\135\201\216\206\321\157\32\313\155\11\142"
+  "\237\102\154\0\16\42\304\0\0\107\303\350\267\20\160\32\3\310\353\42\77\161\0\1\376\75\252\13\310\2\370\15"
+  "\111\373\73\110\370\37\142\172\213\35\164\11\373\7\115\325\14\167\74\200\236\24\252\360\300\343\161\361\305\255\40\347"
+  "\116\232\213\207\140\346\271\367\234\370\66\15\27\217\135\74\341\164\342\212\144\65\53\301\236\271\74\316\234\25\54\146"
+  "\343\256\312\143\276\146\345\337\316\202\112\70\312\47\137\216\362\77\200\242\121\15\120\64\346\201\215\334\136\42\366\163"
+  "\236\363\46\312\77\271\320\360\157\250\166\16\104\376\224\366\116\160\205\267\341\207\166\347\50\373\224\236\40\51\377\327"
+  "\202\303\116\11\230\273\30\163\260\142\60\74\320\375\327\277\211\356\147\100\127\323\340\37\322\325\200\256\166\161\272\374"
+  "\135\226\221\333\112\272\13\50\207\271\213\361\253\300\342\21\31\230\263\176\56\215\237\56\16\60\371\227\24\150\312\363"
+  "\350\31\347\215\235\144\30\175\102\234\160\136\0\211\172\344\273\346\166\5\102\222\142\174\147\305\362\325\13\124\271\113"
+  "\141\27\160\212\272\173\250\272\0\227\26\265\135\141\371\333\222\251\205\7\22\243\273\24\145\106\33\275\32\277\134\203"
+  "\14\170\211\45\3\6\344\166\261\53\200\176\271\254\207\212\326\63\4\113\273\302\335\175\1\176\123\65\74\33\200\156"
+  "\361\350\122\166\40\115\364\71\150\104\345\265\53\174\50\50\337\344\55\27\50\374\23\144\57\320\134\301\141\47\151\247"
+  "\377\220\247\101\374\120\366\145\170\100\144\144\73\355\54\236\117\175\114\100\6\130\177\227\120\376\25\327\245\135\310\161"
+  "\256\314\252\357\2\264\53\362\262\262\304\146\152\241\102\204\256\42\250\250\105\240\225\305\122\73\206\246\314\257\321\330"
+  "\42\305\242\232\224\344\303\252\226\305\210\42\304\37\322\277\166\14\105\340\307\232\370\224\241\250\313\51\313\347\337\240"
+  "\201\262\260\175\71\154\125\77\46\146\30\126\312\154\345\154\271\231\227\343\123\132\67\341\275\222\337\214\3\205\42\124"
+  "\216\321\277\223\214\77\43\111\174\214\104\262\313\141\106\227\73\313\204\226\373\250\7\30\347\274\343\212\264\130\221\332"
+  "\22\112\132\242\130\274\15\164\4\243\56\122\370\346\156\41\72\371\117\25\351\157\125\332\122\305\160\270\273\25\341\164"
+  "\373\204\223\55\125\324\273\25\341\152\230\125\162\113\212\57\347\40\152\233\53\271\151\140\236\111\334\315\35\200\173\265"
+  "\173\37\225\231\156\157\237\260\34\27\71\260\307\335\42\23\202\321\320\137\104\342\215\124\340\251\233\177\307\326\13\13"
+  "\264\236\102\61\137\54\373\51\107\176\346\161\42\364\134\252\360\367\143\47\60\32\335\143\10\176\13\12\275\124\72\17"
+  "\112\215\322\47\45\207\1\362\141\50\51\71\70\6\110\316\335\44\105\164\236\304\365\10\13\163\321\61\216\54\126\120"
+  "\311\26\361\123\255\304\205\341\62\336\215\160\41\344\142\305\42\45\115\112\51\6\20\36\5\323\114\212\155\27\212\264"
+  "\312\230\337\115\6\376\57";
+
+/* lib/string.wbo (DEFLATEd, org. size 3696) */
+static unsigned char file_l_60[1633] =
+  "\265\127\335\167\23\105\24\237\331\315\7\155\250\135\233\17\332\244\204\273\333\264\115\333\244\320\226\26\1\245\40\42"
+  "\130\5\52\122\205\47\116\233\54\264\66\37\153\66\265\304\163\330\171\327\67\377\42\372\0\172\104\377\21\352\213\157"
+  "\274\351\275\63\263\351\7\172\100\221\234\234\314\327\235\373\273\367\316\357\336\231\260\355\265\46\277\33\363\333\255\215"
+  "\306\3\263\322\152\233\276\127\210\325\335\172\263\325\301\331\152\155\143\55\126\137\255\325\232\225\250\333\152\65\232\321"
+  "\173\156\335\177\20\255\264\73\236\33\157\67\267\74\317\155\141\133\153\156\273\255\76\324\322\156\156\336\133\157\326\252"
+  "\156\53\132\365\347\346\12\321\265\357\334\126\323\254\372\155\336\210\243\332\112\305\353\230\176\253\302\53\374\33\356\31"
+  "\225\165\163\143\246\140\340\167\126\242\126\326\133\334\67\174\117\366\353\236\341\317\30\376\254\121\231\61\52\263\274\52"
+  "\47\275\16\65\370\75\262\276\332\361\333\253\225\315\130\303\165\253\65\227\327\171\207\77\344\137\363\115\136\63\116\27"
+  "\214\271\202\61\137\40\310\172\363\133\227\366\370\156\233\206\376\366\252\147\324\147\214\372\254\331\256\173\346\306\154\241"
+  "\27\355\256\254\372\56\2\306\144\267\55\233\365\226\154\274\216\154\352\136\234\32\337\153\320\260\272\45\105\153\156\303"
+  "\360\375\4\366\32\132\101\134\365\333\252\15\307\136\107\266\270\313\360\153\262\213\73\61\256\17\261\241\241\267\326\332"
+  "\244\226\100\243\367\233\133\215\52\151\327\130\370\225\215\53\225\341\61\171\321\252\133\333\250\163\367\210\16\170\53\246"
+  "\102\36\123\143\163\315\53\230\367\275\202\64\270\131\223\200\17\357\267\352\221\252\353\267\151\17\236\144\263\305\131\334"
+  "\64\114\56\270\21\141\14\173\114\104\242\61\34\12\63\176\4\373\75\275\324\217\364\44\250\31\61\371\121\306\5\63"
+  "\170\37\143\274\237\57\156\65\66\33\315\355\6\110\115\214\105\370\73\334\20\202\305\203\176\21\130\2\372\167\30\3"
+  "\353\207\27\146\177\204\277\313\43\2\77\134\314\322\342\200\10\222\44\22\244\104\220\26\101\106\4\307\120\334\116\301"
+  "\200\235\66\6\315\41\260\300\332\141\174\227\331\126\344\42\244\40\205\203\347\314\116\71\307\40\15\151\65\110\227\30"
+  "\173\314\235\314\71\4\311\74\346\220\174\314\237\62\222\356\117\260\243\103\11\226\30\112\14\242\1\210\235\345\246\204"
+  "\36\11\162\41\356\260\200\234\75\374\62\324\60\52\355\152\32\106\115\60\14\303\12\157\70\173\120\353\161\255\265\34"
+  "\344\105\160\102\152\5\21\330\42\160\4\344\155\200\23\266\215\202\266\363\62\10\176\224\112\100\264\35\366\47\377\203"
+  "\201\15\266\232\263\273\163\273\314\161\372\6\103\120\160\20\163\104\143\366\350\40\122\220\141\0\254\357\137\230\320\217"
+  "\353\205\60\312\77\362\140\124\232\64\46\202\161\21\24\105\60\41\202\111\21\114\211\240\44\140\324\56\302\230\75\1"
+  "\343\140\75\143\21\201\300\121\30\177\302\22\141\337\222\375\213\344\147\2\215\341\60\376\23\305\143\242\214\301\231\50"
+  "\163\366\124\56\32\366\24\256\331\245\50\375\116\321\270\104\322\314\236\224\56\117\242\323\343\273\354\67\265\223\63\50"
+  "\302\244\164\361\71\103\75\122\341\44\114\241\307\223\121\230\300\335\317\245\304\163\246\272\343\330\354\62\213\37\177\202"
+  "\106\51\144\271\212\235\247\14\21\245\201\152\212\116\151\22\112\244\151\357\344\243\106\331\234\66\116\102\121\331\314\244"
+  "\315\120\44\331\42\24\125\250\213\331\304\111\175\56\216\325\67\235\230\116\224\245\3\30\310\123\257\10\364\314\376\365"
+  "\244\136\117\112\262\313\365\131\271\316\146\202\71\21\234\226\7\221\226\144\237\47\246\7\13\2\346\354\64\234\266\123"
+  "\57\223\203\150\155\317\103\32\251\236\302\56\261\73\345\54\300\74\165\366\270\237\335\227\24\135\136\42\356\31\112\100"
+  "\112\62\305\111\105\310\314\337\162\22\167\37\340\142\71\344\235\223\261\172\22\373\10\211\13\70\101\154\324\364\310\50"
+  "\71\42\311\41\176\276\247\340\173\125\324\144\1\260\370\131\30\260\370\271\254\214\313\131\45\160\134\145\242\364\76\247"
+  "\123\116\62\202\6\117\272\324\203\34\344\224\21\271\256\223\220\103\65\347\225\232\123\157\346\346\101\37\137\313\301\163"
+  "\12\170\114\323\42\45\121\323\7\312\327\220\71\150\114\277\272\146\45\246\251\152\355\120\46\364\15\46\6\23\103\62"
+  "\76\357\53\375\363\332\61\31\45\164\51\47\43\225\307\335\221\213\106\31\375\113\232\323\220\224\261\352\53\43\313\363"
+  "\62\206\45\142\171\137\31\111\235\204\244\2\114\146\217\112\136\313\305\276\101\310\103\136\55\344\367\2\232\207\334\56"
+  "\161\376\3\116\105\76\105\240\45\31\312\234\305\57\110\151\247\144\105\143\216\263\243\323\326\301\163\51\141\46\340\1"
+  "\121\114\56\310\175\307\150\337\42\225\325\105\151\354\242\64\26\26\141\121\1\56\356\1\56\152\300\213\72\211\316\34"
+  "\256\240\231\177\125\104\17\20\267\367\60\161\173\137\353\134\57\151\123\26\272\371\276\377\152\242\204\325\134\176\243\73"
+  "\212\230\215\307\274\127\245\50\265\167\124\222\323\351\177\250\255\230\377\337\2\362\37\50\176\131\33\61\273\27\212\114"
+  "\30\215\303\267\64\302\356\331\220\175\335\40\354\3\114\205\117\4\351\377\107\212\375\5\242\22\302\136\321\104\44\130"
+  "\342\242\163\205\320\340\312\63\226\333\117\313\175\365\42\144\46\166\54\134\77\246\143\113\156\175\254\164\217\222\356\253"
+  "\7\230\172\25\245\350\32\224\224\355\136\55\373\210\13\127\111\206\174\274\372\62\211\257\51\275\227\364\221\141\272\142"
+  "\166\312\204\334\263\353\155\146\157\122\276\27\364\225\214\53\30\205\74\232\365\211\62\353\204\176\362\54\11\132\134\352"
+  "\26\134\135\152\273\117\235\234\275\364\17\345\166\11\225\175\252\224\235\171\53\125\111\32\377\212\322\364\131\170\257\214"
+  "\322\213\6\106\141\24\351\0\143\60\206\215\305\13\50\161\235\151\352\334\20\301\115\151\342\162\230\271\67\212\314\160"
+  "\162\7\156\225\233\26\277\346\54\207\365\154\31\226\25\362\162\310\30\24\272\201\227\356\362\2\63\344\175\363\271\316"
+  "\11\311\114\124\177\113\161\62\124\160\13\351\236\103\131\74\151\125\375\157\21\302\165\73\207\105\136\13\11\175\265\51"
+  "\176\351\212\117\252\277\10\157\154\245\371\266\10\126\264\341\43\206\351\334\336\141\26\146\355\202\263\102\20\43\374\250"
+  "\326\107\150\32\153\5\156\302\102\301\60\137\7\160\5\103\121\40\45\160\33\167\40\372\227\12\75\246\116\26\343\175"
+  "\302\342\347\161\376\53\355\160\42\270\23\276\177\356\320\373\307\342\227\263\164\235\137\100\231\273\262\356\147\202\270\200"
+  "\70\202\374\34\276\36\161\360\53\373\105\146\321\43\374\247\200\21\177\204\377\45\150\72\362\73\76\376\320\204\376\277"
+  "\0";
+
+/* lib/time.wbo (DEFLATEd, org. size 9169) */
+static unsigned char file_l_61[4329] =
+  "\235\130\175\164\34\325\165\177\167\146\127\132\153\145\173\241\116\142\204\200\331\145\125\114\0\107\332\225\145\331\230\304"
+  "\56\301\115\151\14\44\30\144\311\156\205\274\132\111\153\153\265\362\356\312\137\150\147\154\50\206\6\14\246\241\115\332"
+  "\6\32\160\300\44\121\2\44\41\204\20\222\310\211\214\361\27\6\143\276\77\333\376\321\43\333\207\344\364\44\115\317"
+  "\11\161\177\367\276\231\335\321\132\234\223\306\160\337\334\357\167\357\175\367\175\254\324\246\265\71\172\237\2\305\114\66"
+  "\155\246\362\105\263\60\34\257\311\246\263\271\374\226\217\157\352\51\144\272\13\103\75\303\205\201\134\261\173\70\237\336"
+  "\230\111\157\152\231\231\32\314\245\326\167\347\323\205\356\376\164\161\226\246\330\234\311\232\102\261\167\60\263\266\6\150"
+  "\172\150\43\250\174\146\250\237\77\251\341\55\265\370\14\341\53\144\166\230\77\203\351\241\140\72\237\37\312\5\141\227"
+  "\311\205\12\103\303\60\50\366\205\330\337\326\334\120\172\146\157\317\226\102\167\146\250\73\233\33\52\16\204\60\166\63"
+  "\147\306\46\214\335\103\75\331\164\240\267\220\214\143\150\345\141\1\17\155\74\54\344\241\235\207\105\361\131\242\334\67"
+  "\62\70\50\26\301\336\102\113\113\234\307\204\214\111\31\133\145\134\40\143\233\214\13\343\62\235\147\262\210\231\211\146"
+  "\31\305\74\41\346\11\61\117\210\171\102\314\23\142\236\130\50\143\273\214\142\233\154\216\317\144\207\376\100\222\342\43"
+  "\51\76\222\342\43\51\76\222\342\43\51\76\222\342\43\51\76\132\145\376\126\231\277\125\154\133\223\361\160\117\41\45"
+  "\365\137\73\322\127\327\237\365\320\332\356\342\126\236\246\6\337\215\75\203\374\51\140\201\360\311\365\211\260\267\157\260"
+  "\130\243\165\302\251\236\324\100\272\127\152\133\301\213\34\142\233\204\322\46\241\54\224\351\333\365\50\101\264\113\20\355"
+  "\222\100\273\44\320\56\11\264\213\125\373\302\270\61\134\344\25\316\345\315\265\303\161\263\17\220\151\1\44\0\111\100"
+  "\53\0\6\322\104\241\336\114\137\37\107\157\24\133\214\142\263\333\147\350\44\335\233\203\353\215\142\241\276\314\104\377"
+  "\325\111\163\24\163\335\305\154\200\121\163\270\230\15\156\111\367\344\13\265\371\164\226\71\41\174\205\61\143\103\252\73"
+  "\265\45\65\230\56\204\312\310\6\27\251\221\336\52\4\270\115\2\133\170\30\114\367\14\33\211\270\321\22\67\222\361"
+  "\272\102\72\345\316\102\305\32\135\234\0\363\170\22\376\232\231\66\144\261\20\320\16\130\24\17\271\153\220\362\220\174"
+  "\30\361\242\340\262\352\146\41\237\12\364\246\13\305\140\161\53\332\177\246\53\302\232\140\165\314\354\310\40\145\202\262"
+  "\122\101\275\154\331\365\272\44\331\232\242\144\22\54\162\142\101\16\261\120\73\122\114\165\17\40\73\246\272\131\34\340"
+  "\301\104\102\63\274\246\100\341\107\372\302\250\132\317\240\216\312\207\347\153\135\235\32\35\151\255\153\64\243\254\22\24"
+  "\72\304\101\156\112\247\261\2\303\365\205\142\117\276\310\373\221\53\305\314\20\66\262\254\33\25\2\205\154\317\146\263"
+  "\57\133\304\122\344\203\251\334\310\120\261\246\247\267\27\12\374\101\272\65\3\271\221\174\113\302\4\32\310\264\64\307"
+  "\61\264\360\220\340\41\311\103\53\17\13\170\150\343\141\41\17\355\74\54\302\220\140\213\4\133\44\330\42\301\26\11"
+  "\266\110\260\105\202\55\22\154\221\140\213\4\133\44\331\42\311\26\111\266\110\262\105\222\55\222\154\221\144\213\44\133"
+  "\44\331\42\311\26\255\154\321\312\26\330\141\6\32\24\36\115\270\66\61\207\231\140\32\215\213\351\115\304\141\42\40"
+  "\23\221\231\10\321\104\254\46\202\66\21\275\211\64\114\344\143\42\61\23\31\232\110\325\130\24\67\332\343\6\266\104"
+  "\133\334\130\20\47\125\157\32\46\71\144\4\224\2\246\234\100\260\306\160\34\302\267\326\164\154\106\102\63\210\77\165"
+  "\141\315\257\253\67\35\215\314\164\31\263\130\156\316\236\15\343\310\131\1\107\244\235\46\235\115\340\217\53\145\320\237"
+  "\51\12\64\323\5\112\251\363\1\376\357\107\361\316\3\300\160\116\331\360\162\100\27\140\63\340\53\200\47\1\57\3"
+  "\376\33\160\26\51\325\14\270\6\220\45\61\374\30\14\33\325\254\22\175\134\215\252\22\175\102\215\6\112\64\127\215"
+  "\206\112\164\216\32\255\57\121\203\32\215\224\350\134\65\72\247\104\215\152\164\256\1\115\330\320\365\43\103\154\377\11"
+  "\41\126\344\204\230\53\304\312\221\64\23\347\10\321\221\356\145\242\101\113\6\106\230\70\127\210\345\371\14\23\215\332"
+  "\133\117\221\211\363\274\150\316\227\150\56\220\150\54\211\46\52\321\304\44\232\13\45\232\270\104\203\142\120\55\107\203"
+  "\376\146\27\27\10\275\42\347\321\26\350\20\307\124\160\31\121\60\352\70\256\241\62\53\6\326\14\216\56\357\161\56"
+  "\24\57\10\321\245\343\242\201\50\107\362\56\247\211\53\256\346\226\350\317\45\324\213\44\324\171\22\352\305\22\352\47"
+  "\45\324\113\44\324\113\21\152\211\56\123\243\215\45\232\257\106\255\22\175\112\215\306\113\324\254\106\347\225\250\105\215"
+  "\136\152\300\17\27\342\352\36\251\344\105\272\104\351\265\114\314\323\65\356\311\63\161\261\20\313\206\205\370\244\53\221"
+  "\210\56\321\16\364\272\134\352\22\203\114\134\246\155\106\372\231\230\257\13\236\36\146\342\123\102\134\233\222\352\67\13"
+  "\161\115\156\43\23\55\102\174\66\235\142\42\341\45\233\224\144\133\45\331\5\222\154\233\44\273\120\222\155\227\144\27"
+  "\111\262\213\45\331\313\45\331\45\222\354\25\222\354\247\45\331\244\254\12\222\35\351\311\113\360\255\122\140\44\234\367"
+  "\70\13\300\251\341\254\123\3\114\266\11\211\274\63\222\322\102\177\346\355\40\202\234\271\64\336\42\227\32\24\331\142"
+  "\131\111\344\76\122\220\44\57\327\53\231\36\116\147\327\246\245\210\113\44\26\324\40\347\62\256\20\25\324\241\254\362"
+  "\151\341\240\30\145\316\147\24\161\123\33\264\24\161\304\31\131\6\316\266\0\143\177\301\230\301\330\225\20\12\353\263"
+  "\36\162\25\144\1\262\54\213\211\345\300\103\12\245\274\112\312\212\61\140\320\137\42\232\20\157\116\376\267\15\132\237"
+  "\363\146\370\53\104\141\322\312\56\306\257\6\116\214\374\65\220\106\152\52\130\115\205\246\144\257\325\64\77\321\273\270"
+  "\74\130\115\275\165\254\364\171\50\161\314\100\127\124\320\153\200\316\246\246\36\253\151\55\24\255\246\315\126\123\47\363"
+  "\257\225\171\226\255\140\374\72\301\257\23\374\13\122\205\246\336\371\115\331\371\132\363\213\232\363\271\305\115\53\26\67"
+  "\135\317\234\353\305\175\223\122\1\42\76\326\354\305\366\112\307\276\301\261\157\164\354\16\307\136\345\330\235\216\335\345"
+  "\330\253\35\173\215\163\241\141\306\156\34\127\221\23\52\266\46\326\21\133\205\63\160\14\53\153\342\273\127\155\273\357"
+  "\304\133\246\325\141\255\211\33\146\44\130\33\273\141\134\235\76\155\376\132\115\250\300\122\253\43\326\151\165\136\254\114"
+  "\127\155\33\133\5\301\355\332\253\34\240\141\145\255\204\223\347\130\165\145\154\265\325\1\125\315\146\314\272\21\56\147"
+  "\7\350\157\110\221\335\124\25\234\57\246\316\251\61\31\173\25\41\236\316\252\170\334\171\60\261\366\133\65\311\337\222"
+  "\141\333\64\132\153\167\333\366\115\266\325\155\335\364\241\172\232\40\350\41\271\25\76\143\257\165\354\324\364\45\362\305"
+  "\262\332\37\213\265\126\207\262\172\372\120\54\217\216\317\236\75\356\13\53\205\242\161\150\343\272\150\143\44\145\263\122"
+  "\343\52\64\251\142\135\123\145\267\320\36\354\71\3\56\275\114\172\165\300\127\376\111\1\227\243\255\371\243\243\365\344"
+  "\177\112\330\141\345\13\74\255\14\276\237\167\32\166\237\155\367\73\366\200\155\147\34\173\235\143\257\167\354\101\307\316"
+  "\72\366\220\143\347\34\173\330\261\67\124\267\350\270\202\123\253\357\367\360\127\73\106\333\341\75\226\203\353\375\34\30"
+  "\220\332\111\25\315\41\330\276\161\365\304\157\102\143\164\132\355\241\350\372\62\51\372\31\117\77\43\134\130\144\254\365"
+  "\343\212\116\250\350\172\230\202\73\166\277\161\112\305\6\307\125\140\37\353\15\152\341\40\13\231\200\370\244\102\111\241"
+  "\371\144\30\212\331\161\165\216\50\146\265\142\126\24\263\54\365\364\116\261\303\165\236\303\165\132\157\235\350\255\143\51"
+  "\353\41\214\165\330\114\216\225\15\40\115\12\132\203\23\52\254\202\210\66\254\242\33\70\256\13\46\221\166\343\244\262"
+  "\66\240\320\303\154\307\330\21\166\131\246\340\147\30\176\171\56\53\173\122\261\305\177\52\153\220\261\61\332\253\166\231"
+  "\326\372\61\372\203\372\275\212\16\30\171\370\216\16\231\205\22\36\72\326\20\54\130\153\236\62\254\314\41\154\353\231"
+  "\171\243\150\145\252\145\34\147\270\150\15\61\217\120\273\241\206\372\102\270\20\316\63\135\47\241\0\251\207\326\220\65"
+  "\0\215\61\342\231\20\320\0\307\301\24\167\327\351\323\130\274\343\312\315\323\47\332\206\177\233\307\350\30\122\16\54"
+  "\105\367\161\343\365\217\253\71\310\167\225\65\260\207\130\163\122\241\241\230\33\1\267\223\247\63\312\254\172\351\300\214"
+  "\204\346\262\346\202\265\332\312\271\24\252\27\133\143\15\353\235\204\136\34\121\246\315\273\350\253\144\157\224\146\334\344"
+  "\160\127\156\266\355\55\325\255\147\157\165\354\233\35\173\324\261\113\216\265\161\257\304\272\355\361\307\156\167\216\171\211"
+  "\60\363\267\277\371\325\351\27\216\376\116\35\367\247\300\202\147\176\75\141\176\250\142\233\221\344\356\40\167\146\264\317"
+  "\362\10\351\313\55\136\137\156\21\56\152\273\205\33\27\45\374\20\272\360\262\151\102\115\350\343\266\317\352\217\120\332"
+  "\325\327\163\4\255\276\22\356\52\354\275\227\104\243\204\173\252\132\207\25\120\307\76\175\364\272\165\355\144\315\171\163"
+  "\14\137\121\273\204\25\61\174\105\135\55\254\172\303\127\324\65\302\232\153\370\52\273\125\130\215\206\354\170\146\362\211"
+  "\160\63\47\264\253\361\224\267\40\1\360\106\231\267\344\24\126\174\311\7\232\37\53\11\113\50\275\64\266\273\64\15"
+  "\225\225\131\205\302\133\375\272\20\21\32\51\47\167\205\234\125\312\355\26\213\273\5\244\370\205\43\107\37\224\41\276"
+  "\371\372\35\153\45\337\6\120\203\7\33\322\155\244\104\234\261\267\223\143\337\2\270\225\334\245\347\355\161\53\131\333"
+  "\371\365\66\256\26\363\351\147\24\314\274\307\340\343\320\361\210\113\237\163\267\152\205\165\311\231\254\313\316\144\65\37"
+  "\361\21\213\16\271\362\211\212\336\255\350\372\323\264\337\143\54\265\156\41\374\257\167\337\55\204\365\334\316\41\152\132"
+  "\334\340\211\45\106\314\270\225\352\363\141\25\316\143\213\152\246\332\247\135\360\363\46\122\27\156\10\2\217\165\216\213"
+  "\25\124\266\363\125\370\167\156\111\176\113\122\23\334\54\267\341\263\203\174\327\313\32\331\24\135\123\66\5\156\33\271"
+  "\153\242\35\345\12\361\144\45\274\266\312\353\161\203\314\5\214\137\7\153\254\16\335\16\253\31\221\333\303\125\353\302"
+  "\111\303\337\325\372\213\134\242\267\225\27\342\262\175\272\243\65\313\113\74\130\56\273\144\130\21\40\175\245\217\272\35"
+  "\144\26\254\35\20\230\373\275\363\315\37\50\253\334\126\361\63\375\302\360\143\107\174\310\201\30\333\172\106\365\141\170"
+  "\102\162\370\377\270\271\31\207\247\237\201\264\117\252\63\134\117\376\321\316\165\52\234\71\377\147\335\346\55\174\175\276"
+  "\234\336\342\252\62\5\245\121\24\316\366\35\56\157\7\271\107\173\307\274\0\226\340\362\3\336\71\327\61\57\244\151"
+  "\377\124\262\314\243\230\312\25\57\21\63\175\3\355\152\4\241\204\70\351\266\101\311\13\112\237\25\322\167\267\363\23"
+  "\72\155\337\101\323\77\117\321\153\276\7\315\326\150\107\11\117\160\153\53\77\143\102\63\142\167\120\271\337\256\126\321"
+  "\73\44\242\53\271\220\23\156\330\45\374\20\260\356\240\110\335\114\331\272\141\121\275\222\17\104\146\316\342\115\166\230"
+  "\243\161\315\130\352\32\204\33\302\214\224\360\233\42\202\363\2\123\131\35\21\354\222\50\43\256\352\162\71\111\257\322"
+  "\16\226\53\335\327\135\56\47\350\132\343\140\307\135\305\76\242\314\130\56\347\352\262\251\66\153\52\212\122\32\135\131"
+  "\314\22\247\263\275\27\324\337\353\267\374\263\144\177\11\265\272\23\160\27\140\47\340\156\300\75\200\135\200\173\1\70"
+  "\72\161\150\176\211\160\300\107\167\21\43\21\43\172\57\105\120\153\13\364\275\50\132\375\51\54\113\324\43\76\120\61"
+  "\376\352\233\110\70\20\336\313\312\372\321\262\13\205\25\342\344\54\136\331\300\7\172\367\104\357\321\52\373\370\301\163"
+  "\47\311\235\14\351\51\25\335\111\326\235\145\207\42\71\121\221\334\103\150\137\236\205\16\124\66\306\116\267\377\166\22"
+  "\137\153\325\316\312\46\274\330\272\37\305\301\276\362\143\311\163\161\102\273\100\274\242\316\355\133\242\71\232\42\11\302"
+  "\335\152\332\54\166\227\324\247\336\20\351\244\320\74\71\277\316\340\160\222\253\244\125\102\106\364\156\262\356\302\315\354"
+  "\336\337\177\120\326\335\102\355\152\324\217\53\326\12\30\314\131\122\141\50\203\37\71\27\322\331\374\211\155\24\344\103"
+  "\226\310\135\64\365\66\333\253\37\16\54\363\137\147\33\261\370\377\100\372\76\133\306\227\342\227\345\256\262\276\14\275"
+  "\206\22\176\174\312\31\274\15\361\307\126\241\125\54\330\325\262\335\252\22\175\14\167\43\156\353\112\326\155\21\341\67"
+  "\61\77\342\347\133\340\203\207\313\276\131\143\41\243\155\251\306\2\106\333\165\32\203\336\115\6\373\77\71\13\324\34"
+  "\356\326\141\241\361\200\210\104\316\142\154\33\152\206\40\32\20\35\302\276\217\334\373\174\116\371\76\257\154\320\245\334"
+  "\220\374\120\162\173\135\12\123\276\350\371\232\376\107\372\310\133\374\76\166\377\117\256\374\174\226\163\125\372\53\207\210"
+  "\173\152\64\163\125\160\71\255\304\111\313\325\211\300\151\254\337\273\307\373\21\146\4\305\325\315\340\355\264\257\310\116"
+  "\163\152\341\125\246\54\321\122\64\16\351\230\276\252\205\101\216\247\277\204\37\361\154\17\376\77\177\224\221\104\372\57"
+  "\132\172\226\57\21\237\102\254\177\102\37\252\362\230\361\71\375\127\367\122\276\310\376\32\262\273\37\360\0\71\326\327"
+  "\10\317\55\375\273\347\1\262\356\47\364\76\130\274\314\372\242\177\0\215\121\163\202\205\101\340\236\14\375\41\74\336"
+  "\137\36\327\145\210\105\355\51\176\200\375\33\221\373\107\321\247\152\354\257\143\302\7\1\17\1\70\200\335\200\157\0"
+  "\36\6\74\242\203\261\367\0\36\375\350\303\273\374\120\260\277\11\245\157\1\276\15\30\3\174\7\360\135\300\143\200"
+  "\307\1\117\0\276\7\370\76\340\7\200\47\1\77\4\74\5\370\21\340\151\300\217\1\317\0\176\2\170\26\360\123"
+  "\300\317\0\77\7\214\3\366\2\176\1\370\45\140\2\260\17\360\34\140\77\340\171\362\172\342\50\237\127\317\23\272"
+  "\342\353\24\335\315\73\61\372\15\262\236\47\151\217\333\311\310\233\5\274\22\36\322\127\146\223\367\112\170\230\370\371"
+  "\361\10\31\7\310\70\110\306\41\62\16\223\161\204\214\27\310\70\112\306\213\144\274\104\306\61\62\136\46\343\70\31"
+  "\257\220\361\52\31\257\221\361\72\31\157\220\361\46\31\157\221\361\66\31\357\220\361\56\31\357\221\361\76\141\2\71"
+  "\362\142\62\121\24\173\247\311\132\265\117\315\74\4\66\16\0\106\337\3\272\127\243\357\0\335\257\321\67\201\76\257"
+  "\321\67\200\36\326\350\253\100\217\151\364\70\320\343\32\175\31\350\253\32\75\6\364\65\215\276\10\364\165\215\36\1"
+  "\372\206\106\17\3\175\137\243\357\3\375\167\215\276\13\364\77\64\372\266\374\24\23\364\55\240\223\32\175\235\217\113"
+  "\215\276\6\364\127\32\175\5\350\377\150\364\45\240\277\323\350\121\240\377\253\321\27\250\376\40\205\171\42\23\105\15"
+  "\277\127\356\123\76\20\365\21\357\62\152\16\270\367\366\347\53\213\200\213\375\74\345\51\170\207\30\244\141\125\177\200"
+  "\302\357\172\136\337\21\257\221\152\257\314\10\173\136\127\114\361\232\120\236\302\31\136\337\46\176\261\36\305\325\174\15"
+  "\53\105\260\127\32\230\377\26\361\237\302\160\324\260\45\337\44\165\174\271\362\203\274\103\57\160\227\137\366\101\105\146"
+  "\360\53\130\277\302\331\317\233\354\147\215\253\33\232\306\317\126\277\254\312\317\315\25\77\157\220\247\304\27\373\36\52"
+  "\277\164\353\243\173\170\263\167\304\106\331\21\13\252\147\50\225\5\125\356\277\111\25\377\257\163\234\337\42\67\30\76"
+  "\211\110\377\305\241\312\331\267\247\121\341\227\203\177\122\366\75\166\206\236\177\166\23\32\337\361\315\376\32\317\376\135"
+  "\317\44\122\66\251\232\374\261\63\65\252\122\172\334\347\364\125\166\372\204\147\22\230\246\366\337\233\42\254\162\365\175"
+  "\237\253\127\312\325\227\307\207\107\314\254\374\226\53\321\265\334\162\150\266\353\124\271\271\216\163\4\77\360\46\121\323"
+  "\104\360\344\24\141\125\4\77\364\105\360\62\205\217\161\20\343\174\174\221\167\216\35\107\23\234\33\301\215\302\167\106"
+  "\107\354\51\361\366\300\64\75\360\243\212\244\152\222\247\175\223\274\304\116\176\354\205\64\167\232\170\237\231\42\254\162"
+  "\365\23\237\253\27\313\373\352\13\123\366\325\321\62\377\213\123\370\57\360\324\317\172\336\347\30\323\365\25\7\360\323"
+  "\151\124\252\302\370\231\57\214\43\354\366\347\176\33\375\332\375\257\332\52\277\343\323\351\174\120\275\3\330\375\336\63"
+  "\65\317\14\225\33\374\27\147\52\372\103\345\237\10\277\364\205\172\130\176\107\260\276\245\373\154\312\151\305\32\207\240"
+  "\161\275\162\211\203\234\331\4\354\233\174\131\354\163\73\303\27\356\163\276\51\16\220\365\160\371\57\7\35\322\246\140"
+  "\224\377\4\262\324\172\304\175\337\73\140\343\227\124\20\214\260\212\76\112\26\256\322\107\61\201\365\40\35\144\275\7"
+  "\231\163\202\45\360\260\233\275\102\34\251\253\157\140\202\25\161\3\173\66\270\206\241\344\336\213\321\207\160\130\103\360"
+  "\40\176\241\301\17\264\166\273\202\335\24\333\137\211\176\212\205\374\226\145\322\231\124\136\260\63\365\17\132\161\165\320"
+  "\275\314\145\42\160\344\305\367\177";
+
+/* lib/unistd.wbo (DEFLATEd, org. size 4557) */
+static unsigned char file_l_62[1679] =
+  "\305\127\133\123\24\107\24\356\236\333\356\12\310\340\25\201\204\336\141\1\121\61\42\106\203\10\242\300\22\215\42\121"
+  "\41\32\223\254\303\356\54\114\261\314\156\315\14\40\126\322\155\225\171\312\157\361\107\200\17\230\104\53\125\61\177\40"
+  "\317\370\144\52\345\253\71\335\63\263\13\50\144\253\102\22\255\235\76\247\373\234\257\317\345\353\236\1\55\115\27\361"
+  "\175\155\301\261\75\77\47\147\135\137\366\112\51\155\336\232\57\272\313\211\131\313\54\145\246\115\317\72\264\144\172\166"
+  "\306\163\314\222\67\133\364\63\45\327\132\264\255\245\236\130\76\227\161\55\63\27\207\161\311\265\175\213\13\331\102\321"
+  "\263\152\100\310\231\276\351\55\73\331\72\220\363\71\317\67\375\314\214\345\37\340\232\135\260\204\356\131\360\263\37\12"
+  "\277\22\107\112\160\101\100\161\154\317\262\346\304\10\50\15\45\323\237\255\170\2\122\102\314\24\154\147\256\116\110\334"
+  "\237\153\7\103\155\276\270\150\145\162\266\153\145\175\110\246\126\314\172\313\363\334\104\27\312\202\303\145\201\231\50\271"
+  "\305\154\306\172\140\373\232\347\273\266\63\303\207\202\345\250\226\353\72\105\65\237\165\374\102\155\336\166\170\276\5\356"
+  "\254\145\27\334\151\167\116\341\233\112\371\234\74\275\220\127\235\351\145\337\222\301\103\236\56\245\344\74\374\354\36\370"
+  "\235\206\137\157\112\25\131\251\334\176\121\266\213\213\32\374\0\125\23\323\213\252\310\136\53\346\363\120\22\55\250\200"
+  "\132\340\371\153\113\263\226\223\265\22\171\337\135\160\262\246\157\151\20\326\214\77\53\171\17\125\121\152\315\366\114\337"
+  "\137\306\256\342\101\100\262\355\144\245\331\151\331\162\162\252\271\150\332\5\305\261\254\234\2\355\264\344\142\41\207\113"
+  "\211\274\231\315\132\36\370\50\74\17\325\234\57\346\54\315\364\363\5\163\246\266\120\54\316\55\224\62\134\366\170\352"
+  "\105\127\236\267\35\55\360\120\241\226\371\134\74\250\232\351\153\201\240\5\232\12\340\371\134\14\236\2\325\261\226\100"
+  "\203\47\327\24\156\22\207\245\0\0\146\205\220\10\233\141\372\61\177\306\347\206\261\202\63\47\306\160\145\117\324\122"
+  "\60\201\2\13\246\104\123\61\167\36\120\140\143\61\2\157\102\266\251\171\361\214\172\151\372\13\36\106\215\262\44\143"
+  "\206\45\5\41\220\20\223\45\25\61\105\213\51\14\376\141\220\342\145\51\201\305\260\47\30\152\244\140\266\126\142\224"
+  "\217\165\52\230\121\61\265\267\42\326\53\40\10\111\17\334\32\370\132\60\263\57\306\130\131\331\257\125\344\3\162\50"
+  "\34\254\30\37\212\346\16\143\206\224\306\43\34\115\156\152\202\130\233\133\104\44\315\22\376\0\141\5\362\120\360\207"
+  "\70\260\36\244\255\214\22\106\223\214\32\214\266\61\232\142\264\235\321\16\106\73\131\233\44\33\155\253\110\177\205\214"
+  "\116\43\145\264\23\162\26\111\44\265\212\224\165\144\164\220\44\327\132\271\216\371\43\276\216\110\147\112\222\165\55\146"
+  "\30\253\350\355\133\371\65\132\105\350\31\122\206\110\105\177\201\326\220\302\300\132\55\117\326\240\124\123\323\52\142\244"
+  "\15\274\353\153\20\111\35\215\113\201\242\340\243\377\142\234\361\135\214\263\53\214\163\230\307\171\214\321\343\233\342\334"
+  "\20\141\173\62\105\216\303\176\77\12\170\254\162\345\121\374\147\100\127\206\126\121\313\226\55\132\311\61\162\234\244\110"
+  "\373\56\25\26\225\3\76\361\137\4\34\337\305\200\273\61\77\146\160\220\146\53\124\70\111\267\145\303\51\316\6\10"
+  "\375\44\354\374\4\377\366\336\140\167\346\312\311\315\154\251\373\333\134\2\107\175\35\351\132\15\330\254\41\25\236\274"
+  "\114\44\325\325\50\77\105\322\143\54\202\371\125\4\23\17\275\223\6\230\255\241\262\126\3\56\145\350\35\30\367\321"
+  "\377\134\217\275\377\270\36\53\150\127\13\162\12\30\15\127\52\75\303\353\1\225\350\331\211\321\255\220\116\17\140\342"
+  "\327\250\314\326\372\52\330\12\111\274\103\327\47\270\22\117\27\222\243\170\116\143\161\357\33\74\234\136\12\141\101\70"
+  "\244\67\171\206\364\276\333\202\340\350\234\321\265\332\155\143\50\33\302\2\240\177\214\371\375\276\237\203\3\154\253\256"
+  "\45\252\365\74\53\74\317\162\317\163\357\324\207\224\353\23\125\245\306\70\27\1\236\23\110\250\222\155\67\2\114\351"
+  "\131\164\63\244\272\342\320\326\124\330\325\227\341\25\321\277\331\213\123\51\254\320\47\42\222\42\355\143\364\74\243\375"
+  "\214\136\140\164\200\321\101\106\57\62\72\24\122\230\364\201\363\57\234\116\175\225\374\52\134\202\241\111\5\351\73\170"
+  "\267\301\155\41\326\224\241\66\111\25\306\353\140\374\350\321\267\100\243\363\334\0\370\175\36\30\135\203\56\2\23\376"
+  "\104\106\177\350\365\12\45\57\220\76\162\341\71\317\22\306\127\340\246\277\101\311\1\322\277\212\32\336\40\143\220\14"
+  "\374\304\327\6\222\203\220\367\340\12\62\0\201\11\222\303\322\363\12\263\7\126\120\362\42\230\204\313\20\336\251\162"
+  "\371\313\101\46\207\104\60\35\244\203\337\157\175\353\210\237\262\41\50\310\45\34\176\112\374\200\171\173\56\63\72\314"
+  "\350\10\243\243\214\246\31\35\243\133\273\365\73\12\333\65\274\212\36\104\215\17\172\61\2\173\206\63\357\275\251\301"
+  "\50\71\12\155\36\45\227\341\277\150\165\343\21\222\322\265\6\43\275\205\107\351\367\237\275\341\150\135\34\363\25\44"
+  "\316\171\225\316\202\40\311\61\216\241\124\154\307\236\102\263\360\123\176\1\165\353\60\53\257\241\346\357\301\54\330\114"
+  "\332\144\270\202\302\225\61\240\335\204\374\30\223\261\227\42\117\151\363\116\142\257\210\160\237\142\361\41\324\36\126\366"
+  "\312\266\327\303\345\210\376\315\55\306\225\162\53\137\154\55\301\225\340\15\305\53\241\343\113\321\56\127\303\127\153\147"
+  "\330\303\21\336\75\336\220\15\251\266\362\262\103\305\165\355\100\62\255\156\120\17\45\323\0\274\163\25\313\107\371\63"
+  "\161\200\332\370\46\273\224\213\310\344\152\224\311\65\34\175\136\166\323\353\214\216\63\172\203\321\211\12\45\301\32\110"
+  "\64\262\251\67\243\300\254\77\140\32\40\257\3\273\306\311\70\47\326\15\62\101\46\104\202\373\214\52\223\373\74\150"
+  "\326\151\276\55\354\171\223\321\133\333\346\70\276\41\307\233\0\42\160\47\302\367\30\237\274\25\115\336\14\132\166\13"
+  "\6\45\310\366\332\106\252\154\56\213\202\157\207\275\154\246\223\214\267\163\112\364\162\222\114\362\244\132\311\24\231\22"
+  "\111\35\254\66\251\57\202\244\122\34\156\152\247\256\115\125\327\265\311\260\157\72\276\35\205\174\47\272\104\116\204\374"
+  "\203\157\203\273\342\2\331\366\135\270\361\12\40\344\56\277\6\366\127\173\15\154\374\106\373\62\254\126\107\145\333\335"
+  "\72\143\20\226\216\357\104\33\335\13\312\170\70\314\60\315\66\36\250\152\173\361\225\70\75\306\56\236\36\35\337\213"
+  "\42\374\132\200\267\360\0\323\342\375\274\147\333\260\66\175\13\247\267\174\134\224\243\375\146\53\240\136\5\140\313\16"
+  "\200\31\314\377\116\244\367\31\271\257\153\207\353\377\2";
+
+/* lib/wasm_simd128.wbo (DEFLATEd, org. size 4751) */
+static unsigned char file_l_63[2083] =
+  "\235\226\215\133\24\307\35\307\167\166\17\117\171\11\250\47\227\52\36\163\27\121\323\212\5\64\155\323\6\66\117\376"
+  "\221\74\251\162\321\7\21\43\74\217\46\233\354\336\26\214\64\152\37\221\120\123\203\21\317\227\220\3\324\366\152\224"
+  "\310\333\345\42\157\41\106\4\22\223\150\113\300\207\152\65\125\104\71\70\321\353\157\146\357\146\367\16\56\171\236\300"
+  "\363\334\174\146\346\73\57\73\363\235\337\14\267\343\217\45\350\271\344\35\257\224\26\277\134\272\271\170\143\156\336\357"
+  "\204\15\333\313\204\322\155\53\346\25\27\26\227\154\177\335\124\374\112\331\46\141\103\111\251\120\272\171\253\120\270\163"
+  "\233\260\245\344\125\23\260\323\4\205\116\23\224\70\115\120\344\174\212\166\342\374\315\372\235\171\57\103\41\332\311\27"
+  "\155\344\213\66\363\233\66\363\133\112\320\166\124\206\66\240\327\371\222\42\243\16\332\241\42\176\143\21\162\232\66\71"
+  "\113\137\103\245\350\15\264\203\57\313\345\313\362\222\65\5\14\4\303\240\327\170\347\126\176\53\164\366\206\120\132\270"
+  "\305\330\5\10\214\131\20\207\263\353\362\166\256\47\23\341\235\105\150\33\52\64\226\222\141\213\371\55\145\274\263\60"
+  "\131\53\321\206\61\152\364\176\151\226\114\202\113\24\170\1\51\210\67\161\234\51\141\36\172\23\275\151\112\60\153\311"
+  "\174\55\131\240\45\211\350\55\364\226\51\41\111\113\222\265\44\205\44\211\46\364\24\102\22\222\266\312\251\222\234\46"
+  "\311\13\45\171\221\44\57\226\144\213\44\57\221\344\164\111\266\112\362\323\22\116\335\33\24\134\364\257\322\377\42\203"
+  "\276\240\140\250\171\307\337\301\351\364\171\120\270\24\24\34\117\253\157\7\314\27\71\323\213\70\365\150\120\100\151\11"
+  "\363\337\45\215\200\71\140\67\44\251\111\34\355\344\311\256\123\37\115\326\137\174\44\62\120\157\4\314\254\167\127\255"
+  "\237\323\111\35\16\230\35\151\76\156\275\372\327\200\331\276\20\247\305\323\215\100\165\32\116\215\10\2\247\273\367\114"
+  "\210\14\310\10\124\262\210\12\46\247\156\64\114\264\376\345\141\76\3\42\260\57\306\213\360\142\42\163\130\260\205\226"
+  "\54\1\361\370\327\75\247\152\353\357\136\157\123\164\302\244\342\162\117\260\346\340\17\373\274\5\14\350\60\60\143\173"
+  "\72\124\67\266\34\234\366\174\61\124\51\62\300\113\160\172\224\244\372\121\360\254\257\351\214\267\135\321\151\226\250\315"
+  "\63\104\376\107\104\6\321\22\154\141\371\221\160\76\75\172\105\135\221\375\42\4\225\40\123\307\100\152\325\45\123\42"
+  "\3\274\30\133\211\4\57\242\102\262\34\126\274\120\255\15\230\123\115\350\27\324\105\273\20\261\321\122\111\136\46\311"
+  "\31\222\274\134\222\155\222\234\51\311\130\222\355\222\354\240\256\212\62\223\153\176\44\215\266\222\153\52\304\351\324\23"
+  "\307\112\13\14\126\132\140\264\322\27\201\31\357\130\165\375\204\310\100\165\7\314\304\55\357\301\347\55\5\73\54\15"
+  "\133\207\224\317\371\265\164\315\62\360\322\170\276\252\215\157\115\322\162\231\136\171\117\144\200\63\160\6\335\20\342\241"
+  "\345\70\43\336\126\144\220\35\44\133\341\260\141\33\21\73\62\161\46\155\204\241\311\351\361\346\73\375\347\153\307\104"
+  "\6\230\24\37\331\67\132\176\330\67\366\275\310\200\171\301\16\325\25\17\376\335\367\67\357\330\35\221\1\306\330\256"
+  "\113\42\71\52\376\327\356\306\217\173\372\372\107\105\6\164\210\317\216\117\117\67\271\133\276\27\31\260\366\16\250\376"
+  "\346\344\73\107\173\216\37\270\45\62\200\116\35\121\222\352\6\352\325\373\42\203\150\11\316\324\162\100\66\274\34\73"
+  "\140\116\303\132\35\51\305\313\342\36\122\332\334\2\115\54\324\243\31\164\27\54\170\131\334\143\257\11\301\272\317\160"
+  "\274\44\43\351\50\365\356\12\131\316\222\344\225\64\354\145\122\277\332\150\24\134\105\115\274\132\363\156\171\325\207\377"
+  "\173\173\354\340\175\221\301\117\105\252\54\274\342\100\120\40\246\261\257\304\131\77\146\234\54\60\147\130\340\76\333\336"
+  "\75\43\62\210\234\144\70\165\141\301\100\325\336\246\233\371\14\142\4\23\303\373\356\271\377\336\331\377\7\6\6\201"
+  "\225\56\162\46\310\156\67\237\352\277\331\322\334\324\246\350\204\111\305\214\247\375\253\23\37\116\336\317\147\240\257\63"
+  "\124\77\236\351\152\75\333\322\65\132\300\0\366\316\22\45\31\362\357\272\244\376\323\125\323\256\350\64\113\164\162\334"
+  "\137\131\345\376\254\103\144\60\113\322\23\16\160\355\212\116\321\42\154\205\274\65\274\255\221\122\33\224\332\350\247\160"
+  "\134\127\120\270\22\24\354\66\142\342\321\53\77\334\36\170\264\277\200\1\325\14\216\327\75\170\377\172\333\140\253\242"
+  "\123\324\54\232\116\214\127\114\365\34\351\151\123\164\232\65\325\375\15\215\344\103\37\27\60\230\45\11\270\167\175\14"
+  "\41\275\241\135\321\151\226\250\117\373\320\53\42\203\230\17\16\7\204\360\175\144\231\73\334\150\61\143\325\334\341\174"
+  "\25\265\2\236\273\22\323\123\104\45\60\304\60\273\123\126\202\34\41\210\306\64\125\33\241\160\65\116\207\145\136\15"
+  "\313\13\327\43\251\347\171\250\367\161\5\44\276\366\7\5\70\142\317\322\333\301\12\7\14\247\252\127\15\107\245\343"
+  "\135\37\247\23\74\31\142\103\274\331\20\342\315\54\304\373\70\256\21\245\241\147\240\353\137\376\354\256\347\31\272\236"
+  "\147\350\32\105\272\376\25\355\172\43\11\13\153\150\50\200\200\220\55\311\153\15\167\330\371\232\275\56\327\327\57\61"
+  "\350\144\267\130\107\115\205\313\165\365\123\116\247\213\221\133\254\163\62\74\217\43\101\101\110\113\110\256\46\215\200\171"
+  "\340\72\110\150\6\151\31\104\63\234\226\141\367\333\205\301\221\307\336\56\317\65\221\201\332\27\60\377\27\14\276\6"
+  "\302\307\32\72\201\316\351\162\327\360\173\42\3\242\120\173\351\33\206\10\312\325\140\357\205\375\165\247\233\25\235\14"
+  "\22\13\141\32\37\376\163\305\327\73\321\170\250\376\171\6\132\45\124\135\332\175\175\150\164\372\362\167\277\147\240\166"
+  "\103\353\154\46\250\74\340\36\56\77\352\256\170\201\101\214\300\67\340\271\125\175\336\123\223\317\40\106\0\336\37\77"
+  "\66\344\251\51\140\20\43\40\166\55\207\37\221\101\130\220\111\4\40\353\216\310\146\240\266\103\144\100\52\354\331\170"
+  "\215\172\217\274\14\102\134\25\70\344\332\44\240\125\375\152\322\154\137\213\263\361\132\322\5\30\341\327\324\10\225\364"
+  "\202\200\335\317\221\344\334\210\31\362\214\17\232\212\310\75\256\201\156\6\327\314\156\50\240\117\232\60\371\343\230\41"
+  "\305\140\206\24\243\31\122\214\146\110\251\323\355\152\125\277\45\263\176\102\77\140\204\316\234\14\32\12\205\312\247\102"
+  "\241\166\227\242\223\166\154\147\257\330\145\230\111\16\271\61\376\74\70\355\375\300\167\110\144\0\323\264\347\342\265\70"
+  "\227\54\15\364\234\63\367\122\202\147\160\16\316\205\376\351\342\347\340\34\146\237\13\376\216\73\336\163\225\335\371\14"
+  "\264\112\250\72\177\354\364\335\75\347\36\74\154\125\164\12\157\136\104\162\250\267\345\356\261\143\75\201\174\6\61\202"
+  "\57\77\231\276\373\350\243\203\241\126\105\247\30\111\373\100\327\275\211\163\301\312\2\6\61\202\313\327\74\343\173\172"
+  "\33\152\332\24\235\142\44\215\207\275\367\375\103\336\223\5\14\142\4\63\241\320\304\347\260\310\155\212\116\61\22\160"
+  "\360\103\160\360\120\1\3\243\100\363\253\235\230\356\1\244\171\140\277\274\37\73\246\264\351\234\273\251\365\104\366\4"
+  "\172\313\301\331\104\112\373\212\23\23\272\251\307\327\301\53\110\101\322\46\372\10\122\242\36\101\332\13\50\362\366\231"
+  "\330\63\355\75\323\126\45\62\10\207\36\107\26\71\111\170\105\370\34\301\73\47\362\220\71\376\244\334\325\161\103\144"
+  "\300\302\114\370\41\323\61\371\145\271\353\346\223\347\31\304\10\156\175\132\171\270\272\251\262\177\35\3\203\300\312\234"
+  "\66\355\377\107\357\373\355\365\47\233\25\235\264\265\200\312\17\166\273\207\107\47\352\52\136\140\100\127\320\306\4\260"
+  "\41\343\27\6\75\260\365\72\31\45\332\100\360\333\35\363\262\360\351\57\213\113\267\275\155\243\315\255\143\277\145\300"
+  "\272\77\264\367\352\120\203\137\375\356\23\105\47\332\175\72\223\234\30\362\334\32\200\161\363\31\30\5\332\257\43\375"
+  "\47\266\74\176\250\323\356\156\25\12\323\350\217\26\14\364\374\71\370\10\303\125\156\243\362\77\101\15\246\77\364\112"
+  "\267\221\320\250\135\351\353\151\114\264\151\367\156\107\144\340\63\44\362\165\162\72\301\245\27\33\342\22\15\41\56\321"
+  "\30\342\22\215\41\56\321\20\342\270\64\264\16\206\174\356\147\17\231\144\30\62\311\70\144\222\161\310\44\303\220\210"
+  "\14\371\177";
+
+/* lib/include/stdatomic.h (DEFLATEd, org. size 8556) */
+static unsigned char file_l_64[1521] =
+  "\255\130\155\157\333\66\20\376\36\40\377\201\103\277\130\206\363\322\44\10\212\144\31\220\6\175\103\323\172\150\213\355"
+  "\313\0\201\226\116\66\27\231\122\111\52\221\67\354\277\357\50\331\62\145\121\264\144\273\100\320\110\167\367\360\236\173"
+  "\110\352\56\147\103\162\257\222\71\13\44\31\74\274\176\75\42\164\42\130\70\205\320\43\303\263\343\243\343\243\127\251"
+  "\240\323\71\45\11\17\0\237\30\17\342\54\4\362\253\124\41\343\352\164\366\233\166\72\33\222\257\157\157\310\237\367"
+  "\337\277\20\132\300\221\44\5\101\25\113\270\44\124\0\221\360\63\3\256\30\215\343\5\11\360\55\223\12\237\107\104"
+  "\46\144\16\363\104\54\110\42\102\20\307\107\144\210\1\323\154\216\326\62\224\6\1\244\12\102\62\311\24\141\123\236"
+  "\10\10\157\253\145\46\177\103\200\216\363\114\52\62\1\302\251\312\204\136\244\4\212\321\37\43\51\17\211\0\311\60"
+  "\161\306\127\353\15\244\22\131\240\364\343\4\204\104\352\102\320\5\376\77\3\232\222\220\52\352\341\73\131\0\311\200"
+  "\306\124\220\151\234\114\150\134\246\305\270\124\24\213\162\42\123\10\130\204\271\14\220\362\211\232\11\240\130\275\242\26"
+  "\113\377\133\242\146\120\340\370\145\261\311\317\14\123\213\30\10\302\44\341\211\42\62\113\323\104\40\313\33\254\64\226"
+  "\310\50\337\4\342\344\245\254\104\21\74\52\251\225\100\152\221\102\231\117\32\123\344\166\171\161\62\141\152\371\32\162"
+  "\135\71\22\45\202\14\62\57\216\23\76\105\164\64\224\322\152\247\20\42\2\74\233\57\213\342\27\42\220\177\161\211"
+  "\332\33\137\100\114\163\10\107\15\203\326\22\305\152\32\150\360\63\143\302\142\100\50\240\322\36\241\215\115\3\156\36"
+  "\77\220\352\370\350\277\332\373\133\223\4\156\306\145\115\374\111\222\304\267\126\113\60\243\302\156\221\33\246\14\167\150"
+  "\271\165\112\173\346\10\235\241\160\256\320\115\7\43\26\177\165\105\326\315\205\176\113\223\376\335\26\151\372\144\33\116"
+  "\205\255\6\342\104\251\103\155\270\142\146\251\22\276\111\244\170\66\321\66\175\62\213\223\144\377\300\332\243\174\62\314"
+  "\350\36\262\50\132\173\124\57\352\271\134\137\325\122\231\323\274\221\212\351\222\31\76\126\135\242\230\116\13\333\53\64"
+  "\60\16\344\376\307\370\313\247\7\377\355\170\374\350\77\216\37\76\373\357\277\275\173\107\56\32\16\17\37\357\277\71"
+  "\35\276\177\34\177\373\341\364\370\364\325\155\177\34\177\375\340\166\330\352\361\373\30\27\171\347\116\364\375\343\375\7"
+  "\314\345\323\17\162\336\260\375\201\44\265\151\360\354\21\374\131\333\237\130\34\373\41\244\300\103\340\301\142\260\100\373"
+  "\302\133\176\42\214\73\55\251\156\52\175\65\137\137\25\277\6\20\307\345\335\264\202\363\375\152\273\323\360\362\142\220"
+  "\42\334\0\145\272\274\360\325\140\350\15\364\345\243\310\163\302\302\241\347\121\71\37\260\313\213\323\62\344\124\207\220"
+  "\44\212\44\250\273\363\362\113\160\167\345\41\204\327\202\177\175\125\341\353\275\142\307\277\276\162\341\277\151\303\227\12"
+  "\277\132\232\300\210\350\222\15\64\244\136\240\200\36\221\45\245\6\207\42\314\106\102\303\264\256\243\211\264\256\243\251"
+  "\65\270\130\327\171\343\130\47\17\146\123\203\216\41\311\26\106\142\376\162\252\203\373\220\322\376\6\47\103\237\55\264"
+  "\332\26\163\61\243\141\270\63\61\214\355\303\13\335\167\246\145\131\312\305\112\146\223\235\131\141\154\257\55\230\115\166"
+  "\146\145\131\312\251\25\337\103\53\336\117\53\276\207\126\274\227\126\211\330\231\24\66\172\75\70\45\142\147\112\315\205"
+  "\234\267\305\36\224\362\176\234\362\75\110\345\375\130\105\370\205\203\201\171\313\226\250\113\304\302\254\337\55\277\176\101"
+  "\62\117\261\117\77\301\335\160\202\215\371\214\362\51\334\220\54\305\101\3\310\60\5\362\302\324\214\4\231\20\70\371"
+  "\220\147\32\147\240\77\223\21\145\161\206\227\263\376\54\102\256\100\160\242\373\133\262\312\42\230\247\313\313\130\147\201"
+  "\100\125\71\65\350\372\41\364\156\235\0\130\65\23\240\350\226\126\0\305\103\1\260\56\103\325\154\61\265\52\367\120"
+  "\177\77\357\164\103\340\65\375\44\176\143\203\47\77\22\0\305\147\26\147\57\150\272\225\323\323\262\264\11\272\155\126"
+  "\273\31\242\133\126\32\367\12\321\237\356\42\211\51\160\20\54\50\62\37\221\277\364\340\101\54\135\360\15\216\117\215"
+  "\227\136\263\171\250\40\252\177\6\104\27\367\152\155\143\105\257\331\4\325\3\153\251\155\246\272\65\272\226\52\106\367"
+  "\10\302\242\322\54\126\67\226\66\315\246\223\356\61\126\133\245\163\341\155\235\315\352\130\173\172\247\165\253\171\367\150"
+  "\33\55\243\173\133\335\136\105\264\205\345\352\144\367\46\352\334\141\353\16\150\7\356\235\203\335\273\157\335\362\325\152"
+  "\260\323\136\354\204\345\336\231\75\40\232\202\266\4\133\364\214\100\5\63\335\251\35\126\320\252\365\333\101\317\256\261"
+  "\156\71\253\76\167\177\65\273\100\271\305\354\216\320\324\322\36\333\52\45\266\230\207\225\262\352\167\167\271\226\72\306"
+  "\272\245\254\232\373\375\245\354\2\345\226\262\73\202\345\236\265\306\266\237\112\176\350\123\311\367\70\225\374\40\247\222"
+  "\37\356\124\362\275\117\45\337\343\124\362\136\247\62\21\207\125\162\65\5\354\40\144\307\120\267\216\253\201\147\177\31"
+  "\73\40\271\125\354\14\320\24\321\32\332\252\141\176\150\21\363\75\124\314\17\42\143\176\70\35\363\275\205\314\367\120"
+  "\62\357\52\345\162\112\255\372\130\354\175\5\146\241\103\365\60\30\366\352\335\33\23\246\241\7\216\313\51\170\246\76"
+  "\341\66\155\17\0\147\326\246\61\100\33\345\61\341\312\162\205\335\312\365\2\364\311\50\126\327\252\132\46\153\75\113"
+  "\141\100\32\263\240\34\261\23\157\143\176\265\217\130\265\230\147\63\314\230\300\132\347\226\366\350\372\144\323\336\50\267"
+  "\43\154\364\322\355\15\332\66\210\252\207\153\157\14\266\146\301\335\131\44\142\33\302\352\266\153\277\15\267\41\344\255"
+  "\20\55\373\245\6\130\154\34\4\225\370\23\365\331\151\135\266\360\141\126\152\226\46\246\123\137\201\124\205\104\22\20"
+  "\76\62\377\142\263\72\210\321\210\274\366\310\57\167\344\334\263\143\4\61\120\261\21\134\115\351\30\175\356\171\333\27"
+  "\67\110\106\65\165\154\131\72\362\160\342\124\231\36\37\375\17";
+
+/* lib/stdatomic.wbo (DEFLATEd, org. size 244) */
+static unsigned char file_l_65[178] =
+  "\135\314\75\13\202\120\24\200\341\163\356\61\365\152\40\255\115\67\161\250\261\17\154\355\237\104\231\224\203\50\52\175"
+  "\54\347\374\266\226\250\261\377\323\120\26\101\264\276\274\74\160\130\27\330\325\165\263\131\65\105\236\45\224\124\15\325"
+  "\145\144\347\151\136\124\247\336\362\223\227\111\136\36\223\335\166\72\301\122\225\51\156\60\305\75\145\343\350\177\210\147"
+  "\10\212\24\241\240\262\0\224\205\35\44\21\101\351\263\55\354\10\273\302\132\330\23\366\305\70\103\120\3\155\154\243"
+  "\215\173\175\20\250\320\63\372\2\326\342\14\30\370\140\234\320\67\136\14\352\14\20\130\330\155\45\376\221\230\65\263"
+  "\307\157\151\4\364\225\156\57\211\132\351\376\47\315\201\132\351\11";
+
+/* lib/include/pthread.h (DEFLATEd, org. size 3054) */
+static unsigned char file_l_66[915] =
+  "\235\126\333\216\333\66\20\175\67\340\177\30\240\57\222\140\257\167\203\42\100\355\242\200\263\153\40\156\23\157\220\165"
+  "\320\240\57\6\55\216\55\166\145\122\41\251\170\335\40\377\236\241\56\136\131\226\224\165\137\164\31\315\71\163\70\34"
+  "\216\146\24\300\207\373\207\371\147\260\221\106\306\15\170\154\255\5\337\42\367\41\30\365\173\375\336\57\211\146\333\35"
+  "\3\45\103\244\67\41\303\70\345\10\277\233\203\31\331\103\202\346\52\372\243\156\17\71\156\352\166\53\166\230\231\372"
+  "\275\121\0\213\67\143\130\247\42\266\304\13\177\117\37\346\245\200\1\30\5\211\126\133\315\166\6\122\43\344\366\250"
+  "\315\104\52\215\71\254\21\142\41\37\221\367\173\20\300\136\330\10\206\103\23\61\215\174\270\303\235\322\7\140\222\203"
+  "\116\45\254\351\21\42\145\54\230\64\111\224\266\216\156\317\214\30\26\234\23\100\26\106\31\121\156\161\60\3\102\202"
+  "\260\6\324\136\302\116\361\64\106\262\30\313\50\5\340\2\71\226\42\122\26\336\106\10\212\56\332\14\62\52\132\202"
+  "\11\131\314\64\154\143\265\146\61\174\45\14\133\307\110\371\305\253\355\25\240\326\122\371\100\222\213\260\303\130\21\140"
+  "\0\373\110\120\60\316\54\313\210\110\107\21\307\143\132\263\203\113\217\325\151\150\123\215\364\34\41\113\174\20\6\362"
+  "\325\117\40\311\331\126\370\44\354\240\240\316\210\102\247\75\216\231\25\224\157\227\235\42\254\111\60\24\33\21\146\41"
+  "\63\75\122\35\223\205\274\250\1\267\317\264\245\105\354\62\12\4\145\70\73\71\363\371\6\106\374\207\53\342\262\54"
+  "\174\164\317\23\132\215\5\216\364\36\221\321\222\341\373\121\60\263\126\67\323\70\20\45\347\261\352\275\113\55\76\221"
+  "\73\0\225\322\365\30\66\32\161\0\67\343\314\21\371\0\136\215\41\124\322\242\344\305\32\32\151\15\176\251\262\22"
+  "\202\267\153\70\223\354\16\304\211\273\363\72\121\170\266\250\252\207\213\166\164\240\203\102\337\205\104\370\260\174\373\161"
+  "\66\275\133\335\322\165\71\133\375\171\77\137\114\337\274\233\301\165\253\313\335\154\71\275\175\73\273\203\233\163\227\7"
+  "\372\364\327\352\375\174\1\277\136\377\366\372\374\373\373\117\313\331\347\325\174\61\137\316\247\357\346\377\314\76\202\347"
+  "\325\222\354\177\203\153\370\356\67\204\277\137\334\265\100\363\114\266\42\357\27\267\263\14\131\201\344\331\74\102\372\75"
+  "\174\262\250\345\111\312\262\164\11\51\254\167\132\66\20\270\273\77\151\7\161\244\275\124\207\213\161\6\355\261\176\33"
+  "\301\203\143\231\323\255\213\151\133\145\242\374\230\332\367\72\137\220\374\214\221\264\125\16\123\213\272\143\345\376\104\133"
+  "\225\251\113\235\303\222\264\16\306\220\256\25\71\316\235\132\121\27\347\127\45\350\220\172\1\261\152\353\173\371\253\137"
+  "\332\231\336\266\104\372\127\11\131\211\143\113\104\220\120\163\154\301\344\353\254\242\52\216\317\326\362\311\140\274\311\4"
+  "\265\320\341\227\224\305\125\266\233\101\205\305\276\362\47\55\245\374\334\37\116\352\271\322\66\72\213\363\331\257\136\331"
+  "\27\61\64\4\167\260\135\175\277\56\43\155\224\224\361\166\302\134\357\276\24\143\365\341\377\300\122\331\201\152\256\352"
+  "\262\133\237\144\354\271\207\167\246\345\350\126\317\314\5\370\363\300\16\24\326\167\352\22\306\46\65\31\151\27\150\317"
+  "\232\145\274\170\7\162\14\15\203\374\345\124\345\52\213\37\262\103\273\301\205\226\270\66\356\245\53\224\21\133\131\71"
+  "\243\57\132\344\132\53\306\103\146\154\63\254\21\350\176\140\265\277\31\4\252\350\111\136\340\266\57\357\155\176\116\61"
+  "\162\323\235\143\141\361\30\120\122\45\103\242\34\241\332\200\304\175\71\216\226\163\247\233\34\237\362\241\54\237\314\13"
+  "\11\31\275\233\150\127\145\313\162\135\324\163\104\126\360\132\23\375\1";
+
+/* lib/include/wasi.threads.h (DEFLATEd, org. size 473) */
+static unsigned char file_l_67[284] =
+  "\115\121\75\157\203\60\20\335\43\361\37\236\350\320\4\25\330\223\51\143\326\146\310\30\31\270\200\125\154\43\337\221"
+  "\217\177\137\333\120\245\223\345\273\347\367\345\272\300\345\170\76\101\6\117\252\343\75\6\221\211\367\165\335\153\31\346"
+  "\246\152\235\251\57\324\34\231\311\64\343\253\176\50\326\345\12\106\121\147\233\154\363\61\171\325\33\5\343\272\171\44"
+  "\344\21\222\277\307\316\266\24\141\165\201\263\50\57\120\260\364\130\5\367\341\44\14\216\5\155\270\13\361\272\326\226"
+  "\105\205\227\160\267\4\131\310\263\15\12\360\240\274\266\75\264\60\14\31\347\137\120\266\103\253\306\221\323\220\236\223"
+  "\363\102\35\242\223\353\42\164\345\250\275\25\335\175\101\371\176\127\45\252\157\222\331\133\116\12\157\123\237\201\246\303"
+  "\126\141\162\254\105\337\303\156\66\15\371\35\234\117\366\172\365\157\232\210\234\305\115\351\161\366\124\341\144\126\171\305"
+  "\153\31\310\27\342\222\47\365\260\371\141\115\303\230\171\11\2\63\263\44\242\206\60\152\373\23\315\207\17\100\131\306"
+  "\264\324\225\113\320\52\125\116\117\41\157\103\105\202\277\160\221\167\173\167\301\166\21\323\35\262\315\57";
+
+/* lib/pthread.wbo (DEFLATEd, org. size 3370) */
+static unsigned char file_l_68[1612] =
+  "\175\125\315\127\33\125\24\177\157\76\102\40\241\44\224\122\140\2\175\231\114\55\210\142\201\226\102\153\241\261\125\243"
+  "\125\54\255\126\245\213\234\220\114\141\54\371\150\146\70\264\236\323\31\134\273\351\302\163\334\271\163\327\177\202\236\43"
+  "\155\67\56\334\270\361\57\200\225\73\27\325\343\275\357\315\114\146\322\352\42\57\357\176\337\373\273\367\276\41\273\33"
+  "\115\172\247\247\345\154\265\315\112\115\256\266\35\331\156\31\211\272\131\157\266\37\46\154\247\266\155\155\50\167\333\246"
+  "\231\250\127\266\267\233\325\164\131\374\227\341\167\357\130\100\354\64\220\4\365\266\325\330\104\143\333\164\172\301\270\342"
+  "\64\353\126\65\133\26\377\345\152\275\365\240\272\265\71\77\247\354\126\154\53\55\142\226\355\126\145\267\241\70\126\335"
+  "\354\257\242\233\362\246\351\40\325\133\335\151\13\225\276\172\305\152\210\153\22\216\326\266\145\73\175\74\162\175\307\61"
+  "\37\364\165\62\32\364\13\51\163\1\147\245\243\51\16\305\345\202\251\240\117\352\50\15\363\201\43\315\32\322\234\221"
+  "\12\264\40\256\354\130\65\145\13\301\261\146\15\331\232\203\337\274\41\315\33\131\254\241\34\324\340\124\0\271\112\173"
+  "\123\262\133\362\106\313\310\6\161\52\216\323\56\133\15\313\121\360\66\24\143\327\114\0\254\371\160\64\306\4\344\300"
+  "\131\365\236\155\175\153\52\170\304\305\233\21\261\332\302\123\353\66\257\231\240\260\5\132\216\251\362\123\353\366\20\321"
+  "\110\264\370\337\261\100\245\12\247\143\112\55\107\345\45\251\133\30\102\266\316\101\325\347\341\267\140\244\3\315\157\232"
+  "\126\103\151\265\115\233\332\41\317\66\267\357\206\256\104\24\371\156\313\350\17\130\346\375\235\312\266\344\314\112\316\334"
+  "\160\254\23\41\114\243\257\262\175\230\272\132\213\312\264\176\42\316\364\125\273\270\116\373\41\266\71\344\126\233\215\132"
+  "\30\160\344\25\256\357\44\33\25\210\160\325\241\30\317\127\354\345\304\156\305\162\244\206\55\333\346\175\332\216\333\242"
+  "\150\70\306\301\361\256\41\273\247\262\141\43\161\74\46\266\255\315\106\145\73\156\262\321\156\126\152\325\212\355\204\140"
+  "\67\33\125\223\66\25\236\31\111\311\222\114\75\52\51\204\300\215\170\212\232\240\36\121\324\36\140\172\262\232\44\160"
+  "\364\2\273\57\45\173\36\260\224\164\277\177\71\66\200\52\112\46\53\41\171\132\246\203\4\30\373\204\110\364\70\241"
+  "\112\16\57\103\160\121\360\162\102\134\24\72\114\340\174\4\164\206\236\34\33\120\350\110\207\36\105\172\14\350\21\127"
+  "\363\334\234\367\10\314\301\335\376\113\231\110\171\115\32\227\47\230\6\364\63\242\134\141\332\344\220\224\317\61\55\243"
+  "\46\130\56\257\245\47\122\44\65\221\32\7\7\247\10\344\103\126\134\346\241\227\274\347\352\236\133\360\134\303\143\232"
+  "\101\7\321\203\162\110\164\235\261\5\42\375\106\351\260\241\46\341\157\304\120\173\121\226\1\131\1\274\247\45\70\222"
+  "\122\26\113\4\105\24\111\74\221\175\102\17\40\1\151\102\36\227\116\143\206\217\171\172\171\324\30\2\143\203\345\101"
+  "\77\305\105\14\270\317\121\314\362\317\110\377\170\152\74\65\241\242\36\335\103\346\130\212\100\272\157\120\114\327\300\164"
+  "\317\360\214\47\75\167\312\117\272\40\311\371\51\166\46\257\261\51\250\373\10\62\323\47\41\255\21\351\10\160\31\70"
+  "\204\243\365\47\311\353\254\300\364\43\222\57\60\306\64\126\60\44\71\103\117\261\51\370\7\367\157\122\254\140\300\235"
+  "\366\135\262\151\135\337\47\173\173\12\26\65\55\260\50\200\363\5\254\14\363\171\213\33\310\140\40\350\267\51\157\157"
+  "\6\75\314\240\23\66\3\366\354\5\140\260\117\162\3\51\202\36\331\114\150\377\216\320\357\103\375\263\134\377\54\310"
+  "\247\47\211\24\252\314\12\225\121\124\231\343\52\163\242\255\374\102\237\21\25\310\124\44\100\320\262\271\320\305\174\44"
+  "\312\71\356\342\34\217\242\164\242\234\247\212\307\7\265\345\56\170\250\167\201\43\74\303\101\136\354\214\205\273\344\271"
+  "\27\75\367\222\207\161\104\26\230\255\312\121\112\221\74\224\313\362\213\5\65\11\122\354\174\174\146\122\60\267\143\10"
+  "\111\330\216\31\266\310\146\16\111\106\355\321\65\337\144\237\44\260\16\15\241\7\255\334\367\177\311\100\0\354\270\55"
+  "\321\260\212\30\57\121\277\346\317\135\222\117\325\5\237\112\3\265\304\316\370\324\10\120\27\241\353\74\344\41\341\334"
+  "\314\261\1\260\177\316\267\4\326\303\17\276\240\137\142\132\10\316\273\2\277\105\304\342\262\347\56\163\10\265\14\135"
+  "\21\351\146\170\272\217\140\217\17\302\66\210\375\343\323\256\57\303\66\360\65\134\366\327\301\357\224\306\226\237\22\357"
+  "\73\76\335\301\112\262\313\301\316\136\206\26\151\223\31\154\21\352\362\334\60\231\53\174\344\26\60\27\230\374\142\147"
+  "\370\165\30\373\14\37\373\42\207\216\227\327\311\212\210\41\347\161\213\220\210\230\375\164\277\37\57\252\120\234\304\312"
+  "\245\203\0\24\100\70\27\10\103\75\205\256\120\170\302\172\13\164\120\64\316\303\130\52\220\174\123\337\23\230\45\334"
+  "\253\236\173\315\143\127\331\265\3\144\277\317\263\117\212\15\23\353\325\331\246\17\272\266\351\103\341\243\327\55\171\276"
+  "\101\51\156\360\221\157\120\362\15\116\162\172\5\365\43\330\210\261\215\40\264\24\101\250\44\300\130\22\140\374\202\45"
+  "\373\345\363\56\24\341\175\53\5\257\31\157\5\357\254\120\21\215\102\161\330\107\60\60\142\6\101\143\143\310\175\314"
+  "\363\314\165\345\371\372\36\362\45\350\13\362\214\66\115\13\334\215\162\167\131\160\207\241\351\317\376\313\33\144\107\176"
+  "\344\257\152\51\362\224\12\270\256\377\137\63\76\351\152\306\247\101\63\126\203\146\254\306\15\76\363\15\126\175\203\33"
+  "\4\76\175\56\365\306\320\2\52\135\163\335\233\236\173\13\354\304\107\340\46\53\341\127\214\255\262\233\154\215\243\227"
+  "\277\205\254\223\143\373\344\5\107\353\26\37\102\15\174\175\56\202\367\10\127\140\122\2\304\63\364\6\210\276\240\342"
+  "\13\173\335\17\163\233\107\12\140\215\140\252\347\213\354\66\174\245\304\272\103\222\124\365\351\275\37\216\376\220\177\15"
+  "\36\321\350\244\27\231\216\200\147\262\341\226\204\142\166\173\212\310\254\10\307\337\344\251\160\361\17\341\16\141\72\222"
+  "\360\321\171\102\137\22\175\15\14\237\320\337\271\351\213\316\206\101\1\154\15\362\17\72\370\45\307\56\5\45\260\125"
+  "\110\354\47\61\113\253\141\307\4\242\137\375\227\226\27\325\372\132\140\125\162\327\75\367\116\367\42\104\360\60\42\133"
+  "\260\376\130\314\214\324\375\126\254\213\261\63\142\157\5\273\223\5\225\165\120\27\223\265\36\146\240\106\266\103\54\320"
+  "\72\247\242\373\121\360\243\275\176\71\376\5";
 
 /* l directory (sorted by path) */
-struct memdir directory_l[46] = {
-  { "lib/crt.args.wo", 881, 1, 4765, &file_l_0[0] },
-  { "lib/crt.argv.wo", 876, 1, 4717, &file_l_1[0] },
-  { "lib/crt.void.wo", 450, 1, 1416, &file_l_2[0] },
-  { "lib/crt.wo", 121, 1, 264, &file_l_3[0] },
-  { "lib/ctype.wo", 489, 1, 4203, &file_l_4[0] },
-  { "lib/dirent.wo", 2161, 1, 21870, &file_l_5[0] },
-  { "lib/errno.wo", 1474, 1, 9609, &file_l_6[0] },
-  { "lib/fcntl.wo", 2337, 1, 20902, &file_l_7[0] },
-  { "lib/fenv.wo", 260, 1, 1286, &file_l_8[0] },
+struct memdir directory_l[53] = {
+  { "lib/crt.args.wbo", 622, 1, 940, &file_l_47[0] },
+  { "lib/crt.argv.wbo", 612, 1, 936, &file_l_48[0] },
+  { "lib/crt.void.wbo", 269, 1, 361, &file_l_49[0] },
+  { "lib/crt.wbo", 71, 1, 85, &file_l_50[0] },
+  { "lib/ctype.wbo", 331, 1, 731, &file_l_51[0] },
+  { "lib/dirent.wbo", 2720, 1, 5475, &file_l_52[0] },
+  { "lib/errno.wbo", 1761, 1, 3437, &file_l_53[0] },
+  { "lib/fcntl.wbo", 1786, 1, 3428, &file_l_54[0] },
+  { "lib/fenv.wbo", 204, 1, 360, &file_l_55[0] },
   { "lib/include/NDEBUG/assert.h", 116, 1, 150, &file_l_20[0] },
   { "lib/include/assert.h", 137, 1, 182, &file_l_9[0] },
   { "lib/include/ctype.h", 154, 1, 495, &file_l_10[0] },
@@ -4439,35 +5218,42 @@ struct memdir directory_l[46] = {
   { "lib/include/fcntl.h", 715, 1, 2242, &file_l_13[0] },
   { "lib/include/fenv.h", 317, 1, 780, &file_l_14[0] },
   { "lib/include/float.h", 278, 1, 665, &file_l_15[0] },
+  { "lib/include/ftw.h", 576, 1, 1266, &file_l_46[0] },
   { "lib/include/inttypes.h", 557, 1, 3738, &file_l_16[0] },
-  { "lib/include/limits.h", 230, 1, 635, &file_l_17[0] },
+  { "lib/include/limits.h", 265, 1, 691, &file_l_17[0] },
   { "lib/include/locale.h", 154, 1, 215, &file_l_18[0] },
-  { "lib/include/math.h", 417, 1, 1519, &file_l_19[0] },
+  { "lib/include/math.h", 512, 1, 2048, &file_l_19[0] },
+  { "lib/include/pthread.h", 915, 1, 3054, &file_l_66[0] },
   { "lib/include/stdarg.h", 267, 1, 583, &file_l_21[0] },
+  { "lib/include/stdatomic.h", 1521, 1, 8556, &file_l_64[0] },
   { "lib/include/stdbool.h", 81, 1, 122, &file_l_22[0] },
   { "lib/include/stddef.h", 100, 1, 178, &file_l_23[0] },
   { "lib/include/stdint.h", 490, 1, 2186, &file_l_24[0] },
-  { "lib/include/stdio.h", 1054, 1, 3869, &file_l_25[0] },
-  { "lib/include/stdlib.h", 597, 1, 1993, &file_l_26[0] },
+  { "lib/include/stdio.h", 1326, 1, 4429, &file_l_25[0] },
+  { "lib/include/stdlib.h", 661, 1, 2130, &file_l_26[0] },
   { "lib/include/string.h", 414, 1, 1854, &file_l_27[0] },
   { "lib/include/sys.cdefs.h", 113, 1, 191, &file_l_28[0] },
-  { "lib/include/sys.crt.h", 154, 1, 243, &file_l_29[0] },
+  { "lib/include/sys.crt.h", 213, 1, 339, &file_l_29[0] },
   { "lib/include/sys.intrs.h", 612, 1, 3110, &file_l_30[0] },
   { "lib/include/sys.stat.h", 634, 1, 2073, &file_l_31[0] },
-  { "lib/include/sys.types.h", 150, 1, 414, &file_l_32[0] },
-  { "lib/include/time.h", 457, 1, 1301, &file_l_33[0] },
-  { "lib/include/unistd.h", 453, 1, 1529, &file_l_34[0] },
-  { "lib/include/wasi.api.h", 10409, 1, 48950, &file_l_35[0] },
-  { "lib/include/wasm.h", 2302, 1, 22452, &file_l_36[0] },
-  { "lib/include/wasm_simd128.h", 4173, 1, 44179, &file_l_37[0] },
+  { "lib/include/sys.types.h", 156, 1, 443, &file_l_32[0] },
+  { "lib/include/time.h", 596, 1, 1681, &file_l_33[0] },
+  { "lib/include/unistd.h", 578, 1, 1861, &file_l_34[0] },
+  { "lib/include/wasi.api.h", 10941, 1, 48987, &file_l_35[0] },
+  { "lib/include/wasi.threads.h", 284, 1, 473, &file_l_67[0] },
+  { "lib/include/wasm.h", 2960, 1, 26441, &file_l_36[0] },
+  { "lib/include/wasm_simd128.h", 4821, 1, 45138, &file_l_37[0] },
   { "lib/include/wchar.h", 159, 1, 292, &file_l_38[0] },
-  { "lib/math.wo", 14260, 1, 168538, &file_l_39[0] },
-  { "lib/stat.wo", 1077, 1, 9195, &file_l_40[0] },
-  { "lib/stdio.wo", 13209, 1, 192049, &file_l_41[0] },
-  { "lib/stdlib.wo", 6320, 1, 70385, &file_l_42[0] },
-  { "lib/string.wo", 2033, 1, 23745, &file_l_43[0] },
-  { "lib/time.wo", 4434, 1, 46152, &file_l_44[0] },
-  { "lib/unistd.wo", 1892, 1, 25993, &file_l_45[0] },
+  { "lib/math.wbo", 12073, 1, 30324, &file_l_56[0] },
+  { "lib/pthread.wbo", 1612, 1, 3370, &file_l_68[0] },
+  { "lib/stat.wbo", 804, 1, 1553, &file_l_57[0] },
+  { "lib/stdatomic.wbo", 178, 1, 244, &file_l_65[0] },
+  { "lib/stdio.wbo", 14880, 1, 39798, &file_l_58[0] },
+  { "lib/stdlib.wbo", 8327, 1, 17163, &file_l_59[0] },
+  { "lib/string.wbo", 1633, 1, 3696, &file_l_60[0] },
+  { "lib/time.wbo", 4329, 1, 9169, &file_l_61[0] },
+  { "lib/unistd.wbo", 1679, 1, 4557, &file_l_62[0] },
+  { "lib/wasm_simd128.wbo", 2083, 1, 4751, &file_l_63[0] },
 };
 
 /* end of in-memory archive */
@@ -4781,6 +5567,10 @@ static int memdir_cmp(const void *p1, const void *p2)
   return strcmp(name1, name2);
 }
 
+/* inflated archive entries, shared by all MEMs opened on them */
+typedef struct mcent { char *data; int refc; } mcent_t;
+static mcent_t g_mcache[sizeof(directory_l)/sizeof(struct memdir)];
+
 MEM *mopen(const char *path)
 {
   struct memdir md, *pmd;
@@ -4789,46 +5579,64 @@ MEM *mopen(const char *path)
   if (pmd) {
     MEM *mp = emalloc(sizeof(MEM));
     if (pmd->compression == 1) {
-      size_t size = pmd->size, org_size = pmd->org_size;
-      char *dst = emalloc(pmd->org_size + 1);
-      int err = zinflate((uint8_t *)dst, &org_size, (const uint8_t *)pmd->data, &size);
-      if (err != 0 || org_size != pmd->org_size) 
-        eprintf("%s: internal inflate error: %d", path, err);
-      dst[pmd->org_size] = '\0'; /* 0-terminate for debugging &c. */
-      mp->base = mp->curp = dst;
+      mcent_t *pce = &g_mcache[pmd - &directory_l[0]];
+      if (pce->data == NULL) { /* first use: inflate and keep it */
+        size_t size = pmd->size, org_size = pmd->org_size;
+        char *dst = emalloc(pmd->org_size + 1);
+        int err = zinflate((uint8_t *)dst, &org_size, (const uint8_t *)pmd->data, &size);
+        if (err != 0 || org_size != pmd->org_size) 
+          eprintf("%s: internal inflate error: %d", path, err);
+        dst[pmd->org_size] = '\0'; /* 0-terminate for debugging &c. */
+        pce->data = dst;
+      }
+      pce->refc += 1;
+      mp->base = mp->curp = pce->data;
       mp->end = mp->base + pmd->org_size; 
-      mp->inheap = true;
+      mp->pce = pce;
       return mp;
     } else if (pmd->compression == 0) {
-      assert(*mp->end == '\0'); /* already 0-terminated */
       mp->base = mp->curp = (char*)pmd->data;
       mp->end = mp->base + pmd->size;
-      mp->inheap = false;
+      assert(*mp->end == '\0'); /* already 0-terminated */
+      mp->pce = NULL;
       return mp;
     } else assert(false);
   }
   return NULL;
 }
 
+/* lines are found via memchr and appended as whole spans */
 char *mgetlb(cbuf_t *pcb, MEM *mp)
 {
+  const char *s, *e; size_t n;
   assert(mp); assert(pcb);
   cbclear(pcb);
   if (mp->curp == mp->end) return NULL;
-  while (mp->curp < mp->end) {
-    int c = *mp->curp++;
-    if (c == '\r' && *mp->curp == '\n') continue;
-    if (c == '\n') break;
-    cbputc(c, pcb);
-  }
+  s = mp->curp, n = (size_t)(mp->end - s);
+  if ((e = memchr(s, '\n', n)) != NULL) mp->curp = e + 1; 
+  else mp->curp = e = mp->end;
+  if (e > s && e[-1] == '\r' && e < mp->end) --e;
+  cbput(s, (size_t)(e - s), pcb);
   return cbdata(pcb);
 }
 
 int mclose(MEM *mp)
 {
   if (mp) {
-    if (mp->inheap) free((void*)mp->base);
+    if (mp->pce != NULL) ((mcent_t*)mp->pce)->refc -= 1;
+    free(mp);
     return 0;
   }
   return -1;
 }
+
+void mcachetrim(void)
+{
+  size_t i;
+  for (i = 0; i < sizeof(g_mcache)/sizeof(mcent_t); ++i) {
+    mcent_t *pce = &g_mcache[i];
+    if (pce->data != NULL && pce->refc == 0) {
+      free(pce->data); pce->data = NULL;
+    }
+  }
+}
@@ -32,6 +32,12 @@ extern  void  verbosenf(int n, const char *fmt, ...);
 extern  void  verbosef(const char *fmt, ...);
 extern  void  vverbosef(const char *fmt, ...);
 extern  void  vvverbosef(const char *fmt, ...);
+/* phase statistics (-ftime-report) */
+extern  void  phenable(void);
+extern  bool  phenabled(void);
+extern  void  phbeg(const char *name);
+extern  void  phend(void);
+extern  void  phreport(FILE *fp, bool json);
 /* AT&T-like option parser */
 extern  int   eoptind, eopterr, eoptopt, eoptich;
 extern  char  *eoptarg;
@@ -121,6 +127,19 @@ extern void* bufbsearch(const buf_t* pb, const void *pe, int (*cmp)(const void *
 extern size_t bufoff(const buf_t* pb, const void *pe); /* element offset of non-NULL pe inside pb: [0..len] */
 extern void bufswap(buf_t* pb1, buf_t* pb2);
 
+/* hash indices over buffers: caller hashes elements and supplies cmp
+ * for exact matching; elements are referred to by their buffer index */
+typedef struct hidx {
+  size_t *slots;         /* element index + 1 or 0 for empty slot */
+  unsigned long *hashes; /* hashes of elements in slots */
+  size_t sz, cnt;        /* slots allocated/used; sz is 0 or power of 2 */
+} hidx_t;
+extern hidx_t* hidxinit(hidx_t* pi);
+extern void hidxfini(hidx_t* pi);
+extern void hidxadd(hidx_t* pi, unsigned long h, size_t i); /* pb[i] hashes to h */
+extern void* bufhsearch(const buf_t* pb, const hidx_t* pi, const void *pe, unsigned long h, int (*cmp)(const void *, const void *)); /* hashed */
+extern unsigned long memhash(const void *p, size_t n);
+
 /* dstr_t buffers */
 typedef buf_t dsbuf_t;
 #define dsbinit(mem) (bufinit(mem, sizeof(dstr_t)))
@@ -186,6 +205,7 @@ extern void cbcat(cbuf_t* pdcb, const cbuf_t* pscb);
 extern dstr_t cbclose(cbuf_t* pcb);
 extern int cbuf_cmp(const void *p1, const void *p2);
 extern char* fgetlb(cbuf_t *pcb, FILE *fp);
+extern char* fgetall(cbuf_t *pcb, FILE *fp);
 extern char *wcsto8cb(const wchar_t *wstr, int rc, cbuf_t *pcb);
 
 /* wide char buffers */
@@ -210,6 +230,30 @@ extern void binfloat(float f, cbuf_t* pcb);   /* align=4 */
 extern void bindouble(double d, cbuf_t* pcb); /* align=8 */
 
 
+/* arenas: bump-pointer allocation from big chunks, freed all at once */
+typedef struct archunk {
+  struct archunk *next; /* older chunk or NULL */
+  size_t size;          /* usable bytes after the header */
+} archunk_t;
+typedef struct arena {
+  archunk_t *chunks;    /* newest first */
+  char *curp, *endp;    /* free space in the newest chunk */
+  size_t chunksz;       /* default chunk size; 0 means 64K */
+} arena_t;
+typedef struct armark {
+  archunk_t *chunk; char *curp;
+} armark_t;
+/* zero-filled arena_t is a valid empty arena with default chunk size */
+extern arena_t* arinit(arena_t* pa, size_t chunksz);
+extern void arfini(arena_t* pa);
+/* returns n uninitialized bytes aligned to 8 */
+extern void *aralloc(arena_t* pa, size_t n);
+extern char *arstrdup(arena_t* pa, const char *s);
+/* release frees everything allocated after the mark was taken */
+extern void armark(arena_t* pa, armark_t *pm);
+extern void arrelease(arena_t* pa, const armark_t *pm);
+
+
 /* symbols */
 typedef int sym_t;
 #define sym_cmp int_cmp
@@ -222,6 +266,36 @@ extern sym_t internf(const char *fmt, ...);
 /* reset symbol table */
 extern void clearsyms(void);
 
+/* perfect hash tables for fixed sets of names (keywords &c.): add all
+ * names, then build; lookup costs one hash pass and one strcmp */
+typedef struct phtab {
+  buf_t ents;       /* names and values in order of addition */
+  unsigned *disps;  /* bucket => displacement */
+  int *slots;       /* slot => ents index or -1 */
+  int sbits, bbits; /* log2 of slot and bucket counts */
+} phtab_t;
+extern phtab_t* phtinit(phtab_t *pt);
+extern void phtfini(phtab_t *pt);
+/* name is not copied and should stay valid */
+extern void phtadd(phtab_t *pt, const char *name, int val);
+extern void phtbuild(phtab_t *pt);
+/* true if name is in the table; its value goes to *pval if not NULL */
+extern bool phtlookup(const phtab_t *pt, const char *name, int *pval);
+
+/* source locations */
+/* every source gets its own range in a single 32-bit space, so a location
+ * is just range base + char offset, with 0 standing for 'no location' */
+typedef unsigned srcloc_t;
+/* reserve range for size chars of src (opaque), return its base */
+extern srcloc_t srcreg(void *src, size_t size);
+/* find src whose range contains loc and offset of loc in it; NULL if none */
+extern void *srcfind(srcloc_t loc, size_t *poff);
+/* reset source location ranges */
+extern void clearsrcs(void);
+/* convert pos into 1-based line + 0-based offset via binary search in 
+ * plsposs, ascending buffer of line start positions (size_t) */
+extern void bufpos2lnoff(const buf_t* plsposs, size_t pos, int *pln1, int *poff0);
+
 /* path name components */
 /* returns trailing file name */
 extern char *getfname(const char *path);
@@ -235,11 +309,15 @@ typedef char* (*fgetlb_t)(cbuf_t *pcb, void *dp);
 typedef int (*fclose_t)(void *dp);
 
 /* reading from in-memory archive */
+/* compressed entries are inflated once per process and shared by all
+ * MEMs opened on them; mclose releases the MEM, not the inflated data */
 typedef struct mem {
   const char *base, *end;
   const char *curp;
-  bool inheap;
+  void *pce; /* cache entry, NULL if not compressed */
 } MEM;
 extern MEM *mopen(const char *path);
 extern char *mgetlb(cbuf_t *pcb, MEM *mp);
 extern int mclose(MEM *mp);
+/* free inflated entries that are not open */
+extern void mcachetrim(void);
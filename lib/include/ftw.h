@@ -0,0 +1,31 @@
+/* file tree traversal */
+
+#pragma module "dirent"
+#pragma once
+#include <sys/stat.h>
+
+/* values of the type argument of the callback */
+#define FTW_F    1  /* file */
+#define FTW_D    2  /* directory, reported before its contents */
+#define FTW_DNR  3  /* directory that cannot be read */
+#define FTW_DP   4  /* directory, reported after its contents (FTW_DEPTH) */
+#define FTW_NS   5  /* stat failed */
+#define FTW_SL   6  /* symbolic link (FTW_PHYS) */
+#define FTW_SLN  7  /* symbolic link to a nonexistent file */
+
+/* values of the flags argument of nftw */
+#define FTW_PHYS   0x1  /* do not follow symbolic links */
+#define FTW_MOUNT  0x2  /* stay within the file system of the path */
+#define FTW_DEPTH  0x4  /* report directories after their contents */
+#define FTW_CHDIR  0x8  /* ignored: there is no current directory */
+
+struct FTW {
+  int base;  /* offset of the file name in the path */
+  int level; /* depth relative to the root of the walk */
+};
+
+/* directories are read in full before descending into them, so at most
+ * one directory descriptor is open at a time and fdlimit is ignored */
+extern int nftw(const char *path, 
+  int (*fn)(const char *, const struct stat *, int, struct FTW *), 
+  int fdlimit, int flags);
@@ -21,3 +21,4 @@
 #define UINT_MAX 0xffffffffU
 #define ULONG_MAX UINT_MAX /* wasm32 */
 #define ULLONG_MAX  0xffffffffffffffffULL
+#define IOV_MAX 1024 /* max #iovecs in readv/writev */
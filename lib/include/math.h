@@ -7,6 +7,7 @@
 
 #define NAN (_uasf(0x7FC00000U))
 #define INFINITY (_uasf(0x7F800000U))
+#define HUGE_VALF INFINITY
 
 extern double acos(double x);
 extern double asin(double x);
@@ -48,4 +49,18 @@ extern double fmax(double x, double y);
 extern double fmin(double x, double y);
 extern double expm1(double x); 
 
-
+/* selected C99 additions for floats */
+extern float sqrtf(float x);
+extern float fabsf(float x);
+extern float ceilf(float x);
+extern float floorf(float x);
+extern float truncf(float x);
+extern float nearbyintf(float x);
+extern float copysignf(float x, float y);
+extern float fmaxf(float x, float y);
+extern float fminf(float x, float y);
+extern float sinf(float x);
+extern float cosf(float x);
+extern float expf(float x);
+extern float logf(float x);
+extern float powf(float x, float y);
@@ -0,0 +1,62 @@
+/* POSIX threads (abridged) */
+
+#pragma once
+#include <sys/types.h>
+#include <sys/cdefs.h>
+#include <time.h>
+
+/* NB: built on WASI threads, so programs using threads should be linked
+ * with --shared-memory and run by a host supporting wasi-threads; each
+ * thread runs in its own module instance sharing memory with the others,
+ * so scalar global variables (e.g. errno) are thread-local, while data
+ * in memory (arrays, structures, heap) is shared; pthread_exit, thread
+ * cancellation and thread-specific data are not supported */
+
+typedef struct pthread *pthread_t;
+typedef struct { size_t stacksize; int detachstate; } pthread_attr_t;
+typedef struct { int lock; } pthread_mutex_t;  /* 0: free, 1: locked, 2: contended */
+typedef struct { int seq; } pthread_cond_t;
+typedef struct { int state; } pthread_once_t;
+typedef int pthread_mutexattr_t;
+typedef int pthread_condattr_t;
+
+#define PTHREAD_CREATE_JOINABLE 0
+#define PTHREAD_CREATE_DETACHED 1
+#define PTHREAD_STACK_MIN 4096
+#define PTHREAD_MUTEX_INITIALIZER ((pthread_mutex_t){ 0 })
+#define PTHREAD_COND_INITIALIZER ((pthread_cond_t){ 0 })
+#define PTHREAD_ONCE_INIT ((pthread_once_t){ 0 })
+
+extern int pthread_attr_init(pthread_attr_t *attr);
+extern int pthread_attr_destroy(pthread_attr_t *attr);
+extern int pthread_attr_setstacksize(pthread_attr_t *attr, size_t size);
+extern int pthread_attr_getstacksize(const pthread_attr_t *attr, size_t *psize);
+extern int pthread_attr_setdetachstate(pthread_attr_t *attr, int state);
+extern int pthread_attr_getdetachstate(const pthread_attr_t *attr, int *pstate);
+extern int pthread_create(pthread_t *pt, const pthread_attr_t *attr, void *(*start)(void *), void *arg);
+extern int pthread_join(pthread_t t, void **pres);
+extern int pthread_detach(pthread_t t);
+extern pthread_t pthread_self(void);
+extern int pthread_equal(pthread_t t1, pthread_t t2);
+
+extern int pthread_mutexattr_init(pthread_mutexattr_t *attr);
+extern int pthread_mutexattr_destroy(pthread_mutexattr_t *attr);
+extern int pthread_mutex_init(pthread_mutex_t *m, const pthread_mutexattr_t *attr);
+extern int pthread_mutex_destroy(pthread_mutex_t *m);
+extern int pthread_mutex_lock(pthread_mutex_t *m);
+extern int pthread_mutex_trylock(pthread_mutex_t *m);
+extern int pthread_mutex_unlock(pthread_mutex_t *m);
+
+extern int pthread_condattr_init(pthread_condattr_t *attr);
+extern int pthread_condattr_destroy(pthread_condattr_t *attr);
+extern int pthread_cond_init(pthread_cond_t *c, const pthread_condattr_t *attr);
+extern int pthread_cond_destroy(pthread_cond_t *c);
+extern int pthread_cond_wait(pthread_cond_t *c, pthread_mutex_t *m);
+extern int pthread_cond_timedwait(pthread_cond_t *c, pthread_mutex_t *m, const struct timespec *abstime);
+extern int pthread_cond_signal(pthread_cond_t *c);
+extern int pthread_cond_broadcast(pthread_cond_t *c);
+
+extern int pthread_once(pthread_once_t *o, void (*init)(void));
+
+/* internal: entry point of new thread instances (exported) */
+extern void wasi_thread_start(int tid, void *arg);
@@ -0,0 +1,154 @@
+/* Atomics (C11, abridged) */
+
+#pragma once
+#include <stdint.h>
+
+/* NB: WASM atomic operations are sequentially consistent, so memory order
+ * arguments are accepted but ignored; atomic objects must be naturally
+ * aligned and reside in memory (struct members, arrays, heap data), as
+ * scalar globals are instance-specific (per-thread) WASM globals; the
+ * _Atomic qualifier is not supported: only operations below are atomic,
+ * atomic types are plain 32-bit types except for (u)llong ones */
+
+typedef enum memory_order {
+  memory_order_relaxed,
+  memory_order_consume,
+  memory_order_acquire,
+  memory_order_release,
+  memory_order_acq_rel,
+  memory_order_seq_cst
+} memory_order;
+
+typedef int atomic_bool;
+typedef int atomic_char;
+typedef int atomic_schar;
+typedef unsigned atomic_uchar;
+typedef int atomic_short;
+typedef unsigned atomic_ushort;
+typedef int atomic_int;
+typedef unsigned atomic_uint;
+typedef long atomic_long;
+typedef unsigned long atomic_ulong;
+typedef long long atomic_llong;
+typedef unsigned long long atomic_ullong;
+typedef intptr_t atomic_intptr_t;
+typedef uintptr_t atomic_uintptr_t;
+typedef size_t atomic_size_t;
+typedef ptrdiff_t atomic_ptrdiff_t;
+typedef int64_t atomic_intmax_t;
+typedef uint64_t atomic_uintmax_t;
+
+typedef int atomic_flag;
+
+#define ATOMIC_BOOL_LOCK_FREE 2
+#define ATOMIC_CHAR_LOCK_FREE 2
+#define ATOMIC_SHORT_LOCK_FREE 2
+#define ATOMIC_INT_LOCK_FREE 2
+#define ATOMIC_LONG_LOCK_FREE 2
+#define ATOMIC_LLONG_LOCK_FREE 2
+#define ATOMIC_POINTER_LOCK_FREE 2
+#define ATOMIC_FLAG_INIT 0
+#define ATOMIC_VAR_INIT(v) (v)
+#define kill_dependency(y) (y)
+
+/* operations on 32-bit and 64-bit cells */
+#define __atomic_load32(p) ((int32_t(*)(const void*))asm(i32.atomic.load offset=0 align=4)(p))
+#define __atomic_load64(p) ((int64_t(*)(const void*))asm(i64.atomic.load offset=0 align=8)(p))
+#define __atomic_store32(p, v) ((void(*)(void*, int32_t))asm(i32.atomic.store offset=0 align=4)(p, v))
+#define __atomic_store64(p, v) ((void(*)(void*, int64_t))asm(i64.atomic.store offset=0 align=8)(p, v))
+#define __atomic_xchg32(p, v) ((int32_t(*)(void*, int32_t))asm(i32.atomic.rmw.xchg offset=0 align=4)(p, v))
+#define __atomic_xchg64(p, v) ((int64_t(*)(void*, int64_t))asm(i64.atomic.rmw.xchg offset=0 align=8)(p, v))
+#define __atomic_add32(p, v) ((int32_t(*)(void*, int32_t))asm(i32.atomic.rmw.add offset=0 align=4)(p, v))
+#define __atomic_add64(p, v) ((int64_t(*)(void*, int64_t))asm(i64.atomic.rmw.add offset=0 align=8)(p, v))
+#define __atomic_sub32(p, v) ((int32_t(*)(void*, int32_t))asm(i32.atomic.rmw.sub offset=0 align=4)(p, v))
+#define __atomic_sub64(p, v) ((int64_t(*)(void*, int64_t))asm(i64.atomic.rmw.sub offset=0 align=8)(p, v))
+#define __atomic_and32(p, v) ((int32_t(*)(void*, int32_t))asm(i32.atomic.rmw.and offset=0 align=4)(p, v))
+#define __atomic_and64(p, v) ((int64_t(*)(void*, int64_t))asm(i64.atomic.rmw.and offset=0 align=8)(p, v))
+#define __atomic_or32(p, v) ((int32_t(*)(void*, int32_t))asm(i32.atomic.rmw.or offset=0 align=4)(p, v))
+#define __atomic_or64(p, v) ((int64_t(*)(void*, int64_t))asm(i64.atomic.rmw.or offset=0 align=8)(p, v))
+#define __atomic_xor32(p, v) ((int32_t(*)(void*, int32_t))asm(i32.atomic.rmw.xor offset=0 align=4)(p, v))
+#define __atomic_xor64(p, v) ((int64_t(*)(void*, int64_t))asm(i64.atomic.rmw.xor offset=0 align=8)(p, v))
+#define __atomic_fence() ((void(*)())asm(atomic.fence)())
+
+/* compare-and-exchange: update *pe with current value on failure */
+extern bool _atomic_cmpxchg32(void *p, int32_t *pe, int32_t d);
+extern bool _atomic_cmpxchg64(void *p, int64_t *pe, int64_t d);
+
+#define atomic_init(p, v) (*(p) = (v))
+#define atomic_is_lock_free(p) (true)
+#define atomic_thread_fence(o) (__atomic_fence())
+#define atomic_signal_fence(o) (__atomic_fence())
+#define atomic_load(p) (generic(*(p), \
+    unsigned long long: (unsigned long long)__atomic_load64(p), \
+             long long: __atomic_load64(p), \
+              unsigned: (unsigned)__atomic_load32(p), \
+         unsigned long: (unsigned long)__atomic_load32(p), \
+                  long: (long)__atomic_load32(p), \
+               default: __atomic_load32(p)))
+#define atomic_store(p, v) (generic(*(p), \
+    unsigned long long: __atomic_store64(p, (int64_t)(v)), \
+             long long: __atomic_store64(p, (int64_t)(v)), \
+               default: __atomic_store32(p, (int32_t)(v))))
+#define atomic_exchange(p, v) (generic(*(p), \
+    unsigned long long: (unsigned long long)__atomic_xchg64(p, (int64_t)(v)), \
+             long long: __atomic_xchg64(p, (int64_t)(v)), \
+              unsigned: (unsigned)__atomic_xchg32(p, (int32_t)(v)), \
+         unsigned long: (unsigned long)__atomic_xchg32(p, (int32_t)(v)), \
+                  long: (long)__atomic_xchg32(p, (int32_t)(v)), \
+               default: __atomic_xchg32(p, (int32_t)(v))))
+#define atomic_fetch_add(p, v) (generic(*(p), \
+    unsigned long long: (unsigned long long)__atomic_add64(p, (int64_t)(v)), \
+             long long: __atomic_add64(p, (int64_t)(v)), \
+              unsigned: (unsigned)__atomic_add32(p, (int32_t)(v)), \
+         unsigned long: (unsigned long)__atomic_add32(p, (int32_t)(v)), \
+                  long: (long)__atomic_add32(p, (int32_t)(v)), \
+               default: __atomic_add32(p, (int32_t)(v))))
+#define atomic_fetch_sub(p, v) (generic(*(p), \
+    unsigned long long: (unsigned long long)__atomic_sub64(p, (int64_t)(v)), \
+             long long: __atomic_sub64(p, (int64_t)(v)), \
+              unsigned: (unsigned)__atomic_sub32(p, (int32_t)(v)), \
+         unsigned long: (unsigned long)__atomic_sub32(p, (int32_t)(v)), \
+                  long: (long)__atomic_sub32(p, (int32_t)(v)), \
+               default: __atomic_sub32(p, (int32_t)(v))))
+#define atomic_fetch_and(p, v) (generic(*(p), \
+    unsigned long long: (unsigned long long)__atomic_and64(p, (int64_t)(v)), \
+             long long: __atomic_and64(p, (int64_t)(v)), \
+              unsigned: (unsigned)__atomic_and32(p, (int32_t)(v)), \
+         unsigned long: (unsigned long)__atomic_and32(p, (int32_t)(v)), \
+                  long: (long)__atomic_and32(p, (int32_t)(v)), \
+               default: __atomic_and32(p, (int32_t)(v))))
+#define atomic_fetch_or(p, v) (generic(*(p), \
+    unsigned long long: (unsigned long long)__atomic_or64(p, (int64_t)(v)), \
+             long long: __atomic_or64(p, (int64_t)(v)), \
+              unsigned: (unsigned)__atomic_or32(p, (int32_t)(v)), \
+         unsigned long: (unsigned long)__atomic_or32(p, (int32_t)(v)), \
+                  long: (long)__atomic_or32(p, (int32_t)(v)), \
+               default: __atomic_or32(p, (int32_t)(v))))
+#define atomic_fetch_xor(p, v) (generic(*(p), \
+    unsigned long long: (unsigned long long)__atomic_xor64(p, (int64_t)(v)), \
+             long long: __atomic_xor64(p, (int64_t)(v)), \
+              unsigned: (unsigned)__atomic_xor32(p, (int32_t)(v)), \
+         unsigned long: (unsigned long)__atomic_xor32(p, (int32_t)(v)), \
+                  long: (long)__atomic_xor32(p, (int32_t)(v)), \
+               default: __atomic_xor32(p, (int32_t)(v))))
+#define atomic_compare_exchange_strong(p, pe, d) (generic(*(p), \
+    unsigned long long: _atomic_cmpxchg64(p, (int64_t*)(pe), (int64_t)(d)), \
+             long long: _atomic_cmpxchg64(p, (int64_t*)(pe), (int64_t)(d)), \
+               default: _atomic_cmpxchg32(p, (int32_t*)(pe), (int32_t)(d))))
+#define atomic_compare_exchange_weak(p, pe, d) atomic_compare_exchange_strong(p, pe, d)
+
+#define atomic_load_explicit(p, o) atomic_load(p)
+#define atomic_store_explicit(p, v, o) atomic_store(p, v)
+#define atomic_exchange_explicit(p, v, o) atomic_exchange(p, v)
+#define atomic_fetch_add_explicit(p, v, o) atomic_fetch_add(p, v)
+#define atomic_fetch_sub_explicit(p, v, o) atomic_fetch_sub(p, v)
+#define atomic_fetch_and_explicit(p, v, o) atomic_fetch_and(p, v)
+#define atomic_fetch_or_explicit(p, v, o) atomic_fetch_or(p, v)
+#define atomic_fetch_xor_explicit(p, v, o) atomic_fetch_xor(p, v)
+#define atomic_compare_exchange_strong_explicit(p, pe, d, os, of) atomic_compare_exchange_strong(p, pe, d)
+#define atomic_compare_exchange_weak_explicit(p, pe, d, os, of) atomic_compare_exchange_strong(p, pe, d)
+
+#define atomic_flag_test_and_set(pf) (__atomic_xchg32(pf, 1) != 0)
+#define atomic_flag_clear(pf) (__atomic_store32(pf, 0))
+#define atomic_flag_test_and_set_explicit(pf, o) atomic_flag_test_and_set(pf)
+#define atomic_flag_clear_explicit(pf, o) atomic_flag_clear(pf)
@@ -84,6 +84,13 @@ extern int vfscanf(FILE *stream, const char *format, va_list arg);
 extern int vscanf(const char *format, va_list arg);
 extern int vsscanf(const char *s, const char *format, va_list arg);
 extern int vsnscanf(const char *s, size_t count, const char *format, va_list arg);
+/* non-standard: shortest decimal form of d that reads back exactly */
+extern int dtostr(char *s, size_t count, double d);
+/* non-standard: read whole file into malloc'd zero-terminated block */
+extern void *fload(const char *path, size_t *plen);
+/* non-standard: call fn on consecutive chunks of the file until it returns nonzero;
+ * returns 0 and stores fn's last result in *pres (if not NULL), or -1 and sets errno */
+extern int fmapchunks(const char *path, size_t chunksize, int (*fn)(const char *chunk, size_t len, void *ud), void *ud, int *pres);
 /* extern FILE *tmpfile(void); -- not in WASI? */
 /* extern char *tmpnam(char s[L_tmpnam]); -- not in WASI? */
 extern int int remove(const char *filename);
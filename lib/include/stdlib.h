@@ -49,3 +49,7 @@ extern size_t wcstombs(char *s, const wchar_t *pwcs, size_t n);
 
 /* internal library bailout w/message */
 extern void _panicf(const char *fmt, ...);
+
+/* internal allocator lock hooks (set by pthread_create) */
+extern void (*_malloc_lock)(void);
+extern void (*_malloc_unlock)(void);
@@ -3,9 +3,12 @@
 #pragma once
 #pragma module "crt"
 
+/* end of static data, stack and argv area, set by the linker */
+extern void *heap_base;
+
 #define ONTERM_MAX 32
 typedef void (*onterm_func_t)(void);
 extern onterm_func_t onterm_funcs[ONTERM_MAX];
-extern size_t onterm_count;
+extern size_t onterm_count[1];
 extern void terminate(int status);
 
@@ -16,3 +16,4 @@ typedef int32_t  blksize_t;
 typedef int64_t  blkcnt_t;
 typedef int64_t  time_t;
 typedef int64_t  clock_t;
+typedef uint32_t clockid_t;
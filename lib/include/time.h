@@ -8,6 +8,17 @@
 
 #define CLOCKS_PER_SEC (1000000000LL)
 
+/* clock ids are WASI clock ids */
+#define CLOCK_REALTIME 0
+#define CLOCK_MONOTONIC 1
+#define CLOCK_PROCESS_CPUTIME_ID 2
+#define CLOCK_THREAD_CPUTIME_ID 3
+
+struct timespec {
+  time_t tv_sec; /* seconds */
+  long tv_nsec;  /* nanoseconds */
+};
+
 struct tm {
   int tm_sec;   /* seconds */
   int tm_min;   /* minutes */
@@ -37,3 +48,5 @@ extern struct tm *gmtime_r(const time_t *pt, struct tm *ptm);
 extern char *ctime_r(const time_t *pt, char *buf);
 extern char *asctime_r(const struct tm *ptm, char *buf);
 extern struct tm *localtime_r(const time_t *pt, struct tm *ptm);
+extern int clock_gettime(clockid_t clk, struct timespec *ts);
+extern int clock_getres(clockid_t clk, struct timespec *ts);
@@ -12,8 +12,16 @@
 #define W_OK (2)
 #define R_OK (4)
 
+/* scatter/gather vector (same layout as WASI iovec_t/ciovec_t) */
+struct iovec {
+  void *iov_base; /* start of the memory region */
+  size_t iov_len; /* length of the memory region */
+};
+
 extern ssize_t read(int fd, void *buf, size_t n);
 extern ssize_t write(int fd, const void *buf, size_t n);
+extern ssize_t readv(int fd, const struct iovec *iov, int iovcnt);
+extern ssize_t writev(int fd, const struct iovec *iov, int iovcnt);
 extern ssize_t pread(int fd, void *buf, size_t nbyte, off_t offset);
 extern ssize_t pwrite(int fd, const void *buf, size_t nbyte, off_t offset);
 extern off_t lseek(int fd, off_t offset, int whence);
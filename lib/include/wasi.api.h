@@ -12,8 +12,8 @@ typedef uint64_t filesize_t;
 /* Timestamp in nanoseconds. */
 typedef uint64_t timestamp_t;
 
-/* Identifiers for clocks. */
-typedef uint32_t clockid_t;
+/* Identifiers for clocks (clockid_t is shared with time.h). */
+#include <sys/types.h>
 /* The clock measuring real time. Time value zero corresponds with
  * 1970-01-01T00:00:00Z. */
 #define CLOCKID_REALTIME 0U
@@ -189,13 +189,13 @@ typedef uint64_t rights_t;
 typedef int32_t fd_t;
 
 /* A region of memory for scatter/gather reads. */
-typedef struct iovec {
+typedef struct iovec_tag {
   uint8_t *buf; /* The address of the buffer to be filled. */
   size_t buf_len; /* The length of the buffer to be filled. */
 } iovec_t;
 
 /* A region of memory for scatter/gather writes. */
-typedef struct ciovec {
+typedef struct ciovec_tag {
   const uint8_t *buf; /* The address of the buffer to be written. */
   size_t buf_len; /* The length of the buffer to be written. */
 } ciovec_t;
@@ -0,0 +1,11 @@
+/* WASI threads: https://github.com/WebAssembly/wasi-threads */
+
+#pragma module "wasi"
+#pragma once
+
+/* Start a new thread: the host creates a new instance of the module
+ * sharing its memory and calls its exported wasi_thread_start(tid, arg).
+ * Returns the new thread's id (a positive number) or a negative number
+ * on failure. Imported as "wasi" "thread-spawn"; modules using it must
+ * be linked with --shared-memory. */
+extern int thread_spawn(void *arg);
@@ -507,3 +507,72 @@
 
 /* void wasm_memory_copy(void *d, void *s, int32_t n); */
 #define wasm_memory_copy(d, s, n) ((void(*)(void*, void*, int32_t))asm(memory.copy)(d, s, n))
+
+
+/* threads (shared memory) atomics; p must be naturally aligned */
+
+/* int32_t wasm_i32_atomic_load(const void *p); */
+#define wasm_i32_atomic_load(p) ((int32_t(*)(const void*))asm(i32.atomic.load offset=0 align=4)(p))
+
+/* int64_t wasm_i64_atomic_load(const void *p); */
+#define wasm_i64_atomic_load(p) ((int64_t(*)(const void*))asm(i64.atomic.load offset=0 align=8)(p))
+
+/* void wasm_i32_atomic_store(void *p, int32_t a); */
+#define wasm_i32_atomic_store(p, a) ((void(*)(void*, int32_t))asm(i32.atomic.store offset=0 align=4)(p, a))
+
+/* void wasm_i64_atomic_store(void *p, int64_t a); */
+#define wasm_i64_atomic_store(p, a) ((void(*)(void*, int64_t))asm(i64.atomic.store offset=0 align=8)(p, a))
+
+/* int32_t wasm_i32_atomic_rmw_add(void *p, int32_t a); */
+#define wasm_i32_atomic_rmw_add(p, a) ((int32_t(*)(void*, int32_t))asm(i32.atomic.rmw.add offset=0 align=4)(p, a))
+
+/* int64_t wasm_i64_atomic_rmw_add(void *p, int64_t a); */
+#define wasm_i64_atomic_rmw_add(p, a) ((int64_t(*)(void*, int64_t))asm(i64.atomic.rmw.add offset=0 align=8)(p, a))
+
+/* int32_t wasm_i32_atomic_rmw_sub(void *p, int32_t a); */
+#define wasm_i32_atomic_rmw_sub(p, a) ((int32_t(*)(void*, int32_t))asm(i32.atomic.rmw.sub offset=0 align=4)(p, a))
+
+/* int64_t wasm_i64_atomic_rmw_sub(void *p, int64_t a); */
+#define wasm_i64_atomic_rmw_sub(p, a) ((int64_t(*)(void*, int64_t))asm(i64.atomic.rmw.sub offset=0 align=8)(p, a))
+
+/* int32_t wasm_i32_atomic_rmw_and(void *p, int32_t a); */
+#define wasm_i32_atomic_rmw_and(p, a) ((int32_t(*)(void*, int32_t))asm(i32.atomic.rmw.and offset=0 align=4)(p, a))
+
+/* int64_t wasm_i64_atomic_rmw_and(void *p, int64_t a); */
+#define wasm_i64_atomic_rmw_and(p, a) ((int64_t(*)(void*, int64_t))asm(i64.atomic.rmw.and offset=0 align=8)(p, a))
+
+/* int32_t wasm_i32_atomic_rmw_or(void *p, int32_t a); */
+#define wasm_i32_atomic_rmw_or(p, a) ((int32_t(*)(void*, int32_t))asm(i32.atomic.rmw.or offset=0 align=4)(p, a))
+
+/* int64_t wasm_i64_atomic_rmw_or(void *p, int64_t a); */
+#define wasm_i64_atomic_rmw_or(p, a) ((int64_t(*)(void*, int64_t))asm(i64.atomic.rmw.or offset=0 align=8)(p, a))
+
+/* int32_t wasm_i32_atomic_rmw_xor(void *p, int32_t a); */
+#define wasm_i32_atomic_rmw_xor(p, a) ((int32_t(*)(void*, int32_t))asm(i32.atomic.rmw.xor offset=0 align=4)(p, a))
+
+/* int64_t wasm_i64_atomic_rmw_xor(void *p, int64_t a); */
+#define wasm_i64_atomic_rmw_xor(p, a) ((int64_t(*)(void*, int64_t))asm(i64.atomic.rmw.xor offset=0 align=8)(p, a))
+
+/* int32_t wasm_i32_atomic_rmw_xchg(void *p, int32_t a); */
+#define wasm_i32_atomic_rmw_xchg(p, a) ((int32_t(*)(void*, int32_t))asm(i32.atomic.rmw.xchg offset=0 align=4)(p, a))
+
+/* int64_t wasm_i64_atomic_rmw_xchg(void *p, int64_t a); */
+#define wasm_i64_atomic_rmw_xchg(p, a) ((int64_t(*)(void*, int64_t))asm(i64.atomic.rmw.xchg offset=0 align=8)(p, a))
+
+/* int32_t wasm_i32_atomic_rmw_cmpxchg(void *p, int32_t e, int32_t r); */
+#define wasm_i32_atomic_rmw_cmpxchg(p, e, r) ((int32_t(*)(void*, int32_t, int32_t))asm(i32.atomic.rmw.cmpxchg offset=0 align=4)(p, e, r))
+
+/* int64_t wasm_i64_atomic_rmw_cmpxchg(void *p, int64_t e, int64_t r); */
+#define wasm_i64_atomic_rmw_cmpxchg(p, e, r) ((int64_t(*)(void*, int64_t, int64_t))asm(i64.atomic.rmw.cmpxchg offset=0 align=8)(p, e, r))
+
+/* int32_t wasm_memory_atomic_wait32(void *p, int32_t e, int64_t ns); */
+#define wasm_memory_atomic_wait32(p, e, ns) ((int32_t(*)(void*, int32_t, int64_t))asm(memory.atomic.wait32 offset=0 align=4)(p, e, ns))
+
+/* int32_t wasm_memory_atomic_wait64(void *p, int64_t e, int64_t ns); */
+#define wasm_memory_atomic_wait64(p, e, ns) ((int32_t(*)(void*, int64_t, int64_t))asm(memory.atomic.wait64 offset=0 align=8)(p, e, ns))
+
+/* int32_t wasm_memory_atomic_notify(void *p, int32_t n); */
+#define wasm_memory_atomic_notify(p, n) ((int32_t(*)(void*, int32_t))asm(memory.atomic.notify offset=0 align=4)(p, n))
+
+/* void wasm_atomic_fence(); */
+#define wasm_atomic_fence() ((void(*)())asm(atomic.fence)())
@@ -918,3 +918,33 @@
 
 /* v128_t wasm_i16x8_q15mulr_sat(v128_t a, v128_t b); */
 #define wasm_i16x8_q15mulr_sat(a, b) ((v128_t(*)(v128_t, v128_t))asm(i16x8.q15mulr_sat_s)(a, b))
+
+
+/* vector math: library functions from the wasm_simd128 module; results
+ * are within a few ulps of the scalar math functions; if any lane is out
+ * of the range handled by the vector code (large, tiny, inf, nan), the
+ * whole vector is computed lane by lane via the scalar functions */
+
+/* v128_t wasm_f64x2_exp(v128_t a); */
+extern v128_t wasm_f64x2_exp(v128_t a);
+
+/* v128_t wasm_f64x2_log(v128_t a); */
+extern v128_t wasm_f64x2_log(v128_t a);
+
+/* v128_t wasm_f64x2_sin(v128_t a); */
+extern v128_t wasm_f64x2_sin(v128_t a);
+
+/* v128_t wasm_f64x2_cos(v128_t a); */
+extern v128_t wasm_f64x2_cos(v128_t a);
+
+/* v128_t wasm_f32x4_exp(v128_t a); */
+extern v128_t wasm_f32x4_exp(v128_t a);
+
+/* v128_t wasm_f32x4_log(v128_t a); */
+extern v128_t wasm_f32x4_log(v128_t a);
+
+/* v128_t wasm_f32x4_sin(v128_t a); */
+extern v128_t wasm_f32x4_sin(v128_t a);
+
+/* v128_t wasm_f32x4_cos(v128_t a); */
+extern v128_t wasm_f32x4_cos(v128_t a);
@@ -10,12 +10,12 @@ void initialize(void)
 }
 
 onterm_func_t onterm_funcs[ONTERM_MAX];
-size_t onterm_count = 0;
+size_t onterm_count[1]; /* in memory, so it is shared by threads */
 
 void terminate(int status)
 {
-  while (onterm_count > 0) {
-    onterm_func_t fn = onterm_funcs[--onterm_count];
+  while (onterm_count[0] > 0) {
+    onterm_func_t fn = onterm_funcs[--onterm_count[0]];
     (*fn)();
   }
   proc_exit((exitcode_t)status);
@@ -1,4 +1,6 @@
 #include <wasi/api.h>
+#include <stdbool.h>
+#include <limits.h>
 #include <string.h>
 #include <stdlib.h>
 #include <assert.h>
@@ -6,6 +8,8 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <dirent.h>
+#include <sys/stat.h>
+#include <ftw.h>
 
 static_assert(DT_BLK == FILETYPE_BLOCK_DEVICE);
 static_assert(DT_CHR == FILETYPE_CHARACTER_DEVICE);
@@ -15,17 +19,25 @@ static_assert(DT_LNK == FILETYPE_SYMBOLIC_LINK);
 static_assert(DT_REG == FILETYPE_REGULAR_FILE);
 static_assert(DT_UNKNOWN == FILETYPE_UNKNOWN);
 
+/* fd_readdir batches start small and double each time a batch fills the
+ * buffer (i.e. more entries remain), so big directories take few host calls */
 #define DIRENT_DEFAULT_BUFFER_SIZE 4096
+#define DIRENT_MAX_BUFFER_SIZE (256*1024)
 
 struct _DIR {
   int fd;
-  dircookie_t cookie;
+  dircookie_t cookie;        /* cookie of the next entry */
+  dircookie_t buffer_cookie; /* cookie of the first entry in the buffer */
+  bool buffer_stale;         /* buffer should be refilled from cookie */
   char *buffer;
   size_t buffer_processed;
   size_t buffer_size;
   size_t buffer_used;
   struct dirent *dirent;
   size_t dirent_size;
+  dircookie_t *locs;         /* telldir cookies that do not fit in a long */
+  size_t locs_size;
+  size_t locs_used;
 };
 
 DIR *fdopendir(int fd) 
@@ -47,11 +59,15 @@ DIR *fdopendir(int fd)
     return NULL;
   }
   dirp->fd = fd;
-  dirp->cookie = DIRCOOKIE_START;
+  dirp->cookie = dirp->buffer_cookie = DIRCOOKIE_START;
+  dirp->buffer_stale = false;
   dirp->buffer_processed = 0;
   dirp->buffer_size = DIRENT_DEFAULT_BUFFER_SIZE;
   dirp->dirent = NULL;
   dirp->dirent_size = 1;
+  dirp->locs = NULL;
+  dirp->locs_size = 1;
+  dirp->locs_used = 0;
   return dirp;
 }
 
@@ -60,6 +76,7 @@ int fdclosedir(DIR *dirp)
   int fd = dirp->fd;
   free(dirp->buffer);
   free(dirp->dirent);
+  free(dirp->locs);
   free(dirp);
   return fd;
 }
@@ -101,8 +118,10 @@ int closedir(DIR *dirp)
       while (new_size < (target_size))              \
         new_size *= 2;                              \
       void *new_buffer = realloc(buffer, new_size); \
-      if (new_buffer == NULL)                       \
+      if (new_buffer == NULL) {                     \
+        errno = ENOMEM;                             \
         return NULL;                                \
+      }                                             \
       (buffer) = new_buffer;                        \
       (buffer_size) = new_size;                     \
     }                                               \
@@ -111,9 +130,14 @@ int closedir(DIR *dirp)
 struct dirent *readdir(DIR *dirp) 
 {
   for (;;) {
-    { size_t buffer_left = dirp->buffer_used - dirp->buffer_processed;
+    if (!dirp->buffer_stale) {
+      size_t buffer_left = dirp->buffer_used - dirp->buffer_processed;
       if (buffer_left < sizeof(dirent_t)) {
         if (dirp->buffer_used < dirp->buffer_size) return NULL;
+        /* full buffer: there is more, so read a bigger batch */
+        if (dirp->buffer_size < DIRENT_MAX_BUFFER_SIZE) {
+          GROW(dirp->buffer, dirp->buffer_size, dirp->buffer_size * 2);
+        }
         goto read_entries;
       }
       dirent_t entry;
@@ -126,7 +150,10 @@ struct dirent *readdir(DIR *dirp)
       }
 
       if (buffer_left < entry_size) {
-        GROW(dirp->buffer, dirp->buffer_size, entry_size);
+        /* truncated entry: the buffer was full, so read a bigger batch */
+        size_t size = dirp->buffer_size;
+        if (size < DIRENT_MAX_BUFFER_SIZE) size *= 2;
+        GROW(dirp->buffer, dirp->buffer_size, entry_size > size ? entry_size : size);
         goto read_entries;
       }
 
@@ -149,10 +176,13 @@ struct dirent *readdir(DIR *dirp)
       read_entries:;
     }
     dirp->buffer_used = dirp->buffer_processed = dirp->buffer_size;
+    dirp->buffer_cookie = dirp->cookie;
+    dirp->buffer_stale = false;
     errno_t error = fd_readdir(dirp->fd, (uint8_t *)dirp->buffer, 
       dirp->buffer_size, dirp->cookie, &dirp->buffer_used);
     if (error != 0) {
       errno = (int)error;
+      dirp->buffer_stale = true;
       break;
     }
     dirp->buffer_processed = 0;
@@ -160,125 +190,117 @@ struct dirent *readdir(DIR *dirp)
   return NULL;
 }
 
+/* move to the entry with the given cookie if it is in the buffer, so that
+ * seeking back (e.g. to a telldir position) does not re-read the directory */
+static bool seekbuf(DIR *dirp, dircookie_t cookie)
+{
+  size_t pos = 0; dircookie_t c = dirp->buffer_cookie;
+  if (dirp->buffer_stale) return false;
+  while (c != cookie) {
+    dirent_t entry;
+    if (dirp->buffer_used - pos < sizeof(dirent_t)) return false;
+    memcpy(&entry, dirp->buffer + pos, sizeof(dirent_t));
+    if (dirp->buffer_used - pos < sizeof(dirent_t) + entry.d_namlen) return false;
+    pos += sizeof(dirent_t) + entry.d_namlen;
+    c = entry.d_next;
+  }
+  dirp->buffer_processed = pos;
+  dirp->cookie = cookie;
+  return true;
+}
+
 void rewinddir(DIR *dirp) 
 {
-  dirp->cookie = DIRCOOKIE_START;
-  dirp->buffer_used = dirp->buffer_processed = dirp->buffer_size;
+  if (!seekbuf(dirp, DIRCOOKIE_START)) {
+    dirp->cookie = DIRCOOKIE_START;
+    dirp->buffer_stale = true;
+  }
 }
 
 void seekdir(DIR *dirp, long loc) 
 {
-  dirp->cookie = (unsigned long)loc;
-  dirp->buffer_used = dirp->buffer_processed = dirp->buffer_size;
+  dircookie_t cookie = (unsigned long)loc;
+  if (loc < -1 && (size_t)(-2 - loc) < dirp->locs_used) 
+    cookie = dirp->locs[-2 - loc];
+  if (!seekbuf(dirp, cookie)) {
+    dirp->cookie = cookie;
+    dirp->buffer_stale = true;
+  }
 }
 
-long telldir(DIR *dirp) 
+/* hosts may use 64-bit hashes as cookies; the ones that do not fit in
+ * a non-negative long are remembered and returned as -2-index */
+static long tellloc(DIR *dirp)
 {
-  return (long)dirp->cookie;
+  size_t n = dirp->locs_used;
+  if (n > 0 && dirp->locs[n-1] == dirp->cookie) return -1 - (long)n;
+  if (dirp->locs == NULL || n == dirp->locs_size) {
+    size_t size = dirp->locs == NULL ? 16 : n * 2;
+    dircookie_t *locs = realloc(dirp->locs, size * sizeof(dircookie_t));
+    if (locs == NULL) {
+      errno = ENOMEM;
+      return -1;
+    }
+    dirp->locs = locs;
+    dirp->locs_size = size;
+  }
+  dirp->locs[n] = dirp->cookie;
+  dirp->locs_used = n + 1;
+  return -2 - (long)n;
 }
 
-
-static int sel_true(const struct dirent *de) 
+long telldir(DIR *dirp) 
 {
-  return 1;
+  if (dirp->cookie > (dircookie_t)LONG_MAX) return tellloc(dirp);
+  return (long)dirp->cookie;
 }
 
 int scandirat(int dirfd, const char *dir, struct dirent ***namelist,
   int (*sel)(const struct dirent *),
   int (*compar)(const struct dirent **, const struct dirent **)) 
 {
-  if (sel == NULL) sel = &sel_true;
-  int fd = openat(dirfd, dir, O_RDONLY|O_NONBLOCK|O_DIRECTORY);
-  if (fd == -1) return -1;
-
-  size_t buffer_size = DIRENT_DEFAULT_BUFFER_SIZE;
-  char *buffer = malloc(buffer_size);
-  if (buffer == NULL) {
-    close(fd);
-    return -1;
-  }
-  
-  { size_t buffer_processed = buffer_size;
-    size_t buffer_used = buffer_size;
-    struct dirent **dirents = NULL;
-    size_t dirents_size = 0;
-    size_t dirents_used = 0;
-    dircookie_t cookie = DIRCOOKIE_START;
-    
-    for (;;) {
-      { size_t buffer_left = buffer_used - buffer_processed;
-        if (buffer_left < sizeof(dirent_t)) {
-          if (buffer_used < buffer_size) break;
-          goto read_entries;
-        }
-
-        dirent_t entry;
-        memcpy(&entry, buffer + buffer_processed, sizeof(dirent_t));
-        size_t entry_size = sizeof(dirent_t) + entry.d_namlen;
-        if (entry.d_namlen == 0) {
-          buffer_processed += entry_size;
-          continue;
-        }
-
-        if (buffer_left < entry_size) {
-          while (buffer_size < entry_size) buffer_size *= 2;
-          char *new_buffer = realloc(buffer, buffer_size);
-          if (new_buffer == NULL) goto bad;
-          buffer = new_buffer;
-          goto read_entries;
-        }
-
-        const char *name = buffer + buffer_processed + sizeof(dirent_t);
-        buffer_processed += entry_size;
-        if (memchr(name, '\0', entry.d_namlen) != NULL) continue;
-
-        struct dirent *dirent = malloc(offsetof(struct dirent, d_name) + entry.d_namlen + 1);
-        if (dirent == NULL) goto bad;
-        dirent->d_ino = entry.d_ino;
-        dirent->d_type = entry.d_type;
-        memcpy(&dirent->d_name[0], name, entry.d_namlen);
-        dirent->d_name[entry.d_namlen] = '\0';
-        cookie = entry.d_next;
-
-        if ((*sel)(dirent)) {
-          if (dirents_used == dirents_size) {
-            dirents_size = dirents_size < 8 ? 8 : dirents_size * 2;
-            struct dirent **new_dirents = realloc(dirents, dirents_size * sizeof(struct dirent *));
-            if (new_dirents == NULL) {
-              free(dirent);
-              goto bad;
-            }
-            dirents = new_dirents;
-          }
-          dirents[dirents_used++] = dirent;
-        } else {
-          free(dirent);
+  struct dirent **dirents = NULL, *dirent;
+  size_t dirents_size = 0, dirents_used = 0, i;
+  int olderrno = errno;
+  DIR *dirp = opendirat(dirfd, dir);
+  if (dirp == NULL) return -1;
+
+  { /* collect entries in large readdir batches, sort once at the end */
+    errno = 0;
+    while ((dirent = readdir(dirp)) != NULL) {
+      if (sel != NULL && !(*sel)(dirent)) continue;
+      size_t size = offsetof(struct dirent, d_name) + strlen(&dirent->d_name[0]) + 1;
+      struct dirent *copy = malloc(size);
+      if (copy == NULL) goto bad;
+      memcpy(copy, dirent, size);
+      if (dirents_used == dirents_size) {
+        dirents_size = dirents_size < 8 ? 8 : dirents_size * 2;
+        struct dirent **new_dirents = realloc(dirents, dirents_size * sizeof(struct dirent *));
+        if (new_dirents == NULL) {
+          free(copy);
+          goto bad;
         }
-        continue;
-        read_entries:;
-      }
-      errno_t error = fd_readdir(fd, (uint8_t*)buffer, buffer_size, cookie, &buffer_used);
-      if (error != 0) {
-        errno = (int)error;
-        goto bad;
+        dirents = new_dirents;
       }
-      buffer_processed = 0;
+      dirents[dirents_used++] = copy;
     }
+    if (errno != 0) goto bad;
+    errno = olderrno;
 
-    free(buffer);
-    close(fd);
-    qsort(dirents, dirents_used, sizeof(struct dirent *), (int (*)(const void *, const void *))compar);
+    closedir(dirp);
+    if (compar != NULL) {
+      qsort(dirents, dirents_used, sizeof(struct dirent *), (int (*)(const void *, const void *))compar);
+    }
     *namelist = dirents;
     return (int)dirents_used;
 
-    bad:; 
+    bad:;
   }
 
-  size_t i;
+  if (errno == 0) errno = ENOMEM;
   for (i = 0; i < dirents_used; ++i) free(dirents[i]);
   free(dirents);
-  free(buffer);
-  close(fd);
+  closedir(dirp);
   return -1;
 }
 
@@ -299,3 +321,83 @@ int alphasort (const struct dirent **a, const struct dirent **b)
 {
   return strcoll(&(*a)->d_name[0], &(*b)->d_name[0]);
 }
+
+
+/* file tree walk */
+
+typedef struct walk {
+  char *path;
+  size_t path_size;
+  dev_t dev;
+  int flags;
+  int (*fn)(const char *, const struct stat *, int, struct FTW *);
+} walk_t;
+
+static int sel_nodots(const struct dirent *de)
+{
+  const char *name = &de->d_name[0];
+  return !(name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0)));
+}
+
+/* walk the tree at pw->path[0..len), the file name starts at base */
+static int walk_path(walk_t *pw, size_t len, int base, int level)
+{
+  struct stat st; struct FTW ftw; struct dirent **names = NULL;
+  int type, n = 0, i, res = 0;
+  if (((pw->flags & FTW_PHYS) ? lstat(pw->path, &st) : stat(pw->path, &st)) != 0) {
+    if (!(pw->flags & FTW_PHYS) && lstat(pw->path, &st) == 0 && S_ISLNK(st.st_mode)) type = FTW_SLN;
+    else type = FTW_NS;
+  } else if (S_ISDIR(st.st_mode)) type = FTW_D;
+  else if (S_ISLNK(st.st_mode)) type = FTW_SL;
+  else type = FTW_F;
+  if ((pw->flags & FTW_MOUNT) && type != FTW_NS) {
+    if (level == 0) pw->dev = st.st_dev;
+    else if (st.st_dev != pw->dev) return 0;
+  }
+  ftw.base = base; ftw.level = level;
+  if (type != FTW_D) return (*pw->fn)(pw->path, &st, type, &ftw);
+  n = scandir(pw->path, &names, &sel_nodots, NULL);
+  if (n < 0) return (*pw->fn)(pw->path, &st, FTW_DNR, &ftw);
+  if (!(pw->flags & FTW_DEPTH)) res = (*pw->fn)(pw->path, &st, FTW_D, &ftw);
+  for (i = 0; i < n; ++i) {
+    if (res == 0) {
+      const char *name = &names[i]->d_name[0];
+      size_t sublen = len, namelen = strlen(name);
+      if (sublen > 0 && pw->path[sublen-1] != '/') pw->path[sublen++] = '/';
+      if (sublen + namelen + 1 > pw->path_size) {
+        size_t size = pw->path_size * 2 > sublen + namelen + 1 ? pw->path_size * 2 : sublen + namelen + 1;
+        char *path = realloc(pw->path, size);
+        if (path == NULL) { errno = ENOMEM; res = -1; }
+        else { pw->path = path; pw->path_size = size; }
+      }
+      if (res == 0) {
+        memcpy(pw->path + sublen, name, namelen + 1);
+        res = walk_path(pw, sublen + namelen, (int)sublen, level + 1);
+        pw->path[len] = 0;
+      }
+    }
+    free(names[i]);
+  }
+  free(names);
+  if (res == 0 && (pw->flags & FTW_DEPTH)) res = (*pw->fn)(pw->path, &st, FTW_DP, &ftw);
+  return res;
+}
+
+int nftw(const char *path, 
+  int (*fn)(const char *, const struct stat *, int, struct FTW *), 
+  int fdlimit, int flags)
+{
+  walk_t w; size_t len = strlen(path); int base, res;
+  w.path_size = len + 256;
+  w.path = malloc(w.path_size);
+  if (w.path == NULL) {
+    errno = ENOMEM;
+    return -1;
+  }
+  memcpy(w.path, path, len + 1);
+  for (base = (int)len; base > 0 && path[base-1] != '/'; --base) ;
+  w.dev = 0; w.flags = flags; w.fn = fn;
+  res = walk_path(&w, len, base, 0);
+  free(w.path);
+  return res;
+}
@@ -2279,6 +2279,104 @@ static double ieee754_tanh(double x)
 }
 
 
+/* single-precision functions: float arguments are exact as doubles,
+ * so short double-precision kernels give float results within an ulp
+ * at a fraction of the cost of the full double algorithms */
+
+#define f32_32oln2 (_ullasd(0x40471547652B82FEULL)) /* 32/ln2 */
+#define f32_ln2o32 (_ullasd(0x3F962E42FEFA39EFULL)) /* ln2/32 */
+#define f32_shift  (_ullasd(0x4338000000000000ULL)) /* 0x1.8p52 */
+#define f32_sqrt1_2 0x3FE6A09E667F3BCDULL /* bits of sqrt(2)/2 */
+static const double exp2_32[] = { /* 2^(i/32), i = 0..31 */
+  (_ullasd(0x3FF0000000000000ULL)), (_ullasd(0x3FF059B0D3158574ULL)),
+  (_ullasd(0x3FF0B5586CF9890FULL)), (_ullasd(0x3FF11301D0125B51ULL)),
+  (_ullasd(0x3FF172B83C7D517BULL)), (_ullasd(0x3FF1D4873168B9AAULL)),
+  (_ullasd(0x3FF2387A6E756238ULL)), (_ullasd(0x3FF29E9DF51FDEE1ULL)),
+  (_ullasd(0x3FF306FE0A31B715ULL)), (_ullasd(0x3FF371A7373AA9CBULL)),
+  (_ullasd(0x3FF3DEA64C123422ULL)), (_ullasd(0x3FF44E086061892DULL)),
+  (_ullasd(0x3FF4BFDAD5362A27ULL)), (_ullasd(0x3FF5342B569D4F82ULL)),
+  (_ullasd(0x3FF5AB07DD485429ULL)), (_ullasd(0x3FF6247EB03A5585ULL)),
+  (_ullasd(0x3FF6A09E667F3BCDULL)), (_ullasd(0x3FF71F75E8EC5F74ULL)),
+  (_ullasd(0x3FF7A11473EB0187ULL)), (_ullasd(0x3FF82589994CCE13ULL)),
+  (_ullasd(0x3FF8ACE5422AA0DBULL)), (_ullasd(0x3FF93737B0CDC5E5ULL)),
+  (_ullasd(0x3FF9C49182A3F090ULL)), (_ullasd(0x3FFA5503B23E255DULL)),
+  (_ullasd(0x3FFAE89F995AD3ADULL)), (_ullasd(0x3FFB7F76F2FB5E47ULL)),
+  (_ullasd(0x3FFC199BDD85529CULL)), (_ullasd(0x3FFCB720DCEF9069ULL)),
+  (_ullasd(0x3FFD5818DCFBA487ULL)), (_ullasd(0x3FFDFC97337B9B5FULL)),
+  (_ullasd(0x3FFEA4AFA2A490DAULL)), (_ullasd(0x3FFF50765B6E4540ULL))
+};
+
+/* poly coefs for log(1+f) = 2s + s*z*(L3f+z*(L5f+...)), s = f/(2+f), z = s*s */
+#define L3f       (_ullasd(0x3FE5555555555555ULL))   /* 2/3 */
+#define L5f       (_ullasd(0x3FD999999999999AULL))   /* 2/5 */
+#define L7f       (_ullasd(0x3FD2492492492492ULL))   /* 2/7 */
+#define L9f       (_ullasd(0x3FCC71C71C71C71CULL))   /* 2/9 */
+#define L11f      (_ullasd(0x3FC745D1745D1746ULL))   /* 2/11 */
+#define L13f      (_ullasd(0x3FC3B13B13B13B14ULL))   /* 2/13 */
+/* |sin(x)/x - poly| < 2^-37, |cos(x) - poly| < 2^-33 for |x| <= pi/4 */
+#define SF1       (_ullasd(0xBFC5555554CBAC77ULL))   /* -0.166666666416265235595 */
+#define SF2       (_ullasd(0x3F811110896EFBB2ULL))   /*  0.0083333293858894631756 */
+#define SF3       (_ullasd(0xBF2A00F9E2CAE774ULL))   /* -0.000198393348360966317347 */
+#define SF4       (_ullasd(0x3EC6CD878C3B46A7ULL))   /*  0.0000027183114939898219064 */
+#define CF0       (_ullasd(0xBFDFFFFFFD0C5E81ULL))   /* -0.499999997251031003120 */
+#define CF1       (_ullasd(0x3FA55553E1053A42ULL))   /*  0.0416666233237390631894 */
+#define CF2       (_ullasd(0xBF56C087E80F1E27ULL))   /* -0.00138867637746099294692 */
+#define CF3       (_ullasd(0x3EF99342E0EE5069ULL))   /*  0.0000243904487962774090654 */
+#define pio2_25   (_ullasd(0x3FF921FB50000000ULL))   /*  first 25 bits of pi/2 */
+#define pio2_25t  (_ullasd(0x3E5110B4611A6263ULL))   /*  pi/2 - pio2_25 */
+
+/* exp(x) for |x| < 700; relative error < 2^-39 */
+static double f32_exp(double x)
+{
+  double z = x * f32_32oln2, kd = z + f32_shift, r, s;
+  uint64_t ki = _dasull(kd);
+  kd -= f32_shift;
+  r = (z - kd) * f32_ln2o32; /* |r| <= ln2/64 */
+  /* s = 2^(k/32) */
+  s = _ullasd(_dasull(exp2_32[(int)(ki & 31)]) + ((ki >> 5) << 52));
+  return s * (one + r * (one + r * (half + r * (_ullasd(0x3FC5555555555555ULL) /* 1/6 */ 
+             + r * _ullasd(0x3FA5555555555555ULL) /* 1/24 */))));
+}
+
+/* log(x) for positive normal x; relative error < 2^-39 */
+static double f32_log(double x)
+{
+  uint64_t ix = _dasull(x), tmp = ix - f32_sqrt1_2;
+  int k = (int)((int64_t)tmp >> 52); /* x = 2^k * m, m in [sqrt(2)/2, sqrt(2)) */
+  double f = _ullasd(ix - ((uint64_t)k << 52)) - one;
+  double s = f / (two + f), z = s * s;
+  double r = z * (L3f + z * (L5f + z * (L7f + z * (L9f + z * (L11f + z * L13f)))));
+  return (double)k * lg2 + (s + s) + s * r;
+}
+
+/* sin(x) and cos(x) for |x| <= pi/4 */
+static double f32_sin(double x)
+{
+  double z = x * x, w = z * z, r = SF3 + z * SF4, s = z * x;
+  return (x + s * (SF1 + z * SF2)) + s * w * r;
+}
+
+static double f32_cos(double x)
+{
+  double z = x * x, w = z * z, r = CF2 + z * CF3;
+  return ((one + z * CF0) + w * CF1) + (w * z) * r;
+}
+
+/* returns n such that x = n*pi/2 + y, |y| <= pi/4 */
+static int32_t f32_rem_pio2(float x, double *py)
+{
+  double dx = x, fn, y[2]; int32_t n;
+  if (fabsf(x) < 4.2165626e8f) { /* |x| ~< 2^28*(pi/2) */
+    fn = nearbyint(dx * invpio2);
+    *py = (dx - fn * pio2_25) - fn * pio2_25t;
+    return (int32_t)fn;
+  }
+  n = ieee754_rem_pio2(dx, y); /* large, inf or NaN */
+  *py = y[0] + y[1];
+  return n;
+}
+
+
 /* public entries: follow IEEE semantics */
 
 double ceil(double x)
@@ -2452,3 +2550,113 @@ double tanh(double x)
   return ieee754_tanh(x);
 }
 
+
+float sqrtf(float x)
+{
+  return (float)asm(local.get x, f32.sqrt);
+}
+
+float fabsf(float x)
+{
+  return (float)asm(local.get x, f32.abs);
+}
+
+float ceilf(float x)
+{
+  return (float)asm(local.get x, f32.ceil);
+}
+
+float floorf(float x)
+{
+  return (float)asm(local.get x, f32.floor);
+}
+
+float truncf(float x)
+{
+  return (float)asm(local.get x, f32.trunc);
+}
+
+float nearbyintf(float x)
+{
+  return (float)asm(local.get x, f32.nearest);
+}
+
+float copysignf(float x, float y)
+{
+  return (float)asm(local.get x, local.get y, f32.copysign);
+}
+
+float fmaxf(float x, float y)
+{
+  if (isnan(x)) return y;
+  if (isnan(y)) return x;
+  return (float)asm(local.get x, local.get y, f32.max);
+}
+
+float fminf(float x, float y)
+{
+  if (isnan(x)) return y;
+  if (isnan(y)) return x;
+  return (float)asm(local.get x, local.get y, f32.min);
+}
+
+float sinf(float x)
+{
+  double y; int32_t n;
+  if (fabsf(x) < 2.44140625e-4f) return x; /* |x| < 2^-12, also keeps -0 */
+  if (fabsf(x) <= 0.785398163f) return (float)f32_sin(x);
+  n = f32_rem_pio2(x, &y);
+  switch (n & 3) {
+    case 0:  return (float)f32_sin(y);
+    case 1:  return (float)f32_cos(y);
+    case 2:  return (float)-f32_sin(y);
+    default: return (float)-f32_cos(y);
+  }
+  return 0.0f; /* to silence WCPL */
+}
+
+float cosf(float x)
+{
+  double y; int32_t n;
+  if (fabsf(x) <= 0.785398163f) return (float)f32_cos(x);
+  n = f32_rem_pio2(x, &y);
+  switch (n & 3) {
+    case 0:  return (float)f32_cos(y);
+    case 1:  return (float)-f32_sin(y);
+    case 2:  return (float)-f32_cos(y);
+    default: return (float)f32_sin(y);
+  }
+  return 0.0f; /* to silence WCPL */
+}
+
+float expf(float x)
+{
+  if (x > 89.0f) return (float)HUGE_VAL;
+  if (x < -104.0f) return 0.0f;
+  return (float)f32_exp(x); /* NaN stays NaN */
+}
+
+float logf(float x)
+{
+  if (x > 0.0f && x < (float)HUGE_VAL) return (float)f32_log(x);
+  if (x == 0.0f) return (float)-HUGE_VAL;
+  if (x < 0.0f) return (float)__builtin_nan("");
+  return x; /* +inf or NaN */
+}
+
+float powf(float x, float y)
+{
+  double t; int neg = 0;
+  if (fabsf(x) < (float)HUGE_VAL && fabsf(y) < (float)HUGE_VAL && x != 0.0f) {
+    if (x < 0.0f) { /* ok for integer y only */
+      if (truncf(y) != y) return (float)__builtin_nan("");
+      neg = fabsf(y) < 16777216.0f && ((int32_t)y & 1) != 0;
+      x = -x;
+    }
+    t = (double)y * f32_log(x);
+    if (t > 89.0) t = 89.0; /* exp(t) overflows float */
+    if (t < -110.0) t = -110.0; /* exp(t) underflows float */
+    return (float)(neg ? -f32_exp(t) : f32_exp(t));
+  }
+  return (float)ieee754_pow(x, y); /* special cases */
+}
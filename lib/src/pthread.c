@@ -0,0 +1,313 @@
+/* POSIX threads */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <wasm.h>
+#include <wasi/api.h>
+#include <wasi/threads.h>
+#include <pthread.h>
+
+/* NB: control block is allocated together with thread's stack, so both
+ * are freed at once by pthread_join; detached threads that are done are
+ * put on the reap list and freed by the next pthread_create */
+
+#define DEFSTACKSIZE 65536
+
+#define TS_JOINABLE 0  /* running, to be joined */
+#define TS_DETACHED 1  /* running, to be reaped */
+#define TS_EXITED   2  /* done, result is set */
+
+struct pthread {
+  int state;                /* TS_XXX, waited on by pthread_join */
+  int tid;                  /* WASI thread id, 0 for main thread */
+  void *(*start)(void *);   /* start routine */
+  void *arg;                /* its argument */
+  void *result;             /* and its result */
+  struct pthread *next;     /* in reap list */
+  char *stacktop;           /* top of thread's stack */
+};
+
+/* shared: in memory */
+static struct pthread mainthread[1];
+static struct pthread *reaplist[1];
+static pthread_mutex_t allocmutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* thread-local: scalar global (instance-specific) */
+static pthread_t curthread = NULL;
+
+static void alloc_lock(void)
+{
+  pthread_mutex_lock(&allocmutex);
+}
+
+static void alloc_unlock(void)
+{
+  pthread_mutex_unlock(&allocmutex);
+}
+
+static void reap(void)
+{
+  struct pthread *t = (struct pthread *)__atomic_xchg32(&reaplist[0], 0);
+  while (t != NULL) {
+    struct pthread *next = t->next;
+    free(t);
+    t = next;
+  }
+}
+
+/* runs on thread's own stack; it should not touch it after state change */
+static void thread_main(int tid, pthread_t t)
+{
+  curthread = t; t->tid = tid;
+  _malloc_lock = &alloc_lock; _malloc_unlock = &alloc_unlock;
+  t->result = (*t->start)(t->arg);
+  if (__atomic_xchg32(&t->state, TS_EXITED) == TS_DETACHED) {
+    int32_t head;
+    do {
+      head = __atomic_load32(&reaplist[0]);
+      t->next = (struct pthread *)head;
+    } while (wasm_i32_atomic_rmw_cmpxchg(&reaplist[0], head, (int32_t)(intptr_t)t) != head);
+  } else {
+    wasm_memory_atomic_notify(&t->state, 1);
+  }
+}
+
+/* new instance's sp$ is the main thread's stack pointer, so the first
+ * thing to do is to switch to thread's stack: alloca's size wraps around
+ * to move sp$ up to stack top; locals can't be address-taken here */
+void wasi_thread_start(int tid, void *arg)
+{
+  pthread_t t = arg;
+  char *sp = alloca(0);
+  alloca((size_t)(sp - t->stacktop));
+  thread_main(tid, t);
+}
+
+int pthread_attr_init(pthread_attr_t *attr)
+{
+  attr->stacksize = DEFSTACKSIZE;
+  attr->detachstate = PTHREAD_CREATE_JOINABLE;
+  return 0;
+}
+
+int pthread_attr_destroy(pthread_attr_t *attr)
+{
+  return 0;
+}
+
+int pthread_attr_setstacksize(pthread_attr_t *attr, size_t size)
+{
+  if (size < PTHREAD_STACK_MIN) return EINVAL;
+  attr->stacksize = size;
+  return 0;
+}
+
+int pthread_attr_getstacksize(const pthread_attr_t *attr, size_t *psize)
+{
+  *psize = attr->stacksize;
+  return 0;
+}
+
+int pthread_attr_setdetachstate(pthread_attr_t *attr, int state)
+{
+  if (state != PTHREAD_CREATE_JOINABLE && state != PTHREAD_CREATE_DETACHED) return EINVAL;
+  attr->detachstate = state;
+  return 0;
+}
+
+int pthread_attr_getdetachstate(const pthread_attr_t *attr, int *pstate)
+{
+  *pstate = attr->detachstate;
+  return 0;
+}
+
+int pthread_create(pthread_t *pt, const pthread_attr_t *attr, void *(*start)(void *), void *arg)
+{
+  size_t size = attr ? attr->stacksize : DEFSTACKSIZE; pthread_t t;
+  size_t hsize = (sizeof(struct pthread) + 15) & ~(size_t)15;
+  if (_malloc_lock == NULL) { /* from now on, heap is shared */
+    _malloc_lock = &alloc_lock; _malloc_unlock = &alloc_unlock;
+  }
+  reap();
+  size = (size + 15) & ~(size_t)15;
+  t = malloc(hsize + size);
+  if (t == NULL) return EAGAIN;
+  memset(t, 0, sizeof(struct pthread));
+  t->state = attr && attr->detachstate == PTHREAD_CREATE_DETACHED ? TS_DETACHED : TS_JOINABLE;
+  t->start = start; t->arg = arg;
+  t->stacktop = (char *)t + (hsize + size);
+  if (thread_spawn(t) < 0) {
+    free(t);
+    return EAGAIN;
+  }
+  *pt = t;
+  return 0;
+}
+
+int pthread_join(pthread_t t, void **pres)
+{
+  int s;
+  if (t == pthread_self()) return EDEADLK;
+  if (t == &mainthread[0]) return EINVAL;
+  while ((s = __atomic_load32(&t->state)) != TS_EXITED) {
+    if (s == TS_DETACHED) return EINVAL;
+    wasm_memory_atomic_wait32(&t->state, s, -1LL);
+  }
+  if (pres != NULL) *pres = t->result;
+  free(t);
+  return 0;
+}
+
+int pthread_detach(pthread_t t)
+{
+  int32_t s = TS_JOINABLE;
+  if (t == &mainthread[0]) return 0;
+  if (_atomic_cmpxchg32(&t->state, &s, TS_DETACHED)) return 0;
+  if (s == TS_EXITED) free(t);
+  else return EINVAL;
+  return 0;
+}
+
+pthread_t pthread_self(void)
+{
+  return curthread == NULL ? &mainthread[0] : curthread;
+}
+
+int pthread_equal(pthread_t t1, pthread_t t2)
+{
+  return t1 == t2;
+}
+
+int pthread_mutexattr_init(pthread_mutexattr_t *attr)
+{
+  *attr = 0;
+  return 0;
+}
+
+int pthread_mutexattr_destroy(pthread_mutexattr_t *attr)
+{
+  return 0;
+}
+
+int pthread_mutex_init(pthread_mutex_t *m, const pthread_mutexattr_t *attr)
+{
+  m->lock = 0;
+  return 0;
+}
+
+int pthread_mutex_destroy(pthread_mutex_t *m)
+{
+  return 0;
+}
+
+/* mutex is a futex: after U. Drepper's "Futexes Are Tricky" */
+int pthread_mutex_lock(pthread_mutex_t *m)
+{
+  int32_t c = 0;
+  if (!_atomic_cmpxchg32(&m->lock, &c, 1)) {
+    if (c != 2) c = __atomic_xchg32(&m->lock, 2);
+    while (c != 0) {
+      wasm_memory_atomic_wait32(&m->lock, 2, -1LL);
+      c = __atomic_xchg32(&m->lock, 2);
+    }
+  }
+  return 0;
+}
+
+int pthread_mutex_trylock(pthread_mutex_t *m)
+{
+  int32_t c = 0;
+  return _atomic_cmpxchg32(&m->lock, &c, 1) ? 0 : EBUSY;
+}
+
+int pthread_mutex_unlock(pthread_mutex_t *m)
+{
+  if (__atomic_sub32(&m->lock, 1) != 1) {
+    __atomic_store32(&m->lock, 0);
+    wasm_memory_atomic_notify(&m->lock, 1);
+  }
+  return 0;
+}
+
+int pthread_condattr_init(pthread_condattr_t *attr)
+{
+  *attr = 0;
+  return 0;
+}
+
+int pthread_condattr_destroy(pthread_condattr_t *attr)
+{
+  return 0;
+}
+
+int pthread_cond_init(pthread_cond_t *c, const pthread_condattr_t *attr)
+{
+  c->seq = 0;
+  return 0;
+}
+
+int pthread_cond_destroy(pthread_cond_t *c)
+{
+  return 0;
+}
+
+static int cond_wait(pthread_cond_t *c, pthread_mutex_t *m, int64_t ns)
+{
+  int32_t seq = __atomic_load32(&c->seq), r;
+  pthread_mutex_unlock(m);
+  r = wasm_memory_atomic_wait32(&c->seq, seq, ns);
+  pthread_mutex_lock(m);
+  return r == 2 ? ETIMEDOUT : 0;
+}
+
+int pthread_cond_wait(pthread_cond_t *c, pthread_mutex_t *m)
+{
+  return cond_wait(c, m, -1LL);
+}
+
+int pthread_cond_timedwait(pthread_cond_t *c, pthread_mutex_t *m, const struct timespec *abstime)
+{
+  struct timespec now; int64_t ns;
+  if (abstime->tv_nsec < 0 || abstime->tv_nsec >= 1000000000L) return EINVAL;
+  if (clock_gettime(CLOCK_REALTIME, &now) != 0) return EINVAL;
+  ns = (abstime->tv_sec - now.tv_sec) * 1000000000LL + (int64_t)(abstime->tv_nsec - now.tv_nsec);
+  if (ns <= 0) return ETIMEDOUT;
+  return cond_wait(c, m, ns);
+}
+
+int pthread_cond_signal(pthread_cond_t *c)
+{
+  __atomic_add32(&c->seq, 1);
+  wasm_memory_atomic_notify(&c->seq, 1);
+  return 0;
+}
+
+int pthread_cond_broadcast(pthread_cond_t *c)
+{
+  __atomic_add32(&c->seq, 1);
+  wasm_memory_atomic_notify(&c->seq, -1); /* all waiters */
+  return 0;
+}
+
+#define ONCE_INIT    0
+#define ONCE_RUNNING 1
+#define ONCE_DONE    2
+
+int pthread_once(pthread_once_t *o, void (*init)(void))
+{
+  int32_t s = ONCE_INIT;
+  if (__atomic_load32(&o->state) == ONCE_DONE) return 0;
+  if (_atomic_cmpxchg32(&o->state, &s, ONCE_RUNNING)) {
+    (*init)();
+    __atomic_store32(&o->state, ONCE_DONE);
+    wasm_memory_atomic_notify(&o->state, -1);
+  } else {
+    while (s != ONCE_DONE) {
+      wasm_memory_atomic_wait32(&o->state, s, -1LL);
+      s = __atomic_load32(&o->state);
+    }
+  }
+  return 0;
+}
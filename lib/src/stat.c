@@ -25,6 +25,7 @@ static void to_public_stat(const filestat_t *in, struct stat *out)
   out->st_dev = in->dev;
   out->st_ino = in->ino;
   out->st_nlink = in->nlink;
+  out->st_mode = 0;
   static_assert(sizeof(off_t) == sizeof(filesize_t));
   out->st_size = (off_t)in->size;
   timestamp_to_timespec(in->atim, &out->st_atime, &out->st_atime_ns);
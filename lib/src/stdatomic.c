@@ -0,0 +1,21 @@
+/* Atomics */
+
+#include <stdatomic.h>
+
+bool _atomic_cmpxchg32(void *p, int32_t *pe, int32_t d)
+{
+  int32_t e = *pe;
+  int32_t v = (int32_t)asm(local.get p, local.get e, local.get d, i32.atomic.rmw.cmpxchg offset=0 align=4);
+  if (v == e) return true;
+  *pe = v;
+  return false;
+}
+
+bool _atomic_cmpxchg64(void *p, int64_t *pe, int64_t d)
+{
+  int64_t e = *pe;
+  int64_t v = (int64_t)asm(local.get p, local.get e, local.get d, i64.atomic.rmw.cmpxchg offset=0 align=8);
+  if (v == e) return true;
+  *pe = v;
+  return false;
+}
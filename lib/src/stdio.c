@@ -13,7 +13,7 @@
 
 /* stream i/o after K&R TCPL */
 
-static bool initialized = false;
+static bool initialized[1]; /* in memory, so it is shared by threads */
 
 /* by detault, use full buffering for stdin and stdout */
 FILE _iob[FOPEN_MAX] = {
@@ -42,19 +42,19 @@ static void closeall(void)
 
 static void initialize(void)
 {
-  if (!initialized) {
+  if (!initialized[0]) {
     /* make stdin and stdout line-buffered if associated with a tty */
     if (isatty(STDIN_FILENO)) stdin->flags |= _IOLBF; 
     if (isatty(STDOUT_FILENO)) stdout->flags |= _IOLBF; 
     atexit(&closeall);
-    initialized = true;
+    initialized[0] = true;
   }
 }
 
 FILE *freopen(const char *filename, const char *mode, FILE *fp)
 {
   int plus, oflags, fd;
-  if (!initialized) initialize();
+  if (!initialized[0]) initialize();
   if (fp != NULL) fclose(fp); else fp = findfp();
   if (fp == NULL || filename == NULL || mode == NULL) return NULL;
   switch (*mode++) {
@@ -85,7 +85,7 @@ FILE *fopen(const char *name, const char *mode)
 
 FILE *fdopen(int fd, const char *mode)
 {
-  if (!initialized) initialize();
+  if (!initialized[0]) initialize();
   FILE *fp = findfp();
   if (fp == NULL) return NULL;
   fp->fd = fd;
@@ -144,7 +144,7 @@ static void addbuf(FILE *fp)
 int _fillbuf(FILE *fp)
 {
   FILE *fpi; size_t readc;
-  if (!initialized) initialize();
+  if (!initialized[0]) initialize();
   if (fp->base == NULL) addbuf(fp);
   if (!(fp->flags & _IOREAD)) {
     if (fp->flags & _IORW) fp->flags |= _IOREAD;
@@ -176,6 +176,18 @@ size_t fread(void *buf, size_t size, size_t count, FILE *fp)
   if (size == 0 || count == 0) return 0;
   nleft = count * size;
   for (;;) {
+    if (fp->cnt <= 0 && nleft >= BUFSIZ && (fp->flags & (_IOREAD|_IOEOF|_IOLBF|_IONBF)) == _IOREAD) {
+      /* big reads go directly to buf, bypassing the stream buffer */
+      n = read(fp->fd, ptr, nleft);
+      if (n <= 0) {
+        fp->flags |= (n == 0) ? _IOEOF : _IOERR;
+        return (count - (nleft+size-1)/size);
+      }
+      ptr += n;
+      if (nleft <= (size_t)n) return count;
+      nleft -= (size_t)n;
+      continue;
+    }
     if (fp->cnt <= 0) {
       if (_fillbuf(fp) == EOF)
         return (count - (nleft+size-1)/size);
@@ -205,7 +217,7 @@ static int writebuf(FILE *fp)
 
 static int wrtchk(FILE *fp)
 {
-  if (!initialized) initialize();
+  if (!initialized[0]) initialize();
   if ((fp->flags & (_IOWRT|_IOEOF)) != _IOWRT) {
     if (!(fp->flags & (_IOWRT|_IORW))) return EOF; /* read-only */
     fp->flags = fp->flags & ~_IOEOF | _IOWRT; /* clear flags */
@@ -241,7 +253,13 @@ int _flushbuf(int c, FILE *fp)
     }
   } while (fp->flags & (_IONBF|_IOLBF));
   writebuf(fp); /* full buffer: flush it */
-  putc((char)c, fp); /* then put "c" in newly emptied buf */
+  /* then put "c" in newly emptied buf; not via putc that would call us 
+   * again for line-buffered files, as their cnt stays 0 */
+  if (fp->flags & _IOLBF) {
+    if ((*fp->ptr++ = c) == '\n') writebuf(fp);
+  } else if (--fp->cnt >= 0) {
+    *fp->ptr++ = c;
+  }
   return ferror(fp) ? EOF : c;
 }
 
@@ -259,6 +277,20 @@ size_t fwrite(const void *buf, size_t size, size_t count, FILE *fp)
       if (n != nleft) { fp->flags |= _IOERR; n = (n >= 0) ? n : 0; }
       return n/size;
     }
+  } else if (nleft >= BUFSIZ) {
+    /* buffer is not empty, but there is > BUFSIZ chars to write: 
+     * write both buffered and new chars out with a single gather write */
+    struct iovec iov[2]; ssize_t nbuf = fp->ptr - fp->base;
+    iov[0].iov_base = fp->base; iov[0].iov_len = (size_t)nbuf;
+    iov[1].iov_base = ptr; iov[1].iov_len = nleft;
+    n = writev(fp->fd, &iov[0], 2);
+    fp->ptr = fp->base;
+    fp->cnt = (fp->flags & (_IONBF|_IOLBF)) ? 0 : fp->end - fp->base;
+    if (n != nbuf + (ssize_t)nleft) { 
+      fp->flags |= _IOERR; n = (n > nbuf) ? n - nbuf : 0; 
+      return n/size;
+    }
+    return count;
   }
   /* put characters in the buffer */
   for (;; ptr += n) {
@@ -271,7 +303,7 @@ size_t fwrite(const void *buf, size_t size, size_t count, FILE *fp)
     /* done; flush if linebuffered with a newline */
     if ((nleft -= n) == 0) { 
       if (fp->flags & (_IOLBF|_IONBF)) {
-        if ((fp->flags & _IONBF) || (memchr(fp->base, '\n', count*size) != NULL)) 
+        if ((fp->flags & _IONBF) || (memchr(buf, '\n', count*size) != NULL)) 
           writebuf(fp);
       }
       return (count);
@@ -517,6 +549,107 @@ void setbuf(FILE *fp, char *buf)
 }
 
 
+/* whole-file i/o (non-standard) */
+
+/* WASI has no mmap, so fload sizes a regular file via fd_filestat_get,
+ * allocates it at once and fills it with as few large preads as the host
+ * allows; streams of unknown size are read with a geometrically growing
+ * buffer. fmapchunks reuses a single chunk buffer for files that should
+ * not be loaded whole; it returns -1 only on i/o errors, fn's result is
+ * passed back via pres */
+#define FLOAD_CHUNK_SIZE  (64*1024U)
+#define FMAP_CHUNK_SIZE   (1024*1024U)
+
+static int fsizefd(int fd, size_t *psize)
+{
+  filestat_t fs; errno_t error = fd_filestat_get(fd, &fs);
+  if (error != 0) {
+    errno = (int)error;
+    return -1;
+  }
+  if (fs.filetype != FILETYPE_REGULAR_FILE) return 0;
+  if (fs.size >= (filesize_t)SIZE_MAX) {
+    errno = EFBIG;
+    return -1;
+  }
+  *psize = (size_t)fs.size;
+  return 1;
+}
+
+void *fload(const char *path, size_t *plen)
+{
+  int fd, sized, olderrno; size_t size = 0, len = 0; ssize_t n;
+  char *buf = NULL, *nbuf;
+  if ((fd = open(path, O_RDONLY)) < 0) return NULL;
+  { if ((sized = fsizefd(fd, &size)) < 0) goto err;
+    if (!sized) size = FLOAD_CHUNK_SIZE;
+    for (;;) {
+      if (buf == NULL || (!sized && len == size)) {
+        if (buf != NULL) size = (size > SIZE_MAX/4) ? SIZE_MAX/2 : size*2;
+        if ((nbuf = realloc(buf, size + 1)) == NULL) {
+          errno = ENOMEM;
+          goto err;
+        }
+        buf = nbuf;
+      }
+      if (sized && len == size) break;
+      if (sized) n = pread(fd, &buf[len], size - len, (off_t)len);
+      else n = read(fd, &buf[len], size - len);
+      if (n < 0) goto err;
+      if (n == 0) break; /* eof or file got shorter */
+      len += (size_t)n;
+    }
+    close(fd);
+    buf[len] = 0; /* zero-terminated for convenience */
+    if (plen != NULL) *plen = len;
+    return buf;
+  err:; }
+  olderrno = errno;
+  free(buf);
+  close(fd);
+  errno = olderrno;
+  return NULL;
+}
+
+int fmapchunks(const char *path, size_t chunksize, int (*fn)(const char *, size_t, void *), void *ud, int *pres)
+{
+  int fd, sized, olderrno, res = 0; size_t size = 0, len; off_t off = 0; ssize_t n;
+  char *buf = NULL;
+  if ((fd = open(path, O_RDONLY)) < 0) return -1;
+  { if ((sized = fsizefd(fd, &size)) < 0) goto err;
+    if (chunksize == 0) chunksize = FMAP_CHUNK_SIZE;
+    /* no need for a buffer bigger than the file itself */
+    if (sized && size < chunksize) chunksize = (size > 0) ? size : 1;
+    if ((buf = malloc(chunksize)) == NULL) {
+      errno = ENOMEM;
+      goto err;
+    }
+    for (;;) {
+      for (len = 0; len < chunksize; len += (size_t)n) {
+        /* fill the whole chunk unless at eof */
+        if (sized) n = pread(fd, &buf[len], chunksize - len, off + (off_t)len);
+        else n = read(fd, &buf[len], chunksize - len);
+        if (n < 0) goto err;
+        if (n == 0) break;
+      }
+      if (len == 0) break;
+      if ((res = (*fn)(buf, len, ud)) != 0) break;
+      if (len < chunksize) break;
+      off += (off_t)len;
+    }
+    free(buf);
+    close(fd);
+    if (pres != NULL) *pres = res;
+    return 0;
+  err:; }
+  olderrno = errno;
+  free(buf);
+  close(fd);
+  errno = olderrno;
+  return -1;
+}
+
+
 /* formatted i/o helpers */
 
 /* todo: use macros? */
@@ -563,7 +696,7 @@ static unsigned int _atoi(const char** str)
 
  /* 'atod' conversion buffer size, this must be big enough to hold one converted
   * floating-point number including prefixes (dynamically created on stack) */
-#define SCANF_ATOD_BUFFER_SIZE    32U
+#define SCANF_ATOD_BUFFER_SIZE    64U
 
 /* internal size definitions */
 #define SIZE_HH  (-2)
@@ -727,7 +860,7 @@ static int _atos(in_fct_t in, void *data, const size_t maxlen, const char *s, si
 /* internal atod for decimal floating point */
 static double _atod(in_fct_t in, void *data, const size_t maxlen, int width, size_t *pidx)
 {
-  char buf[SCANF_ATON_BUFFER_SIZE];
+  char buf[SCANF_ATOD_BUFFER_SIZE];
   size_t len = 0, dc = 0; int c; bool hex = false;
   double res; char *end; bool neg = false;
   size_t maxidx = (width == 0) ? SIZE_MAX : *pidx + width;
@@ -751,7 +884,7 @@ static double _atod(in_fct_t in, void *data, const size_t maxlen, int width, siz
       if (n >= 3) return -HUGE_VAL + HUGE_VAL; /* fixme */
       errno = EILSEQ; return 0;
     }
-    while (len < SCANF_ATON_BUFFER_SIZE - 1) {
+    while (len < SCANF_ATOD_BUFFER_SIZE - 1) {
       if (*pidx >= maxidx) goto stop;
       c = (*in)(data, *pidx, maxlen, false);
       if (c == EOF) break;
@@ -765,12 +898,12 @@ static double _atod(in_fct_t in, void *data, const size_t maxlen, int width, siz
         ++dc;
       } else break;
     }
-    if (len < SCANF_ATON_BUFFER_SIZE - 1) {
+    if (len < SCANF_ATOD_BUFFER_SIZE - 1) {
       if (*pidx >= maxidx) goto stop;
       c = (*in)(data, *pidx, maxlen, false);
       if (c == '.') {
         buf[len++] = (*in)(data, (*pidx)++, maxlen, true);
-        while (len < SCANF_ATON_BUFFER_SIZE - 1) {
+        while (len < SCANF_ATOD_BUFFER_SIZE - 1) {
           if (*pidx >= maxidx) goto stop;
           c = (*in)(data, *pidx, maxlen, false);
           if (c != EOF && hex ? _is_hex_digit(c) : _is_dec_digit(c)) {
@@ -780,19 +913,19 @@ static double _atod(in_fct_t in, void *data, const size_t maxlen, int width, siz
         }
       }
     }
-    if (len < SCANF_ATON_BUFFER_SIZE - 1) {
+    if (len < SCANF_ATOD_BUFFER_SIZE - 1) {
       if (*pidx >= maxidx) goto stop;
       c = (*in)(data, *pidx, maxlen, false);
       if (hex ? (c == 'p' || c == 'P')  : (c == 'e' || c == 'E')) {
         buf[len++] = (*in)(data, (*pidx)++, maxlen, true);
-        if (len < SCANF_ATON_BUFFER_SIZE - 1) {
+        if (len < SCANF_ATOD_BUFFER_SIZE - 1) {
           if (*pidx >= maxidx) goto stop;
           c = (*in)(data, *pidx, maxlen, false);
           if (c == '-' || c == '+') {
             (*in)(data, (*pidx)++, maxlen, true);
             buf[len++] = c;
           }
-          while (len < SCANF_ATON_BUFFER_SIZE - 1) {
+          while (len < SCANF_ATOD_BUFFER_SIZE - 1) {
             if (*pidx >= maxidx) goto stop;
             c = (*in)(data, *pidx, maxlen, false);
             if (c != EOF && _is_dec_digit(c))
@@ -1062,9 +1195,9 @@ int vsnscanf(const char *buf, size_t count, const char *format, va_list va)
  * integer number including padded zeros (dynamically created on stack) */
 #define PRINTF_NTOA_BUFFER_SIZE    32U
 
-/* 'ftoa' conversion buffer size, this must be big enough to hold one converted
- * float number including padded zeros (dynamically created on stack) */
-#define PRINTF_FTOA_BUFFER_SIZE    32U
+/* 'dtoa' digit buffer size, this must be big enough to hold all significant
+ * digits of a double's exact decimal value, 767 max (dynamically created on stack) */
+#define PRINTF_DTOA_BUFFER_SIZE    800U
 
 /* 'atoa' conversion buffer size, this must be big enough to hold one converted
  * hex float number including padded zeros (dynamically created on stack) */
@@ -1076,8 +1209,9 @@ int vsnscanf(const char *buf, size_t count, const char *format, va_list va)
 /* default precision for hexadecimal doubles */
 #define PRINTF_DEFAULT_HEXFL_PRECISION  13U 
 
-/* largest float suitable to print with %f */
-#define PRINTF_MAX_FLOAT  1e9
+/* 'file' output chunk size: formatted output is collected in chunks 
+ * appended to the stream via fwrite (dynamically created on stack) */
+#define PRINTF_CHUNK_BUFFER_SIZE  128U
 
 /* internal flag definitions */
 #define FLAGS_ZEROPAD   (1U <<  0U)
@@ -1107,11 +1241,22 @@ static void _out_null(char c, void *data, size_t idx, size_t maxlen)
 {
 }
 
-/* internal file output */
-static void _out_file(char c, void *data, size_t idx, size_t maxlen)
+/* internal chunked file output */
+typedef struct outchunk {
+  FILE *fp;
+  size_t len;
+  char buf[PRINTF_CHUNK_BUFFER_SIZE];
+} outchunk_t;
+
+static void _out_chunk(char c, void *data, size_t idx, size_t maxlen)
 {
-  FILE *fp = (FILE *)data;
-  if (c) putc(c, fp);
+  outchunk_t *pc = (outchunk_t *)data;
+  if (!c) return;
+  if (pc->len == PRINTF_CHUNK_BUFFER_SIZE) {
+    fwrite(&pc->buf[0], 1, pc->len, pc->fp);
+    pc->len = 0;
+  }
+  pc->buf[pc->len++] = c;
 } 
 
 /* output the specified string in reverse, taking care of any zero-padding */
@@ -1185,168 +1330,418 @@ static size_t _ntoa_long_long(out_fct_t out, void *data, size_t idx, size_t maxl
   return _ntoa_format(out, data, idx, maxlen, buf, len, negative, (unsigned int)base, prec, width, flags);
 }
 
-/* powers of 10 for _ftoa's 9 digits of precision */
-static const double pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+/* Binary-to-decimal conversion is based on Ryu (Ulf Adams, "Ryu: fast float-to-string
+ * conversion", PLDI 2018), small-table variant: 128-bit multipliers for 5^i and
+ * 2^k/5^i are interpolated from every 26th power and corrected with 2-bit offsets */
+
+#define DOUBLE_POW5_INV_BITCOUNT 125
+#define DOUBLE_POW5_BITCOUNT 125
+
+/* 128-bit 5^i (lo, hi) for i = 0, 26, 52, ..., 312, 125-bit precision */
+static const uint64_t _ryu_pow5_split2[26] = {
+  0x0000000000000000ULL, 0x1000000000000000ULL,
+  0x0000000000000000ULL, 0x14adf4b7320334b9ULL,
+  0x0e549208b31adb10ULL, 0x1aba4714957d300dULL,
+  0x6dc6ad264d8f0866ULL, 0x1145b7e285bf98f5ULL,
+  0xeb1dbd923d8596caULL, 0x1652efdc6018a1fcULL,
+  0xb4c1b80b22ae923cULL, 0x1cda62055b2d9d83ULL,
+  0x5bb28b4e8f7e4c30ULL, 0x12a5568b9f52f416ULL,
+  0xf08aed437682d4fbULL, 0x1819651531f9e78fULL,
+  0xb4ee134ad99bf150ULL, 0x1f25c186a6f04c28ULL,
+  0x16499ecb70c25f03ULL, 0x1420eb449c8842e6ULL,
+  0x85a56ead360865b0ULL, 0x1a03fde214caf085ULL,
+  0x093db1d57999890bULL, 0x10cfeb353a97dad8ULL,
+  0xcf38bb735e3f36acULL, 0x15baaf44fa52673eULL
+};
 
-/* forward declaration so that _ftoa can switch to exp notation for values > PRINTF_MAX_FLOAT */
-static size_t _etoa(out_fct_t out, void *data, size_t idx, size_t maxlen, double value, unsigned int prec, unsigned int width, unsigned int flags);
+/* 128-bit 2^k/5^i + 1 (lo, hi) for i = 0, 26, 52, ..., 364, 125-bit precision */
+static const uint64_t _ryu_pow5_inv_split2[30] = {
+  0x0000000000000001ULL, 0x2000000000000000ULL,
+  0x52a6c95fc0655034ULL, 0x18c240c4aecb13bbULL,
+  0x7ca8d50071dfc806ULL, 0x1327fc58da0f6ff5ULL,
+  0x6520247d3556476eULL, 0x1da48ce468e7c702ULL,
+  0x6139cdd76802e6e9ULL, 0x16ef5b40c2fc7779ULL,
+  0xf951a7ff43de8c79ULL, 0x11bebdf578b2f391ULL,
+  0x7be8bee8d6e957e8ULL, 0x1b758d848fac54b0ULL,
+  0x8bd3f9e999a423eaULL, 0x153eda614071a3b7ULL,
+  0x0848f973cb3ee3ceULL, 0x10701bd527b4978cULL,
+  0x153285ebb9efbfa2ULL, 0x196fbb9bb44db44dULL,
+  0xadeee7f86c07b696ULL, 0x13ae3591f5b4d936ULL,
+  0x4d686a4eaf182222ULL, 0x1e74404f3daada91ULL,
+  0x98c0a106e09ebd9fULL, 0x17900ea4fda7c257ULL,
+  0x8f20e37371497d0eULL, 0x123b140576d820b2ULL,
+  0xb043138134743d85ULL, 0x1c35f4275f7a29adULL
+};
 
-/* internal ftoa for fixed decimal floating point */
-static size_t _ftoa(out_fct_t out, void *data, size_t idx, size_t maxlen, double value, unsigned int prec, unsigned int width, unsigned int flags)
+/* 2-bit corrections to interpolated _ryu_pow5 values, 16 per word */
+static const uint32_t _ryu_pow5_offsets[21] = {
+  0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x40000000U, 0x59695995U,
+  0x55545555U, 0x56555515U, 0x41150504U, 0x40555410U, 0x44555145U, 0x44504540U,
+  0x45555550U, 0x40004000U, 0x96440440U, 0x55565565U, 0x54454045U, 0x40154151U,
+  0x55559155U, 0x51405555U, 0x00000105U
+};
+
+/* 2-bit corrections to interpolated _ryu_pow5_inv values, 16 per word */
+static const uint32_t _ryu_pow5_inv_offsets[22] = {
+  0x54544554U, 0x04055545U, 0x10041000U, 0x00400414U, 0x40010000U, 0x41155555U,
+  0x00000454U, 0x00010044U, 0x40000000U, 0x44000041U, 0x50454450U, 0x55550054U,
+  0x51655554U, 0x40004000U, 0x01000001U, 0x00010500U, 0x51515411U, 0x05555554U,
+  0x50411500U, 0x40040000U, 0x05040110U, 0x00000000U
+};
+
+/* 5^0 .. 5^25 */
+static const uint64_t _ryu_pow5_table[26] = {
+  1ULL, 5ULL, 25ULL, 125ULL,
+  625ULL, 3125ULL, 15625ULL, 78125ULL,
+  390625ULL, 1953125ULL, 9765625ULL, 48828125ULL,
+  244140625ULL, 1220703125ULL, 6103515625ULL, 30517578125ULL,
+  152587890625ULL, 762939453125ULL, 3814697265625ULL, 19073486328125ULL,
+  95367431640625ULL, 476837158203125ULL, 2384185791015625ULL, 11920928955078125ULL,
+  59604644775390625ULL, 298023223876953125ULL
+};
+
+/* full 64x64->128 multiplication: returns low part, stores high part in *phi */
+static uint64_t _umul128(uint64_t a, uint64_t b, uint64_t *phi)
 {
-  char buf[PRINTF_FTOA_BUFFER_SIZE];
-  size_t len  = 0U; double diff = 0.0;
-  
-  if (value != value)   /* NAN */
-    return _out_rev(out, data, idx, maxlen, "nan", 3, width, flags);
-  if (value < -DBL_MAX) /* -INF */
-    return _out_rev(out, data, idx, maxlen, "fni-", 4, width, flags);
-  if (value > DBL_MAX)  /* +INF */
-    return _out_rev(out, data, idx, maxlen, (flags & FLAGS_PLUS) ? "fni+" : "fni", (flags & FLAGS_PLUS) ? 4U : 3U, width, flags);
-  /* fall back to etoa for very large values */
-  if ((value > PRINTF_MAX_FLOAT) || (value < -PRINTF_MAX_FLOAT)) {
-    return _etoa(out, data, idx, maxlen, value, prec, width, flags);
-  }
-  bool negative = false;
-  if (value < 0) { negative = true; value = -value; }
-  if (!(flags & FLAGS_PRECISION)) {
-    prec = PRINTF_DEFAULT_FLOAT_PRECISION;
-  }
-  /* limit precision to 9, cause a prec >= 10 can lead to overflow errors */
-  while ((len < PRINTF_FTOA_BUFFER_SIZE) && (prec > 9U)) {
-    buf[len++] = '0';
-    --prec;
+  uint64_t a0 = a & 0xFFFFFFFFULL, a1 = a >> 32, b0 = b & 0xFFFFFFFFULL, b1 = b >> 32;
+  uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+  uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFULL) + (p10 & 0xFFFFFFFFULL);
+  *phi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+  return (mid << 32) | (p00 & 0xFFFFFFFFULL);
+}
+
+/* (hi:lo) >> dist for 0 < dist < 64 */
+static uint64_t _shiftright128(uint64_t lo, uint64_t hi, int dist)
+{
+  return (hi << (64 - dist)) | (lo >> dist);
+}
+
+/* ceil(log2(5^e)) for 0 < e <= 3528, 1 for e == 0 */
+static int _pow5bits(int e)
+{
+  return (int)(((uint32_t)e * 1217359U) >> 19) + 1;
+}
+
+/* floor(log10(2^e)) for 0 <= e <= 1650 */
+static int _log10pow2(int e)
+{
+  return (int)(((uint32_t)e * 78913U) >> 18);
+}
+
+/* floor(log10(5^e)) for 0 <= e <= 2620 */
+static int _log10pow5(int e)
+{
+  return (int)(((uint32_t)e * 732923U) >> 20);
+}
+
+/* largest n such that 5^n divides v != 0 */
+static int _pow5factor(uint64_t v)
+{
+  int n = 0;
+  while (v % 5U == 0U) { v /= 5U; ++n; }
+  return n;
+}
+
+/* 5^i >> (pow5bits(i) - 125) as (lo, hi) */
+static void _ryu_pow5(int i, uint64_t *res)
+{
+  int base = i / 26, base2 = base * 26, off = i - base2, delta;
+  const uint64_t *mul = &_ryu_pow5_split2[base * 2];
+  uint64_t m, low0, high0, low1, high1, sum;
+  if (off == 0) { res[0] = mul[0]; res[1] = mul[1]; return; }
+  m = _ryu_pow5_table[off];
+  low1 = _umul128(m, mul[1], &high1);
+  low0 = _umul128(m, mul[0], &high0);
+  sum = high0 + low1;
+  if (sum < high0) ++high1;
+  delta = _pow5bits(i) - _pow5bits(base2);
+  res[0] = _shiftright128(low0, sum, delta) + ((_ryu_pow5_offsets[i / 16] >> ((i % 16) << 1)) & 3U);
+  res[1] = _shiftright128(sum, high1, delta);
+}
+
+/* 2^(pow5bits(i) - 1 + 125) / 5^i + 1 as (lo, hi) */
+static void _ryu_pow5_inv(int i, uint64_t *res)
+{
+  int base = (i + 25) / 26, base2 = base * 26, off = base2 - i, delta;
+  const uint64_t *mul = &_ryu_pow5_inv_split2[base * 2];
+  uint64_t m, low0, high0, low1, high1, sum;
+  if (off == 0) { res[0] = mul[0]; res[1] = mul[1]; return; }
+  m = _ryu_pow5_table[off];
+  low1 = _umul128(m, mul[1], &high1);
+  low0 = _umul128(m, mul[0] - 1U, &high0);
+  sum = high0 + low1;
+  if (sum < high0) ++high1;
+  delta = _pow5bits(base2) - _pow5bits(i);
+  res[0] = _shiftright128(low0, sum, delta) + 1U + ((_ryu_pow5_inv_offsets[i / 16] >> ((i % 16) << 1)) & 3U);
+  res[1] = _shiftright128(sum, high1, delta);
+}
+
+/* (m * mul) >> j for 64 < j < 128 */
+static uint64_t _ryu_mulshift(uint64_t m, const uint64_t *mul, int j)
+{
+  uint64_t high0, high1, low1, sum;
+  _umul128(m, mul[0], &high0);
+  low1 = _umul128(m, mul[1], &high1);
+  sum = high0 + low1;
+  if (sum < high0) ++high1;
+  return _shiftright128(sum, high1, j - 64);
+}
+
+/* decimal form of finite positive value: returns digits d and sets *pe10 so that
+ * value ~ d*10^*pe10; if shortest, d has the fewest digits that round-trip, otherwise
+ * d is value/10^*pe10 truncated to 18-19 digits and *pexact tells if it was exact */
+static uint64_t _ryu(double value, bool shortest, int *pe10, bool *pexact)
+{
+  union { uint64_t U; double F; } conv; 
+  uint64_t m2, mv, vr, vp, vm, output, mul[2];
+  int e2, e10, q, removed = 0; uint32_t mmshift; 
+  bool even, vmtz = false, vrtz = false; int lastdigit = 0;
+  conv.F = value;
+  m2 = conv.U & ((1ULL << 52) - 1U);
+  e2 = (int)(conv.U >> 52);
+  mmshift = (m2 != 0U || e2 <= 1) ? 1U : 0U;
+  if (e2 == 0) e2 = 1 - 1075 - 2; 
+  else { e2 = e2 - 1075 - 2; m2 |= 1ULL << 52; }
+  even = (m2 & 1U) == 0U;
+  mv = 4U * m2;
+  if (e2 >= 0) {
+    int k, i;
+    q = _log10pow2(e2) - (e2 > 3);
+    e10 = q;
+    k = DOUBLE_POW5_INV_BITCOUNT + _pow5bits(q) - 1;
+    i = -e2 + q + k;
+    _ryu_pow5_inv(q, &mul[0]);
+    vr = _ryu_mulshift(mv, &mul[0], i);
+    if (!shortest) {
+      *pexact = _pow5factor(mv) >= q; *pe10 = e10;
+      return vr;
+    }
+    vp = _ryu_mulshift(mv + 2U, &mul[0], i);
+    vm = _ryu_mulshift(mv - 1U - mmshift, &mul[0], i);
+    if (q <= 21) {
+      if (mv % 5U == 0U) vrtz = _pow5factor(mv) >= q;
+      else if (even) vmtz = _pow5factor(mv - 1U - mmshift) >= q;
+      else vp -= _pow5factor(mv + 2U) >= q;
+    }
+  } else {
+    int k, i, j;
+    q = _log10pow5(-e2) - (-e2 > 1);
+    e10 = q + e2;
+    i = -e2 - q;
+    k = _pow5bits(i) - DOUBLE_POW5_BITCOUNT;
+    j = q - k;
+    _ryu_pow5(i, &mul[0]);
+    vr = _ryu_mulshift(mv, &mul[0], j);
+    if (!shortest) {
+      *pexact = q < 64 && (mv & ((1ULL << q) - 1U)) == 0U; *pe10 = e10;
+      return vr;
+    }
+    vp = _ryu_mulshift(mv + 2U, &mul[0], j);
+    vm = _ryu_mulshift(mv - 1U - mmshift, &mul[0], j);
+    if (q <= 1) {
+      vrtz = true;
+      if (even) vmtz = mmshift == 1U;
+      else --vp;
+    } else if (q < 63) {
+      vrtz = (mv & ((1ULL << q) - 1U)) == 0U;
+    }
   }
-  
-  int whole = (int)value;
-  double tmp = (value - whole) * pow10[prec];
-  unsigned long frac = (unsigned long)tmp;
-  diff = tmp - frac;
-  if (diff > 0.5) {
-    ++frac;
-    /* handle rollover, e.g. case 0.99 with prec 1 is 1.0 */
-    if (frac >= pow10[prec]) {
-      frac = 0;
-      ++whole;
+  /* find the shortest representation in the interval */
+  if (vmtz || vrtz) {
+    while (vp / 10U > vm / 10U) {
+      vmtz = vmtz && vm % 10U == 0U;
+      vrtz = vrtz && lastdigit == 0;
+      lastdigit = (int)(vr % 10U);
+      vr /= 10U; vp /= 10U; vm /= 10U; ++removed;
     }
-  } else if (diff < 0.5) {
-  } else if ((frac == 0U) || (frac & 1U)) {
-    /* if halfway, round up if odd OR if last digit is 0 */
-    ++frac;
-  }
-  if (prec == 0U) {
-    diff = value - (double)whole;
-    if ((!(diff < 0.5) || (diff > 0.5)) && (whole & 1)) {
-      /* exactly 0.5 and ODD, then round up:  1.5 -> 2, but 2.5 -> 2 */
-      ++whole;
+    if (vmtz) {
+      while (vm % 10U == 0U) {
+        vrtz = vrtz && lastdigit == 0;
+        lastdigit = (int)(vr % 10U);
+        vr /= 10U; vp /= 10U; vm /= 10U; ++removed;
+      }
     }
+    if (vrtz && lastdigit == 5 && vr % 2U == 0U) lastdigit = 4; /* round even */
+    output = vr + ((vr == vm && (!even || !vmtz)) || lastdigit >= 5);
   } else {
-    unsigned int count = prec;
-    /* now do fractional part, as an unsigned number */
-    while (len < PRINTF_FTOA_BUFFER_SIZE) {
-      --count;
-      buf[len++] = (char)(48U + (frac % 10U));
-      if (!(frac /= 10U)) break;
+    bool roundup = false;
+    while (vp / 10U > vm / 10U) {
+      roundup = vr % 10U >= 5U;
+      vr /= 10U; vp /= 10U; vm /= 10U; ++removed;
     }
-    /* add extra 0s */
-    while ((len < PRINTF_FTOA_BUFFER_SIZE) && (count-- > 0U)) {
-      buf[len++] = '0';
+    output = vr + (vr == vm || roundup);
+  }
+  *pe10 = e10 + removed;
+  return output;
+}
+
+/* exact decimal digits of finite positive value via base-1e9 bignum; returns digit count */
+static int _dtod_exact(double value, char *dig, int *pdexp)
+{
+  uint32_t big[90]; /* value's integer significand scaled by 2^e or 5^-e */
+  union { uint64_t U; double F; } conv;
+  uint64_t m; int e, nb, i, n = 0, d10 = 0;
+  conv.F = value;
+  m = conv.U & ((1ULL << 52) - 1U);
+  e = (int)(conv.U >> 52);
+  if (e == 0) e = -1074; else { m |= 1ULL << 52; e -= 1075; }
+  big[0] = (uint32_t)(m % 1000000000U); big[1] = (uint32_t)(m / 1000000000U % 1000000000U);
+  big[2] = (uint32_t)(m / 1000000000000000000ULL); nb = big[2] ? 3 : big[1] ? 2 : 1;
+  if (e < 0) d10 = e;
+  while (e != 0) { /* multiply by 2^e or 5^-e in chunks */
+    uint64_t f, carry = 0;
+    if (e > 0) { int s = e < 29 ? e : 29; f = 1ULL << s; e -= s; }
+    else { int s = -e < 13 ? -e : 13; f = _ryu_pow5_table[s]; e += s; }
+    for (i = 0; i < nb; ++i) {
+      uint64_t t = big[i] * f + carry;
+      big[i] = (uint32_t)(t % 1000000000U); carry = t / 1000000000U;
     }
-    if (len < PRINTF_FTOA_BUFFER_SIZE) {
-      /* add decimal dot */
-      buf[len++] = '.';
+    while (carry) { big[nb++] = (uint32_t)(carry % 1000000000U); carry /= 1000000000U; }
+  }
+  for (i = nb - 1; i >= 0; --i) { /* top limb without leading zeros, others with 9 digits */
+    uint32_t v = big[i]; int k, w = 9;
+    if (i == nb - 1) { w = 0; while (v >= 1U) { ++w; v /= 10U; } v = big[i]; }
+    for (k = w - 1; k >= 0; --k) { dig[n + k] = (char)('0' + v % 10U); v /= 10U; }
+    n += w;
+  }
+  *pdexp = n - 1 + d10;
+  while (n > 0 && dig[n-1] == '0') --n;
+  return n;
+}
+
+/* correctly rounded (ties to even) decimal digits of finite positive value: ndig is the
+ * number of significant digits or, if fixed, of digits after the decimal point; stores
+ * up to that many digits in dig (the rest are zeros) and the decimal exponent of the
+ * first digit in *pdexp; returns digit count, 0 if value rounds to zero */
+static int _dtod(double value, int ndig, bool fixed, char *dig, int *pdexp)
+{
+  bool exact; uint64_t vr, t = 1U; int e10, l = 0, p, n;
+  vr = _ryu(value, false, &e10, &exact);
+  while (t <= vr / 10U) { t *= 10U; ++l; }
+  *pdexp = l + e10; /* vr has l+1 digits, t = 10^l */
+  p = fixed ? *pdexp + 1 + ndig : ndig;
+  if (p <= 0) { /* compare with half a unit of the next higher digit */
+    if (p < 0 || vr < 5U * t || (vr == 5U * t && exact)) return 0;
+    dig[0] = '1'; ++*pdexp;
+    return 1;
+  } else if (p <= l) { /* vr has extra digits to round */
+    uint64_t d = 10U, rem;
+    for (n = p; n < l; ++n) d *= 10U; /* d = 10^(l+1-p) */
+    rem = vr % d; vr /= d;
+    if (rem > d / 2U || (rem == d / 2U && (!exact || (vr & 1U)))) {
+      if (++vr == t / d * 10U) { vr /= 10U; ++*pdexp; }
     }
+    n = p;
+  } else if (exact) { /* vr has all the digits */
+    n = l + 1;
+  } else { /* not enough digits in vr: do it the slow way */
+    n = _dtod_exact(value, dig, pdexp);
+    if (p >= n) return n;
+    if (dig[p] > '5' || (dig[p] == '5' && (n > p + 1 || ((dig[p-1] - '0') & 1)))) {
+      while (p > 0 && dig[p-1] == '9') --p;
+      if (p == 0) { dig[0] = '1'; ++*pdexp; return 1; }
+      ++dig[p-1];
+      return p;
+    }
+    while (dig[p-1] == '0') --p;
+    return p;
   }
+  while (vr % 10U == 0U) { vr /= 10U; --n; } /* vr != 0 */
+  for (p = n - 1; p >= 0; --p) { dig[p] = (char)('0' + vr % 10U); vr /= 10U; }
+  return n;
+}
 
-  /* do whole part, number is reversed */
-  while (len < PRINTF_FTOA_BUFFER_SIZE) {
-    buf[len++] = (char)(48 + (whole % 10));
-    if (!(whole /= 10)) break;
+/* digit k of the decimal digits in dig[0..n), zeros elsewhere */
+#define _DIGIT(dig, n, k) (((k) >= 0 && (k) < (n)) ? (dig)[k] : '0')
+
+/* output decimal digits dig[0..n) with decimal exponent dexp of the first one in fixed
+ * (%f) or exponential (%e) notation with prec digits after the decimal point */
+static size_t _dtoa_format(out_fct_t out, void *data, size_t idx, size_t maxlen, const char *dig, int n, int dexp, bool negative, bool expform, unsigned int prec, unsigned int width, unsigned int flags)
+{
+  const size_t start_idx = idx;
+  const bool dot = prec > 0U || (flags & FLAGS_HASH);
+  const char sign = negative ? '-' : (flags & FLAGS_PLUS) ? '+' : (flags & FLAGS_SPACE) ? ' ' : 0;
+  const int aexp = dexp < 0 ? -dexp : dexp;
+  size_t len = prec + (dot ? 1U : 0U) + (sign ? 1U : 0U), i; int k;
+  if (expform) len += aexp < 100 ? 5U : 6U;
+  else len += dexp < 0 ? 1U : (size_t)dexp + 1U;
+  if (!(flags & FLAGS_LEFT) && !(flags & FLAGS_ZEROPAD)) {
+    for (i = len; i < width; ++i) (*out)(' ', data, idx++, maxlen);
   }
+  if (sign) (*out)(sign, data, idx++, maxlen);
   if (!(flags & FLAGS_LEFT) && (flags & FLAGS_ZEROPAD)) {
-    if (width && (negative || (flags & (FLAGS_PLUS | FLAGS_SPACE)))) --width;
-    while ((len < width) && (len < PRINTF_FTOA_BUFFER_SIZE)) buf[len++] = '0';
+    for (i = len; i < width; ++i) (*out)('0', data, idx++, maxlen);
   }
-  if (len < PRINTF_FTOA_BUFFER_SIZE) {
-    if (negative) buf[len++] = '-';
-    else if (flags & FLAGS_PLUS) buf[len++] = '+';
-    else if (flags & FLAGS_SPACE) buf[len++] = ' ';
+  if (expform) {
+    (*out)(_DIGIT(dig, n, 0), data, idx++, maxlen);
+    if (dot) (*out)('.', data, idx++, maxlen);
+    for (k = 1; k <= (int)prec; ++k) (*out)(_DIGIT(dig, n, k), data, idx++, maxlen);
+    (*out)((flags & FLAGS_UPPERCASE) ? 'E' : 'e', data, idx++, maxlen);
+    (*out)(dexp < 0 ? '-' : '+', data, idx++, maxlen);
+    if (aexp >= 100) (*out)((char)('0' + aexp / 100), data, idx++, maxlen);
+    (*out)((char)('0' + aexp / 10 % 10), data, idx++, maxlen);
+    (*out)((char)('0' + aexp % 10), data, idx++, maxlen);
+  } else {
+    if (dexp < 0) (*out)('0', data, idx++, maxlen);
+    else for (k = 0; k <= dexp; ++k) (*out)(_DIGIT(dig, n, k), data, idx++, maxlen);
+    if (dot) (*out)('.', data, idx++, maxlen);
+    for (k = dexp + 1; k <= dexp + (int)prec; ++k) (*out)(_DIGIT(dig, n, k), data, idx++, maxlen);
   }
+  if (flags & FLAGS_LEFT) {
+    while (idx - start_idx < width) (*out)(' ', data, idx++, maxlen);
+  }
+  return idx;
+}
 
-  return _out_rev(out, data, idx, maxlen, buf, len, width, flags);
+/* internal ftoa for fixed decimal floating point */
+static size_t _ftoa(out_fct_t out, void *data, size_t idx, size_t maxlen, double value, unsigned int prec, unsigned int width, unsigned int flags)
+{
+  char dig[PRINTF_DTOA_BUFFER_SIZE];
+  union { uint64_t U; double F; } conv;
+  int n = 0, dexp = 0; bool negative;
+
+  if (value != value)   /* NAN */
+    return _out_rev(out, data, idx, maxlen, "nan", 3, width, flags);
+  if (value < -DBL_MAX) /* -INF */
+    return _out_rev(out, data, idx, maxlen, "fni-", 4, width, flags);
+  if (value > DBL_MAX)  /* +INF */
+    return _out_rev(out, data, idx, maxlen, (flags & FLAGS_PLUS) ? "fni+" : "fni", (flags & FLAGS_PLUS) ? 4U : 3U, width, flags);
+  conv.F = value; negative = (conv.U >> 63) != 0U;
+  if (negative) value = -value;
+  if (!(flags & FLAGS_PRECISION)) prec = PRINTF_DEFAULT_FLOAT_PRECISION;
+  if (value != 0.0) n = _dtod(value, (int)prec, true, &dig[0], &dexp);
+  if (n == 0) dexp = 0;
+  return _dtoa_format(out, data, idx, maxlen, &dig[0], n, dexp, negative, false, prec, width, flags);
 }
 
-/* internal ftoa variant for exponential floating-point type, contributed by Martijn Jasperse <m.jasperse@gmail.com> */
+/* internal ftoa variant for exponential floating-point type */
 static size_t _etoa(out_fct_t out, void *data, size_t idx, size_t maxlen, double value, unsigned int prec, unsigned int width, unsigned int flags)
 {
+  char dig[PRINTF_DTOA_BUFFER_SIZE];
+  union { uint64_t U; double F; } conv;
+  int n = 0, dexp = 0; bool negative, expform = true;
+
   if ((value != value) || (value > DBL_MAX) || (value < -DBL_MAX)) {
     return _ftoa(out, data, idx, maxlen, value, prec, width, flags);
   }
-  const bool negative = value < 0; if (negative) value = -value;
+  conv.F = value; negative = (conv.U >> 63) != 0U;
+  if (negative) value = -value;
   if (!(flags & FLAGS_PRECISION)) prec = PRINTF_DEFAULT_FLOAT_PRECISION;
-
-  /* determine the decimal exponent
-   * based on the algorithm by David Gay (https://www.ampl.com/netlib/fp/dtoa.c) */
-  union { uint64_t U; double F; } conv; conv.F = value;
-  int exp2 = (int)((conv.U >> 52U) & 0x07FFU) - 1023;  /* effectively log2 */
-  conv.U = (conv.U & ((1ULL << 52U) - 1U)) | (1023ULL << 52U);  /* drop the exponent so conv.F is now in [1,2) */
-  /* now approximate log10 from the log2 integer part and an expansion of ln around 1.5 */
-  int expval = (int)(0.1760912590558 + exp2 * 0.301029995663981 + (conv.F - 1.5) * 0.289529654602168);
-  /* now we want to compute 10^expval but we want to be sure it won't overflow */
-  exp2 = (int)(expval * 3.321928094887362 + 0.5);
-  const double z  = expval * 2.302585092994046 - exp2 * 0.6931471805599453;
-  const double z2 = z * z;
-  conv.U = (uint64_t)(exp2 + 1023) << 52U;
-  /* compute exp(z) using continued fractions, see 
-   * https://en.wikipedia.org/wiki/Exponential_function#Continued_fractions_for_ex */
-  conv.F *= 1 + 2 * z / (2 - z + (z2 / (6 + (z2 / (10 + z2 / 14)))));
-  /* correct for rounding errors */
-  if (value < conv.F) { --expval; conv.F /= 10; }
-
-  /* the exponent format is "%+03d" and largest value is "307", so set aside 4-5 characters */
-  unsigned int minwidth = ((expval < 100) && (expval > -100)) ? 4U : 5U;
-
-  /* in "%g" mode, "prec" is the number of *significant figures* not decimals */
   if (flags & FLAGS_ADAPT_EXP) {
-    /* do we want to fall-back to "%f" mode? */
-    if ((value >= 1e-4) && (value < 1e6)) {
-      if ((int)prec > expval) prec = (unsigned)((int)prec - expval - 1);
-      else prec = 0;
-      flags |= FLAGS_PRECISION; /* make sure _ftoa respects precision */
-      /* no characters in exponent */
-      minwidth = 0U; expval = 0;
-    } else {
-      /* we use one sigfig for the whole part */
-      if ((prec > 0) && (flags & FLAGS_PRECISION)) --prec;
-    }
-  }
-
-  unsigned int fwidth = width;
-  if (width > minwidth) { /* we didn't fall-back so subtract the characters required for the exponent */
-    fwidth -= minwidth;
-  } else { /* not enough characters, so go back to default sizing */
-    fwidth = 0U;
-  }
-  if ((flags & FLAGS_LEFT) && minwidth) { /* if we're padding on the right, DON'T pad the floating part */
-    fwidth = 0U;
-  }
-
-  /* rescale the float value */
-  if (expval) value /= conv.F;
-
-  /* output the floating part */
-  const size_t start_idx = idx;
-  idx = _ftoa(out, data, idx, maxlen, negative ? -value : value, prec, fwidth, flags & ~FLAGS_ADAPT_EXP);
-  /* output the exponent part */
-  if (minwidth) {
-    (*out)((flags & FLAGS_UPPERCASE) ? 'E' : 'e', data, idx++, maxlen);
-    idx = _ntoa_long(out, data, idx, maxlen, (expval < 0) ? -expval : expval, expval < 0, 10, 0, minwidth-1, FLAGS_ZEROPAD | FLAGS_PLUS);
-    if (flags & FLAGS_LEFT) { /* right-pad spaces */ 
-      while (idx - start_idx < width) (*out)(' ', data, idx++, maxlen);
-    }
+    /* in "%g" mode, "prec" is the number of *significant figures* */
+    if (prec == 0U) prec = 1U;
+    if (value != 0.0) n = _dtod(value, (int)prec, false, &dig[0], &dexp);
+    if (n == 0) dexp = 0;
+    /* use "%f" mode if the exponent is in [-4, prec), trailing zeros are kept */
+    if (dexp >= -4 && dexp < (int)prec) {
+      prec = (unsigned)((int)prec - 1 - dexp);
+      expform = false;
+    } else --prec;
+  } else {
+    if (value != 0.0) n = _dtod(value, (int)prec + 1, false, &dig[0], &dexp);
+    if (n == 0) dexp = 0;
   }
-
-  return idx;
+  return _dtoa_format(out, data, idx, maxlen, &dig[0], n, dexp, negative, expform, prec, width, flags);
 }
 
 /* internal hexadecimal ftoa variant for exponential floating-point type */
@@ -1371,7 +1766,7 @@ static size_t _atoa(out_fct_t out, void *data, size_t idx, size_t maxlen, double
   } while (val && (len < PRINTF_ATOA_BUFFER_SIZE));
   if (len < PRINTF_ATOA_BUFFER_SIZE) buf[len++] = vneg ? '-' : '+';
   if (len < PRINTF_ATOA_BUFFER_SIZE) buf[len++] = flags & FLAGS_UPPERCASE ? 'P' : 'p';
-  while ((len < PRINTF_FTOA_BUFFER_SIZE) && (prec > PRINTF_DEFAULT_HEXFL_PRECISION)) {
+  while ((len < PRINTF_ATOA_BUFFER_SIZE) && (prec > PRINTF_DEFAULT_HEXFL_PRECISION)) {
     buf[len++] = '0';
     --prec;
   }
@@ -1598,11 +1993,21 @@ static int _vsnprintf(out_fct_t out, void *data, const size_t maxlen, const char
   return (int)idx; /* # of written chars sans \0 */
 }
 
+/* internal vfprintf */
+static int _vfprintf(FILE *fp, const char *format, va_list va)
+{
+  outchunk_t chunk; 
+  chunk.fp = fp; chunk.len = 0;
+  const int ret = _vsnprintf(&_out_chunk, &chunk, SIZE_MAX, format, va);
+  if (chunk.len > 0) fwrite(&chunk.buf[0], 1, chunk.len, fp);
+  return ret;
+}
+
 int fprintf(FILE *fp, const char *format, ...)
 {
   va_list va;
   va_start(va, format);
-  const int ret = _vsnprintf(&_out_file, fp, SIZE_MAX, format, va);
+  const int ret = _vfprintf(fp, format, va);
   va_end(va);
   return ret;
 }
@@ -1611,7 +2016,7 @@ int printf(const char* format, ...)
 {
   va_list va;
   va_start(va, format);
-  const int ret = _vsnprintf(&_out_file, stdout, SIZE_MAX, format, va);
+  const int ret = _vfprintf(stdout, format, va);
   va_end(va);
   return ret;
 }
@@ -1636,12 +2041,12 @@ int snprintf(char* buf, size_t count, const char* format, ...)
 
 int vprintf(const char* format, va_list va)
 {
-  return _vsnprintf(&_out_file, stdout, SIZE_MAX, format, va);
+  return _vfprintf(stdout, format, va);
 }
 
 int vfprintf(FILE *fp, const char *format, va_list va)
 {
-  return _vsnprintf(&_out_file, fp, SIZE_MAX, format, va);
+  return _vfprintf(fp, format, va);
 }
 
 int vsprintf(char* buf, const char* format, va_list va)
@@ -1654,6 +2059,37 @@ int vsnprintf(char* buf, size_t count, const char* format, va_list va)
   return _vsnprintf(&_out_buffer, buf, count, format, va);
 }
 
+/* shortest decimal form of value that reads back exactly: like %.17g, but with
+ * the fewest significant digits and no trailing zeros */
+int dtostr(char* buf, size_t count, double value)
+{
+  char dig[24];
+  union { uint64_t U; double F; } conv;
+  out_fct_t out = (buf != NULL) ? &_out_buffer : &_out_null;
+  int n = 0, dexp = 0; size_t idx; bool negative;
+  if ((value != value) || (value > DBL_MAX) || (value < -DBL_MAX)) {
+    idx = _ftoa(out, buf, 0, count, value, 0U, 0U, 0U);
+  } else {
+    conv.F = value; negative = (conv.U >> 63) != 0U;
+    if (negative) value = -value;
+    if (value != 0.0) {
+      int e10, k; bool exact;
+      uint64_t v = _ryu(value, true, &e10, &exact);
+      for (n = 0; v > 0U; v /= 10U) dig[n++] = (char)('0' + v % 10U);
+      for (k = 0; k < n / 2; ++k) { char c = dig[k]; dig[k] = dig[n-1-k]; dig[n-1-k] = c; }
+      while (n > 1 && dig[n-1] == '0') --n;
+      dexp = e10 + n - 1;
+    }
+    if (dexp < -4 || dexp >= 17) {
+      idx = _dtoa_format(out, buf, 0, count, &dig[0], n, dexp, negative, true, (unsigned)(n > 0 ? n - 1 : 0), 0U, 0U);
+    } else {
+      idx = _dtoa_format(out, buf, 0, count, &dig[0], n, dexp, negative, false, (unsigned)(n - 1 - dexp > 0 ? n - 1 - dexp : 0), 0U, 0U);
+    }
+  }
+  (*out)((char)0, buf, idx < count ? idx : count - 1U, count); /* \0 */
+  return (int)idx;
+}
+
 
 /* misc filesystem functions */
 
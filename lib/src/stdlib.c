@@ -130,75 +130,284 @@ long long atoll(const char *s)
   return neg ? n : -n;
 }
 
-/* poor man's strtod: rounding errors are possible in decimal, hex is exact */
+/* decimal strtod is correctly rounded: up to 19 significant digits are handled by
+ * Clinger's fast path or the Eisel-Lemire algorithm (D. Lemire, "Number Parsing at a
+ * Gigabyte per Second", 2021); ambiguous longer inputs are decided by exact big integer
+ * comparison with the halfway point between neighboring doubles */
+
+/* normalized 128-bit 5^q (hi, lo) for q = -342, -315, ..., 306; see pow5_128 */
+static const uint64_t pow5_128_anchors[50] = {
+  0xeef453d6923bd65aULL, 0x113faa2906a13b3fULL,
+  0xc1069cd4eabe89f8ULL, 0x999ec0bb696e840aULL,
+  0x9becce62836ac577ULL, 0x4ee367f9430aec32ULL,
+  0xfbe9141915d7a922ULL, 0x4bf1ff9f0062baa8ULL,
+  0xcb7ddcdda26da268ULL, 0xa9942f5dcf7dfd09ULL,
+  0xa46116538d0deb78ULL, 0x52d9be85f074e608ULL,
+  0x84c8d4dfd2c63f3bULL, 0x29ecd9f40041e073ULL,
+  0xd686619ba27255a2ULL, 0xc80a537b0efefebdULL,
+  0xad4ab7112eb3929dULL, 0x86c16c98d2c953c6ULL,
+  0x8bfbea76c619ef36ULL, 0x57eb4edb3c55b65aULL,
+  0xe2280b6c20dd5232ULL, 0x25c6da63c38de1b0ULL,
+  0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL,
+  0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL,
+  0xee6b280000000000ULL, 0x0000000000000000ULL,
+  0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL,
+  0x9b934c3b330c8577ULL, 0x63cc55f49f88eb2fULL,
+  0xfb5878494ace3a5fULL, 0x04ab48a04065c723ULL,
+  0xcb090c8001ab551cULL, 0x5cadf5bfd3072cc5ULL,
+  0xa402b9c5a8d3a6e7ULL, 0x5f16206c9c6209a6ULL,
+  0x847c9b5d7c2e09b7ULL, 0x69956135febada11ULL,
+  0xd60b3bd56a5586f1ULL, 0x8a71e223d8d3b074ULL,
+  0xace73cbfdc0bfb7bULL, 0x636cc64d1001550bULL,
+  0x8bab8eefb6409c1aULL, 0x1ad089b6c2f7548eULL,
+  0xe1a63853bbd26451ULL, 0x5e7873f8a0396973ULL,
+  0xb6472e511c81471dULL, 0xe0133fe4adf8e952ULL
+};
 
-#define MAX_BASE10_EXPONENT 511 /* largest possible base 10 exponent */
-#define MAX_BASE10_DIGS 18 /* more than this won't affect the result */
-static double powers_of_10[] = { 10., 100., 1.0e4, 1.0e8, 1.0e16, 1.0e32, 1.0e64, 1.0e128, 1.0e256 };
+/* 2-bit corrections (plus 1) to interpolated pow5_128 values, 16 per word */
+static const uint32_t pow5_128_offsets[41] = {
+  0x6a6aa995U, 0x6a5a6565U, 0x9a9a5a56U, 0xa69a9555U, 0x99a9aa9aU, 0x95655556U,
+  0x99a59656U, 0x565aa95aU, 0xeba655a5U, 0xaaaaaa6aU, 0x9a6a969aU, 0x9569a69aU,
+  0xa56956aaU, 0x595599a5U, 0x55555555U, 0xa595aa59U, 0x599aa9aaU, 0x55555555U,
+  0x55555555U, 0xab966556U, 0x555541faU, 0x44105555U, 0x55555555U, 0x55555555U,
+  0x55555555U, 0x99aaa555U, 0xa9696656U, 0xaaaa69a9U, 0x595aaa5aU, 0x55556aa5U,
+  0x55955955U, 0x56666555U, 0x69a69a95U, 0xa96aa966U, 0xaaa9a9aaU, 0x9aaa5a5aU,
+  0xa56aaa6aU, 0x5565565aU, 0xa5955696U, 0xa969aaaaU, 0x00156aabU
+};
 
-static double strtod_dec(const char *s, const char *pc, bool neg, char **endp)
+/* 5^0 .. 5^26 */
+static const uint64_t pow5_64[27] = {
+  1ULL, 5ULL, 25ULL, 125ULL,
+  625ULL, 3125ULL, 15625ULL, 78125ULL,
+  390625ULL, 1953125ULL, 9765625ULL, 48828125ULL,
+  244140625ULL, 1220703125ULL, 6103515625ULL, 30517578125ULL,
+  152587890625ULL, 762939453125ULL, 3814697265625ULL, 19073486328125ULL,
+  95367431640625ULL, 476837158203125ULL, 2384185791015625ULL, 11920928955078125ULL,
+  59604644775390625ULL, 298023223876953125ULL, 1490116119384765625ULL
+};
+
+/* exactly representable powers of 10 */
+static const double exact_powers_of_10[23] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+#define MAX_BASE10_DIGS 768 /* more than this won't affect the result, only their presence */
+#define BIGNUM_WORDS 90 /* 2^54*5^1111 fits in 90 32-bit words */
+
+/* full 64x64->128 multiplication: returns low part, stores high part in *phi */
+static uint64_t umul128(uint64_t a, uint64_t b, uint64_t *phi)
 {
-  bool negexp = false;
-  double fraction, exponent, *pd;
-  int c, exp = 0, fracexp = 0;
-  int mantsz = 0, dotpos = -1, expsz = -1;
-  const char *pexp;
+  uint64_t a0 = a & 0xFFFFFFFFULL, a1 = a >> 32, b0 = b & 0xFFFFFFFFULL, b1 = b >> 32;
+  uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+  uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFULL) + (p10 & 0xFFFFFFFFULL);
+  *phi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+  return (mid << 32) | (p00 & 0xFFFFFFFFULL);
+}
 
-  while (true) {
-    if (!isdigit(c = *pc)) {
-      if ((c != '.') || (dotpos >= 0)) break;
-      dotpos = mantsz;
+/* truncated normalized 128-bit 5^q for -342 <= q <= 308 (negative q: 2^k/5^-q + 1);
+ * interpolated from every 27th power and corrected by -1..2 */
+static void pow5_128(int q, uint64_t *res)
+{
+  int i = q + 342, a = i / 27, off = i % 27, lz;
+  uint64_t hi = pow5_128_anchors[a * 2], lo = pow5_128_anchors[a * 2 + 1], corr;
+  if (off > 0) {
+    uint64_t m = pow5_64[off], p0, p1, h0, h1;
+    p0 = umul128(m, lo, &h0);
+    p1 = umul128(m, hi, &h1);
+    p1 += h0; if (p1 < h0) ++h1;
+    lz = (int)_clz(h1); /* h1 != 0 since hi >= 2^63 and m >= 5 */
+    if (lz == 0) { hi = h1; lo = p1; }
+    else { hi = (h1 << lz) | (p1 >> (64 - lz)); lo = (p1 << lz) | (p0 >> (64 - lz)); }
+  }
+  corr = (pow5_128_offsets[i / 16] >> ((i % 16) << 1)) & 3U;
+  if (corr == 0U) { if (lo-- == 0U) --hi; }
+  else { lo += corr - 1U; if (lo < corr - 1U) ++hi; }
+  res[0] = hi; res[1] = lo;
+}
+
+/* Eisel-Lemire: bits of the double nearest to w*10^q, w != 0, -342 <= q <= 308 */
+static uint64_t eisel_lemire(uint64_t w, int q)
+{
+  uint64_t hi, lo, mant, pow5[2]; int lz, upper, p2;
+  pow5_128(q, &pow5[0]);
+  lz = (int)_clz(w); w <<= lz;
+  lo = umul128(w, pow5[0], &hi);
+  if ((hi & 0x1FFU) == 0x1FFU) { /* low bits may be affected by the second product */
+    uint64_t h2; umul128(w, pow5[1], &h2);
+    lo += h2; if (lo < h2) ++hi;
+  }
+  upper = (int)(hi >> 63);
+  mant = hi >> (upper + 9);
+  p2 = (((152170 + 65536) * q) >> 16) + 63 + upper - lz + 1023;
+  if (p2 <= 0) { /* subnormal */
+    if (-p2 + 1 >= 64) return 0U;
+    mant >>= -p2 + 1;
+    mant += mant & 1U; mant >>= 1;
+    return mant;
+  }
+  if (lo <= 1U && q >= -4 && q <= 23 && (mant & 3U) == 1U) { /* exactly halfway: round to even */
+    if ((mant << (upper + 9)) == hi) mant &= ~1ULL;
+  }
+  mant += mant & 1U; mant >>= 1;
+  if (mant >= (2ULL << 52)) { mant = 1ULL << 52; ++p2; }
+  mant &= ~(1ULL << 52);
+  if (p2 >= 0x7FF) return 0x7FF0000000000000ULL;
+  return mant | ((uint64_t)p2 << 52);
+}
+
+/* x = x*m + a for bignum x of *pn 32-bit words */
+static void bignum_muladd(uint32_t *x, int *pn, uint32_t m, uint32_t a)
+{
+  uint64_t carry = a; int i;
+  for (i = 0; i < *pn; ++i) {
+    uint64_t t = (uint64_t)x[i] * m + carry;
+    x[i] = (uint32_t)t; carry = t >> 32;
+  }
+  if (carry != 0U && *pn < BIGNUM_WORDS) x[(*pn)++] = (uint32_t)carry;
+}
+
+/* x = x*5^k */
+static void bignum_mulpow5(uint32_t *x, int *pn, int k)
+{
+  for (; k > 0; k -= 13) bignum_muladd(x, pn, (uint32_t)pow5_64[k < 13 ? k : 13], 0U);
+}
+
+/* x = x*2^k */
+static void bignum_shl(uint32_t *x, int *pn, int k)
+{
+  int ws = k / 32, bs = k % 32, i, n = *pn;
+  if (bs != 0) {
+    uint32_t carry = 0;
+    for (i = 0; i < n; ++i) {
+      uint32_t t = x[i];
+      x[i] = (t << bs) | carry; carry = t >> (32 - bs);
     }
-    ++pc; ++mantsz;
+    if (carry != 0U && n < BIGNUM_WORDS) x[n++] = carry;
   }
-  pexp = pc; pc -= mantsz;
-  if (dotpos < 0) dotpos = mantsz; 
-  else --mantsz;
-  if (mantsz > MAX_BASE10_DIGS) mantsz = MAX_BASE10_DIGS;
-  fracexp = dotpos - mantsz;
-  if (mantsz == 0) {
-    if (endp != NULL) *endp = (char*)s;
-    return 0.0;
-  } else {
-    long long frac = 0LL;
-    while (mantsz-- > 0) {
-      if ((c = *pc++) == '.') c = *pc++;
-      frac = 10LL * frac + (c - '0');
+  if (ws > 0 && n + ws <= BIGNUM_WORDS) {
+    for (i = n - 1; i >= 0; --i) x[i + ws] = x[i];
+    for (i = 0; i < ws; ++i) x[i] = 0;
+    n += ws;
+  }
+  *pn = n;
+}
+
+/* compare d*10^q with the halfway point between doubles with bits b and b+1;
+ * d is given by nd digits at pc, possibly interspersed with a '.' */
+static int bignum_cmphalf(const char *pc, int nd, int q, uint64_t b)
+{
+  uint32_t x[BIGNUM_WORDS], y[BIGNUM_WORDS]; int nx = 1, ny = 2, s, i;
+  uint64_t m = b & ((1ULL << 52) - 1U); int e = (int)(b >> 52);
+  if (e == 0) e = -1074; else { m |= 1ULL << 52; e -= 1075; }
+  m = 2U * m + 1U; /* halfway is m*2^(e-1) */
+  x[0] = 0; y[0] = (uint32_t)m; y[1] = (uint32_t)(m >> 32);
+  while (nd > 0) {
+    uint32_t chunk = 0, scale = 1;
+    for (i = 0; i < 9 && nd > 0; ++i, --nd) {
+      if (*pc == '.') ++pc;
+      chunk = chunk * 10U + (uint32_t)(*pc++ - '0'); scale *= 10U;
     }
-    fraction = (double)frac;
+    bignum_muladd(&x[0], &nx, scale, chunk);
   }
-  pc = pexp;
-  if ((*pc == 'E') || (*pc == 'e')) {
-    expsz = 0;
-    if (*++pc == '-') { ++pc; negexp = true; }
-    else if (*pc == '+') ++pc;
-    while (isdigit(*pc)) {
-      exp = exp * 10 + (*pc++ - '0');
-      ++expsz;
+  if (q >= 0) bignum_mulpow5(&x[0], &nx, q);
+  else bignum_mulpow5(&y[0], &ny, -q);
+  s = q - (e - 1);
+  if (s >= 0) bignum_shl(&x[0], &nx, s);
+  else bignum_shl(&y[0], &ny, -s);
+  while (nx > 1 && x[nx-1] == 0U) --nx;
+  while (ny > 1 && y[ny-1] == 0U) --ny;
+  if (nx != ny) return nx < ny ? -1 : 1;
+  for (i = nx - 1; i >= 0; --i) {
+    if (x[i] != y[i]) return x[i] < y[i] ? -1 : 1;
+  }
+  return 0;
+}
+
+/* correct bits b of an approximation to d*10^q; sticky is set if d was truncated */
+static uint64_t strtod_slow(const char *pc, int nd, int q, bool sticky, uint64_t b)
+{
+  int c;
+  if (b >= 0x7FF0000000000000ULL) b = 0x7FEFFFFFFFFFFFFFULL;
+  while (b > 0U) { /* go down while d*10^q does not round above b-1 */
+    c = bignum_cmphalf(pc, nd, q, b - 1U);
+    if (c > 0 || (c == 0 && (sticky || ((b - 1U) & 1U)))) break;
+    --b;
+  }
+  while (b < 0x7FF0000000000000ULL) { /* go up while d*10^q rounds above b */
+    c = bignum_cmphalf(pc, nd, q, b);
+    if (c < 0 || (c == 0 && !sticky && !(b & 1U))) break;
+    ++b;
+  }
+  return b;
+}
+
+static double strtod_dec(const char *s, const char *pc, bool neg, char **endp)
+{
+  union { uint64_t U; double F; } conv;
+  uint64_t w = 0U; bool dot = false, any = false, trunc = false, negexp = false;
+  int nd = 0, nw = 0, q = 0, exp = 0;
+  const char *pd = NULL, *pm;
+  while (true) { /* w takes first 19 significant digits, q is the decimal exponent */
+    int c = *pc;
+    if (c == '.' && !dot) dot = true;
+    else if (!isdigit(c)) break;
+    else {
+      any = true;
+      if (nd == 0 && c == '0') {
+        if (dot) --q;
+      } else {
+        if (nd++ == 0) pd = pc;
+        if (nw < 19) { w = 10U * w + (uint64_t)(c - '0'); ++nw; if (dot) --q; }
+        else { if (c != '0') trunc = true; if (!dot) ++q; }
+      }
     }
+    ++pc;
   }
-  if (expsz == 0) {
+  if (!any) {
     if (endp != NULL) *endp = (char*)s;
     return 0.0;
   }
-  if (negexp) exp = fracexp - exp;
-  else exp = fracexp + exp;
-  if (exp < 0) { negexp = true; exp = -exp; } 
-  else negexp = false;
-  if (exp > MAX_BASE10_EXPONENT) {
-    if (endp != NULL) *endp = (char *)pc;
-    errno = ERANGE;
-    return neg ? -HUGE_VAL : HUGE_VAL;
-  }
-  exponent = 1.0;
-  for (pd = &powers_of_10[0]; exp != 0; exp >>= 1, ++pd) {
-    if (exp & 1) exponent *= *pd;
+  pm = pc;
+  if ((*pc == 'E') || (*pc == 'e')) {
+    const char *pe = pc + 1;
+    if (*pe == '-') { ++pe; negexp = true; }
+    else if (*pe == '+') ++pe;
+    if (isdigit(*pe)) {
+      while (isdigit(*pe)) {
+        if (exp < 100000) exp = exp * 10 + (*pe - '0');
+        ++pe;
+      }
+      pc = pe;
+    }
   }
-  if (negexp) fraction /= exponent;
-  else fraction *= exponent;
-
   if (endp != NULL) *endp = (char *)pc;
-  return neg ? -fraction : fraction;
+  q = negexp ? q - exp : q + exp;
+  if (w == 0U || q < -342) { /* (negative) zero or underflow */
+    if (w != 0U) errno = ERANGE;
+    conv.U = 0U;
+  } else if (q > 308) { /* overflow */
+    errno = ERANGE;
+    conv.U = 0x7FF0000000000000ULL;
+  } else if (!trunc && w <= (1ULL << 53) && q >= -22 && q <= 22) { /* exact */
+    conv.F = (double)w;
+    if (q < 0) conv.F /= exact_powers_of_10[-q];
+    else conv.F *= exact_powers_of_10[q];
+  } else {
+    conv.U = eisel_lemire(w, q);
+    if (trunc && eisel_lemire(w + 1U, q) != conv.U) {
+      /* w*10^q and (w+1)*10^q differ: take all digits into account */
+      int nt = nd < MAX_BASE10_DIGS ? nd : MAX_BASE10_DIGS; bool sticky = false;
+      if (nd > nt) { /* check truncated digits for non-zeros */
+        const char *pt = pd; int i;
+        for (i = 0; i < nt; ++i) { if (*pt == '.') ++pt; ++pt; }
+        for (; pt < pm && !sticky; ++pt) sticky = *pt != '0' && *pt != '.';
+      }
+      conv.U = strtod_slow(pd, nt, q + nw - nt, sticky, conv.U);
+    }
+    if (conv.U == 0U || conv.U == 0x7FF0000000000000ULL) errno = ERANGE;
+  }
+  return neg ? -conv.F : conv.F;
 }
 
 #define MAX_BASE2_EXPONENT 1024 /* largest possible base 2 exponent */
@@ -432,8 +641,8 @@ void abort(void)
 
 int atexit(onterm_func_t fn)
 {
-  if (onterm_count < ONTERM_MAX) {
-    onterm_funcs[onterm_count++] = fn;
+  if (onterm_count[0] < ONTERM_MAX) {
+    onterm_funcs[onterm_count[0]++] = fn;
     return 0;
   } 
   return -1;
@@ -485,7 +694,7 @@ char *getenv(const char *name)
     initialize_environ();
     char **env;
     for (env = _environ; *env; ++env) {
-      if (strncmp(name, *env, len) && (*env)[len] == '=')
+      if (strncmp(name, *env, len) == 0 && (*env)[len] == '=')
         return *env + len + 1;
     }
   }
@@ -572,26 +781,26 @@ static header_t *sbrkblock(size_t bi)
   return p;
 }
 
-static void pushblock(size_t bi, void *pb);
+/* NB: non-recursive, so stack usage analysis can bound malloc's stack */
 static header_t *pullblock(size_t bi)
 {
-  header_t *pbi = buckets[bi];
-  if (pbi != NULL) {
-    if (pbi->free.next != NULL) pbi->free.next->free.prev = NULL;
-    buckets[bi] = pbi->free.next;
-    return pbi;
+  header_t *pb, *pbi; size_t bj = bi;
+  /* take a block from the smallest non-empty bucket or get a new one */
+  while (bj < SBRKBUCKET && buckets[bj] == NULL) ++bj;
+  if ((pb = buckets[bj]) != NULL) {
+    if (pb->free.next != NULL) pb->free.next->free.prev = NULL;
+    buckets[bj] = pb->free.next;
+  } else if ((pb = sbrkblock(bj)) == NULL) {
+    return NULL;
   }
-  if (bi < SBRKBUCKET) {
-    header_t *pb = pullblock(bi + 1);
-    if (pb != NULL) {
-      header_t *pb2 = (header_t *)((char*)pb + BI2BLKSZ(bi));
-      if ((pbi = buckets[bi]) != NULL) pbi->free.prev = pb2;
-      pb2->free.next = pbi; pb2->free.prev = NULL;
-      buckets[bi] = pb2;
-    }
-    return pb;
+  /* split it down to bi, putting upper halves into their buckets */
+  while (bj > bi) {
+    header_t *pb2 = (header_t *)((char*)pb + BI2BLKSZ(--bj));
+    if ((pbi = buckets[bj]) != NULL) pbi->free.prev = pb2;
+    pb2->free.next = pbi; pb2->free.prev = NULL;
+    buckets[bj] = pb2;
   }
-  return sbrkblock(bi);
+  return pb;
 }
 
 static void unlinkblock(size_t bi, header_t *pb)
@@ -644,7 +853,22 @@ static size_t findbktidx(size_t payload)
   return NBUCKETS;
 }
 
-void *realloc(void *p, size_t n)
+static void *xmalloc(size_t n)
+{
+  size_t bi = findbktidx(n);
+  if (bi < NBUCKETS) {
+    header_t *pb = pullblock(bi);
+    if (pb != NULL) {
+      pb->used.plsz = n;
+      pb->used.ff = (uint8_t)0xff;
+      pb->used.bi = (uint8_t)bi;
+      return pb+1;
+    }
+  }
+  return NULL;
+}
+
+static void *xrealloc(void *p, size_t n)
 {
   if (p != NULL) { /* realloc or free */
     header_t *pb = (header_t*)p - 1;
@@ -657,7 +881,7 @@ void *realloc(void *p, size_t n)
         pb->used.plsz = n;
         return p;
       } else {
-        void *np = realloc(NULL, n); /* malloc */
+        void *np = xmalloc(n);
         size_t orgn = pb->used.plsz;
         if (np != NULL) memcpy(np, p, n < orgn ? n : orgn);
         pushblock(bi, pb);
@@ -667,20 +891,25 @@ void *realloc(void *p, size_t n)
       pushblock(bi, pb);
     }
   } else { /* malloc */
-    size_t bi = findbktidx(n);
-    if (bi < NBUCKETS) {
-      header_t *pb = pullblock(bi);
-      if (pb != NULL) {
-        pb->used.plsz = n;
-        pb->used.ff = (uint8_t)0xff;
-        pb->used.bi = (uint8_t)bi;
-        return pb+1;
-      }
-    }
+    return xmalloc(n);
   }
   return NULL;  
 }
 
+/* allocator lock hooks, set once threads are created */
+void (*_malloc_lock)(void) = NULL;
+void (*_malloc_unlock)(void) = NULL;
+
+void *realloc(void *p, size_t n)
+{
+  void *np;
+  if (_malloc_lock == NULL) return xrealloc(p, n);
+  (*_malloc_lock)();
+  np = xrealloc(p, n);
+  (*_malloc_unlock)();
+  return np;
+}
+
 void *malloc(size_t n)
 {
   return realloc(NULL, n);
@@ -62,7 +62,10 @@ static struct tm gmtime_buf;
 /* timezone internals */
 static char _tzname[2][TZ_STRLEN_MAX + 1];
 static char	_tzval[TZ_STRLEN_MAX + 1];
-static int	_tzset = 0;
+/* in memory, so threads share them with the arrays above; per-thread
+ * timezone is refreshed from _tzoff by tzset */
+static int	_tzset[1];
+static long _tzoff[1];
 static char _tzdflt[] = {(char)' ', (char)' ', (char)' ', (char)0};
 /* public globals */
 long  timezone = 0;
@@ -91,25 +94,48 @@ double difftime(time_t t1, time_t t0)
   return t1-t0;
 }
 
-static int secs_to_tm(long long t, struct tm *ptm)
+int clock_gettime(clockid_t clk, struct timespec *ts)
 {
-  long long days, secs, years;
-  int remdays, remsecs, remyears;
-  int qc_cycles, c_cycles, q_cycles;
-  int months;
-  int wday, yday, leap;
-
-  /* reject time_t values whose year would overflow int */
-  if (t < INT_MIN * 31622400LL || t > INT_MAX * 31622400LL)
+  timestamp_t t = 0;
+  errno_t error = clock_time_get(clk, 1LL, &t);
+  if (error != 0) {
+    errno = (int)error;
     return -1;
+  }
+  ts->tv_sec = (time_t)(t / 1000000000);
+  ts->tv_nsec = (long)(t % 1000000000);
+  return 0;
+}
 
-  secs = t - LEAPOCH;
-  days = secs / 86400;
-  remsecs = (int)(secs % 86400);
-  if (remsecs < 0) {
-    remsecs += 86400;
-    --days;
+int clock_getres(clockid_t clk, struct timespec *ts)
+{
+  timestamp_t t = 0;
+  errno_t error = clock_res_get(clk, &t);
+  if (error != 0) {
+    errno = (int)error;
+    return -1;
   }
+  if (ts != NULL) {
+    ts->tv_sec = (time_t)(t / 1000000000);
+    ts->tv_nsec = (long)(t % 1000000000);
+  }
+  return 0;
+}
+
+/* date part of the last breakdown by non-reentrant functions: successive
+ * timestamps (e.g. in logs) usually fall on the same day, so it is reused
+ * instead of recomputed; _r functions do not share it. NB: kept in memory
+ * (not in scalar globals) so all threads see the days/date pair together */
+static long long cached_days[1] = { LLONG_MIN };
+static struct tm cached_date;
+
+static int days_to_tm(long long days, struct tm *ptm)
+{
+  long long years;
+  int remdays, remyears;
+  int qc_cycles, c_cycles, q_cycles;
+  int months;
+  int wday, yday, leap;
 
   wday = (int)((3+days) % 7);
   if (wday < 0) wday += 7;
@@ -156,6 +182,42 @@ static int secs_to_tm(long long t, struct tm *ptm)
   ptm->tm_wday = wday;
   ptm->tm_yday = yday;
 
+  return 0;
+}
+
+static int secs_to_tm(long long t, struct tm *ptm, bool cached)
+{
+  long long days, secs;
+  int remsecs;
+
+  /* reject time_t values whose year would overflow int */
+  if (t < INT_MIN * 31622400LL || t > INT_MAX * 31622400LL)
+    return -1;
+
+  secs = t - LEAPOCH;
+  days = secs / 86400;
+  remsecs = (int)(secs % 86400);
+  if (remsecs < 0) {
+    remsecs += 86400;
+    --days;
+  }
+
+  if (!cached) {
+    if (days_to_tm(days, ptm) < 0)
+      return -1;
+  } else {
+    if (days != cached_days[0]) {
+      if (days_to_tm(days, &cached_date) < 0)
+        return -1;
+      cached_days[0] = days;
+    }
+    ptm->tm_year = cached_date.tm_year;
+    ptm->tm_mon = cached_date.tm_mon;
+    ptm->tm_mday = cached_date.tm_mday;
+    ptm->tm_wday = cached_date.tm_wday;
+    ptm->tm_yday = cached_date.tm_yday;
+  }
+
   ptm->tm_hour = remsecs / 3600;
   ptm->tm_min = remsecs / 60 % 60;
   ptm->tm_sec = remsecs % 60;
@@ -163,9 +225,9 @@ static int secs_to_tm(long long t, struct tm *ptm)
   return 0;
 }
 
-struct tm *gmtime_r(const time_t *pt, struct tm *ptm)
+static struct tm *gmtime_c(time_t t, struct tm *ptm, bool cached)
 {
-  if (secs_to_tm(*pt, ptm) < 0) {
+  if (secs_to_tm(t, ptm, cached) < 0) {
     errno = EOVERFLOW;
     return NULL;
   }
@@ -173,6 +235,11 @@ struct tm *gmtime_r(const time_t *pt, struct tm *ptm)
   return ptm;
 }
 
+struct tm *gmtime_r(const time_t *pt, struct tm *ptm)
+{
+  return gmtime_c(*pt, ptm, false);
+}
+
 static const char *get_tz_name(const char *src, char *dest)
 {
   int tzlen = 0;
@@ -194,7 +261,7 @@ static const char *get_tz_name(const char *src, char *dest)
 static const char *get_tz_offset(const char *src, int *error)
 {
   if (*src == '\0') {
-    timezone = 0;
+    _tzoff[0] = 0;
     *error   = 0;
   } else {
     enum { Hours, Minutes, Seconds };
@@ -229,21 +296,22 @@ static const char *get_tz_offset(const char *src, int *error)
     if (tim[Minutes] > 59 || tim[Seconds] > 59) { /* invalid minutes or seconds */
       mul = 0L;
     }
-    timezone = mul * ((long)tim[Seconds] + 60L * (long)tim[Minutes] + 3600L * (long)tim[Hours]);
+    _tzoff[0] = mul * ((long)tim[Seconds] + 60L * (long)tim[Minutes] + 3600L * (long)tim[Hours]);
     *error = (mul == 0L);
   }
   return src;
 }
 
-/* tzset() relies on TZ env variable */
+/* tzset() relies on TZ env variable; it is parsed only when it changes */
 void tzset(void)
 {
   const char* tzval = getenv("TZ");
   if (tzval == NULL) tzval = "";
-  if (!_tzset || strcmp(_tzval, tzval) != 0) {
+  if (!_tzset[0] || strcmp(_tzval, tzval) != 0) {
     int error;
-    _tzset = (strlen(tzval) <= TZ_STRLEN_MAX);
-    if (_tzset) strcpy(_tzval, tzval);
+    /* values too long to be kept are parsed anew on each call */
+    _tzset[0] = (strlen(tzval) <= TZ_STRLEN_MAX);
+    if (_tzset[0]) strcpy(_tzval, tzval);
     tzval = get_tz_name(tzval, _tzname[0]);
     tzval = get_tz_offset(tzval, &error);
     if (error) {
@@ -255,30 +323,44 @@ void tzset(void)
       tzname[1] = _tzname[1];
     }
   }
+  timezone = _tzoff[0];
 }
 
 time_t mktime(struct tm *tm)
 {
   long tyears, tdays, leaps, utc_hrs;
-  int leap_year;
+  int leap_year, year = tm->tm_year, mon = tm->tm_mon;
+  time_t t;
 
   tzset();
-  leap_year = is_leap(tm->tm_year + 1900);
-  tyears = tm->tm_year - 70;
+  year += mon / 12; mon %= 12;
+  if (mon < 0) {
+    mon += 12;
+    --year;
+  }
+  leap_year = is_leap(year + 1900);
+  tyears = year - 70;
   leaps = (tyears + 2) / 4;
   if (tyears < 0) {
     leaps = (tyears - 2) / 4;
-    if (leap_year && tm->tm_mon > 1) ++leaps;
+    if (leap_year && mon > 1) ++leaps;
   } else {
     leaps = (tyears + 2) / 4; /* no of next two lines until year 2100. */
-    if (leap_year && (tm->tm_mon == 0 || tm->tm_mon == 1)) --leaps;
+    if (leap_year && (mon == 0 || mon == 1)) --leaps;
   }
-  tdays = (tm->tm_mon > 0) ? mon_days[tm->tm_mon - 1] : 0;
+  tdays = (mon > 0) ? mon_days[mon - 1] : 0;
   tdays += tm->tm_mday - 1; /* days of month passed. */
   tdays += (tyears * 365) + leaps;
   utc_hrs = tm->tm_hour;
 
-  return (tdays * 86400L) + (utc_hrs * 3600L) + ((long)tm->tm_min * 60L) + (long)tm->tm_sec + timezone;
+  t = (time_t)tdays * 86400 + (time_t)utc_hrs * 3600 + (time_t)tm->tm_min * 60 + (time_t)tm->tm_sec + timezone;
+  /* normalize fields and fill in tm_wday/tm_yday */
+  if (secs_to_tm(t - timezone, tm, false) < 0) {
+    errno = EOVERFLOW;
+    return (time_t)-1;
+  }
+  tm->tm_isdst = 0;
+  return t;
 }
 
 char *asctime_r(const struct tm *ptm, char *buf)
@@ -292,12 +374,15 @@ char *asctime_r(const struct tm *ptm, char *buf)
   return buf;
 }
 
+static struct tm *localtime_c(time_t t, struct tm *ptm, bool cached)
+{
+  if (!_tzset[0]) tzset(); /* POSIX does not require localtime_r to re-check TZ */
+  return gmtime_c(t - (time_t)_tzoff[0], ptm, cached);
+}
+
 struct tm *localtime_r(const time_t *pt, struct tm *ptm)
 {
-  time_t t = *pt;
-  tzset();
-  t -= (time_t)timezone;
-  return gmtime_r(&t, ptm);
+  return localtime_c(*pt, ptm, false);
 }
 
 char *ctime_r(const time_t *pt, char *buf)
@@ -311,7 +396,7 @@ char *ctime_r(const time_t *pt, char *buf)
 
 struct tm *gmtime(const time_t *pt)
 {
-  return gmtime_r(pt, &gmtime_buf);
+  return gmtime_c(*pt, &gmtime_buf, true);
 }
 
 char *asctime(const struct tm *ptm)
@@ -321,12 +406,12 @@ char *asctime(const struct tm *ptm)
 
 struct tm *localtime(const time_t* pt)
 {
-  return localtime_r(pt, &gmtime_buf);
+  return localtime_c(*pt, &gmtime_buf, true);
 }
 
 char *ctime(const time_t *pt)
 {
-  struct tm *ptm = localtime_r(pt, &gmtime_buf);
+  struct tm *ptm = localtime_c(*pt, &gmtime_buf, true);
   if (!ptm) return NULL;
   return asctime_r(ptm, &asctime_buf[0]);
 }
@@ -3,14 +3,19 @@
 #include <stdint.h>
 #include <string.h>
 #include <errno.h>
+#include <limits.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/crt.h>
 
 static_assert(SEEK_SET == WHENCE_SET);
 static_assert(SEEK_CUR == WHENCE_CUR);
 static_assert(SEEK_END == WHENCE_END);
 static_assert(sizeof(off_t) == sizeof(filesize_t));
 static_assert(sizeof(off_t) == sizeof(filedelta_t));
+static_assert(sizeof(struct iovec) == sizeof(iovec_t));
+static_assert(sizeof(struct iovec) == sizeof(ciovec_t));
+static_assert(offsetof(struct iovec, iov_len) == offsetof(iovec_t, buf_len));
 
 ssize_t read(int fd, void *buf, size_t nbyte) 
 {
@@ -39,6 +44,36 @@ ssize_t write(int fd, const void *buf, size_t nbyte)
   return (ssize_t)bytes_written;
 }
 
+ssize_t readv(int fd, const struct iovec *iov, int iovcnt) 
+{
+  errno_t err; size_t bytes_read;
+  if (iovcnt < 0 || iovcnt > IOV_MAX) {
+    errno = EINVAL;
+    return -1;
+  }
+  err = fd_read(fd, (const iovec_t *)iov, (size_t)iovcnt, &bytes_read);
+  if (err != 0) {
+    errno = (err == ERRNO_NOTCAPABLE) ? EBADF : (int)err;
+    return -1;
+  }
+  return (ssize_t)bytes_read;
+}
+
+ssize_t writev(int fd, const struct iovec *iov, int iovcnt) 
+{
+  errno_t err; size_t bytes_written;
+  if (iovcnt < 0 || iovcnt > IOV_MAX) {
+    errno = EINVAL;
+    return -1;
+  }
+  err = fd_write(fd, (const ciovec_t *)iov, (size_t)iovcnt, &bytes_written);
+  if (err != 0) {
+    errno = (err == ERRNO_NOTCAPABLE) ? EBADF : (int)err;
+    return -1;
+  }
+  return (ssize_t)bytes_written;
+}
+
 ssize_t pread(int fd, void *buf, size_t nbyte, off_t offset) 
 {
   iovec_t iov; 
@@ -138,14 +173,32 @@ int isatty(int fd)
   return 1;
 }
 
+/* program break starts at the first page boundary after heap_base, so
+ * the heap can use the rest of initial memory; memory itself is grown
+ * by at least half of its current size, so gradually growing heaps
+ * need few memory.grow calls */
+static char *curbrk[1]; /* in memory, so it is shared by threads */
+
 void *sbrk(intptr_t inc) /* inc should be a multiple of 64K */
 {
   assert(inc >= 0 && (inc & 0xFFFF) == 0);
-  if (!inc) return (void *)asm(memory.size, i32.const 16, i32.shl);
-  size_t new = (size_t)inc >> 16;
-  size_t old = (size_t)asm(i32.const 0, local.get new, memory.grow);
-  if (old == SIZE_MAX) { errno = ENOMEM; return (void *)-1; }
-  return (void *)(old << 16);
+  if (curbrk[0] == NULL) {
+    size_t hb = ((size_t)heap_base + 0xFFFF) & ~(size_t)0xFFFF;
+    curbrk[0] = (char *)hb;
+  }
+  size_t end = (size_t)asm(memory.size, i32.const 16, i32.shl);
+  size_t avail = end - (size_t)curbrk[0];
+  if ((size_t)inc > avail) {
+    size_t need = ((size_t)inc - avail) >> 16, more = end >> 17;
+    if (more < need) more = need;
+    size_t old = (size_t)asm(local.get more, memory.grow);
+    if (old == SIZE_MAX && more > need) /* try without extra */
+      old = (size_t)asm(local.get need, memory.grow);
+    if (old == SIZE_MAX) { errno = ENOMEM; return (void *)-1; }
+  }
+  char *p = curbrk[0];
+  curbrk[0] += inc;
+  return p;
 }
 
 int faccessat(int fd, const char *path, int amode, int atflag) 
@@ -0,0 +1,285 @@
+/* Vector math */
+
+#include <stdint.h>
+#include <math.h>
+#include <wasm_simd128.h>
+
+/* vector versions follow the scalar algorithms of the math module:
+ * double-precision ones use fdlibm's argument reduction and kernels,
+ * single-precision ones use Cephes' polynomials (Stephen L. Moshier);
+ * lanes are checked for the range where the branch-free code is valid
+ * and the whole vector falls back to the scalar functions otherwise */
+
+/* constants as bit patterns */
+#define D(u) wasm_i64x2_const_splat(u)
+#define F(u) wasm_u32x4_const_splat(u)
+
+#define f64x2_lane_apply(f, x) \
+  (wasm_f64x2_make(f(wasm_f64x2_extract_lane(x, 0)), f(wasm_f64x2_extract_lane(x, 1))))
+#define f32x4_lane_apply(f, x) \
+  (wasm_f32x4_make(f(wasm_f32x4_extract_lane(x, 0)), f(wasm_f32x4_extract_lane(x, 1)), \
+                   f(wasm_f32x4_extract_lane(x, 2)), f(wasm_f32x4_extract_lane(x, 3))))
+
+/* f64x2 */
+
+#define d_one      0x3FF0000000000000ULL /* 1.0 */
+#define d_two      0x4000000000000000ULL /* 2.0 */
+#define d_half     0x3FE0000000000000ULL /* 0.5 */
+#define d_shift    0x4338000000000000ULL /* 0x1.8p52 */
+#define d_sqrt1_2  0x3FE6A09E667F3BCDULL /* sqrt(1/2) */
+#define d_min      0x0010000000000000ULL /* DBL_MIN */
+#define d_inf      0x7FF0000000000000ULL /* +inf */
+#define d_expmin   0xC086200000000000ULL /* -708 */
+#define d_expmax   0x4086280000000000ULL /* 709 */
+#define d_trigmax  0x4129000000000000ULL /* 819200 < 2^19*pi/2 */
+#define ivln2      0x3FF71547652B82FEULL
+#define ln2_hi     0x3FE62E42FEE00000ULL
+#define ln2_lo     0x3DEA39EF35793C76ULL
+#define invpio2    0x3FE45F306DC9C883ULL
+#define pio2_1     0x3FF921FB54400000ULL
+#define pio2_2     0x3DD0B4611A600000ULL
+#define pio2_2t    0x3BA3198A2E037073ULL
+#define P1         0x3FC555555555553EULL
+#define P2         0xBF66C16C16BEBD93ULL
+#define P3         0x3F11566AAF25DE2CULL
+#define P4         0xBEBBBD41C5D26BF1ULL
+#define P5         0x3E66376972BEA4D0ULL
+#define Lg1        0x3FE5555555555593ULL
+#define Lg2        0x3FD999999997FA04ULL
+#define Lg3        0x3FD2492494229359ULL
+#define Lg4        0x3FCC71C51D8E78AFULL
+#define Lg5        0x3FC7466496CB03DEULL
+#define Lg6        0x3FC39A09D078C69FULL
+#define Lg7        0x3FC2F112DF3E5244ULL
+#define S1         0xBFC5555555555549ULL
+#define S2         0x3F8111111110F8A6ULL
+#define S3         0xBF2A01A019C161D5ULL
+#define S4         0x3EC71DE357B1FE7DULL
+#define S5         0xBE5AE5E68A2B9CEBULL
+#define S6         0x3DE5D93A5ACFD57CULL
+#define C1         0x3FA555555555554CULL
+#define C2         0xBF56C16C16C15177ULL
+#define C3         0x3EFA01A019CB1590ULL
+#define C4         0xBE927E4F809C52ADULL
+#define C5         0x3E21EE9EBDB4B1C4ULL
+#define C6         0xBDA8FAE9BE8838D4ULL
+
+/* exp: x = k*ln2 + r, |r| <= ln2/2, exp(x) = 2^k * exp(r) (see e_exp.c) */
+v128_t wasm_f64x2_exp(v128_t x)
+{
+  v128_t kd, ki, hi, lo, r, t, c, y;
+  v128_t ok = wasm_v128_and(wasm_f64x2_ge(x, D(d_expmin)), wasm_f64x2_le(x, D(d_expmax)));
+  if (!wasm_i64x2_all_true(ok)) return f64x2_lane_apply(exp, x);
+  kd = wasm_f64x2_add(wasm_f64x2_mul(x, D(ivln2)), D(d_shift));
+  ki = wasm_i64x2_shl(kd, 52); /* low bits of kd hold k */
+  kd = wasm_f64x2_sub(kd, D(d_shift));
+  hi = wasm_f64x2_sub(x, wasm_f64x2_mul(kd, D(ln2_hi)));
+  lo = wasm_f64x2_mul(kd, D(ln2_lo));
+  r = wasm_f64x2_sub(hi, lo);
+  t = wasm_f64x2_mul(r, r);
+  c = wasm_f64x2_add(D(P4), wasm_f64x2_mul(t, D(P5)));
+  c = wasm_f64x2_add(D(P3), wasm_f64x2_mul(t, c));
+  c = wasm_f64x2_add(D(P2), wasm_f64x2_mul(t, c));
+  c = wasm_f64x2_add(D(P1), wasm_f64x2_mul(t, c));
+  c = wasm_f64x2_sub(r, wasm_f64x2_mul(t, c));
+  y = wasm_f64x2_div(wasm_f64x2_mul(r, c), wasm_f64x2_sub(D(d_two), c));
+  y = wasm_f64x2_sub(D(d_one), wasm_f64x2_sub(wasm_f64x2_sub(lo, y), hi));
+  return wasm_i64x2_add(y, ki);
+}
+
+/* log: x = 2^k * (1+f), sqrt(2)/2 <= 1+f < sqrt(2) (see e_log.c) */
+v128_t wasm_f64x2_log(v128_t x)
+{
+  v128_t k, dk, f, hfsq, s, z, w, t1, t2, r;
+  v128_t ok = wasm_v128_and(wasm_f64x2_ge(x, D(d_min)), wasm_f64x2_lt(x, D(d_inf)));
+  if (!wasm_i64x2_all_true(ok)) return f64x2_lane_apply(log, x);
+  k = wasm_i64x2_shr(wasm_i64x2_sub(x, D(d_sqrt1_2)), 52);
+  f = wasm_f64x2_sub(wasm_i64x2_sub(x, wasm_i64x2_shl(k, 52)), D(d_one));
+  dk = wasm_f64x2_sub(wasm_i64x2_add(k, D(d_shift)), D(d_shift));
+  hfsq = wasm_f64x2_mul(D(d_half), wasm_f64x2_mul(f, f));
+  s = wasm_f64x2_div(f, wasm_f64x2_add(D(d_two), f));
+  z = wasm_f64x2_mul(s, s);
+  w = wasm_f64x2_mul(z, z);
+  t1 = wasm_f64x2_add(D(Lg4), wasm_f64x2_mul(w, D(Lg6)));
+  t1 = wasm_f64x2_add(D(Lg2), wasm_f64x2_mul(w, t1));
+  t1 = wasm_f64x2_mul(w, t1);
+  t2 = wasm_f64x2_add(D(Lg5), wasm_f64x2_mul(w, D(Lg7)));
+  t2 = wasm_f64x2_add(D(Lg3), wasm_f64x2_mul(w, t2));
+  t2 = wasm_f64x2_add(D(Lg1), wasm_f64x2_mul(w, t2));
+  t2 = wasm_f64x2_mul(z, t2);
+  r = wasm_f64x2_add(wasm_f64x2_mul(s, wasm_f64x2_add(hfsq, wasm_f64x2_add(t2, t1))),
+                     wasm_f64x2_mul(dk, D(ln2_lo)));
+  r = wasm_f64x2_sub(wasm_f64x2_sub(hfsq, r), f);
+  return wasm_f64x2_sub(wasm_f64x2_mul(dk, D(ln2_hi)), r);
+}
+
+/* sin (q = 0) or cos (q = 1): x = n*pi/2 + y, |y| <= pi/4, then
+ * sin/cos of y by quadrant (n+q) mod 4 (see k_sin.c, k_cos.c) */
+static v128_t f64x2_sincos(v128_t x, int64_t q)
+{
+  v128_t fn, ni, y, z, r, s, c, hz, w, sel;
+  fn = wasm_f64x2_add(wasm_f64x2_mul(x, D(invpio2)), D(d_shift));
+  ni = wasm_i64x2_add(fn, wasm_i64x2_splat(q)); /* low bits of fn hold n */
+  fn = wasm_f64x2_sub(fn, D(d_shift));
+  y = wasm_f64x2_sub(x, wasm_f64x2_mul(fn, D(pio2_1)));
+  y = wasm_f64x2_sub(y, wasm_f64x2_mul(fn, D(pio2_2)));
+  y = wasm_f64x2_sub(y, wasm_f64x2_mul(fn, D(pio2_2t)));
+  z = wasm_f64x2_mul(y, y);
+  r = wasm_f64x2_add(D(S5), wasm_f64x2_mul(z, D(S6)));
+  r = wasm_f64x2_add(D(S4), wasm_f64x2_mul(z, r));
+  r = wasm_f64x2_add(D(S3), wasm_f64x2_mul(z, r));
+  r = wasm_f64x2_add(D(S2), wasm_f64x2_mul(z, r));
+  r = wasm_f64x2_add(D(S1), wasm_f64x2_mul(z, r));
+  s = wasm_f64x2_add(y, wasm_f64x2_mul(wasm_f64x2_mul(z, y), r));
+  s = wasm_v128_bitselect(y, s, wasm_f64x2_eq(z, D(0))); /* keep sign of zero */
+  r = wasm_f64x2_add(D(C5), wasm_f64x2_mul(z, D(C6)));
+  r = wasm_f64x2_add(D(C4), wasm_f64x2_mul(z, r));
+  r = wasm_f64x2_add(D(C3), wasm_f64x2_mul(z, r));
+  r = wasm_f64x2_add(D(C2), wasm_f64x2_mul(z, r));
+  r = wasm_f64x2_add(D(C1), wasm_f64x2_mul(z, r));
+  r = wasm_f64x2_mul(wasm_f64x2_mul(z, z), r);
+  hz = wasm_f64x2_mul(D(d_half), z);
+  w = wasm_f64x2_sub(D(d_one), hz);
+  c = wasm_f64x2_add(w, wasm_f64x2_add(wasm_f64x2_sub(wasm_f64x2_sub(D(d_one), w), hz), r));
+  sel = wasm_i64x2_eq(wasm_v128_and(ni, D(1)), D(1));
+  r = wasm_v128_bitselect(c, s, sel);
+  return wasm_v128_xor(r, wasm_i64x2_shl(wasm_v128_and(ni, D(2)), 62));
+}
+
+v128_t wasm_f64x2_sin(v128_t x)
+{
+  if (!wasm_i64x2_all_true(wasm_f64x2_le(wasm_f64x2_abs(x), D(d_trigmax))))
+    return f64x2_lane_apply(sin, x);
+  return f64x2_sincos(x, 0);
+}
+
+v128_t wasm_f64x2_cos(v128_t x)
+{
+  if (!wasm_i64x2_all_true(wasm_f64x2_le(wasm_f64x2_abs(x), D(d_trigmax))))
+    return f64x2_lane_apply(cos, x);
+  return f64x2_sincos(x, 1);
+}
+
+/* f32x4 */
+
+#define f_one      0x3F800000U /* 1.0f */
+#define f_half     0x3F000000U /* 0.5f */
+#define f_min      0x00800000U /* FLT_MIN */
+#define f_inf      0x7F800000U /* +inf */
+#define f_expmin   0xC2AE0000U /* -87 */
+#define f_expmax   0x42B00000U /* 88 */
+#define f_trigmax  0x46000000U /* 8192 */
+#define log2ef     0x3FB8AA3BU
+#define ln2f_hi    0x3F318000U /* 0.693359375 */
+#define ln2f_lo    0xB95E8083U /* -2.12194440e-4 */
+#define sqrthf     0x3F3504F3U
+#define twoopi     0x3F22F983U
+#define pio2f_1    0x3FC90000U /* 1.5703125 */
+#define pio2f_2    0x39FDA000U /* 4.837512969970703125e-4 */
+#define pio2f_3    0x33A22169U /* 7.54978995489188216e-8 */
+#define EP0        0x39506967U /* 1.9875691500E-4 */
+#define EP1        0x3AB743CEU /* 1.3981999507E-3 */
+#define EP2        0x3C088908U /* 8.3334519073E-3 */
+#define EP3        0x3D2AA9C1U /* 4.1665795894E-2 */
+#define EP4        0x3E2AAAAAU /* 1.6666665459E-1 */
+#define EP5        0x3F000000U /* 5.0000001201E-1 */
+#define LP0        0x3D9021BBU /* 7.0376836292E-2 */
+#define LP1        0xBDEBD1B8U /* -1.1514610310E-1 */
+#define LP2        0x3DEF251AU /* 1.1676998740E-1 */
+#define LP3        0xBDFE5D4FU /* -1.2420140846E-1 */
+#define LP4        0x3E11E9BFU /* 1.4249322787E-1 */
+#define LP5        0xBE2AAE50U /* -1.6668057665E-1 */
+#define LP6        0x3E4CCEACU /* 2.0000714765E-1 */
+#define LP7        0xBE7FFFFCU /* -2.4999993993E-1 */
+#define LP8        0x3EAAAAAAU /* 3.3333331174E-1 */
+#define SP0        0xB94CA1F9U /* -1.9515295891E-4 */
+#define SP1        0x3C08839EU /* 8.3321608736E-3 */
+#define SP2        0xBE2AAAA3U /* -1.6666654611E-1 */
+#define CP0        0x37CCF5CEU /* 2.443315711809948E-5 */
+#define CP1        0xBAB6061AU /* -1.388731625493765E-3 */
+#define CP2        0x3D2AAAA5U /* 4.166664568298827E-2 */
+
+/* exp: x = k*ln2 + r, exp(x) = 2^k * exp(r) (see Cephes expf.c) */
+v128_t wasm_f32x4_exp(v128_t x)
+{
+  v128_t fk, r, z, p, e;
+  v128_t ok = wasm_v128_and(wasm_f32x4_ge(x, F(f_expmin)), wasm_f32x4_le(x, F(f_expmax)));
+  if (!wasm_i32x4_all_true(ok)) return f32x4_lane_apply(expf, x);
+  fk = wasm_f32x4_nearest(wasm_f32x4_mul(x, F(log2ef)));
+  r = wasm_f32x4_sub(x, wasm_f32x4_mul(fk, F(ln2f_hi)));
+  r = wasm_f32x4_sub(r, wasm_f32x4_mul(fk, F(ln2f_lo)));
+  z = wasm_f32x4_mul(r, r);
+  p = wasm_f32x4_add(wasm_f32x4_mul(F(EP0), r), F(EP1));
+  p = wasm_f32x4_add(wasm_f32x4_mul(p, r), F(EP2));
+  p = wasm_f32x4_add(wasm_f32x4_mul(p, r), F(EP3));
+  p = wasm_f32x4_add(wasm_f32x4_mul(p, r), F(EP4));
+  p = wasm_f32x4_add(wasm_f32x4_mul(p, r), F(EP5));
+  p = wasm_f32x4_add(wasm_f32x4_add(wasm_f32x4_mul(p, z), r), F(f_one));
+  e = wasm_i32x4_shl(wasm_i32x4_add(wasm_i32x4_trunc_sat_f32x4(fk), wasm_i32x4_splat(127)), 23);
+  return wasm_f32x4_mul(p, e);
+}
+
+/* log: x = 2^e * m, sqrt(1/2) <= m < sqrt(2) (see Cephes logf.c) */
+v128_t wasm_f32x4_log(v128_t x)
+{
+  v128_t e, m, lt, z, p, fe;
+  v128_t ok = wasm_v128_and(wasm_f32x4_ge(x, F(f_min)), wasm_f32x4_lt(x, F(f_inf)));
+  if (!wasm_i32x4_all_true(ok)) return f32x4_lane_apply(logf, x);
+  e = wasm_i32x4_sub(wasm_u32x4_shr(x, 23), wasm_i32x4_splat(126));
+  m = wasm_v128_or(wasm_v128_and(x, F(0x807FFFFFU)), F(f_half)); /* 0.5 <= m < 1 */
+  lt = wasm_f32x4_lt(m, F(sqrthf));
+  e = wasm_i32x4_add(e, lt); /* lt lanes are -1 */
+  m = wasm_f32x4_add(wasm_f32x4_sub(m, F(f_one)), wasm_v128_and(m, lt));
+  z = wasm_f32x4_mul(m, m);
+  p = wasm_f32x4_add(wasm_f32x4_mul(F(LP0), m), F(LP1));
+  p = wasm_f32x4_add(wasm_f32x4_mul(p, m), F(LP2));
+  p = wasm_f32x4_add(wasm_f32x4_mul(p, m), F(LP3));
+  p = wasm_f32x4_add(wasm_f32x4_mul(p, m), F(LP4));
+  p = wasm_f32x4_add(wasm_f32x4_mul(p, m), F(LP5));
+  p = wasm_f32x4_add(wasm_f32x4_mul(p, m), F(LP6));
+  p = wasm_f32x4_add(wasm_f32x4_mul(p, m), F(LP7));
+  p = wasm_f32x4_add(wasm_f32x4_mul(p, m), F(LP8));
+  p = wasm_f32x4_mul(wasm_f32x4_mul(p, m), z);
+  fe = wasm_f32x4_convert_i32x4(e);
+  p = wasm_f32x4_add(p, wasm_f32x4_mul(fe, F(ln2f_lo)));
+  p = wasm_f32x4_sub(p, wasm_f32x4_mul(F(f_half), z));
+  return wasm_f32x4_add(wasm_f32x4_add(m, p), wasm_f32x4_mul(fe, F(ln2f_hi)));
+}
+
+/* sin (q = 0) or cos (q = 1): x = n*pi/2 + y, |y| <= pi/4, then
+ * sin/cos of y by quadrant (n+q) mod 4 (see Cephes sinf.c) */
+static v128_t f32x4_sincos(v128_t x, int32_t q)
+{
+  v128_t fn, ni, y, z, s, c, sel;
+  fn = wasm_f32x4_nearest(wasm_f32x4_mul(x, F(twoopi)));
+  ni = wasm_i32x4_add(wasm_i32x4_trunc_sat_f32x4(fn), wasm_i32x4_splat(q));
+  y = wasm_f32x4_sub(x, wasm_f32x4_mul(fn, F(pio2f_1)));
+  y = wasm_f32x4_sub(y, wasm_f32x4_mul(fn, F(pio2f_2)));
+  y = wasm_f32x4_sub(y, wasm_f32x4_mul(fn, F(pio2f_3)));
+  z = wasm_f32x4_mul(y, y);
+  s = wasm_f32x4_add(wasm_f32x4_mul(F(SP0), z), F(SP1));
+  s = wasm_f32x4_add(wasm_f32x4_mul(s, z), F(SP2));
+  s = wasm_f32x4_add(wasm_f32x4_mul(wasm_f32x4_mul(s, z), y), y);
+  s = wasm_v128_bitselect(y, s, wasm_f32x4_eq(z, F(0))); /* keep sign of zero */
+  c = wasm_f32x4_add(wasm_f32x4_mul(F(CP0), z), F(CP1));
+  c = wasm_f32x4_add(wasm_f32x4_mul(c, z), F(CP2));
+  c = wasm_f32x4_mul(wasm_f32x4_mul(c, z), z);
+  c = wasm_f32x4_add(wasm_f32x4_sub(c, wasm_f32x4_mul(F(f_half), z)), F(f_one));
+  sel = wasm_i32x4_eq(wasm_v128_and(ni, F(1)), F(1));
+  s = wasm_v128_bitselect(c, s, sel);
+  return wasm_v128_xor(s, wasm_i32x4_shl(wasm_v128_and(ni, F(2)), 30));
+}
+
+v128_t wasm_f32x4_sin(v128_t x)
+{
+  if (!wasm_i32x4_all_true(wasm_f32x4_le(wasm_f32x4_abs(x), F(f_trigmax))))
+    return f32x4_lane_apply(sinf, x);
+  return f32x4_sincos(x, 0);
+}
+
+v128_t wasm_f32x4_cos(v128_t x)
+{
+  if (!wasm_i32x4_all_true(wasm_f32x4_le(wasm_f32x4_abs(x), F(f_trigmax))))
+    return f32x4_lane_apply(cosf, x);
+  return f32x4_sincos(x, 1);
+}
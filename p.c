@@ -67,6 +67,7 @@ pws_t *pws_from_modname(bool sys, sym_t mod)
 /* parser workspaces */
 struct pws {
   int id;             /* sequential id of this pws or -1 */
+  srcloc_t locbase;   /* base of this pws' source locations */
   dstr_t infile;      /* current input file name or "-" */
   sym_t curmod;       /* current module name or 0 */
   void *input;        /* current input stream */
@@ -75,6 +76,8 @@ struct pws {
   bool inateof;       /* current input is exausted */  
   cbuf_t incb;        /* input buffer for parser */  
   buf_t lsposs;       /* line start positions */  
+  bool lazylines;     /* lsposs is to be computed from chars */
+  buf_t splices;      /* positions of spliced-out line ends */
   size_t discarded;   /* count of discarded chars */  
   cbuf_t chars;       /* line buffer of chars */
   int curi;           /* current input position in buf */
@@ -91,6 +94,11 @@ int pwsid(pws_t *pw)
   return pw->id;
 }
 
+srcloc_t pwsloc(pws_t *pw, int pos)
+{
+  return (pos < 0) ? 0 : pw->locbase + (srcloc_t)pos;
+}
+
 sym_t pwscurmod(pws_t *pw)
 {
   return pw->curmod;
@@ -98,6 +106,8 @@ sym_t pwscurmod(pws_t *pw)
 
 static buf_t g_pwsbuf;
 
+static void loadchars(pws_t *pw);
+
 /* alloc parser workspace for infile */
 pws_t *newpws(const char *infile)
 {
@@ -111,7 +121,7 @@ pws_t *newpws(const char *infile)
     pw->input = fp;
     pw->getlb = (fgetlb_t)&fgetlb;
     pw->close = (fclose_t)&fclose;
-    fget8bom(pw->input);
+    if (fp == stdin) fget8bom(pw->input);
   } else if (mp) {
     pw = emalloc(sizeof(pws_t));
     pw->input = mp;
@@ -126,6 +136,8 @@ pws_t *newpws(const char *infile)
     pw->inateof = false;
     cbinit(&pw->incb);
     bufinit(&pw->lsposs, sizeof(size_t));
+    pw->lazylines = false;
+    bufinit(&pw->splices, sizeof(size_t));
     pw->discarded = 0;
     bufinit(&pw->chars, sizeof(char));
     pw->curi = 0; 
@@ -136,6 +148,21 @@ pws_t *newpws(const char *infile)
     pw->pos = 0;
     pw->cclevel = 0;
     *(pws_t**)bufnewbk(&g_pwsbuf) = pw;
+    /* files and resources are read whole, so the lexer works directly
+     * on their chars; only stdin is fetched line by line */
+    if (fp != NULL && fp != stdin) {
+      if (!fgetall(&pw->chars, fp)) eprintf("%s: read error", infile);
+      fclose(fp);
+      pw->input = NULL;
+      loadchars(pw);
+    } else if (mp != NULL) {
+      cbset(&pw->chars, mp->base, (size_t)(mp->end - mp->base));
+      mclose(mp);
+      pw->input = NULL;
+      loadchars(pw);
+    }
+    /* whole inputs need exactly their size, stdin gets a generous range */
+    pw->locbase = srcreg(pw, pw->inateof ? cblen(&pw->chars) : 0x10000000);
   }
   return pw;
 }
@@ -160,6 +187,7 @@ static void freepws(pws_t *pw)
     free(pw->infile);
     cbfini(&pw->incb);
     buffini(&pw->lsposs);
+    buffini(&pw->splices);
     cbfini(&pw->chars);
     cbfini(&pw->token);
     free(pw);
@@ -178,35 +206,100 @@ void fini_workspaces(void)
     freepws(*(pws_t**)bufref(&g_pwsbuf, i));
   }
   buffini(&g_pwsbuf);
+  clearsrcs();
+}
+
+/* whole-input mode: do to all chars at once what fetchline does to each
+ * line (skip bom, drop \r before \n, splice lines ending in \, check
+ * utf-8), compacting them in place; 8-byte words with nothing but plain
+ * ascii are skipped at once, so most input is just moved or left alone */
+#define HASZERO(w) (((w) - 0x0101010101010101ULL) & ~(w) & 0x8080808080808080ULL)
+#define HASBYTE(w, b) (HASZERO((w) ^ (0x0101010101010101ULL * (b))))
+
+static void loadchars(pws_t *pw)
+{
+  cbuf_t *pp = &pw->chars; size_t len = cblen(pp);
+  unsigned char *base, *s, *d, *e; unsigned long long w;
+  bufresize(pp, len + 4); pp->fill = len; /* zeros past the end for unutf8 */
+  base = s = d = (unsigned char *)cbdata(pp); e = base + len;
+  if (len >= 3 && s[0] == 0xEF && s[1] == 0xBB && s[2] == 0xBF) s += 3;
+  while (s < e) {
+    int c;
+    if (e - s >= 8) {
+      memcpy(&w, s, 8);
+      if (((w & 0x8080808080808080ULL) | HASZERO(w) | HASBYTE(w, '\r') | HASBYTE(w, '\\')) == 0) {
+        if (d != s) memmove(d, s, 8);
+        d += 8; s += 8;
+        continue;
+      }
+    }
+    c = *s;
+    if (c == '\r' && s[1] == '\n') {
+      s += 1;
+    } else if (c == '\\' && (s[1] == '\n' || s+1 == e || (s[1] == '\r' && s[2] == '\n'))) {
+      /* c preprocessor-like behavior: next line continues this one */
+      s += (s[1] == '\r') ? 3 : 2;
+      *(size_t*)bufnewbk(&pw->splices) = (size_t)(d - base);
+    } else if (c == 0 || c >= 0x80) {
+      unsigned char *p = s; unsigned long ch = unutf8(&s);
+      if (ch == 0 || ch == (unsigned long)-1) {
+        int lno = (int)buflen(&pw->splices) + 1;
+        for (p = base; p < d; ++p) if (*p == '\n') ++lno;
+        eprintf("%s:%d: utf-8 encoding error", pw->infile, lno);
+      }
+      if (s > e) s = e;
+      while (p < s) *d++ = *p++;
+    } else {
+      *d++ = *s++;
+    }
+  }
+  pp->fill = (size_t)(d - base);
+  /* last line gets its \n unless it was spliced into nothing */
+  if (d > base && d[-1] != '\n') {
+    size_t ns = buflen(&pw->splices);
+    if (ns == 0 || *(size_t*)bufref(&pw->splices, ns-1) != (size_t)(d - base)) cbputc('\n', pp);
+  }
+  pw->inateof = true;
+  pw->lazylines = true;
+}
+
+/* line start positions, computed on first use in whole-input mode */
+static buf_t *pwlines(pws_t *pw)
+{
+  if (pw->lazylines) {
+    char *base = cbdata(&pw->chars), *p = base, *e = base + cblen(&pw->chars);
+    size_t *sp = bufdata(&pw->splices), *se = sp + buflen(&pw->splices);
+    bufclear(&pw->lsposs);
+    while (p < e) {
+      char *nl = memchr(p, '\n', (size_t)(e - p));
+      size_t npos = nl ? (size_t)(nl + 1 - base) : (size_t)(e - base);
+      *(size_t*)bufnewbk(&pw->lsposs) = (size_t)(p - base);
+      /* next physical line starts after \n or where it was spliced */
+      if (sp < se && *sp < npos) p = base + *sp++;
+      else p = base + npos;
+    }
+    pw->lazylines = false;
+  }
+  return &pw->lsposs;
 }
 
 /* convert global position into 1-based line + 0-based offset */
 static void pos2lnoff(pws_t *pw, int gci, int *pln1, int *poff0)
 {
-  /* todo: use binary search */
-  size_t i; int curlc = 0, curci = 0;
   gci += (int)pw->discarded; /* in case we are in a repl */
-  for (i = 0; i < buflen(&pw->lsposs); ++i) {
-    size_t *plsp = bufref(&pw->lsposs, i);
-    int ici = (int)*plsp;
-    if (ici > gci) break;
-    curlc = (int)i; 
-    curci = ici;
-  }
-  *pln1 = curlc + 1;
-  *poff0 = gci - curci;
+  bufpos2lnoff(pwlines(pw), (size_t)gci, pln1, poff0);
 }
 
 /* recall line #n; return NULL if it is not available */
 static char *recallline(pws_t *pw, int lno, cbuf_t *pcb)
 {
   size_t gci, ppi; cbuf_t *pp = &pw->chars; 
-  char *pchars = cbdata(pp);
+  char *pchars = cbdata(pp); buf_t *plsposs = pwlines(pw);
   assert(lno > 0);
   /* check if this line is already comitted in full */
-  if (lno >= (int)(1+buflen(&pw->lsposs))) return NULL;
+  if (lno >= (int)(1+buflen(plsposs))) return NULL;
   /* ok, let's get its global initial offset as gci */
-  gci = *(size_t *)bufref(&pw->lsposs, (size_t)(lno-1));
+  gci = *(size_t *)bufref(plsposs, (size_t)(lno-1));
   /* see if this part is still available */
   if (gci < pw->discarded) return NULL; 
   gci -= pw->discarded; /* now gci is relative to pp */
@@ -325,6 +418,8 @@ void reprintf(pws_t *pw, int startpos, const char *fmt, ...)
 buf_t g_syminfo;
 /* nodes referred to by some syminfos */
 ndbuf_t g_nodes;
+/* C keywords => tt_t (kept out of g_syminfo) */
+static phtab_t g_kwtab;
 
 /* NB: intern_symbol does not check for duplicates! */
 static void intern_symbol(const char *name, tt_t tt, int info)
@@ -348,25 +443,25 @@ void make_vararg_union_type(node_t *ptn)
   node_t *pfn;
   assert(ptn->nt == NT_NULL);
   ptn->nt = NT_TYPE; ptn->ts = TS_UNION; ptn->name = intern("va_arg");
-  ndset(pfn = ndnewbk(ptn), NT_VARDECL, -1, -1)->name = intern("va_int"); 
+  ndset(pfn = ndnewbk(ptn), NT_VARDECL, 0)->name = intern("va_int"); 
   ndsettype(ndnewbk(pfn), TS_INT);
-  ndset(pfn = ndnewbk(ptn), NT_VARDECL, -1, -1)->name = intern("va_uint"); 
+  ndset(pfn = ndnewbk(ptn), NT_VARDECL, 0)->name = intern("va_uint"); 
   ndsettype(ndnewbk(pfn), TS_UINT);
-  ndset(pfn = ndnewbk(ptn), NT_VARDECL, -1, -1)->name = intern("va_long"); 
+  ndset(pfn = ndnewbk(ptn), NT_VARDECL, 0)->name = intern("va_long"); 
   ndsettype(ndnewbk(pfn), TS_LONG);
-  ndset(pfn = ndnewbk(ptn), NT_VARDECL, -1, -1)->name = intern("va_ulong"); 
+  ndset(pfn = ndnewbk(ptn), NT_VARDECL, 0)->name = intern("va_ulong"); 
   ndsettype(ndnewbk(pfn), TS_ULONG);
-  ndset(pfn = ndnewbk(ptn), NT_VARDECL, -1, -1)->name = intern("va_llong"); 
+  ndset(pfn = ndnewbk(ptn), NT_VARDECL, 0)->name = intern("va_llong"); 
   ndsettype(ndnewbk(pfn), TS_LLONG);
-  ndset(pfn = ndnewbk(ptn), NT_VARDECL, -1, -1)->name = intern("va_ullong"); 
+  ndset(pfn = ndnewbk(ptn), NT_VARDECL, 0)->name = intern("va_ullong"); 
   ndsettype(ndnewbk(pfn), TS_ULLONG);
-  ndset(pfn = ndnewbk(ptn), NT_VARDECL, -1, -1)->name = intern("va_double"); 
+  ndset(pfn = ndnewbk(ptn), NT_VARDECL, 0)->name = intern("va_double"); 
   ndsettype(ndnewbk(pfn), TS_DOUBLE);
-  ndset(pfn = ndnewbk(ptn), NT_VARDECL, -1, -1)->name = intern("va_size"); 
+  ndset(pfn = ndnewbk(ptn), NT_VARDECL, 0)->name = intern("va_size"); 
   ndsettype(ndnewbk(pfn), TS_ULONG);
-  ndset(pfn = ndnewbk(ptn), NT_VARDECL, -1, -1)->name = intern("va_v128"); 
+  ndset(pfn = ndnewbk(ptn), NT_VARDECL, 0)->name = intern("va_v128"); 
   ndsettype(ndnewbk(pfn), TS_V128);
-  ndset(pfn = ndnewbk(ptn), NT_VARDECL, -1, -1)->name = intern("va_voidptr"); 
+  ndset(pfn = ndnewbk(ptn), NT_VARDECL, 0)->name = intern("va_voidptr"); 
   ndsettype(ndnewbk(ndsettype(ndnewbk(pfn), TS_PTR)), TS_VOID);
 }
 
@@ -375,50 +470,53 @@ void init_symbols(void)
   node_t *pn, *psn; time_t now;
   bufinit(&g_syminfo, sizeof(int)*3);
   ndbinit(&g_nodes); time(&now);
-  intern_symbol("asm", TT_ASM_KW, -1); /* WCPL */
-  intern_symbol("auto", TT_AUTO_KW, -1);
-  intern_symbol("break", TT_BREAK_KW, -1);
-  intern_symbol("case", TT_CASE_KW, -1);
-  intern_symbol("char", TT_CHAR_KW, -1);
-  intern_symbol("const", TT_CONST_KW, -1);
-  intern_symbol("constexpr", TT_CONSTEXPR_KW, -1);
-  intern_symbol("continue", TT_CONTINUE_KW, -1);
-  intern_symbol("default", TT_DEFAULT_KW, -1);
-  intern_symbol("do"	, TT_DO_KW, -1);
-  intern_symbol("double", TT_DOUBLE_KW, -1);
-  intern_symbol("else"	, TT_ELSE_KW, -1);
-  intern_symbol("enum"	, TT_ENUM_KW, -1);
-  intern_symbol("extern", TT_EXTERN_KW, -1);
-  intern_symbol("float", TT_FLOAT_KW, -1);
-  intern_symbol("for", TT_FOR_KW, -1);
-  intern_symbol("goto", TT_GOTO_KW, -1);
-  intern_symbol("if", TT_IF_KW, -1);
-  intern_symbol("inline", TT_INLINE_KW, -1);
-  intern_symbol("int", TT_INT_KW, -1);
-  intern_symbol("long", TT_LONG_KW, -1);
-  intern_symbol("register", TT_REGISTER_KW, -1);
-  intern_symbol("restrict", TT_RESTRICT_KW, -1);
-  intern_symbol("return", TT_RETURN_KW, -1);
-  intern_symbol("short", TT_SHORT_KW, -1);
-  intern_symbol("signed", TT_SIGNED_KW, -1);
-  intern_symbol("simd", TT_SIMD_KW, -1); /* WCPL */
-  intern_symbol("static", TT_STATIC_KW, -1);
-  intern_symbol("struct", TT_STRUCT_KW, -1);
-  intern_symbol("switch", TT_SWITCH_KW, -1);
-  intern_symbol("typedef", TT_TYPEDEF_KW, -1);
-  intern_symbol("union", TT_UNION_KW, -1);
-  intern_symbol("unsigned", TT_UNSIGNED_KW, -1);
-  intern_symbol("void", TT_VOID_KW, -1);
-  intern_symbol("volatile", TT_VOLATILE_KW, -1);
-  intern_symbol("while", TT_WHILE_KW, -1);
+  phtinit(&g_kwtab);
+  phtadd(&g_kwtab, "_Atomic", TT_ATOMIC_KW); /* C11: not supported */
+  phtadd(&g_kwtab, "asm", TT_ASM_KW); /* WCPL */
+  phtadd(&g_kwtab, "auto", TT_AUTO_KW);
+  phtadd(&g_kwtab, "break", TT_BREAK_KW);
+  phtadd(&g_kwtab, "case", TT_CASE_KW);
+  phtadd(&g_kwtab, "char", TT_CHAR_KW);
+  phtadd(&g_kwtab, "const", TT_CONST_KW);
+  phtadd(&g_kwtab, "constexpr", TT_CONSTEXPR_KW);
+  phtadd(&g_kwtab, "continue", TT_CONTINUE_KW);
+  phtadd(&g_kwtab, "default", TT_DEFAULT_KW);
+  phtadd(&g_kwtab, "do", TT_DO_KW);
+  phtadd(&g_kwtab, "double", TT_DOUBLE_KW);
+  phtadd(&g_kwtab, "else", TT_ELSE_KW);
+  phtadd(&g_kwtab, "enum", TT_ENUM_KW);
+  phtadd(&g_kwtab, "extern", TT_EXTERN_KW);
+  phtadd(&g_kwtab, "float", TT_FLOAT_KW);
+  phtadd(&g_kwtab, "for", TT_FOR_KW);
+  phtadd(&g_kwtab, "goto", TT_GOTO_KW);
+  phtadd(&g_kwtab, "if", TT_IF_KW);
+  phtadd(&g_kwtab, "inline", TT_INLINE_KW);
+  phtadd(&g_kwtab, "int", TT_INT_KW);
+  phtadd(&g_kwtab, "long", TT_LONG_KW);
+  phtadd(&g_kwtab, "register", TT_REGISTER_KW);
+  phtadd(&g_kwtab, "restrict", TT_RESTRICT_KW);
+  phtadd(&g_kwtab, "return", TT_RETURN_KW);
+  phtadd(&g_kwtab, "short", TT_SHORT_KW);
+  phtadd(&g_kwtab, "signed", TT_SIGNED_KW);
+  phtadd(&g_kwtab, "simd", TT_SIMD_KW); /* WCPL */
+  phtadd(&g_kwtab, "static", TT_STATIC_KW);
+  phtadd(&g_kwtab, "struct", TT_STRUCT_KW);
+  phtadd(&g_kwtab, "switch", TT_SWITCH_KW);
+  phtadd(&g_kwtab, "typedef", TT_TYPEDEF_KW);
+  phtadd(&g_kwtab, "union", TT_UNION_KW);
+  phtadd(&g_kwtab, "unsigned", TT_UNSIGNED_KW);
+  phtadd(&g_kwtab, "void", TT_VOID_KW);
+  phtadd(&g_kwtab, "volatile", TT_VOLATILE_KW);
+  phtadd(&g_kwtab, "while", TT_WHILE_KW);
+  phtbuild(&g_kwtab);
   intern_symbol("bool", TT_TYPE_NAME, (int)ndblen(&g_nodes));
   ndsettype(ndbnewbk(&g_nodes), TS_BOOL);
   intern_symbol("true", TT_MACRO_NAME, (int)ndblen(&g_nodes));
-  pn = ndbnewbk(&g_nodes); ndset(pn, NT_LITERAL, -1, -1);
+  pn = ndbnewbk(&g_nodes); ndset(pn, NT_LITERAL, 0);
   pn->ts = TS_BOOL; pn->val.i = 1; /* NB: int in C99 */
   wrap_node(pn, NT_MACRODEF); pn->name = intern("true");
   intern_symbol("false", TT_MACRO_NAME, (int)ndblen(&g_nodes));
-  pn = ndbnewbk(&g_nodes); ndset(pn, NT_LITERAL, -1, -1);
+  pn = ndbnewbk(&g_nodes); ndset(pn, NT_LITERAL, 0);
   pn->ts = TS_BOOL; pn->val.i = 0; /* NB: int in C99 */
   wrap_node(pn, NT_MACRODEF); pn->name = intern("false");
   intern_symbol("wchar_t", TT_TYPE_NAME, (int)ndblen(&g_nodes));
@@ -469,14 +567,14 @@ void init_symbols(void)
   pn = ndsetulit(ndbnewbk(&g_nodes), TS_ULONG, UINT_MAX); /* wasm32 */
   wrap_node(pn, NT_MACRODEF); pn->name = intern("UINTPTR_MAX");
   intern_symbol("NULL", TT_MACRO_NAME, (int)ndblen(&g_nodes));
-  pn = ndbnewbk(&g_nodes); ndset(pn, NT_CAST, -1, -1);
+  pn = ndbnewbk(&g_nodes); ndset(pn, NT_CAST, 0);
   psn = ndnewbk(pn); ndsettype(psn, TS_PTR);
   psn = ndnewbk(psn); ndsettype(psn, TS_VOID);
-  psn = ndnewbk(pn); ndset(psn, NT_LITERAL, -1, -1);
+  psn = ndnewbk(pn); ndset(psn, NT_LITERAL, 0);
   psn->ts = TS_ULONG; psn->val.i = 0;
   wrap_node(pn, NT_MACRODEF); pn->name = intern("NULL");
   intern_symbol("HUGE_VAL", TT_MACRO_NAME, (int)ndblen(&g_nodes));
-  pn = ndbnewbk(&g_nodes); ndset(pn, NT_LITERAL, -1, -1);
+  pn = ndbnewbk(&g_nodes); ndset(pn, NT_LITERAL, 0);
   pn->ts = TS_DOUBLE; pn->val.d = HUGE_VAL;
   wrap_node(pn, NT_MACRODEF); pn->name = intern("HUGE_VAL");
   intern_symbol("sizeof", TT_INTR_NAME, INTR_SIZEOF);
@@ -491,14 +589,14 @@ void init_symbols(void)
   intern_symbol("static_assert", TT_INTR_NAME, INTR_SASSERT);
   intern_symbol("defined", TT_INTR_NAME, INTR_DEFINED);
   intern_symbol("__VA_ARGS__", TT_MACRO_NAME, (int)ndblen(&g_nodes)); /* C99 */
-  pn = ndbnewbk(&g_nodes); ndset(pn, NT_INTRCALL, -1, -1); pn->intr = INTR_VAETC;
+  pn = ndbnewbk(&g_nodes); ndset(pn, NT_INTRCALL, 0); pn->intr = INTR_VAETC;
   wrap_node(pn, NT_MACRODEF); pn->name = intern("__VA_ARGS__");
   intern_symbol("__DATE__", TT_MACRO_NAME, (int)ndblen(&g_nodes));
-  pn = ndbnewbk(&g_nodes); ndset(pn, NT_LITERAL, -1, -1);
+  pn = ndbnewbk(&g_nodes); ndset(pn, NT_LITERAL, 0);
   pn->ts = TS_STRING; cbputtime("%b %d %Y", gmtime(&now), &pn->data);
   cbputc(0, &pn->data); wrap_node(pn, NT_MACRODEF); pn->name = intern("__DATE__");
   intern_symbol("__TIME__", TT_MACRO_NAME, (int)ndblen(&g_nodes));
-  pn = ndbnewbk(&g_nodes); ndset(pn, NT_LITERAL, -1, -1);
+  pn = ndbnewbk(&g_nodes); ndset(pn, NT_LITERAL, 0);
   pn->ts = TS_STRING; cbputtime("%X", gmtime(&now), &pn->data);
   cbputc(0, &pn->data); wrap_node(pn, NT_MACRODEF); pn->name = intern("__TIME__");
   intern_symbol("__WCPL__", TT_MACRO_NAME, (int)ndblen(&g_nodes));
@@ -528,6 +626,7 @@ bool same_type(const node_t *pctn1, const node_t *pctn2)
 {
   node_t *ptn1 = (node_t*)pctn1, *ptn2 = (node_t*)pctn2;
   assert(ptn1->nt == NT_TYPE && ptn2->nt == NT_TYPE);
+  if (ptn1 == ptn2) return true;
   if (ptn1->ts == TS_ENUM && ptn2->ts == TS_INT) return true;
   if (ptn1->ts == TS_INT && ptn2->ts == TS_ENUM) return true;
   if (ptn1->ts == TS_V128 && ptn2->ts == TS_V128) {
@@ -600,7 +699,7 @@ const node_t *post_symbol(sym_t mod, node_t *pvn, bool final, bool hide)
           node_t *ptn = ndref(pin, 0); assert(ptn->nt == NT_TYPE);
           if (curhide == hide && same_type(ptn, ndref(pvn, 0))) {
             if (final) {
-              pin->pwsid = pvn->pwsid; pin->startpos = pvn->startpos;
+              pin->loc = pvn->loc;
               pin->sc = (hide ? SC_AUTO : SC_REGISTER);
             }
             return pin;
@@ -611,7 +710,7 @@ const node_t *post_symbol(sym_t mod, node_t *pvn, bool final, bool hide)
     n2eprintf(pvn, pin, "symbol already defined differently: %s", symname(pvn->name));
   }
   info = (int)ndblen(&g_nodes); pin = ndbnewbk(&g_nodes);
-  ndset(pin, NT_IMPORT, pvn->pwsid, pvn->startpos);
+  ndset(pin, NT_IMPORT, pvn->loc);
   /* changed to SC_EXTERN on reference; SC_AUTO is for private, SC_REGISTER for public */
   pin->name = mod; assert(mod);
   pin->sc = final ? (hide ? SC_AUTO : SC_REGISTER) : (hide ? SC_STATIC : SC_NONE); 
@@ -622,14 +721,20 @@ const node_t *post_symbol(sym_t mod, node_t *pvn, bool final, bool hide)
 
 void fini_symbols(void)
 {
+  phtfini(&g_kwtab);
   buffini(&g_syminfo);
   ndbfini(&g_nodes);
 }
 
 static tt_t lookup_symbol(const char *name, int *pinfo)
 {
-  sym_t s = intern(name);
-  int *pi = bufbsearch(&g_syminfo, &s, &int_cmp);
+  sym_t s; int *pi, kw;
+  if (phtlookup(&g_kwtab, name, &kw)) { /* no need to intern keywords */
+    if (pinfo) *pinfo = -1;
+    return (tt_t)kw;
+  }
+  s = intern(name);
+  pi = bufbsearch(&g_syminfo, &s, &int_cmp);
   if (pinfo) *pinfo = pi ? pi[2] : -1;
   return pi != NULL ? (tt_t)pi[1] : TT_IDENTIFIER;  
 }
@@ -1804,8 +1909,10 @@ static tt_t lex(pws_t *pw, cbuf_t *pcb)
 static tt_t peekt_ws(pws_t *pw)
 {
   if (!pw->gottk) {
+    phbeg("lex");
     pw->pos = (int)pw->discarded + pw->curi; 
     pw->ctk = lex(pw, &pw->token); 
+    phend();
     pw->gottk = true; 
     pw->tokstr = cbdata(&pw->token); 
   }
@@ -1816,12 +1923,14 @@ static tt_t peekt_ws(pws_t *pw)
 static tt_t peekt(pws_t *pw) 
 { 
   if (!pw->gottk) {
+    phbeg("lex");
     do {
       pw->pos = (int)pw->discarded + pw->curi; 
       pw->ctk = lex(pw, &pw->token); 
       if (pw->ctk == TT_EOF && !pw->inateof) 
         reprintf(pw, pw->pos, "illegal token"); 
     } while (pw->ctk == TT_WHITESPACE); 
+    phend();
     pw->gottk = true; 
     pw->tokstr = cbdata(&pw->token); 
   } 
@@ -1877,7 +1986,6 @@ node_t mknd(void)
 node_t* ndinit(node_t* pn)
 {
   memset(pn, 0, sizeof(node_t));
-  pn->pwsid = pn->startpos = -1;
   bufinit(&pn->data, sizeof(char)); /* cbuf by default */
   ndbinit(&pn->body);
   return pn;
@@ -1904,12 +2012,11 @@ node_t *ndcpy(node_t* pn, const node_t* pr)
   return pn;
 }
 
-node_t *ndset(node_t *dst, nt_t nt, int pwsid, int startpos)
+node_t *ndset(node_t *dst, nt_t nt, srcloc_t loc)
 {
   size_t esz = (nt == NT_ACODE) ? sizeof(inscode_t) : sizeof(char);
   dst->nt = nt;
-  dst->pwsid = pwsid;
-  dst->startpos = startpos;
+  dst->loc = loc;
   dst->name = 0;
   if (esz == dst->data.esz) bufclear(&dst->data);
   else { buffini(&dst->data); bufinit(&dst->data, esz); }
@@ -1923,21 +2030,21 @@ node_t *ndset(node_t *dst, nt_t nt, int pwsid, int startpos)
 
 node_t *ndsettype(node_t *dst, ts_t ts)
 {
-  ndset(dst, NT_TYPE, -1, -1);
+  ndset(dst, NT_TYPE, 0);
   dst->ts = ts;
   return dst;
 }
 
 node_t *ndsetilit(node_t *dst, ts_t ts, long long i)
 {
-  ndset(dst, NT_LITERAL, -1, -1);
+  ndset(dst, NT_LITERAL, 0);
   dst->ts = ts; dst->val.i = i;
   return dst;
 }
 
 node_t *ndsetulit(node_t *dst, ts_t ts, unsigned long long u)
 {
-  ndset(dst, NT_LITERAL, -1, -1);
+  ndset(dst, NT_LITERAL, 0);
   dst->ts = ts; dst->val.u = u;
   return dst;
 }
@@ -1956,12 +2063,12 @@ void ndrem(node_t* pn, size_t i)
 
 node_t *ndinsfr(node_t *pn, nt_t nt)
 {
-  return ndset(ndinsnew(pn, 0), nt, pn->pwsid, pn->startpos);
+  return ndset(ndinsnew(pn, 0), nt, pn->loc);
 }
 
 node_t *ndinsbk(node_t *pn, nt_t nt)
 {
-  return ndset(ndnewbk(pn), nt, pn->pwsid, pn->startpos);
+  return ndset(ndnewbk(pn), nt, pn->loc);
 }
 
 void ndbicpy(ndbuf_t* mem, const ndbuf_t* pb)
@@ -1994,10 +2101,17 @@ void ndbclear(ndbuf_t* pb)
 
 /* node pool */
 
+/* pool nodes live in an arena and are freed with it in one go; 
+ * only the bufs inside them need to be freed one by one */
+static arena_t g_nparena;
+static armark_t g_npmark; /* past the first chunk's header */
 static buf_t g_npbuf;
 
 void init_nodepool(void)
 {
+  arinit(&g_nparena, 0x40000);
+  aralloc(&g_nparena, 0); /* so clearing keeps first chunk */
+  armark(&g_nparena, &g_npmark);
   bufinit(&g_npbuf, sizeof(node_t*));
 }
 
@@ -2006,33 +2120,39 @@ void fini_nodepool(void)
   size_t i;
   for (i = 0; i < buflen(&g_npbuf); ++i) {
     node_t **ppn = bufref(&g_npbuf, i);
-    ndfini(*ppn); free(*ppn);
+    ndfini(*ppn);
   }
   buffini(&g_npbuf);
+  arfini(&g_nparena);
 }
 
 void clear_nodepool(void)
 {
-  fini_nodepool();
-  init_nodepool();
+  size_t i;
+  for (i = 0; i < buflen(&g_npbuf); ++i) {
+    node_t **ppn = bufref(&g_npbuf, i);
+    ndfini(*ppn);
+  }
+  bufclear(&g_npbuf);
+  arrelease(&g_nparena, &g_npmark);
 }
 
 node_t *npalloc(void)
 {
-  node_t *pn = emalloc(sizeof(node_t)), **ppn;
+  node_t *pn = aralloc(&g_nparena, sizeof(node_t)), **ppn;
   ndinit(pn);
   ppn = bufnewbk(&g_npbuf); *ppn = pn;
   return pn;
 }
 
-node_t *npnew(nt_t nt, int pwsid, int startpos)
+node_t *npnew(nt_t nt, srcloc_t loc)
 {
-  return ndset(npalloc(), nt, pwsid, startpos);
+  return ndset(npalloc(), nt, loc);
 }
 
 node_t *npnewcode(const node_t *psn)
 {
-  return npnew(NT_ACODE, psn ? psn->pwsid : -1, psn ? psn->startpos : -1);
+  return npnew(NT_ACODE, psn ? psn->loc : 0);
 }
 
 node_t *npdup(const node_t *pr)
@@ -2072,7 +2192,7 @@ sym_t rpalloc(valtype_t vt)
 {
   switch (vt) {
     case VT_F64: return internf("d%d$",  ++g_rnum_f64); 
-    case VT_F32: return internf("d%d$",  ++g_rnum_f32); 
+    case VT_F32: return internf("f%d$",  ++g_rnum_f32); 
     case VT_I64: return internf("ll%d$", ++g_rnum_i64); 
     case VT_I32: return internf("i%d$",  ++g_rnum_i32); 
     default: assert(false);
@@ -2091,7 +2211,7 @@ sym_t rpalloc_label(void)
 node_t *wrap_node(node_t *pn, nt_t nt)
 {
   node_t nd = mknd();
-  ndset(&nd, nt, pn->pwsid, pn->startpos);
+  ndset(&nd, nt, pn->loc);
   ndswap(pn, ndnewbk(&nd));
   ndswap(pn, &nd);
   ndfini(&nd);
@@ -2102,7 +2222,7 @@ node_t *wrap_node(node_t *pn, nt_t nt)
 node_t *wrap_type_pointer(node_t *pn)
 {
   node_t nd = mknd();
-  ndset(&nd, NT_TYPE, pn->pwsid, pn->startpos);
+  ndset(&nd, NT_TYPE, pn->loc);
   nd.ts = TS_PTR;
   ndswap(pn, ndnewbk(&nd));
   ndswap(pn, &nd);
@@ -2114,7 +2234,7 @@ node_t *wrap_type_pointer(node_t *pn)
 node_t *wrap_type_array(node_t *pn, node_t *pi)
 {
   node_t nd = mknd();
-  ndset(&nd, NT_TYPE, pn->pwsid, pn->startpos);
+  ndset(&nd, NT_TYPE, pn->loc);
   nd.ts = TS_ARRAY;
   ndswap(pn, ndnewbk(&nd));
   ndswap(pi, ndnewbk(&nd));
@@ -2137,7 +2257,7 @@ node_t *flatten_type_array(node_t *pn)
 node_t *wrap_type_function(node_t *pn, ndbuf_t *pnb)
 {
   size_t i; node_t nd = mknd();
-  ndset(&nd, NT_TYPE, pn->pwsid, pn->startpos);
+  ndset(&nd, NT_TYPE, pn->loc);
   nd.ts = TS_FUNCTION;
   ndswap(pn, ndnewbk(&nd));
   if (pnb) for (i = 0; i < ndblen(pnb); ++i) {
@@ -2157,7 +2277,7 @@ node_t *wrap_type_function(node_t *pn, ndbuf_t *pnb)
 node_t *wrap_subscript(node_t *pn, node_t *psn)
 {
   node_t nd = mknd();
-  ndset(&nd, NT_SUBSCRIPT, pn->pwsid, pn->startpos);
+  ndset(&nd, NT_SUBSCRIPT, pn->loc);
   ndswap(pn, ndnewbk(&nd));
   ndswap(psn, ndnewbk(&nd));
   ndswap(pn, &nd);
@@ -2169,7 +2289,7 @@ node_t *wrap_subscript(node_t *pn, node_t *psn)
 node_t *wrap_postfix_operator(node_t *pn, tt_t op, sym_t id)
 {
   node_t nd = mknd();
-  ndset(&nd, NT_POSTFIX, pn->pwsid, pn->startpos);
+  ndset(&nd, NT_POSTFIX, pn->loc);
   ndswap(pn, ndnewbk(&nd));
   nd.op = op; nd.name = id;
   ndswap(pn, &nd);
@@ -2178,10 +2298,10 @@ node_t *wrap_postfix_operator(node_t *pn, tt_t op, sym_t id)
 }
 
 /* wrap expr node into NT_PREFIX type node */
-node_t *wrap_unary_operator(node_t *pn, int startpos, tt_t op)
+node_t *wrap_unary_operator(node_t *pn, srcloc_t loc, tt_t op)
 {
   node_t nd = mknd();
-  ndset(&nd, NT_PREFIX, pn->pwsid, startpos);
+  ndset(&nd, NT_PREFIX, loc);
   ndswap(pn, ndnewbk(&nd));
   nd.op = op;
   ndswap(pn, &nd);
@@ -2225,7 +2345,7 @@ node_t *init_to_int(node_t *pn, int n)
 extern node_t *set_to_int(node_t *pn, int n)
 {
   node_t nd = mknd();
-  ndset(&nd, NT_LITERAL, pn->pwsid, pn->startpos);
+  ndset(&nd, NT_LITERAL, pn->loc);
   nd.ts = TS_INT, nd.val.i = n;
   ndswap(pn, &nd);
   ndfini(&nd);
@@ -2236,7 +2356,7 @@ extern node_t *set_to_int(node_t *pn, int n)
 node_t *wrap_cast_expr(node_t *pcn, node_t *pn)
 {
   node_t nd = mknd();
-  ndset(&nd, NT_CAST, pcn->pwsid, pcn->startpos);
+  ndset(&nd, NT_CAST, pcn->loc);
   ndswap(pcn, ndnewbk(&nd));
   ndswap(pn, ndnewbk(&nd));
   ndswap(pcn, &nd);
@@ -2248,7 +2368,7 @@ node_t *wrap_cast_expr(node_t *pcn, node_t *pn)
 node_t *wrap_expr_cast(node_t *pn, node_t *pcn)
 {
   node_t nd = mknd();
-  ndset(&nd, NT_CAST, pcn->pwsid, pcn->startpos);
+  ndset(&nd, NT_CAST, pcn->loc);
   ndswap(pcn, ndnewbk(&nd));
   ndswap(pn, ndnewbk(&nd));
   ndswap(pn, &nd);
@@ -2260,7 +2380,7 @@ node_t *wrap_expr_cast(node_t *pn, node_t *pcn)
 node_t *wrap_binary(node_t *pn, tt_t op, node_t *pn2)
 {
   node_t nd = mknd();
-  ndset(&nd, NT_INFIX, pn->pwsid, pn->startpos);
+  ndset(&nd, NT_INFIX, pn->loc);
   ndswap(pn, ndnewbk(&nd));
   ndswap(pn2, ndnewbk(&nd));
   nd.op = op;
@@ -2273,7 +2393,7 @@ node_t *wrap_binary(node_t *pn, tt_t op, node_t *pn2)
 node_t *wrap_conditional(node_t *pn, node_t *pn2, node_t *pn3)
 {
   node_t nd = mknd();
-  ndset(&nd, NT_COND, pn->pwsid, pn->startpos);
+  ndset(&nd, NT_COND, pn->loc);
   ndswap(pn, ndnewbk(&nd));
   ndswap(pn2, ndnewbk(&nd));
   ndswap(pn3, ndnewbk(&nd));
@@ -2286,7 +2406,7 @@ node_t *wrap_conditional(node_t *pn, node_t *pn2, node_t *pn3)
 node_t *wrap_assignment(node_t *pn, tt_t op, node_t *pn2)
 {
   node_t nd = mknd();
-  ndset(&nd, NT_ASSIGN, pn->pwsid, pn->startpos);
+  ndset(&nd, NT_ASSIGN, pn->loc);
   ndswap(pn, ndnewbk(&nd));
   ndswap(pn2, ndnewbk(&nd));
   nd.op = op;
@@ -2299,7 +2419,7 @@ node_t *wrap_assignment(node_t *pn, tt_t op, node_t *pn2)
 node_t *wrap_comma(node_t *pn, node_t *pn2)
 {
   node_t nd = mknd();
-  ndset(&nd, NT_COMMA, pn->pwsid, pn->startpos);
+  ndset(&nd, NT_COMMA, pn->loc);
   ndswap(pn, ndnewbk(&nd));
   ndswap(pn2, ndnewbk(&nd));
   ndswap(pn, &nd);
@@ -2342,7 +2462,7 @@ static bool type_specifier_ahead(pws_t *pw)
     case TT_LONG_KW:     case TT_RESTRICT_KW: case TT_SHORT_KW:
     case TT_SIGNED_KW:   case TT_SIMD_KW:     case TT_STRUCT_KW: 
     case TT_UNION_KW:    case TT_UNSIGNED_KW: case TT_VOID_KW:   
-    case TT_VOLATILE_KW: case TT_TYPE_NAME:
+    case TT_VOLATILE_KW: case TT_TYPE_NAME:    case TT_ATOMIC_KW:
       return true;
     default:;
   }
@@ -2417,7 +2537,7 @@ void patch_macro_template(buf_t *pids, ndbuf_t *ppars, node_t *pn)
   } else if (node_is_countofetc(pn) && no_etcpars(ppars)) {
     size_t pcnt = ndblen(ppars), ecnt = pcnt-(n-1); 
     node_t nd = mknd(); assert(pcnt >= n-1);
-    ndset(&nd, NT_LITERAL, pn->pwsid, pn->startpos);
+    ndset(&nd, NT_LITERAL, pn->loc);
     nd.ts = TS_INT; nd.val.i = (int)ecnt;
     ndswap(pn, &nd); ndfini(&nd);
   } else if (node_is_generic(pn)) {
@@ -2509,7 +2629,7 @@ static void parse_primary_expr(pws_t *pw, node_t *pn)
     case TT_LONG: /* longs are the same size as pointers; wasm32 */
     case TT_INT: { /* 0 .. 2147483647 (INT32_MIN is written as = -2147483647-1) */
       char *ns = pw->tokstr; unsigned long ul;
-      ndset(pn, NT_LITERAL, pw->id, startpos); 
+      ndset(pn, NT_LITERAL, pwsloc(pw, startpos)); 
       if (errno = 0, ul = strtoul(ns, NULL, 0), !errno && ul <= 0x7FFFFFFFUL) {
         pn->val.i = (long)ul; /* no need for for sext: too small? */
       } else reprintf(pw, startpos, "signed int literal overflow"); 
@@ -2519,7 +2639,7 @@ static void parse_primary_expr(pws_t *pw, node_t *pn)
     case TT_ULONG: /* ulongs are the same size as pointers; wasm32 */
     case TT_UINT: { /* 0 .. 4294967295 */
       char *ns = pw->tokstr; unsigned long ul;
-      ndset(pn, NT_LITERAL, pw->id, startpos); 
+      ndset(pn, NT_LITERAL, pwsloc(pw, startpos)); 
       if (errno = 0, ul = strtoul(ns, NULL, 0), !errno && ul <= 0xFFFFFFFFUL) {
         pn->val.u = ul;
       } else reprintf(pw, startpos, "unsigned int literal overflow"); 
@@ -2528,7 +2648,7 @@ static void parse_primary_expr(pws_t *pw, node_t *pn)
     } break;
     case TT_LLONG: { /* 0 .. 9223372036854775807 (INT64_MIN is written as = -9223372036854775807-1) */
       char *ns = pw->tokstr; unsigned long long ull;
-      ndset(pn, NT_LITERAL, pw->id, startpos); 
+      ndset(pn, NT_LITERAL, pwsloc(pw, startpos)); 
       if (errno = 0, ull = strtoull(ns, NULL, 0), !errno && ull <= 0x7FFFFFFFFFFFFFFFULL) {
         pn->val.i = (long long)ull; /* no need for for sext */
       } else reprintf(pw, startpos, "signed long literal overflow"); 
@@ -2537,7 +2657,7 @@ static void parse_primary_expr(pws_t *pw, node_t *pn)
     } break;
     case TT_ULLONG: { /* 0 .. 18446744073709551615 */
       char *ns = pw->tokstr; unsigned long long ull;
-      ndset(pn, NT_LITERAL, pw->id, startpos); 
+      ndset(pn, NT_LITERAL, pwsloc(pw, startpos)); 
       if (errno = 0, ull = strtoull(ns, NULL, 0), !errno && ull <= 0xFFFFFFFFFFFFFFFFULL) {
         pn->val.u = ull;
       } else reprintf(pw, startpos, "unsigned long literal overflow"); 
@@ -2546,7 +2666,7 @@ static void parse_primary_expr(pws_t *pw, node_t *pn)
     } break;
     case TT_FLOAT: {
       char *ns = pw->tokstr; double d;
-      ndset(pn, NT_LITERAL, pw->id, startpos); 
+      ndset(pn, NT_LITERAL, pwsloc(pw, startpos)); 
       if (errno = 0, d = strtod(ns, NULL), !errno) {
         pn->val.f = (float)d;
       } else reprintf(pw, startpos, "invalid float literal"); 
@@ -2555,7 +2675,7 @@ static void parse_primary_expr(pws_t *pw, node_t *pn)
     } break;
     case TT_DOUBLE: {
       char *ns = pw->tokstr; double d;
-      ndset(pn, NT_LITERAL, pw->id, startpos); 
+      ndset(pn, NT_LITERAL, pwsloc(pw, startpos)); 
       if (errno = 0, d = strtod(ns, NULL), !errno) {
         pn->val.d = d;
       } else reprintf(pw, startpos, "invalid double literal"); 
@@ -2564,7 +2684,7 @@ static void parse_primary_expr(pws_t *pw, node_t *pn)
     } break;
     case TT_CHAR: {
       char *ns = pw->tokstr; unsigned long ul;
-      ndset(pn, NT_LITERAL, pw->id, startpos); 
+      ndset(pn, NT_LITERAL, pwsloc(pw, startpos)); 
       if (errno = 0, ul = strtou8cc32(ns, NULL, NULL), !errno && ul <= 0x10FFFFUL) {
         pn->val.i = ul; /* no sext: too small */
       } else reprintf(pw, startpos, "char literal overflow");
@@ -2573,7 +2693,7 @@ static void parse_primary_expr(pws_t *pw, node_t *pn)
     } break;
     case TT_LCHAR: {
       char *ns = pw->tokstr; unsigned long ul;
-      ndset(pn, NT_LITERAL, pw->id, startpos); 
+      ndset(pn, NT_LITERAL, pwsloc(pw, startpos)); 
       if (errno = 0, ul = strtou8cc32(ns, NULL, NULL), !errno && ul <= 0x10FFFFUL) {
         pn->val.i = ul; /* no sext: too small */
       } else reprintf(pw, startpos, "long char literal overflow");
@@ -2582,7 +2702,7 @@ static void parse_primary_expr(pws_t *pw, node_t *pn)
     } break;
     case TT_STRING: {
       char *ns = pw->tokstr; unsigned long ul; bool raw;
-      ndset(pn, NT_LITERAL, pw->id, startpos); 
+      ndset(pn, NT_LITERAL, pwsloc(pw, startpos)); 
       while (*ns && (errno = 0, ul = strtou8cc32(ns, &ns, &raw), !errno && ul <= 0x10FFFFUL)) {
         if (raw) { assert(ul <= 0xFFL); cbputc(ul, &pn->data); }
         else cbputlc(ul, &pn->data); /* in utf-8 */
@@ -2595,7 +2715,7 @@ static void parse_primary_expr(pws_t *pw, node_t *pn)
     } break;
     case TT_LSTRING: {
       char *ns = pw->tokstr; unsigned long ul;
-      ndset(pn, NT_LITERAL, pw->id, startpos); 
+      ndset(pn, NT_LITERAL, pwsloc(pw, startpos)); 
       while (*ns && (errno = 0, ul = strtou8cc32(ns, &ns, NULL), !errno && ul <= 0x10FFFFUL)) {
         cbput4le((unsigned)ul, &pn->data); /* 4 bytes, in LE order */
       }
@@ -2605,18 +2725,18 @@ static void parse_primary_expr(pws_t *pw, node_t *pn)
       dropt(pw);
     } break;
     case TT_IDENTIFIER: {
-      ndset(pn, NT_IDENTIFIER, pw->id, startpos); 
+      ndset(pn, NT_IDENTIFIER, pwsloc(pw, startpos)); 
       pn->name = getid(pw);
     } break;
     case TT_ELLIPSIS: { /* same as va_etc() */
       dropt(pw);
-      ndset(pn, NT_INTRCALL, pw->id, startpos);
+      ndset(pn, NT_INTRCALL, pwsloc(pw, startpos));
       pn->intr = INTR_VAETC;
     } break;
     case TT_ENUM_NAME: {
       /* todo: cast to enum type for extra type checking */
       int info = 42; lookup_symbol(pw->tokstr, &info);
-      ndset(pn, NT_LITERAL, pw->id, startpos);
+      ndset(pn, NT_LITERAL, pwsloc(pw, startpos));
       pn->ts = TS_INT; pn->val.i = info;
       dropt(pw);
     } break;
@@ -2662,14 +2782,14 @@ static void parse_primary_expr(pws_t *pw, node_t *pn)
         buffini(&ids); ndbfini(&pars); 
       } else assert(false);
       /* use current loc info on outer level */
-      pn->pwsid = pw->id; pn->startpos = startpos;
+      pn->loc = pwsloc(pw, startpos);
     } break;
     case TT_INTR_NAME: {
       /* intrinsic application */
       int intr = INTR_NONE; lookup_symbol(pw->tokstr, &intr);
       if (intr == INTR_NONE) 
         reprintf(pw, startpos, "use of undefined intrinsic??");
-      ndset(pn, NT_INTRCALL, pw->id, startpos);
+      ndset(pn, NT_INTRCALL, pwsloc(pw, startpos));
       dropt(pw);
       pn->intr = (intr_t)intr;
       switch (intr) {
@@ -2692,7 +2812,7 @@ static void parse_primary_expr(pws_t *pw, node_t *pn)
         case INTR_VAARG: { /* (id, type) */
           node_t *ptn = ndnewbk(pn);
           expect(pw, TT_LPAR, "(");
-          ndset(ptn, NT_IDENTIFIER, pw->id, peekpos(pw));
+          ndset(ptn, NT_IDENTIFIER, pwsloc(pw, peekpos(pw)));
           ptn->name = getid(pw); 
           expect(pw, TT_COMMA, ",");
           ptn = ndnewbk(pn);
@@ -2715,7 +2835,7 @@ static void parse_primary_expr(pws_t *pw, node_t *pn)
           }
           expect(pw, TT_COMMA, ",");
           ptn = ndnewbk(pn);
-          ndset(ptn, NT_IDENTIFIER, pw->id, peekpos(pw));
+          ndset(ptn, NT_IDENTIFIER, pwsloc(pw, peekpos(pw)));
           ptn->name = getid(pw); 
           expect(pw, TT_RPAR, ")"); 
         } break;
@@ -2851,7 +2971,7 @@ static void parse_postfix_expr(pws_t *pw, node_t *pn)
       case TT_LPAR: {
         node_t nd = mknd();
         dropt(pw);
-        ndset(&nd, NT_CALL, pn->pwsid, pn->startpos);
+        ndset(&nd, NT_CALL, pn->loc);
         ndswap(pn, ndnewbk(&nd));
         while (peekt(pw) != TT_RPAR) {
           parse_assignment_expr(pw, ndnewbk(&nd));
@@ -2886,7 +3006,7 @@ static void parse_unary_expr(pws_t *pw, node_t *pn)
       tt_t tk = pw->ctk; dropt(pw);
       parse_cast_expr(pw, pn);
       if (pn->nt == NT_TYPE) reprintf(pw, startpos, "unexpected type cast");
-      wrap_unary_operator(pn, startpos, tk);
+      wrap_unary_operator(pn, pwsloc(pw, startpos), tk);
     } break;
     default: {
       parse_postfix_expr(pw, pn);
@@ -2985,12 +3105,13 @@ static void parse_asm_instr(pws_t *pw, node_t *pan)
       (TT_TYPE_NAME <= tt && tt <= TT_INTR_NAME)) {
       bool dot = peekc(pw) == '.';
       cbputs(pw->tokstr, &cb); dropt(pw);
-      if (dot) {
+      while (dot) { /* i32.load, i32.atomic.rmw.add, ... */
         expect(pw, TT_DOT, "."); cbputc('.', &cb); 
-        tt = peekt(pw);
+        tt = peekt(pw); dot = false;
         if (tt == TT_IDENTIFIER || 
           (TT_AUTO_KW <= tt && tt <= TT_WHILE_KW) ||
           (TT_TYPE_NAME <= tt && tt <= TT_INTR_NAME)) {
+          dot = peekc(pw) == '.';
           cbputs(pw->tokstr, &cb); dropt(pw);
         }
       }
@@ -3119,7 +3240,7 @@ static void parse_asm_instr(pws_t *pw, node_t *pan)
 static void parse_asm_code(pws_t *pw, node_t *pn, node_t *ptn)
 {
   assert(ptn->nt == NT_TYPE);
-  ndset(pn, NT_ACODE, pw->id, pw->pos);
+  ndset(pn, NT_ACODE, pwsloc(pw, pw->pos));
   ndswap(ptn, ndnewbk(pn));
   expect(pw, TT_ASM_KW, "asm");
   expect(pw, TT_LPAR, "(");
@@ -3132,7 +3253,7 @@ static void parse_asm_code(pws_t *pw, node_t *pn, node_t *ptn)
   if (peekt(pw) == TT_LPAR) {
     node_t nd = mknd();
     dropt(pw);
-    ndset(&nd, NT_INTRCALL, pn->pwsid, pn->startpos);
+    ndset(&nd, NT_INTRCALL, pn->loc);
     nd.intr = INTR_ACODE;
     ndswap(pn, ndnewbk(&nd));
     while (peekt(pw) != TT_RPAR) {
@@ -3332,19 +3453,19 @@ static void parse_expr(pws_t *pw, node_t *pn)
 /* fill pn with definition of typedef'd type tn */
 static void load_typedef_type(pws_t *pw, node_t *pn, sym_t tn)
 {
-  int info = -1, pwsid = pn->pwsid, startpos = pn->startpos; 
+  int info = -1; srcloc_t loc = pn->loc; 
   lookup_symbol(symname(tn), &info);
   if (info < 0) reprintf(pw, pw->pos, "can't find definition of type: %s", symname(tn));
   assert(info >= 0 && info < (int)ndblen(&g_nodes));
   ndcpy(pn, ndbref(&g_nodes, (size_t)info));
-  pn->pwsid = pwsid, pn->startpos = startpos; 
+  pn->loc = loc; 
   assert(pn->nt == NT_TYPE);
 }
 
 /* parse enum body (name? + enumlist?) */
 static void parse_enum_body(pws_t *pw, node_t *pn)
 {
-  ndset(pn, NT_TYPE, pw->id, peekpos(pw));
+  ndset(pn, NT_TYPE, pwsloc(pw, peekpos(pw)));
   pn->ts = TS_ENUM;
   if (peekt(pw) == TT_IDENTIFIER) pn->name = getid(pw);
   if (peekt(pw) == TT_LBRC) {
@@ -3352,7 +3473,7 @@ static void parse_enum_body(pws_t *pw, node_t *pn)
     dropt(pw);
     while (peekt(pw) != TT_RBRC) {
       node_t *pni = ndnewbk(pn), *pnv; int *pi;
-      ndset(pni, NT_VARDECL, pw->id, peekpos(pw));
+      ndset(pni, NT_VARDECL, pwsloc(pw, peekpos(pw)));
       pni->name = getid(pw);
       pi = bufbsearch(&g_syminfo, &pni->name, &int_cmp);
       if (pi) neprintf(pni, "enum constant name is already in use");
@@ -3363,7 +3484,7 @@ static void parse_enum_body(pws_t *pw, node_t *pn)
         if (!arithmetic_eval_to_int(pnv, NULL, &curval))
           neprintf(pnv, "invalid enum initializer (int constant expected)");
       }
-      ndset(pnv, NT_LITERAL, pw->id, pni->startpos);
+      ndset(pnv, NT_LITERAL, pni->loc);
       pnv->ts = TS_INT; pnv->val.i = curval;
       intern_symbol(symname(pni->name), TT_ENUM_NAME, curval);  
       if (peekt(pw) == TT_COMMA) dropt(pw);
@@ -3372,14 +3493,14 @@ static void parse_enum_body(pws_t *pw, node_t *pn)
     expect(pw, TT_RBRC, "}");
   }  
   if (!pn->name && !ndlen(pn)) {
-    reprintf(pw, pn->startpos, "incomplete enum");
+    neprintf(pn, "incomplete enum");
   } else if (pn->name && ndlen(pn)) {
     /* register this enum type for lazy fetch */
     const char *tag = "enum"; tt_t tt = TT_ENUM_KW;
     sym_t s = internf("%s %s", tag, symname(pn->name));
     int *pinfo = bufbsearch(&g_syminfo, &s, &int_cmp);
     if (pinfo) {
-      reprintf(pw, pn->startpos, "redefinition of %s", symname(s));
+      neprintf(pn, "redefinition of %s", symname(s));
     } else {
       intern_symbol(symname(s), tt, (int)ndblen(&g_nodes));
       ndcpy(ndbnewbk(&g_nodes), pn);
@@ -3391,7 +3512,7 @@ static void parse_enum_body(pws_t *pw, node_t *pn)
 static void parse_simd_body(pws_t *pw, node_t *pn)
 {
   node_t *ptn; int startpos; 
-  ndset(pn, NT_TYPE, pw->id, peekpos(pw));
+  ndset(pn, NT_TYPE, pwsloc(pw, peekpos(pw)));
   pn->ts = TS_V128;
   expect(pw, TT_LT, "<");
   ptn = ndnewbk(pn); startpos = peekpos(pw);
@@ -3401,7 +3522,7 @@ static void parse_simd_body(pws_t *pw, node_t *pn)
   expect(pw, TT_COMMA, ","); startpos = peekpos(pw);
   if (ahead(pw, "2") || ahead(pw, "4") || ahead(pw, "8") || ahead(pw, "16")) {
     node_t *pvn = ndnewbk(pn); long n = atol(pw->tokstr); dropt(pw);
-    ndset(pvn, NT_LITERAL, pw->id, startpos); pvn->ts = TS_INT; pvn->val.i = n; 
+    ndset(pvn, NT_LITERAL, pwsloc(pw, startpos)); pvn->ts = TS_INT; pvn->val.i = n; 
     switch (ptn->ts) {
       case TS_BOOL:                  n = 128; break; /* all sizes work */
       case TS_CHAR:  case TS_UCHAR:  n *=  8; break;
@@ -3418,11 +3539,13 @@ static void parse_simd_body(pws_t *pw, node_t *pn)
   expect(pw, TT_GT, ">");
 }
 
-/* parse struct or union body (name? + declist?) */
+/* parse struct or union body (name? + declist?); definitions are
+ * registered and shared, so anonymous ones get a unique '@n' name */
+static int g_anonsrucnt = 0;
 static void parse_sru_body(pws_t *pw, ts_t sru, node_t *pn)
 {
   size_t i;
-  ndset(pn, NT_TYPE, pw->id, peekpos(pw));
+  ndset(pn, NT_TYPE, pwsloc(pw, peekpos(pw)));
   pn->ts = sru;
   if (peekt(pw) == TT_IDENTIFIER) pn->name = getid(pw);
   if (peekt(pw) == TT_LBRC) {
@@ -3430,7 +3553,7 @@ static void parse_sru_body(pws_t *pw, ts_t sru, node_t *pn)
     while (peekt(pw) != TT_RBRC) {
       sc_t sc = parse_decl(pw, &pn->body);
       if (sc != SC_NONE)
-        reprintf(pw, pn->startpos, "unexpected storage declarations in struct/union"); 
+        neprintf(pn, "unexpected storage declarations in struct/union"); 
       expect(pw, TT_SEMICOLON, ";"); /* no block-level function definitions */
     }
     expect(pw, TT_RBRC, "}");
@@ -3438,21 +3561,24 @@ static void parse_sru_body(pws_t *pw, ts_t sru, node_t *pn)
   for (i = 0; i < ndlen(pn); ++i) {
     node_t *pni = ndref(pn, i);
     if (pni->nt == NT_VARDECL && ndlen(pni) > 1) 
-      reprintf(pw, pni->startpos, "unexpected initializer in struct/union"); 
+      neprintf(pni, "unexpected initializer in struct/union"); 
   }
   if (!pn->name && !ndlen(pn)) {
-    reprintf(pw, pn->startpos, "incomplete struct/union");
-  } else if (pn->name && ndlen(pn)) {
+    neprintf(pn, "incomplete struct/union");
+  } else if (ndlen(pn)) {
+    if (!pn->name) pn->name = internf("@%d", ++g_anonsrucnt);
     /* register this struct/union type for lazy fetch */
     const char *tag = (sru == TS_STRUCT) ? "struct" : "union";
     tt_t tt = (sru == TS_STRUCT) ? TT_STRUCT_KW : TT_UNION_KW;
     sym_t s = internf("%s %s", tag, symname(pn->name));
     int *pinfo = bufbsearch(&g_syminfo, &s, &int_cmp);
     if (pinfo) {
-      reprintf(pw, pn->startpos, "redefinition of %s", symname(s));
+      neprintf(pn, "redefinition of %s", symname(s));
     } else {
       intern_symbol(symname(s), tt, (int)ndblen(&g_nodes));
       ndcpy(ndbnewbk(&g_nodes), pn);
+      /* the definition is shared: keep just the name here */
+      ndbclear(&pn->body);
     }
   }
 }
@@ -3482,6 +3608,9 @@ static void parse_base_type(pws_t *pw, node_t *pn)
       case TT_CONST_KW:    /* ignored */ break;  
       case TT_VOLATILE_KW: /* ignored */ break;
       case TT_RESTRICT_KW: /* ignored */ break;
+      case TT_ATOMIC_KW:
+        reprintf(pw, pw->pos, "_Atomic is not supported: use atomic_* operations from <stdatomic.h>");
+        break;
       default: assert(false);
     }
     dropt(pw);
@@ -3494,7 +3623,7 @@ static void parse_base_type(pws_t *pw, node_t *pn)
     reprintf(pw, pw->pos, "invalid type specifier: missing or conflicting keywords"); 
   if (f + d + en + si + st + un + ty > 0 && sg + ug > 0)
     reprintf(pw, pw->pos, "invalid type specifier: unexpected signedness keyword"); 
-  ndset(pn, NT_TYPE, pw->id, pos);
+  ndset(pn, NT_TYPE, pwsloc(pw, pos));
   if (v) pn->ts = TS_VOID;
   else if (c && !ug) pn->ts = TS_CHAR; 
   else if (c && ug) pn->ts = TS_UCHAR; 
@@ -3520,19 +3649,19 @@ static void parse_primary_declarator(pws_t *pw, node_t *pn)
 {
   switch (peekt(pw)) {
     case TT_IDENTIFIER: {
-      ndset(pn, NT_IDENTIFIER, pw->id, peekpos(pw)); 
+      ndset(pn, NT_IDENTIFIER, pwsloc(pw, peekpos(pw))); 
       pn->name = getid(pw);
     } break;
     case TT_COMMA: case TT_LBRK: case TT_RPAR: case TT_COLON: {
       /* identifier is missing: allow here, but check in the caller */
-      ndset(pn, NT_NULL, pw->id, peekpos(pw)); 
+      ndset(pn, NT_NULL, pwsloc(pw, peekpos(pw))); 
     } break;
     case TT_LPAR: {
       dropt(pw);
       /* NB: empty pair of parens () could only be a parameter list! */
       if (peekt(pw) == TT_RPAR) {
         /* we've got a missing identifier followed by (); handle it here */
-        ndset(pn, NT_NULL, pw->id, peekpos(pw));
+        ndset(pn, NT_NULL, pwsloc(pw, peekpos(pw)));
         wrap_type_function(pn, NULL);
       } else {
         /* nested declarator */
@@ -3564,8 +3693,8 @@ static void parse_postfix_declarator(pws_t *pw, node_t *pn)
         ndbuf_t ndb; ndbinit(&ndb); 
         dropt(pw);
         while (peekt(pw) != TT_RPAR) {
-          node_t *pdn = ndset(ndbnewbk(&ndb), NT_VARDECL, pw->id, peekpos(pw));
-          node_t *pti = ndset(ndnewbk(pdn), NT_TYPE, pw->id, peekpos(pw)); 
+          node_t *pdn = ndset(ndbnewbk(&ndb), NT_VARDECL, pwsloc(pw, peekpos(pw)));
+          node_t *pti = ndset(ndnewbk(pdn), NT_TYPE, pwsloc(pw, peekpos(pw))); 
           if (peekt(pw) == TT_ELLIPSIS) { /* starting with ellipsis is ok */
             pti->ts = TS_ETC;
             dropt(pw);
@@ -3594,6 +3723,9 @@ static void parse_unary_declarator(pws_t *pw, node_t *pn)
         dropt(pw); /* allowed but ignored */
         goto retry;
       } break;
+      case TT_ATOMIC_KW: {
+        reprintf(pw, pw->pos, "_Atomic is not supported: use atomic_* operations from <stdatomic.h>");
+      } break;
       case TT_STAR: {
         dropt(pw);
         parse_unary_declarator(pw, pn);
@@ -3658,7 +3790,7 @@ static sym_t parse_declarator(pws_t *pw, node_t *ptn)
 static void parse_initializer(pws_t *pw, node_t *pn)
 {
   if (peekt(pw) == TT_LBRC) {
-    ndset(pn, NT_DISPLAY, pw->id, peekpos(pw));
+    ndset(pn, NT_DISPLAY, pwsloc(pw, peekpos(pw)));
     ndinsbk(pn, NT_TYPE); /* placeholder TS_VOID type */
     dropt(pw);
     while (peekt(pw) != TT_RBRC) {
@@ -3676,7 +3808,7 @@ static void parse_init_declarator(pws_t *pw, sc_t sc, const node_t *ptn, ndbuf_t
   /* declarator (= expr/{display})? */
   node_t *pn = ndbnewbk(pnb), *pni, *psn, tn; sym_t id;
   ndicpy(&tn, ptn);
-  ndset(pn, NT_VARDECL, pw->id, pw->pos);
+  ndset(pn, NT_VARDECL, pwsloc(pw, pw->pos));
   pn->name = id = parse_declarator(pw, &tn);
   if (id == 0) reprintf(pw, pw->pos, "declared identifier is missing");
   pn->name = id; pn->sc = sc;
@@ -3687,10 +3819,10 @@ static void parse_init_declarator(pws_t *pw, sc_t sc, const node_t *ptn, ndbuf_t
   }
   dropt(pw);
   pn = ndbnewbk(pnb);
-  ndset(pn, NT_ASSIGN, pw->id, pw->pos);
+  ndset(pn, NT_ASSIGN, pwsloc(pw, pw->pos));
   pn->op = TT_ASN;
   pni = ndnewbk(pn);
-  ndset(pni, NT_IDENTIFIER, pw->id, pw->pos); 
+  ndset(pni, NT_IDENTIFIER, pwsloc(pw, pw->pos)); 
   pni->name = id;
   psn = ndnewbk(pn);
   parse_initializer(pw, psn);
@@ -3739,7 +3871,7 @@ static void parse_switch_clause(pws_t *pw, node_t *pn)
 {
   tt_t ctk = peekt(pw);
   if (ctk == TT_CASE_KW || ctk == TT_DEFAULT_KW) {
-    ndset(pn, ctk == TT_CASE_KW ? NT_CASE : NT_DEFAULT, pw->id, pw->pos);
+    ndset(pn, ctk == TT_CASE_KW ? NT_CASE : NT_DEFAULT, pwsloc(pw, pw->pos));
     dropt(pw);
     if (ctk == TT_CASE_KW) parse_expr(pw, ndnewbk(pn));
     expect(pw, TT_COLON, ":");
@@ -3754,11 +3886,11 @@ static void parse_stmt(pws_t *pw, node_t *pn)
 {
   switch (peekt(pw)) {
     case TT_SEMICOLON: {
-      ndset(pn, NT_NULL, pw->id, pw->pos);
+      ndset(pn, NT_NULL, pwsloc(pw, pw->pos));
       dropt(pw);
     } break;
     case TT_LBRC: {
-      ndset(pn, NT_BLOCK, pw->id, pw->pos);
+      ndset(pn, NT_BLOCK, pwsloc(pw, pw->pos));
       dropt(pw);
       while (peekt(pw) != TT_RBRC) {
         if (peekt(pw) == TT_TYPEDEF_KW) {
@@ -3784,7 +3916,7 @@ static void parse_stmt(pws_t *pw, node_t *pn)
       expect(pw, TT_RBRC, "}");
     } break;
     case TT_IF_KW: {
-      ndset(pn, NT_IF, pw->id, pw->pos);
+      ndset(pn, NT_IF, pwsloc(pw, pw->pos));
       dropt(pw);
       expect(pw, TT_LPAR, "(");
       parse_expr(pw, ndnewbk(pn));
@@ -3796,7 +3928,7 @@ static void parse_stmt(pws_t *pw, node_t *pn)
       }
     } break;
     case TT_SWITCH_KW: {
-      ndset(pn, NT_SWITCH, pw->id, pw->pos);
+      ndset(pn, NT_SWITCH, pwsloc(pw, pw->pos));
       dropt(pw);
       expect(pw, TT_LPAR, "(");
       parse_expr(pw, ndnewbk(pn));
@@ -3806,7 +3938,7 @@ static void parse_stmt(pws_t *pw, node_t *pn)
       expect(pw, TT_RBRC, "}");
     } break;
     case TT_WHILE_KW: {
-      ndset(pn, NT_WHILE, pw->id, pw->pos);
+      ndset(pn, NT_WHILE, pwsloc(pw, pw->pos));
       dropt(pw);
       expect(pw, TT_LPAR, "(");
       parse_expr(pw, ndnewbk(pn));
@@ -3814,7 +3946,7 @@ static void parse_stmt(pws_t *pw, node_t *pn)
       parse_stmt(pw, ndnewbk(pn));
     } break;
     case TT_DO_KW: {
-      ndset(pn, NT_DO, pw->id, pw->pos);
+      ndset(pn, NT_DO, pwsloc(pw, pw->pos));
       dropt(pw);
       parse_stmt(pw, ndnewbk(pn));
       expect(pw, TT_WHILE_KW, "while");
@@ -3824,25 +3956,25 @@ static void parse_stmt(pws_t *pw, node_t *pn)
       expect(pw, TT_SEMICOLON, ";");
     } break;
     case TT_FOR_KW: {
-      ndset(pn, NT_FOR, pw->id, pw->pos);
+      ndset(pn, NT_FOR, pwsloc(pw, pw->pos));
       dropt(pw);
       expect(pw, TT_LPAR, "(");
       if (peekt(pw) != TT_SEMICOLON) {
         if (storage_class_specifier_ahead(pw) || type_specifier_ahead(pw)) {
           node_t *psn = ndnewbk(pn); sc_t sc;
-          ndset(psn, NT_BLOCK, pw->id, pw->pos);
+          ndset(psn, NT_BLOCK, pwsloc(pw, pw->pos));
           if ((sc = parse_decl(pw, &psn->body)) == SC_EXTERN || sc == SC_STATIC)
             reprintf(pw, pw->pos, "block-level extern/static declarations are not supported"); 
         } else {
           parse_expr(pw, ndnewbk(pn));
         }
-      } else ndset(ndnewbk(pn), NT_NULL, pw->id, pw->pos); 
+      } else ndset(ndnewbk(pn), NT_NULL, pwsloc(pw, pw->pos)); 
       expect(pw, TT_SEMICOLON, ";");
       if (peekt(pw) != TT_SEMICOLON) parse_expr(pw, ndnewbk(pn));
-      else ndset(ndnewbk(pn), NT_NULL, pw->id, pw->pos); 
+      else ndset(ndnewbk(pn), NT_NULL, pwsloc(pw, pw->pos)); 
       expect(pw, TT_SEMICOLON, ";");
       if (peekt(pw) != TT_RPAR) parse_expr(pw, ndnewbk(pn));
-      else ndset(ndnewbk(pn), NT_NULL, pw->id, pw->pos); 
+      else ndset(ndnewbk(pn), NT_NULL, pwsloc(pw, pw->pos)); 
       expect(pw, TT_RPAR, ")");
       parse_stmt(pw, ndnewbk(pn));
       if (ndref(pn, 0)->nt == NT_BLOCK) {
@@ -3852,23 +3984,23 @@ static void parse_stmt(pws_t *pw, node_t *pn)
       }
     } break;
     case TT_BREAK_KW: {
-      ndset(pn, NT_BREAK, pw->id, pw->pos);
+      ndset(pn, NT_BREAK, pwsloc(pw, pw->pos));
       dropt(pw);
       expect(pw, TT_SEMICOLON, ";");
     } break;
     case TT_CONTINUE_KW: { 
-      ndset(pn, NT_CONTINUE, pw->id, pw->pos);
+      ndset(pn, NT_CONTINUE, pwsloc(pw, pw->pos));
       dropt(pw);
       expect(pw, TT_SEMICOLON, ";");
     } break;
     case TT_RETURN_KW: {
-      ndset(pn, NT_RETURN, pw->id, pw->pos);
+      ndset(pn, NT_RETURN, pwsloc(pw, pw->pos));
       dropt(pw);
       if (peekt(pw) != TT_SEMICOLON) parse_expr(pw, ndnewbk(pn));
       expect(pw, TT_SEMICOLON, ";");
     } break;
     case TT_GOTO_KW: {
-      ndset(pn, NT_GOTO, pw->id, pw->pos);
+      ndset(pn, NT_GOTO, pwsloc(pw, pw->pos));
       dropt(pw);
       pn->name = getid(pw);
       expect(pw, TT_SEMICOLON, ";");
@@ -3886,7 +4018,7 @@ static void parse_top_decl(pws_t *pw, node_t *pn)
 {
   if (storage_class_specifier_ahead(pw) || type_specifier_ahead(pw)) {
     sc_t sc;
-    ndset(pn, NT_BLOCK, pw->id, pw->pos);
+    ndset(pn, NT_BLOCK, pwsloc(pw, pw->pos));
     pn->name = pw->curmod;
     sc = parse_decl(pw, &pn->body);
     if (sc == SC_AUTO || sc == SC_REGISTER)
@@ -3917,7 +4049,7 @@ static void parse_top_typedef(pws_t *pw, node_t *pn)
 {
   int startpos = peekpos(pw);
   expect(pw, TT_TYPEDEF_KW, "typedef");
-  ndset(pn, NT_TYPEDEF, pw->id, startpos);
+  ndset(pn, NT_TYPEDEF, pwsloc(pw, startpos));
   if (type_specifier_ahead(pw)) {
     node_t *ptn = ndnewbk(pn);
     parse_base_type(pw, ptn);
@@ -3959,7 +4091,7 @@ static void parse_define_directive(pws_t *pw, int startpos)
   if (peekt(pw) == TT_IDENTIFIER && streql(pw->tokstr, "define")) {
     int *pi, info = (int)ndblen(&g_nodes); node_t *pn = ndbnewbk(&g_nodes);
     dropt(pw);
-    ndset(pn, NT_MACRODEF, pw->id, startpos);
+    ndset(pn, NT_MACRODEF, pwsloc(pw, startpos));
     if (peekt(pw) == TT_MACRO_NAME)
       reprintf(pw, peekpos(pw), "macro already defined; use #undef before redefinition");
     pn->name = getid(pw);
@@ -3969,13 +4101,13 @@ static void parse_define_directive(pws_t *pw, int startpos)
     if (peekc(pw) == '(') {
       /* macro with parameters */
       node_t *ptn = ndnewbk(pn);
-      ndset(ptn, NT_TYPE, pw->id, peekpos(pw));
+      ndset(ptn, NT_TYPE, pwsloc(pw, peekpos(pw)));
       ptn->ts = TS_FUNCTION;
       ndnewbk(ptn); /* return value type is not set */
       expect(pw, TT_LPAR, "(");
       while (peekt(pw) != TT_RPAR) {
         node_t *pti = ndnewbk(ptn);
-        ndset(pti, NT_VARDECL, pw->id, peekpos(pw));
+        ndset(pti, NT_VARDECL, pwsloc(pw, peekpos(pw)));
         if (peekt(pw) == TT_ELLIPSIS) {
           pti->name = 0;
           dropt(pw);
@@ -4041,7 +4173,7 @@ static void parse_include_directive(pws_t *pw, node_t *pn, int startpos)
       reprintf(pw, peekpos(pw), "unsupported module name in include directive");
     dropt(pw);
     strtrc(s, '/', '.');
-    ndset(pn, NT_INCLUDE, pw->id, startpos);
+    ndset(pn, NT_INCLUDE, pwsloc(pw, startpos));
     pn->name = intern(cbdata(&cb));
     pn->op = TT_STRING;
   } else {
@@ -4067,7 +4199,7 @@ static void parse_include_directive(pws_t *pw, node_t *pn, int startpos)
       }
     }
     expect(pw, TT_GT, ">");
-    ndset(pn, NT_INCLUDE, pw->id, startpos);
+    ndset(pn, NT_INCLUDE, pwsloc(pw, startpos));
     pn->name = intern(cbdata(&cb));
     pn->op = TT_IDENTIFIER;
   }
@@ -4162,21 +4294,24 @@ static bool parse_cc_inactive(pws_t *pw, bool gotactive)
 /* parse single top-level declaration/definition/directive */
 bool parse_top_form(pws_t *pw, node_t *pn)
 {
+  bool res = false;
+  phbeg("parse");
   ndclear(pn);
   if (peekt(pw) != TT_EOF) {
+    res = true;
     if (peekt(pw) == TT_HASH) {
       int startpos = peekpos(pw);
       dropt(pw);
       if (ahead(pw, "pragma")) {
-        bool cont = parse_pragma_directive(pw, startpos);
-        if (!cont) return false; /* bail out on '#pragma once' repeat */
-        ndset(pn, NT_BLOCK, pw->id, startpos);
+        /* bail out on '#pragma once' repeat */
+        res = parse_pragma_directive(pw, startpos);
+        if (res) ndset(pn, NT_BLOCK, pwsloc(pw, startpos));
       } else if (ahead(pw, "define")) {
         parse_define_directive(pw, startpos);
-        ndset(pn, NT_BLOCK, pw->id, startpos);
+        ndset(pn, NT_BLOCK, pwsloc(pw, startpos));
       } else if (ahead(pw, "undef")) {
         parse_define_directive(pw, startpos);
-        ndset(pn, NT_BLOCK, pw->id, startpos);
+        ndset(pn, NT_BLOCK, pwsloc(pw, startpos));
       } else if (ahead(pw, "include")) {
         parse_include_directive(pw, pn, startpos); 
       } else if (ahead(pw, "ifdef") || ahead(pw, "ifndef") || ahead(pw, "if")) {
@@ -4197,9 +4332,9 @@ bool parse_top_form(pws_t *pw, node_t *pn)
     } else {
       parse_top_decl(pw, pn); 
     } 
-    return true; 
   }
-  return false;
+  phend();
+  return res;
 }
 
 /* parse and collect top-level declarations/definitions */
@@ -4213,16 +4348,21 @@ void parse_translation_unit(pws_t *pw, ndbuf_t *pnb)
   } 
 }
 
+/* find workspace of node's location and position in it */
+static pws_t *ndpws(const node_t *pn, int *pstartpos)
+{
+  size_t off = 0; pws_t *pw = srcfind(pn->loc, &off);
+  *pstartpos = (pw != NULL) ? (int)off : -1;
+  return pw;
+}
+
 /* report node error, possibly printing location information, and exit */
 void neprintf(const node_t *pn, const char *fmt, ...)
 {
   pws_t *pw = NULL; int startpos = -1;
   va_list args;
   va_start(args, fmt); 
-  if (pn && pn->pwsid >= 0 && pn->pwsid < (int)buflen(&g_pwsbuf)) {
-    pw = *(pws_t**)bufref(&g_pwsbuf, (size_t)pn->pwsid);
-    startpos = pn->startpos;
-  }
+  if (pn) pw = ndpws(pn, &startpos);
   vrprintf(pw, startpos, fmt, args); 
   va_end(args); 
   exit(1);
@@ -4233,10 +4373,7 @@ void n2eprintf(const node_t *pn, const node_t *pn2, const char *fmt, ...)
   pws_t *pw = NULL; int startpos = -1;
   va_list args;
   va_start(args, fmt); 
-  if (pn && pn->pwsid >= 0 && pn->pwsid < (int)buflen(&g_pwsbuf)) {
-    pw = *(pws_t**)bufref(&g_pwsbuf, (size_t)pn->pwsid);
-    startpos = pn->startpos;
-  }
+  if (pn) pw = ndpws(pn, &startpos);
   vrprintf(pw, startpos, fmt, args); 
   va_end(args);
   if (pn2) neprintf(pn2, "(original location)");
@@ -4250,10 +4387,7 @@ void nwprintf(const node_t *pn, const char *fmt, ...)
     pws_t *pw = NULL; int startpos = -1;
     va_list args;
     va_start(args, fmt); 
-    if (pn && pn->pwsid >= 0 && pn->pwsid < (int)buflen(&g_pwsbuf)) {
-      pw = *(pws_t**)bufref(&g_pwsbuf, (size_t)pn->pwsid);
-      startpos = pn->startpos;
-    }
+    if (pn) pw = ndpws(pn, &startpos);
     vrprintf(pw, startpos, fmt, args); 
     va_end(args); 
   }
@@ -4433,8 +4567,9 @@ const char *op_name(tt_t op)
 static void dump(node_t *pn, FILE* fp, int indent)
 {
   size_t i;
-  if (pn->pwsid >= 0 && pn->startpos >= 0) {
-    fprintf(fp, "#|%10d%c|# ", pn->startpos, 'a'+pn->pwsid);
+  int startpos; pws_t *pw = ndpws(pn, &startpos);
+  if (pw != NULL) {
+    fprintf(fp, "#|%10d%c|# ", startpos, 'a'+pw->id);
   } else {
     fprintf(fp, "#|           |# ");
   }
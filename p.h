@@ -25,15 +25,16 @@ typedef enum tt {
   TT_LT,          TT_LE,          TT_GT,           TT_GE,
   TT_EQ,          TT_NE,          TT_DOT,          TT_ARROW,
   TT_ASN,         TT_QMARK,       TT_COLON,        TT_TILDE,
-  TT_ASM_KW,      TT_AUTO_KW,     TT_BREAK_KW,     TT_CASE_KW,   
-  TT_CHAR_KW,     TT_CONST_KW,    TT_CONSTEXPR_KW, TT_CONTINUE_KW, 
-  TT_DEFAULT_KW,  TT_DO_KW,       TT_DOUBLE_KW,    TT_ELSE_KW,      
-  TT_ENUM_KW,     TT_EXTERN_KW,   TT_FLOAT_KW,     TT_FOR_KW,
-  TT_GOTO_KW,     TT_IF_KW,       TT_INLINE_KW,    TT_INT_KW,      
-  TT_LONG_KW,     TT_REGISTER_KW, TT_RESTRICT_KW,  TT_RETURN_KW,
-  TT_SHORT_KW,    TT_SIGNED_KW,   TT_SIMD_KW,      TT_STATIC_KW,
-  TT_STRUCT_KW,   TT_SWITCH_KW,   TT_TYPEDEF_KW,   TT_UNION_KW,
-  TT_UNSIGNED_KW, TT_VOID_KW,     TT_VOLATILE_KW,  TT_WHILE_KW,    
+  TT_ASM_KW,      TT_ATOMIC_KW,   TT_AUTO_KW,      TT_BREAK_KW,
+  TT_CASE_KW,     TT_CHAR_KW,     TT_CONST_KW,     TT_CONSTEXPR_KW,
+  TT_CONTINUE_KW, TT_DEFAULT_KW,  TT_DO_KW,        TT_DOUBLE_KW,
+  TT_ELSE_KW,     TT_ENUM_KW,     TT_EXTERN_KW,    TT_FLOAT_KW,
+  TT_FOR_KW,      TT_GOTO_KW,     TT_IF_KW,        TT_INLINE_KW,
+  TT_INT_KW,      TT_LONG_KW,     TT_REGISTER_KW,  TT_RESTRICT_KW,
+  TT_RETURN_KW,   TT_SHORT_KW,    TT_SIGNED_KW,    TT_SIMD_KW,
+  TT_STATIC_KW,   TT_STRUCT_KW,   TT_SWITCH_KW,    TT_TYPEDEF_KW,
+  TT_UNION_KW,    TT_UNSIGNED_KW, TT_VOID_KW,      TT_VOLATILE_KW,
+  TT_WHILE_KW,
   TT_TYPE_NAME,   TT_MACRO_NAME,  TT_ENUM_NAME,    TT_INTR_NAME,   
   TT_EOF = -1
 } tt_t;
@@ -50,6 +51,8 @@ extern pws_t *newpws(const char *infile);
 extern void closepws(pws_t *pw);
 /* access to pws public fields */
 extern int pwsid(pws_t *pw);
+/* compact location of pos in pw (0 if pos < 0) */
+extern srcloc_t pwsloc(pws_t *pw, int pos);
 extern sym_t pwscurmod(pws_t *pw);
 
 /* buffers of grammar nodes */
@@ -128,8 +131,7 @@ typedef enum nt {
 
 typedef struct node {
   nt_t nt;        /* node type */
-  int pwsid;      /* id of origin pws */
-  int startpos;   /* start position in origin pws */
+  srcloc_t loc;   /* start location in origin pws */
   sym_t name;     /* IDENTIFIER/TYPE/VARDECL/FUNDEF/INTRCALL */
   buf_t data;     /* LITERAL(cbuf)/ACODE(icbuf) */
   numval_t val;   /* LITERAL(numeric); type defined by ts */
@@ -145,7 +147,7 @@ extern node_t *ndinit(node_t* pn);
 extern node_t *ndicpy(node_t* mem, const node_t* pn);
 extern void ndfini(node_t* pn);
 extern node_t *ndcpy(node_t* pn, const node_t* pr);
-extern node_t *ndset(node_t *dst, nt_t nt, int pwsid, int startpos);
+extern node_t *ndset(node_t *dst, nt_t nt, srcloc_t loc);
 extern node_t *ndsettype(node_t *dst, ts_t ts);
 extern node_t *ndsetilit(node_t *dst, ts_t ts, long long i);
 extern node_t *ndsetulit(node_t *dst, ts_t ts, unsigned long long u);
@@ -179,7 +181,7 @@ extern void init_nodepool(void);
 extern void fini_nodepool(void);
 extern void clear_nodepool(void);
 extern node_t *npalloc(void);
-extern node_t *npnew(nt_t nt, int pwsid, int startpos);
+extern node_t *npnew(nt_t nt, srcloc_t loc);
 extern node_t *npnewcode(const node_t *psn);
 extern node_t *npdup(const node_t *pr);
 
@@ -208,7 +210,7 @@ extern node_t *wrap_subscript(node_t *pn, node_t *psn);
 /* wrap expr node into NT_POSTFIX type node */
 extern node_t *wrap_postfix_operator(node_t *pn, tt_t op, sym_t id);
 /* wrap expr node into NT_PREFIX type node */
-extern node_t *wrap_unary_operator(node_t *pn, int startpos, tt_t op);
+extern node_t *wrap_unary_operator(node_t *pn, srcloc_t loc, tt_t op);
 /* wrap type node into NT_CAST type node */
 extern node_t *wrap_cast_expr(node_t *pcn, node_t *pn);
 /* wrap expr node into NT_CAST type node */
@@ -0,0 +1,220 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define REQUIRE(x) do { ++testno; if (!(x)) fail(testno, buffer); } while(0)
+
+
+static int testno = 0;
+static int failcnt = 0;
+void fail(int tno, const char *buf)
+{
+  printf("  test %d failed: buffer is [%s]\n", testno, buf);
+  ++failcnt;
+}
+
+void start(const char *test)
+{
+  printf("\n** test set %s **\n", test);
+  fflush(stdout);
+  testno = 0;
+}
+
+/* random finite double with uniformly distributed bits */
+double random_double(void)
+{
+  union { uint64_t U; double F; } conv;
+  do {
+    conv.U = ((uint64_t)rand() << 33) ^ ((uint64_t)rand() << 11) ^ (uint64_t)rand();
+  } while (isnan(conv.F) || isinf(conv.F));
+  return conv.F;
+}
+
+bool same_double(double x, double y)
+{
+  return memcmp(&x, &y, sizeof(double)) == 0;
+}
+
+
+/* conversion tests */
+
+void test_printf_exact(void) {
+  start("printf exact digits");
+  char buffer[1100];
+
+  sprintf(buffer, "%.17g", 0.1);
+  REQUIRE(!strcmp(buffer, "0.10000000000000001"));
+
+  sprintf(buffer, "%.20f", 0.1);
+  REQUIRE(!strcmp(buffer, "0.10000000000000000555"));
+
+  sprintf(buffer, "%.0f", 1e22);
+  REQUIRE(!strcmp(buffer, "10000000000000000000000"));
+
+  sprintf(buffer, "%.0f", 1e23);
+  REQUIRE(!strcmp(buffer, "99999999999999991611392"));
+
+  sprintf(buffer, "%e", ldexp(1.0, -1074));
+  REQUIRE(!strcmp(buffer, "4.940656e-324"));
+
+  sprintf(buffer, "%.16e", 1.7976931348623157e308);
+  REQUIRE(!strcmp(buffer, "1.7976931348623157e+308"));
+
+  sprintf(buffer, "%.3e", 2.5);
+  REQUIRE(!strcmp(buffer, "2.500e+00"));
+
+  sprintf(buffer, "%.0e", 2.5);
+  REQUIRE(!strcmp(buffer, "2e+00"));
+
+  sprintf(buffer, "%.1f", 0.25);
+  REQUIRE(!strcmp(buffer, "0.2"));
+
+  sprintf(buffer, "%.1f", 0.35);
+  REQUIRE(!strcmp(buffer, "0.3"));
+
+  sprintf(buffer, "%.2f", 9.995);
+  REQUIRE(!strcmp(buffer, "9.99"));
+
+  sprintf(buffer, "%.2f", 99.999);
+  REQUIRE(!strcmp(buffer, "100.00"));
+
+  sprintf(buffer, "%f", -0.0);
+  REQUIRE(!strcmp(buffer, "-0.000000"));
+
+  sprintf(buffer, "%.1074f", ldexp(1.0, -1074));
+  REQUIRE(strlen(buffer) == 1076 && !strncmp(&buffer[325], "49406564584124654", 17));
+}
+
+void test_shortest(void) {
+  start("shortest");
+  char buffer[100];
+
+  dtostr(buffer, sizeof(buffer), 0.1);
+  REQUIRE(!strcmp(buffer, "0.1"));
+
+  dtostr(buffer, sizeof(buffer), 1e23);
+  REQUIRE(!strcmp(buffer, "1e+23"));
+
+  dtostr(buffer, sizeof(buffer), ldexp(1.0, -1074));
+  REQUIRE(!strcmp(buffer, "5e-324"));
+
+  dtostr(buffer, sizeof(buffer), 1.7976931348623157e308);
+  REQUIRE(!strcmp(buffer, "1.7976931348623157e+308"));
+
+  dtostr(buffer, sizeof(buffer), 100.0);
+  REQUIRE(!strcmp(buffer, "100"));
+
+  dtostr(buffer, sizeof(buffer), -123456.789);
+  REQUIRE(!strcmp(buffer, "-123456.789"));
+
+  dtostr(buffer, sizeof(buffer), 0.0001);
+  REQUIRE(!strcmp(buffer, "0.0001"));
+
+  dtostr(buffer, sizeof(buffer), 0.00001);
+  REQUIRE(!strcmp(buffer, "1e-05"));
+
+  dtostr(buffer, sizeof(buffer), -0.0);
+  REQUIRE(!strcmp(buffer, "-0"));
+
+  dtostr(buffer, sizeof(buffer), 2.0/3.0);
+  REQUIRE(!strcmp(buffer, "0.6666666666666666"));
+
+  REQUIRE(dtostr(buffer, 4U, 1.5e300) == 8 && !strcmp(buffer, "1.5"));
+}
+
+void test_strtod(void) {
+  start("strtod");
+  char buffer[1000]; char *end;
+  union { uint64_t U; double F; } conv;
+
+  strcpy(buffer, "2.2250738585072011e-308");
+  conv.F = strtod(buffer, &end);
+  REQUIRE(conv.U == 0x000FFFFFFFFFFFFFULL && *end == 0);
+
+  strcpy(buffer, "9007199254740993");
+  REQUIRE(strtod(buffer, NULL) == 9007199254740992.0);
+
+  strcpy(buffer, "9007199254740993.0000000000000000000001");
+  REQUIRE(strtod(buffer, NULL) == 9007199254740994.0);
+
+  strcpy(buffer, "2.4703282292062327e-324");
+  REQUIRE(strtod(buffer, NULL) == 0.0);
+
+  strcpy(buffer, "2.4703282292062328e-324");
+  REQUIRE(strtod(buffer, NULL) == ldexp(1.0, -1074));
+
+  strcpy(buffer, "1.7976931348623158e308");
+  REQUIRE(strtod(buffer, NULL) == 1.7976931348623157e308);
+
+  strcpy(buffer, "1.7976931348623159e308");
+  REQUIRE(isinf(strtod(buffer, NULL)));
+
+  strcpy(buffer, "0.1e-400");
+  REQUIRE(strtod(buffer, NULL) == 0.0);
+
+  strcpy(buffer, "12.5e");
+  REQUIRE(strtod(buffer, &end) == 12.5 && !strcmp(end, "e"));
+
+  /* exact halfway between 1 and its successor, then just above it */
+  sprintf(buffer, "1.%s", "00000000000000011102230246251565404236316680908203125");
+  REQUIRE(strtod(buffer, NULL) == 1.0);
+  strcat(buffer, "000000000000000000000000000000000000000000000000000001");
+  REQUIRE(strtod(buffer, NULL) == 1.0000000000000002);
+}
+
+void test_roundtrip(void) {
+  start("roundtrip");
+  char buffer[100]; int i, bad = 0; double x, y;
+  srand(42);
+
+  for (i = 0; i < 20000; ++i) {
+    x = random_double();
+    sprintf(buffer, "%.17g", x);
+    if (!same_double(strtod(buffer, NULL), x)) { if (bad++ == 0) REQUIRE(false); }
+    dtostr(buffer, sizeof(buffer), x);
+    if (!same_double(strtod(buffer, NULL), x)) { if (bad++ == 0) REQUIRE(false); }
+    sscanf(buffer, "%lf", &y);
+    if (!same_double(y, x)) { if (bad++ == 0) REQUIRE(false); }
+  }
+  REQUIRE(bad == 0);
+}
+
+/* benchmarks (not a test, timings are informational) */
+
+void bench(void) {
+  char buffer[100]; int i, n = 100000; double x, sum = 0.0;
+  double *xs = malloc(n * sizeof(double)); clock_t t0, t1, t2, t3;
+  srand(7);
+  for (i = 0; i < n; ++i) xs[i] = random_double();
+  t0 = clock();
+  for (i = 0; i < n; ++i) sprintf(buffer, "%.17g", xs[i]);
+  t1 = clock();
+  for (i = 0; i < n; ++i) dtostr(buffer, sizeof(buffer), xs[i]);
+  t2 = clock();
+  for (i = 0; i < n; ++i) {
+    sprintf(buffer, "%.17g", xs[i]);
+    x = strtod(buffer, NULL); sum += x;
+  }
+  t3 = clock();
+  printf("\n** benchmarks **\n");
+  printf("  %%.17g:         %d ns/op\n", (int)((t1 - t0) / n));
+  printf("  dtostr:        %d ns/op\n", (int)((t2 - t1) / n));
+  printf("  %%.17g+strtod:  %d ns/op\n", (int)((t3 - t2) / n));
+  free(xs);
+}
+
+
+int main()
+{
+  test_printf_exact();
+  test_shortest();
+  test_strtod();
+  test_roundtrip();
+  bench();
+  printf("\nFAILURES: %d\n", failcnt);
+  return failcnt;
+}
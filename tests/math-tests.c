@@ -3738,6 +3738,48 @@ void test_math_yn(void) {
 }
 */
 
+void test_math_float_variants(void) {
+  start("tests for float variants and builtin calls");
+  const char *buffer = "";
+  double (*pf)(double) = &sqrt; double (*pf2)(double, double) = &fmin;
+
+  buffer = "sqrtf (2.25f) == 1.5f";
+  REQUIRE(FEQ(sqrtf(2.25f), 1.5f));
+
+  buffer = "fabsf (-3.5f) == 3.5f";
+  REQUIRE(FEQ(fabsf(-3.5f), 3.5f));
+
+  buffer = "floorf (-1.5f) == -2.0f";
+  REQUIRE(FEQ(floorf(-1.5f), -2.0f));
+
+  buffer = "ceilf (-1.5f) == -1.0f";
+  REQUIRE(FEQ(ceilf(-1.5f), -1.0f));
+
+  buffer = "truncf (-1.5f) == -1.0f";
+  REQUIRE(FEQ(truncf(-1.5f), -1.0f));
+
+  buffer = "nearbyintf (2.5f) == 2.0f";
+  REQUIRE(FEQ(nearbyintf(2.5f), 2.0f));
+
+  buffer = "copysignf (2.0f, -0.0f) == -2.0f";
+  REQUIRE(FEQ(copysignf(2.0f, -0.0f), -2.0f));
+
+  buffer = "fminf (NaN, 1.0f) == 1.0f";
+  REQUIRE(FEQ(fminf(NAN, 1.0f), 1.0f));
+
+  buffer = "fmaxf (1.0f, NaN) == 1.0f";
+  REQUIRE(FEQ(fmaxf(1.0f, NAN), 1.0f));
+
+  buffer = "fmaxf (-1.0f, 2.0f) == 2.0f";
+  REQUIRE(FEQ(fmaxf(-1.0f, 2.0f), 2.0f));
+
+  buffer = "(*&sqrt) (16) == 4";
+  REQUIRE(FEQ((*pf)(16), 4));
+
+  buffer = "(*&fmin) (NaN, 3) == 3";
+  REQUIRE(FEQ((*pf2)(NaN, 3), 3));
+}
+
 int main()
 {
   test_math_acos();
@@ -3796,6 +3838,7 @@ int main()
   test_math_tanh();
   //test_math_tgamma();
   test_math_trunc();
+  test_math_float_variants();
   //test_math_y0();
   //test_math_y1();
   //test_math_yn();
@@ -0,0 +1,219 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <wasm_simd128.h>
+
+#define REQUIRE(x) do { ++testno; if (!(x)) fail(testno, buffer); } while(0)
+
+
+static int testno = 0;
+static int failcnt = 0;
+void fail(int tno, const char *buf)
+{
+  printf("  test %d failed: %s\n", testno, buf);
+  ++failcnt;
+}
+
+void start(const char *test)
+{
+  printf("\n** test set %s **\n", test);
+  fflush(stdout);
+  testno = 0;
+}
+
+/* random double in [lo, hi) */
+double random_range(double lo, double hi)
+{
+  return lo + (hi - lo) * ((double)rand() / ((double)RAND_MAX + 1.0));
+}
+
+/* distance in ulps; same-signed finite values only, nans/infs must match exactly */
+int64_t ulps_double(double x, double y)
+{
+  union { int64_t I; double F; } cx, cy; int64_t d;
+  if (isnan(x) || isnan(y)) return (isnan(x) && isnan(y)) ? 0 : INT64_MAX;
+  cx.F = x; cy.F = y;
+  if ((cx.I < 0) != (cy.I < 0)) return (x == y) ? 0 : INT64_MAX;
+  d = cx.I - cy.I;
+  return d < 0 ? -d : d;
+}
+
+int32_t ulps_float(float x, float y)
+{
+  union { int32_t I; float F; } cx, cy; int32_t d;
+  if (isnan(x) || isnan(y)) return (isnan(x) && isnan(y)) ? 0 : INT32_MAX;
+  cx.F = x; cy.F = y;
+  if ((cx.I < 0) != (cy.I < 0)) return (x == y) ? 0 : INT32_MAX;
+  d = cx.I - cy.I;
+  return d < 0 ? -d : d;
+}
+
+/* vector vs scalar on random lanes; returns max ulp distance */
+int64_t check_f64x2(v128_t (*vf)(v128_t), double (*sf)(double), double lo, double hi)
+{
+  int i; int64_t d, maxd = 0; double a, b; v128_t r;
+  for (i = 0; i < 20000; ++i) {
+    a = random_range(lo, hi); b = random_range(lo, hi);
+    r = (*vf)(wasm_f64x2_make(a, b));
+    d = ulps_double(wasm_f64x2_extract_lane(r, 0), (*sf)(a)); if (d > maxd) maxd = d;
+    d = ulps_double(wasm_f64x2_extract_lane(r, 1), (*sf)(b)); if (d > maxd) maxd = d;
+  }
+  return maxd;
+}
+
+int32_t check_f32x4(v128_t (*vf)(v128_t), float (*sf)(float), double lo, double hi)
+{
+  int i; int32_t d, maxd = 0; float a, b, c, e; v128_t r;
+  for (i = 0; i < 20000; ++i) {
+    a = (float)random_range(lo, hi); b = (float)random_range(lo, hi);
+    c = (float)random_range(lo, hi); e = (float)random_range(lo, hi);
+    r = (*vf)(wasm_f32x4_make(a, b, c, e));
+    d = ulps_float(wasm_f32x4_extract_lane(r, 0), (*sf)(a)); if (d > maxd) maxd = d;
+    d = ulps_float(wasm_f32x4_extract_lane(r, 1), (*sf)(b)); if (d > maxd) maxd = d;
+    d = ulps_float(wasm_f32x4_extract_lane(r, 2), (*sf)(c)); if (d > maxd) maxd = d;
+    d = ulps_float(wasm_f32x4_extract_lane(r, 3), (*sf)(e)); if (d > maxd) maxd = d;
+  }
+  return maxd;
+}
+
+
+/* accuracy tests */
+
+void test_f64x2(void) {
+  start("f64x2 vs scalar");
+  char buffer[100]; int64_t d;
+  srand(42);
+
+  d = check_f64x2(&wasm_f64x2_exp, &exp, -700.0, 700.0);
+  sprintf(buffer, "exp: %d ulps", (int)d); REQUIRE(d <= 1);
+  d = check_f64x2(&wasm_f64x2_exp, &exp, -1.0, 1.0);
+  sprintf(buffer, "exp small: %d ulps", (int)d); REQUIRE(d <= 1);
+  d = check_f64x2(&wasm_f64x2_log, &log, 0.0, 2.0);
+  sprintf(buffer, "log: %d ulps", (int)d); REQUIRE(d <= 1);
+  d = check_f64x2(&wasm_f64x2_log, &log, 1e-300, 1e300);
+  sprintf(buffer, "log wide: %d ulps", (int)d); REQUIRE(d <= 1);
+  d = check_f64x2(&wasm_f64x2_sin, &sin, -10.0, 10.0);
+  sprintf(buffer, "sin: %d ulps", (int)d); REQUIRE(d <= 1);
+  d = check_f64x2(&wasm_f64x2_cos, &cos, -10.0, 10.0);
+  sprintf(buffer, "cos: %d ulps", (int)d); REQUIRE(d <= 1);
+  d = check_f64x2(&wasm_f64x2_sin, &sin, -1e5, 1e5);
+  sprintf(buffer, "sin large: %d ulps", (int)d); REQUIRE(d <= 2);
+  d = check_f64x2(&wasm_f64x2_cos, &cos, -1e5, 1e5);
+  sprintf(buffer, "cos large: %d ulps", (int)d); REQUIRE(d <= 2);
+}
+
+void test_f32x4(void) {
+  start("f32x4 vs scalar");
+  char buffer[100]; int32_t d;
+  srand(43);
+
+  d = check_f32x4(&wasm_f32x4_exp, &expf, -87.0, 88.0);
+  sprintf(buffer, "exp: %d ulps", (int)d); REQUIRE(d <= 2);
+  d = check_f32x4(&wasm_f32x4_log, &logf, 0.0, 2.0);
+  sprintf(buffer, "log: %d ulps", (int)d); REQUIRE(d <= 2);
+  d = check_f32x4(&wasm_f32x4_log, &logf, 1e-30, 1e30);
+  sprintf(buffer, "log wide: %d ulps", (int)d); REQUIRE(d <= 2);
+  d = check_f32x4(&wasm_f32x4_sin, &sinf, -10.0, 10.0);
+  sprintf(buffer, "sin: %d ulps", (int)d); REQUIRE(d <= 2);
+  d = check_f32x4(&wasm_f32x4_cos, &cosf, -10.0, 10.0);
+  sprintf(buffer, "cos: %d ulps", (int)d); REQUIRE(d <= 2);
+}
+
+/* vectors with out-of-range lanes go to scalar functions */
+void test_special(void) {
+  start("special lanes");
+  char buffer[100]; v128_t r; double x;
+  strcpy(buffer, "");
+
+  r = wasm_f64x2_exp(wasm_f64x2_make(1000.0, 0.0));
+  REQUIRE(isinf(wasm_f64x2_extract_lane(r, 0)) && wasm_f64x2_extract_lane(r, 1) == 1.0);
+  r = wasm_f64x2_exp(wasm_f64x2_make(-1000.0, NAN));
+  REQUIRE(wasm_f64x2_extract_lane(r, 0) == 0.0 && isnan(wasm_f64x2_extract_lane(r, 1)));
+  r = wasm_f64x2_log(wasm_f64x2_make(0.0, -1.0));
+  REQUIRE(wasm_f64x2_extract_lane(r, 0) == -HUGE_VAL && isnan(wasm_f64x2_extract_lane(r, 1)));
+  x = 1e-300 * 1e-20; /* subnormal */
+  r = wasm_f64x2_log(wasm_f64x2_make(1.0, x));
+  REQUIRE(wasm_f64x2_extract_lane(r, 0) == 0.0 && wasm_f64x2_extract_lane(r, 1) == log(x));
+  r = wasm_f64x2_sin(wasm_f64x2_make(1e22, INFINITY));
+  REQUIRE(wasm_f64x2_extract_lane(r, 0) == sin(1e22) && isnan(wasm_f64x2_extract_lane(r, 1)));
+  r = wasm_f64x2_cos(wasm_f64x2_make(0.0, -0.0));
+  REQUIRE(wasm_f64x2_extract_lane(r, 0) == 1.0 && wasm_f64x2_extract_lane(r, 1) == 1.0);
+  r = wasm_f64x2_sin(wasm_f64x2_make(-0.0, 0.0));
+  REQUIRE(signbit(wasm_f64x2_extract_lane(r, 0)) && !signbit(wasm_f64x2_extract_lane(r, 1)));
+
+  r = wasm_f32x4_exp(wasm_f32x4_make(100.0f, -200.0f, 0.0f, 1.0f));
+  REQUIRE(isinf(wasm_f32x4_extract_lane(r, 0)) && wasm_f32x4_extract_lane(r, 1) == 0.0f);
+  REQUIRE(wasm_f32x4_extract_lane(r, 2) == 1.0f && wasm_f32x4_extract_lane(r, 3) == expf(1.0f));
+  r = wasm_f32x4_log(wasm_f32x4_make(0.0f, -1.0f, 1.0f, INFINITY));
+  REQUIRE(wasm_f32x4_extract_lane(r, 0) == -HUGE_VALF && isnan(wasm_f32x4_extract_lane(r, 1)));
+  REQUIRE(wasm_f32x4_extract_lane(r, 2) == 0.0f && isinf(wasm_f32x4_extract_lane(r, 3)));
+  r = wasm_f32x4_sin(wasm_f32x4_make(1e10f, NAN, -0.0f, 0.0f));
+  REQUIRE(wasm_f32x4_extract_lane(r, 0) == sinf(1e10f) && isnan(wasm_f32x4_extract_lane(r, 1)));
+  REQUIRE(signbit(wasm_f32x4_extract_lane(r, 2)) && wasm_f32x4_extract_lane(r, 3) == 0.0f);
+  r = wasm_f32x4_cos(wasm_f32x4_make(0.0f, 1e10f, INFINITY, -0.0f));
+  REQUIRE(wasm_f32x4_extract_lane(r, 0) == 1.0f && wasm_f32x4_extract_lane(r, 1) == cosf(1e10f));
+  REQUIRE(isnan(wasm_f32x4_extract_lane(r, 2)) && wasm_f32x4_extract_lane(r, 3) == 1.0f);
+}
+
+/* benchmarks (not a test, timings are informational): array-at-a-time
+ * loops over scalar functions vs vector functions */
+
+void bench_f64(const char *name, double (*sf)(double), v128_t (*vf)(v128_t),
+               double *xs, double *ys, int n)
+{
+  int i; clock_t t0, t1, t2;
+  t0 = clock();
+  for (i = 0; i < n; ++i) ys[i] = (*sf)(xs[i]);
+  t1 = clock();
+  for (i = 0; i < n; i += 2) wasm_v128_store(&ys[i], (*vf)(wasm_v128_load(&xs[i])));
+  t2 = clock();
+  printf("  %s:  scalar %d, f64x2 %d ns/elem\n", name, (int)((t1 - t0) / n), (int)((t2 - t1) / n));
+}
+
+void bench_f32(const char *name, float (*sf)(float), v128_t (*vf)(v128_t),
+               float *xs, float *ys, int n)
+{
+  int i; clock_t t0, t1, t2;
+  t0 = clock();
+  for (i = 0; i < n; ++i) ys[i] = (*sf)(xs[i]);
+  t1 = clock();
+  for (i = 0; i < n; i += 4) wasm_v128_store(&ys[i], (*vf)(wasm_v128_load(&xs[i])));
+  t2 = clock();
+  printf("  %s: scalar %d, f32x4 %d ns/elem\n", name, (int)((t1 - t0) / n), (int)((t2 - t1) / n));
+}
+
+void bench(void) {
+  int i, n = 200000;
+  double *xd = malloc(n * sizeof(double)), *yd = malloc(n * sizeof(double));
+  float *xf = malloc(n * sizeof(float)), *yf = malloc(n * sizeof(float));
+  srand(7);
+  printf("\n** benchmarks **\n");
+  for (i = 0; i < n; ++i) xd[i] = random_range(-50.0, 50.0);
+  for (i = 0; i < n; ++i) xf[i] = (float)xd[i];
+  bench_f64("exp", &exp, &wasm_f64x2_exp, xd, yd, n);
+  bench_f64("sin", &sin, &wasm_f64x2_sin, xd, yd, n);
+  bench_f64("cos", &cos, &wasm_f64x2_cos, xd, yd, n);
+  bench_f32("expf", &expf, &wasm_f32x4_exp, xf, yf, n);
+  bench_f32("sinf", &sinf, &wasm_f32x4_sin, xf, yf, n);
+  bench_f32("cosf", &cosf, &wasm_f32x4_cos, xf, yf, n);
+  for (i = 0; i < n; ++i) xd[i] = random_range(1e-5, 1e5);
+  for (i = 0; i < n; ++i) xf[i] = (float)xd[i];
+  bench_f64("log", &log, &wasm_f64x2_log, xd, yd, n);
+  bench_f32("logf", &logf, &wasm_f32x4_log, xf, yf, n);
+  free(xd); free(yd); free(xf); free(yf);
+}
+
+
+int main()
+{
+  test_f64x2();
+  test_f32x4();
+  test_special();
+  bench();
+  printf("\nFAILURES: %d\n", failcnt);
+  return failcnt;
+}
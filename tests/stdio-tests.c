@@ -1077,15 +1077,13 @@ void test_float (void) {
   sprintf(buffer, "%.10f", 42.895223);
   REQUIRE(!strcmp(buffer, "42.8952230000"));
 
-  // this testcase checks, that the precision is truncated to 9 digits.
-  // a perfect working float should return the whole number
+  // precision is not limited to 9 digits
   sprintf(buffer, "%.12f", 42.89522312345678);
-  REQUIRE(!strcmp(buffer, "42.895223123000"));
+  REQUIRE(!strcmp(buffer, "42.895223123457"));
 
-  // this testcase checks, that the precision is truncated AND rounded to 9 digits.
-  // a perfect working float should return the whole number
+  // precision is not limited to 9 digits, and the result is correctly rounded
   sprintf(buffer, "%.12f", 42.89522387654321);
-  REQUIRE(!strcmp(buffer, "42.895223877000"));
+  REQUIRE(!strcmp(buffer, "42.895223876543"));
 
   sprintf(buffer, "%6.2f", 42.8952);
   REQUIRE(!strcmp(buffer, " 42.90"));
@@ -1159,9 +1157,9 @@ void test_float (void) {
   //sprintf(buffer, "%+.3E", 1.23e+308); // strtod fails on older systems
   //REQUIRE(!strcmp(buffer, "+1.230E+308"));
 
-  // out of range for float: should switch to exp notation if supported, else empty
+  // large values are printed in full
   sprintf(buffer, "%.1f", 1E20);
-  REQUIRE(!strcmp(buffer, "1.0e+20"));
+  REQUIRE(!strcmp(buffer, "100000000000000000000.0"));
 
   /* brute force float
   bool fail = false;
@@ -12,7 +12,31 @@
 #include <assert.h>
 #include <wchar.h>
 #include <ctype.h>
+#include <time.h>
 #include <math.h>
+#ifdef __WCPL__
+#include <sys/stat.h>
+#include <dirent.h>
+#else
+#ifdef _WIN32
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <direct.h>
+#include <io.h>
+#define mkdir(path, mode) _mkdir(path)
+#define environ _environ
+#ifndef S_ISDIR
+#define S_ISDIR(m) (((m) & _S_IFMT) == _S_IFDIR)
+#define S_ISREG(m) (((m) & _S_IFMT) == _S_IFREG)
+#define S_ISCHR(m) (((m) & _S_IFMT) == _S_IFCHR)
+#endif
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+extern char **environ;
+#endif
+#endif
 #include "l.h"
 #include "w.h"
 #include "p.h"
@@ -355,6 +379,9 @@ static void wasm_expr(icbuf_t *pcb)
           case IN_MEMORY_COPY:
             wasm_unsigned(0); wasm_unsigned(0); /* two reserved args */
             break;
+          case IN_ATOMIC_FENCE:
+            wasm_byte(0); /* reserved ordering byte */
+            break;
           default:;
         }
         break;
@@ -473,7 +500,7 @@ static void wasm_imports(entbuf_t *pfdb, entbuf_t *ptdb, entbuf_t *pmdb, entbuf_
     wasm_byte(pe->vt); /* RT_FUNCREF/RT_EXTERNREF */        
     wasm_byte(pe->lt);
     wasm_unsigned(pe->n);
-    if (pe->lt == LT_MINMAX) wasm_unsigned(pe->m);
+    if (pe->lt != LT_MIN) wasm_unsigned(pe->m);
     wasm_section_bumpc(); 
   }    
   /* imported mems */
@@ -487,7 +514,7 @@ static void wasm_imports(entbuf_t *pfdb, entbuf_t *ptdb, entbuf_t *pmdb, entbuf_
     wasm_byte(EK_MEM);
     wasm_byte(pe->lt);
     wasm_unsigned(pe->n);
-    if (pe->lt == LT_MINMAX) wasm_unsigned(pe->m);
+    if (pe->lt != LT_MIN) wasm_unsigned(pe->m);
     wasm_section_bumpc(); 
   }    
   /* imported globals */
@@ -533,7 +560,7 @@ static void wasm_tables(entbuf_t *ptdb)
     wasm_byte(pe->vt);
     wasm_byte(pe->lt);
     wasm_unsigned(pe->n);
-    if (pe->lt == LT_MINMAX) wasm_unsigned(pe->m);
+    if (pe->lt != LT_MIN) wasm_unsigned(pe->m);
     wasm_section_bumpc();
   }
   wasm_section_end();
@@ -550,7 +577,7 @@ static void wasm_mems(entbuf_t *pmdb)
     if (pe->imported) continue;
     wasm_byte(pe->lt);
     wasm_unsigned(pe->n);
-    if (pe->lt == LT_MINMAX) wasm_unsigned(pe->m);
+    if (pe->lt != LT_MIN) wasm_unsigned(pe->m);
     wasm_section_bumpc();
   }
   wasm_section_end();
@@ -685,18 +712,21 @@ static void wasm_elems(esegbuf_t *pesb)
   wasm_section_end();
 }
 
-#if 0
 static void wasm_datacount(dsegbuf_t *pdsb)
 {
   size_t i;
   if (!pdsb) return;
+  /* only required by memory.init/data.drop of passive segments */
+  for (i = 0; i < dsegblen(pdsb); ++i) {
+    if (dsegbref(pdsb, i)->dsm == DS_PASSIVE) break;
+  }
+  if (i == dsegblen(pdsb)) return;
   wasm_section_start(SI_DATACOUNT);
   for (i = 0; i < dsegblen(pdsb); ++i) {
     wasm_section_bumpc();
   }  
   wasm_section_end();
 }
-#endif
 
 static void wasm_codes(entbuf_t *pfdb)
 {
@@ -798,7 +828,7 @@ void write_wasm_module(wasm_module_t* pm, FILE *pf)
   wasm_exports(&pm->funcdefs, &pm->tabdefs, &pm->memdefs, &pm->globdefs);
   wasm_start(&pm->funcdefs);
   wasm_elems(&pm->elemdefs);
-  //wasm_datacount(&pm->datadefs);
+  wasm_datacount(&pm->datadefs);
   wasm_codes(&pm->funcdefs);
   wasm_datas(&pm->datadefs);
   g_wasmout = NULL;
@@ -1330,6 +1360,74 @@ const char *instr_name(instr_t in)
     case IN_I32X4_TRUNC_SAT_F64X2_U_ZERO: s = "i32x4.trunc_sat_f64x2_u_zero"; break;
     case IN_F64X2_CONVERT_LOW_I32X4_S: s = "f64x2.convert_low_i32x4_s"; break;
     case IN_F64X2_CONVERT_LOW_I32X4_U: s = "f64x2.convert_low_i32x4_u"; break;
+    /* threads multibyte, not in core-1 */
+    case IN_MEMORY_ATOMIC_NOTIFY: s = "memory.atomic.notify"; break;
+    case IN_MEMORY_ATOMIC_WAIT32: s = "memory.atomic.wait32"; break;
+    case IN_MEMORY_ATOMIC_WAIT64: s = "memory.atomic.wait64"; break;
+    case IN_ATOMIC_FENCE: s = "atomic.fence"; break;
+    case IN_I32_ATOMIC_LOAD: s = "i32.atomic.load"; break;
+    case IN_I64_ATOMIC_LOAD: s = "i64.atomic.load"; break;
+    case IN_I32_ATOMIC_LOAD8_U: s = "i32.atomic.load8_u"; break;
+    case IN_I32_ATOMIC_LOAD16_U: s = "i32.atomic.load16_u"; break;
+    case IN_I64_ATOMIC_LOAD8_U: s = "i64.atomic.load8_u"; break;
+    case IN_I64_ATOMIC_LOAD16_U: s = "i64.atomic.load16_u"; break;
+    case IN_I64_ATOMIC_LOAD32_U: s = "i64.atomic.load32_u"; break;
+    case IN_I32_ATOMIC_STORE: s = "i32.atomic.store"; break;
+    case IN_I64_ATOMIC_STORE: s = "i64.atomic.store"; break;
+    case IN_I32_ATOMIC_STORE8: s = "i32.atomic.store8"; break;
+    case IN_I32_ATOMIC_STORE16: s = "i32.atomic.store16"; break;
+    case IN_I64_ATOMIC_STORE8: s = "i64.atomic.store8"; break;
+    case IN_I64_ATOMIC_STORE16: s = "i64.atomic.store16"; break;
+    case IN_I64_ATOMIC_STORE32: s = "i64.atomic.store32"; break;
+    case IN_I32_ATOMIC_RMW_ADD: s = "i32.atomic.rmw.add"; break;
+    case IN_I64_ATOMIC_RMW_ADD: s = "i64.atomic.rmw.add"; break;
+    case IN_I32_ATOMIC_RMW8_ADD_U: s = "i32.atomic.rmw8.add_u"; break;
+    case IN_I32_ATOMIC_RMW16_ADD_U: s = "i32.atomic.rmw16.add_u"; break;
+    case IN_I64_ATOMIC_RMW8_ADD_U: s = "i64.atomic.rmw8.add_u"; break;
+    case IN_I64_ATOMIC_RMW16_ADD_U: s = "i64.atomic.rmw16.add_u"; break;
+    case IN_I64_ATOMIC_RMW32_ADD_U: s = "i64.atomic.rmw32.add_u"; break;
+    case IN_I32_ATOMIC_RMW_SUB: s = "i32.atomic.rmw.sub"; break;
+    case IN_I64_ATOMIC_RMW_SUB: s = "i64.atomic.rmw.sub"; break;
+    case IN_I32_ATOMIC_RMW8_SUB_U: s = "i32.atomic.rmw8.sub_u"; break;
+    case IN_I32_ATOMIC_RMW16_SUB_U: s = "i32.atomic.rmw16.sub_u"; break;
+    case IN_I64_ATOMIC_RMW8_SUB_U: s = "i64.atomic.rmw8.sub_u"; break;
+    case IN_I64_ATOMIC_RMW16_SUB_U: s = "i64.atomic.rmw16.sub_u"; break;
+    case IN_I64_ATOMIC_RMW32_SUB_U: s = "i64.atomic.rmw32.sub_u"; break;
+    case IN_I32_ATOMIC_RMW_AND: s = "i32.atomic.rmw.and"; break;
+    case IN_I64_ATOMIC_RMW_AND: s = "i64.atomic.rmw.and"; break;
+    case IN_I32_ATOMIC_RMW8_AND_U: s = "i32.atomic.rmw8.and_u"; break;
+    case IN_I32_ATOMIC_RMW16_AND_U: s = "i32.atomic.rmw16.and_u"; break;
+    case IN_I64_ATOMIC_RMW8_AND_U: s = "i64.atomic.rmw8.and_u"; break;
+    case IN_I64_ATOMIC_RMW16_AND_U: s = "i64.atomic.rmw16.and_u"; break;
+    case IN_I64_ATOMIC_RMW32_AND_U: s = "i64.atomic.rmw32.and_u"; break;
+    case IN_I32_ATOMIC_RMW_OR: s = "i32.atomic.rmw.or"; break;
+    case IN_I64_ATOMIC_RMW_OR: s = "i64.atomic.rmw.or"; break;
+    case IN_I32_ATOMIC_RMW8_OR_U: s = "i32.atomic.rmw8.or_u"; break;
+    case IN_I32_ATOMIC_RMW16_OR_U: s = "i32.atomic.rmw16.or_u"; break;
+    case IN_I64_ATOMIC_RMW8_OR_U: s = "i64.atomic.rmw8.or_u"; break;
+    case IN_I64_ATOMIC_RMW16_OR_U: s = "i64.atomic.rmw16.or_u"; break;
+    case IN_I64_ATOMIC_RMW32_OR_U: s = "i64.atomic.rmw32.or_u"; break;
+    case IN_I32_ATOMIC_RMW_XOR: s = "i32.atomic.rmw.xor"; break;
+    case IN_I64_ATOMIC_RMW_XOR: s = "i64.atomic.rmw.xor"; break;
+    case IN_I32_ATOMIC_RMW8_XOR_U: s = "i32.atomic.rmw8.xor_u"; break;
+    case IN_I32_ATOMIC_RMW16_XOR_U: s = "i32.atomic.rmw16.xor_u"; break;
+    case IN_I64_ATOMIC_RMW8_XOR_U: s = "i64.atomic.rmw8.xor_u"; break;
+    case IN_I64_ATOMIC_RMW16_XOR_U: s = "i64.atomic.rmw16.xor_u"; break;
+    case IN_I64_ATOMIC_RMW32_XOR_U: s = "i64.atomic.rmw32.xor_u"; break;
+    case IN_I32_ATOMIC_RMW_XCHG: s = "i32.atomic.rmw.xchg"; break;
+    case IN_I64_ATOMIC_RMW_XCHG: s = "i64.atomic.rmw.xchg"; break;
+    case IN_I32_ATOMIC_RMW8_XCHG_U: s = "i32.atomic.rmw8.xchg_u"; break;
+    case IN_I32_ATOMIC_RMW16_XCHG_U: s = "i32.atomic.rmw16.xchg_u"; break;
+    case IN_I64_ATOMIC_RMW8_XCHG_U: s = "i64.atomic.rmw8.xchg_u"; break;
+    case IN_I64_ATOMIC_RMW16_XCHG_U: s = "i64.atomic.rmw16.xchg_u"; break;
+    case IN_I64_ATOMIC_RMW32_XCHG_U: s = "i64.atomic.rmw32.xchg_u"; break;
+    case IN_I32_ATOMIC_RMW_CMPXCHG: s = "i32.atomic.rmw.cmpxchg"; break;
+    case IN_I64_ATOMIC_RMW_CMPXCHG: s = "i64.atomic.rmw.cmpxchg"; break;
+    case IN_I32_ATOMIC_RMW8_CMPXCHG_U: s = "i32.atomic.rmw8.cmpxchg_u"; break;
+    case IN_I32_ATOMIC_RMW16_CMPXCHG_U: s = "i32.atomic.rmw16.cmpxchg_u"; break;
+    case IN_I64_ATOMIC_RMW8_CMPXCHG_U: s = "i64.atomic.rmw8.cmpxchg_u"; break;
+    case IN_I64_ATOMIC_RMW16_CMPXCHG_U: s = "i64.atomic.rmw16.cmpxchg_u"; break;
+    case IN_I64_ATOMIC_RMW32_CMPXCHG_U: s = "i64.atomic.rmw32.cmpxchg_u"; break;
     /* internal use */
     case IN_REF_DATA: s = "ref.data"; break;
     case IN_DATA_PUT_REF: s = "data.put_ref"; break;
@@ -1355,19 +1453,18 @@ const char *valtype_name(valtype_t vt)
   return s;
 }
 
-static buf_t g_nimap;
+static phtab_t g_nimap;
 
 static void nimap_intern(const char *name, instr_t in)
 {
-  int *pi = bufnewbk(&g_nimap); 
-  pi[0] = intern(name); pi[1] = (int)in;
+  phtadd(&g_nimap, name, (int)in);
 }
 
 instr_t name_instr(const char *name)
 { 
-  sym_t sym; int *pi;
-  if (!g_nimap.esz) {
-    size_t i; bufinit(&g_nimap, sizeof(int)*2);
+  int in;
+  if (!g_nimap.ents.esz) {
+    size_t i; phtinit(&g_nimap);
     /* single byte, core-1 */
     for (i = 0; i <= 0xff; ++i) {
       const char *s = g_innames[i];
@@ -1629,14 +1726,80 @@ instr_t name_instr(const char *name)
     nimap_intern("i32x4.trunc_sat_f64x2_u_zero", IN_I32X4_TRUNC_SAT_F64X2_U_ZERO);
     nimap_intern("f64x2.convert_low_i32x4_s", IN_F64X2_CONVERT_LOW_I32X4_S);
     nimap_intern("f64x2.convert_low_i32x4_u", IN_F64X2_CONVERT_LOW_I32X4_U);
+    /* threads multibyte, not in core-1 */
+    nimap_intern("memory.atomic.notify", IN_MEMORY_ATOMIC_NOTIFY);
+    nimap_intern("memory.atomic.wait32", IN_MEMORY_ATOMIC_WAIT32);
+    nimap_intern("memory.atomic.wait64", IN_MEMORY_ATOMIC_WAIT64);
+    nimap_intern("atomic.fence", IN_ATOMIC_FENCE);
+    nimap_intern("i32.atomic.load", IN_I32_ATOMIC_LOAD);
+    nimap_intern("i64.atomic.load", IN_I64_ATOMIC_LOAD);
+    nimap_intern("i32.atomic.load8_u", IN_I32_ATOMIC_LOAD8_U);
+    nimap_intern("i32.atomic.load16_u", IN_I32_ATOMIC_LOAD16_U);
+    nimap_intern("i64.atomic.load8_u", IN_I64_ATOMIC_LOAD8_U);
+    nimap_intern("i64.atomic.load16_u", IN_I64_ATOMIC_LOAD16_U);
+    nimap_intern("i64.atomic.load32_u", IN_I64_ATOMIC_LOAD32_U);
+    nimap_intern("i32.atomic.store", IN_I32_ATOMIC_STORE);
+    nimap_intern("i64.atomic.store", IN_I64_ATOMIC_STORE);
+    nimap_intern("i32.atomic.store8", IN_I32_ATOMIC_STORE8);
+    nimap_intern("i32.atomic.store16", IN_I32_ATOMIC_STORE16);
+    nimap_intern("i64.atomic.store8", IN_I64_ATOMIC_STORE8);
+    nimap_intern("i64.atomic.store16", IN_I64_ATOMIC_STORE16);
+    nimap_intern("i64.atomic.store32", IN_I64_ATOMIC_STORE32);
+    nimap_intern("i32.atomic.rmw.add", IN_I32_ATOMIC_RMW_ADD);
+    nimap_intern("i64.atomic.rmw.add", IN_I64_ATOMIC_RMW_ADD);
+    nimap_intern("i32.atomic.rmw8.add_u", IN_I32_ATOMIC_RMW8_ADD_U);
+    nimap_intern("i32.atomic.rmw16.add_u", IN_I32_ATOMIC_RMW16_ADD_U);
+    nimap_intern("i64.atomic.rmw8.add_u", IN_I64_ATOMIC_RMW8_ADD_U);
+    nimap_intern("i64.atomic.rmw16.add_u", IN_I64_ATOMIC_RMW16_ADD_U);
+    nimap_intern("i64.atomic.rmw32.add_u", IN_I64_ATOMIC_RMW32_ADD_U);
+    nimap_intern("i32.atomic.rmw.sub", IN_I32_ATOMIC_RMW_SUB);
+    nimap_intern("i64.atomic.rmw.sub", IN_I64_ATOMIC_RMW_SUB);
+    nimap_intern("i32.atomic.rmw8.sub_u", IN_I32_ATOMIC_RMW8_SUB_U);
+    nimap_intern("i32.atomic.rmw16.sub_u", IN_I32_ATOMIC_RMW16_SUB_U);
+    nimap_intern("i64.atomic.rmw8.sub_u", IN_I64_ATOMIC_RMW8_SUB_U);
+    nimap_intern("i64.atomic.rmw16.sub_u", IN_I64_ATOMIC_RMW16_SUB_U);
+    nimap_intern("i64.atomic.rmw32.sub_u", IN_I64_ATOMIC_RMW32_SUB_U);
+    nimap_intern("i32.atomic.rmw.and", IN_I32_ATOMIC_RMW_AND);
+    nimap_intern("i64.atomic.rmw.and", IN_I64_ATOMIC_RMW_AND);
+    nimap_intern("i32.atomic.rmw8.and_u", IN_I32_ATOMIC_RMW8_AND_U);
+    nimap_intern("i32.atomic.rmw16.and_u", IN_I32_ATOMIC_RMW16_AND_U);
+    nimap_intern("i64.atomic.rmw8.and_u", IN_I64_ATOMIC_RMW8_AND_U);
+    nimap_intern("i64.atomic.rmw16.and_u", IN_I64_ATOMIC_RMW16_AND_U);
+    nimap_intern("i64.atomic.rmw32.and_u", IN_I64_ATOMIC_RMW32_AND_U);
+    nimap_intern("i32.atomic.rmw.or", IN_I32_ATOMIC_RMW_OR);
+    nimap_intern("i64.atomic.rmw.or", IN_I64_ATOMIC_RMW_OR);
+    nimap_intern("i32.atomic.rmw8.or_u", IN_I32_ATOMIC_RMW8_OR_U);
+    nimap_intern("i32.atomic.rmw16.or_u", IN_I32_ATOMIC_RMW16_OR_U);
+    nimap_intern("i64.atomic.rmw8.or_u", IN_I64_ATOMIC_RMW8_OR_U);
+    nimap_intern("i64.atomic.rmw16.or_u", IN_I64_ATOMIC_RMW16_OR_U);
+    nimap_intern("i64.atomic.rmw32.or_u", IN_I64_ATOMIC_RMW32_OR_U);
+    nimap_intern("i32.atomic.rmw.xor", IN_I32_ATOMIC_RMW_XOR);
+    nimap_intern("i64.atomic.rmw.xor", IN_I64_ATOMIC_RMW_XOR);
+    nimap_intern("i32.atomic.rmw8.xor_u", IN_I32_ATOMIC_RMW8_XOR_U);
+    nimap_intern("i32.atomic.rmw16.xor_u", IN_I32_ATOMIC_RMW16_XOR_U);
+    nimap_intern("i64.atomic.rmw8.xor_u", IN_I64_ATOMIC_RMW8_XOR_U);
+    nimap_intern("i64.atomic.rmw16.xor_u", IN_I64_ATOMIC_RMW16_XOR_U);
+    nimap_intern("i64.atomic.rmw32.xor_u", IN_I64_ATOMIC_RMW32_XOR_U);
+    nimap_intern("i32.atomic.rmw.xchg", IN_I32_ATOMIC_RMW_XCHG);
+    nimap_intern("i64.atomic.rmw.xchg", IN_I64_ATOMIC_RMW_XCHG);
+    nimap_intern("i32.atomic.rmw8.xchg_u", IN_I32_ATOMIC_RMW8_XCHG_U);
+    nimap_intern("i32.atomic.rmw16.xchg_u", IN_I32_ATOMIC_RMW16_XCHG_U);
+    nimap_intern("i64.atomic.rmw8.xchg_u", IN_I64_ATOMIC_RMW8_XCHG_U);
+    nimap_intern("i64.atomic.rmw16.xchg_u", IN_I64_ATOMIC_RMW16_XCHG_U);
+    nimap_intern("i64.atomic.rmw32.xchg_u", IN_I64_ATOMIC_RMW32_XCHG_U);
+    nimap_intern("i32.atomic.rmw.cmpxchg", IN_I32_ATOMIC_RMW_CMPXCHG);
+    nimap_intern("i64.atomic.rmw.cmpxchg", IN_I64_ATOMIC_RMW_CMPXCHG);
+    nimap_intern("i32.atomic.rmw8.cmpxchg_u", IN_I32_ATOMIC_RMW8_CMPXCHG_U);
+    nimap_intern("i32.atomic.rmw16.cmpxchg_u", IN_I32_ATOMIC_RMW16_CMPXCHG_U);
+    nimap_intern("i64.atomic.rmw8.cmpxchg_u", IN_I64_ATOMIC_RMW8_CMPXCHG_U);
+    nimap_intern("i64.atomic.rmw16.cmpxchg_u", IN_I64_ATOMIC_RMW16_CMPXCHG_U);
+    nimap_intern("i64.atomic.rmw32.cmpxchg_u", IN_I64_ATOMIC_RMW32_CMPXCHG_U);
     /* internal use */
     nimap_intern("ref.data", IN_REF_DATA);
     nimap_intern("data.put_ref", IN_DATA_PUT_REF);
-    bufqsort(&g_nimap, &sym_cmp);
+    phtbuild(&g_nimap);
   }
-  sym = intern(name);
-  pi = bufbsearch(&g_nimap, &sym, &sym_cmp);
-  if (pi) return (instr_t)pi[1];
+  if (phtlookup(&g_nimap, name, &in)) return (instr_t)in;
   return IN_PLACEHOLDER;
 }
 
@@ -1714,6 +1877,41 @@ insig_t instr_sig(instr_t in)
     case IN_V128_STORE32_LANE:    case IN_V128_STORE64_LANE:
     case IN_V128_LOAD32_ZERO:     case IN_V128_LOAD64_ZERO:
       return INSIG_MEMARG_LANEIDX;
+    /* threads */
+    case IN_MEMORY_ATOMIC_NOTIFY:      case IN_MEMORY_ATOMIC_WAIT32:
+    case IN_MEMORY_ATOMIC_WAIT64:      case IN_I32_ATOMIC_LOAD:
+    case IN_I64_ATOMIC_LOAD:           case IN_I32_ATOMIC_LOAD8_U:
+    case IN_I32_ATOMIC_LOAD16_U:       case IN_I64_ATOMIC_LOAD8_U:
+    case IN_I64_ATOMIC_LOAD16_U:       case IN_I64_ATOMIC_LOAD32_U:
+    case IN_I32_ATOMIC_STORE:          case IN_I64_ATOMIC_STORE:
+    case IN_I32_ATOMIC_STORE8:         case IN_I32_ATOMIC_STORE16:
+    case IN_I64_ATOMIC_STORE8:         case IN_I64_ATOMIC_STORE16:
+    case IN_I64_ATOMIC_STORE32:        case IN_I32_ATOMIC_RMW_ADD:
+    case IN_I64_ATOMIC_RMW_ADD:        case IN_I32_ATOMIC_RMW8_ADD_U:
+    case IN_I32_ATOMIC_RMW16_ADD_U:    case IN_I64_ATOMIC_RMW8_ADD_U:
+    case IN_I64_ATOMIC_RMW16_ADD_U:    case IN_I64_ATOMIC_RMW32_ADD_U:
+    case IN_I32_ATOMIC_RMW_SUB:        case IN_I64_ATOMIC_RMW_SUB:
+    case IN_I32_ATOMIC_RMW8_SUB_U:     case IN_I32_ATOMIC_RMW16_SUB_U:
+    case IN_I64_ATOMIC_RMW8_SUB_U:     case IN_I64_ATOMIC_RMW16_SUB_U:
+    case IN_I64_ATOMIC_RMW32_SUB_U:    case IN_I32_ATOMIC_RMW_AND:
+    case IN_I64_ATOMIC_RMW_AND:        case IN_I32_ATOMIC_RMW8_AND_U:
+    case IN_I32_ATOMIC_RMW16_AND_U:    case IN_I64_ATOMIC_RMW8_AND_U:
+    case IN_I64_ATOMIC_RMW16_AND_U:    case IN_I64_ATOMIC_RMW32_AND_U:
+    case IN_I32_ATOMIC_RMW_OR:         case IN_I64_ATOMIC_RMW_OR:
+    case IN_I32_ATOMIC_RMW8_OR_U:      case IN_I32_ATOMIC_RMW16_OR_U:
+    case IN_I64_ATOMIC_RMW8_OR_U:      case IN_I64_ATOMIC_RMW16_OR_U:
+    case IN_I64_ATOMIC_RMW32_OR_U:     case IN_I32_ATOMIC_RMW_XOR:
+    case IN_I64_ATOMIC_RMW_XOR:        case IN_I32_ATOMIC_RMW8_XOR_U:
+    case IN_I32_ATOMIC_RMW16_XOR_U:    case IN_I64_ATOMIC_RMW8_XOR_U:
+    case IN_I64_ATOMIC_RMW16_XOR_U:    case IN_I64_ATOMIC_RMW32_XOR_U:
+    case IN_I32_ATOMIC_RMW_XCHG:       case IN_I64_ATOMIC_RMW_XCHG:
+    case IN_I32_ATOMIC_RMW8_XCHG_U:    case IN_I32_ATOMIC_RMW16_XCHG_U:
+    case IN_I64_ATOMIC_RMW8_XCHG_U:    case IN_I64_ATOMIC_RMW16_XCHG_U:
+    case IN_I64_ATOMIC_RMW32_XCHG_U:   case IN_I32_ATOMIC_RMW_CMPXCHG:
+    case IN_I64_ATOMIC_RMW_CMPXCHG:    case IN_I32_ATOMIC_RMW8_CMPXCHG_U:
+    case IN_I32_ATOMIC_RMW16_CMPXCHG_U:  case IN_I64_ATOMIC_RMW8_CMPXCHG_U:
+    case IN_I64_ATOMIC_RMW16_CMPXCHG_U:  case IN_I64_ATOMIC_RMW32_CMPXCHG_U:
+      return INSIG_MEMARG;
     /* internal use */
     case IN_REF_DATA:
       return INSIG_RD; 
@@ -1991,8 +2189,10 @@ static void wat_imports(watiebuf_t *pib)
       } break;
       case IEK_MEM: {
         cbputf(g_watbuf, "(memory $%s:%s", smod, sname);
-        if (pi->lt == LT_MIN) cbputf(g_watbuf, " %u)", pi->n);
-        else cbputf(g_watbuf, " %u %u)", pi->n, pi->m);
+        if (pi->lt == LT_MIN) cbputf(g_watbuf, " %u", pi->n);
+        else cbputf(g_watbuf, " %u %u", pi->n, pi->m);
+        if (pi->lt == LT_MINMAX_SHARED) cbputs(" shared", g_watbuf);
+        cbputc(')', g_watbuf); 
       } break;
       case IEK_GLOBAL: {
         cbputf(g_watbuf, "(global $%s:%s", smod, sname);
@@ -2006,6 +2206,10 @@ static void wat_imports(watiebuf_t *pib)
     }
     cbputc(')', g_watbuf); 
     wat_line(cbdata(g_watbuf));
+    if (pi->iek == IEK_MEM && pi->exported) { /* shared memory */
+      cbsetf(g_watbuf, "(export \"%s\" (memory $%s:%s))", sname, smod, sname);
+      wat_line(cbdata(g_watbuf));
+    }
   }
 }
 
@@ -2020,6 +2224,7 @@ static void wat_export_mems(watiebuf_t *peb)
       if (pe->exported) cbputf(g_watbuf, " (export \"%s\")", symname(pe->id));
       if (pe->lt == LT_MIN) cbputf(g_watbuf, " %u", pe->n);
       else cbputf(g_watbuf, " %u %u", pe->n, pe->m);
+      if (pe->lt == LT_MINMAX_SHARED) cbputs(" shared", g_watbuf);
       cbputc(')', g_watbuf); 
       wat_line(cbdata(g_watbuf));
     }
@@ -2068,6 +2273,9 @@ static void wat_export_datas(watiebuf_t *pdb)
         cbsetf(g_watbuf, "(data $%s:%s", smod, sname);
         if (pd->exported) cbputf(g_watbuf, " (export \"%s\")", symname(pd->id));
         cbputf(g_watbuf, " %s align=%d", vcs, pd->align);
+      } else if (pd->passive) { /* passive segment (final, WAT-compatible) */
+        assert(!pd->align);
+        cbsetf(g_watbuf, "(data");
       } else { /* positioned segment (final, WAT-compatible) */
         cbuf_t cb = mkcb();
         assert(!pd->align); assert(pd->ic.in == IN_I32_CONST);
@@ -2209,6 +2417,457 @@ void write_wat_module(wat_module_t* pm, FILE *pf)
 }
 
 
+/* write binary object module */
+/* NB: .wbo is a serialized wat_module_t: header, table of symbol names,
+ * then imports and exports; fields are stored as the wat text reader
+ * would fill them from the .wo dump of the same module, so both load
+ * identically, but .wbo needs no tokenizing and no name lookups */
+
+#define WBO_VERSION 1
+
+static buf_t *g_wbosymidx = NULL; /* sym_t => 1-based index in g_wbosyms */
+static buf_t *g_wbosyms = NULL; /* sym_t in order of first use */
+
+static void wbo_sym(sym_t s)
+{
+  unsigned *pi;
+  if (s == 0) { wasm_unsigned(0); return; }
+  if ((size_t)s >= buflen(g_wbosymidx)) bufresize(g_wbosymidx, (size_t)s+1);
+  pi = bufref(g_wbosymidx, (size_t)s);
+  if (*pi == 0) {
+    *(sym_t*)bufnewbk(g_wbosyms) = s;
+    *pi = (unsigned)buflen(g_wbosyms);
+  }
+  wasm_unsigned(*pi);
+}
+
+static void wbo_funcsig(funcsig_t *pfs)
+{
+  size_t i;
+  wasm_unsigned(vtblen(&pfs->partypes));
+  for (i = 0; i < vtblen(&pfs->partypes); ++i) wasm_byte(*vtbref(&pfs->partypes, i));
+  wasm_unsigned(vtblen(&pfs->restypes));
+  for (i = 0; i < vtblen(&pfs->restypes); ++i) wasm_byte(*vtbref(&pfs->restypes, i));
+}
+
+static void wbo_ins(inscode_t *pic)
+{
+  wasm_signed(pic->in);
+  if (pic->in == IN_REGDECL) {
+    wbo_sym(pic->id); wasm_byte((unsigned)pic->arg.u);
+    return;
+  }
+  switch (instr_sig(pic->in)) {
+    case INSIG_NONE:
+      if (pic->in == IN_END) wbo_sym(pic->id); /* optional label */
+      break;
+    case INSIG_BT:
+      if (pic->in == IN_IF) wasm_byte((unsigned)pic->arg.u);
+      else wbo_sym(pic->id);
+      break;
+    case INSIG_L: case INSIG_XL:
+      wbo_sym(pic->id);
+      if (!pic->id) wasm_signed(pic->arg.i);
+      break;
+    case INSIG_XG: case INSIG_XT: case INSIG_RF:
+      wbo_sym(pic->arg2.mod); wbo_sym(pic->id);
+      if (!pic->id) wasm_signed(pic->arg.i);
+      break;
+    case INSIG_CI: /* index into g_funcsigs is process-specific */
+      assert(pic->arg.u < fsblen(&g_funcsigs));
+      wbo_funcsig(fsbref(&g_funcsigs, (size_t)pic->arg.u));
+      break;
+    case INSIG_T:
+      wasm_byte((unsigned)pic->arg.u);
+      break;
+    case INSIG_I32: /* sign-extended as in text */
+      wasm_signed((long long)(pic->arg.u << 32) >> 32);
+      break;
+    case INSIG_I64:
+      wasm_signed(pic->arg.i);
+      break;
+    case INSIG_F32:
+      wasm_float(pic->arg.f);
+      break;
+    case INSIG_F64:
+      wasm_double(pic->arg.d);
+      break;
+    case INSIG_I128:
+      wasm_signed(pic->arg.i); wasm_signed(pic->arg2.i);
+      break;
+    case INSIG_MEMARG:
+      wasm_unsigned(pic->arg.u); wasm_unsigned(pic->arg2.u);
+      break;
+    case INSIG_MEMARG_LANEIDX:
+      wasm_unsigned(pic->arg2.ux2[0]); wasm_unsigned(pic->arg2.ux2[1]);
+      wasm_unsigned(pic->arg.u);
+      break;
+    case INSIG_LANEIDX: case INSIG_LANEIDX16: case INSIG_PR: case INSIG_LS_L:
+      wasm_unsigned(pic->arg.u);
+      break;
+    case INSIG_RD:
+      wbo_sym(pic->arg2.mod); wbo_sym(pic->id);
+      wasm_signed(pic->arg.i);
+      break;
+    default:
+      assert(false);
+  }
+}
+
+static void wbo_code(icbuf_t *pcb)
+{
+  size_t i;
+  wasm_unsigned(icblen(pcb));
+  for (i = 0; i < icblen(pcb); ++i) wbo_ins(icbref(pcb, i));
+}
+
+static void wbo_import(watie_t *pi)
+{
+  wasm_byte(pi->iek); wbo_sym(pi->mod); wbo_sym(pi->id);
+  switch (pi->iek) {
+    case IEK_FUNC:
+      wbo_funcsig(&pi->fs);
+      break;
+    case IEK_DATA:
+      wasm_byte(pi->mut); wasm_unsigned(pi->align); wasm_unsigned(pi->n);
+      break;
+    case IEK_MEM:
+      wasm_byte(pi->lt); wasm_unsigned(pi->n);
+      if (pi->lt != LT_MIN) wasm_unsigned(pi->m);
+      break;
+    case IEK_GLOBAL:
+      wasm_byte(pi->mut); wasm_byte(pi->vt);
+      break;
+    default: assert(false);
+  }
+}
+
+static void wbo_export(watie_t *pe)
+{
+  size_t i;
+  wasm_byte(pe->iek); wbo_sym(pe->mod); wbo_sym(pe->id);
+  wasm_byte(pe->exported);
+  switch (pe->iek) {
+    case IEK_MEM:
+      wasm_byte(pe->lt); wasm_unsigned(pe->n);
+      if (pe->lt != LT_MIN) wasm_unsigned(pe->m);
+      break;
+    case IEK_GLOBAL:
+      wasm_byte(pe->mut); wasm_byte(pe->vt);
+      wasm_byte(pe->ic.in != 0);
+      if (pe->ic.in != 0) wbo_ins(&pe->ic);
+      break;
+    case IEK_DATA: {
+      size_t n = buflen(&pe->data);
+      wasm_byte(pe->mut); wasm_unsigned(pe->align);
+      wasm_unsigned(n);
+      if (data_all_zeroes(pe->data.buf, n)) { /* size only */
+        wasm_byte(0);
+      } else {
+        wasm_byte(1); cbput(pe->data.buf, n, g_curbuf);
+      }
+      wbo_code(&pe->code);
+    } break;
+    case IEK_TABLE:
+      wasm_byte(pe->lt); wasm_unsigned(pe->n); wasm_unsigned(pe->m);
+      wasm_unsigned(buflen(&pe->table));
+      for (i = 0; i < buflen(&pe->table); ++i) {
+        dpme_t *pd = bufref(&pe->table, i);
+        wbo_sym(pd->mod); wbo_sym(pd->id);
+      }
+      break;
+    case IEK_FUNC:
+      wbo_funcsig(&pe->fs);
+      wbo_code(&pe->code);
+      break;
+    default: assert(false);
+  }
+}
+
+void write_wbo_module(wat_module_t* pm, FILE *pf)
+{
+  /* exports go in the same order as in the text dump */
+  iekind_t order[5] = { IEK_MEM, IEK_GLOBAL, IEK_DATA, IEK_TABLE, IEK_FUNC };
+  buf_t symidx, syms; cbuf_t body, head; size_t i, k, n;
+  bufinit(&symidx, sizeof(unsigned)); bufinit(&syms, sizeof(sym_t));
+  cbinit(&body); cbinit(&head);
+  g_wbosymidx = &symidx, g_wbosyms = &syms;
+  g_curbuf = &body;
+  wbo_sym(pm->name);
+  wasm_byte(pm->main);
+  wasm_unsigned(watieblen(&pm->imports));
+  for (i = 0; i < watieblen(&pm->imports); ++i) wbo_import(watiebref(&pm->imports, i));
+  wasm_unsigned(watieblen(&pm->exports));
+  for (k = 0; k < 5; ++k) {
+    for (i = 0; i < watieblen(&pm->exports); ++i) {
+      watie_t *pe = watiebref(&pm->exports, i);
+      if (pe->iek == order[k]) wbo_export(pe);
+    }
+  }
+  /* header and symbol names go first, so the reader can intern them up front */
+  g_curbuf = &head;
+  cbput("\0wbo", 4, &head);
+  wasm_unsigned(WBO_VERSION);
+  wasm_unsigned(buflen(&syms));
+  for (i = 0; i < buflen(&syms); ++i) wasm_name(symname(*(sym_t*)bufref(&syms, i)));
+  g_curbuf = NULL;
+  n = fwrite(cbdata(&head), 1, cblen(&head), pf);
+  n += fwrite(cbdata(&body), 1, cblen(&body), pf);
+  if (n != cblen(&head) + cblen(&body)) eprintf("failed to write binary object module");
+  g_wbosymidx = g_wbosyms = NULL;
+  buffini(&symidx); buffini(&syms);
+  cbfini(&body); cbfini(&head);
+}
+
+
+/* read binary object module */
+
+typedef struct wbor {
+  const char *fname;          /* for error messages */
+  const unsigned char *p, *e; /* current position and end of input */
+  buf_t syms;                 /* index-1 => sym_t */
+} wbor_t;
+
+static void wbor_fail(wbor_t *pr)
+{
+  eprintf("%s: invalid or damaged binary object module", pr->fname);
+}
+
+static unsigned wbor_byte(wbor_t *pr)
+{
+  if (pr->p >= pr->e) wbor_fail(pr);
+  return *pr->p++;
+}
+
+static unsigned long long wbor_unsigned(wbor_t *pr)
+{
+  unsigned long long val = 0; int shift = 0; unsigned b;
+  do {
+    b = wbor_byte(pr);
+    if (shift < 64) val |= (unsigned long long)(b & 0x7F) << shift;
+    shift += 7;
+  } while ((b & 0x80) != 0);
+  return val;
+}
+
+static long long wbor_signed(wbor_t *pr)
+{
+  unsigned long long val = 0; int shift = 0; unsigned b;
+  do {
+    b = wbor_byte(pr);
+    if (shift < 64) val |= (unsigned long long)(b & 0x7F) << shift;
+    shift += 7;
+  } while ((b & 0x80) != 0);
+  if (shift < 64 && (b & 0x40) != 0) val |= ~0ULL << shift;
+  return (long long)val;
+}
+
+static void wbor_bytes(wbor_t *pr, void *dst, size_t n)
+{
+  if ((size_t)(pr->e - pr->p) < n) wbor_fail(pr);
+  memcpy(dst, pr->p, n);
+  pr->p += n;
+}
+
+static sym_t wbor_sym(wbor_t *pr)
+{
+  unsigned long long i = wbor_unsigned(pr);
+  if (i == 0) return 0;
+  if (i > buflen(&pr->syms)) wbor_fail(pr);
+  return *(sym_t*)bufref(&pr->syms, (size_t)i-1);
+}
+
+static void wbor_funcsig(wbor_t *pr, funcsig_t *pfs)
+{
+  size_t i, n;
+  n = (size_t)wbor_unsigned(pr);
+  for (i = 0; i < n; ++i) *vtbnewbk(&pfs->partypes) = (valtype_t)wbor_byte(pr);
+  n = (size_t)wbor_unsigned(pr);
+  for (i = 0; i < n; ++i) *vtbnewbk(&pfs->restypes) = (valtype_t)wbor_byte(pr);
+}
+
+static void wbor_ins(wbor_t *pr, inscode_t *pic)
+{
+  pic->in = (instr_t)wbor_signed(pr);
+  if (pic->in == IN_REGDECL) {
+    pic->id = wbor_sym(pr); pic->arg.u = wbor_byte(pr);
+    return;
+  }
+  switch (instr_sig(pic->in)) {
+    case INSIG_NONE:
+      if (pic->in == IN_END) pic->id = wbor_sym(pr);
+      break;
+    case INSIG_BT:
+      if (pic->in == IN_IF) pic->arg.u = wbor_byte(pr);
+      else pic->id = wbor_sym(pr), pic->arg.u = BT_VOID;
+      break;
+    case INSIG_L: case INSIG_XL:
+      pic->id = wbor_sym(pr);
+      if (!pic->id) pic->arg.i = wbor_signed(pr);
+      break;
+    case INSIG_XG: case INSIG_XT: case INSIG_RF:
+      pic->arg2.mod = wbor_sym(pr); pic->id = wbor_sym(pr);
+      if (!pic->id) pic->arg.i = wbor_signed(pr);
+      break;
+    case INSIG_CI: {
+      funcsig_t fs; fsinit(&fs);
+      wbor_funcsig(pr, &fs);
+      pic->arg.u = fsintern(&g_funcsigs, &fs);
+      fsfini(&fs);
+    } break;
+    case INSIG_T:
+      pic->arg.u = wbor_byte(pr);
+      break;
+    case INSIG_I32: case INSIG_I64:
+      pic->arg.i = wbor_signed(pr);
+      break;
+    case INSIG_F32:
+      wbor_bytes(pr, &pic->arg.f, 4);
+      break;
+    case INSIG_F64:
+      wbor_bytes(pr, &pic->arg.d, 8);
+      break;
+    case INSIG_I128:
+      pic->arg.i = wbor_signed(pr); pic->arg2.i = wbor_signed(pr);
+      break;
+    case INSIG_MEMARG:
+      pic->arg.u = wbor_unsigned(pr); pic->arg2.u = wbor_unsigned(pr);
+      break;
+    case INSIG_MEMARG_LANEIDX:
+      pic->arg2.ux2[0] = (unsigned)wbor_unsigned(pr); 
+      pic->arg2.ux2[1] = (unsigned)wbor_unsigned(pr);
+      pic->arg.u = wbor_unsigned(pr);
+      break;
+    case INSIG_LANEIDX: case INSIG_LANEIDX16: case INSIG_PR: case INSIG_LS_L:
+      pic->arg.u = wbor_unsigned(pr);
+      break;
+    case INSIG_RD:
+      pic->arg2.mod = wbor_sym(pr); pic->id = wbor_sym(pr);
+      pic->arg.i = wbor_signed(pr);
+      break;
+    default:
+      wbor_fail(pr);
+  }
+}
+
+static void wbor_code(wbor_t *pr, icbuf_t *pcb)
+{
+  size_t i, n = (size_t)wbor_unsigned(pr);
+  for (i = 0; i < n; ++i) wbor_ins(pr, icbnewbk(pcb));
+}
+
+static void wbor_import(wbor_t *pr, watie_t *pi)
+{
+  pi->mod = wbor_sym(pr); pi->id = wbor_sym(pr);
+  switch (pi->iek) {
+    case IEK_FUNC:
+      wbor_funcsig(pr, &pi->fs);
+      break;
+    case IEK_DATA:
+      pi->mut = (muttype_t)wbor_byte(pr); pi->align = (int)wbor_unsigned(pr); 
+      pi->n = (unsigned)wbor_unsigned(pr);
+      break;
+    case IEK_MEM:
+      pi->lt = (limtype_t)wbor_byte(pr); pi->n = (unsigned)wbor_unsigned(pr);
+      if (pi->lt != LT_MIN) pi->m = (unsigned)wbor_unsigned(pr);
+      break;
+    case IEK_GLOBAL:
+      pi->mut = (muttype_t)wbor_byte(pr); pi->vt = (valtype_t)wbor_byte(pr);
+      break;
+    default: wbor_fail(pr);
+  }
+}
+
+static void wbor_export(wbor_t *pr, watie_t *pe)
+{
+  size_t i, n;
+  pe->mod = wbor_sym(pr); pe->id = wbor_sym(pr);
+  pe->exported = wbor_byte(pr) != 0;
+  switch (pe->iek) {
+    case IEK_MEM:
+      pe->lt = (limtype_t)wbor_byte(pr); pe->n = (unsigned)wbor_unsigned(pr);
+      if (pe->lt != LT_MIN) pe->m = (unsigned)wbor_unsigned(pr);
+      break;
+    case IEK_GLOBAL:
+      pe->mut = (muttype_t)wbor_byte(pr); pe->vt = (valtype_t)wbor_byte(pr);
+      if (wbor_byte(pr) != 0) wbor_ins(pr, &pe->ic);
+      break;
+    case IEK_DATA:
+      pe->mut = (muttype_t)wbor_byte(pr); pe->align = (int)wbor_unsigned(pr);
+      n = (size_t)wbor_unsigned(pr);
+      bufresize(&pe->data, n); /* zeroes */
+      if (wbor_byte(pr) != 0) wbor_bytes(pr, pe->data.buf, n);
+      wbor_code(pr, &pe->code);
+      break;
+    case IEK_TABLE:
+      pe->lt = (limtype_t)wbor_byte(pr); pe->n = (unsigned)wbor_unsigned(pr); 
+      pe->m = (unsigned)wbor_unsigned(pr);
+      n = (size_t)wbor_unsigned(pr);
+      for (i = 0; i < n; ++i) {
+        dpme_t *pd = bufnewbk(&pe->table);
+        pd->mod = wbor_sym(pr); pd->id = wbor_sym(pr);
+      }
+      break;
+    case IEK_FUNC:
+      wbor_funcsig(pr, &pe->fs);
+      wbor_code(pr, &pe->code);
+      break;
+    default: wbor_fail(pr);
+  }
+}
+
+static void wbor_module(wbor_t *pr, wat_module_t* pm)
+{
+  cbuf_t cb = mkcb(); size_t i, n;
+  if ((size_t)(pr->e - pr->p) < 4 || memcmp(pr->p, "\0wbo", 4) != 0) wbor_fail(pr);
+  pr->p += 4;
+  if (wbor_unsigned(pr) != WBO_VERSION) 
+    eprintf("%s: unsupported binary object module version", pr->fname);
+  n = (size_t)wbor_unsigned(pr);
+  for (i = 0; i < n; ++i) {
+    size_t len = (size_t)wbor_unsigned(pr);
+    cbclear(&cb); wbor_bytes(pr, cballoc(&cb, len), len);
+    *(sym_t*)bufnewbk(&pr->syms) = intern(cbdata(&cb));
+  }
+  wat_module_clear(pm);
+  pm->name = wbor_sym(pr);
+  pm->main = (main_t)wbor_byte(pr);
+  n = (size_t)wbor_unsigned(pr);
+  for (i = 0; i < n; ++i) {
+    watie_t *pi = watiebnewbk(&pm->imports, (iekind_t)wbor_byte(pr));
+    wbor_import(pr, pi);
+  }
+  n = (size_t)wbor_unsigned(pr);
+  for (i = 0; i < n; ++i) {
+    watie_t *pe = watiebnewbk(&pm->exports, (iekind_t)wbor_byte(pr));
+    wbor_export(pr, pe);
+  }
+  if (pr->p != pr->e) wbor_fail(pr);
+  cbfini(&cb);
+}
+
+bool read_wbo_module(const char *fname, wat_module_t* pm)
+{
+  wbor_t r; const char *mpath; MEM *mp = NULL; FILE *fp = NULL; cbuf_t cb = mkcb();
+  r.fname = fname;
+  if ((mpath = strprf(fname, "res://")) != NULL) {
+    if ((mp = mopen(mpath)) == NULL) return false;
+    r.p = (const unsigned char *)mp->base, r.e = (const unsigned char *)mp->end;
+  } else {
+    if ((fp = fopen(fname, "rb")) == NULL) return false;
+    if (fgetall(&cb, fp) == NULL) eprintf("%s: read error", fname);
+    fclose(fp);
+    r.p = (const unsigned char *)cbdata(&cb), r.e = r.p + cblen(&cb);
+  }
+  bufinit(&r.syms, sizeof(sym_t));
+  wbor_module(&r, pm);
+  buffini(&r.syms);
+  if (mp != NULL) mclose(mp);
+  cbfini(&cb);
+  return true;
+}
+
+
 /* read object wat text module */
 
 /* wasm token types */
@@ -2227,6 +2886,8 @@ typedef struct sws {
   fgetlb_t getlb;     /* function to read from it */
   fclose_t close;     /* and close it afterwards */
   int lno;            /* current line no. (0-based) */
+  size_t lpos;        /* position of current line start */
+  buf_t lsposs;       /* line start positions */
   bool inateof;       /* current input is exausted */  
   cbuf_t chars;       /* line buffer of chars */
   int curi;           /* current input position in line */
@@ -2234,8 +2895,7 @@ typedef struct sws {
   wt_t ctk;           /* lookahead token type */
   cbuf_t token;       /* lookahead token char data */
   char *tokstr;       /* lookahead token string */
-  int posl;           /* lno of la token start */
-  int posi;           /* posi of la token start */
+  size_t tpos;        /* position of la token start */
 } sws_t;
 
 /* alloc scanner workspace for infile */
@@ -2262,6 +2922,8 @@ sws_t *newsws(const char *infile)
   if (pw) {
     pw->infile = estrdup(infile);
     pw->lno = 0;
+    pw->lpos = 0;
+    bufinit(&pw->lsposs, sizeof(size_t));
     pw->inateof = false;
     bufinit(&pw->chars, sizeof(char));
     pw->curi = 0; 
@@ -2269,8 +2931,7 @@ sws_t *newsws(const char *infile)
     pw->ctk = WT_EOF;
     cbinit(&pw->token);
     pw->tokstr = NULL;
-    pw->posl = 0;
-    pw->posi = 0;
+    pw->tpos = 0;
   }
   return pw;
 }
@@ -2280,6 +2941,7 @@ static void freesws(sws_t *pw)
   if (pw) {
     free(pw->infile);
     if (pw->close != (fclose_t)&fclose || pw->input != stdin) (*pw->close)(pw->input);
+    buffini(&pw->lsposs);
     cbfini(&pw->chars);
     cbfini(&pw->token);
     free(pw);
@@ -2290,6 +2952,7 @@ static void freesws(sws_t *pw)
 static int fetchline(sws_t *pw, char **ptbase, int *pendi)
 {
   cbuf_t *pp = &pw->chars; int c = EOF;
+  pw->lpos += cblen(pp);
   cbclear(pp);
   if (!pw->inateof) {
     char *line = (*pw->getlb)(pp, pw->input);
@@ -2300,6 +2963,7 @@ static int fetchline(sws_t *pw, char **ptbase, int *pendi)
       c = '\n';
       pw->lno += 1;
       pw->curi = 0;
+      *(size_t*)bufnewbk(&pw->lsposs) = pw->lpos;
       *ptbase = cbdata(pp);
       *pendi = (int)cblen(pp);
     }
@@ -2949,9 +3613,9 @@ static void vseprintf(sws_t *pw, const char *fmt, va_list args)
   cbuf_t cb = mkcb(); const char *s;
   int ln = 0, off = 0; assert(fmt);
   if (pw != NULL && pw->infile != NULL) cbputf(&cb, "%s:", pw->infile);
-  if (pw != NULL) {
-    ln = pw->posl, off = pw->posi;
-    if (ln > 0) cbputf(&cb, "%d:%d:", ln, off+1);
+  if (pw != NULL && buflen(&pw->lsposs) > 0) {
+    bufpos2lnoff(&pw->lsposs, pw->tpos, &ln, &off);
+    cbputf(&cb, "%d:%d:", ln, off+1);
   }
   fflush(stdout); 
   if (cblen(&cb) > 0) {
@@ -3012,7 +3676,7 @@ static wt_t peekt(sws_t *pw)
 { 
   if (!pw->gottk) {
     do { /* fetch next non-whitespace token */
-      pw->posl = pw->lno, pw->posi = pw->curi; 
+      pw->tpos = pw->lpos + pw->curi; 
       pw->ctk = lex(pw, &pw->token);
       if (pw->ctk == WT_EOF && !pw->inateof) {
         seprintf(pw, "illegal token"); 
@@ -3214,6 +3878,7 @@ static valtype_t parse_valtype(sws_t *pw)
     else if (streql(pw->tokstr, "f32")) vt = VT_F32;
     else if (streql(pw->tokstr, "i64")) vt = VT_I64;
     else if (streql(pw->tokstr, "i32")) vt = VT_I32;
+    else if (streql(pw->tokstr, "v128")) vt = VT_V128;
     /* else if (streql(pw->tokstr, "funcref")) vt = RT_FUNCREF; */
     /* else if (streql(pw->tokstr, "externref")) vt = RT_EXTERNREF; */
     if (vt != VT_UNKN) { dropt(pw); return vt; }
@@ -3518,6 +4183,7 @@ static void parse_import_des(sws_t *pw, watie_t *pi)
     if (!ahead(pw, ")")) {
       pi->lt = LT_MINMAX;
       pi->m = parse_uint(pw);  
+      if (ahead(pw, "shared")) { dropt(pw); pi->lt = LT_MINMAX_SHARED; }
     }
   } else if (ahead(pw, "data")) {
     dropt(pw);
@@ -3631,6 +4297,7 @@ static void parse_modulefield(sws_t *pw, wat_module_t* pm)
     if (!ahead(pw, ")")) {
       pe->m = parse_uint(pw);
       pe->lt = LT_MINMAX;
+      if (ahead(pw, "shared")) { dropt(pw); pe->lt = LT_MINMAX_SHARED; }
     }
   } else if (ahead(pw, "global")) {
     watie_t *pe = watiebnewbk(&pm->exports, IEK_GLOBAL);
@@ -3730,7 +4397,12 @@ static void parse_module(sws_t *pw, wat_module_t* pm)
 
 void read_wat_object_module(const char *fname, wat_module_t* pm)
 {
-  sws_t *pw = newsws(fname);
+  sws_t *pw;
+  if (strsuf(fname, ".wbo") != NULL) {
+    if (!read_wbo_module(fname, pm)) eprintf("cannot read object file: %s", fname);
+    return;
+  }
+  pw = newsws(fname);
   if (pw) {
     wat_module_clear(pm);
     pm->main = MAIN_ABSENT;
@@ -3765,6 +4437,11 @@ void load_library_wat_module(sym_t mod, wat_module_t* pm)
   sws_t *pws = NULL;
   for (i = 0; i < buflen(g_lbases); ++i) {
     sym_t *pb = bufref(g_lbases, i);
+    if (read_wbo_module(cbsetf(&cb, "%s%s.wbo", symname(*pb), symname(mod)), pm)) {
+      logef("# '%s' module object loaded from %s\n", symname(mod), cbdata(&cb));
+      cbfini(&cb);
+      return;
+    }
     pws = newsws(cbsetf(&cb, "%s%s.o", symname(*pb), symname(mod)));
     if (pws) break;
     pws = newsws(cbsetf(&cb, "%s%s.wo", symname(*pb), symname(mod)));
@@ -3808,8 +4485,8 @@ int modid_cmp(const void *pv1, const void *pv2)
 static bool process_subsystem_depglobal(modid_t *pmii, wat_module_t* pmi, wat_module_t* pm)
 {
   watie_t *pi;
-  /* as of now, we only have one subsystem, WASI */
-  if (pmii->mod != g_wasi_mod) return false;
+  /* as of now, we only have two subsystems, WASI and WASI threads */
+  if (pmii->mod != g_wasi_mod && pmii->mod != g_wasit_mod) return false;
   pi = bufbsearch(&pmi->imports, pmii, &modid_cmp);
   if (!pi) eprintf("cannot locate import '%s:%s' in '%s' module", 
     symname(pmii->mod), symname(pmii->id), symname(pmi->name));
@@ -3922,6 +4599,7 @@ typedef struct dsme {
   cbuf_t data; /* data segment data */
   int align;    /* alignment in bytes: 1,2,4,8,16 */
   bool write;   /* belongs to wtiteable memory */
+  sym_t mod;    /* dseg module */
   sym_t id;     /* module-local dseg id */
   size_t addr;  /* used by linker */
 } dsme_t;
@@ -3964,99 +4642,483 @@ int dsme_cmp(const void *p1, const void *p2)
   return 0;
 }
 
-/* remove dependence on non-standard WAT features and instructions */
-size_t watify_wat_module(wat_module_t* pm)
+/* compare data backwards, so suffixes precede data ending with them */
+int dsme_rcmp(const void *p1, const void *p2)
 {
-  size_t curaddr = g_sdbaddr;
-  cbuf_t dseg = mkcb(); size_t i;
-  buf_t dpmap = mkbuf(sizeof(dpme_t));
-  buf_t table = mkbuf(sizeof(dpme_t));
-  dsmebuf_t dsmap; dsmebinit(&dsmap);
-  
-  /* reverse exports so leafs are processed before non-leafs */
-  bufrev(&pm->exports);
-  
-  /* concatenate dss into one big data chunk */
-  for (i = 0; i < watieblen(&pm->exports); /* del or bumpi */) {
-    watie_t *pd = watiebref(&pm->exports, i);
-    if (pd->iek == IEK_DATA) {
-      dpme_t *pme; size_t addr;
-      vverbosef("converting dseg: %s:%s\n", symname(pd->mod), symname(pd->id));
-      if (pd->mut == MT_CONST && icblen(&pd->code) == 0) {
-        /* leaf, read-only: try to merge it with equals */
-        dsme_t e, *pe; dsmeinit(&e); 
-        cbcpy(&e.data, &pd->data);
-        e.align = pd->align; assert(pd->align);
-        pe = bufbsearch(&dsmap, &e, &dsme_cmp);
-        if (!pe) { /* new data elt */
-          size_t align, n;
-          addr = curaddr;
-          pe = bufnewbk(&dsmap);
-          memswap(pe, &e, sizeof(dsme_t)); 
-          align = pd->align, n = addr % align;
-          if (n > 0) addr += align - n;
-          if (n > 0) bufresize(&dseg, buflen(&dseg) + (align-n));
-          cbcat(&dseg, &pe->data);
-          pe->addr = addr;
-          curaddr = addr + buflen(&pe->data);
-          bufqsort(&dsmap, &dsme_cmp);
-        } else {
-          addr = pe->addr;
-        }
-        dsmefini(&e);
-      } else {
-        /* non-leaf or read-write -- can't share */
-        size_t align, n;
-        addr = curaddr;
-        align = pd->align, n = addr % align;
-        if (n > 0) addr += align - n;
-        if (n > 0) bufresize(&dseg, buflen(&dseg) + (align-n));
-        if (icblen(&pd->code) > 0) { /* patch pd->data */
-          size_t i; cbuf_t cb = mkcb(); bool gotarg = false;
-          for (i = 0; i < icblen(&pd->code); ++i) {
-            modid_t mi; dpme_t *pdpme; size_t off; 
-            inscode_t *pic = icbref(&pd->code, i);
-            if (!gotarg && pic->in == IN_REF_DATA) {
-              unsigned address;
-              mi.mod = pic->arg2.mod; mi.id = pic->id;
-              pdpme = bufsearch(&dpmap, &mi, &modid_cmp); /* linear, still adding to it */
-              if (!pdpme) eprintf("internal error: undefined ref in data: $%s:%s", 
-                mi.mod ? symname(mi.mod) : "?", mi.id ? symname(mi.id) : "?");
-              address = (unsigned)((long long)pdpme->address + pic->arg.i);
-              bufclear(&cb); binuint(address, &cb); /* wasm32 */
-              gotarg = true;
-            } else if (gotarg && pic->in == IN_DATA_PUT_REF) {
-              off = (size_t)pic->arg.u; assert(pic->id == 0);
-              if (off % 4 != 0 || off + 4 > cblen(&pd->data)) /* wasm32 */
-                eprintf("internal error: cannot patch data: bad offset %lu", (unsigned long)off);
-              memcpy(cbdata(&pd->data) + off, cbdata(&cb), 4); /* wasm32 */
-              gotarg = false;
-            } else {
-              eprintf("internal error in data patch");
-            }
-          }
-          cbfini(&cb);
-        }
-        cbcat(&dseg, &pd->data);
-        curaddr = addr + buflen(&pd->data);
-      }
-      pme = bufnewbk(&dpmap);
-      pme->mod = pd->mod; pme->id = pd->id;
-      pme->address = addr;
-      vverbosef("  addr = %u\n", (unsigned)addr);
-      watiefini(pd); bufrem(&pm->exports, i);
-    } else {
-      ++i;
+  dsme_t *pe1 = (dsme_t*)p1, *pe2 = (dsme_t*)p2; 
+  size_t n1 = cblen(&pe1->data), n2 = cblen(&pe2->data);
+  const unsigned char *pc1 = (unsigned char *)cbdata(&pe1->data) + n1;
+  const unsigned char *pc2 = (unsigned char *)cbdata(&pe2->data) + n2;
+  while (n1 > 0 && n2 > 0) {
+    int d = (int)*--pc1 - (int)*--pc2; --n1, --n2;
+    if (d < 0) return -1;
+    if (d > 0) return 1;
+  }
+  if (n1 < n2) return -1;
+  if (n1 > n2) return 1;
+  return 0;
+}
+
+static bool dsme_suffix(dsme_t *pe1, dsme_t *pe2)
+{
+  size_t n1 = cblen(&pe1->data), n2 = cblen(&pe2->data);
+  return n1 <= n2 && memcmp(cbdata(&pe1->data), cbdata(&pe2->data) + (n2-n1), n1) == 0;
+}
+
+/* index of mod:id function in the table, adding it if needed */
+static size_t table_index(buf_t *ptable, hidx_t *pidx, sym_t mod, sym_t id)
+{
+  dpme_t e, *pdpme; unsigned long h;
+  e.mod = mod; e.id = id; 
+  h = (unsigned long)mod * 2654435761UL ^ (unsigned long)id;
+  pdpme = bufhsearch(ptable, pidx, &e, h, &modid_cmp);
+  if (!pdpme) { 
+    pdpme = bufnewbk(ptable); *pdpme = e; 
+    hidxadd(pidx, h, buflen(ptable)-1); 
+  }
+  return bufoff(ptable, pdpme) + 1; /* elem #0 reserved */
+}
+
+/* function reference: mod:id function and its signature */
+typedef struct fref {
+  sym_t mod, id;  /* mod:id; used for sorting */
+  unsigned fsi;   /* index of signature in g_funcsigs */
+} fref_t;
+
+/* function pointer global: i32 global holding known function refs */
+typedef struct fpglob {
+  sym_t mod, id;  /* mod:id; used for sorting */
+  bool known;     /* all values stored in it are ref.funcs or 0 */
+  buf_t refs;     /* fref_t: functions stored in it */
+} fpglob_t;
+
+/* collect all functions of pm with their signatures, sorted by mod:id */
+static void collect_funcsigs(wat_module_t* pm, buf_t *pfb)
+{
+  size_t i;
+  for (i = 0; i < watieblen(&pm->imports); ++i) {
+    watie_t *pi = watiebref(&pm->imports, i); fref_t *pf;
+    if (pi->iek != IEK_FUNC) continue;
+    pf = bufnewbk(pfb); pf->mod = pi->mod; pf->id = pi->id;
+    pf->fsi = fsintern(&g_funcsigs, &pi->fs);
+  }
+  for (i = 0; i < watieblen(&pm->exports); ++i) {
+    watie_t *pe = watiebref(&pm->exports, i); fref_t *pf;
+    if (pe->iek != IEK_FUNC) continue;
+    pf = bufnewbk(pfb); pf->mod = pe->mod; pf->id = pe->id;
+    pf->fsi = fsintern(&g_funcsigs, &pe->fs);
+  }
+  bufqsort(pfb, &modid_cmp);
+}
+
+/* add mod:id function to set of function refs */
+static void frefadd(buf_t *prb, buf_t *pfb, sym_t mod, sym_t id)
+{
+  fref_t e, *pf; e.mod = mod; e.id = id;
+  if (bufsearch(prb, &e, &modid_cmp) != NULL) return;
+  pf = bufbsearch(pfb, &e, &modid_cmp);
+  e.fsi = pf ? pf->fsi : UINT_MAX; /* unknown: never a target */
+  *(fref_t*)bufnewbk(prb) = e;
+}
+
+/* n-th devirtualization temp local of vt type, declared in prdb if new */
+static sym_t dvlocal(valtype_t vt, int n, icbuf_t *prdb)
+{
+  size_t i; inscode_t *pic;
+  sym_t id = internf("dv%s_%d$", valtype_name(vt), n);
+  for (i = 0; i < icblen(prdb); ++i)
+    if (icbref(prdb, i)->id == id) return id;
+  pic = icbnewbk(prdb); pic->in = IN_REGDECL;
+  pic->id = id; pic->arg.u = vt;
+  return id;
+}
+
+/* collect functions with their signatures, address-taken functions and
+ * i32 globals with function refs they may hold */
+static void collect_funcrefs(wat_module_t* pm, buf_t *pfb, buf_t *ptb, buf_t *pgb)
+{
+  size_t i, j;
+  collect_funcsigs(pm, pfb);
+  for (i = 0; i < watieblen(&pm->exports); ++i) {
+    watie_t *pe = watiebref(&pm->exports, i);
+    if (pe->iek == IEK_GLOBAL && pe->vt == VT_I32 && !pe->exported) {
+      fpglob_t *pg = bufnewbk(pgb);
+      pg->mod = pe->mod; pg->id = pe->id; bufinit(&pg->refs, sizeof(fref_t));
+      pg->known = pe->ic.in == 0 || pe->ic.in == IN_REF_FUNC ||
+        (pe->ic.in == IN_I32_CONST && pe->ic.arg.i == 0);
     }
   }
-  
-  /* prepare dpmap for binary search */
-  bufqsort(&dpmap, &modid_cmp);
-  
-  /* patch IN_REF_{DATA,FUNC}s, memory export, zero globals */
+  bufqsort(pgb, &modid_cmp);
   for (i = 0; i < watieblen(&pm->exports); ++i) {
     watie_t *pe = watiebref(&pm->exports, i);
-    if (pe->iek == IEK_FUNC) {
+    if (pe->iek == IEK_GLOBAL && pe->ic.in == IN_REF_FUNC) {
+      fpglob_t *pg = bufbsearch(pgb, pe, &modid_cmp);
+      frefadd(ptb, pfb, pe->ic.arg2.mod, pe->ic.id);
+      if (pg) frefadd(&pg->refs, pfb, pe->ic.arg2.mod, pe->ic.id);
+    } else if (pe->iek == IEK_FUNC) {
+      for (j = 0; j < icblen(&pe->code); ++j) {
+        inscode_t *pic = icbref(&pe->code, j), *ppic = j > 0 ? pic-1 : NULL;
+        if (pic->in == IN_REF_FUNC) {
+          frefadd(ptb, pfb, pic->arg2.mod, pic->id);
+        } else if (pic->in == IN_GLOBAL_SET) {
+          fref_t e; fpglob_t *pg; e.mod = pic->arg2.mod; e.id = pic->id;
+          if (!(pg = bufbsearch(pgb, &e, &modid_cmp))) continue;
+          if (ppic && ppic->in == IN_REF_FUNC)
+            frefadd(&pg->refs, pfb, ppic->arg2.mod, ppic->id);
+          else if (!(ppic && ppic->in == IN_I32_CONST && ppic->arg.i == 0))
+            pg->known = false;
+        }
+      }
+    }
+  }
+}
+
+/* possible targets of call_indirect preceded by ppic instruction: refs
+ * of the global it gets the callee from or all address-taken functions;
+ * only ones with call's signature can be called */
+static buf_t *call_targets(const inscode_t *ppic, buf_t *ptb, buf_t *pgb)
+{
+  if (ppic && ppic->in == IN_GLOBAL_GET) {
+    fref_t e; fpglob_t *pg; e.mod = ppic->arg2.mod; e.id = ppic->id;
+    pg = bufbsearch(pgb, &e, &modid_cmp);
+    if (pg && pg->known) return &pg->refs;
+  }
+  return ptb;
+}
+
+static void fpglobbfini(buf_t *pgb)
+{
+  size_t i;
+  for (i = 0; i < buflen(pgb); ++i) buffini(&((fpglob_t*)bufref(pgb, i))->refs);
+  buffini(pgb);
+}
+
+/* link-time devirtualization of indirect calls: possible targets of a
+ * call_indirect are the address-taken functions of its signature or, if
+ * the callee comes from a global that only ever holds ref.funcs, the ones
+ * stored there; calls with one possible target become direct calls, and
+ * ones with two become a test and two direct calls; as before, calls via
+ * other values trap */
+static void devirtualize_wat_module(wat_module_t* pm)
+{
+  buf_t funcs = mkbuf(sizeof(fref_t)), taken = mkbuf(sizeof(fref_t));
+  buf_t fpglobs = mkbuf(sizeof(fpglob_t)); size_t i, j, k;
+  size_t ndirect = 0, nguarded = 0;
+  
+  /* collect possible targets of indirect calls */
+  collect_funcrefs(pm, &funcs, &taken, &fpglobs);
+
+  /* rewrite call sites with one or two possible targets */
+  for (i = 0; i < watieblen(&pm->exports); ++i) {
+    watie_t *pe = watiebref(&pm->exports, i);
+    icbuf_t rdb, icb; /* regdecls, code */
+    if (pe->iek != IEK_FUNC) continue;
+    icbinit(&rdb); icbinit(&icb);
+    for (j = 0; j < icblen(&pe->code); ++j) {
+      inscode_t *pic = icbref(&pe->code, j), *ppic = j > 0 ? pic-1 : NULL;
+      buf_t *ptb; fref_t *pt[2]; size_t nt = 0; funcsig_t *pfs;
+      if (pic->in == IN_REGDECL) { *icbnewbk(&rdb) = *pic; continue; }
+      if (pic->in != IN_CALL_INDIRECT || pic->id != 0) { *icbnewbk(&icb) = *pic; continue; }
+      ptb = call_targets(ppic, &taken, &fpglobs);
+      for (k = 0; k < buflen(ptb); ++k) {
+        fref_t *pf = bufref(ptb, k);
+        if (pf->fsi != pic->arg.u) continue;
+        if (nt == 2) { nt = 3; break; }
+        pt[nt++] = pf;
+      }
+      pfs = fsbref(&g_funcsigs, (size_t)pic->arg.u);
+      if (nt == 1) {
+        /* ref.func f; i32.ne; if; unreachable; end; call f */
+        inscode_t *pnic = icbnewbk(&icb); pnic->in = IN_REF_FUNC;
+        pnic->id = pt[0]->id; pnic->arg2.mod = pt[0]->mod;
+        icbnewbk(&icb)->in = IN_I32_NE;
+        pnic = icbnewbk(&icb); pnic->in = IN_IF; pnic->arg.u = BT_VOID;
+        icbnewbk(&icb)->in = IN_UNREACHABLE;
+        icbnewbk(&icb)->in = IN_END;
+        pnic = icbnewbk(&icb); pnic->in = IN_CALL;
+        pnic->id = pt[0]->id; pnic->arg2.mod = pt[0]->mod;
+        ++ndirect;
+      } else if (nt == 2 && vtblen(&pfs->restypes) <= 1) {
+        /* spill index and args to locals, test index and call either f1 or f2 */
+        size_t np = vtblen(&pfs->partypes), n, l; sym_t xid = dvlocal(VT_I32, 0, &rdb);
+        inscode_t *pnic = icbnewbk(&icb); pnic->in = IN_LOCAL_SET; pnic->id = xid;
+        for (n = np; n > 0; --n) {
+          valtype_t vt = *vtbref(&pfs->partypes, n-1); int m = 0;
+          for (l = 0; l < n-1; ++l) if (*vtbref(&pfs->partypes, l) == vt) ++m;
+          pnic = icbnewbk(&icb); pnic->in = IN_LOCAL_SET;
+          pnic->id = dvlocal(vt, m + (vt == VT_I32), &rdb);
+        }
+        for (k = 0; k < 2; ++k) {
+          pnic = icbnewbk(&icb); pnic->in = IN_LOCAL_GET; pnic->id = xid;
+          pnic = icbnewbk(&icb); pnic->in = IN_REF_FUNC;
+          pnic->id = pt[k]->id; pnic->arg2.mod = pt[k]->mod;
+          if (k == 0) {
+            icbnewbk(&icb)->in = IN_I32_EQ;
+            pnic = icbnewbk(&icb); pnic->in = IN_IF;
+            pnic->arg.u = vtblen(&pfs->restypes) ? *vtbref(&pfs->restypes, 0) : BT_VOID;
+          } else {
+            icbnewbk(&icb)->in = IN_I32_NE;
+            pnic = icbnewbk(&icb); pnic->in = IN_IF; pnic->arg.u = BT_VOID;
+            icbnewbk(&icb)->in = IN_UNREACHABLE;
+            icbnewbk(&icb)->in = IN_END;
+          }
+          for (n = 0; n < np; ++n) {
+            valtype_t vt = *vtbref(&pfs->partypes, n); int m = 0;
+            for (l = 0; l < n; ++l) if (*vtbref(&pfs->partypes, l) == vt) ++m;
+            pnic = icbnewbk(&icb); pnic->in = IN_LOCAL_GET;
+            pnic->id = dvlocal(vt, m + (vt == VT_I32), &rdb);
+          }
+          pnic = icbnewbk(&icb); pnic->in = IN_CALL;
+          pnic->id = pt[k]->id; pnic->arg2.mod = pt[k]->mod;
+          if (k == 0) icbnewbk(&icb)->in = IN_ELSE;
+        }
+        icbnewbk(&icb)->in = IN_END;
+        ++nguarded;
+      } else {
+        *icbnewbk(&icb) = *pic;
+      }
+    }
+    for (j = 0; j < icblen(&icb); ++j) *icbnewbk(&rdb) = *icbref(&icb, j);
+    memswap(&pe->code, &rdb, sizeof(icbuf_t));
+    icbfini(&rdb); icbfini(&icb);
+  }
+  if (ndirect + nguarded > 0)
+    logef("# devirtualized indirect calls: %d direct, %d guarded\n", (int)ndirect, (int)nguarded);
+
+  fpglobbfini(&fpglobs);
+  buffini(&taken);
+  buffini(&funcs);
+}
+
+/* put functions that can be called indirectly first into the table,
+ * followed by all other referenced ones; returns number of the former
+ * or SIZE_MAX if the table can't be compacted */
+static size_t compact_table(wat_module_t* pm, buf_t *ptable, hidx_t *pidx)
+{
+  buf_t funcs = mkbuf(sizeof(fref_t)), sigs = mkbuf(sizeof(unsigned));
+  size_t i, j, pass, tablen = SIZE_MAX; bool ok = g_optlvl > 0;
+  /* collect signatures of indirect calls; any other table use disables compaction */
+  for (i = 0; ok && i < watieblen(&pm->exports); ++i) {
+    watie_t *pe = watiebref(&pm->exports, i);
+    if (pe->iek != IEK_FUNC) continue;
+    for (j = 0; ok && j < icblen(&pe->code); ++j) {
+      inscode_t *pic = icbref(&pe->code, j);
+      if (pic->in == IN_CALL_INDIRECT || pic->in == IN_RETURN_CALL_INDIRECT) {
+        unsigned fsi = (unsigned)pic->arg.u;
+        if (pic->id != 0) ok = false;
+        else if (!bufsearch(&sigs, &fsi, &int_cmp)) *(unsigned*)bufnewbk(&sigs) = fsi;
+      } else if (pic->in == IN_TABLE_GET || pic->in == IN_TABLE_SET 
+        || (pic->in >= IN_TABLE_INIT && pic->in <= IN_TABLE_FILL)) {
+        ok = false;
+      }
+    }
+  }
+  if (ok) collect_funcsigs(pm, &funcs);
+  for (pass = 0; ok && pass < 2; ++pass) {
+    for (i = 0; i < watieblen(&pm->exports); ++i) {
+      watie_t *pe = watiebref(&pm->exports, i);
+      size_t n = pe->iek == IEK_FUNC ? icblen(&pe->code) : pe->iek == IEK_GLOBAL ? 1 : 0;
+      for (j = 0; j < n; ++j) {
+        inscode_t *pic = pe->iek == IEK_FUNC ? icbref(&pe->code, j) : &pe->ic;
+        fref_t e, *pf; bool callable;
+        if (pic->in != IN_REF_FUNC) continue;
+        e.mod = pic->arg2.mod; e.id = pic->id;
+        pf = bufbsearch(&funcs, &e, &modid_cmp);
+        callable = pf != NULL && bufsearch(&sigs, &pf->fsi, &int_cmp) != NULL;
+        if (callable == (pass == 0)) table_index(ptable, pidx, e.mod, e.id);
+      }
+    }
+    if (pass == 0) tablen = buflen(ptable);
+  }
+  buffini(&funcs);
+  buffini(&sigs);
+  return tablen;
+}
+
+/* remove IEK_UNKN elements in one pass (bufrem per element is quadratic) */
+static void watiebcompact(watiebuf_t *pb)
+{
+  size_t i, j;
+  for (i = j = 0; i < watieblen(pb); ++i) {
+    watie_t *pd = watiebref(pb, i);
+    if (pd->iek == IEK_UNKN) continue;
+    if (i != j) memcpy(watiebref(pb, j), pd, sizeof(watie_t));
+    ++j;
+  }
+  bufresize(pb, j);
+}
+
+/* pending patch of references in combined data */
+typedef struct dpatch {
+  size_t off;   /* offset of patched data in combined data */
+  icbuf_t code; /* ref.data/data.put_ref pairs */
+} dpatch_t;
+
+/* zero runs at least this long split the combined data segment */
+#define DSEG_ZRUN 32
+
+/* remove dependence on non-standard WAT features and instructions */
+size_t watify_wat_module(wat_module_t* pm)
+{
+  size_t curaddr = g_sdbaddr;
+  cbuf_t dseg = mkcb(); size_t i, j;
+  buf_t dpmap = mkbuf(sizeof(dpme_t));
+  buf_t table = mkbuf(sizeof(dpme_t));
+  buf_t patches = mkbuf(sizeof(dpatch_t));
+  dsmebuf_t dsmap, strmap; hidx_t dsmidx, tabidx; size_t tablen;
+  dsmebinit(&dsmap); dsmebinit(&strmap);
+  hidxinit(&dsmidx); hidxinit(&tabidx);
+  
+  /* reverse exports so leafs are processed before non-leafs */
+  bufrev(&pm->exports);
+
+  /* compact the table: functions that can't be called indirectly get
+   * ids past the end of it; comparisons of function pointers still work */
+  tablen = compact_table(pm, &table, &tabidx);
+  
+  /* collect read-only unaligned leafs (strings) to share suffixes */
+  for (i = 0; i < watieblen(&pm->exports); ++i) {
+    watie_t *pd = watiebref(&pm->exports, i);
+    if (pd->iek == IEK_DATA && pd->mut == MT_CONST && icblen(&pd->code) == 0 && pd->align == 1
+        && !data_all_zeroes(cbdata(&pd->data), cblen(&pd->data))) {
+      dsme_t *pe = dsmebnewbk(&strmap);
+      memswap(&pe->data, &pd->data, sizeof(cbuf_t));
+      pe->align = 1; pe->mod = pd->mod; pe->id = pd->id;
+      watiefini(pd); pd->iek = IEK_UNKN; /* drop it below */
+    }
+  }
+  watiebcompact(&pm->exports);
+
+  /* lay out strings: sorted backwards, each one is either a suffix
+   * of its successor (which contains all its other superstrings) or
+   * gets its own place */
+  bufqsort(&strmap, &dsme_rcmp);
+  for (j = dsmeblen(&strmap); j > 0; --j) {
+    dsme_t *pe = dsmebref(&strmap, j-1); dpme_t *pme;
+    dsme_t *pne = (j < dsmeblen(&strmap)) ? dsmebref(&strmap, j) : NULL;
+    if (pne != NULL && dsme_suffix(pe, pne)) {
+      pe->addr = pne->addr + (cblen(&pne->data) - cblen(&pe->data));
+    } else {
+      pe->addr = curaddr;
+      cbcat(&dseg, &pe->data);
+      curaddr += cblen(&pe->data);
+    }
+    pme = bufnewbk(&dpmap);
+    pme->mod = pe->mod; pme->id = pe->id;
+    pme->address = pe->addr;
+  }
+
+  /* concatenate initialized dss into one big data chunk; zero-only
+   * leafs (bss) are placed after it and take no space in the chunk */
+  for (i = 0; i < watieblen(&pm->exports); ++i) {
+    watie_t *pd = watiebref(&pm->exports, i);
+    if (pd->iek == IEK_DATA) {
+      dpme_t *pme; size_t addr;
+      if (icblen(&pd->code) == 0 && data_all_zeroes(cbdata(&pd->data), cblen(&pd->data))) {
+        continue; /* bss: leave it for the second pass */
+      }
+      vverbosef("converting dseg: %s:%s\n", symname(pd->mod), symname(pd->id));
+      if (pd->mut == MT_CONST && icblen(&pd->code) == 0) {
+        /* leaf, read-only: try to merge it with equals */
+        dsme_t e, *pe; unsigned long h; dsmeinit(&e); 
+        memswap(&e.data, &pd->data, sizeof(cbuf_t));
+        e.align = pd->align; assert(pd->align);
+        h = memhash(cbdata(&e.data), cblen(&e.data)) ^ (unsigned long)e.align;
+        pe = bufhsearch(&dsmap, &dsmidx, &e, h, &dsme_cmp);
+        if (!pe) { /* new data elt */
+          size_t align, n;
+          addr = curaddr;
+          pe = dsmebnewbk(&dsmap);
+          memswap(pe, &e, sizeof(dsme_t)); 
+          hidxadd(&dsmidx, h, dsmeblen(&dsmap)-1);
+          align = pd->align, n = addr % align;
+          if (n > 0) addr += align - n;
+          if (n > 0) bufresize(&dseg, buflen(&dseg) + (align-n));
+          cbcat(&dseg, &pe->data);
+          pe->addr = addr;
+          curaddr = addr + buflen(&pe->data);
+        } else {
+          addr = pe->addr;
+        }
+        dsmefini(&e);
+      } else {
+        /* non-leaf or read-write -- can't share */
+        size_t align, n;
+        addr = curaddr;
+        align = pd->align, n = addr % align;
+        if (n > 0) addr += align - n;
+        if (n > 0) bufresize(&dseg, buflen(&dseg) + (align-n));
+        if (icblen(&pd->code) > 0) { /* patch it when all addresses are known */
+          dpatch_t *pp = bufnewbk(&patches);
+          pp->off = cblen(&dseg); icbinit(&pp->code);
+          memswap(&pp->code, &pd->code, sizeof(icbuf_t));
+        }
+        cbcat(&dseg, &pd->data);
+        curaddr = addr + buflen(&pd->data);
+      }
+      pme = bufnewbk(&dpmap);
+      pme->mod = pd->mod; pme->id = pd->id;
+      pme->address = addr;
+      vverbosef("  addr = %u\n", (unsigned)addr);
+      watiefini(pd); pd->iek = IEK_UNKN; /* drop it below */
+    }
+  }
+  watiebcompact(&pm->exports);
+
+  /* lay out bss after initialized data; memory starts zeroed */
+  for (i = 0; i < watieblen(&pm->exports); ++i) {
+    watie_t *pd = watiebref(&pm->exports, i);
+    if (pd->iek == IEK_DATA) {
+      dpme_t *pme; size_t align = pd->align, n = curaddr % align;
+      vverbosef("converting bss dseg: %s:%s\n", symname(pd->mod), symname(pd->id));
+      if (n > 0) curaddr += align - n;
+      pme = bufnewbk(&dpmap);
+      pme->mod = pd->mod; pme->id = pd->id;
+      pme->address = curaddr;
+      vverbosef("  addr = %u\n", (unsigned)curaddr);
+      curaddr += buflen(&pd->data);
+      watiefini(pd); pd->iek = IEK_UNKN; /* drop it below */
+    }
+  }
+  watiebcompact(&pm->exports);
+  
+  /* prepare dpmap for binary search */
+  bufqsort(&dpmap, &modid_cmp);
+
+  /* patch references in combined data */
+  for (i = 0; i < buflen(&patches); ++i) {
+    dpatch_t *pp = bufref(&patches, i);
+    cbuf_t cb = mkcb(); bool gotarg = false;
+    for (j = 0; j < icblen(&pp->code); ++j) {
+      modid_t mi; dpme_t *pdpme; size_t off; 
+      inscode_t *pic = icbref(&pp->code, j);
+      if (!gotarg && pic->in == IN_REF_DATA) {
+        unsigned address;
+        mi.mod = pic->arg2.mod; mi.id = pic->id;
+        pdpme = bufbsearch(&dpmap, &mi, &modid_cmp);
+        if (!pdpme) eprintf("internal error: undefined ref in data: $%s:%s", 
+          mi.mod ? symname(mi.mod) : "?", mi.id ? symname(mi.id) : "?");
+        address = (unsigned)((long long)pdpme->address + pic->arg.i);
+        bufclear(&cb); binuint(address, &cb); /* wasm32 */
+        gotarg = true;
+      } else if (gotarg && pic->in == IN_DATA_PUT_REF) {
+        off = pp->off + (size_t)pic->arg.u; assert(pic->id == 0);
+        if (off % 4 != 0 || off + 4 > cblen(&dseg)) /* wasm32 */
+          eprintf("internal error: cannot patch data: bad offset %lu", (unsigned long)off);
+        memcpy(cbdata(&dseg) + off, cbdata(&cb), 4); /* wasm32 */
+        gotarg = false;
+      } else {
+        eprintf("internal error in data patch");
+      }
+    }
+    cbfini(&cb);
+    icbfini(&pp->code);
+  }
+  
+  /* patch IN_REF_{DATA,FUNC}s, memory export, zero globals */
+  for (i = 0; i < watieblen(&pm->exports); ++i) {
+    watie_t *pe = watiebref(&pm->exports, i);
+    if (pe->iek == IEK_FUNC) {
       watie_t *pf = pe; size_t j;
       for (j = 0; j < icblen(&pf->code); ++j) {
         inscode_t *pic = icbref(&pf->code, j);
@@ -4069,12 +5131,9 @@ size_t watify_wat_module(wat_module_t* pm)
           pic->in = IN_I32_CONST;
           pic->arg.i = (long long)pdpme->address + pic->arg.i;
         } else if (pic->in == IN_REF_FUNC) {
-          dpme_t e, *pdpme;
-          e.mod = pic->arg2.mod; e.id = pic->id;
-          pdpme = bufsearch(&table, &e, &modid_cmp);
-          if (!pdpme) { pdpme = bufnewbk(&table); *pdpme = e; }
+          size_t k = table_index(&table, &tabidx, pic->arg2.mod, pic->id);
           pic->in = IN_I32_CONST;
-          pic->arg.i = (long long)bufoff(&table, pdpme) + 1; /* elem #0 reserved */
+          pic->arg.i = (long long)k;
         }
       }
     } else if (pe->iek == IEK_GLOBAL) {
@@ -4096,43 +5155,449 @@ size_t watify_wat_module(wat_module_t* pm)
         pe->ic.in = IN_I32_CONST;
         pe->ic.arg.i = (long long)pdpme->address + pe->ic.arg.i;
       } else if (pe->ic.in == IN_REF_FUNC) {
-        dpme_t e, *pdpme;
-        e.mod = pe->ic.arg2.mod; e.id = pe->ic.id;
-        pdpme = bufsearch(&table, &e, &modid_cmp);
-        if (!pdpme) { pdpme = bufnewbk(&table); *pdpme = e; }
+        size_t k = table_index(&table, &tabidx, pe->ic.arg2.mod, pe->ic.id);
         pe->ic.in = IN_I32_CONST;
-        pe->ic.arg.i = (long long)bufoff(&table, pdpme) + 1; /* elem #0 reserved */
+        pe->ic.arg.i = (long long)k;
       }
     }
   }
     
-  /* add combined data segment */
-  if (buflen(&dpmap) > 0) {
-    watie_t *pd = watiebnewbk(&pm->exports, IEK_DATA);
-    memswap(&pd->data, &dseg, sizeof(buf_t));
-    pd->align = 0; /* means ds is final */
-    pd->ic.in = IN_I32_CONST; /* wasm32 address */
-    pd->ic.arg.u = g_sdbaddr;
+  /* add combined data as segments separated by long zero runs */
+  for (i = 0; i < cblen(&dseg); /* bumpi */) {
+    char *pc = cbdata(&dseg); size_t n = cblen(&dseg), zn = 0;
+    for (j = i; j < n && zn < DSEG_ZRUN; ++j) zn = pc[j] ? 0 : zn + 1;
+    j -= zn; /* drop long zero run or trailing zeroes */
+    if (j > i) { 
+      watie_t *pd = watiebnewbk(&pm->exports, IEK_DATA);
+      cbput(pc + i, j - i, &pd->data);
+      pd->align = 0; /* means ds is final */
+      pd->ic.in = IN_I32_CONST; /* wasm32 address */
+      pd->ic.arg.u = g_sdbaddr + i;
+    }
+    for (i = j; i < n && !pc[i]; ++i) /* skip zeroes */;
   }
   
   /* always add table, even if it is empty! */
   if (true) {
     watie_t *pt = watiebnewbk(&pm->exports, IEK_TABLE);
     memswap(&pt->table, &table, sizeof(buf_t));
+    if (tablen < buflen(&pt->table)) bufresize(&pt->table, tablen);
     pt->n = pt->m = (unsigned)buflen(&pt->table) + 1;
     pt->lt = LT_MINMAX;
   }
   
   cbfini(&dseg);
   dsmebfini(&dsmap);
+  dsmebfini(&strmap);
+  hidxfini(&dsmidx);
+  hidxfini(&tabidx);
   buffini(&dpmap);
   buffini(&table);
+  buffini(&patches);
   
   /* return absolute address of dseg's end */
   return curaddr;
 }
 
+/* WASI threads instantiate the module once per thread: memory is imported
+ * (and re-exported), and data segments become passive, to be copied into
+ * memory by _start() of the main thread only */
+static void share_wat_module_memory(wat_module_t* pm)
+{
+  size_t i, j, k; sym_t startid = intern("_start"), tsid = intern("thread_spawn");
+  icbuf_t icb; inscode_t *pic;
+  for (i = 0; i < watieblen(&pm->exports); ++i) {
+    watie_t *pe = watiebref(&pm->exports, i), *pi;
+    if (pe->iek != IEK_MEM) continue;
+    pi = watiebnewbk(&pm->imports, IEK_MEM);
+    pi->mod = intern("env"); pi->id = pe->id; pi->exported = true;
+    pi->lt = LT_MINMAX_SHARED; pi->n = pe->n; pi->m = pe->m;
+    watiebdel(&pm->exports, IEK_MEM, pe->mod, pe->id);
+    break;
+  }
+  icbinit(&icb);
+  for (i = k = 0; i < watieblen(&pm->exports); ++i) {
+    watie_t *pd = watiebref(&pm->exports, i);
+    if (pd->iek != IEK_DATA) continue;
+    assert(!pd->align); assert(pd->ic.in == IN_I32_CONST);
+    pd->passive = true;
+    pic = icbnewbk(&icb); pic->in = IN_I32_CONST; pic->arg.u = pd->ic.arg.u;
+    pic = icbnewbk(&icb); pic->in = IN_I32_CONST; pic->arg.u = 0;
+    pic = icbnewbk(&icb); pic->in = IN_I32_CONST; pic->arg.u = buflen(&pd->data);
+    pic = icbnewbk(&icb); pic->in = IN_MEMORY_INIT; pic->arg.u = k;
+    pic = icbnewbk(&icb); pic->in = IN_DATA_DROP; pic->arg.u = k;
+    ++k;
+  }
+  for (i = 0; i < watieblen(&pm->exports); ++i) {
+    watie_t *pf = watiebref(&pm->exports, i);
+    if (pf->iek == IEK_FUNC && pf->id == startid && pf->exported) {
+      bufcat(&icb, &pf->code);
+      bufswap(&icb, &pf->code);
+      break;
+    }
+  }
+  icbfini(&icb);
+  /* WASI threads import is "thread-spawn", not a C name */
+  for (i = 0; i < watieblen(&pm->imports); ++i) {
+    watie_t *pi = watiebref(&pm->imports, i);
+    if (pi->iek == IEK_FUNC && pi->mod == g_wasit_mod && pi->id == tsid) {
+      sym_t nid = intern("thread-spawn");
+      pi->id = nid;
+      for (k = 0; k < watieblen(&pm->exports); ++k) {
+        watie_t *pf = watiebref(&pm->exports, k);
+        if (pf->iek != IEK_FUNC) continue;
+        for (j = 0; j < icblen(&pf->code); ++j) {
+          pic = icbref(&pf->code, j);
+          if ((pic->in == IN_CALL || pic->in == IN_RETURN_CALL) && pic->arg2.mod == g_wasit_mod && pic->id == tsid)
+            pic->id = nid;
+        }
+      }
+      break;
+    }
+  }
+}
+
 /* patch initial stack pointer and memory size */
+/* stack usage analysis: sp$-relative values are tracked through the
+ * operand stack, locals and sp$ itself; frames, fixed allocas and vararg
+ * frames all lower sp$ by multiples of 16, while dynamic allocas lower
+ * it by a value rounded to 16 via & -16 */
+
+/* abstract i32 value */
+typedef enum avkind { 
+  AV_OTHER, AV_CONST, AV_SP, AV_ALIGNED 
+} avkind_t;
+
+typedef struct absval {
+  avkind_t k;  /* AV_XXX */
+  long long v; /* CONST: value, SP: offset below sp$ on entry */
+} absval_t;
+
+/* abstract value of a local */
+typedef struct locav {
+  sym_t id; absval_t av;
+} locav_t;
+
+/* open block: loops remember stack depth on entry */
+typedef struct stkblk {
+  instr_t in; long long depth;
+} stkblk_t;
+
+/* call site: callee and sp$ offset at the call or -1 */
+typedef struct scall {
+  size_t fi; long long off;
+} scall_t;
+
+/* function's stack usage */
+typedef struct sfinfo {
+  sym_t mod, id;   /* mod:id; used for sorting */
+  watie_t *pf;     /* definition or NULL for imports */
+  size_t frame;    /* own usage in bytes */
+  size_t total;    /* worst case usage with callees */
+  size_t next;     /* callee on worst case path or SIZE_MAX */
+  int state;       /* 0: new, 1: being walked, 2: done */
+  bool dynalloc;   /* alloca of unknown size or in a loop */
+  bool recursive;  /* closes a call cycle */
+  bool unbounded;  /* usage with callees is unbounded */
+  buf_t calls;     /* scall_t */
+} sfinfo_t;
+
+static void avpush(buf_t *pvb, avkind_t k, long long v)
+{
+  absval_t *pav = bufnewbk(pvb); pav->k = k; pav->v = v;
+}
+
+static void avpop(buf_t *pvb, absval_t *pav)
+{
+  if (buflen(pvb) > 0) *pav = *(absval_t*)bufpopbk(pvb);
+  else { pav->k = AV_OTHER; pav->v = 0; }
+}
+
+static locav_t *locavref(buf_t *plb, sym_t id)
+{
+  size_t i;
+  for (i = 0; i < buflen(plb); ++i) {
+    locav_t *pl = bufref(plb, i);
+    if (pl->id == id) return pl;
+  }
+  return NULL;
+}
+
+static void locavset(buf_t *plb, sym_t id, const absval_t *pav)
+{
+  locav_t *pl = locavref(plb, id);
+  if (!pl) { pl = bufnewbk(plb); pl->id = id; }
+  pl->av = *pav;
+}
+
+/* current stack depth: deepest of sp$ and its local copies in phb */
+static long long stack_depth(const absval_t *pg, buf_t *plb, buf_t *phb)
+{
+  long long d = pg->k == AV_SP ? pg->v : -1; size_t i;
+  for (i = 0; i < buflen(plb); ++i) {
+    locav_t *pl = bufref(plb, i);
+    if (pl->av.k == AV_SP && pl->av.v > d && bufsearch(phb, &pl->id, &sym_cmp) != NULL)
+      d = pl->av.v;
+  }
+  return d;
+}
+
+/* scan function's code, collecting its frame size and call sites; if limit
+ * is not 0, add a check that traps when sp$ goes below it after each sp$ 
+ * decrement */
+static void stack_scan_func(sfinfo_t *psi, buf_t *psib, buf_t *ptb, buf_t *pgb, size_t limit)
+{
+  icbuf_t *pcb = &psi->pf->code, icb; size_t i, j, nchecks = 0, scdi = 0;
+  buf_t vb = mkbuf(sizeof(absval_t)), lb = mkbuf(sizeof(locav_t));
+  buf_t bb = mkbuf(sizeof(stkblk_t)), hb = mkbuf(sizeof(sym_t)); 
+  absval_t g, a, b; sym_t scid = intern("sc$"); inscode_t *pic;
+  g.k = AV_SP; g.v = 0;
+  /* locals holding sp$ itself: loaded from it or stored back to it */
+  for (i = 1; i < icblen(pcb); ++i) {
+    inscode_t *ppic = icbref(pcb, i-1); pic = icbref(pcb, i);
+    if (ppic->in == IN_GLOBAL_GET && ppic->id == g_sp_id && ppic->arg2.mod == g_crt_mod &&
+        (pic->in == IN_LOCAL_SET || pic->in == IN_LOCAL_TEE)) 
+      *(sym_t*)bufnewbk(&hb) = pic->id;
+    else if (ppic->in == IN_LOCAL_GET && pic->in == IN_GLOBAL_SET && 
+        pic->id == g_sp_id && pic->arg2.mod == g_crt_mod)
+      *(sym_t*)bufnewbk(&hb) = ppic->id;
+  }
+  icbinit(&icb); bufclear(&psi->calls); psi->frame = 0; psi->dynalloc = false;
+  for (i = 0; i < icblen(pcb); ++i) {
+    inscode_t ic = *icbref(pcb, i); bool dec = false;
+    if (limit > 0 && ic.in != IN_REGDECL && scdi == 0) {
+      scdi = icblen(&icb) + 1; /* +1: 0 means not yet */
+      pic = icbnewbk(&icb); pic->in = IN_REGDECL; pic->id = scid; pic->arg.u = VT_I32;
+    }
+    switch (ic.in) {
+      case IN_REGDECL: break;
+      case IN_GLOBAL_GET: 
+        if (ic.id == g_sp_id && ic.arg2.mod == g_crt_mod) avpush(&vb, g.k, g.v);
+        else avpush(&vb, AV_OTHER, 0);
+        break;
+      case IN_GLOBAL_SET:
+        avpop(&vb, &a);
+        if (ic.id == g_sp_id && ic.arg2.mod == g_crt_mod) g = a;
+        break;
+      case IN_LOCAL_GET: {
+        locav_t *pl = locavref(&lb, ic.id);
+        if (pl) avpush(&vb, pl->av.k, pl->av.v); else avpush(&vb, AV_OTHER, 0);
+      } break;
+      case IN_LOCAL_SET: case IN_LOCAL_TEE:
+        avpop(&vb, &a);
+        locavset(&lb, ic.id, &a);
+        if (ic.in == IN_LOCAL_TEE) avpush(&vb, a.k, a.v);
+        break;
+      case IN_I32_CONST: /* sign-extend: some are kept as unsigned */
+        avpush(&vb, AV_CONST, (long long)(int)ic.arg.i);
+        break;
+      case IN_I32_ADD:
+        avpop(&vb, &b); avpop(&vb, &a);
+        if (a.k == AV_SP && b.k == AV_CONST && b.v % 16 == 0) avpush(&vb, AV_SP, a.v - b.v);
+        else avpush(&vb, AV_OTHER, 0);
+        break;
+      case IN_I32_SUB:
+        avpop(&vb, &b); avpop(&vb, &a);
+        if (a.k == AV_SP && b.k == AV_CONST && b.v > 0 && b.v % 16 == 0) {
+          avpush(&vb, AV_SP, a.v + b.v); dec = true;
+          if ((size_t)(a.v + b.v) > psi->frame) psi->frame = (size_t)(a.v + b.v);
+        } else if (a.k == AV_SP && b.k == AV_ALIGNED) {
+          avpush(&vb, AV_OTHER, 0); dec = true;
+          psi->dynalloc = true;
+        } else avpush(&vb, AV_OTHER, 0);
+        break;
+      case IN_I32_AND:
+        avpop(&vb, &b); avpop(&vb, &a);
+        avpush(&vb, (b.k == AV_CONST && b.v == -16) ? AV_ALIGNED : AV_OTHER, 0);
+        break;
+      case IN_CALL: case IN_RETURN_CALL: 
+      case IN_CALL_INDIRECT: case IN_RETURN_CALL_INDIRECT: {
+        scall_t *pc; sfinfo_t e, *pci;
+        if (ic.in == IN_CALL || ic.in == IN_RETURN_CALL) {
+          e.mod = ic.arg2.mod; e.id = ic.id;
+          pci = bufbsearch(psib, &e, &modid_cmp); 
+          if (pci) {
+            pc = bufnewbk(&psi->calls); pc->fi = bufoff(psib, pci);
+            pc->off = g.k == AV_SP ? g.v : -1;
+          }
+        } else {
+          buf_t *ptgb = call_targets(i > 0 ? icbref(pcb, i-1) : NULL, ptb, pgb);
+          for (j = 0; j < buflen(ptgb); ++j) {
+            fref_t *pf = bufref(ptgb, j);
+            if (pf->fsi != (unsigned)ic.arg.u) continue;
+            e.mod = pf->mod; e.id = pf->id;
+            pci = bufbsearch(psib, &e, &modid_cmp); 
+            if (!pci) continue;
+            pc = bufnewbk(&psi->calls); pc->fi = bufoff(psib, pci);
+            pc->off = g.k == AV_SP ? g.v : -1;
+          }
+        }
+        bufclear(&vb);
+      } break;
+      case IN_BLOCK: case IN_LOOP: case IN_IF: {
+        stkblk_t *pb = bufnewbk(&bb); 
+        pb->in = ic.in; pb->depth = ic.in == IN_LOOP ? stack_depth(&g, &lb, &hb) : -1;
+        bufclear(&vb);
+      } break;
+      case IN_END: {
+        stkblk_t *pb = buflen(&bb) > 0 ? bufpopbk(&bb) : NULL;
+        /* stack going down in loops means unbounded allocas */
+        if (pb && pb->in == IN_LOOP && pb->depth >= 0 && stack_depth(&g, &lb, &hb) > pb->depth) 
+          psi->dynalloc = true;
+        bufclear(&vb);
+      } break;
+      default:
+        bufclear(&vb);
+    }
+    *icbnewbk(&icb) = ic;
+    if (dec && limit > 0) { /* local.tee sc$; (i32.const limit; i32.lt_u; if; unreachable; end); local.get sc$ */
+      pic = icbnewbk(&icb); pic->in = IN_LOCAL_TEE; pic->id = scid;
+      pic = icbnewbk(&icb); pic->in = IN_I32_CONST; pic->arg.i = (long long)limit;
+      icbnewbk(&icb)->in = IN_I32_LT_U;
+      pic = icbnewbk(&icb); pic->in = IN_IF; pic->arg.u = BT_VOID;
+      icbnewbk(&icb)->in = IN_UNREACHABLE;
+      icbnewbk(&icb)->in = IN_END;
+      pic = icbnewbk(&icb); pic->in = IN_LOCAL_GET; pic->id = scid;
+      ++nchecks;
+    }
+  }
+  if (limit > 0) {
+    if (nchecks == 0 && scdi > 0) bufrem(&icb, scdi-1);
+    memswap(pcb, &icb, sizeof(icbuf_t));
+  }
+  icbfini(&icb);
+  buffini(&vb);
+  buffini(&lb);
+  buffini(&bb);
+  buffini(&hb);
+}
+
+/* calculate worst case stack usage of fi function and its callees */
+static void stack_walk_func(buf_t *psib, size_t fi)
+{
+  sfinfo_t *psi = bufref(psib, fi); size_t i;
+  if (psi->state != 0) return;
+  psi->state = 1; psi->total = psi->frame; psi->next = SIZE_MAX;
+  psi->unbounded = psi->dynalloc;
+  for (i = 0; i < buflen(&psi->calls); ++i) {
+    scall_t *pc = bufref(&psi->calls, i);
+    sfinfo_t *pci = bufref(psib, pc->fi); size_t off;
+    if (pci->state == 1) { /* call cycle */
+      psi->recursive = psi->unbounded = true;
+      continue;
+    }
+    stack_walk_func(psib, pc->fi);
+    off = pc->off >= 0 ? (size_t)pc->off : psi->frame;
+    if (off + pci->total > psi->total) {
+      psi->total = off + pci->total; psi->next = pc->fi;
+    }
+    if (pci->unbounded) psi->unbounded = true;
+  }
+  psi->state = 2;
+}
+
+/* print worst case path from fi function */
+static void stack_path(buf_t *psib, size_t fi, FILE *fp)
+{
+  size_t n = 0;
+  while (fi != SIZE_MAX && n++ < buflen(psib)) {
+    sfinfo_t *psi = bufref(psib, fi);
+    fprintf(fp, "%s%s:%s", n > 1 ? " > " : "", symname(psi->mod), symname(psi->id));
+    fi = psi->next;
+  }
+}
+
+/* analyze stack usage of functions called from _start(); report it and
+ * size the stack if asked to by g_stkreport/g_stkauto options */
+static void stack_wat_module(wat_module_t* pm)
+{
+  buf_t sib = mkbuf(sizeof(sfinfo_t)), funcs = mkbuf(sizeof(fref_t));
+  buf_t taken = mkbuf(sizeof(fref_t)), fpglobs = mkbuf(sizeof(fpglob_t));
+  sym_t startid = intern("_start"); size_t i, starti = SIZE_MAX;
+  
+  /* collect functions; imported ones use no stack */
+  collect_funcrefs(pm, &funcs, &taken, &fpglobs);
+  for (i = 0; i < watieblen(&pm->imports); ++i) {
+    watie_t *pi = watiebref(&pm->imports, i); sfinfo_t *psi;
+    if (pi->iek != IEK_FUNC) continue;
+    psi = bufnewbk(&sib); memset(psi, 0, sizeof(sfinfo_t));
+    psi->mod = pi->mod; psi->id = pi->id; bufinit(&psi->calls, sizeof(scall_t));
+  }
+  for (i = 0; i < watieblen(&pm->exports); ++i) {
+    watie_t *pe = watiebref(&pm->exports, i); sfinfo_t *psi;
+    if (pe->iek != IEK_FUNC) continue;
+    psi = bufnewbk(&sib); memset(psi, 0, sizeof(sfinfo_t));
+    psi->mod = pe->mod; psi->id = pe->id; bufinit(&psi->calls, sizeof(scall_t));
+    psi->pf = pe;
+  }
+  bufqsort(&sib, &modid_cmp);
+  
+  /* calculate stack usage */
+  for (i = 0; i < buflen(&sib); ++i) {
+    sfinfo_t *psi = bufref(&sib, i);
+    if (psi->pf) stack_scan_func(psi, &sib, &taken, &fpglobs, 0);
+    if (psi->pf && psi->pf->exported && psi->id == startid) starti = i;
+  }
+  for (i = 0; i < buflen(&sib); ++i) stack_walk_func(&sib, i);
+
+  if (g_stkreport) {
+    fprintf(stderr, "stack usage in bytes:\n%10s %10s  %s\n", "frame", "total", "function");
+    for (i = 0; i < buflen(&sib); ++i) {
+      sfinfo_t *psi = bufref(&sib, i);
+      if (!psi->pf) continue;
+      fprintf(stderr, "%10lu %9lu%c  %s:%s%s%s\n", (unsigned long)psi->frame,
+        (unsigned long)psi->total, psi->unbounded ? '+' : ' ', 
+        symname(psi->mod), symname(psi->id), psi->recursive ? " (recursive)" : "", 
+        psi->dynalloc ? " (alloca)" : "");
+    }
+  }
+  if (starti != SIZE_MAX) {
+    sfinfo_t *psi = bufref(&sib, starti);
+    if (g_stkreport) {
+      fprintf(stderr, "worst case: %lu%s bytes via ", 
+        (unsigned long)psi->total, psi->unbounded ? "+" : "");
+      stack_path(&sib, starti, stderr);
+      fprintf(stderr, "\n");
+    }
+    if (g_stkauto && !psi->unbounded) {
+      g_stacksz = (psi->total + 15) & ~(size_t)15;
+      if (g_stacksz == 0) g_stacksz = 16;
+      logef("# stack size set to %lu bytes\n", (unsigned long)g_stacksz);
+    } else if (g_stkauto) {
+      nwprintf(NULL, "warning: stack usage is unbounded due to recursion or alloca; "
+        "using stack size of %lu bytes", (unsigned long)g_stacksz);
+    } else if (!psi->unbounded && psi->total > g_stacksz) {
+      nwprintf(NULL, "warning: worst case stack usage of %lu bytes exceeds stack size "
+        "of %lu bytes", (unsigned long)psi->total, (unsigned long)g_stacksz);
+    }
+  }
+  
+  for (i = 0; i < buflen(&sib); ++i) buffini(&((sfinfo_t*)bufref(&sib, i))->calls);
+  buffini(&sib);
+  buffini(&funcs);
+  buffini(&taken);
+  fpglobbfini(&fpglobs);
+}
+
+/* stack grows down from stack_base to the end of data at dsegend: add
+ * checks for its lower limit after each decrement of sp$ */
+static void stack_check_wat_module(wat_module_t* pm, size_t dsegend)
+{
+  size_t i, spaddr = (dsegend + g_stacksz + 15) & ~(size_t)15; 
+  buf_t sib = mkbuf(sizeof(sfinfo_t)), tb = mkbuf(sizeof(fref_t)), gb = mkbuf(sizeof(fpglob_t));
+  sfinfo_t si; memset(&si, 0, sizeof(sfinfo_t)); bufinit(&si.calls, sizeof(scall_t));
+  for (i = 0; i < watieblen(&pm->exports); ++i) {
+    watie_t *pe = watiebref(&pm->exports, i);
+    if (pe->iek != IEK_FUNC) continue;
+    si.pf = pe; 
+    stack_scan_func(&si, &sib, &tb, &gb, spaddr - g_stacksz);
+  }
+  buffini(&si.calls);
+  buffini(&sib);
+  buffini(&tb);
+  buffini(&gb);
+}
+
 static void finalize_wat_module(wat_module_t* pm, size_t dsegend)
 {
   size_t i, n, align, spaddr, hpaddr, ememaddr, mempages;
@@ -4143,6 +5608,13 @@ static void finalize_wat_module(wat_module_t* pm, size_t dsegend)
   ememaddr = hpaddr; align = 64*1024; /* page = 64K */
   n = ememaddr % align; if (n > 0) ememaddr += align - n;
   mempages = ememaddr/align;
+  if (g_imempg > 0) {
+    if (g_imempg < mempages) 
+      eprintf("initial memory is too small: %lu bytes needed", (unsigned long)ememaddr);
+    mempages = g_imempg;
+  }
+  if (g_mmempg > 0 && g_mmempg < mempages)
+    eprintf("maximum memory is too small: %lu bytes needed", (unsigned long)ememaddr);
   for (i = 0; i < watieblen(&pm->exports); ++i) {
     watie_t *pe = watiebref(&pm->exports, i);
     if (pe->iek == IEK_GLOBAL) {
@@ -4162,18 +5634,22 @@ static void finalize_wat_module(wat_module_t* pm, size_t dsegend)
     } else if (pe->iek == IEK_MEM) {
       if (pe->mod == g_crt_mod && pe->id == g_lm_id) {
         pe->n = (unsigned)mempages;
+        if (g_mmempg > 0) { pe->lt = LT_MINMAX; pe->m = (unsigned)g_mmempg; }
         /* it seems to be required that mem is exported as "memory" */
         pe->id = intern("memory"); pe->exported = true;
       }
     }
   }  
+  if (g_sharedmem) share_wat_module_memory(pm);
 }
 
 void link_wat_modules(wat_module_buf_t *pwb, wat_module_t* pm)
 {
   size_t i, j; main_t mt = MAIN_ABSENT;
   sym_t mainid = intern("main"), startid = intern("_start"); 
+  sym_t wtsid = intern("wasi_thread_start"), wtsmod = 0;
   sym_t mainmod = 0, envmod = 0, startmod = 0; 
+  modid_t tsmi; 
   buf_t curmodnames = mkbuf(sizeof(sym_t)); /* in pwb */
   buf_t extmodnames = mkbuf(sizeof(sym_t)); /* not in pwb */
   buf_t depglobals = mkbuf(sizeof(modid_t));
@@ -4221,6 +5697,9 @@ void link_wat_modules(wat_module_buf_t *pwb, wat_module_t* pm)
       if (*pmn == g_wasi_mod) {
         logef("# found WASI subsystem dependence: '%s' module\n", symname(g_wasi_mod));
         /* nothing to load  */
+      } else if (*pmn == g_wasit_mod) {
+        logef("# found WASI threads subsystem dependence: '%s' module\n", symname(g_wasit_mod));
+        /* nothing to load  */
       } else {
         sym_t rtn = *pmn; wat_module_t* pnewm;
         if (rtn == g_crt_mod) {
@@ -4232,7 +5711,9 @@ void link_wat_modules(wat_module_buf_t *pwb, wat_module_t* pm)
           envmod = rtn;
         }
         logef("# found library dependence: '%s' module\n", symname(rtn));
+        phbeg("load");
         load_library_wat_module(rtn, (pnewm = wat_module_buf_newbk(pwb)));
+        phend();
         if (pnewm->main != MAIN_ABSENT)
           eprintf("unexpected main() in library module '%s'", symname(rtn)); 
         /* trace sub-dependencies */
@@ -4244,6 +5725,8 @@ void link_wat_modules(wat_module_buf_t *pwb, wat_module_t* pm)
       }
     }
   }
+  /* all library modules are in: inflated archive entries are not needed */
+  mcachetrim();
   
   /* first, sort modules by module name for bsearch */
   bufqsort(pwb, &sym_cmp);
@@ -4253,8 +5736,23 @@ void link_wat_modules(wat_module_buf_t *pwb, wat_module_t* pm)
     bufqsort(&pmi->imports, &modid_cmp);    
     bufqsort(&pmi->exports, &modid_cmp);    
   }
+  /* make sure imported functions have the expected signatures */
+  for (i = 0; i < wat_module_buf_len(pwb); ++i) {
+    wat_module_t* pmi = wat_module_buf_ref(pwb, i);
+    for (j = 0; j < watieblen(&pmi->imports); ++j) {
+      watie_t *pi = watiebref(&pmi->imports, j), *pe; wat_module_t* pmj;
+      if (pi->iek != IEK_FUNC) continue;
+      if (!(pmj = bufbsearch(pwb, &pi->mod, &sym_cmp))) continue;
+      pe = bufbsearch(&pmj->exports, pi, &modid_cmp);
+      if (pe && pe->iek == IEK_FUNC && !sameft(&pi->fs, &pe->fs))
+        eprintf("function '%s' in '%s' module has a signature unexpected in '%s' module "
+          "(modules compiled with different --multi-value settings?)", 
+          symname(pi->id), symname(pi->mod), symname(pmi->name));
+    }
+  }
 
   /* now seed depglobals and use it to move globals to pm */
+  tsmi.mod = g_wasit_mod; tsmi.id = intern("thread_spawn"); tsmi.iek = IEK_FUNC;
   pmodid = bufnewbk(&depglobals); 
   pmodid->mod = mainmod; pmodid->id = mainid; pmodid->iek = IEK_FUNC;
   pmodid = bufnewbk(&depglobals); 
@@ -4269,6 +5767,19 @@ void link_wat_modules(wat_module_buf_t *pwb, wat_module_t* pm)
     /* precondition: this global is not moved yet */
     modid_t *pmii = bufref(&depglobals, i);
     process_depglobal(pmii, pwb, &depglobals, pm);
+    /* spawned threads start in wasi_thread_start(), so it is a dependence too */
+    if (i+1 == buflen(&depglobals) && !wtsmod && bufsearch(&pm->imports, &tsmi, &modid_cmp) != NULL) {
+      for (j = 0; j < wat_module_buf_len(pwb) && !wtsmod; ++j) {
+        wat_module_t* pmj = wat_module_buf_ref(pwb, j);
+        modid_t mi; mi.mod = pmj->name; mi.id = wtsid; mi.iek = IEK_FUNC;
+        if (bufbsearch(&pmj->exports, &mi, &modid_cmp)) {
+          wtsmod = pmj->name;
+          *(modid_t*)bufnewbk(&depglobals) = mi;
+        }
+      }
+      if (!wtsmod) eprintf("wasi_thread_start() function not found");
+      if (!g_sharedmem) eprintf("thread creation requires --shared-memory option");
+    }
   }
 
   /* pass over output module functions to check for _start */
@@ -4285,14 +5796,40 @@ void link_wat_modules(wat_module_buf_t *pwb, wat_module_t* pm)
   }
   if (!startmod) eprintf("_start() function not found");
   else logef("# found _start() function in '%s' module\n", symname(startmod));
+  if (wtsmod) {
+    for (i = 0; i < watieblen(&pm->exports); ++i) {
+      watie_t *pe = watiebref(&pm->exports, i);
+      if (pe->iek == IEK_FUNC && pe->id == wtsid) pe->exported = true;
+    }
+    logef("# found wasi_thread_start() function in '%s' module\n", symname(wtsmod));
+  }
 
   if (getverbosity() > 0) {
     fprintf(stderr, "linked module before watify:\n");
     write_wat_module(pm, stderr);
   }
   
+  /* turn indirect calls with known targets into direct calls */
+  if (g_optlvl > 0) {
+    phbeg("devirtualize");
+    devirtualize_wat_module(pm);
+    phend();
+  }
+
+  /* analyze stack usage if asked to; may change g_stacksz */
+  if (g_stkauto || g_stkreport) {
+    phbeg("stack");
+    stack_wat_module(pm);
+    phend();
+  }
+
   /* remove dependence on non-standard WAT features and instructions */
+  phbeg("watify");
   dsegend = watify_wat_module(pm);
+  phend();
+  
+  /* add stack overflow checks if asked to */
+  if (g_stkcheck) stack_check_wat_module(pm, dsegend);
   
   /* patch initial stack pointer and memory size */
   finalize_wat_module(pm, dsegend);
@@ -4454,7 +5991,7 @@ static void wat_to_wasm_ie(bool import, watiebuf_t *pieb, wasm_module_t *pbm)
         entry_t *pe = entbnewbk(&pbm->memdefs, EK_MEM);
         pe->mod = pie->mod; pe->name = pie->id; 
         if (import) pe->imported = true;
-        else pe->exported = pie->exported;
+        pe->exported = pie->exported; /* imported memory can be re-exported */
         pe->lt = pie->lt; pe->n = pie->n; pe->m = pie->m;
       } break;
       case IEK_GLOBAL: {
@@ -4507,11 +6044,12 @@ void wat_to_wasm(wat_module_t *ptm, wasm_module_t *pbm)
         }
       } break;
       case IEK_DATA: {
-        dseg_t *ps = dsegbnewbk(&pbm->datadefs, DS_ACTIVE); 
-        inscode_t *pdc;
+        dseg_t *ps = dsegbnewbk(&pbm->datadefs, pe->passive ? DS_PASSIVE : DS_ACTIVE); 
         assert(!pe->align); assert(pe->ic.in == IN_I32_CONST);
-        pdc = icbnewbk(&ps->code); *pdc = pe->ic; pdc->id = 0;
-        icbnewbk(&ps->code)->in = IN_END; 
+        if (!pe->passive) {
+          inscode_t *pdc = icbnewbk(&ps->code); *pdc = pe->ic; pdc->id = 0;
+          icbnewbk(&ps->code)->in = IN_END; 
+        }
         cbcpy(&ps->data, &pe->data);
       } break;
       default:;
@@ -4519,3 +6057,1418 @@ void wat_to_wasm(wat_module_t *ptm, wasm_module_t *pbm)
   }
 }
 
+
+/* wasm interpreter */
+
+/* Function bodies of the linked module are pre-decoded into flat arrays
+ * of rins_t with branch targets and stack adjustments resolved, so that
+ * blocks cost nothing at run time and branches are plain jumps. Every
+ * value takes one 8-byte slot (v128 is not supported); the host is
+ * assumed to be little-endian. WASI calls are implemented on top of
+ * host C stdio, with the current directory preopened as "." (fd 3).
+ * There is a single thread: thread-spawn fails, atomics are plain
+ * memory accesses, wait can only time out and notify wakes no one */
+
+/* internal opcodes (reuse reserved codes) */
+typedef enum rinstr {
+  RI_BRM = 0x06,    /* br with stack adjustment: a=target, b=height, c=arity */
+  RI_BRM_IF = 0x07, /* br_if with stack adjustment */
+  RI_TRAP = 0x08,   /* unsupported instruction: a=instr, b=funcidx */
+  RI_ATOMIC = 0x09  /* threads instruction: a=offset, b=instr */
+} rinstr_t;
+
+/* value slot */
+typedef union rval {
+  int i32; unsigned u32; long long i64; unsigned long long u64; float f32; double f64;
+} rval_t;
+
+/* pre-decoded instruction */
+typedef struct rins {
+  int op;         /* instr_t or rinstr_t */
+  unsigned a, b;  /* target/index/offset, height */
+  numval_t c;     /* immediate value, arity */
+} rins_t;
+
+/* pre-decoded function */
+typedef struct rfunc {
+  unsigned fsi;   /* funcsig index */
+  unsigned npar;  /* number of params */
+  unsigned nres;  /* number of results */
+  unsigned nloc;  /* params + locals */
+  unsigned maxh;  /* max operand stack height */
+  int hid;        /* host function id (imports only) */
+  bool host;      /* imported from the host */
+  size_t start;   /* index of first instruction */
+} rfunc_t;
+
+/* decoder's control stack element */
+typedef struct rctl {
+  instr_t in;     /* IN_BLOCK, IN_LOOP, IN_IF or IN_ELSE */
+  unsigned h;     /* operand stack height below block params */
+  unsigned npar;  /* number of block params */
+  unsigned nres;  /* number of block results */
+  size_t start;   /* IN_LOOP: branch target; IN_IF: conditional jump */
+  buf_t fixups;   /* of size_t: forward branches to the end */
+  bool dead;      /* the rest of the block is unreachable */
+} rctl_t;
+
+/* call frame */
+typedef struct rframe {
+  rins_t *pc;     /* return address */
+  rval_t *fp;     /* caller's locals */
+} rframe_t;
+
+/* host (WASI) functions */
+typedef enum rhost {
+  RH_UNSUPPORTED = 0, RH_ARGS_GET, RH_ARGS_SIZES_GET,
+  RH_ENVIRON_GET, RH_ENVIRON_SIZES_GET, RH_CLOCK_RES_GET, RH_CLOCK_TIME_GET,
+  RH_FD_CLOSE, RH_FD_DATASYNC, RH_FD_SYNC, RH_FD_FDSTAT_GET, RH_FD_FILESTAT_GET,
+  RH_FD_PREAD, RH_FD_PWRITE, RH_FD_READ, RH_FD_WRITE, RH_FD_SEEK, RH_FD_TELL,
+  RH_FD_PRESTAT_GET, RH_FD_PRESTAT_DIR_NAME, RH_PATH_OPEN, RH_PATH_FILESTAT_GET,
+  RH_PATH_UNLINK_FILE, RH_PATH_REMOVE_DIRECTORY, RH_PATH_RENAME,
+  RH_FD_READDIR, RH_PATH_CREATE_DIRECTORY,
+  RH_PROC_EXIT, RH_RANDOM_GET, RH_SCHED_YIELD, RH_THREAD_SPAWN
+} rhost_t;
+
+/* WASI errno, filetype, and whence values */
+typedef enum rerrno {
+  RE_SUCCESS = 0, RE_ACCES = 2, RE_BADF = 8, RE_EXIST = 20, RE_INVAL = 28,
+  RE_IO = 29, RE_ISDIR = 31, RE_MFILE = 33, RE_NOENT = 44, RE_NOSYS = 52,
+  RE_NOTDIR = 54, RE_NOTEMPTY = 55, RE_NOTSUP = 58, RE_SPIPE = 70
+} rerrno_t;
+typedef enum rfiletype {
+  RFT_UNKNOWN = 0, RFT_CHARACTER_DEVICE = 2, RFT_DIRECTORY = 3, RFT_REGULAR_FILE = 4
+} rfiletype_t;
+typedef enum rwhence {
+  RW_SET = 0, RW_CUR = 1, RW_END = 2
+} rwhence_t;
+
+#define RT_PAGESZ 65536
+#define RT_STKSZ (1024*1024) /* value stack, in slots */
+#define RT_MAXFRAMES 65536
+#define RT_MAXFDS 64
+#define RT_PREOPENFD 3
+
+/* interpreter state */
+typedef struct rt {
+  wasm_module_t *pm;
+  buf_t funcs;               /* of rfunc_t, parallel to funcdefs */
+  buf_t code;                /* of rins_t, all functions */
+  rval_t *globals;
+  unsigned *table; size_t tabsz;
+  unsigned char *mem; unsigned long long memsz, maxmemsz;
+  bool shared;               /* shared memory (threads) */
+  bool *dropped;             /* data segments dropped by data.drop */
+  rval_t *stk, *stkend;
+  rframe_t *frames;
+  FILE *fds[RT_MAXFDS];
+  char *dirs[RT_MAXFDS];     /* host paths of directory fds */
+  int argc; char **argv;
+  unsigned long long icount; /* executed instructions */
+  clock_t t0;
+} rt_t;
+
+static void rt_report(rt_t *prt)
+{
+  double s = (double)(clock() - prt->t0)/(double)CLOCKS_PER_SEC;
+  logef("# %llu instructions executed in %.3f s", prt->icount, s);
+  if (s > 0.0) logef(" (%.1f M/s)", (double)prt->icount/s/1000000.0);
+  logef("\n");
+}
+
+static void rt_trap(rt_t *prt, const char *msg)
+{
+  fflush(stdout);
+  rt_report(prt);
+  eprintf("wasm trap: %s", msg);
+}
+
+static unsigned char *rt_mref(rt_t *prt, unsigned long long addr, unsigned long long n)
+{
+  if (addr + n > prt->memsz) rt_trap(prt, "out of bounds memory access");
+  return prt->mem + (size_t)addr;
+}
+
+static unsigned rt_ldu32(rt_t *prt, unsigned long long addr)
+{
+  unsigned v; memcpy(&v, rt_mref(prt, addr, 4), 4);
+  return v;
+}
+
+static void rt_stu32(rt_t *prt, unsigned long long addr, unsigned v)
+{
+  memcpy(rt_mref(prt, addr, 4), &v, 4);
+}
+
+static void rt_stu64(rt_t *prt, unsigned long long addr, unsigned long long v)
+{
+  memcpy(rt_mref(prt, addr, 8), &v, 8);
+}
+
+/* copy wasm string to a fresh NUL-terminated host string */
+static char *rt_strdup(rt_t *prt, unsigned addr, unsigned n)
+{
+  char *s = emalloc(n+1);
+  memcpy(s, rt_mref(prt, addr, n), n); s[n] = 0;
+  return s;
+}
+
+#ifdef __WCPL__
+/* WCPL's libc does not expose environ: pass empty environment */
+static char *rt_noenv[1] = { NULL };
+static char **rt_environ(void) { return &rt_noenv[0]; }
+#else
+static char **rt_environ(void) { return environ; }
+#endif
+
+static rhost_t rt_host_id(sym_t name)
+{
+  const char *s = symname(name);
+  if (streql(s, "args_get")) return RH_ARGS_GET;
+  if (streql(s, "args_sizes_get")) return RH_ARGS_SIZES_GET;
+  if (streql(s, "environ_get")) return RH_ENVIRON_GET;
+  if (streql(s, "environ_sizes_get")) return RH_ENVIRON_SIZES_GET;
+  if (streql(s, "clock_res_get")) return RH_CLOCK_RES_GET;
+  if (streql(s, "clock_time_get")) return RH_CLOCK_TIME_GET;
+  if (streql(s, "fd_close")) return RH_FD_CLOSE;
+  if (streql(s, "fd_datasync")) return RH_FD_DATASYNC;
+  if (streql(s, "fd_sync")) return RH_FD_SYNC;
+  if (streql(s, "fd_fdstat_get")) return RH_FD_FDSTAT_GET;
+  if (streql(s, "fd_filestat_get")) return RH_FD_FILESTAT_GET;
+  if (streql(s, "fd_pread")) return RH_FD_PREAD;
+  if (streql(s, "fd_pwrite")) return RH_FD_PWRITE;
+  if (streql(s, "fd_read")) return RH_FD_READ;
+  if (streql(s, "fd_write")) return RH_FD_WRITE;
+  if (streql(s, "fd_seek")) return RH_FD_SEEK;
+  if (streql(s, "fd_tell")) return RH_FD_TELL;
+  if (streql(s, "fd_prestat_get")) return RH_FD_PRESTAT_GET;
+  if (streql(s, "fd_prestat_dir_name")) return RH_FD_PRESTAT_DIR_NAME;
+  if (streql(s, "path_open")) return RH_PATH_OPEN;
+  if (streql(s, "path_filestat_get")) return RH_PATH_FILESTAT_GET;
+  if (streql(s, "path_unlink_file")) return RH_PATH_UNLINK_FILE;
+  if (streql(s, "path_remove_directory")) return RH_PATH_REMOVE_DIRECTORY;
+  if (streql(s, "path_rename")) return RH_PATH_RENAME;
+  if (streql(s, "fd_readdir")) return RH_FD_READDIR;
+  if (streql(s, "path_create_directory")) return RH_PATH_CREATE_DIRECTORY;
+  if (streql(s, "proc_exit")) return RH_PROC_EXIT;
+  if (streql(s, "random_get")) return RH_RANDOM_GET;
+  if (streql(s, "sched_yield")) return RH_SCHED_YIELD;
+  if (streql(s, "thread-spawn")) return RH_THREAD_SPAWN;
+  return RH_UNSUPPORTED;
+}
+
+static void rt_exit(rt_t *prt, int code)
+{
+  fflush(stdout);
+  rt_report(prt);
+  exit(code);
+}
+
+/* WASI fd_read/fd_write/fd_pread/fd_pwrite over iovec array */
+static unsigned rt_fdio(rt_t *prt, FILE *pf, bool wr, unsigned iovs, unsigned n, unsigned *pcnt)
+{
+  unsigned i, cnt = 0;
+  for (i = 0; i < n; ++i) {
+    unsigned p = rt_ldu32(prt, iovs + 8ULL*i), len = rt_ldu32(prt, iovs + 8ULL*i + 4), k;
+    unsigned char *pb = rt_mref(prt, p, len);
+    if (wr) {
+      k = (unsigned)fwrite(pb, 1, len, pf);
+    } else if (pf == stdin) {
+      /* don't wait for a full buffer: return what's there by end of line */
+      int c = 0;
+      for (k = 0; k < len && (c = getc(pf)) != EOF; ) {
+        pb[k++] = (unsigned char)c;
+        if (c == '\n') break;
+      }
+      cnt += k;
+      if (k < len || c == '\n') break;
+      continue;
+    } else {
+      k = (unsigned)fread(pb, 1, len, pf);
+    }
+    cnt += k;
+    if (k < len) break;
+  }
+  *pcnt = cnt;
+  if (ferror(pf)) { clearerr(pf); return RE_IO; }
+  return RE_SUCCESS;
+}
+
+static unsigned rt_filestat(rt_t *prt, FILE *pf, unsigned filetype, unsigned addr)
+{
+  memset(rt_mref(prt, addr, 64), 0, 64);
+  *rt_mref(prt, addr + 16ULL, 1) = (unsigned char)filetype;
+  rt_stu64(prt, addr + 24ULL, 1); /* nlink */
+  if (pf != NULL) {
+    long pos = ftell(pf), end;
+    if (pos >= 0 && fseek(pf, 0, SEEK_END) == 0) {
+      end = ftell(pf);
+      fseek(pf, pos, SEEK_SET);
+      if (end > 0) rt_stu64(prt, addr + 32ULL, (unsigned long long)end);
+    }
+  }
+  return RE_SUCCESS;
+}
+
+/* fill WASI filestat from host stat */
+static unsigned rt_stat(rt_t *prt, const char *path, unsigned addr)
+{
+  struct stat st; unsigned ft = RFT_UNKNOWN;
+  if (stat(path, &st) != 0) return errno == EACCES ? RE_ACCES : RE_NOENT;
+  if (S_ISDIR(st.st_mode)) ft = RFT_DIRECTORY;
+  else if (S_ISREG(st.st_mode)) ft = RFT_REGULAR_FILE;
+  else if (S_ISCHR(st.st_mode)) ft = RFT_CHARACTER_DEVICE;
+  memset(rt_mref(prt, addr, 64), 0, 64);
+  rt_stu64(prt, addr, (unsigned long long)st.st_dev);
+  rt_stu64(prt, addr + 8ULL, (unsigned long long)st.st_ino);
+  *rt_mref(prt, addr + 16ULL, 1) = (unsigned char)ft;
+  rt_stu64(prt, addr + 24ULL, (unsigned long long)st.st_nlink);
+  rt_stu64(prt, addr + 32ULL, (unsigned long long)st.st_size);
+  rt_stu64(prt, addr + 40ULL, (unsigned long long)st.st_atime * 1000000000ULL);
+  rt_stu64(prt, addr + 48ULL, (unsigned long long)st.st_mtime * 1000000000ULL);
+  rt_stu64(prt, addr + 56ULL, (unsigned long long)st.st_ctime * 1000000000ULL);
+  return RE_SUCCESS;
+}
+
+/* host path for wasm path relative to directory fd; NULL if fd is not a directory */
+static char *rt_path(rt_t *prt, unsigned fd, unsigned addr, unsigned n)
+{
+  char *dir = (fd < RT_MAXFDS) ? prt->dirs[fd] : NULL, *path;
+  size_t len;
+  if (dir == NULL) return NULL;
+  if (fd == RT_PREOPENFD) return rt_strdup(prt, addr, n);
+  len = strlen(dir);
+  path = emalloc(len + n + 2);
+  memcpy(path, dir, len); path[len] = '/';
+  memcpy(path + len + 1, rt_mref(prt, addr, n), n); path[len + n + 1] = 0;
+  return path;
+}
+
+static unsigned rt_errno(int e)
+{
+  switch (e) {
+    case EACCES: return RE_ACCES;
+    case EEXIST: return RE_EXIST;
+    case ENOTDIR: return RE_NOTDIR;
+    case ENOTEMPTY: return RE_NOTEMPTY;
+  }
+  return RE_NOENT;
+}
+
+#ifndef __WCPL__
+#ifdef _WIN32
+/* minimal dirent API over _findfirst/_findnext (FindFirstFile) */
+struct dirent { unsigned long d_ino; char d_name[260]; };
+typedef struct DIR { intptr_t h; bool more; struct _finddata_t fd; struct dirent de; } DIR;
+
+static DIR *opendir(const char *dir)
+{
+  DIR *pd = emalloc(sizeof(DIR)); char *spec = emalloc(strlen(dir) + 3);
+  strcpy(spec, dir); strcat(spec, "/*");
+  pd->h = _findfirst(spec, &pd->fd); pd->more = true;
+  free(spec);
+  if (pd->h == -1) { free(pd); return NULL; }
+  return pd;
+}
+
+static struct dirent *readdir(DIR *pd)
+{
+  if (!pd->more) return NULL;
+  pd->de.d_ino = 0;
+  strncpy(pd->de.d_name, pd->fd.name, sizeof(pd->de.d_name) - 1);
+  pd->de.d_name[sizeof(pd->de.d_name) - 1] = 0;
+  pd->more = (_findnext(pd->h, &pd->fd) == 0);
+  return &pd->de;
+}
+
+static int closedir(DIR *pd)
+{
+  _findclose(pd->h); free(pd);
+  return 0;
+}
+#endif
+#endif
+
+/* WASI fd_readdir: entries are numbered by cookie, the last one may be cut short */
+static unsigned rt_readdir(rt_t *prt, const char *dir, unsigned buf, unsigned len,
+  unsigned long long cookie, unsigned *pused)
+{
+  DIR *pd = opendir(dir); struct dirent *pde;
+  unsigned long long k = 0; unsigned used = 0;
+  if (pd == NULL) return rt_errno(errno);
+  while (used < len && (pde = readdir(pd)) != NULL) {
+    unsigned char hdr[24]; unsigned namlen = (unsigned)strlen(pde->d_name), n;
+    unsigned long long ino = (unsigned long long)pde->d_ino;
+    char *path; struct stat st;
+    if (k++ < cookie) continue;
+    path = emalloc(strlen(dir) + namlen + 2);
+    strcpy(path, dir); strcat(path, "/"); strcat(path, pde->d_name);
+    memset(&hdr[0], 0, 24);
+    memcpy(&hdr[0], &k, 8); memcpy(&hdr[8], &ino, 8); memcpy(&hdr[16], &namlen, 4);
+    if (stat(path, &st) == 0) {
+      if (S_ISDIR(st.st_mode)) hdr[20] = RFT_DIRECTORY;
+      else if (S_ISREG(st.st_mode)) hdr[20] = RFT_REGULAR_FILE;
+      else if (S_ISCHR(st.st_mode)) hdr[20] = RFT_CHARACTER_DEVICE;
+    }
+    free(path);
+    n = len - used < 24 ? len - used : 24;
+    memcpy(rt_mref(prt, buf + (unsigned long long)used, n), &hdr[0], n); used += n;
+    n = len - used < namlen ? len - used : namlen;
+    memcpy(rt_mref(prt, buf + (unsigned long long)used, n), &pde->d_name[0], n); used += n;
+  }
+  closedir(pd);
+  *pused = used;
+  return RE_SUCCESS;
+}
+
+static unsigned rt_newfd(rt_t *prt)
+{
+  unsigned fd;
+  for (fd = RT_PREOPENFD+1; fd < RT_MAXFDS; ++fd) {
+    if (prt->fds[fd] == NULL && prt->dirs[fd] == NULL) break;
+  }
+  return fd;
+}
+
+static unsigned rt_path_open(rt_t *prt, rval_t *pa)
+{
+  unsigned oflags = pa[4].u32, fd;
+  bool rd = (pa[5].u64 & 2) != 0 /* FD_READ */, wr = (pa[5].u64 & 64) != 0 /* FD_WRITE */;
+  char *path; FILE *pf = NULL; unsigned err = RE_SUCCESS; struct stat st; int sr;
+  if ((fd = rt_newfd(prt)) == RT_MAXFDS) return RE_MFILE;
+  if ((path = rt_path(prt, pa[0].u32, pa[2].u32, pa[3].u32)) == NULL) return RE_NOTDIR;
+  if ((sr = stat(path, &st)) == 0 && S_ISDIR(st.st_mode)) {
+    /* directories are kept as host paths for fd_readdir and path_* calls */
+    if (wr) { free(path); return RE_ISDIR; }
+    prt->dirs[fd] = path;
+    rt_stu32(prt, pa[8].u32, fd);
+    return RE_SUCCESS;
+  } else if ((oflags & 2) != 0 /* DIRECTORY */) {
+    err = (sr == 0) ? RE_NOTDIR : RE_NOENT;
+  } else if ((oflags & 4) != 0 /* EXCL */ && (pf = fopen(path, "rb")) != NULL) {
+    fclose(pf); pf = NULL; err = RE_EXIST;
+  } else if (wr && (oflags & 8) != 0 /* TRUNC */) {
+    pf = fopen(path, rd ? "w+b" : "wb");
+  } else if (wr && (pa[7].u32 & 1) != 0 /* APPEND */) {
+    pf = fopen(path, rd ? "a+b" : "ab");
+  } else if (wr) {
+    pf = fopen(path, "r+b");
+    if (pf == NULL && (oflags & 1) != 0 /* CREAT */) pf = fopen(path, rd ? "w+b" : "wb");
+  } else {
+    pf = fopen(path, "rb");
+  }
+  free(path);
+  if (err != RE_SUCCESS) return err;
+  if (pf == NULL) return errno == EACCES ? RE_ACCES : RE_NOENT;
+  prt->fds[fd] = pf;
+  rt_stu32(prt, pa[8].u32, fd);
+  return RE_SUCCESS;
+}
+
+/* call host function; args and results are at pa */
+static void rt_host_call(rt_t *prt, rfunc_t *pf, rval_t *pa)
+{
+  unsigned err = RE_SUCCESS, n = pf->npar > 0 ? pa[0].u32 : 0, i, cnt;
+  FILE *pfile = (n < RT_MAXFDS) ? prt->fds[n] : NULL;
+  char *dir = (n < RT_MAXFDS) ? prt->dirs[n] : NULL;
+  switch (pf->hid) {
+    case RH_ARGS_SIZES_GET: {
+      unsigned sz = 0; int k;
+      for (k = 0; k < prt->argc; ++k) sz += (unsigned)strlen(prt->argv[k]) + 1;
+      rt_stu32(prt, pa[0].u32, (unsigned)prt->argc);
+      rt_stu32(prt, pa[1].u32, sz);
+    } break;
+    case RH_ARGS_GET: {
+      unsigned p = pa[1].u32; int k;
+      for (k = 0; k < prt->argc; ++k) {
+        unsigned len = (unsigned)strlen(prt->argv[k]) + 1;
+        rt_stu32(prt, pa[0].u32 + 4ULL*k, p);
+        memcpy(rt_mref(prt, p, len), prt->argv[k], len);
+        p += len;
+      }
+    } break;
+    case RH_ENVIRON_SIZES_GET: {
+      char **env = rt_environ(); unsigned sz = 0; int k;
+      for (k = 0; env[k] != NULL; ++k) sz += (unsigned)strlen(env[k]) + 1;
+      rt_stu32(prt, pa[0].u32, (unsigned)k);
+      rt_stu32(prt, pa[1].u32, sz);
+    } break;
+    case RH_ENVIRON_GET: {
+      char **env = rt_environ(); unsigned p = pa[1].u32; int k;
+      for (k = 0; env[k] != NULL; ++k) {
+        unsigned len = (unsigned)strlen(env[k]) + 1;
+        rt_stu32(prt, pa[0].u32 + 4ULL*k, p);
+        memcpy(rt_mref(prt, p, len), env[k], len);
+        p += len;
+      }
+    } break;
+    case RH_CLOCK_RES_GET: {
+      rt_stu64(prt, pa[1].u32, n == 0 ? 1000000000ULL
+        : (unsigned long long)(1000000000.0/(double)CLOCKS_PER_SEC));
+    } break;
+    case RH_CLOCK_TIME_GET: {
+      unsigned long long t;
+      if (n == 0) t = (unsigned long long)time(NULL) * 1000000000ULL;
+      else t = (unsigned long long)((double)clock() * (1000000000.0/(double)CLOCKS_PER_SEC));
+      rt_stu64(prt, pa[2].u32, t);
+    } break;
+    case RH_FD_CLOSE: {
+      if (n <= RT_PREOPENFD || (pfile == NULL && dir == NULL)) err = RE_BADF;
+      else if (dir != NULL) { free(dir); prt->dirs[n] = NULL; }
+      else { fclose(pfile); prt->fds[n] = NULL; }
+    } break;
+    case RH_FD_DATASYNC: case RH_FD_SYNC: {
+      if (pfile == NULL) err = RE_BADF; else fflush(pfile);
+    } break;
+    case RH_FD_FDSTAT_GET: {
+      unsigned ft = n < RT_PREOPENFD ? RFT_CHARACTER_DEVICE : RFT_REGULAR_FILE;
+      if (dir != NULL) ft = RFT_DIRECTORY;
+      else if (pfile == NULL) { err = RE_BADF; break; }
+      memset(rt_mref(prt, pa[1].u32, 24), 0, 24);
+      *rt_mref(prt, pa[1].u32, 1) = (unsigned char)ft;
+      rt_stu64(prt, pa[1].u32 + 8ULL, ~0ULL); rt_stu64(prt, pa[1].u32 + 16ULL, ~0ULL);
+    } break;
+    case RH_FD_FILESTAT_GET: {
+      if (dir != NULL) err = rt_stat(prt, dir, pa[1].u32);
+      else if (pfile == NULL) err = RE_BADF;
+      else if (n < RT_PREOPENFD) err = rt_filestat(prt, NULL, RFT_CHARACTER_DEVICE, pa[1].u32);
+      else err = rt_filestat(prt, pfile, RFT_REGULAR_FILE, pa[1].u32);
+    } break;
+    case RH_FD_READ: case RH_FD_WRITE: {
+      if (pfile == NULL) { err = RE_BADF; break; }
+      err = rt_fdio(prt, pfile, pf->hid == RH_FD_WRITE, pa[1].u32, pa[2].u32, &cnt);
+      if (n == 2) fflush(pfile);
+      rt_stu32(prt, pa[3].u32, cnt);
+    } break;
+    case RH_FD_PREAD: case RH_FD_PWRITE: {
+      long pos;
+      if (pfile == NULL) { err = RE_BADF; break; }
+      if (n <= RT_PREOPENFD || (pos = ftell(pfile)) < 0) { err = RE_SPIPE; break; }
+      if (fseek(pfile, (long)pa[3].i64, SEEK_SET) != 0) { err = RE_INVAL; break; }
+      err = rt_fdio(prt, pfile, pf->hid == RH_FD_PWRITE, pa[1].u32, pa[2].u32, &cnt);
+      fseek(pfile, pos, SEEK_SET);
+      rt_stu32(prt, pa[4].u32, cnt);
+    } break;
+    case RH_FD_SEEK: case RH_FD_TELL: {
+      long pos; int whence = SEEK_SET;
+      if (pfile == NULL) { err = RE_BADF; break; }
+      if (n <= RT_PREOPENFD) { err = RE_SPIPE; break; }
+      if (pf->hid == RH_FD_SEEK) {
+        if (pa[2].u32 == RW_CUR) whence = SEEK_CUR;
+        else if (pa[2].u32 == RW_END) whence = SEEK_END;
+        if (fseek(pfile, (long)pa[1].i64, whence) != 0) { err = RE_INVAL; break; }
+      }
+      if ((pos = ftell(pfile)) < 0) { err = RE_SPIPE; break; }
+      rt_stu64(prt, pa[pf->hid == RH_FD_SEEK ? 3 : 1].u32, (unsigned long long)pos);
+    } break;
+    case RH_FD_PRESTAT_GET: {
+      if (n != RT_PREOPENFD) { err = RE_BADF; break; }
+      rt_stu32(prt, pa[1].u32, 0); /* PREOPENTYPE_DIR */
+      rt_stu32(prt, pa[1].u32 + 4ULL, 1);
+    } break;
+    case RH_FD_PRESTAT_DIR_NAME: {
+      if (n != RT_PREOPENFD) { err = RE_BADF; break; }
+      if (pa[2].u32 > 0) *rt_mref(prt, pa[1].u32, 1) = '.';
+    } break;
+    case RH_PATH_OPEN: {
+      err = rt_path_open(prt, pa);
+    } break;
+    case RH_PATH_FILESTAT_GET: {
+      char *path = rt_path(prt, n, pa[2].u32, pa[3].u32);
+      if (path == NULL) err = RE_NOTDIR;
+      else err = rt_stat(prt, path, pa[4].u32);
+      free(path);
+    } break;
+    case RH_PATH_UNLINK_FILE: case RH_PATH_REMOVE_DIRECTORY: {
+      char *path = rt_path(prt, n, pa[1].u32, pa[2].u32);
+      if (path == NULL) err = RE_NOTDIR;
+      else if (remove(path) != 0) err = rt_errno(errno);
+      free(path);
+    } break;
+    case RH_PATH_RENAME: {
+      char *from = rt_path(prt, n, pa[1].u32, pa[2].u32), *to = rt_path(prt, pa[3].u32, pa[4].u32, pa[5].u32);
+      if (from == NULL || to == NULL) err = RE_NOTDIR;
+      else if (rename(from, to) != 0) err = rt_errno(errno);
+      free(from); free(to);
+    } break;
+    case RH_FD_READDIR: {
+      if (dir == NULL) { err = pfile == NULL ? RE_BADF : RE_NOTDIR; break; }
+      err = rt_readdir(prt, dir, pa[1].u32, pa[2].u32, pa[3].u64, &cnt);
+      if (err == RE_SUCCESS) rt_stu32(prt, pa[4].u32, cnt);
+    } break;
+    case RH_PATH_CREATE_DIRECTORY: {
+      char *path = rt_path(prt, n, pa[1].u32, pa[2].u32);
+      if (path == NULL) err = RE_NOTDIR;
+      else if (mkdir(path, 0777) != 0) err = rt_errno(errno);
+      free(path);
+    } break;
+    case RH_PROC_EXIT: {
+      rt_exit(prt, pa[0].i32);
+    } break;
+    case RH_RANDOM_GET: {
+      unsigned char *pb = rt_mref(prt, pa[0].u32, pa[1].u32);
+      for (i = 0; i < pa[1].u32; ++i) pb[i] = (unsigned char)(rand() >> 4);
+    } break;
+    case RH_SCHED_YIELD: break;
+    case RH_THREAD_SPAWN: err = 0xFFFFFFFFU; break; /* -1: no threads */
+    default: err = RE_NOSYS;
+  }
+  if (pf->nres > 0) pa[0].u64 = err;
+}
+
+/* pre-decoding */
+
+static bool rt_blocktype(rt_t *prt, unsigned long long bt, unsigned *pnpar, unsigned *pnres)
+{
+  *pnpar = *pnres = 0;
+  if (bt == BT_VOID) return true;
+  if (bt == VT_I32 || bt == VT_I64 || bt == VT_F32 || bt == VT_F64) {
+    *pnres = 1;
+    return true;
+  }
+  if (bt < fsblen(&prt->pm->funcsigs)) {
+    funcsig_t *pfs = fsbref(&prt->pm->funcsigs, (size_t)bt);
+    *pnpar = (unsigned)vtblen(&pfs->partypes); *pnres = (unsigned)vtblen(&pfs->restypes);
+    return true;
+  }
+  return false;
+}
+
+/* simple instructions: pops/pushes, false if not supported */
+static bool rt_stack_effect(instr_t in, unsigned *ppop, unsigned *ppush)
+{
+  unsigned pop = 1, push = 1;
+  if (in >= IN_I32_LOAD && in <= IN_I64_LOAD32_U) pop = 1;
+  else if (in >= IN_I32_STORE && in <= IN_I64_STORE32) pop = 2, push = 0;
+  else if (in >= IN_I32_CONST && in <= IN_F64_CONST) pop = 0;
+  else if (in == IN_I32_EQZ || in == IN_I64_EQZ) pop = 1;
+  else if (in >= IN_I32_EQ && in <= IN_F64_GE) pop = 2;
+  else if (in >= IN_I32_CLZ && in <= IN_I32_POPCNT) pop = 1;
+  else if (in >= IN_I32_ADD && in <= IN_I32_ROTR) pop = 2;
+  else if (in >= IN_I64_CLZ && in <= IN_I64_POPCNT) pop = 1;
+  else if (in >= IN_I64_ADD && in <= IN_I64_ROTR) pop = 2;
+  else if (in >= IN_F32_ABS && in <= IN_F32_SQRT) pop = 1;
+  else if (in >= IN_F32_ADD && in <= IN_F32_COPYSIGN) pop = 2;
+  else if (in >= IN_F64_ABS && in <= IN_F64_SQRT) pop = 1;
+  else if (in >= IN_F64_ADD && in <= IN_F64_COPYSIGN) pop = 2;
+  else if (in >= IN_I32_WRAP_I64 && in <= IN_I64_EXTEND32_S) pop = 1;
+  else if (in >= IN_I32_TRUNC_SAT_F32_S && in <= IN_I64_TRUNC_SAT_F64_U) pop = 1;
+  else switch (in) {
+    case IN_DROP: pop = 1, push = 0; break;
+    case IN_SELECT: case IN_SELECT_T: pop = 3; break;
+    case IN_MEMORY_SIZE: pop = 0; break;
+    case IN_MEMORY_GROW: pop = 1; break;
+    case IN_MEMORY_COPY: case IN_MEMORY_FILL: pop = 3, push = 0; break;
+    case IN_MEMORY_INIT: pop = 3, push = 0; break;
+    case IN_DATA_DROP: case IN_ATOMIC_FENCE: pop = 0, push = 0; break;
+    case IN_MEMORY_ATOMIC_NOTIFY: pop = 2; break;
+    case IN_MEMORY_ATOMIC_WAIT32: case IN_MEMORY_ATOMIC_WAIT64: pop = 3; break;
+    default:
+      if (in >= IN_I32_ATOMIC_LOAD && in <= IN_I64_ATOMIC_LOAD32_U) pop = 1;
+      else if (in >= IN_I32_ATOMIC_STORE && in <= IN_I64_ATOMIC_STORE32) pop = 2, push = 0;
+      else if (in >= IN_I32_ATOMIC_RMW_ADD && in <= IN_I64_ATOMIC_RMW32_XCHG_U) pop = 2;
+      else if (in >= IN_I32_ATOMIC_RMW_CMPXCHG && in <= IN_I64_ATOMIC_RMW32_CMPXCHG_U) pop = 3;
+      else return false;
+  }
+  *ppop = pop, *ppush = push;
+  return true;
+}
+
+static rins_t *rt_emit(rt_t *prt, int op, unsigned a)
+{
+  rins_t *pri = bufnewbk(&prt->code);
+  pri->op = op; pri->a = a;
+  return pri;
+}
+
+/* emit branch to label l at operand stack height h */
+static void rt_emit_br(rt_t *prt, buf_t *pctls, unsigned l, unsigned h, unsigned nloc, bool cond)
+{
+  size_t n = buflen(pctls); rctl_t *pt; rins_t *pri; unsigned arity;
+  assert(l < n);
+  pt = bufref(pctls, n-1-l);
+  arity = (pt->in == IN_LOOP) ? pt->npar : pt->nres;
+  if (l == n-1 && !cond) { /* function block */
+    rt_emit(prt, IN_RETURN, arity);
+    return;
+  }
+  if (l == n-1 || h - arity == pt->h) {
+    pri = rt_emit(prt, cond ? IN_BR_IF : IN_BR, 0);
+  } else {
+    pri = rt_emit(prt, cond ? RI_BRM_IF : RI_BRM, 0);
+    pri->b = nloc + pt->h; pri->c.u = arity;
+  }
+  if (pt->in == IN_LOOP) pri->a = (unsigned)pt->start;
+  else *(size_t*)bufnewbk(&pt->fixups) = buflen(&prt->code)-1;
+}
+
+static void rt_decode_func(rt_t *prt, size_t fi)
+{
+  wasm_module_t *pm = prt->pm;
+  entry_t *pe = entbref(&pm->funcdefs, fi);
+  rfunc_t *pf = bufref(&prt->funcs, fi);
+  buf_t ctls = mkbuf(sizeof(rctl_t));
+  unsigned h = 0, maxh = 0, skip = 0, pop, push;
+  size_t i, k; rctl_t *pc; rins_t *pri; bool ok = true;
+  pf->start = buflen(&prt->code);
+  pc = bufnewbk(&ctls); pc->in = IN_BLOCK; pc->nres = pf->nres;
+  bufinit(&pc->fixups, sizeof(size_t));
+  for (i = 0; i < icblen(&pe->code); ++i) {
+    inscode_t *pic = icbref(&pe->code, i); instr_t in = pic->in;
+    pc = bufbk(&ctls);
+    if (pc->dead) { /* skip unreachable code */
+      if (in == IN_BLOCK || in == IN_LOOP || in == IN_IF) { ++skip; continue; }
+      if (in == IN_END && skip > 0) { --skip; continue; }
+      if (in != IN_END && (in != IN_ELSE || skip > 0)) continue;
+    }
+    switch (in) {
+      case IN_NOP: case IN_I32_REINTERPRET_F32: case IN_I64_REINTERPRET_F64:
+      case IN_F32_REINTERPRET_I32: case IN_F64_REINTERPRET_I64:
+        break;
+      case IN_UNREACHABLE:
+        rt_emit(prt, IN_UNREACHABLE, 0);
+        pc->dead = true;
+        break;
+      case IN_BLOCK: case IN_LOOP: case IN_IF: {
+        unsigned npar, nres;
+        if (!rt_blocktype(prt, pic->arg.u, &npar, &nres)) { ok = false; break; }
+        if (in == IN_IF) h -= 1;
+        pc = bufnewbk(&ctls); pc->in = in;
+        pc->h = h - npar; pc->npar = npar; pc->nres = nres;
+        bufinit(&pc->fixups, sizeof(size_t));
+        pc->start = buflen(&prt->code);
+        if (in == IN_IF) rt_emit(prt, IN_IF, 0);
+      } break;
+      case IN_ELSE: {
+        assert(pc->in == IN_IF);
+        if (!pc->dead) {
+          rt_emit(prt, IN_BR, 0);
+          *(size_t*)bufnewbk(&pc->fixups) = buflen(&prt->code)-1;
+        }
+        pri = bufref(&prt->code, pc->start); pri->a = (unsigned)buflen(&prt->code);
+        pc->in = IN_ELSE; pc->dead = false; skip = 0;
+        h = pc->h + pc->npar;
+      } break;
+      case IN_END: {
+        if (buflen(&ctls) == 1) { /* end of function */
+          i = icblen(&pe->code);
+        } else {
+          if (pc->in == IN_IF) {
+            pri = bufref(&prt->code, pc->start); pri->a = (unsigned)buflen(&prt->code);
+          }
+          for (k = 0; k < buflen(&pc->fixups); ++k) {
+            pri = bufref(&prt->code, *(size_t*)bufref(&pc->fixups, k));
+            pri->a = (unsigned)buflen(&prt->code);
+          }
+          h = pc->h + pc->nres; skip = 0;
+          buffini(&pc->fixups); bufpopbk(&ctls);
+        }
+      } break;
+      case IN_BR: {
+        rt_emit_br(prt, &ctls, (unsigned)pic->arg.u, h, pf->nloc, false);
+        pc->dead = true;
+      } break;
+      case IN_BR_IF: {
+        h -= 1;
+        rt_emit_br(prt, &ctls, (unsigned)pic->arg.u, h, pf->nloc, true);
+      } break;
+      case IN_BR_TABLE: {
+        size_t n = (size_t)pic->arg.u;
+        h -= 1;
+        rt_emit(prt, IN_BR_TABLE, (unsigned)n);
+        for (k = 0; k <= n; ++k) {
+          inscode_t *pbr = icbref(&pe->code, i+1+k); assert(pbr->in == IN_BR);
+          rt_emit_br(prt, &ctls, (unsigned)pbr->arg.u, h, pf->nloc, false);
+        }
+        i += n+1;
+        pc = bufbk(&ctls); pc->dead = true;
+      } break;
+      case IN_RETURN: {
+        rt_emit(prt, IN_RETURN, pf->nres);
+        pc->dead = true;
+      } break;
+      case IN_CALL: case IN_CALL_INDIRECT: {
+        funcsig_t *pfs;
+        if (in == IN_CALL) {
+          if (pic->arg.u >= entblen(&pm->funcdefs)) { ok = false; break; }
+          pfs = fsbref(&pm->funcsigs, entbref(&pm->funcdefs, (size_t)pic->arg.u)->fsi);
+        } else {
+          if (pic->arg.u >= fsblen(&pm->funcsigs)) { ok = false; break; }
+          pfs = fsbref(&pm->funcsigs, (size_t)pic->arg.u);
+          h -= 1;
+        }
+        h -= (unsigned)vtblen(&pfs->partypes);
+        h += (unsigned)vtblen(&pfs->restypes);
+        rt_emit(prt, in, (unsigned)pic->arg.u);
+      } break;
+      case IN_LOCAL_GET: case IN_GLOBAL_GET:
+        h += 1; rt_emit(prt, in, (unsigned)pic->arg.u); break;
+      case IN_LOCAL_SET: case IN_GLOBAL_SET:
+        h -= 1; rt_emit(prt, in, (unsigned)pic->arg.u); break;
+      case IN_LOCAL_TEE:
+        rt_emit(prt, in, (unsigned)pic->arg.u); break;
+      default: {
+        if (!rt_stack_effect(in, &pop, &push)) { ok = false; break; }
+        h -= pop; h += push;
+        if (in >= IN_MEMORY_ATOMIC_NOTIFY && in <= IN_I64_ATOMIC_RMW32_CMPXCHG_U) {
+          pri = rt_emit(prt, RI_ATOMIC, (unsigned)pic->arg.u); /* memarg offset */
+          pri->b = (unsigned)in;
+          break;
+        }
+        pri = rt_emit(prt, in, (unsigned)pic->arg.u); /* memarg offset, data index */
+        pri->c.u = pic->arg.u; /* const */
+      } break;
+    }
+    if (!ok) break;
+    if (h > maxh) maxh = h;
+  }
+  if (ok) {
+    pc = bufref(&ctls, 0);
+    for (k = 0; k < buflen(&pc->fixups); ++k) {
+      pri = bufref(&prt->code, *(size_t*)bufref(&pc->fixups, k));
+      pri->a = (unsigned)buflen(&prt->code);
+    }
+    rt_emit(prt, IN_RETURN, pf->nres);
+    pf->maxh = maxh;
+  } else {
+    /* replace the whole body with a trap */
+    bufresize(&prt->code, pf->start);
+    pri = rt_emit(prt, RI_TRAP, (unsigned)icbref(&pe->code, i)->in);
+    pri->b = (unsigned)fi;
+  }
+  for (k = 0; k < buflen(&ctls); ++k) buffini(&((rctl_t*)bufref(&ctls, k))->fixups);
+  buffini(&ctls);
+}
+
+/* numeric helpers */
+
+static unsigned rt_clz64(unsigned long long x)
+{
+  unsigned n = 0;
+  if (x == 0) return 64;
+  while ((x & 0xFF00000000000000ULL) == 0) n += 8, x <<= 8;
+  while ((x & 0x8000000000000000ULL) == 0) n += 1, x <<= 1;
+  return n;
+}
+
+static unsigned rt_ctz64(unsigned long long x)
+{
+  unsigned n = 0;
+  if (x == 0) return 64;
+  while ((x & 0xFFULL) == 0) n += 8, x >>= 8;
+  while ((x & 1ULL) == 0) n += 1, x >>= 1;
+  return n;
+}
+
+static unsigned rt_popcnt64(unsigned long long x)
+{
+  x = x - ((x >> 1) & 0x5555555555555555ULL);
+  x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+  x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return (unsigned)((x * 0x0101010101010101ULL) >> 56);
+}
+
+/* wasm min/max: NaN if either is NaN, -0 < +0 */
+static double rt_fmin(double x, double y)
+{
+  rval_t a, b;
+  if (x != x || y != y) return x + y;
+  if (x != y) return x < y ? x : y;
+  a.f64 = x, b.f64 = y; a.u64 |= b.u64;
+  return a.f64;
+}
+
+static double rt_fmax(double x, double y)
+{
+  rval_t a, b;
+  if (x != x || y != y) return x + y;
+  if (x != y) return x > y ? x : y;
+  a.f64 = x, b.f64 = y; a.u64 &= b.u64;
+  return a.f64;
+}
+
+static float rt_fminf(float x, float y)
+{
+  rval_t a, b;
+  if (x != x || y != y) return x + y;
+  if (x != y) return x < y ? x : y;
+  a.f32 = x, b.f32 = y; a.u32 |= b.u32;
+  return a.f32;
+}
+
+static float rt_fmaxf(float x, float y)
+{
+  rval_t a, b;
+  if (x != x || y != y) return x + y;
+  if (x != y) return x > y ? x : y;
+  a.f32 = x, b.f32 = y; a.u32 &= b.u32;
+  return a.f32;
+}
+
+/* rounding and square root done bitwise, so libm is not needed */
+static double rt_ftrunc(double x)
+{
+  rval_t v; int e;
+  v.f64 = x; e = (int)((v.u64 >> 52) & 0x7FF) - 1023;
+  if (e >= 52) return x; /* integral, inf or nan */
+  if (e < 0) v.u64 &= 0x8000000000000000ULL; /* signed zero */
+  else v.u64 &= ~((1ULL << (52 - e)) - 1);
+  return v.f64;
+}
+
+static double rt_ffloor(double x)
+{
+  double t = rt_ftrunc(x);
+  return t > x ? t - 1.0 : t;
+}
+
+static double rt_fceil(double x)
+{
+  double t = rt_ftrunc(x);
+  return t < x ? t + 1.0 : t;
+}
+
+/* round to nearest, ties to even */
+static double rt_fnearest(double x)
+{
+  double t = rt_ftrunc(x), d = x - t;
+  if (d < 0.0) d = -d;
+  if (d > 0.5 || (d == 0.5 && ((unsigned long long)(long long)t & 1) != 0))
+    t += x < 0.0 ? -1.0 : 1.0;
+  return t;
+}
+
+/* correctly rounded square root via bit-by-bit integer square root */
+static double rt_fsqrt(double x)
+{
+  rval_t v; unsigned long long m, q = 0, r = 0, t; int e, i;
+  if (x != x || x == 0.0 || x > 1.7976931348623157e308) return x;
+  if (x < 0.0) return (x - x)/(x - x);
+  v.f64 = x; e = (int)((v.u64 >> 52) & 0x7FF); m = v.u64 & 0xFFFFFFFFFFFFFULL;
+  if (e == 0) { /* subnormal */
+    e = 1; while ((m & (1ULL << 52)) == 0) m <<= 1, --e;
+  } else {
+    m |= 1ULL << 52;
+  }
+  e -= 1023 + 52; /* x = m * 2^e */
+  if ((e & 1) != 0) m <<= 1, --e;
+  /* q = isqrt(m * 2^54), 54 bits */
+  for (i = 0; i < 54; ++i) {
+    unsigned long long pair = i < 27 ? (m >> (52 - 2*i)) & 3 : 0;
+    r = (r << 2) | pair; t = (q << 2) | 1;
+    if (r >= t) r -= t, q = (q << 1) | 1; else q <<= 1;
+  }
+  m = q >> 1; e = (e - 54)/2 + 1;
+  if ((q & 1) != 0 && (r != 0 || (m & 1) != 0)) ++m;
+  if (m == (1ULL << 53)) m >>= 1, ++e;
+  v.u64 = ((unsigned long long)(e + 52 + 1023) << 52) | (m & 0xFFFFFFFFFFFFFULL);
+  return v.f64;
+}
+
+/* float-to-int truncation range check: lo < x < hi */
+static double rt_trunc(rt_t *prt, double x, double lo, double hi)
+{
+  if (x != x) rt_trap(prt, "invalid conversion to integer");
+  if (!(x > lo && x < hi)) rt_trap(prt, "integer overflow");
+  return x;
+}
+
+/* saturating truncation to [lo, hi] range, -1 for lo, +1 for hi, 0 otherwise */
+static int rt_sat(double x, double lo, double hi)
+{
+  if (x <= lo) return -1;
+  if (x >= hi) return 1;
+  return 0;
+}
+
+#define RT_I32MIN (-2147483648.0)
+#define RT_I32MAX 2147483647.0
+#define RT_U32MAX 4294967295.0
+#define RT_I64MIN (-9223372036854775808.0)
+#define RT_I64LIM 9223372036854775808.0
+#define RT_U64LIM 18446744073709551616.0
+
+/* memory access: effective address of n-byte access at sp[-k] */
+#define RT_EA(k, n) (ea = (unsigned long long)sp[-(k)].u32 + pi->a + (n), \
+  (ea <= memsz) ? mem + (size_t)(ea - (n)) : rt_oob(prt))
+
+static unsigned char *rt_oob(rt_t *prt)
+{
+  rt_trap(prt, "out of bounds memory access");
+  return NULL;
+}
+
+/* threads instructions; access sizes of load/store/rmw variants */
+static const unsigned char g_rtatsz[7] = { 4, 8, 1, 2, 1, 2, 4 };
+
+static rval_t *rt_atomic(rt_t *prt, rins_t *pi, rval_t *sp)
+{
+  int op = (int)pi->b - IN_MEMORY_ATOMIC_NOTIFY; 
+  unsigned n; rval_t *pa; unsigned long long ea, v = 0, mask;
+  if (op == 3) return sp; /* atomic.fence */
+  if (op < 3) { /* notify, wait32, wait64 */
+    pa = sp - (op == 0 ? 2 : 3); n = op == 2 ? 8 : 4;
+  } else if (op < 0x17) { /* loads */
+    pa = sp - 1; n = g_rtatsz[op - 0x10];
+  } else if (op < 0x1E) { /* stores */
+    pa = sp - 2; n = g_rtatsz[op - 0x17];
+  } else { /* rmw */
+    pa = sp - ((op - 0x1E)/7 == 6 ? 3 : 2); n = g_rtatsz[(op - 0x1E) % 7];
+  }
+  ea = (unsigned long long)pa[0].u32 + pi->a;
+  if ((ea & (n - 1)) != 0) rt_trap(prt, "unaligned atomic");
+  memcpy(&v, rt_mref(prt, ea, n), n);
+  mask = n == 8 ? ~0ULL : (1ULL << (n*8)) - 1;
+  if (op == 0) { /* notify: no waiters */
+    pa[0].u64 = 0;
+  } else if (op < 3) { /* wait: not-equal or timed-out */
+    if (!prt->shared) rt_trap(prt, "expected shared memory");
+    if (v != (pa[1].u64 & mask)) pa[0].u64 = 1;
+    else if (pa[2].i64 < 0) rt_trap(prt, "wait would block forever");
+    else pa[0].u64 = 2;
+  } else if (op < 0x17) {
+    pa[0].u64 = v;
+  } else if (op < 0x1E) {
+    memcpy(rt_mref(prt, ea, n), &pa[1].u64, n);
+  } else {
+    unsigned long long w = pa[1].u64;
+    switch ((op - 0x1E)/7) {
+      case 0: w = v + w; break;
+      case 1: w = v - w; break;
+      case 2: w = v & w; break;
+      case 3: w = v | w; break;
+      case 4: w = v ^ w; break;
+      case 5: break;
+      case 6: w = v == (w & mask) ? pa[2].u64 : v; break;
+    }
+    memcpy(rt_mref(prt, ea, n), &w, n);
+    pa[0].u64 = v;
+  }
+  return pa + 1;
+}
+
+/* execute function fi with arguments at the bottom of the value stack */
+static void rt_exec(rt_t *prt, size_t fi)
+{
+  rins_t *code = bufref(&prt->code, 0), *pc, *pi;
+  rfunc_t *funcs = bufref(&prt->funcs, 0), *pcf = funcs + fi;
+  rval_t *fp = prt->stk, *sp, *gl = prt->globals;
+  rframe_t *pfr = prt->frames, *pfrend = prt->frames + RT_MAXFRAMES;
+  unsigned char *mem = prt->mem; unsigned long long memsz = prt->memsz, ea;
+  unsigned long long icnt = prt->icount; unsigned n;
+  for (n = pcf->npar; n < pcf->nloc; ++n) fp[n].u64 = 0;
+  sp = fp + pcf->nloc;
+  pc = code + pcf->start;
+  for (;;) {
+    pi = pc++; ++icnt;
+    switch (pi->op) {
+      case IN_UNREACHABLE: rt_trap(prt, "unreachable"); break;
+      case RI_TRAP: {
+        entry_t *pe = entbref(&prt->pm->funcdefs, pi->b);
+        fflush(stdout); rt_report(prt);
+        eprintf("wasm trap: %s instruction in $%s:%s is not supported",
+          instr_name((instr_t)pi->a), symname(pe->mod), symname(pe->name));
+      } break;
+      case IN_BR: pc = code + pi->a; break;
+      case IN_BR_IF: if ((--sp)->i32 != 0) pc = code + pi->a; break;
+      case IN_IF: if ((--sp)->i32 == 0) pc = code + pi->a; break;
+      case RI_BRM_IF: if ((--sp)->i32 == 0) break; /* else fall thru */
+      case RI_BRM: {
+        rval_t *dp = fp + pi->b, *rp; unsigned k;
+        n = (unsigned)pi->c.u; rp = sp - n;
+        for (k = 0; k < n; ++k) dp[k].u64 = rp[k].u64;
+        sp = dp + n; pc = code + pi->a;
+      } break;
+      case IN_BR_TABLE: {
+        n = (--sp)->u32;
+        pc += n < pi->a ? n : pi->a;
+      } break;
+      case IN_RETURN: {
+        rval_t *rp; unsigned k;
+        n = pi->a; rp = sp - n;
+        for (k = 0; k < n; ++k) fp[k].u64 = rp[k].u64;
+        sp = fp + n;
+        if (pfr == prt->frames) { prt->icount = icnt; return; }
+        --pfr; pc = pfr->pc; fp = pfr->fp;
+      } break;
+      case IN_CALL_INDIRECT: case IN_CALL: {
+        if (pi->op == IN_CALL) {
+          pcf = funcs + pi->a;
+        } else {
+          n = (--sp)->u32;
+          if (n >= prt->tabsz) rt_trap(prt, "undefined element");
+          if (prt->table[n] == UINT_MAX) rt_trap(prt, "uninitialized element");
+          pcf = funcs + prt->table[n];
+          if (pcf->fsi != pi->a) rt_trap(prt, "indirect call type mismatch");
+        }
+        if (pcf->host) {
+          prt->icount = icnt;
+          sp -= pcf->npar;
+          rt_host_call(prt, pcf, sp);
+          sp += pcf->nres;
+        } else {
+          rval_t *nfp = sp - pcf->npar;
+          if (pfr == pfrend || nfp + pcf->nloc + pcf->maxh > prt->stkend)
+            rt_trap(prt, "call stack exhausted");
+          pfr->pc = pc; pfr->fp = fp; ++pfr;
+          fp = nfp; sp = fp + pcf->nloc;
+          for (n = pcf->npar; n < pcf->nloc; ++n) fp[n].u64 = 0;
+          pc = code + pcf->start;
+        }
+      } break;
+      case IN_DROP: --sp; break;
+      case IN_SELECT: case IN_SELECT_T: {
+        sp -= 2; if (sp[1].i32 == 0) sp[-1].u64 = sp[0].u64;
+      } break;
+      case IN_LOCAL_GET: (sp++)->u64 = fp[pi->a].u64; break;
+      case IN_LOCAL_SET: fp[pi->a].u64 = (--sp)->u64; break;
+      case IN_LOCAL_TEE: fp[pi->a].u64 = sp[-1].u64; break;
+      case IN_GLOBAL_GET: (sp++)->u64 = gl[pi->a].u64; break;
+      case IN_GLOBAL_SET: gl[pi->a].u64 = (--sp)->u64; break;
+      /* loads */
+      case IN_I32_LOAD: case IN_F32_LOAD: memcpy(&sp[-1].u32, RT_EA(1, 4), 4); break;
+      case IN_I64_LOAD: case IN_F64_LOAD: memcpy(&sp[-1].u64, RT_EA(1, 8), 8); break;
+      case IN_I32_LOAD8_S: sp[-1].i32 = (signed char)*RT_EA(1, 1); break;
+      case IN_I32_LOAD8_U: sp[-1].u32 = *RT_EA(1, 1); break;
+      case IN_I32_LOAD16_S: { short v; memcpy(&v, RT_EA(1, 2), 2); sp[-1].i32 = v; } break;
+      case IN_I32_LOAD16_U: { unsigned short v; memcpy(&v, RT_EA(1, 2), 2); sp[-1].u32 = v; } break;
+      case IN_I64_LOAD8_S: sp[-1].i64 = (signed char)*RT_EA(1, 1); break;
+      case IN_I64_LOAD8_U: sp[-1].u64 = *RT_EA(1, 1); break;
+      case IN_I64_LOAD16_S: { short v; memcpy(&v, RT_EA(1, 2), 2); sp[-1].i64 = v; } break;
+      case IN_I64_LOAD16_U: { unsigned short v; memcpy(&v, RT_EA(1, 2), 2); sp[-1].u64 = v; } break;
+      case IN_I64_LOAD32_S: { int v; memcpy(&v, RT_EA(1, 4), 4); sp[-1].i64 = v; } break;
+      case IN_I64_LOAD32_U: { unsigned v; memcpy(&v, RT_EA(1, 4), 4); sp[-1].u64 = v; } break;
+      /* stores */
+      case IN_I32_STORE: case IN_F32_STORE: memcpy(RT_EA(2, 4), &sp[-1].u32, 4); sp -= 2; break;
+      case IN_I64_STORE: case IN_F64_STORE: memcpy(RT_EA(2, 8), &sp[-1].u64, 8); sp -= 2; break;
+      case IN_I32_STORE8: case IN_I64_STORE8: *RT_EA(2, 1) = (unsigned char)sp[-1].u32; sp -= 2; break;
+      case IN_I32_STORE16: case IN_I64_STORE16: {
+        unsigned short v = (unsigned short)sp[-1].u32; memcpy(RT_EA(2, 2), &v, 2); sp -= 2;
+      } break;
+      case IN_I64_STORE32: memcpy(RT_EA(2, 4), &sp[-1].u32, 4); sp -= 2; break;
+      /* memory */
+      case IN_MEMORY_SIZE: (sp++)->u64 = memsz / RT_PAGESZ; break;
+      case IN_MEMORY_GROW: {
+        unsigned long long nsz = memsz + (unsigned long long)sp[-1].u32 * RT_PAGESZ;
+        unsigned char *nmem = NULL;
+        if (nsz <= prt->maxmemsz && (size_t)nsz == nsz) nmem = realloc(mem, (size_t)nsz);
+        if (nmem == NULL) {
+          sp[-1].i32 = -1;
+        } else {
+          memset(nmem + (size_t)memsz, 0, (size_t)(nsz - memsz));
+          sp[-1].u32 = (unsigned)(memsz / RT_PAGESZ);
+          prt->mem = mem = nmem; prt->memsz = memsz = nsz;
+        }
+      } break;
+      case IN_MEMORY_COPY: {
+        unsigned long long d = sp[-3].u32, s = sp[-2].u32, k = sp[-1].u32;
+        sp -= 3;
+        if (d + k > memsz || s + k > memsz) rt_trap(prt, "out of bounds memory access");
+        memmove(mem + (size_t)d, mem + (size_t)s, (size_t)k);
+      } break;
+      case IN_MEMORY_FILL: {
+        unsigned long long d = sp[-3].u32, k = sp[-1].u32;
+        sp -= 3;
+        if (d + k > memsz) rt_trap(prt, "out of bounds memory access");
+        memset(mem + (size_t)d, (int)(sp[1].u32 & 0xFF), (size_t)k);
+      } break;
+      case IN_MEMORY_INIT: {
+        dseg_t *ps = dsegbref(&prt->pm->datadefs, pi->a);
+        unsigned long long d = sp[-3].u32, s = sp[-2].u32, k = sp[-1].u32;
+        unsigned long long len = prt->dropped[pi->a] ? 0 : buflen(&ps->data);
+        sp -= 3;
+        if (d + k > memsz || s + k > len) rt_trap(prt, "out of bounds memory access");
+        memcpy(mem + (size_t)d, (char*)bufdata(&ps->data) + (size_t)s, (size_t)k);
+      } break;
+      case IN_DATA_DROP: prt->dropped[pi->a] = true; break;
+      case RI_ATOMIC: sp = rt_atomic(prt, pi, sp); break;
+      /* constants */
+      case IN_I32_CONST: case IN_I64_CONST: case IN_F32_CONST: case IN_F64_CONST:
+        (sp++)->u64 = pi->c.u; break;
+      /* i32 comparisons */
+      case IN_I32_EQZ: sp[-1].i32 = sp[-1].i32 == 0; break;
+      case IN_I32_EQ: --sp; sp[-1].i32 = sp[-1].i32 == sp[0].i32; break;
+      case IN_I32_NE: --sp; sp[-1].i32 = sp[-1].i32 != sp[0].i32; break;
+      case IN_I32_LT_S: --sp; sp[-1].i32 = sp[-1].i32 < sp[0].i32; break;
+      case IN_I32_LT_U: --sp; sp[-1].i32 = sp[-1].u32 < sp[0].u32; break;
+      case IN_I32_GT_S: --sp; sp[-1].i32 = sp[-1].i32 > sp[0].i32; break;
+      case IN_I32_GT_U: --sp; sp[-1].i32 = sp[-1].u32 > sp[0].u32; break;
+      case IN_I32_LE_S: --sp; sp[-1].i32 = sp[-1].i32 <= sp[0].i32; break;
+      case IN_I32_LE_U: --sp; sp[-1].i32 = sp[-1].u32 <= sp[0].u32; break;
+      case IN_I32_GE_S: --sp; sp[-1].i32 = sp[-1].i32 >= sp[0].i32; break;
+      case IN_I32_GE_U: --sp; sp[-1].i32 = sp[-1].u32 >= sp[0].u32; break;
+      /* i64 comparisons */
+      case IN_I64_EQZ: sp[-1].i32 = sp[-1].i64 == 0; break;
+      case IN_I64_EQ: --sp; sp[-1].i32 = sp[-1].i64 == sp[0].i64; break;
+      case IN_I64_NE: --sp; sp[-1].i32 = sp[-1].i64 != sp[0].i64; break;
+      case IN_I64_LT_S: --sp; sp[-1].i32 = sp[-1].i64 < sp[0].i64; break;
+      case IN_I64_LT_U: --sp; sp[-1].i32 = sp[-1].u64 < sp[0].u64; break;
+      case IN_I64_GT_S: --sp; sp[-1].i32 = sp[-1].i64 > sp[0].i64; break;
+      case IN_I64_GT_U: --sp; sp[-1].i32 = sp[-1].u64 > sp[0].u64; break;
+      case IN_I64_LE_S: --sp; sp[-1].i32 = sp[-1].i64 <= sp[0].i64; break;
+      case IN_I64_LE_U: --sp; sp[-1].i32 = sp[-1].u64 <= sp[0].u64; break;
+      case IN_I64_GE_S: --sp; sp[-1].i32 = sp[-1].i64 >= sp[0].i64; break;
+      case IN_I64_GE_U: --sp; sp[-1].i32 = sp[-1].u64 >= sp[0].u64; break;
+      /* f32/f64 comparisons */
+      case IN_F32_EQ: --sp; sp[-1].i32 = sp[-1].f32 == sp[0].f32; break;
+      case IN_F32_NE: --sp; sp[-1].i32 = sp[-1].f32 != sp[0].f32; break;
+      case IN_F32_LT: --sp; sp[-1].i32 = sp[-1].f32 < sp[0].f32; break;
+      case IN_F32_GT: --sp; sp[-1].i32 = sp[-1].f32 > sp[0].f32; break;
+      case IN_F32_LE: --sp; sp[-1].i32 = sp[-1].f32 <= sp[0].f32; break;
+      case IN_F32_GE: --sp; sp[-1].i32 = sp[-1].f32 >= sp[0].f32; break;
+      case IN_F64_EQ: --sp; sp[-1].i32 = sp[-1].f64 == sp[0].f64; break;
+      case IN_F64_NE: --sp; sp[-1].i32 = sp[-1].f64 != sp[0].f64; break;
+      case IN_F64_LT: --sp; sp[-1].i32 = sp[-1].f64 < sp[0].f64; break;
+      case IN_F64_GT: --sp; sp[-1].i32 = sp[-1].f64 > sp[0].f64; break;
+      case IN_F64_LE: --sp; sp[-1].i32 = sp[-1].f64 <= sp[0].f64; break;
+      case IN_F64_GE: --sp; sp[-1].i32 = sp[-1].f64 >= sp[0].f64; break;
+      /* i32 arithmetics */
+      case IN_I32_CLZ: sp[-1].u32 = rt_clz64(sp[-1].u32) - 32; break;
+      case IN_I32_CTZ: sp[-1].u32 = sp[-1].u32 == 0 ? 32 : rt_ctz64(sp[-1].u32); break;
+      case IN_I32_POPCNT: sp[-1].u32 = rt_popcnt64(sp[-1].u32); break;
+      case IN_I32_ADD: --sp; sp[-1].u32 += sp[0].u32; break;
+      case IN_I32_SUB: --sp; sp[-1].u32 -= sp[0].u32; break;
+      case IN_I32_MUL: --sp; sp[-1].u32 *= sp[0].u32; break;
+      case IN_I32_DIV_S: case IN_I32_REM_S: {
+        int x = sp[-2].i32, y = sp[-1].i32; --sp;
+        if (y == 0) rt_trap(prt, "integer divide by zero");
+        if (y == -1 && x == INT_MIN && pi->op == IN_I32_DIV_S) rt_trap(prt, "integer overflow");
+        if (y == -1) sp[-1].u32 = (pi->op == IN_I32_REM_S) ? 0 : 0U - (unsigned)x;
+        else sp[-1].i32 = (pi->op == IN_I32_REM_S) ? x % y : x / y;
+      } break;
+      case IN_I32_DIV_U: case IN_I32_REM_U: {
+        unsigned x = sp[-2].u32, y = sp[-1].u32; --sp;
+        if (y == 0) rt_trap(prt, "integer divide by zero");
+        sp[-1].u32 = (pi->op == IN_I32_REM_U) ? x % y : x / y;
+      } break;
+      case IN_I32_AND: --sp; sp[-1].u32 &= sp[0].u32; break;
+      case IN_I32_OR: --sp; sp[-1].u32 |= sp[0].u32; break;
+      case IN_I32_XOR: --sp; sp[-1].u32 ^= sp[0].u32; break;
+      case IN_I32_SHL: --sp; sp[-1].u32 <<= sp[0].u32 & 31; break;
+      case IN_I32_SHR_S: --sp; sp[-1].i32 >>= (int)(sp[0].u32 & 31); break;
+      case IN_I32_SHR_U: --sp; sp[-1].u32 >>= sp[0].u32 & 31; break;
+      case IN_I32_ROTL: case IN_I32_ROTR: {
+        unsigned x = sp[-2].u32, k = sp[-1].u32 & 31; --sp;
+        if (pi->op == IN_I32_ROTR) k = (32 - k) & 31;
+        sp[-1].u32 = k == 0 ? x : (x << k) | (x >> (32 - k));
+      } break;
+      /* i64 arithmetics */
+      case IN_I64_CLZ: sp[-1].u64 = rt_clz64(sp[-1].u64); break;
+      case IN_I64_CTZ: sp[-1].u64 = rt_ctz64(sp[-1].u64); break;
+      case IN_I64_POPCNT: sp[-1].u64 = rt_popcnt64(sp[-1].u64); break;
+      case IN_I64_ADD: --sp; sp[-1].u64 += sp[0].u64; break;
+      case IN_I64_SUB: --sp; sp[-1].u64 -= sp[0].u64; break;
+      case IN_I64_MUL: --sp; sp[-1].u64 *= sp[0].u64; break;
+      case IN_I64_DIV_S: case IN_I64_REM_S: {
+        long long x = sp[-2].i64, y = sp[-1].i64; --sp;
+        if (y == 0) rt_trap(prt, "integer divide by zero");
+        if (y == -1 && x == LLONG_MIN && pi->op == IN_I64_DIV_S) rt_trap(prt, "integer overflow");
+        if (y == -1) sp[-1].u64 = (pi->op == IN_I64_REM_S) ? 0 : 0ULL - (unsigned long long)x;
+        else sp[-1].i64 = (pi->op == IN_I64_REM_S) ? x % y : x / y;
+      } break;
+      case IN_I64_DIV_U: case IN_I64_REM_U: {
+        unsigned long long x = sp[-2].u64, y = sp[-1].u64; --sp;
+        if (y == 0) rt_trap(prt, "integer divide by zero");
+        sp[-1].u64 = (pi->op == IN_I64_REM_U) ? x % y : x / y;
+      } break;
+      case IN_I64_AND: --sp; sp[-1].u64 &= sp[0].u64; break;
+      case IN_I64_OR: --sp; sp[-1].u64 |= sp[0].u64; break;
+      case IN_I64_XOR: --sp; sp[-1].u64 ^= sp[0].u64; break;
+      case IN_I64_SHL: --sp; sp[-1].u64 <<= sp[0].u64 & 63; break;
+      case IN_I64_SHR_S: --sp; sp[-1].i64 >>= (long long)(sp[0].u64 & 63); break;
+      case IN_I64_SHR_U: --sp; sp[-1].u64 >>= sp[0].u64 & 63; break;
+      case IN_I64_ROTL: case IN_I64_ROTR: {
+        unsigned long long x = sp[-2].u64; unsigned k = (unsigned)(sp[-1].u64 & 63); --sp;
+        if (pi->op == IN_I64_ROTR) k = (64 - k) & 63;
+        sp[-1].u64 = k == 0 ? x : (x << k) | (x >> (64 - k));
+      } break;
+      /* f32 arithmetics */
+      case IN_F32_ABS: sp[-1].u32 &= 0x7FFFFFFFU; break;
+      case IN_F32_NEG: sp[-1].u32 ^= 0x80000000U; break;
+      case IN_F32_CEIL: sp[-1].f32 = (float)rt_fceil((double)sp[-1].f32); break;
+      case IN_F32_FLOOR: sp[-1].f32 = (float)rt_ffloor((double)sp[-1].f32); break;
+      case IN_F32_TRUNC: sp[-1].f32 = (float)rt_ftrunc((double)sp[-1].f32); break;
+      case IN_F32_NEAREST: sp[-1].f32 = (float)rt_fnearest((double)sp[-1].f32); break;
+      case IN_F32_SQRT: sp[-1].f32 = (float)rt_fsqrt((double)sp[-1].f32); break;
+      case IN_F32_ADD: --sp; sp[-1].f32 += sp[0].f32; break;
+      case IN_F32_SUB: --sp; sp[-1].f32 -= sp[0].f32; break;
+      case IN_F32_MUL: --sp; sp[-1].f32 *= sp[0].f32; break;
+      case IN_F32_DIV: --sp; sp[-1].f32 /= sp[0].f32; break;
+      case IN_F32_MIN: --sp; sp[-1].f32 = rt_fminf(sp[-1].f32, sp[0].f32); break;
+      case IN_F32_MAX: --sp; sp[-1].f32 = rt_fmaxf(sp[-1].f32, sp[0].f32); break;
+      case IN_F32_COPYSIGN: {
+        --sp; sp[-1].u32 = (sp[-1].u32 & 0x7FFFFFFFU) | (sp[0].u32 & 0x80000000U);
+      } break;
+      /* f64 arithmetics */
+      case IN_F64_ABS: sp[-1].u64 &= 0x7FFFFFFFFFFFFFFFULL; break;
+      case IN_F64_NEG: sp[-1].u64 ^= 0x8000000000000000ULL; break;
+      case IN_F64_CEIL: sp[-1].f64 = rt_fceil(sp[-1].f64); break;
+      case IN_F64_FLOOR: sp[-1].f64 = rt_ffloor(sp[-1].f64); break;
+      case IN_F64_TRUNC: sp[-1].f64 = rt_ftrunc(sp[-1].f64); break;
+      case IN_F64_NEAREST: sp[-1].f64 = rt_fnearest(sp[-1].f64); break;
+      case IN_F64_SQRT: sp[-1].f64 = rt_fsqrt(sp[-1].f64); break;
+      case IN_F64_ADD: --sp; sp[-1].f64 += sp[0].f64; break;
+      case IN_F64_SUB: --sp; sp[-1].f64 -= sp[0].f64; break;
+      case IN_F64_MUL: --sp; sp[-1].f64 *= sp[0].f64; break;
+      case IN_F64_DIV: --sp; sp[-1].f64 /= sp[0].f64; break;
+      case IN_F64_MIN: --sp; sp[-1].f64 = rt_fmin(sp[-1].f64, sp[0].f64); break;
+      case IN_F64_MAX: --sp; sp[-1].f64 = rt_fmax(sp[-1].f64, sp[0].f64); break;
+      case IN_F64_COPYSIGN: {
+        --sp; sp[-1].u64 = (sp[-1].u64 & 0x7FFFFFFFFFFFFFFFULL) | (sp[0].u64 & 0x8000000000000000ULL);
+      } break;
+      /* conversions */
+      case IN_I32_WRAP_I64: sp[-1].u32 = (unsigned)sp[-1].u64; break;
+      case IN_I32_TRUNC_F32_S: case IN_I32_TRUNC_F64_S: {
+        double x = pi->op == IN_I32_TRUNC_F32_S ? (double)sp[-1].f32 : sp[-1].f64;
+        sp[-1].i32 = (int)rt_trunc(prt, x, RT_I32MIN - 1.0, RT_I32MAX + 1.0);
+      } break;
+      case IN_I32_TRUNC_F32_U: case IN_I32_TRUNC_F64_U: {
+        double x = pi->op == IN_I32_TRUNC_F32_U ? (double)sp[-1].f32 : sp[-1].f64;
+        sp[-1].u32 = (unsigned)rt_trunc(prt, x, -1.0, RT_U32MAX + 1.0);
+      } break;
+      case IN_I64_TRUNC_F32_S: case IN_I64_TRUNC_F64_S: {
+        double x = pi->op == IN_I64_TRUNC_F32_S ? (double)sp[-1].f32 : sp[-1].f64;
+        if (x == RT_I64MIN) sp[-1].i64 = LLONG_MIN;
+        else sp[-1].i64 = (long long)rt_trunc(prt, x, RT_I64MIN, RT_I64LIM);
+      } break;
+      case IN_I64_TRUNC_F32_U: case IN_I64_TRUNC_F64_U: {
+        double x = pi->op == IN_I64_TRUNC_F32_U ? (double)sp[-1].f32 : sp[-1].f64;
+        sp[-1].u64 = (unsigned long long)rt_trunc(prt, x, -1.0, RT_U64LIM);
+      } break;
+      case IN_I32_TRUNC_SAT_F32_S: case IN_I32_TRUNC_SAT_F64_S: {
+        double x = pi->op == IN_I32_TRUNC_SAT_F32_S ? (double)sp[-1].f32 : sp[-1].f64;
+        int s = rt_sat(x, RT_I32MIN, RT_I32MAX);
+        sp[-1].i32 = x != x ? 0 : s < 0 ? INT_MIN : s > 0 ? INT_MAX : (int)x;
+      } break;
+      case IN_I32_TRUNC_SAT_F32_U: case IN_I32_TRUNC_SAT_F64_U: {
+        double x = pi->op == IN_I32_TRUNC_SAT_F32_U ? (double)sp[-1].f32 : sp[-1].f64;
+        int s = rt_sat(x, 0.0, RT_U32MAX);
+        sp[-1].u32 = x != x ? 0 : s < 0 ? 0 : s > 0 ? UINT_MAX : (unsigned)x;
+      } break;
+      case IN_I64_TRUNC_SAT_F32_S: case IN_I64_TRUNC_SAT_F64_S: {
+        double x = pi->op == IN_I64_TRUNC_SAT_F32_S ? (double)sp[-1].f32 : sp[-1].f64;
+        int s = rt_sat(x, RT_I64MIN, RT_I64LIM);
+        sp[-1].i64 = x != x ? 0 : s < 0 ? LLONG_MIN : s > 0 ? LLONG_MAX : (long long)x;
+      } break;
+      case IN_I64_TRUNC_SAT_F32_U: case IN_I64_TRUNC_SAT_F64_U: {
+        double x = pi->op == IN_I64_TRUNC_SAT_F32_U ? (double)sp[-1].f32 : sp[-1].f64;
+        int s = rt_sat(x, 0.0, RT_U64LIM);
+        sp[-1].u64 = x != x ? 0 : s < 0 ? 0 : s > 0 ? ULLONG_MAX : (unsigned long long)x;
+      } break;
+      case IN_I64_EXTEND_I32_S: sp[-1].i64 = sp[-1].i32; break;
+      case IN_I64_EXTEND_I32_U: sp[-1].u64 = sp[-1].u32; break;
+      case IN_F32_CONVERT_I32_S: sp[-1].f32 = (float)sp[-1].i32; break;
+      case IN_F32_CONVERT_I32_U: sp[-1].f32 = (float)sp[-1].u32; break;
+      case IN_F32_CONVERT_I64_S: sp[-1].f32 = (float)sp[-1].i64; break;
+      case IN_F32_CONVERT_I64_U: sp[-1].f32 = (float)sp[-1].u64; break;
+      case IN_F32_DEMOTE_F64: sp[-1].f32 = (float)sp[-1].f64; break;
+      case IN_F64_CONVERT_I32_S: sp[-1].f64 = (double)sp[-1].i32; break;
+      case IN_F64_CONVERT_I32_U: sp[-1].f64 = (double)sp[-1].u32; break;
+      case IN_F64_CONVERT_I64_S: sp[-1].f64 = (double)sp[-1].i64; break;
+      case IN_F64_CONVERT_I64_U: sp[-1].f64 = (double)sp[-1].u64; break;
+      case IN_F64_PROMOTE_F32: sp[-1].f64 = (double)sp[-1].f32; break;
+      case IN_I32_EXTEND8_S: sp[-1].i32 = (signed char)sp[-1].i32; break;
+      case IN_I32_EXTEND16_S: sp[-1].i32 = (short)sp[-1].i32; break;
+      case IN_I64_EXTEND8_S: sp[-1].i64 = (signed char)sp[-1].i64; break;
+      case IN_I64_EXTEND16_S: sp[-1].i64 = (short)sp[-1].i64; break;
+      case IN_I64_EXTEND32_S: sp[-1].i64 = (int)sp[-1].i64; break;
+      default: assert(false);
+    }
+  }
+}
+
+/* evaluate constant initializer code */
+static unsigned long long rt_const(icbuf_t *pcb)
+{
+  inscode_t *pic;
+  if (icblen(pcb) == 0) return 0;
+  pic = icbref(pcb, 0);
+  assert(IN_I32_CONST <= pic->in && pic->in <= IN_F64_CONST);
+  return pic->arg.u;
+}
+
+int run_wasm_module(wasm_module_t *pm, int argc, char **argv)
+{
+  rt_t rt; size_t i, k, starti = SIZE_MAX, mainfi = SIZE_MAX;
+  sym_t startid = intern("_start");
+  memset(&rt, 0, sizeof(rt_t));
+  rt.pm = pm; rt.argc = argc; rt.argv = argv;
+  bufinit(&rt.funcs, sizeof(rfunc_t)); bufinit(&rt.code, sizeof(rins_t));
+  /* functions */
+  for (i = 0; i < entblen(&pm->funcdefs); ++i) {
+    entry_t *pe = entbref(&pm->funcdefs, i);
+    rfunc_t *pf = bufnewbk(&rt.funcs);
+    funcsig_t *pfs = fsbref(&pm->funcsigs, pe->fsi);
+    pf->fsi = pe->fsi;
+    pf->npar = (unsigned)vtblen(&pfs->partypes);
+    pf->nres = (unsigned)vtblen(&pfs->restypes);
+    pf->nloc = pf->npar + (unsigned)vtblen(&pe->loctypes);
+    if (pe->imported) {
+      pf->host = true;
+      pf->hid = pe->mod == g_wasi_mod || pe->mod == g_wasit_mod ? rt_host_id(pe->name) : RH_UNSUPPORTED;
+      if (pf->hid == RH_UNSUPPORTED)
+        logef("# warning: import %s:%s is not supported\n", symname(pe->mod), symname(pe->name));
+    }
+    if (pe->isstart) starti = i;
+    if (pe->exported && pe->name == startid) mainfi = i;
+  }
+  for (i = 0; i < entblen(&pm->funcdefs); ++i) {
+    if (!entbref(&pm->funcdefs, i)->imported) rt_decode_func(&rt, i);
+  }
+  if (mainfi == SIZE_MAX) eprintf("cannot run module: no exported _start() function");
+  /* globals */
+  rt.globals = ecalloc(entblen(&pm->globdefs) + 1, sizeof(rval_t));
+  for (i = 0; i < entblen(&pm->globdefs); ++i) {
+    rt.globals[i].u64 = rt_const(&entbref(&pm->globdefs, i)->code);
+  }
+  /* table */
+  for (i = 0; i < entblen(&pm->tabdefs); ++i) {
+    entry_t *pe = entbref(&pm->tabdefs, i);
+    rt.tabsz = pe->n;
+  }
+  rt.table = emalloc((rt.tabsz + 1) * sizeof(unsigned));
+  for (i = 0; i <= rt.tabsz; ++i) rt.table[i] = UINT_MAX;
+  for (i = 0; i < esegblen(&pm->elemdefs); ++i) {
+    eseg_t *ps = esegbref(&pm->elemdefs, i);
+    size_t off = (size_t)rt_const(&ps->code);
+    for (k = 0; k < idxblen(&ps->fidxs); ++k) {
+      if (off + k >= rt.tabsz) eprintf("cannot run module: element segment is out of table bounds");
+      rt.table[off + k] = *idxbref(&ps->fidxs, k);
+    }
+  }
+  /* memory */
+  rt.maxmemsz = 65536ULL * RT_PAGESZ;
+  for (i = 0; i < entblen(&pm->memdefs); ++i) {
+    entry_t *pe = entbref(&pm->memdefs, i);
+    rt.memsz = (unsigned long long)pe->n * RT_PAGESZ;
+    if (pe->lt != LT_MIN) rt.maxmemsz = (unsigned long long)pe->m * RT_PAGESZ;
+    rt.shared = pe->lt == LT_MINMAX_SHARED;
+  }
+  rt.mem = ecalloc((size_t)rt.memsz + 1, 1);
+  rt.dropped = ecalloc(dsegblen(&pm->datadefs) + 1, sizeof(bool));
+  for (i = 0; i < dsegblen(&pm->datadefs); ++i) {
+    dseg_t *ps = dsegbref(&pm->datadefs, i);
+    unsigned long long off = rt_const(&ps->code) & 0xFFFFFFFFULL;
+    if (ps->dsm == DS_PASSIVE) continue; /* copied by memory.init */
+    if (off + buflen(&ps->data) > rt.memsz) eprintf("cannot run module: data segment is out of memory bounds");
+    memcpy(rt.mem + (size_t)off, bufdata(&ps->data), buflen(&ps->data));
+  }
+  /* stacks and files */
+  rt.stk = emalloc(RT_STKSZ * sizeof(rval_t)); rt.stkend = rt.stk + RT_STKSZ;
+  rt.frames = emalloc(RT_MAXFRAMES * sizeof(rframe_t));
+  rt.fds[0] = stdin; rt.fds[1] = stdout; rt.fds[2] = stderr;
+  rt.dirs[RT_PREOPENFD] = estrdup(".");
+  /* run */
+  rt.t0 = clock();
+  if (starti != SIZE_MAX) rt_exec(&rt, starti);
+  rt_exec(&rt, mainfi);
+  fflush(stdout);
+  rt_report(&rt);
+  /* done */
+  for (i = RT_PREOPENFD+1; i < RT_MAXFDS; ++i) if (rt.fds[i] != NULL) fclose(rt.fds[i]);
+  for (i = RT_PREOPENFD; i < RT_MAXFDS; ++i) free(rt.dirs[i]);
+  free(rt.frames); free(rt.stk); free(rt.mem); free(rt.table); free(rt.globals);
+  free(rt.dropped);
+  buffini(&rt.code); buffini(&rt.funcs);
+  return EXIT_SUCCESS;
+}
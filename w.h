@@ -22,7 +22,8 @@ typedef enum functype {
 
 typedef enum limtype {
   LT_MIN = 0x00,     /* followed by single u32 */
-  LT_MINMAX = 0x01   /* followed by two u32s */
+  LT_MINMAX = 0x01,  /* followed by two u32s */
+  LT_MINMAX_SHARED = 0x03 /* ditto, shared memory (threads) */
 } limtype_t;
 
 typedef enum muttype {
@@ -525,6 +526,74 @@ typedef enum instr {
   IN_I32X4_TRUNC_SAT_F64X2_U_ZERO = 0xFDFD01,
   IN_F64X2_CONVERT_LOW_I32X4_S = 0xFDFE01,
   IN_F64X2_CONVERT_LOW_I32X4_U = 0xFDFF01,
+  /* threads multibyte, not in core-1 */
+  IN_MEMORY_ATOMIC_NOTIFY /* memarg */ = 0xFE00,
+  IN_MEMORY_ATOMIC_WAIT32 /* memarg */ = 0xFE01,
+  IN_MEMORY_ATOMIC_WAIT64 /* memarg */ = 0xFE02,
+  IN_ATOMIC_FENCE = 0xFE03,
+  IN_I32_ATOMIC_LOAD /* memarg */ = 0xFE10,
+  IN_I64_ATOMIC_LOAD /* memarg */ = 0xFE11,
+  IN_I32_ATOMIC_LOAD8_U /* memarg */ = 0xFE12,
+  IN_I32_ATOMIC_LOAD16_U /* memarg */ = 0xFE13,
+  IN_I64_ATOMIC_LOAD8_U /* memarg */ = 0xFE14,
+  IN_I64_ATOMIC_LOAD16_U /* memarg */ = 0xFE15,
+  IN_I64_ATOMIC_LOAD32_U /* memarg */ = 0xFE16,
+  IN_I32_ATOMIC_STORE /* memarg */ = 0xFE17,
+  IN_I64_ATOMIC_STORE /* memarg */ = 0xFE18,
+  IN_I32_ATOMIC_STORE8 /* memarg */ = 0xFE19,
+  IN_I32_ATOMIC_STORE16 /* memarg */ = 0xFE1A,
+  IN_I64_ATOMIC_STORE8 /* memarg */ = 0xFE1B,
+  IN_I64_ATOMIC_STORE16 /* memarg */ = 0xFE1C,
+  IN_I64_ATOMIC_STORE32 /* memarg */ = 0xFE1D,
+  IN_I32_ATOMIC_RMW_ADD /* memarg */ = 0xFE1E,
+  IN_I64_ATOMIC_RMW_ADD /* memarg */ = 0xFE1F,
+  IN_I32_ATOMIC_RMW8_ADD_U /* memarg */ = 0xFE20,
+  IN_I32_ATOMIC_RMW16_ADD_U /* memarg */ = 0xFE21,
+  IN_I64_ATOMIC_RMW8_ADD_U /* memarg */ = 0xFE22,
+  IN_I64_ATOMIC_RMW16_ADD_U /* memarg */ = 0xFE23,
+  IN_I64_ATOMIC_RMW32_ADD_U /* memarg */ = 0xFE24,
+  IN_I32_ATOMIC_RMW_SUB /* memarg */ = 0xFE25,
+  IN_I64_ATOMIC_RMW_SUB /* memarg */ = 0xFE26,
+  IN_I32_ATOMIC_RMW8_SUB_U /* memarg */ = 0xFE27,
+  IN_I32_ATOMIC_RMW16_SUB_U /* memarg */ = 0xFE28,
+  IN_I64_ATOMIC_RMW8_SUB_U /* memarg */ = 0xFE29,
+  IN_I64_ATOMIC_RMW16_SUB_U /* memarg */ = 0xFE2A,
+  IN_I64_ATOMIC_RMW32_SUB_U /* memarg */ = 0xFE2B,
+  IN_I32_ATOMIC_RMW_AND /* memarg */ = 0xFE2C,
+  IN_I64_ATOMIC_RMW_AND /* memarg */ = 0xFE2D,
+  IN_I32_ATOMIC_RMW8_AND_U /* memarg */ = 0xFE2E,
+  IN_I32_ATOMIC_RMW16_AND_U /* memarg */ = 0xFE2F,
+  IN_I64_ATOMIC_RMW8_AND_U /* memarg */ = 0xFE30,
+  IN_I64_ATOMIC_RMW16_AND_U /* memarg */ = 0xFE31,
+  IN_I64_ATOMIC_RMW32_AND_U /* memarg */ = 0xFE32,
+  IN_I32_ATOMIC_RMW_OR /* memarg */ = 0xFE33,
+  IN_I64_ATOMIC_RMW_OR /* memarg */ = 0xFE34,
+  IN_I32_ATOMIC_RMW8_OR_U /* memarg */ = 0xFE35,
+  IN_I32_ATOMIC_RMW16_OR_U /* memarg */ = 0xFE36,
+  IN_I64_ATOMIC_RMW8_OR_U /* memarg */ = 0xFE37,
+  IN_I64_ATOMIC_RMW16_OR_U /* memarg */ = 0xFE38,
+  IN_I64_ATOMIC_RMW32_OR_U /* memarg */ = 0xFE39,
+  IN_I32_ATOMIC_RMW_XOR /* memarg */ = 0xFE3A,
+  IN_I64_ATOMIC_RMW_XOR /* memarg */ = 0xFE3B,
+  IN_I32_ATOMIC_RMW8_XOR_U /* memarg */ = 0xFE3C,
+  IN_I32_ATOMIC_RMW16_XOR_U /* memarg */ = 0xFE3D,
+  IN_I64_ATOMIC_RMW8_XOR_U /* memarg */ = 0xFE3E,
+  IN_I64_ATOMIC_RMW16_XOR_U /* memarg */ = 0xFE3F,
+  IN_I64_ATOMIC_RMW32_XOR_U /* memarg */ = 0xFE40,
+  IN_I32_ATOMIC_RMW_XCHG /* memarg */ = 0xFE41,
+  IN_I64_ATOMIC_RMW_XCHG /* memarg */ = 0xFE42,
+  IN_I32_ATOMIC_RMW8_XCHG_U /* memarg */ = 0xFE43,
+  IN_I32_ATOMIC_RMW16_XCHG_U /* memarg */ = 0xFE44,
+  IN_I64_ATOMIC_RMW8_XCHG_U /* memarg */ = 0xFE45,
+  IN_I64_ATOMIC_RMW16_XCHG_U /* memarg */ = 0xFE46,
+  IN_I64_ATOMIC_RMW32_XCHG_U /* memarg */ = 0xFE47,
+  IN_I32_ATOMIC_RMW_CMPXCHG /* memarg */ = 0xFE48,
+  IN_I64_ATOMIC_RMW_CMPXCHG /* memarg */ = 0xFE49,
+  IN_I32_ATOMIC_RMW8_CMPXCHG_U /* memarg */ = 0xFE4A,
+  IN_I32_ATOMIC_RMW16_CMPXCHG_U /* memarg */ = 0xFE4B,
+  IN_I64_ATOMIC_RMW8_CMPXCHG_U /* memarg */ = 0xFE4C,
+  IN_I64_ATOMIC_RMW16_CMPXCHG_U /* memarg */ = 0xFE4D,
+  IN_I64_ATOMIC_RMW32_CMPXCHG_U /* memarg */ = 0xFE4E,
   /* internal use */
   IN_PLACEHOLDER = -1,
   IN_REGDECL = -2,
@@ -721,6 +790,7 @@ typedef struct watie {
   unsigned n;     /* MEM: min limit/DATA: size (import only) */
   unsigned m;     /* MEM: max limit */
   int align;      /* DATA: alignment in bytes: 1,2,4,8,16 */
+  bool passive;   /* DATA: passive segment, copied by memory.init */
   buf_t data;     /* DATA: bytes (export only) */
   icbuf_t code;   /* FUNC: code (export only) */
   buf_t table;    /* TABLE: dpme_t */
@@ -766,8 +836,17 @@ extern void read_wat_executable_module(const char *fname, wat_module_t* pm);
 extern void load_library_wat_module(sym_t mod, wat_module_t* pm);
 extern void write_wat_module(wat_module_t* pm, FILE *pf);
 
+/* read/write wcpl binary object modules (.wbo) */
+/* returns false if fname can't be opened; exits on bad content */
+extern bool read_wbo_module(const char *fname, wat_module_t* pm);
+extern void write_wbo_module(wat_module_t* pm, FILE *pf);
+
 /* linker */
 extern void link_wat_modules(wat_module_buf_t *pwb, wat_module_t* pm); 
 
 /* wat-to-wasm converter */
 extern void wat_to_wasm(wat_module_t *ptm, wasm_module_t *pbm);
+
+/* interpreter: runs linked module's _start() with WASI on top of
+ * host stdio; returns program's exit code */
+extern int run_wasm_module(wasm_module_t *pm, int argc, char **argv);